@@ -35,6 +35,7 @@ int main(int argc, char* argv[])
 	auto& windowSwapchain = renderSystem.CreateSwapchain(mainWindow);
 
 	Nz::Canvas canvas2D(world, mainWindow.GetEventHandler(), mainWindow.GetCursorController().CreateHandle(), 0xFFFFFFFF);
+	canvas2D.EnableDeferredLayout();
 	canvas2D.Resize(Nz::Vector2f(mainWindow.GetSize()));
 
 	Nz::LabelWidget* labelWidget = canvas2D.Add<Nz::LabelWidget>();
@@ -110,6 +111,11 @@ int main(int argc, char* argv[])
 			progressBarWidget->SetFraction(progressBarWidget->GetFraction() + 0.1001f); //< ensures ten clicks go over 1
 	});
 
+	app.AddUpdaterFunc([&]
+	{
+		canvas2D.UpdateLayout();
+	});
+
 	entt::handle viewer2D = world.CreateEntity();
 	{
 		viewer2D.emplace<Nz::NodeComponent>();
@@ -42,6 +42,7 @@
 #include <Nazara/Core/ApplicationUpdater.hpp>
 #include <Nazara/Core/Buffer.hpp>
 #include <Nazara/Core/BufferMapper.hpp>
+#include <Nazara/Core/BufferedImageStream.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/ByteStream.hpp>
@@ -77,10 +78,12 @@
 #include <Nazara/Core/Joint.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/MaterialData.hpp>
+#include <Nazara/Core/MaxRectsBinPack.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Core/Mesh.hpp>
 #include <Nazara/Core/MeshData.hpp>
+#include <Nazara/Core/MipStreamingScheduler.hpp>
 #include <Nazara/Core/ModuleBase.hpp>
 #include <Nazara/Core/Modules.hpp>
 #include <Nazara/Core/Node.hpp>
@@ -108,6 +111,7 @@
 #include <Nazara/Core/SignalHandlerAppComponent.hpp>
 #include <Nazara/Core/SkeletalMesh.hpp>
 #include <Nazara/Core/Skeleton.hpp>
+#include <Nazara/Core/SkylineBinPack.hpp>
 #include <Nazara/Core/SoftwareBuffer.hpp>
 #include <Nazara/Core/State.hpp>
 #include <Nazara/Core/StateMachine.hpp>
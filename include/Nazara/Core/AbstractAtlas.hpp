@@ -33,6 +33,7 @@ namespace Nz
 			virtual std::size_t GetLayerCount() const = 0;
 			virtual DataStoreFlags GetStorage() const = 0;
 			virtual bool Insert(const Image& image, Rectui* rect, bool* flipped, std::size_t* layerIndex) = 0;
+			virtual bool Insert(SparsePtr<const Image> images, SparsePtr<Rectui> rects, SparsePtr<bool> flipped, SparsePtr<std::size_t> layerIndices, std::size_t count);
 
 			AbstractAtlas& operator=(const AbstractAtlas&) = delete;
 			AbstractAtlas& operator=(AbstractAtlas&&) noexcept = default;
@@ -40,6 +41,7 @@ namespace Nz
 			// Signals:
 			NazaraSignal(OnAtlasCleared, const AbstractAtlas* /*atlas*/);
 			NazaraSignal(OnAtlasLayerChange, const AbstractAtlas* /*atlas*/, AbstractImage* /*oldLayer*/, AbstractImage* /*newLayer*/);
+			NazaraSignal(OnAtlasRectsRelocated, const AbstractAtlas* /*atlas*/, std::size_t /*layerIndex*/, AbstractImage* /*layer*/, SparsePtr<const Rectui> /*oldRects*/, SparsePtr<const Rectui> /*newRects*/, std::size_t /*count*/);
 			NazaraSignal(OnAtlasRelease, const AbstractAtlas* /*atlas*/);
 	};
 }
@@ -31,6 +31,7 @@
 namespace Nz
 {
 	class ByteArray;
+	class TaskScheduler;
 
 	// Hash
 	template<typename T> ByteArray ComputeHash(HashType hash, T&& v);
@@ -62,6 +63,7 @@ namespace Nz
 		SparsePtr<Vector3f> outputPositions;
 		SparsePtr<Vector3f> outputTangents;
 		SparsePtr<Vector2f> outputUv;
+		UInt32 jointCount = 0; //< if zero, deduced from the joint indices
 	};
 
 	struct VertexPointers
@@ -72,15 +74,32 @@ namespace Nz
 		SparsePtr<Vector2f> uvPtr;
 	};
 
+	// Quantized positions are stored as normalized values, to be remapped using position = offset + value * scale
+	struct PositionQuantization
+	{
+		Vector3f offset = Vector3f::Zero();
+		Vector3f scale = Vector3f::Unit();
+	};
+
 	NAZARA_CORE_API Boxf ComputeAABB(SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount);
 	NAZARA_CORE_API void ComputeBoxIndexVertexCount(const Vector3ui& subdivision, UInt32* indexCount, UInt32* vertexCount);
-	NAZARA_CORE_API UInt32 ComputeCacheMissCount(IndexIterator indices, UInt32 indexCount);
+	NAZARA_CORE_API UInt32 ComputeCacheMissCount(IndexIterator indices, UInt32 indexCount, float* acmr = nullptr, float* atvr = nullptr);
 	NAZARA_CORE_API void ComputeConeIndexVertexCount(unsigned int subdivision, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API void ComputeCubicSphereIndexVertexCount(unsigned int subdivision, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API void ComputeIcoSphereIndexVertexCount(unsigned int recursionLevel, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API void ComputePlaneIndexVertexCount(const Vector2ui& subdivision, UInt32* indexCount, UInt32* vertexCount);
+	NAZARA_CORE_API PositionQuantization ComputePositionQuantization(const Boxf& aabb);
 	NAZARA_CORE_API void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, UInt32* indexCount, UInt32* vertexCount);
 
+	NAZARA_CORE_API Vector3f DecodeOctahedral(const Vector2i16& encodedVector);
+	NAZARA_CORE_API void DequantizeNormals(SparsePtr<const Vector2i16> normals, UInt32 vertexCount, SparsePtr<Vector3f> output);
+	NAZARA_CORE_API void DequantizePositions(SparsePtr<const Vector4i16> positions, UInt32 vertexCount, const PositionQuantization& quantization, SparsePtr<Vector3f> output);
+	NAZARA_CORE_API void DequantizeTexCoords(SparsePtr<const Vector2ui16> texCoords, UInt32 vertexCount, SparsePtr<Vector2f> output);
+
+	NAZARA_CORE_API Vector2i16 EncodeOctahedral(const Vector3f& vector);
+
+	NAZARA_CORE_API UInt16 FloatToHalf(float value);
+
 	NAZARA_CORE_API void GenerateBox(const Vector3f& lengths, const Vector3ui& subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
 	NAZARA_CORE_API void GenerateCone(float length, float radius, unsigned int subdivision, const Matrix4f& matrix, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
 	NAZARA_CORE_API void GenerateCubicSphere(float size, unsigned int subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
@@ -88,9 +107,20 @@ namespace Nz
 	NAZARA_CORE_API void GeneratePlane(const Vector2ui& subdivision, const Vector2f& size, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
 	NAZARA_CORE_API void GenerateUvSphere(float size, unsigned int sliceCount, unsigned int stackCount, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
 
+	NAZARA_CORE_API float HalfToFloat(UInt16 value);
+
 	NAZARA_CORE_API void OptimizeIndices(IndexIterator indices, UInt32 indexCount);
+	NAZARA_CORE_API void OptimizeOverdraw(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positions, float threshold = 1.05f);
+	NAZARA_CORE_API UInt32 OptimizeVertexFetch(IndexIterator indices, UInt32 indexCount, UInt32 vertexCount, UInt32* remap);
+
+	NAZARA_CORE_API void QuantizeNormals(SparsePtr<const Vector3f> normals, UInt32 vertexCount, SparsePtr<Vector2i16> output);
+	NAZARA_CORE_API void QuantizePositions(SparsePtr<const Vector3f> positions, UInt32 vertexCount, const PositionQuantization& quantization, SparsePtr<Vector4i16> output);
+	NAZARA_CORE_API void QuantizeTexCoords(SparsePtr<const Vector2f> texCoords, UInt32 vertexCount, SparsePtr<Vector2ui16> output);
+
+	NAZARA_CORE_API UInt32 SimplifyIndices(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positions, UInt32 vertexCount, UInt32 targetIndexCount, float targetError, UInt32* destination, float* resultError = nullptr);
 
-	NAZARA_CORE_API void SkinLinearBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_CORE_API void SkinDualQuaternionBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount, TaskScheduler* taskScheduler = nullptr);
+	NAZARA_CORE_API void SkinLinearBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount, TaskScheduler* taskScheduler = nullptr);
 
 	inline Vector3f TransformPositionSRT(const Vector3f& transformTranslation, const Quaternionf& transformRotation, const Vector3f& transformScale, const Vector3f& position);
 	inline Vector3f TransformNormalSRT(const Quaternionf& transformRotation, const Vector3f& transformScale, const Vector3f& normal);
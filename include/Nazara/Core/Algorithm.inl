@@ -130,10 +130,13 @@ namespace Nz
 	template<> constexpr ComponentType ComponentTypeId<Vector2f>()    { return ComponentType::Float2; }
 	template<> constexpr ComponentType ComponentTypeId<Vector3f>()    { return ComponentType::Float3; }
 	template<> constexpr ComponentType ComponentTypeId<Vector4f>()    { return ComponentType::Float4; }
+	template<> constexpr ComponentType ComponentTypeId<Vector2ui16>() { return ComponentType::Half2; }
 	template<> constexpr ComponentType ComponentTypeId<int>()         { return ComponentType::Int1; }
 	template<> constexpr ComponentType ComponentTypeId<Vector2i>()    { return ComponentType::Int2; }
 	template<> constexpr ComponentType ComponentTypeId<Vector3i>()    { return ComponentType::Int3; }
 	template<> constexpr ComponentType ComponentTypeId<Vector4i>()    { return ComponentType::Int4; }
+	template<> constexpr ComponentType ComponentTypeId<Vector2i16>()  { return ComponentType::Short2Norm; }
+	template<> constexpr ComponentType ComponentTypeId<Vector4i16>()  { return ComponentType::Short4Norm; }
 
 	template<typename T>
 	constexpr ComponentType GetComponentTypeOf()
@@ -0,0 +1,87 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_BUFFEREDIMAGESTREAM_HPP
+#define NAZARA_CORE_BUFFEREDIMAGESTREAM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	class ImageStream;
+
+	// Decodes an image stream ahead of time on a worker thread, into a ring of frames allocated once
+	// The image stream must not be used by anything else while it's buffered
+	class NAZARA_CORE_API BufferedImageStream
+	{
+		public:
+			struct Frame;
+
+			BufferedImageStream(std::shared_ptr<ImageStream> imageStream, std::size_t bufferedFrameCount = 4, bool loop = false);
+			BufferedImageStream(const BufferedImageStream&) = delete;
+			BufferedImageStream(BufferedImageStream&&) = delete;
+			~BufferedImageStream();
+
+			const Frame* FetchFrame(Time timestamp);
+
+			inline std::size_t GetBufferedFrameCount() const;
+			inline UInt64 GetFrameCount() const;
+			inline PixelFormat GetPixelFormat() const;
+			std::size_t GetReadyFrameCount() const;
+			inline Vector2ui GetSize() const;
+
+			bool IsFinished() const;
+			inline bool IsLooping() const;
+
+			void Seek(UInt64 frameIndex);
+
+			BufferedImageStream& operator=(const BufferedImageStream&) = delete;
+			BufferedImageStream& operator=(BufferedImageStream&&) = delete;
+
+			struct Frame
+			{
+				const void* pixels;
+				Time time; //< presentation time, keeps increasing when looping
+				UInt64 index;
+			};
+
+		private:
+			void DecoderThread();
+			inline bool HasFreeFrame() const;
+
+			mutable std::mutex m_mutex;
+			std::condition_variable m_decoderCondition;
+			std::shared_ptr<ImageStream> m_imageStream;
+			std::thread m_decoderThread;
+			std::unique_ptr<UInt8[]> m_frameArena;
+			std::vector<Frame> m_frames;
+			std::size_t m_frameSize;
+			std::size_t m_readIndex;
+			std::size_t m_readyFrameCount;
+			PixelFormat m_pixelFormat;
+			UInt64 m_frameCount;
+			UInt64 m_seekFrameIndex;
+			Vector2ui m_size;
+			bool m_hasPendingSeek;
+			bool m_hasPresentedFrame;
+			bool m_isEndReached;
+			bool m_isLooping;
+			bool m_stopDecoder;
+	};
+}
+
+#include <Nazara/Core/BufferedImageStream.inl>
+
+#endif // NAZARA_CORE_BUFFEREDIMAGESTREAM_HPP
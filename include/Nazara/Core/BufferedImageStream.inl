@@ -0,0 +1,37 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+namespace Nz
+{
+	inline std::size_t BufferedImageStream::GetBufferedFrameCount() const
+	{
+		return m_frames.size();
+	}
+
+	inline UInt64 BufferedImageStream::GetFrameCount() const
+	{
+		return m_frameCount;
+	}
+
+	inline PixelFormat BufferedImageStream::GetPixelFormat() const
+	{
+		return m_pixelFormat;
+	}
+
+	inline Vector2ui BufferedImageStream::GetSize() const
+	{
+		return m_size;
+	}
+
+	inline bool BufferedImageStream::IsLooping() const
+	{
+		return m_isLooping;
+	}
+
+	inline bool BufferedImageStream::HasFreeFrame() const
+	{
+		// The presented frame stays valid until the next FetchFrame call
+		return m_readyFrameCount + ((m_hasPresentedFrame) ? 1 : 0) < m_frames.size();
+	}
+}
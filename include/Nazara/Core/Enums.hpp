@@ -19,6 +19,15 @@ namespace Nz
 		Max = Static
 	};
 
+	enum class BinPackAlgorithm
+	{
+		Guillotine, //< splits free rectangles in two along an axis, supports rotation and merging of freed rectangles
+		MaxRects,   //< tracks maximal free rectangles, best occupancy for a higher insertion cost
+		Skyline,    //< tracks the top edge of packed rectangles, fastest insertion for rectangles of similar heights (such as glyphs)
+
+		Max = Skyline
+	};
+
 	enum class BlendEquation
 	{
 		Add,
@@ -46,6 +55,15 @@ namespace Nz
 		Zero
 	};
 
+	enum class BlockCompressionQuality
+	{
+		Fast,   //< Single pass endpoint fitting, meant for runtime compression
+		Normal, //< Principal axis fitting with one refinement pass
+		High,   //< Multiple refinement passes and more encoding modes (BC1 3-color, BC4 endpoint search, BC7 partitions)
+
+		Max = High
+	};
+
 	enum class BufferAccess
 	{
 		DiscardAndWrite,
@@ -98,12 +116,15 @@ namespace Nz
 		Float2,
 		Float3,
 		Float4,
+		Half2,
 		Int1,
 		Int2,
 		Int3,
 		Int4,
+		Short2Norm,
+		Short4Norm,
 
-		Max = Int4
+		Max = Short4Norm
 	};
 
 	constexpr std::size_t ComponentTypeCount = static_cast<std::size_t>(ComponentType::Max) + 1;
@@ -206,6 +227,14 @@ namespace Nz
 		Max = FrontAndBack
 	};
 
+	enum class FontGlyphMode
+	{
+		Bitmap,        //< one coverage bitmap per character size and outline thickness
+		DistanceField, //< one signed distance field per character, shared by every size and outline thickness
+
+		Max = DistanceField
+	};
+
 	enum class FrontFace
 	{
 		Clockwise,
@@ -255,6 +284,15 @@ namespace Nz
 
 	constexpr std::size_t HashTypeCount = static_cast<std::size_t>(HashType::Max) + 1;
 
+	enum class MipmapFilter
+	{
+		Box,     //< Averages the source texels covered by each destination texel, fast and sharp enough for most textures
+		Kaiser,  //< Kaiser-windowed sinc, sharper than box with little ringing
+		Lanczos, //< Lanczos-3 windowed sinc, sharpest but may ring around high-contrast edges
+
+		Max = Lanczos
+	};
+
 	enum class OpenMode
 	{
 		NotOpen,    //< File is not open
@@ -313,13 +351,18 @@ namespace Nz
 		Undefined = -1,
 
 		A8,              // 1*uint8
+		BC4,             // 4x4 blocks, 1 channel
+		BC5,             // 4x4 blocks, 2 channels
+		BC6H,            // 4x4 blocks, 3*unsigned half
+		BC7,             // 4x4 blocks, 4 channels
+		BC7_SRGB,        // 4x4 blocks, 4 channels
 		BGR8,            // 3*uint8
 		BGR8_SRGB,       // 3*uint8
 		BGRA8,           // 4*uint8
 		BGRA8_SRGB,      // 4*uint8
-		DXT1,
-		DXT3,
-		DXT5,
+		DXT1,            // 4x4 blocks (BC1)
+		DXT3,            // 4x4 blocks (BC2)
+		DXT5,            // 4x4 blocks (BC3)
 		L8,              // 1*uint8
 		LA8,             // 2*uint8
 		R8,              // 1*uint8
@@ -608,6 +651,7 @@ namespace Nz
 		Unused = -1,
 
 		Color,
+		DistanceField,
 		JointIndices,
 		JointWeights,
 		Normal,
@@ -642,6 +686,8 @@ namespace Nz
 		XYZ_Normal_UV_Tangent_Skinning,
 		UV_SizeSinCos_Color,
 		XYZ_UV,
+		XYZ_Normal_UV_Tangent_Quantized,
+		XYZ_Color_UV_DistanceField,
 
 		// Predefined declarations for instancing
 		Matrix4,
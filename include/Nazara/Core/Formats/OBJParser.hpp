@@ -16,6 +16,7 @@
 namespace Nz
 {
 	class Stream;
+	class TaskScheduler;
 
 	class NAZARA_CORE_API OBJParser
 	{
@@ -46,7 +47,7 @@ namespace Nz
 			inline const Vector3f* GetTexCoords() const;
 			inline std::size_t GetTexCoordCount() const;
 
-			bool Parse(Stream& stream, std::size_t reservedVertexCount = 100);
+			bool Parse(Stream& stream, std::size_t reservedVertexCount = 100, TaskScheduler* taskScheduler = nullptr);
 
 			bool Save(Stream& stream) const;
 
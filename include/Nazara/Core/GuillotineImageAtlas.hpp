@@ -12,7 +12,11 @@
 #include <Nazara/Core/AbstractImage.hpp>
 #include <Nazara/Core/GuillotineBinPack.hpp>
 #include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/MaxRectsBinPack.hpp>
+#include <Nazara/Core/SkylineBinPack.hpp>
 #include <memory>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace Nz
@@ -27,18 +31,24 @@ namespace Nz
 
 			void Clear() override;
 
+			bool Defragment(std::size_t layerIndex);
+
 			void Free(SparsePtr<const Rectui> rects, SparsePtr<std::size_t> layers, std::size_t count) override;
 
 			unsigned int GetMaxLayerSize() const;
+			BinPackAlgorithm GetPackingAlgorithm() const;
 			GuillotineBinPack::FreeRectChoiceHeuristic GetRectChoiceHeuristic() const;
 			GuillotineBinPack::GuillotineSplitHeuristic GetRectSplitHeuristic() const;
 			AbstractImage* GetLayer(std::size_t layerIndex) const override;
 			std::size_t GetLayerCount() const override;
+			float GetLayerOccupancy(std::size_t layerIndex) const;
 			DataStoreFlags GetStorage() const override;
 
 			bool Insert(const Image& image, Rectui* rect, bool* flipped, std::size_t* layerIndex) override;
+			bool Insert(SparsePtr<const Image> images, SparsePtr<Rectui> rects, SparsePtr<bool> flipped, SparsePtr<std::size_t> layerIndices, std::size_t count) override;
 
 			void SetMaxLayerSize(unsigned int maxLayerSize);
+			void SetPackingAlgorithm(BinPackAlgorithm algorithm);
 			void SetRectChoiceHeuristic(GuillotineBinPack::FreeRectChoiceHeuristic heuristic);
 			void SetRectSplitHeuristic(GuillotineBinPack::GuillotineSplitHeuristic heuristic);
 
@@ -48,6 +58,7 @@ namespace Nz
 		protected:
 			struct Layer;
 
+			virtual std::shared_ptr<AbstractImage> RelocateImage(const std::shared_ptr<AbstractImage>& oldImage, const Rectui* oldRects, const Rectui* newRects, std::size_t count) const;
 			virtual std::shared_ptr<AbstractImage> ResizeImage(const std::shared_ptr<AbstractImage>& oldImage, const Vector2ui& size) const;
 			bool ResizeLayer(Layer& layer, const Vector2ui& size);
 
@@ -58,18 +69,27 @@ namespace Nz
 				bool flipped;
 			};
 
+			using BinPack = std::variant<GuillotineBinPack, MaxRectsBinPack, SkylineBinPack>;
+
 			struct Layer
 			{
+				std::unordered_map<UInt64, Rectui> entries; //< live rectangles, by position
 				std::vector<QueuedGlyph> queuedGlyphs;
 				std::shared_ptr<AbstractImage> image;
-				GuillotineBinPack binPack;
+				BinPack binPack;
 				unsigned int freedRectangles = 0;
 			};
 
 		private:
+			BinPack CreateBinPack(const Vector2ui& size) const;
+			bool GrowLastLayer();
+			bool InsertIntoBinPack(Layer& layer, Rectui* rects, bool* flipped, bool* inserted, unsigned int count);
 			void ProcessGlyphQueue(Layer& layer) const;
 
+			static UInt64 GetEntryKey(const Rectui& rect);
+
 			mutable std::vector<Layer> m_layers;
+			BinPackAlgorithm m_packingAlgorithm;
 			GuillotineBinPack::FreeRectChoiceHeuristic m_rectChoiceHeuristic;
 			GuillotineBinPack::GuillotineSplitHeuristic m_rectSplitHeuristic;
 			unsigned int m_maxLayerSize;
@@ -12,6 +12,7 @@
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/CubemapParams.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
 #include <Nazara/Core/Resource.hpp>
 #include <Nazara/Core/ResourceLoader.hpp>
 #include <Nazara/Core/ResourceManager.hpp>
@@ -21,8 +22,6 @@
 #include <NazaraUtils/Signal.hpp>
 #include <atomic>
 
-///TODO: Filtres
-
 namespace Nz
 {
 	struct NAZARA_CORE_API ImageParams : ResourceParameters
@@ -37,7 +36,25 @@ namespace Nz
 		void Merge(const ImageParams& params);
 	};
 
+	struct ImageMipmapParams
+	{
+		MipmapFilter filter = MipmapFilter::Box;
+
+		// Alpha test reference for which the proportion of texels passing the test is preserved across levels (disabled if negative)
+		float alphaCoverageReference = -1.f;
+
+		// Number of levels the image should have (0 for a complete mipmap chain)
+		UInt8 levelCount = 0;
+
+		// Handles 8-bit normalized colors as sRGB-encoded even if the pixel format doesn't say so (_SRGB formats are always filtered in linear space)
+		bool sRGB = false;
+
+		// Wraps texels around borders (for tiling textures) instead of clamping them
+		bool wrap = false;
+	};
+
 	class Image;
+	class TaskScheduler;
 
 	using ImageLibrary = ObjectLibrary<Image>;
 	using ImageLoader = ResourceLoader<Image, ImageParams>;
@@ -57,7 +74,8 @@ namespace Nz
 			inline Image(Image&& image) noexcept;
 			~Image();
 
-			bool Convert(PixelFormat format);
+			bool Convert(PixelFormat format, TaskScheduler* taskScheduler = nullptr);
+			bool Convert(PixelFormat format, const BlockCompressionParams& compressionParams, TaskScheduler* taskScheduler = nullptr);
 
 			void Copy(const Image& source, const Boxui& srcBox, const Vector3ui& dstPos);
 
@@ -71,6 +89,8 @@ namespace Nz
 			bool FlipHorizontally();
 			bool FlipVertically();
 
+			bool GenerateMipmaps(const ImageMipmapParams& params = ImageMipmapParams{}, TaskScheduler* taskScheduler = nullptr);
+
 			const UInt8* GetConstPixels(unsigned int x = 0, unsigned int y = 0, unsigned int z = 0, UInt8 level = 0) const;
 			unsigned int GetDepth(UInt8 level = 0) const;
 			PixelFormat GetFormat() const override;
@@ -23,7 +23,7 @@ namespace Nz
 			IndexBuffer(IndexBuffer&&) noexcept = default;
 			~IndexBuffer() = default;
 
-			UInt64 ComputeCacheMissCount();
+			UInt64 ComputeCacheMissCount(float* acmr = nullptr, float* atvr = nullptr);
 
 			bool Fill(const void* data, UInt64 startIndex, UInt64 length);
 			bool FillRaw(const void* data, UInt64 offset, UInt64 size);
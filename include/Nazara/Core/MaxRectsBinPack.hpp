@@ -0,0 +1,66 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+// Based on the maximal rectangles packer by Jukka Jylänki (public domain)
+// http://clb.demon.fi/projects/even-more-rectangle-bin-packing
+
+#pragma once
+
+#ifndef NAZARA_CORE_MAXRECTSBINPACK_HPP
+#define NAZARA_CORE_MAXRECTSBINPACK_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API MaxRectsBinPack
+	{
+		public:
+			MaxRectsBinPack();
+			MaxRectsBinPack(unsigned int width, unsigned int height);
+			MaxRectsBinPack(const Vector2ui& size);
+			MaxRectsBinPack(const MaxRectsBinPack&) = default;
+			MaxRectsBinPack(MaxRectsBinPack&&) noexcept = default;
+			~MaxRectsBinPack() = default;
+
+			void Clear();
+
+			void Expand(unsigned int newWidth, unsigned newHeight);
+			void Expand(const Vector2ui& newSize);
+
+			void FreeRectangle(const Rectui& rect);
+
+			unsigned int GetHeight() const;
+			float GetOccupancy() const;
+			Vector2ui GetSize() const;
+			unsigned int GetWidth() const;
+
+			bool Insert(Rectui* rects, unsigned int count);
+			bool Insert(Rectui* rects, bool* flipped, unsigned int count);
+			bool Insert(Rectui* rects, bool* flipped, bool* inserted, unsigned int count);
+
+			void Reset();
+			void Reset(unsigned int width, unsigned int height);
+			void Reset(const Vector2ui& size);
+
+			MaxRectsBinPack& operator=(const MaxRectsBinPack&) = default;
+			MaxRectsBinPack& operator=(MaxRectsBinPack&&) noexcept = default;
+
+		private:
+			bool FindPosition(unsigned int width, unsigned int height, std::size_t* freeIndex, unsigned int* shortSideScore, unsigned int* longSideScore) const;
+			bool Insert(Rectui& rect, bool allowFlip, bool* flipped);
+			void PlaceRectangle(const Rectui& rect);
+			void PruneFreeRectangles(std::size_t firstNewIndex);
+
+			std::vector<Rectui> m_freeRectangles; //< maximal free rectangles, they may overlap each other
+			unsigned int m_height;
+			unsigned int m_usedArea;
+			unsigned int m_width;
+	};
+}
+
+#endif // NAZARA_CORE_MAXRECTSBINPACK_HPP
@@ -22,11 +22,14 @@
 #include <Nazara/Core/VertexDeclaration.hpp>
 #include <Nazara/Core/VertexStruct.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <NazaraUtils/FunctionRef.hpp>
 #include <unordered_map>
 #include <vector>
 
 namespace Nz
 {
+	class TaskScheduler;
+
 	struct NAZARA_CORE_API MeshParams : ResourceParameters
 	{
 		// How buffer will be allocated (by default in RAM)
@@ -57,7 +60,20 @@ namespace Nz
 		// If true, will center the mesh vertices around the origin
 		bool center = false;
 
-		// Optimize the index buffers after loading, improve cache locality (and thus rendering speed) but increase loading time.
+		// If set, loaders supporting it will use this scheduler to decode large files in parallel (waits on all of its tasks)
+		TaskScheduler* taskScheduler = nullptr;
+
+		// Number of simplified levels of detail to generate for each submesh (each one having lodReductionRatio times the triangles of the previous one)
+		std::size_t lodCount = 0;
+
+		// Triangle ratio between two successive levels of detail
+		float lodReductionRatio = 0.5f;
+
+		// Maximum simplification error, relative to the submesh size (levels of detail which can't be simplified further without exceeding it are dropped)
+		float lodMaxError = 0.05f;
+
+		// Optimize the index buffers after loading, improve cache locality and reduce overdraw (and thus rendering speed) but increase loading time.
+		// Some loaders (such as OBJ) also reorder vertices to improve vertex fetch locality.
 		#ifndef NAZARA_DEBUG
 		bool optimizeIndexBuffers = true;
 		#else
@@ -110,6 +126,7 @@ namespace Nz
 			bool CreateStatic();
 			void Destroy();
 
+			void GenerateLods(const MeshParams& params);
 			void GenerateNormals();
 			void GenerateNormalsAndTangents();
 			void GenerateTangents();
@@ -138,6 +155,8 @@ namespace Nz
 			bool IsAnimable() const;
 			bool IsValid() const;
 
+			void Optimize(TaskScheduler* taskScheduler = nullptr);
+
 			void Recenter();
 
 			void RemoveSubMesh(std::string_view identifier);
@@ -167,6 +186,8 @@ namespace Nz
 			NazaraSignal(OnMeshInvalidateAABB, const Mesh* /*mesh*/);
 
 		private:
+			void ProcessSubMeshes(TaskScheduler* taskScheduler, FunctionRef<void(SubMesh& subMesh, bool hasSharedVertexBuffer)> callback);
+
 			struct SubMeshData
 			{
 				std::shared_ptr<SubMesh> subMesh;
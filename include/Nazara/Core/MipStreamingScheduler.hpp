@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_MIPSTREAMINGSCHEDULER_HPP
+#define NAZARA_CORE_MIPSTREAMINGSCHEDULER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	// Decides which mip levels of streamed textures should be resident, without touching any GPU resource
+	// A texture always keeps its mip tail (levels up to Config::mipTailSize) resident, higher levels are streamed in according to
+	// reported screen sizes, within a per-frame upload budget and a global resident memory budget.
+	// Changing the residency of a texture re-uploads every level it keeps resident, which is what the upload budget accounts for.
+	class NAZARA_CORE_API MipStreamingScheduler
+	{
+		public:
+			struct Config;
+			struct ResidencyChange;
+
+			MipStreamingScheduler();
+			MipStreamingScheduler(const Config& config);
+			MipStreamingScheduler(const MipStreamingScheduler&) = default;
+			MipStreamingScheduler(MipStreamingScheduler&&) noexcept = default;
+			~MipStreamingScheduler() = default;
+
+			inline const Config& GetConfig() const;
+			inline UInt8 GetDesiredLevel(std::size_t textureIndex) const;
+			inline UInt64 GetLastFrameUploadSize() const;
+			inline UInt8 GetLevelCount(std::size_t textureIndex) const;
+			inline UInt64 GetResidentMemory() const;
+			inline UInt64 GetResidentMemory(std::size_t textureIndex) const;
+			inline UInt8 GetResidentLevel(std::size_t textureIndex) const;
+			inline UInt8 GetTailLevel(std::size_t textureIndex) const;
+			inline std::size_t GetTextureCount() const;
+
+			inline bool IsValid(std::size_t textureIndex) const;
+
+			std::size_t RegisterTexture(PixelFormat format, unsigned int width, unsigned int height, unsigned int layerCount, UInt8 levelCount);
+
+			void ReportUsage(std::size_t textureIndex, float screenSize);
+
+			void UnregisterTexture(std::size_t textureIndex);
+
+			void Update(std::vector<ResidencyChange>& changes);
+
+			void UpdateConfig(const Config& config);
+
+			MipStreamingScheduler& operator=(const MipStreamingScheduler&) = default;
+			MipStreamingScheduler& operator=(MipStreamingScheduler&&) noexcept = default;
+
+			static constexpr std::size_t InvalidTextureIndex = std::numeric_limits<std::size_t>::max();
+
+			struct Config
+			{
+				UInt64 frameUploadBudget = 8 * 1024 * 1024;
+				UInt64 residentMemoryBudget = 512 * 1024 * 1024;
+				float lodBias = 0.f;
+				unsigned int evictionDelay = 120; //< frames during which a texture must need less detail before its high mips get evicted
+				unsigned int mipTailSize = 64; //< levels whose largest dimension doesn't exceed this are always resident
+			};
+
+			struct ResidencyChange
+			{
+				std::size_t textureIndex;
+				UInt64 uploadSize;
+				UInt8 previousResidentLevel;
+				UInt8 residentLevel;
+			};
+
+		private:
+			struct TextureData;
+
+			void ApplyResidency(std::size_t textureIndex, UInt8 residentLevel, std::vector<ResidencyChange>& changes);
+			UInt8 ComputeWantedLevel(const TextureData& textureData) const;
+
+			struct TextureData
+			{
+				std::vector<UInt64> residentSizes; //< memory used when level i is the first resident level
+				float reportedScreenSize = 0.f;
+				UInt64 lastNeededFrame;
+				unsigned int height;
+				unsigned int width;
+				UInt8 desiredLevel;
+				UInt8 levelCount;
+				UInt8 residentLevel;
+				UInt8 tailLevel;
+				bool isValid = false;
+			};
+
+			std::vector<std::size_t> m_candidates;
+			std::vector<std::size_t> m_freeIndices;
+			std::vector<TextureData> m_textures;
+			Config m_config;
+			UInt64 m_frameIndex;
+			UInt64 m_lastFrameUploadSize;
+			UInt64 m_residentMemory;
+	};
+}
+
+#include <Nazara/Core/MipStreamingScheduler.inl>
+
+#endif // NAZARA_CORE_MIPSTREAMINGSCHEDULER_HPP
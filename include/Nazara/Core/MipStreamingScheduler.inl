@@ -0,0 +1,64 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline auto MipStreamingScheduler::GetConfig() const -> const Config&
+	{
+		return m_config;
+	}
+
+	inline UInt8 MipStreamingScheduler::GetDesiredLevel(std::size_t textureIndex) const
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		return m_textures[textureIndex].desiredLevel;
+	}
+
+	inline UInt64 MipStreamingScheduler::GetLastFrameUploadSize() const
+	{
+		return m_lastFrameUploadSize;
+	}
+
+	inline UInt8 MipStreamingScheduler::GetLevelCount(std::size_t textureIndex) const
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		return m_textures[textureIndex].levelCount;
+	}
+
+	inline UInt64 MipStreamingScheduler::GetResidentMemory() const
+	{
+		return m_residentMemory;
+	}
+
+	inline UInt64 MipStreamingScheduler::GetResidentMemory(std::size_t textureIndex) const
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		const TextureData& textureData = m_textures[textureIndex];
+		return textureData.residentSizes[textureData.residentLevel];
+	}
+
+	inline UInt8 MipStreamingScheduler::GetResidentLevel(std::size_t textureIndex) const
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		return m_textures[textureIndex].residentLevel;
+	}
+
+	inline UInt8 MipStreamingScheduler::GetTailLevel(std::size_t textureIndex) const
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		return m_textures[textureIndex].tailLevel;
+	}
+
+	inline std::size_t MipStreamingScheduler::GetTextureCount() const
+	{
+		return m_textures.size() - m_freeIndices.size();
+	}
+
+	inline bool MipStreamingScheduler::IsValid(std::size_t textureIndex) const
+	{
+		return textureIndex < m_textures.size() && m_textures[textureIndex].isValid;
+	}
+}
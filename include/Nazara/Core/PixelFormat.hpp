@@ -16,12 +16,18 @@
 #include <array>
 #include <functional>
 
-///TODO: Permettre la conversion automatique entre les formats via des renseignements de bits et de type pour chaque format.
-///      Ce serait plus lent que la conversion spécialisée (qui ne disparaîtra donc pas) mais ça permettrait au moteur de faire la conversion
-///      entre n'importe quels formats non-compressés.
-
 namespace Nz
 {
+	class TaskScheduler;
+
+	struct BlockCompressionParams
+	{
+		BlockCompressionQuality quality = BlockCompressionQuality::Normal;
+
+		// DXT1 only: texels with an alpha below this value are encoded as transparent (0 to ignore alpha)
+		UInt8 alphaThreshold = 128;
+	};
+
 	struct PixelFormatDescription
 	{
 		inline PixelFormatDescription();
@@ -61,16 +67,22 @@ namespace Nz
 			using ConvertFunction = std::function<UInt8*(const UInt8* start, const UInt8* end, UInt8* dst)>;
 			using FlipFunction = std::function<void(unsigned int width, unsigned int height, unsigned int depth, const UInt8* src, UInt8* dst)>;
 
+			static bool Compress(PixelFormat dstFormat, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst, const BlockCompressionParams& params = BlockCompressionParams{}, TaskScheduler* taskScheduler = nullptr);
+
 			static inline std::size_t ComputeSize(PixelFormat format, unsigned int width, unsigned int height, unsigned int depth);
 
 			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* src, void* dst);
-			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst);
+			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst, TaskScheduler* taskScheduler = nullptr);
+
+			static bool Decompress(PixelFormat srcFormat, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst, TaskScheduler* taskScheduler = nullptr);
 
 			static bool Flip(PixelFlipping flipping, PixelFormat format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst);
 
 			static inline UInt8 GetBitsPerPixel(PixelFormat format);
+			static inline UInt8 GetBlockSize(PixelFormat format);
 			static inline PixelFormatContent GetContent(PixelFormat format);
 			static inline UInt8 GetBytesPerPixel(PixelFormat format);
+			static inline PixelFormat GetDecompressedFormat(PixelFormat format);
 			static inline const PixelFormatDescription& GetInfo(PixelFormat format);
 			static inline std::string_view GetName(PixelFormat format);
 
@@ -87,6 +99,8 @@ namespace Nz
 			static inline void SetFlipFunction(PixelFlipping flipping, PixelFormat format, FlipFunction func);
 
 		private:
+			static bool ConvertParallel(const ConvertFunction& func, UInt8 srcBytesPerPixel, UInt8 dstBytesPerPixel, const UInt8* start, const UInt8* end, UInt8* dst, TaskScheduler& taskScheduler);
+
 			static bool Initialize();
 			static void Uninitialize();
 
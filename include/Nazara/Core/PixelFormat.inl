@@ -147,17 +147,14 @@ namespace Nz
 	{
 		if (IsCompressed(format))
 		{
-			switch (format)
+			UInt8 blockSize = GetBlockSize(format);
+			if (blockSize == 0)
 			{
-				case PixelFormat::DXT1:
-				case PixelFormat::DXT3:
-				case PixelFormat::DXT5:
-					return (((width + 3) / 4) * ((height + 3) / 4) * ((format == PixelFormat::DXT1) ? 8 : 16)) * depth;
-
-				default:
-					NazaraError("unsupported format");
-					return 0;
+				NazaraError("unsupported format");
+				return 0;
 			}
+
+			return std::size_t((width + 3) / 4) * ((height + 3) / 4) * blockSize * depth;
 		}
 		else
 			return width * height * depth * GetBytesPerPixel(format);
@@ -177,7 +174,7 @@ namespace Nz
 		return Convert(srcFormat, dstFormat, src, static_cast<const UInt8*>(src) + GetBytesPerPixel(srcFormat), dst);
 	}
 
-	inline bool PixelFormatInfo::Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst)
+	inline bool PixelFormatInfo::Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst, TaskScheduler* taskScheduler)
 	{
 		if (srcFormat == dstFormat)
 		{
@@ -185,14 +182,20 @@ namespace Nz
 			return true;
 		}
 
-		ConvertFunction func = s_convertFunctions[srcFormat][dstFormat];
+		const ConvertFunction& func = s_convertFunctions[srcFormat][dstFormat];
 		if (!func)
 		{
 			NazaraErrorFmt("pixel format conversion from {0} to {1} is not supported", GetName(srcFormat), GetName(dstFormat));
 			return false;
 		}
 
-		if (!func(reinterpret_cast<const UInt8*>(start), reinterpret_cast<const UInt8*>(end), reinterpret_cast<UInt8*>(dst)))
+		bool succeeded;
+		if (taskScheduler)
+			succeeded = ConvertParallel(func, GetBytesPerPixel(srcFormat), GetBytesPerPixel(dstFormat), reinterpret_cast<const UInt8*>(start), reinterpret_cast<const UInt8*>(end), reinterpret_cast<UInt8*>(dst), *taskScheduler);
+		else
+			succeeded = func(reinterpret_cast<const UInt8*>(start), reinterpret_cast<const UInt8*>(end), reinterpret_cast<UInt8*>(dst)) != nullptr;
+
+		if (!succeeded)
 		{
 			NazaraErrorFmt("pixel format conversion from {0} to {1} failed", GetName(srcFormat), GetName(dstFormat));
 			return false;
@@ -206,11 +209,55 @@ namespace Nz
 		return s_pixelFormatInfos[format].bitsPerPixel;
 	}
 
+	inline UInt8 PixelFormatInfo::GetBlockSize(PixelFormat format)
+	{
+		switch (format)
+		{
+			case PixelFormat::BC4:
+			case PixelFormat::DXT1:
+				return 8;
+
+			case PixelFormat::BC5:
+			case PixelFormat::BC6H:
+			case PixelFormat::BC7:
+			case PixelFormat::BC7_SRGB:
+			case PixelFormat::DXT3:
+			case PixelFormat::DXT5:
+				return 16;
+
+			default:
+				return 0;
+		}
+	}
+
 	inline UInt8 PixelFormatInfo::GetBytesPerPixel(PixelFormat format)
 	{
 		return GetBitsPerPixel(format)/8;
 	}
 
+	inline PixelFormat PixelFormatInfo::GetDecompressedFormat(PixelFormat format)
+	{
+		switch (format)
+		{
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			case PixelFormat::BC7:
+			case PixelFormat::DXT1:
+			case PixelFormat::DXT3:
+			case PixelFormat::DXT5:
+				return PixelFormat::RGBA8;
+
+			case PixelFormat::BC6H:
+				return PixelFormat::RGBA16F;
+
+			case PixelFormat::BC7_SRGB:
+				return PixelFormat::RGBA8_SRGB;
+
+			default:
+				return format;
+		}
+	}
+
 	inline PixelFormatContent PixelFormatInfo::GetContent(PixelFormat format)
 	{
 		return s_pixelFormatInfos[format].content;
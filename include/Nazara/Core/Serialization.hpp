@@ -13,6 +13,7 @@
 #include <NazaraUtils/Endianness.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
 #include <NazaraUtils/TypeTag.hpp>
+#include <algorithm>
 #include <string>
 
 namespace Nz
@@ -40,6 +41,8 @@ namespace Nz
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Serialize(SerializationContext& context, T value, TypeTag<T>);
 
+	inline bool SerializeBits(SerializationContext& context, UInt64 value, unsigned int bitCount);
+
 	template<typename T>
 	bool Unserialize(SerializationContext& context, T* value);
 
@@ -48,6 +51,8 @@ namespace Nz
 
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Unserialize(SerializationContext& context, T* value, TypeTag<T>);
+
+	inline bool UnserializeBits(SerializationContext& context, UInt64* value, unsigned int bitCount);
 }
 
 #include <Nazara/Core/Serialization.inl>
@@ -97,6 +97,52 @@ namespace Nz
 		return context.stream->Write(&value, sizeof(T)) == sizeof(T);
 	}
 
+	/*!
+	* \ingroup core
+	* \brief Serializes the lowest bits of an integer
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param value Integer whose bitCount lowest bits are written
+	* \param bitCount Number of bits to write, from 0 to 64
+	*
+	* Bits are packed with the ones written by boolean serialization, starting from the least significant bit of the pending byte.
+	*
+	* \remark Don't forget to call FlushBits once all bits have been written
+	*
+	* \see UnserializeBits
+	*/
+	inline bool SerializeBits(SerializationContext& context, UInt64 value, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "bit count must be between 0 and 64");
+
+		while (bitCount > 0)
+		{
+			if (context.writeBitPos == 8)
+			{
+				context.writeBitPos = 0;
+				context.writeByte = 0;
+			}
+
+			unsigned int writtenBits = std::min<unsigned int>(8 - context.writeBitPos, bitCount);
+			UInt8 bits = static_cast<UInt8>(value & ((1u << writtenBits) - 1));
+
+			context.writeByte |= static_cast<UInt8>(bits << context.writeBitPos);
+			context.writeBitPos += static_cast<UInt8>(writtenBits);
+
+			value >>= writtenBits;
+			bitCount -= writtenBits;
+
+			if (context.writeBitPos >= 8)
+			{
+				if (!Serialize(context, context.writeByte, TypeTag<UInt8>()))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
 
 	template<typename T>
 	bool Unserialize(SerializationContext& context, T* value)
@@ -178,5 +224,46 @@ namespace Nz
 		else
 			return false;
 	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes an integer stored on a number of bits
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param value Pointer to the integer receiving the bits, higher bits being cleared (can be null to skip bits)
+	* \param bitCount Number of bits to read, from 0 to 64
+	*
+	* \see SerializeBits
+	*/
+	inline bool UnserializeBits(SerializationContext& context, UInt64* value, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "bit count must be between 0 and 64");
+
+		UInt64 result = 0;
+		unsigned int readBits = 0;
+		while (readBits < bitCount)
+		{
+			if (context.readBitPos == 8)
+			{
+				if (!Unserialize(context, &context.readByte, TypeTag<UInt8>()))
+					return false;
+
+				context.readBitPos = 0;
+			}
+
+			unsigned int bitsToRead = std::min<unsigned int>(8 - context.readBitPos, bitCount - readBits);
+			UInt64 bits = (context.readByte >> context.readBitPos) & ((1u << bitsToRead) - 1);
+
+			result |= bits << readBits;
+			context.readBitPos += static_cast<UInt8>(bitsToRead);
+			readBits += bitsToRead;
+		}
+
+		if (value)
+			*value = result;
+
+		return true;
+	}
 }
 
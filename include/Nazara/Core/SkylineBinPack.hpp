@@ -0,0 +1,75 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+// Based on the skyline bottom-left packer by Jukka Jylänki (public domain)
+// http://clb.demon.fi/projects/even-more-rectangle-bin-packing
+
+#pragma once
+
+#ifndef NAZARA_CORE_SKYLINEBINPACK_HPP
+#define NAZARA_CORE_SKYLINEBINPACK_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API SkylineBinPack
+	{
+		public:
+			SkylineBinPack();
+			SkylineBinPack(unsigned int width, unsigned int height);
+			SkylineBinPack(const Vector2ui& size);
+			SkylineBinPack(const SkylineBinPack&) = default;
+			SkylineBinPack(SkylineBinPack&&) noexcept = default;
+			~SkylineBinPack() = default;
+
+			void Clear();
+
+			void Expand(unsigned int newWidth, unsigned newHeight);
+			void Expand(const Vector2ui& newSize);
+
+			void FreeRectangle(const Rectui& rect);
+
+			unsigned int GetHeight() const;
+			float GetOccupancy() const;
+			Vector2ui GetSize() const;
+			unsigned int GetWidth() const;
+
+			bool Insert(Rectui* rects, unsigned int count);
+			bool Insert(Rectui* rects, bool* flipped, unsigned int count);
+			bool Insert(Rectui* rects, bool* flipped, bool* inserted, unsigned int count);
+
+			void Reset();
+			void Reset(unsigned int width, unsigned int height);
+			void Reset(const Vector2ui& size);
+
+			SkylineBinPack& operator=(const SkylineBinPack&) = default;
+			SkylineBinPack& operator=(SkylineBinPack&&) noexcept = default;
+
+		private:
+			struct Segment
+			{
+				unsigned int x;
+				unsigned int y;
+				unsigned int width;
+			};
+
+			bool FindSkylinePosition(unsigned int width, unsigned int height, std::size_t* segmentIndex, unsigned int* y, unsigned int* score, unsigned int* scoreWidth) const;
+			bool FindWastePosition(unsigned int width, unsigned int height, std::size_t* wasteIndex, unsigned int* score) const;
+			bool Insert(Rectui& rect, bool allowFlip, bool* flipped);
+			void PlaceOnSkyline(std::size_t segmentIndex, const Rectui& rect);
+			void PlaceInWaste(std::size_t wasteIndex, Rectui& rect);
+
+			std::vector<Rectui> m_wastedRectangles; //< free space below the skyline (gaps and freed rectangles)
+			std::vector<Segment> m_skyline;
+			unsigned int m_height;
+			unsigned int m_usedArea;
+			unsigned int m_width;
+	};
+}
+
+#endif // NAZARA_CORE_SKYLINEBINPACK_HPP
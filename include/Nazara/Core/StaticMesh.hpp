@@ -25,7 +25,7 @@ namespace Nz
 			const Boxf& GetAABB() const override;
 			AnimationType GetAnimationType() const final;
 			const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override;
-			const std::shared_ptr<VertexBuffer>& GetVertexBuffer() const;
+			const std::shared_ptr<VertexBuffer>& GetVertexBuffer() const override;
 			UInt32 GetVertexCount() const override;
 
 			bool IsAnimated() const final;
@@ -14,6 +14,7 @@
 #include <Nazara/Core/VertexBuffer.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <NazaraUtils/Signal.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -24,11 +25,18 @@ namespace Nz
 		friend Mesh;
 
 		public:
+			struct Lod;
+
 			SubMesh();
 			SubMesh(const SubMesh&) = delete;
 			SubMesh(SubMesh&&) = delete;
 			virtual ~SubMesh();
 
+			void AddLod(std::shared_ptr<IndexBuffer> indexBuffer, float error);
+
+			void ClearLods();
+
+			void GenerateLods(std::size_t lodCount, float reductionRatio, float maxError, BufferUsageFlags usage, const BufferFactory& bufferFactory);
 			void GenerateNormals();
 			void GenerateNormalsAndTangents();
 			void GenerateTangents();
@@ -36,23 +44,36 @@ namespace Nz
 			virtual const Boxf& GetAABB() const = 0;
 			virtual AnimationType GetAnimationType() const = 0;
 			virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const = 0;
+			const Lod& GetLod(std::size_t lodIndex) const;
+			std::size_t GetLodCount() const;
 			std::size_t GetMaterialIndex() const;
 			PrimitiveMode GetPrimitiveMode() const;
 			UInt32 GetTriangleCount() const;
+			virtual const std::shared_ptr<VertexBuffer>& GetVertexBuffer() const = 0;
 			virtual UInt32 GetVertexCount() const = 0;
 
 			virtual bool IsAnimated() const = 0;
 
+			void Optimize(bool reorderVertices = true);
+
 			void SetMaterialIndex(std::size_t matIndex);
 			void SetPrimitiveMode(PrimitiveMode mode);
 
 			SubMesh& operator=(const SubMesh&) = delete;
 			SubMesh& operator=(SubMesh&&) = delete;
 
+			// Simplified version of the submesh, sharing its vertices
+			struct Lod
+			{
+				std::shared_ptr<IndexBuffer> indexBuffer;
+				float error; //< relative to the submesh size
+			};
+
 			// Signals:
 			NazaraSignal(OnSubMeshInvalidateAABB, const SubMesh* /*subMesh*/);
 
 		protected:
+			std::vector<Lod> m_lods;
 			PrimitiveMode m_primitiveMode;
 			std::size_t m_matIndex;
 	};
@@ -9,6 +9,7 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Export.hpp>
+#include <NazaraUtils/FunctionRef.hpp>
 #include <functional>
 #include <memory>
 
@@ -28,6 +29,9 @@ namespace Nz
 
 			unsigned int GetWorkerCount() const;
 
+			void ParallelFor(std::size_t jobCount, FunctionRef<void(std::size_t jobIndex)> job);
+			void ParallelForRange(std::size_t count, std::size_t minCountPerTask, FunctionRef<void(std::size_t first, std::size_t last)> job);
+
 			void WaitForTasks();
 
 			TaskScheduler& operator=(const TaskScheduler&) = delete;
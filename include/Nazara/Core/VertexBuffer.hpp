@@ -8,6 +8,7 @@
 #define NAZARA_CORE_VERTEXBUFFER_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/Buffer.hpp>
 #include <Nazara/Core/VertexDeclaration.hpp>
 
@@ -29,6 +30,7 @@ namespace Nz
 
 			inline const std::shared_ptr<Buffer>& GetBuffer() const;
 			inline UInt64 GetEndOffset() const;
+			inline const PositionQuantization& GetPositionQuantization() const;
 			inline UInt64 GetStartOffset() const;
 			inline UInt64 GetStride() const;
 			inline UInt32 GetVertexCount() const;
@@ -41,6 +43,7 @@ namespace Nz
 			void* MapRaw(UInt64 offset, UInt64 size);
 			void* MapRaw(UInt64 offset, UInt64 size) const;
 
+			inline void SetPositionQuantization(const PositionQuantization& positionQuantization);
 			void SetVertexDeclaration(std::shared_ptr<const VertexDeclaration> vertexDeclaration);
 
 			void Unmap() const;
@@ -51,6 +54,7 @@ namespace Nz
 		private:
 			std::shared_ptr<Buffer> m_buffer;
 			std::shared_ptr<const VertexDeclaration> m_vertexDeclaration;
+			PositionQuantization m_positionQuantization;
 			UInt32 m_vertexCount;
 			UInt64 m_endOffset;
 			UInt64 m_startOffset;
@@ -16,6 +16,11 @@ namespace Nz
 		return m_endOffset;
 	}
 
+	inline const PositionQuantization& VertexBuffer::GetPositionQuantization() const
+	{
+		return m_positionQuantization;
+	}
+
 	inline UInt64 VertexBuffer::GetStride() const
 	{
 		return static_cast<UInt64>(m_vertexDeclaration->GetStride());
@@ -40,5 +45,10 @@ namespace Nz
 	{
 		return m_buffer && m_vertexDeclaration;
 	}
+
+	inline void VertexBuffer::SetPositionQuantization(const PositionQuantization& positionQuantization)
+	{
+		m_positionQuantization = positionQuantization;
+	}
 }
 
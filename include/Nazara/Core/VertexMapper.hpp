@@ -12,6 +12,7 @@
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/VertexBuffer.hpp>
 #include <NazaraUtils/SparsePtr.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -28,12 +29,26 @@ namespace Nz
 			inline const VertexBuffer* GetVertexBuffer() const;
 			inline UInt32 GetVertexCount() const;
 
-			template<typename T> bool HasComponentOfType(VertexComponent component) const;
+			template<typename T> bool HasComponentOfType(VertexComponent component, std::size_t componentIndex = 0) const;
 
 			void Unmap();
 
 		private:
+			void* DecodeComponent(VertexComponent component, std::size_t componentIndex, ComponentType decodedType, bool writeBack);
+			void EncodeComponents();
+
+			static ComponentType GetDecodedType(ComponentType type);
+
+			struct DecodedComponent
+			{
+				const VertexDeclaration::Component* component;
+				std::vector<float> data;
+				bool writeBack;
+			};
+
+			std::vector<DecodedComponent> m_decodedComponents;
 			BufferMapper<VertexBuffer> m_mapper;
+			VertexBuffer* m_vertexBuffer;
 	};
 }
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/VertexDeclaration.hpp>
+#include <type_traits>
 
 namespace Nz
 {
@@ -14,8 +15,15 @@ namespace Nz
 
 		if (const auto* componentData = declaration->GetComponentByType<T>(component, componentIndex))
 			return SparsePtr<T>(static_cast<UInt8*>(m_mapper.GetPointer()) + componentData->offset, declaration->GetStride());
-		else
-			return SparsePtr<T>();
+
+		// Quantized components are decoded to a temporary array, which is encoded back on unmapping (unless accessed as const)
+		if constexpr (std::is_same_v<std::remove_const_t<T>, Vector2f> || std::is_same_v<std::remove_const_t<T>, Vector3f>)
+		{
+			if (void* decodedData = DecodeComponent(component, componentIndex, GetComponentTypeOf<T>(), !std::is_const_v<T>))
+				return SparsePtr<T>(static_cast<T*>(decodedData));
+		}
+
+		return SparsePtr<T>();
 	}
 
 	inline const VertexBuffer* VertexMapper::GetVertexBuffer() const
@@ -29,9 +37,15 @@ namespace Nz
 	}
 
 	template<typename T>
-	bool VertexMapper::HasComponentOfType(VertexComponent component) const
+	bool VertexMapper::HasComponentOfType(VertexComponent component, std::size_t componentIndex) const
 	{
-		return m_mapper.GetBuffer()->GetVertexDeclaration()->HasComponentOfType<T>(component);
+		const std::shared_ptr<const VertexDeclaration>& declaration = m_mapper.GetBuffer()->GetVertexDeclaration();
+		if (declaration->HasComponentOfType<T>(component, componentIndex))
+			return true;
+
+		// Quantized components can be accessed as their decoded type (see GetComponentPtr)
+		const auto* componentData = declaration->FindComponent(component, componentIndex);
+		return componentData && GetDecodedType(componentData->type) == GetComponentTypeOf<T>();
 	}
 }
 
@@ -53,6 +53,11 @@ namespace Nz
 		Vector2f uv;
 	};
 
+	struct VertexStruct_XYZ_Color_UV_DistanceField : VertexStruct_XYZ_Color_UV
+	{
+		Vector2f distanceField; //< edge value, smoothing width
+	};
+
 	struct VertexStruct_XYZ_Normal : VertexStruct_XYZ
 	{
 		Vector3f normal;
@@ -84,6 +89,16 @@ namespace Nz
 		Vector2f uv;
 	};
 
+	/************************* Structures 3D (Quantized) *************************/
+
+	struct VertexStruct_XYZ_Normal_UV_Tangent_Quantized
+	{
+		Vector4i16 position; //< normalized, remapped to the vertex buffer bounds (see PositionQuantization)
+		Vector2i16 normal;   //< normalized, octahedral encoding
+		Vector2ui16 uv;      //< half-floats
+		Vector2i16 tangent;  //< normalized, octahedral encoding
+	};
+
 	/************************* Structures 3D (+ Skinning) ************************/
 
 	struct VertexStruct_XYZ_Normal_UV_Tangent_Skinning : VertexStruct_XYZ_Normal_UV_Tangent
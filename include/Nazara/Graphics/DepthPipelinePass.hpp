@@ -63,9 +63,11 @@ namespace Nz
 			};
 
 			std::size_t m_passIndex;
+			std::size_t m_lastLodHash;
 			std::size_t m_lastVisibilityHash;
 			std::string m_passName;
 			std::vector<std::unique_ptr<ElementRendererData>> m_elementRendererData;
+			std::vector<std::size_t> m_lodLevels;
 			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
 			RenderQueue<const RenderElement*> m_renderQueue;
@@ -13,6 +13,7 @@ namespace Nz
 	inline DepthPipelinePass::DepthPipelinePass(PassData& passData, std::string passName, std::size_t materialPassIndex) :
 	FramePipelinePass(FramePipelineNotification::ElementInvalidation | FramePipelineNotification::MaterialInstanceRegistration),
 	m_passIndex(materialPassIndex),
+	m_lastLodHash(0),
 	m_lastVisibilityHash(0),
 	m_passName(std::move(passName)),
 	m_viewer(passData.viewer),
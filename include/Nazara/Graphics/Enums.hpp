@@ -45,6 +45,7 @@ namespace Nz
 	{
 		InstanceDataUbo,
 		LightDataUbo,
+		MeshDataUbo,
 		OverlayTexture,
 		ShadowmapDirectional,
 		ShadowmapPoint,
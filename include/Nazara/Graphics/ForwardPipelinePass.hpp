@@ -79,15 +79,18 @@ namespace Nz
 			};
 
 			std::size_t m_forwardPassIndex;
+			std::size_t m_lastLodHash;
 			std::size_t m_lastVisibilityHash;
 			std::shared_ptr<RenderBuffer> m_lightDataBuffer;
 			std::string m_passName;
 			std::vector<std::unique_ptr<ElementRendererData>> m_elementRendererData;
+			std::vector<std::size_t> m_lodLevels;
 			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
 			std::vector<RenderableLight<DirectionalLight>> m_directionalLights;
 			std::vector<RenderableLight<PointLight>> m_pointLights;
 			std::vector<RenderableLight<SpotLight>> m_spotLights;
+			std::vector<float> m_screenSizes;
 			ElementRenderer::RenderStates m_renderState;
 			RenderQueue<const RenderElement*> m_renderQueue;
 			RenderQueueRegistry m_renderQueueRegistry;
@@ -15,6 +15,7 @@
 #include <NazaraUtils/Bitset.hpp>
 #include <limits>
 #include <span>
+#include <vector>
 
 namespace Nz
 {
@@ -27,6 +28,7 @@ namespace Nz
 	class MaterialInstance;
 	class RenderResources;
 	class SkeletonInstance;
+	class ViewerInstance;
 	class WorldInstance;
 
 	class NAZARA_GRAPHICS_API FramePipelinePass
@@ -91,6 +93,9 @@ namespace Nz
 
 			static constexpr std::size_t InvalidAttachmentIndex = std::numeric_limits<std::size_t>::max();
 
+		protected:
+			static std::size_t SelectLods(const ViewerInstance& viewerInstance, const std::vector<VisibleRenderable>& visibleRenderables, std::vector<std::size_t>& lodLevels, std::vector<float>* screenSizes = nullptr);
+
 		private:
 			FramePipelineNotificationFlags m_notificationFlags;
 	};
@@ -8,18 +8,21 @@
 #define NAZARA_GRAPHICS_GRAPHICALMESH_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/Mesh.hpp>
 #include <Nazara/Core/VertexDeclaration.hpp>
 #include <Nazara/Graphics/Export.hpp>
 #include <Nazara/Renderer/RenderBuffer.hpp>
 #include <NazaraUtils/Signal.hpp>
 #include <memory>
+#include <vector>
 
 namespace Nz
 {
 	class NAZARA_GRAPHICS_API GraphicalMesh
 	{
 		public:
+			struct Lod;
 			struct SubMesh;
 
 			GraphicalMesh() = default;
@@ -33,23 +36,38 @@ namespace Nz
 
 			inline const Boxf& GetAABB() const;
 			inline const std::shared_ptr<RenderBuffer>& GetIndexBuffer(std::size_t subMesh) const;
+			inline const std::shared_ptr<RenderBuffer>& GetIndexBuffer(std::size_t subMesh, std::size_t lodLevel) const;
 			inline UInt32 GetIndexCount(std::size_t subMesh) const;
+			inline UInt32 GetIndexCount(std::size_t subMesh, std::size_t lodLevel) const;
 			inline IndexType GetIndexType(std::size_t subMesh) const;
+			inline std::size_t GetLodCount() const;
+			inline float GetLodError(std::size_t lodLevel) const;
+			inline const std::shared_ptr<RenderBuffer>& GetMeshDataBuffer(std::size_t subMesh) const;
 			inline const std::shared_ptr<RenderBuffer>& GetVertexBuffer(std::size_t subMesh) const;
 			inline const std::shared_ptr<const VertexDeclaration>& GetVertexDeclaration(std::size_t subMesh) const;
 			inline std::size_t GetSubMeshCount() const;
 
 			inline void UpdateAABB(const Boxf& aabb);
 			inline void UpdateSubMeshIndexCount(std::size_t subMeshIndex, UInt32 indexCount);
+			void UpdateSubMeshPositionQuantization(std::size_t subMeshIndex, const PositionQuantization& quantization);
 
 			GraphicalMesh& operator=(const GraphicalMesh&) = delete;
 			GraphicalMesh& operator=(GraphicalMesh&&) = delete;
 
+			struct Lod
+			{
+				std::shared_ptr<RenderBuffer> indexBuffer;
+				UInt32 indexCount;
+				float error;
+			};
+
 			struct SubMesh
 			{
 				std::shared_ptr<RenderBuffer> indexBuffer;
+				std::shared_ptr<RenderBuffer> meshDataBuffer; //< only present for quantized positions
 				std::shared_ptr<RenderBuffer> vertexBuffer;
 				std::shared_ptr<const VertexDeclaration> vertexDeclaration;
+				std::vector<Lod> lods; //< simplified index buffers, from the most to the least detailed
 				IndexType indexType;
 				UInt32 indexCount;
 			};
@@ -61,6 +79,7 @@ namespace Nz
 			NazaraSignal(OnInvalidated, GraphicalMesh* /*gfxMesh*/);
 
 		private:
+			std::vector<float> m_lodErrors;
 			std::vector<SubMesh> m_subMeshes;
 			Boxf m_aabb;
 	};
@@ -2,12 +2,22 @@
 // This file is part of the "Nazara Engine - Graphics module"
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
+#include <algorithm>
 #include <cassert>
 
 namespace Nz
 {
 	inline std::size_t GraphicalMesh::AddSubMesh(SubMesh subMesh)
 	{
+		// Keep track of the maximum error of each level of detail across submeshes
+		for (std::size_t i = 0; i < subMesh.lods.size(); ++i)
+		{
+			if (i < m_lodErrors.size())
+				m_lodErrors[i] = std::max(m_lodErrors[i], subMesh.lods[i].error);
+			else
+				m_lodErrors.push_back(subMesh.lods[i].error);
+		}
+
 		std::size_t subMeshIndex = m_subMeshes.size();
 		m_subMeshes.emplace_back(std::move(subMesh));
 
@@ -18,6 +28,7 @@ namespace Nz
 
 	inline void GraphicalMesh::Clear()
 	{
+		m_lodErrors.clear();
 		m_subMeshes.clear();
 
 		OnInvalidated(this);
@@ -34,18 +45,58 @@ namespace Nz
 		return m_subMeshes[subMesh].indexBuffer;
 	}
 
+	inline const std::shared_ptr<RenderBuffer>& GraphicalMesh::GetIndexBuffer(std::size_t subMesh, std::size_t lodLevel) const
+	{
+		assert(subMesh < m_subMeshes.size());
+		const SubMesh& subMeshData = m_subMeshes[subMesh];
+
+		// Submeshes may have less levels of detail than the mesh, use their least detailed one
+		if (lodLevel == 0 || subMeshData.lods.empty())
+			return subMeshData.indexBuffer;
+
+		return subMeshData.lods[std::min(lodLevel, subMeshData.lods.size()) - 1].indexBuffer;
+	}
+
 	inline UInt32 GraphicalMesh::GetIndexCount(std::size_t subMesh) const
 	{
 		assert(subMesh < m_subMeshes.size());
 		return m_subMeshes[subMesh].indexCount;
 	}
 
+	inline UInt32 GraphicalMesh::GetIndexCount(std::size_t subMesh, std::size_t lodLevel) const
+	{
+		assert(subMesh < m_subMeshes.size());
+		const SubMesh& subMeshData = m_subMeshes[subMesh];
+
+		if (lodLevel == 0 || subMeshData.lods.empty())
+			return subMeshData.indexCount;
+
+		return subMeshData.lods[std::min(lodLevel, subMeshData.lods.size()) - 1].indexCount;
+	}
+
 	inline IndexType GraphicalMesh::GetIndexType(std::size_t subMesh) const
 	{
 		assert(subMesh < m_subMeshes.size());
 		return m_subMeshes[subMesh].indexType;
 	}
 
+	inline std::size_t GraphicalMesh::GetLodCount() const
+	{
+		return m_lodErrors.size() + 1; //< full detail level is always present
+	}
+
+	inline float GraphicalMesh::GetLodError(std::size_t lodLevel) const
+	{
+		assert(lodLevel <= m_lodErrors.size());
+		return (lodLevel > 0) ? m_lodErrors[lodLevel - 1] : 0.f;
+	}
+
+	inline const std::shared_ptr<RenderBuffer>& GraphicalMesh::GetMeshDataBuffer(std::size_t subMesh) const
+	{
+		assert(subMesh < m_subMeshes.size());
+		return m_subMeshes[subMesh].meshDataBuffer;
+	}
+
 	inline const std::shared_ptr<RenderBuffer>& GraphicalMesh::GetVertexBuffer(std::size_t subMesh) const
 	{
 		assert(subMesh < m_subMeshes.size());
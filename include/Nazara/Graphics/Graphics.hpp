@@ -16,6 +16,7 @@
 #include <Nazara/Graphics/Model.hpp>
 #include <Nazara/Graphics/PipelinePassList.hpp>
 #include <Nazara/Graphics/TextureSamplerCache.hpp>
+#include <Nazara/Graphics/TextureStreamer.hpp>
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Renderer/RenderPassCache.hpp>
 #include <Nazara/Renderer/RenderPipelineLayout.hpp>
@@ -66,6 +67,8 @@ namespace Nz
 			inline const std::shared_ptr<RenderDevice>& GetRenderDevice() const;
 			inline const RenderPassCache& GetRenderPassCache() const;
 			inline TextureSamplerCache& GetSamplerCache();
+			inline TextureStreamer& GetTextureStreamer();
+			inline const TextureStreamer& GetTextureStreamer() const;
 			inline std::shared_ptr<nzsl::FilesystemModuleResolver>& GetShaderModuleResolver();
 			inline const std::shared_ptr<nzsl::FilesystemModuleResolver>& GetShaderModuleResolver() const;
 
@@ -75,6 +78,7 @@ namespace Nz
 			{
 				void Override(const CommandLineParameters& parameters);
 
+				MipStreamingScheduler::Config textureStreaming;
 				RenderDeviceFeatures forceDisableFeatures;
 				bool useDedicatedRenderDevice = true;
 			};
@@ -109,6 +113,7 @@ namespace Nz
 
 			std::optional<RenderPassCache> m_renderPassCache;
 			std::optional<TextureSamplerCache> m_samplerCache;
+			std::optional<TextureStreamer> m_textureStreamer;
 			std::shared_ptr<nzsl::FilesystemModuleResolver> m_shaderModuleResolver;
 			std::shared_ptr<PipelinePassList> m_defaultPipelinePasses;
 			std::shared_ptr<RenderDevice> m_renderDevice;
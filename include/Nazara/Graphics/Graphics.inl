@@ -116,6 +116,16 @@ namespace Nz
 		return *m_samplerCache;
 	}
 
+	inline TextureStreamer& Graphics::GetTextureStreamer()
+	{
+		return *m_textureStreamer;
+	}
+
+	inline const TextureStreamer& Graphics::GetTextureStreamer() const
+	{
+		return *m_textureStreamer;
+	}
+
 	inline std::shared_ptr<nzsl::FilesystemModuleResolver>& Graphics::GetShaderModuleResolver()
 	{
 		return m_shaderModuleResolver;
@@ -24,6 +24,7 @@ namespace Nz
 			DataStoreFlags GetStorage() const override;
 
 		private:
+			std::shared_ptr<AbstractImage> RelocateImage(const std::shared_ptr<AbstractImage>& oldImage, const Rectui* oldRects, const Rectui* newRects, std::size_t count) const override;
 			std::shared_ptr<AbstractImage> ResizeImage(const std::shared_ptr<AbstractImage>& oldImage, const Vector2ui& size) const override;
 
 			RenderDevice& m_renderDevice;
@@ -40,6 +40,8 @@ namespace Nz
 			virtual std::size_t GetMaterialCount() const = 0;
 			inline int GetRenderLayer() const;
 
+			virtual std::size_t SelectLod(float screenSize) const;
+
 			inline void UpdateRenderLayer(int renderLayer);
 
 			InstancedRenderable& operator=(const InstancedRenderable&) = delete;
@@ -54,6 +56,7 @@ namespace Nz
 				const Recti* scissorBox;
 				const SkeletonInstance* skeletonInstance;
 				const WorldInstance* worldInstance;
+				std::size_t lodLevel = 0;
 			};
 
 		protected:
@@ -57,12 +57,16 @@ namespace Nz
 
 			const std::shared_ptr<RenderBuffer>& GetIndexBuffer(std::size_t subMeshIndex) const;
 			std::size_t GetIndexCount(std::size_t subMeshIndex) const;
+			inline float GetLodThreshold() const;
 			const std::shared_ptr<MaterialInstance>& GetMaterial(std::size_t subMeshIndex) const override;
 			std::size_t GetMaterialCount() const override;
 			inline std::size_t GetSubMeshCount() const;
 			const std::vector<RenderPipelineInfo::VertexBufferData>& GetVertexBufferData(std::size_t subMeshIndex) const;
 			const std::shared_ptr<RenderBuffer>& GetVertexBuffer(std::size_t subMeshIndex) const;
 
+			std::size_t SelectLod(float screenSize) const override;
+
+			inline void SetLodThreshold(float pixelError);
 			inline void SetMaterial(std::size_t subMeshIndex, std::shared_ptr<MaterialInstance> material);
 
 			Model& operator=(const Model&) = delete;
@@ -83,6 +87,7 @@ namespace Nz
 
 			std::shared_ptr<GraphicalMesh> m_graphicalMesh;
 			std::vector<SubMeshData> m_submeshes;
+			float m_lodThreshold;
 	};
 }
 
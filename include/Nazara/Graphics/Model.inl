@@ -6,11 +6,31 @@
 
 namespace Nz
 {
+	inline float Model::GetLodThreshold() const
+	{
+		return m_lodThreshold;
+	}
+
 	inline std::size_t Model::GetSubMeshCount() const
 	{
 		return m_submeshes.size();
 	}
 
+	/*!
+	* \brief Sets the maximum simplification error (in pixels) tolerated when selecting a level of detail
+	*
+	* \param pixelError Maximum projected error, in pixels (zero disables levels of detail)
+	*/
+	inline void Model::SetLodThreshold(float pixelError)
+	{
+		NazaraAssert(pixelError >= 0.f, "LOD threshold must be positive");
+		if (m_lodThreshold != pixelError)
+		{
+			m_lodThreshold = pixelError;
+			OnElementInvalidated(this);
+		}
+	}
+
 	inline void Model::SetMaterial(std::size_t subMeshIndex, std::shared_ptr<MaterialInstance> material)
 	{
 		NazaraAssertFmt(subMeshIndex < m_submeshes.size(), "submesh index out of range ({0} >= {1})", subMeshIndex, m_submeshes.size());
@@ -99,6 +99,18 @@ namespace Nz
 		static constexpr PredefinedInstanceData Build();
 	};
 
+	struct NAZARA_GRAPHICS_API PredefinedMeshData
+	{
+		nzsl::FieldOffsets fieldOffsets;
+
+		std::size_t positionOffsetOffset;
+		std::size_t positionScaleOffset;
+
+		std::size_t totalSize;
+
+		static constexpr PredefinedMeshData Build();
+	};
+
 	struct NAZARA_GRAPHICS_API PredefinedSkeletalData
 	{
 		nzsl::FieldOffsets fieldOffsets;
@@ -96,6 +96,18 @@ NAZARA_WARNING_CLANG_GCC_DISABLE("-Wmissing-field-initializers")
 		return instanceData;
 	}
 
+	// PredefinedMeshData
+	constexpr PredefinedMeshData PredefinedMeshData::Build()
+	{
+		PredefinedMeshData meshData = { nzsl::FieldOffsets(nzsl::StructLayout::Std140) };
+		meshData.positionOffsetOffset = meshData.fieldOffsets.AddField(nzsl::StructFieldType::Float3);
+		meshData.positionScaleOffset = meshData.fieldOffsets.AddField(nzsl::StructFieldType::Float3);
+
+		meshData.totalSize = meshData.fieldOffsets.GetAlignedSize();
+
+		return meshData;
+	}
+
 	// PredefinedSkeletalData
 	constexpr PredefinedSkeletalData PredefinedSkeletalData::Build()
 	{
@@ -16,6 +16,7 @@ namespace Nz
 	static constexpr PredefinedSpotLightData PredefinedSpotLightOffsets = PredefinedSpotLightData::Build();
 	static constexpr PredefinedLightData PredefinedLightOffsets = PredefinedLightData::Build();
 	static constexpr PredefinedInstanceData PredefinedInstanceOffsets = PredefinedInstanceData::Build();
+	static constexpr PredefinedMeshData PredefinedMeshOffsets = PredefinedMeshData::Build();
 	static constexpr PredefinedSkeletalData PredefinedSkeletalOffsets = PredefinedSkeletalData::Build();
 	static constexpr PredefinedViewerData PredefinedViewerOffsets = PredefinedViewerData::Build();
 }
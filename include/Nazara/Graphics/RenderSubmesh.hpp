@@ -25,7 +25,7 @@ namespace Nz
 	class RenderSubmesh : public RenderElement
 	{
 		public:
-			inline RenderSubmesh(int renderLayer, std::shared_ptr<MaterialInstance> materialInstance, MaterialPassFlags materialFlags, std::shared_ptr<RenderPipeline> renderPipeline, const WorldInstance& worldInstance, const SkeletonInstance* skeletonInstance, std::size_t indexCount, IndexType indexType, std::shared_ptr<RenderBuffer> indexBuffer, std::shared_ptr<RenderBuffer> vertexBuffer, const Recti& scissorBox);
+			inline RenderSubmesh(int renderLayer, std::shared_ptr<MaterialInstance> materialInstance, MaterialPassFlags materialFlags, std::shared_ptr<RenderPipeline> renderPipeline, const WorldInstance& worldInstance, const SkeletonInstance* skeletonInstance, std::size_t indexCount, IndexType indexType, std::shared_ptr<RenderBuffer> indexBuffer, std::shared_ptr<RenderBuffer> vertexBuffer, std::shared_ptr<RenderBuffer> meshDataBuffer, const Recti& scissorBox);
 			~RenderSubmesh() = default;
 
 			inline UInt64 ComputeSortingScore(const Frustumf& frustum, const RenderQueueRegistry& registry) const override;
@@ -34,6 +34,7 @@ namespace Nz
 			inline std::size_t GetIndexCount() const;
 			inline IndexType GetIndexType() const;
 			inline const MaterialInstance& GetMaterialInstance() const;
+			inline const RenderBuffer* GetMeshDataBuffer() const;
 			inline const RenderPipeline* GetRenderPipeline() const;
 			inline const Recti& GetScissorBox() const;
 			inline const SkeletonInstance* GetSkeletonInstance() const;
@@ -46,6 +47,7 @@ namespace Nz
 
 		private:
 			std::shared_ptr<RenderBuffer> m_indexBuffer;
+			std::shared_ptr<RenderBuffer> m_meshDataBuffer;
 			std::shared_ptr<RenderBuffer> m_vertexBuffer;
 			std::shared_ptr<MaterialInstance> m_materialInstance;
 			std::shared_ptr<RenderPipeline> m_renderPipeline;
@@ -46,12 +46,14 @@ namespace Nz
 		private:
 			void OnAtlasInvalidated(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
+			void OnAtlasRectsRelocated(const AbstractAtlas* atlas, std::size_t layerIndex, AbstractImage* layer, SparsePtr<const Rectui> oldRects, SparsePtr<const Rectui> newRects, std::size_t count);
 
 			struct AtlasSlots
 			{
 				bool used;
 				NazaraSlot(AbstractAtlas, OnAtlasCleared, clearSlot);
 				NazaraSlot(AbstractAtlas, OnAtlasLayerChange, layerChangeSlot);
+				NazaraSlot(AbstractAtlas, OnAtlasRectsRelocated, rectsRelocatedSlot);
 				NazaraSlot(AbstractAtlas, OnAtlasRelease, releaseSlot);
 			};
 
@@ -89,6 +91,8 @@ namespace Nz
 			std::unordered_map<const AbstractAtlas*, AtlasSlots> m_atlases;
 			std::shared_ptr<MaterialInstance> m_material;
 			std::vector<VertexStruct_XYZ_Color_UV> m_vertices;
+			std::vector<VertexStruct_XYZ_Color_UV_DistanceField> m_distanceFieldVertices;
+			bool m_useDistanceField;
 	};
 }
 
@@ -10,6 +10,7 @@ namespace Nz
 	{
 		m_atlases.clear();
 		m_vertices.clear();
+		m_distanceFieldVertices.clear();
 		OnElementInvalidated(this);
 	}
 
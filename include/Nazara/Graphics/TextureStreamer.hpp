@@ -0,0 +1,86 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_TEXTURESTREAMER_HPP
+#define NAZARA_GRAPHICS_TEXTURESTREAMER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/MipStreamingScheduler.hpp>
+#include <Nazara/Graphics/Export.hpp>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class MaterialInstance;
+	class RenderDevice;
+	class RenderResources;
+	class Texture;
+
+	// Uploads the mip tail of textures right away and streams their higher levels over multiple frames
+	// Residency follows the screen size reported by the frame pipelines for the material instances the textures are bound to
+	class NAZARA_GRAPHICS_API TextureStreamer
+	{
+		public:
+			TextureStreamer(std::shared_ptr<RenderDevice> renderDevice, const MipStreamingScheduler::Config& config = MipStreamingScheduler::Config{});
+			TextureStreamer(const TextureStreamer&) = delete;
+			TextureStreamer(TextureStreamer&&) = delete;
+			~TextureStreamer();
+
+			void BindTexture(std::size_t textureIndex, const std::shared_ptr<MaterialInstance>& materialInstance, std::string_view propertyName);
+			void BindTexture(std::size_t textureIndex, const std::shared_ptr<MaterialInstance>& materialInstance, std::size_t propertyIndex);
+
+			inline MipStreamingScheduler& GetScheduler();
+			inline const MipStreamingScheduler& GetScheduler() const;
+			inline const std::shared_ptr<Texture>& GetTexture(std::size_t textureIndex) const;
+
+			inline bool HasTextures() const;
+
+			std::size_t RegisterTexture(std::shared_ptr<const Image> image);
+
+			void ReportUsage(const MaterialInstance& materialInstance, float screenSize);
+
+			void UnregisterTexture(std::size_t textureIndex);
+
+			void Update(RenderResources& renderResources);
+
+			TextureStreamer& operator=(const TextureStreamer&) = delete;
+			TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+			static constexpr std::size_t InvalidTextureIndex = MipStreamingScheduler::InvalidTextureIndex;
+
+		private:
+			std::shared_ptr<Texture> InstantiateTexture(const Image& image, UInt8 firstLevel) const;
+			void ReleaseExpiredBindings();
+
+			struct MaterialBinding
+			{
+				std::weak_ptr<MaterialInstance> materialInstance;
+				std::size_t propertyIndex;
+				const MaterialInstance* materialKey; //< key in m_materialTextures, may be dangling once materialInstance has expired
+			};
+
+			struct StreamedTexture
+			{
+				std::shared_ptr<const Image> image;
+				std::shared_ptr<Texture> texture;
+				std::vector<MaterialBinding> bindings;
+			};
+
+			std::unordered_map<const MaterialInstance*, std::vector<std::size_t>> m_materialTextures;
+			std::shared_ptr<RenderDevice> m_renderDevice;
+			std::vector<MipStreamingScheduler::ResidencyChange> m_residencyChanges;
+			std::vector<StreamedTexture> m_textures;
+			MipStreamingScheduler m_scheduler;
+	};
+}
+
+#include <Nazara/Graphics/TextureStreamer.inl>
+
+#endif // NAZARA_GRAPHICS_TEXTURESTREAMER_HPP
@@ -0,0 +1,29 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline MipStreamingScheduler& TextureStreamer::GetScheduler()
+	{
+		return m_scheduler;
+	}
+
+	inline const MipStreamingScheduler& TextureStreamer::GetScheduler() const
+	{
+		return m_scheduler;
+	}
+
+	inline const std::shared_ptr<Texture>& TextureStreamer::GetTexture(std::size_t textureIndex) const
+	{
+		NazaraAssertFmt(m_scheduler.IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		return m_textures[textureIndex].texture;
+	}
+
+	inline bool TextureStreamer::HasTextures() const
+	{
+		return m_scheduler.GetTextureCount() > 0;
+	}
+}
@@ -107,8 +107,10 @@ namespace Nz
 	using Vector2f = Vector2<float>;
 	using Vector2i = Vector2<int>;
 	using Vector2ui = Vector2<unsigned int>;
+	using Vector2i16 = Vector2<Int16>;
 	using Vector2i32 = Vector2<Int32>;
 	using Vector2i64 = Vector2<Int64>;
+	using Vector2ui16 = Vector2<UInt16>;
 	using Vector2ui32 = Vector2<UInt32>;
 	using Vector2ui64 = Vector2<UInt64>;
 
@@ -103,8 +103,10 @@ namespace Nz
 	using Vector4f = Vector4<float>;
 	using Vector4i = Vector4<int>;
 	using Vector4ui = Vector4<unsigned int>;
+	using Vector4i16 = Vector4<Int16>;
 	using Vector4i32 = Vector4<Int32>;
 	using Vector4i64 = Vector4<Int64>;
+	using Vector4ui16 = Vector4<UInt16>;
 	using Vector4ui32 = Vector4<UInt32>;
 	using Vector4ui64 = Vector4<UInt64>;
 
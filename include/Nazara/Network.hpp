@@ -33,14 +33,20 @@
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/EntitySnapshot.hpp>
+#include <Nazara/Network/EntitySnapshotEncoder.hpp>
 #include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
 #include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/TcpClient.hpp>
@@ -51,4 +57,13 @@
 #include <Nazara/Network/WebService.hpp>
 #include <Nazara/Network/WebServiceAppComponent.hpp>
 
+#ifdef NAZARA_ENTT
+
+#include <Nazara/Network/Components.hpp>
+#include <Nazara/Network/EntitySnapshotDecoder.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <Nazara/Network/Systems.hpp>
+
+#endif
+
 #endif // NAZARA_GLOBAL_NETWORK_HPP
@@ -0,0 +1,37 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_COMPONENTS_INTERESTCOMPONENT_HPP
+#define NAZARA_NETWORK_COMPONENTS_INTERESTCOMPONENT_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/Export.hpp>
+
+namespace Nz
+{
+	class InterestComponent
+	{
+		public:
+			inline InterestComponent(float priority = 1.f);
+			InterestComponent(const InterestComponent&) = default;
+			InterestComponent(InterestComponent&&) = default;
+			~InterestComponent() = default;
+
+			inline float GetPriority() const;
+
+			inline void SetPriority(float priority);
+
+			InterestComponent& operator=(const InterestComponent&) = default;
+			InterestComponent& operator=(InterestComponent&&) = default;
+
+		private:
+			float m_priority;
+	};
+}
+
+#include <Nazara/Network/Components/InterestComponent.inl>
+
+#endif // NAZARA_NETWORK_COMPONENTS_INTERESTCOMPONENT_HPP
@@ -0,0 +1,32 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline InterestComponent::InterestComponent(float priority) :
+	m_priority(priority)
+	{
+		NazaraAssert(priority > 0.f, "priority must be positive");
+	}
+
+	inline float InterestComponent::GetPriority() const
+	{
+		return m_priority;
+	}
+
+	/*!
+	* \brief Sets the priority of the entity, scaling its update rate
+	*
+	* An entity with a priority of 2 is updated as often as an entity of priority 1 twice as close to the observer.
+	*
+	* \param priority New priority, must be positive (defaults to 1)
+	*/
+	inline void InterestComponent::SetPriority(float priority)
+	{
+		NazaraAssert(priority > 0.f, "priority must be positive");
+		m_priority = priority;
+	}
+}
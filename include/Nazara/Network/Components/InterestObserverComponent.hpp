@@ -0,0 +1,66 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_COMPONENTS_INTERESTOBSERVERCOMPONENT_HPP
+#define NAZARA_NETWORK_COMPONENTS_INTERESTOBSERVERCOMPONENT_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class ENetPeer;
+
+	class InterestObserverComponent
+	{
+		friend class InterestSystem;
+
+		public:
+			struct RelevantEntity;
+
+			inline InterestObserverComponent(float radius, ENetPeer* peer = nullptr);
+			InterestObserverComponent(const InterestObserverComponent&) = default;
+			InterestObserverComponent(InterestObserverComponent&&) noexcept = default;
+			~InterestObserverComponent() = default;
+
+			inline const std::vector<entt::entity>& GetEnteringEntities() const;
+			inline const std::vector<entt::entity>& GetLeavingEntities() const;
+			inline std::size_t GetMaxUpdatedEntities() const;
+			inline ENetPeer* GetPeer() const;
+			inline float GetRadius() const;
+			inline const std::vector<RelevantEntity>& GetRelevantEntities() const;
+			inline const std::vector<entt::entity>& GetUpdatedEntities() const;
+
+			inline void SetMaxUpdatedEntities(std::size_t maxUpdatedEntities);
+			inline void SetPeer(ENetPeer* peer);
+			inline void SetRadius(float radius);
+
+			InterestObserverComponent& operator=(const InterestObserverComponent&) = default;
+			InterestObserverComponent& operator=(InterestObserverComponent&&) noexcept = default;
+
+			struct RelevantEntity
+			{
+				entt::entity entity;
+				UInt32 lastUpdateTick;
+				UInt32 networkId;
+			};
+
+		private:
+			std::vector<entt::entity> m_enteringEntities;
+			std::vector<entt::entity> m_leavingEntities;
+			std::vector<entt::entity> m_updatedEntities;
+			std::vector<RelevantEntity> m_relevantEntities; //< sorted by network id
+			std::size_t m_maxUpdatedEntities;
+			ENetPeer* m_peer;
+			float m_radius;
+	};
+}
+
+#include <Nazara/Network/Components/InterestObserverComponent.inl>
+
+#endif // NAZARA_NETWORK_COMPONENTS_INTERESTOBSERVERCOMPONENT_HPP
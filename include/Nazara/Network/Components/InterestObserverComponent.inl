@@ -0,0 +1,83 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline InterestObserverComponent::InterestObserverComponent(float radius, ENetPeer* peer) :
+	m_maxUpdatedEntities(0),
+	m_peer(peer),
+	m_radius(radius)
+	{
+		NazaraAssert(radius > 0.f, "radius must be positive");
+	}
+
+	/*!
+	* \brief Returns the entities which became relevant during the last update
+	*/
+	inline const std::vector<entt::entity>& InterestObserverComponent::GetEnteringEntities() const
+	{
+		return m_enteringEntities;
+	}
+
+	/*!
+	* \brief Returns the entities which were no longer relevant during the last update (they may have been destroyed)
+	*/
+	inline const std::vector<entt::entity>& InterestObserverComponent::GetLeavingEntities() const
+	{
+		return m_leavingEntities;
+	}
+
+	inline std::size_t InterestObserverComponent::GetMaxUpdatedEntities() const
+	{
+		return m_maxUpdatedEntities;
+	}
+
+	inline ENetPeer* InterestObserverComponent::GetPeer() const
+	{
+		return m_peer;
+	}
+
+	inline float InterestObserverComponent::GetRadius() const
+	{
+		return m_radius;
+	}
+
+	inline auto InterestObserverComponent::GetRelevantEntities() const -> const std::vector<RelevantEntity>&
+	{
+		return m_relevantEntities;
+	}
+
+	/*!
+	* \brief Returns the entities whose state should be sent during the last update, sorted by network id
+	*
+	* This includes entering entities, and relevant entities whose update interval (depending on their distance and priority) elapsed.
+	*/
+	inline const std::vector<entt::entity>& InterestObserverComponent::GetUpdatedEntities() const
+	{
+		return m_updatedEntities;
+	}
+
+	/*!
+	* \brief Limits the number of entities updated per tick, the most outdated ones being sent first
+	*
+	* \param maxUpdatedEntities Maximum number of updated entities (entering entities are always updated), 0 for no limit
+	*/
+	inline void InterestObserverComponent::SetMaxUpdatedEntities(std::size_t maxUpdatedEntities)
+	{
+		m_maxUpdatedEntities = maxUpdatedEntities;
+	}
+
+	inline void InterestObserverComponent::SetPeer(ENetPeer* peer)
+	{
+		m_peer = peer;
+	}
+
+	inline void InterestObserverComponent::SetRadius(float radius)
+	{
+		NazaraAssert(radius > 0.f, "radius must be positive");
+		m_radius = radius;
+	}
+}
@@ -22,8 +22,10 @@
 #define NAZARA_NETWORK_ENETCOMPRESSOR_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Time.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -32,12 +34,42 @@ namespace Nz
 	class NAZARA_NETWORK_API ENetCompressor
 	{
 		public:
+			struct Statistics;
+
 			ENetCompressor() = default;
 			virtual ~ENetCompressor();
 
 			virtual std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) = 0;
 			virtual std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) = 0;
+
+			inline const Statistics& GetGlobalStatistics() const;
+			const Statistics* GetPeerStatistics(const ENetPeer* peer) const;
+
+			void ResetStatistics();
+
+			struct Statistics
+			{
+				Time compressionTime = Time::Zero();
+				Time decompressionTime = Time::Zero();
+				UInt64 compressedPacketCount = 0;   //< Packets sent compressed
+				UInt64 decompressedPacketCount = 0;
+				UInt64 inputSize = 0;               //< Bytes given to Compress
+				UInt64 outputSize = 0;              //< Bytes actually sent (packets left uncompressed count for their original size)
+				UInt64 uncompressedPacketCount = 0; //< Packets left uncompressed because compression didn't reduce their size
+
+				inline double GetCompressionRatio() const;
+			};
+
+		protected:
+			void RecordCompression(const ENetPeer* peer, std::size_t inputSize, std::size_t compressedSize, Time duration);
+			void RecordDecompression(const ENetPeer* peer, Time duration);
+
+		private:
+			Statistics m_globalStatistics;
+			std::vector<Statistics> m_peerStatistics; //< indexed by peer id
 	};
 }
 
+#include <Nazara/Network/ENetCompressor.inl>
+
 #endif // NAZARA_NETWORK_ENETCOMPRESSOR_HPP
@@ -0,0 +1,29 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the statistics accumulated over every peer
+	* \return Compression statistics of the host
+	*/
+	inline auto ENetCompressor::GetGlobalStatistics() const -> const Statistics&
+	{
+		return m_globalStatistics;
+	}
+
+	/*!
+	* \brief Computes the ratio between sent and original sizes
+	* \return Compression ratio (lower is better), 1 if nothing was compressed yet
+	*/
+	inline double ENetCompressor::Statistics::GetCompressionRatio() const
+	{
+		if (inputSize == 0)
+			return 1.0;
+
+		return static_cast<double>(outputSize) / static_cast<double>(inputSize);
+	}
+}
+
@@ -36,6 +36,7 @@ namespace Nz
 	class NAZARA_NETWORK_API ENetHost
 	{
 		friend ENetPeer;
+		friend class ENetShardedHost;
 		friend class Network;
 
 		public:
@@ -63,6 +64,8 @@ namespace Nz
 
 			inline bool DoesAllowIncomingConnections() const;
 
+			inline void EnableReusePort(bool reusePort = true);
+
 			void Flush();
 
 			inline IpAddress GetBoundAddress() const;
@@ -72,6 +75,8 @@ namespace Nz
 			inline UInt64 GetTotalSentData() const;
 			inline UInt32 GetTotalSentPackets() const;
 
+			inline bool IsReusePortEnabled() const;
+
 			int Service(ENetEvent* event, UInt32 timeout);
 
 			inline void SetCompressor(std::unique_ptr<ENetCompressor>&& compressor);
@@ -165,6 +170,7 @@ namespace Nz
 			bool m_allowsIncomingConnections;
 			bool m_continueSending;
 			bool m_isUsingDualStack;
+			bool m_isReusePortEnabled;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
 
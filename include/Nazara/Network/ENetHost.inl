@@ -9,6 +9,7 @@ namespace Nz
 	inline ENetHost::ENetHost() :
 	m_packetPool(sizeof(ENetPacket)),
 	m_isUsingDualStack(false),
+	m_isReusePortEnabled(false),
 	m_isSimulationEnabled(false)
 	{
 	}
@@ -72,6 +73,13 @@ namespace Nz
 		return m_allowsIncomingConnections;
 	}
 
+	inline void ENetHost::EnableReusePort(bool reusePort)
+	{
+		NazaraAssert(m_peers.empty(), "Port sharing must be enabled before creating the host");
+
+		m_isReusePortEnabled = reusePort;
+	}
+
 	inline IpAddress ENetHost::GetBoundAddress() const
 	{
 		return m_address;
@@ -102,6 +110,11 @@ namespace Nz
 		return m_totalSentPackets;
 	}
 
+	inline bool ENetHost::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
+
 	inline void ENetHost::SetCompressor(std::unique_ptr<ENetCompressor>&& compressor)
 	{
 		m_compressor = std::move(compressor);
@@ -0,0 +1,35 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETLZ4COMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETLZ4COMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <array>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetLZ4Compressor final : public ENetCompressor
+	{
+		public:
+			ENetLZ4Compressor() = default;
+			~ENetLZ4Compressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+		private:
+			std::size_t CompressBuffers(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize);
+			std::size_t DecompressBuffer(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize);
+
+			static constexpr unsigned int HashBits = 12;
+
+			std::array<UInt16, 1 << HashBits> m_hashTable; //< last input position (plus one) of each hashed sequence, cleared for each datagram
+	};
+}
+
+#endif // NAZARA_NETWORK_ENETLZ4COMPRESSOR_HPP
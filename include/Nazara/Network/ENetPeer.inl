@@ -21,6 +21,11 @@ namespace Nz
 		return m_address;
 	}
 
+	inline UInt32 ENetPeer::GetConnectId() const
+	{
+		return m_connectID;
+	}
+
 	inline UInt32 ENetPeer::GetLastReceiveTime() const
 	{
 		return m_lastReceiveTime;
@@ -0,0 +1,37 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <array>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetRangeCoderCompressor final : public ENetCompressor
+	{
+		public:
+			ENetRangeCoderCompressor() = default;
+			~ENetRangeCoderCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+		private:
+			std::size_t CompressBuffers(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize);
+			std::size_t DecompressBuffer(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize);
+			void ResetModel();
+
+			static constexpr std::size_t ContextCount = 8; //< contexts are selected by the three high bits of the previous byte
+
+			// Adaptive bit probabilities of a binary tree over the 256 byte values, for each context
+			std::array<std::array<UInt16, 256>, ContextCount> m_model;
+	};
+}
+
+#endif // NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
@@ -0,0 +1,87 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+#define NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			struct PeerToken;
+
+			using EventHandler = std::function<void(std::size_t shardIndex, ENetHost& host, ENetEvent& event)>;
+
+			ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) = delete;
+			~ENetShardedHost();
+
+			void Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+
+			inline bool Create(NetProtocol protocol, UInt16 port, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			bool Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0, UInt32 incomingBandwidth = 0, UInt32 outgoingBandwidth = 0);
+			void Destroy();
+
+			void Disconnect(const PeerToken& token, UInt32 data = 0);
+
+			inline UInt32 GetServiceTimeout() const;
+			inline std::size_t GetShardCount() const;
+			ENetHost& GetShardHost(std::size_t shardIndex);
+			UInt32 GetTotalReceivedPackets() const;
+			UInt64 GetTotalReceivedData() const;
+			UInt64 GetTotalSentData() const;
+			UInt32 GetTotalSentPackets() const;
+
+			inline bool IsRunning() const;
+
+			void Send(const PeerToken& token, UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+
+			inline void SetServiceTimeout(UInt32 timeout);
+
+			void Start(EventHandler eventHandler);
+			void Stop();
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) = delete;
+
+			static inline PeerToken GetPeerToken(std::size_t shardIndex, const ENetPeer& peer);
+
+			struct PeerToken
+			{
+				UInt32 connectId;
+				UInt16 peerId;
+				UInt16 shardIndex;
+
+				inline bool operator==(const PeerToken& token) const;
+				inline bool operator!=(const PeerToken& token) const;
+			};
+
+		private:
+			struct Command;
+			struct Shard;
+
+			void RunShard(Shard& shard);
+
+			std::vector<std::unique_ptr<Shard>> m_shards;
+			EventHandler m_eventHandler;
+			UInt32 m_serviceTimeout;
+			bool m_isRunning;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_NETWORK_ENETSHARDEDHOST_HPP
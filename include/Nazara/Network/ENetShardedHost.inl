@@ -0,0 +1,73 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline bool ENetShardedHost::Create(NetProtocol protocol, UInt16 port, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		NazaraAssert(protocol != NetProtocol::Unknown, "Invalid protocol");
+		NazaraAssert(protocol != NetProtocol::Any, "Dual-stack is not supported by sharded hosts");
+
+		IpAddress any = (protocol == NetProtocol::IPv4) ? IpAddress::AnyIpV4 : IpAddress::AnyIpV6;
+		any.SetPort(port);
+
+		return Create(any, shardCount, peerCountPerShard, channelCount);
+	}
+
+	/*!
+	* \brief Gets the maximum time a shard waits for incoming datagrams before checking its command queue
+	* \return Service timeout in milliseconds
+	*
+	* \see SetServiceTimeout
+	*/
+	inline UInt32 ENetShardedHost::GetServiceTimeout() const
+	{
+		return m_serviceTimeout;
+	}
+
+	inline std::size_t ENetShardedHost::GetShardCount() const
+	{
+		return m_shards.size();
+	}
+
+	inline bool ENetShardedHost::IsRunning() const
+	{
+		return m_isRunning;
+	}
+
+	/*!
+	* \brief Sets the maximum time a shard waits for incoming datagrams before checking its command queue
+	*
+	* An idle shard wakes up once per timeout, which bounds the latency of commands (Send, Disconnect, Broadcast) issued from other threads.
+	* Shards can't be woken up on demand as datagrams sent to the shared port are dispatched by the kernel to any shard.
+	* Lower values reduce command latency at the cost of idle wakeups, higher values do the opposite. 0 makes shards busy-loop.
+	*
+	* \param timeout Service timeout in milliseconds (defaults to 1)
+	*
+	* \remark This must be called before Start
+	*/
+	inline void ENetShardedHost::SetServiceTimeout(UInt32 timeout)
+	{
+		NazaraAssert(!m_isRunning, "Service timeout must be set before starting shards");
+
+		m_serviceTimeout = timeout;
+	}
+
+	inline auto ENetShardedHost::GetPeerToken(std::size_t shardIndex, const ENetPeer& peer) -> PeerToken
+	{
+		return PeerToken{ peer.GetConnectId(), peer.GetPeerId(), static_cast<UInt16>(shardIndex) };
+	}
+
+	inline bool ENetShardedHost::PeerToken::operator==(const PeerToken& token) const
+	{
+		return connectId == token.connectId && peerId == token.peerId && shardIndex == token.shardIndex;
+	}
+
+	inline bool ENetShardedHost::PeerToken::operator!=(const PeerToken& token) const
+	{
+		return !operator==(token);
+	}
+}
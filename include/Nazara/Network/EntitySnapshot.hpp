@@ -0,0 +1,57 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENTITYSNAPSHOT_HPP
+#define NAZARA_NETWORK_ENTITYSNAPSHOT_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API EntitySnapshot
+	{
+		friend class EntitySnapshotDecoder;
+		friend class EntitySnapshotSchema;
+		friend class InterestSystem;
+
+		public:
+			struct Entity;
+
+			inline explicit EntitySnapshot(UInt32 tick);
+			EntitySnapshot(const EntitySnapshot&) = default;
+			EntitySnapshot(EntitySnapshot&&) noexcept = default;
+			~EntitySnapshot() = default;
+
+			const Entity* FindEntity(UInt32 networkId) const;
+
+			inline const Entity& GetEntity(std::size_t entityIndex) const;
+			inline std::size_t GetEntityCount() const;
+			inline UInt32 GetTick() const;
+			inline std::size_t GetWordCount(const Entity& entity) const;
+			inline const UInt32* GetWords(const Entity& entity) const;
+
+			EntitySnapshot& operator=(const EntitySnapshot&) = default;
+			EntitySnapshot& operator=(EntitySnapshot&&) noexcept = default;
+
+			struct Entity
+			{
+				UInt32 componentMask;
+				UInt32 firstWord;
+				UInt32 networkId;
+			};
+
+		private:
+			std::vector<Entity> m_entities; //< sorted by network id
+			std::vector<UInt32> m_words;
+			UInt32 m_tick;
+	};
+}
+
+#include <Nazara/Network/EntitySnapshot.inl>
+
+#endif // NAZARA_NETWORK_ENTITYSNAPSHOT_HPP
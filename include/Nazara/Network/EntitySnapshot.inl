@@ -0,0 +1,43 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline EntitySnapshot::EntitySnapshot(UInt32 tick) :
+	m_tick(tick)
+	{
+	}
+
+	inline auto EntitySnapshot::GetEntity(std::size_t entityIndex) const -> const Entity&
+	{
+		NazaraAssert(entityIndex < m_entities.size(), "entity index out of range");
+		return m_entities[entityIndex];
+	}
+
+	inline std::size_t EntitySnapshot::GetEntityCount() const
+	{
+		return m_entities.size();
+	}
+
+	inline UInt32 EntitySnapshot::GetTick() const
+	{
+		return m_tick;
+	}
+
+	inline std::size_t EntitySnapshot::GetWordCount(const Entity& entity) const
+	{
+		std::size_t entityIndex = static_cast<std::size_t>(&entity - m_entities.data());
+		NazaraAssert(entityIndex < m_entities.size(), "entity doesn't belong to this snapshot");
+
+		std::size_t lastWord = (entityIndex + 1 < m_entities.size()) ? m_entities[entityIndex + 1].firstWord : m_words.size();
+		return lastWord - entity.firstWord;
+	}
+
+	inline const UInt32* EntitySnapshot::GetWords(const Entity& entity) const
+	{
+		return m_words.data() + entity.firstWord;
+	}
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENTITYSNAPSHOTDECODER_HPP
+#define NAZARA_NETWORK_ENTITYSNAPSHOTDECODER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Serialization.hpp>
+#include <Nazara/Network/EntitySnapshot.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <entt/entt.hpp>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace Nz
+{
+	class EntitySnapshotSchema;
+
+	class NAZARA_NETWORK_API EntitySnapshotDecoder
+	{
+		public:
+			EntitySnapshotDecoder(std::shared_ptr<const EntitySnapshotSchema> schema, std::size_t maxSnapshotHistory = 64);
+			EntitySnapshotDecoder(const EntitySnapshotDecoder&) = delete;
+			EntitySnapshotDecoder(EntitySnapshotDecoder&&) noexcept = default;
+			~EntitySnapshotDecoder() = default;
+
+			void Apply(entt::registry& registry, const EntitySnapshot& snapshot);
+
+			std::shared_ptr<const EntitySnapshot> Decode(const void* data, std::size_t size);
+			std::shared_ptr<const EntitySnapshot> Decode(SerializationContext& context);
+
+			entt::entity GetEntity(UInt32 networkId) const;
+			inline const std::shared_ptr<const EntitySnapshot>& GetLastSnapshot() const;
+
+			void Reset();
+
+			EntitySnapshotDecoder& operator=(const EntitySnapshotDecoder&) = delete;
+			EntitySnapshotDecoder& operator=(EntitySnapshotDecoder&&) noexcept = default;
+
+		private:
+			bool DecodeComponents(SerializationContext& context, UInt32 componentMask, std::vector<UInt32>& words);
+
+			struct ReplicatedEntity
+			{
+				entt::entity entity = entt::null;
+				UInt32 componentMask = 0;
+			};
+
+			std::deque<std::shared_ptr<const EntitySnapshot>> m_snapshots;
+			std::shared_ptr<const EntitySnapshot> m_lastSnapshot;
+			std::shared_ptr<const EntitySnapshotSchema> m_schema;
+			std::size_t m_maxSnapshotHistory;
+			std::unordered_map<UInt32, ReplicatedEntity> m_entities;
+	};
+}
+
+#include <Nazara/Network/EntitySnapshotDecoder.inl>
+
+#endif // NAZARA_NETWORK_ENTITYSNAPSHOTDECODER_HPP
@@ -0,0 +1,12 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	inline const std::shared_ptr<const EntitySnapshot>& EntitySnapshotDecoder::GetLastSnapshot() const
+	{
+		return m_lastSnapshot;
+	}
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENTITYSNAPSHOTENCODER_HPP
+#define NAZARA_NETWORK_ENTITYSNAPSHOTENCODER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Serialization.hpp>
+#include <Nazara/Network/EntitySnapshot.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <deque>
+#include <memory>
+
+namespace Nz
+{
+	class EntitySnapshotSchema;
+
+	class NAZARA_NETWORK_API EntitySnapshotEncoder
+	{
+		public:
+			EntitySnapshotEncoder(std::shared_ptr<const EntitySnapshotSchema> schema, std::size_t maxPendingSnapshots = 64);
+			EntitySnapshotEncoder(const EntitySnapshotEncoder&) = delete;
+			EntitySnapshotEncoder(EntitySnapshotEncoder&&) noexcept = default;
+			~EntitySnapshotEncoder() = default;
+
+			bool Acknowledge(UInt32 tick);
+
+			ByteArray Encode(std::shared_ptr<const EntitySnapshot> snapshot);
+			bool Encode(SerializationContext& context, std::shared_ptr<const EntitySnapshot> snapshot);
+
+			inline const std::shared_ptr<const EntitySnapshot>& GetBaseline() const;
+			inline const std::shared_ptr<const EntitySnapshot>& GetLastSnapshot() const;
+			inline std::size_t GetPendingSnapshotCount() const;
+
+			void Reset();
+
+			EntitySnapshotEncoder& operator=(const EntitySnapshotEncoder&) = delete;
+			EntitySnapshotEncoder& operator=(EntitySnapshotEncoder&&) noexcept = default;
+
+			static constexpr UInt32 NoBaseline = 0xFFFFFFFF;
+
+		private:
+			bool EncodeComponents(SerializationContext& context, UInt32 componentMask, const UInt32* words);
+
+			std::deque<std::shared_ptr<const EntitySnapshot>> m_pendingSnapshots;
+			std::shared_ptr<const EntitySnapshot> m_baseline;
+			std::shared_ptr<const EntitySnapshotSchema> m_schema;
+			std::size_t m_maxPendingSnapshots;
+	};
+}
+
+#include <Nazara/Network/EntitySnapshotEncoder.inl>
+
+#endif // NAZARA_NETWORK_ENTITYSNAPSHOTENCODER_HPP
@@ -0,0 +1,28 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	inline const std::shared_ptr<const EntitySnapshot>& EntitySnapshotEncoder::GetBaseline() const
+	{
+		return m_baseline;
+	}
+
+	/*!
+	* \brief Returns the last encoded snapshot (acknowledged or not), or the baseline if none is pending
+	*/
+	inline const std::shared_ptr<const EntitySnapshot>& EntitySnapshotEncoder::GetLastSnapshot() const
+	{
+		if (!m_pendingSnapshots.empty())
+			return m_pendingSnapshots.back();
+
+		return m_baseline;
+	}
+
+	inline std::size_t EntitySnapshotEncoder::GetPendingSnapshotCount() const
+	{
+		return m_pendingSnapshots.size();
+	}
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENTITYSNAPSHOTSCHEMA_HPP
+#define NAZARA_NETWORK_ENTITYSNAPSHOTSCHEMA_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/EntitySnapshot.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <entt/entt.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API EntitySnapshotSchema
+	{
+		public:
+			struct Component;
+			struct Field;
+			template<typename T> class ComponentBuilder;
+
+			EntitySnapshotSchema() = default;
+			EntitySnapshotSchema(const EntitySnapshotSchema&) = delete;
+			EntitySnapshotSchema(EntitySnapshotSchema&&) noexcept = default;
+			~EntitySnapshotSchema() = default;
+
+			template<typename T> ComponentBuilder<T> AddComponent();
+
+			void ApplyComponent(entt::registry& registry, entt::entity entity, std::size_t componentIndex, const UInt32* words) const;
+
+			std::shared_ptr<EntitySnapshot> Capture(const entt::registry& registry, UInt32 tick) const;
+			std::shared_ptr<EntitySnapshot> Capture(const entt::registry& registry, UInt32 tick, const entt::entity* entities, std::size_t entityCount) const;
+
+			inline const Component& GetComponent(std::size_t componentIndex) const;
+			inline std::size_t GetComponentCount() const;
+			inline UInt32 GetComponentMask(const entt::registry& registry, entt::entity entity) const;
+			inline std::size_t GetWordCount(UInt32 componentMask) const;
+
+			inline void RemoveComponent(entt::registry& registry, entt::entity entity, std::size_t componentIndex) const;
+
+			EntitySnapshotSchema& operator=(const EntitySnapshotSchema&) = delete;
+			EntitySnapshotSchema& operator=(EntitySnapshotSchema&&) noexcept = default;
+
+			static inline float DequantizeFloat(UInt32 value, float min, float max, UInt8 bitCount);
+			static inline Quaternionf DequantizeQuaternion(UInt32 value, UInt8 bitCount);
+			static inline UInt32 QuantizeFloat(float value, float min, float max, UInt8 bitCount);
+			static inline UInt32 QuantizeQuaternion(const Quaternionf& value, UInt8 bitCount);
+
+			static constexpr std::size_t MaxComponentCount = 32;
+
+			struct Field
+			{
+				std::function<void(const UInt32* words, void* component)> dequantize;
+				std::function<void(const void* component, UInt32* words)> quantize;
+				UInt8 wordBitCount;
+				UInt8 wordCount;
+			};
+
+			struct Component
+			{
+				std::function<void(const entt::registry& registry, std::vector<entt::entity>& entities)> collectEntities;
+				std::function<void*(entt::registry& registry, entt::entity entity)> getOrEmplace;
+				std::function<void(entt::registry& registry, entt::entity entity)> remove;
+				std::function<const void*(const entt::registry& registry, entt::entity entity)> tryGet;
+				std::vector<Field> fields;
+				std::size_t wordCount = 0;
+			};
+
+		private:
+			std::vector<Component> m_components;
+	};
+
+	template<typename T>
+	class EntitySnapshotSchema::ComponentBuilder
+	{
+		public:
+			inline ComponentBuilder(EntitySnapshotSchema& schema, std::size_t componentIndex);
+
+			ComponentBuilder& AddBool(bool T::* member);
+			template<typename Getter, typename Setter> ComponentBuilder& AddBool(Getter&& getter, Setter&& setter);
+			ComponentBuilder& AddFloat(float T::* member, float min, float max, UInt8 bitCount);
+			template<typename Getter, typename Setter> ComponentBuilder& AddFloat(Getter&& getter, Setter&& setter, float min, float max, UInt8 bitCount);
+			template<typename V> ComponentBuilder& AddInteger(V T::* member, UInt8 bitCount);
+			template<typename Getter, typename Setter> ComponentBuilder& AddInteger(Getter&& getter, Setter&& setter, UInt8 bitCount);
+			ComponentBuilder& AddQuaternion(Quaternionf T::* member, UInt8 bitCount);
+			template<typename Getter, typename Setter> ComponentBuilder& AddQuaternion(Getter&& getter, Setter&& setter, UInt8 bitCount);
+			ComponentBuilder& AddVector3(Vector3f T::* member, float min, float max, UInt8 bitCount);
+			template<typename Getter, typename Setter> ComponentBuilder& AddVector3(Getter&& getter, Setter&& setter, float min, float max, UInt8 bitCount);
+
+		private:
+			template<typename Quantize, typename Dequantize> ComponentBuilder& AddField(UInt8 wordCount, UInt8 wordBitCount, Quantize&& quantize, Dequantize&& dequantize);
+
+			EntitySnapshotSchema& m_schema;
+			std::size_t m_componentIndex;
+	};
+}
+
+#include <Nazara/Network/EntitySnapshotSchema.inl>
+
+#endif // NAZARA_NETWORK_ENTITYSNAPSHOTSCHEMA_HPP
@@ -0,0 +1,365 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T>
+	auto EntitySnapshotSchema::AddComponent() -> ComponentBuilder<T>
+	{
+		NazaraAssert(m_components.size() < MaxComponentCount, "too many components");
+
+		Component& component = m_components.emplace_back();
+		component.collectEntities = [](const entt::registry& registry, std::vector<entt::entity>& entities)
+		{
+			for (entt::entity entity : registry.view<const T>())
+				entities.push_back(entity);
+		};
+
+		component.remove = [](entt::registry& registry, entt::entity entity)
+		{
+			registry.remove<T>(entity);
+		};
+
+		if constexpr (std::is_empty_v<T>)
+		{
+			// entt doesn't store empty types (tags), only their presence is replicated
+			component.getOrEmplace = [](entt::registry& registry, entt::entity entity) -> void*
+			{
+				registry.emplace_or_replace<T>(entity);
+				return nullptr;
+			};
+
+			component.tryGet = [](const entt::registry& registry, entt::entity entity) -> const void*
+			{
+				return (registry.all_of<T>(entity)) ? &registry : nullptr;
+			};
+		}
+		else
+		{
+			component.getOrEmplace = [](entt::registry& registry, entt::entity entity) -> void*
+			{
+				return &registry.get_or_emplace<T>(entity);
+			};
+
+			component.tryGet = [](const entt::registry& registry, entt::entity entity) -> const void*
+			{
+				return registry.try_get<T>(entity);
+			};
+		}
+
+		return ComponentBuilder<T>(*this, m_components.size() - 1);
+	}
+
+	inline auto EntitySnapshotSchema::GetComponent(std::size_t componentIndex) const -> const Component&
+	{
+		NazaraAssert(componentIndex < m_components.size(), "component index out of range");
+		return m_components[componentIndex];
+	}
+
+	inline std::size_t EntitySnapshotSchema::GetComponentCount() const
+	{
+		return m_components.size();
+	}
+
+	inline UInt32 EntitySnapshotSchema::GetComponentMask(const entt::registry& registry, entt::entity entity) const
+	{
+		UInt32 componentMask = 0;
+		for (std::size_t i = 0; i < m_components.size(); ++i)
+		{
+			if (m_components[i].tryGet(registry, entity))
+				componentMask |= UInt32(1) << i;
+		}
+
+		return componentMask;
+	}
+
+	inline std::size_t EntitySnapshotSchema::GetWordCount(UInt32 componentMask) const
+	{
+		std::size_t wordCount = 0;
+		for (std::size_t i = 0; i < m_components.size(); ++i)
+		{
+			if (componentMask & (UInt32(1) << i))
+				wordCount += m_components[i].wordCount;
+		}
+
+		return wordCount;
+	}
+
+	inline void EntitySnapshotSchema::RemoveComponent(entt::registry& registry, entt::entity entity, std::size_t componentIndex) const
+	{
+		NazaraAssert(componentIndex < m_components.size(), "component index out of range");
+		m_components[componentIndex].remove(registry, entity);
+	}
+
+	inline float EntitySnapshotSchema::DequantizeFloat(UInt32 value, float min, float max, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+
+		double maxValue = double((UInt64(1) << bitCount) - 1);
+		return static_cast<float>(min + (max - min) * (value / maxValue));
+	}
+
+	inline Quaternionf EntitySnapshotSchema::DequantizeQuaternion(UInt32 value, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 10, "bit count must be between 1 and 10");
+
+		constexpr float MaxComponent = 0.70710678f; //< 1/sqrt(2), the largest value of the three smallest components
+
+		UInt32 largestIndex = value & 0x3;
+		UInt32 componentMask = (UInt32(1) << bitCount) - 1;
+
+		float components[4];
+		float squaredSum = 0.f;
+		unsigned int shift = 2;
+		for (UInt32 i = 0; i < 4; ++i)
+		{
+			if (i == largestIndex)
+				continue;
+
+			components[i] = DequantizeFloat((value >> shift) & componentMask, -MaxComponent, MaxComponent, bitCount);
+			squaredSum += components[i] * components[i];
+			shift += bitCount;
+		}
+
+		components[largestIndex] = std::sqrt(std::max(1.f - squaredSum, 0.f));
+
+		return Quaternionf(components[3], components[0], components[1], components[2]);
+	}
+
+	inline UInt32 EntitySnapshotSchema::QuantizeFloat(float value, float min, float max, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+		NazaraAssert(min < max, "invalid range");
+
+		double maxValue = double((UInt64(1) << bitCount) - 1);
+		double normalized = std::clamp((double(value) - min) / (double(max) - min), 0.0, 1.0);
+
+		return static_cast<UInt32>(normalized * maxValue + 0.5);
+	}
+
+	/*!
+	* \brief Packs a rotation using the smallest three method
+	* \return Packed rotation, using 2 + 3 * bitCount bits
+	*
+	* As a unit quaternion, its largest component can be computed back from the others and only its index is sent.
+	* The three others are in the [-1/sqrt(2), 1/sqrt(2)] range, allowing a better precision for the same bit count.
+	*
+	* \param value Rotation to pack, doesn't have to be normalized
+	* \param bitCount Number of bits of each of the three smallest components, from 1 to 10
+	*/
+	inline UInt32 EntitySnapshotSchema::QuantizeQuaternion(const Quaternionf& value, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 10, "bit count must be between 1 and 10");
+
+		constexpr float MaxComponent = 0.70710678f;
+
+		Quaternionf normalized = Quaternionf::Normalize(value);
+		float components[4] = { normalized.x, normalized.y, normalized.z, normalized.w };
+
+		UInt32 largestIndex = 0;
+		for (UInt32 i = 1; i < 4; ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[largestIndex]))
+				largestIndex = i;
+		}
+
+		// q and -q represent the same rotation, make the largest component positive so its sign doesn't have to be sent
+		float sign = (components[largestIndex] < 0.f) ? -1.f : 1.f;
+
+		UInt32 packed = largestIndex;
+		unsigned int shift = 2;
+		for (UInt32 i = 0; i < 4; ++i)
+		{
+			if (i == largestIndex)
+				continue;
+
+			packed |= QuantizeFloat(components[i] * sign, -MaxComponent, MaxComponent, bitCount) << shift;
+			shift += bitCount;
+		}
+
+		return packed;
+	}
+
+	template<typename T>
+	EntitySnapshotSchema::ComponentBuilder<T>::ComponentBuilder(EntitySnapshotSchema& schema, std::size_t componentIndex) :
+	m_schema(schema),
+	m_componentIndex(componentIndex)
+	{
+	}
+
+	template<typename T>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddBool(bool T::* member) -> ComponentBuilder&
+	{
+		return AddBool([member](const T& component) { return component.*member; }, [member](T& component, bool value) { component.*member = value; });
+	}
+
+	template<typename T>
+	template<typename Getter, typename Setter>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddBool(Getter&& getter, Setter&& setter) -> ComponentBuilder&
+	{
+		return AddField(1, 1,
+			[getter = std::forward<Getter>(getter)](const T& component, UInt32* words)
+			{
+				words[0] = (std::invoke(getter, component)) ? 1 : 0;
+			},
+			[setter = std::forward<Setter>(setter)](const UInt32* words, T& component)
+			{
+				std::invoke(setter, component, words[0] != 0);
+			});
+	}
+
+	template<typename T>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddFloat(float T::* member, float min, float max, UInt8 bitCount) -> ComponentBuilder&
+	{
+		return AddFloat([member](const T& component) { return component.*member; }, [member](T& component, float value) { component.*member = value; }, min, max, bitCount);
+	}
+
+	template<typename T>
+	template<typename Getter, typename Setter>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddFloat(Getter&& getter, Setter&& setter, float min, float max, UInt8 bitCount) -> ComponentBuilder&
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+		NazaraAssert(min < max, "invalid range");
+
+		return AddField(1, bitCount,
+			[getter = std::forward<Getter>(getter), min, max, bitCount](const T& component, UInt32* words)
+			{
+				words[0] = QuantizeFloat(std::invoke(getter, component), min, max, bitCount);
+			},
+			[setter = std::forward<Setter>(setter), min, max, bitCount](const UInt32* words, T& component)
+			{
+				std::invoke(setter, component, DequantizeFloat(words[0], min, max, bitCount));
+			});
+	}
+
+	template<typename T>
+	template<typename V>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddInteger(V T::* member, UInt8 bitCount) -> ComponentBuilder&
+	{
+		return AddInteger([member](const T& component) { return component.*member; }, [member](T& component, V value) { component.*member = value; }, bitCount);
+	}
+
+	/*!
+	* \brief Adds an integer field, clamped to the range representable on bitCount bits
+	*
+	* Signed integers are zigzag-encoded so small negative values stay small.
+	*/
+	template<typename T>
+	template<typename Getter, typename Setter>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddInteger(Getter&& getter, Setter&& setter, UInt8 bitCount) -> ComponentBuilder&
+	{
+		using V = std::decay_t<std::invoke_result_t<Getter&, const T&>>;
+		static_assert(std::is_integral_v<V>, "integer fields require an integral type");
+
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+
+		return AddField(1, bitCount,
+			[getter = std::forward<Getter>(getter), bitCount](const T& component, UInt32* words)
+			{
+				V value = std::invoke(getter, component);
+				if constexpr (std::is_signed_v<V>)
+				{
+					Int64 maxValue = (Int64(1) << (bitCount - 1)) - 1;
+					Int64 clampedValue = std::clamp<Int64>(value, -maxValue - 1, maxValue);
+					words[0] = static_cast<UInt32>((static_cast<UInt64>(clampedValue) << 1) ^ static_cast<UInt64>(clampedValue >> 63));
+				}
+				else
+				{
+					UInt64 maxValue = (UInt64(1) << bitCount) - 1;
+					words[0] = static_cast<UInt32>(std::min<UInt64>(value, maxValue));
+				}
+			},
+			[setter = std::forward<Setter>(setter)](const UInt32* words, T& component)
+			{
+				if constexpr (std::is_signed_v<V>)
+				{
+					Int64 value = static_cast<Int64>(words[0] >> 1) ^ -static_cast<Int64>(words[0] & 1);
+					std::invoke(setter, component, static_cast<V>(value));
+				}
+				else
+					std::invoke(setter, component, static_cast<V>(words[0]));
+			});
+	}
+
+	template<typename T>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddQuaternion(Quaternionf T::* member, UInt8 bitCount) -> ComponentBuilder&
+	{
+		return AddQuaternion([member](const T& component) -> const Quaternionf& { return component.*member; }, [member](T& component, const Quaternionf& value) { component.*member = value; }, bitCount);
+	}
+
+	template<typename T>
+	template<typename Getter, typename Setter>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddQuaternion(Getter&& getter, Setter&& setter, UInt8 bitCount) -> ComponentBuilder&
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 10, "bit count must be between 1 and 10");
+
+		return AddField(1, SafeCast<UInt8>(2 + 3 * bitCount),
+			[getter = std::forward<Getter>(getter), bitCount](const T& component, UInt32* words)
+			{
+				words[0] = QuantizeQuaternion(std::invoke(getter, component), bitCount);
+			},
+			[setter = std::forward<Setter>(setter), bitCount](const UInt32* words, T& component)
+			{
+				std::invoke(setter, component, DequantizeQuaternion(words[0], bitCount));
+			});
+	}
+
+	template<typename T>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddVector3(Vector3f T::* member, float min, float max, UInt8 bitCount) -> ComponentBuilder&
+	{
+		return AddVector3([member](const T& component) -> const Vector3f& { return component.*member; }, [member](T& component, const Vector3f& value) { component.*member = value; }, min, max, bitCount);
+	}
+
+	template<typename T>
+	template<typename Getter, typename Setter>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddVector3(Getter&& getter, Setter&& setter, float min, float max, UInt8 bitCount) -> ComponentBuilder&
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+		NazaraAssert(min < max, "invalid range");
+
+		return AddField(3, bitCount,
+			[getter = std::forward<Getter>(getter), min, max, bitCount](const T& component, UInt32* words)
+			{
+				const Vector3f& value = std::invoke(getter, component);
+				words[0] = QuantizeFloat(value.x, min, max, bitCount);
+				words[1] = QuantizeFloat(value.y, min, max, bitCount);
+				words[2] = QuantizeFloat(value.z, min, max, bitCount);
+			},
+			[setter = std::forward<Setter>(setter), min, max, bitCount](const UInt32* words, T& component)
+			{
+				std::invoke(setter, component, Vector3f(DequantizeFloat(words[0], min, max, bitCount), DequantizeFloat(words[1], min, max, bitCount), DequantizeFloat(words[2], min, max, bitCount)));
+			});
+	}
+
+	template<typename T>
+	template<typename Quantize, typename Dequantize>
+	auto EntitySnapshotSchema::ComponentBuilder<T>::AddField(UInt8 wordCount, UInt8 wordBitCount, Quantize&& quantize, Dequantize&& dequantize) -> ComponentBuilder&
+	{
+		static_assert(!std::is_empty_v<T>, "empty components cannot have fields");
+
+		Component& component = m_schema.m_components[m_componentIndex];
+		component.wordCount += wordCount;
+
+		Field& field = component.fields.emplace_back();
+		field.wordCount = wordCount;
+		field.wordBitCount = wordBitCount;
+		field.quantize = [quantize = std::forward<Quantize>(quantize)](const void* componentPtr, UInt32* words)
+		{
+			quantize(*static_cast<const T*>(componentPtr), words);
+		};
+
+		field.dequantize = [dequantize = std::forward<Dequantize>(dequantize)](const UInt32* words, void* componentPtr)
+		{
+			dequantize(words, *static_cast<T*>(componentPtr));
+		};
+
+		return *this;
+	}
+}
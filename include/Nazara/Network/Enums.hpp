@@ -11,6 +11,17 @@
 
 namespace Nz
 {
+	enum class MessageLengthPrefix
+	{
+		UInt16, //< Two bytes in network byte order, messages are limited to 65535 bytes
+		UInt32, //< Four bytes in network byte order
+		VarInt, //< One to five bytes (LEB128), small messages only pay for a single byte
+
+		Max = VarInt
+	};
+
+	constexpr std::size_t MessageLengthPrefixCount = static_cast<std::size_t>(MessageLengthPrefix::Max) + 1;
+
 	enum class NetProtocol
 	{
 		Any,
@@ -52,6 +63,16 @@ namespace Nz
 
 	constexpr std::size_t ResolveErrorCount = static_cast<std::size_t>(ResolveError::Max) + 1;
 
+	enum class SocketCompletionBackend
+	{
+		IoUring, //< Operations are executed asynchronously by the kernel (io_uring, Linux only)
+		Poller,  //< Operations are executed when a SocketPoller reports their socket as ready
+
+		Max = Poller
+	};
+
+	constexpr std::size_t SocketCompletionBackendCount = static_cast<std::size_t>(SocketCompletionBackend::Max) + 1;
+
 	enum class SocketError
 	{
 		NoError,
@@ -77,6 +98,19 @@ namespace Nz
 
 	constexpr std::size_t SocketErrorCount = static_cast<std::size_t>(SocketError::Max) + 1;
 
+	enum class SocketOperation
+	{
+		Accept,      //< A connection was accepted on a listening TCP socket
+		Receive,     //< Data was received on a socket
+		ReceiveFrom, //< A datagram was received on a UDP socket, along with its sender address
+		Send,        //< Data was sent on a socket
+		SendTo,      //< A datagram was sent on a UDP socket
+
+		Max = SendTo
+	};
+
+	constexpr std::size_t SocketOperationCount = static_cast<std::size_t>(SocketOperation::Max) + 1;
+
 	enum class SocketPollEvent
 	{
 		Read,  //< One or more sockets is ready for a read operation
@@ -95,6 +129,16 @@ namespace Nz
 
 	using SocketPollEventFlags = Flags<SocketPollEvent>;
 
+	enum class SocketPollMode
+	{
+		EdgeTriggered,  //< Sockets are reported once when they become ready, and again only after a new event (e.g. new data incoming)
+		LevelTriggered, //< Sockets are reported as long as they are ready
+
+		Max = LevelTriggered
+	};
+
+	constexpr std::size_t SocketPollModeCount = static_cast<std::size_t>(SocketPollMode::Max) + 1;
+
 	enum class SocketState
 	{
 		Bound,        //< The socket is currently bound
@@ -135,6 +179,14 @@ namespace Nz
 	};
 
 	using WebRequestOptionFlags = Flags<WebRequestOption>;
+
+	enum class WebServicePollMode
+	{
+		Perform,      //< Every transfer is driven by curl_multi_perform on each Poll
+		SocketEvents, //< Only transfers whose socket is ready (or whose timer expired) are driven by curl_multi_socket_action, sockets being watched by a SocketPoller
+
+		Max = SocketEvents
+	};
 }
 
 #endif // NAZARA_NETWORK_ENUMS_HPP
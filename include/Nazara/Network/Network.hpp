@@ -9,6 +9,7 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Core.hpp>
+#include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <memory>
 
@@ -28,7 +29,7 @@ namespace Nz
 			Network(Config config);
 			~Network();
 
-			std::unique_ptr<WebService> InstantiateWebService();
+			std::unique_ptr<WebService> InstantiateWebService(WebServicePollMode pollMode = WebServicePollMode::Perform);
 
 			struct Config
 			{
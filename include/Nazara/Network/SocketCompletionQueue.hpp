@@ -0,0 +1,90 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SOCKETCOMPLETIONQUEUE_HPP
+#define NAZARA_NETWORK_SOCKETCOMPLETIONQUEUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/Enums.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <memory>
+#include <span>
+
+namespace Nz
+{
+	class AbstractSocket;
+	class SocketCompletionQueueImpl;
+	class TcpClient;
+	class TcpServer;
+	class UdpSocket;
+
+	class NAZARA_NETWORK_API SocketCompletionQueue
+	{
+		public:
+			struct Completion;
+			struct Config;
+
+			SocketCompletionQueue();
+			SocketCompletionQueue(const Config& config);
+			SocketCompletionQueue(const SocketCompletionQueue&) = delete;
+			SocketCompletionQueue(SocketCompletionQueue&&) noexcept;
+			~SocketCompletionQueue();
+
+			bool Accept(TcpServer& server, TcpClient* newClient, void* userdata = nullptr);
+
+			SocketCompletionBackend GetBackend() const;
+			std::span<UInt8> GetBuffer(UInt32 bufferIndex);
+			std::span<const UInt8> GetBuffer(UInt32 bufferIndex) const;
+			std::size_t GetBufferSize() const;
+			std::span<const Completion> GetCompletions() const;
+			std::size_t GetPendingOperationCount() const;
+
+			bool Receive(AbstractSocket& socket, void* buffer, std::size_t size, void* userdata = nullptr);
+			bool ReceiveFrom(UdpSocket& socket, void* buffer, std::size_t size, void* userdata = nullptr);
+			bool ReceiveFromPooled(UdpSocket& socket, void* userdata = nullptr);
+			bool ReceivePooled(AbstractSocket& socket, void* userdata = nullptr);
+			void ReleaseBuffer(UInt32 bufferIndex);
+
+			bool Send(AbstractSocket& socket, const void* buffer, std::size_t size, void* userdata = nullptr);
+			bool SendTo(UdpSocket& socket, const IpAddress& to, const void* buffer, std::size_t size, void* userdata = nullptr);
+
+			unsigned int Wait(int msTimeout, SocketError* error = nullptr);
+
+			SocketCompletionQueue& operator=(const SocketCompletionQueue&) = delete;
+			SocketCompletionQueue& operator=(SocketCompletionQueue&&) noexcept;
+
+			static constexpr UInt32 InvalidBufferIndex = 0xFFFFFFFF;
+
+			struct Completion
+			{
+				IpAddress address;            //< Peer address of accepted connections and sender address of received datagrams
+				void* userdata;
+				std::size_t transferredBytes;
+				UInt32 bufferIndex;           //< Pooled buffer holding received data (to be released using ReleaseBuffer), InvalidBufferIndex if none
+				SocketError error;
+				SocketOperation operation;
+			};
+
+			struct Config
+			{
+				// Number and size of the receive buffers of the pool (registered to the kernel with io_uring)
+				std::size_t bufferCount = 256;
+				std::size_t bufferSize = 2048;
+
+				// Maximum number of operations submitted to the kernel at once, more operations are queued until the next Wait call
+				UInt32 queueDepth = 256;
+
+				// Backend to use, falls back to the poller backend if io_uring is unavailable
+				SocketCompletionBackend backend = SocketCompletionBackend::IoUring;
+			};
+
+		private:
+			std::unique_ptr<SocketCompletionQueueImpl> m_impl;
+	};
+}
+
+#endif // NAZARA_NETWORK_SOCKETCOMPLETIONQUEUE_HPP
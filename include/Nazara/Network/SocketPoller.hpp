@@ -10,6 +10,7 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <span>
 
 namespace Nz
 {
@@ -18,6 +19,12 @@ namespace Nz
 	class NAZARA_NETWORK_API SocketPoller
 	{
 		public:
+			struct ReadyEvent
+			{
+				void* userdata;
+				SocketPollEventFlags events;
+			};
+
 			SocketPoller();
 			SocketPoller(const SocketPoller&) = delete;
 			SocketPoller(SocketPoller&&) noexcept = default;
@@ -25,18 +32,31 @@ namespace Nz
 
 			void Clear();
 
+			std::size_t GetEventCapacity() const;
+			std::span<const ReadyEvent> GetReadyEvents() const;
+
 			bool IsReadyToRead(const AbstractSocket& socket) const;
 			bool IsReadyToWrite(const AbstractSocket& socket) const;
-			bool IsRegistered(const AbstractSocket& socket) const;
+			inline bool IsRegistered(const AbstractSocket& socket) const;
+			bool IsRegistered(SocketHandle socket) const;
+
+			inline bool ModifySocket(AbstractSocket& socket, SocketPollEventFlags eventFlags);
+			bool ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags);
 
-			bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags);
-			void UnregisterSocket(AbstractSocket& socket);
+			inline bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags, void* userdata = nullptr, SocketPollMode pollMode = SocketPollMode::LevelTriggered);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata = nullptr, SocketPollMode pollMode = SocketPollMode::LevelTriggered);
+			inline void UnregisterSocket(AbstractSocket& socket);
+			void UnregisterSocket(SocketHandle socket);
+
+			void SetEventCapacity(std::size_t eventCapacity);
 
 			unsigned int Wait(int msTimeout, SocketError* error = nullptr);
 
 			SocketPoller& operator=(const SocketPoller&) = delete;
 			SocketPoller& operator=(SocketPoller&&) noexcept = default;
 
+			static constexpr std::size_t DefaultEventCapacity = 1024;
+
 		private:
 			MovablePtr<SocketPollerImpl> m_impl;
 	};
@@ -5,5 +5,24 @@
 
 namespace Nz
 {
+	inline bool SocketPoller::IsRegistered(const AbstractSocket& socket) const
+	{
+		return IsRegistered(socket.GetNativeHandle());
+	}
+
+	inline bool SocketPoller::ModifySocket(AbstractSocket& socket, SocketPollEventFlags eventFlags)
+	{
+		return ModifySocket(socket.GetNativeHandle(), eventFlags);
+	}
+
+	inline bool SocketPoller::RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode pollMode)
+	{
+		return RegisterSocket(socket.GetNativeHandle(), eventFlags, userdata, pollMode);
+	}
+
+	inline void SocketPoller::UnregisterSocket(AbstractSocket& socket)
+	{
+		UnregisterSocket(socket.GetNativeHandle());
+	}
 }
 
@@ -0,0 +1,118 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SYSTEMS_INTERESTSYSTEM_HPP
+#define NAZARA_NETWORK_SYSTEMS_INTERESTSYSTEM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/EntitySnapshot.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <Nazara/Network/Components/InterestComponent.hpp>
+#include <Nazara/Network/Components/InterestObserverComponent.hpp>
+#include <NazaraUtils/TypeList.hpp>
+#include <entt/entt.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API InterestSystem
+	{
+		public:
+			using Components = TypeList<class NodeComponent, InterestComponent, InterestObserverComponent>;
+
+			InterestSystem(entt::registry& registry, float cellSize = 64.f);
+			InterestSystem(const InterestSystem&) = delete;
+			InterestSystem(InterestSystem&&) = delete;
+			~InterestSystem() = default;
+
+			std::shared_ptr<EntitySnapshot> BuildSnapshot(const InterestObserverComponent& observer, const EntitySnapshot& worldSnapshot, const EntitySnapshot* lastSentSnapshot = nullptr) const;
+
+			inline float GetCellSize() const;
+			inline UInt32 GetMaxUpdateInterval() const;
+			inline std::size_t GetTrackedEntityCount() const;
+
+			inline void SetMaxUpdateInterval(UInt32 maxUpdateInterval);
+
+			void Update(UInt32 tick);
+
+			InterestSystem& operator=(const InterestSystem&) = delete;
+			InterestSystem& operator=(InterestSystem&&) = delete;
+
+		private:
+			struct TrackedEntity;
+
+			void MoveToCell(UInt32 trackedIndex, UInt64 cellKey, const Vector3f& position, float priority);
+			void OnEntityDisabled(entt::registry& registry, entt::entity entity);
+			void OnInterestDestroy(entt::registry& registry, entt::entity entity);
+			void OnNodeDestroy(entt::registry& registry, entt::entity entity);
+			void RemoveFromCell(const TrackedEntity& trackedEntity);
+			UInt32 TrackEntity(entt::entity entity);
+			void UntrackEntity(entt::entity entity);
+			void UpdateObserver(InterestObserverComponent& observer, const Vector3f& position, UInt32 tick);
+
+			inline Int64 GetCellCoordinate(float value) const;
+			inline UInt64 GetCellKey(const Vector3f& position) const;
+
+			static inline UInt64 GetCellKey(Int64 x, Int64 y, Int64 z);
+
+			static constexpr UInt32 InvalidIndex = 0xFFFFFFFF;
+			static constexpr UInt64 InvalidCell = 0xFFFFFFFFFFFFFFFF;
+
+			// Everything needed by observer queries is stored in cells to keep them cache-friendly
+			struct CellEntry
+			{
+				Vector3f position;
+				entt::entity entity;
+				UInt32 networkId;
+				UInt32 trackedIndex;
+				float priority;
+			};
+
+			struct Candidate
+			{
+				entt::entity entity;
+				UInt32 networkId;
+				float priority;
+				float squaredDistance;
+			};
+
+			struct DueEntity
+			{
+				float urgency;
+				UInt32 relevantIndex;
+			};
+
+			struct TrackedEntity
+			{
+				entt::entity entity;
+				std::vector<CellEntry>* cell; //< unordered_map values are never moved
+				UInt64 cellKey;
+				UInt32 cellIndex;
+			};
+
+			std::unordered_map<UInt64, std::vector<CellEntry>> m_cells;
+			std::vector<Candidate> m_candidates;
+			std::vector<DueEntity> m_dueEntities;
+			std::vector<InterestObserverComponent::RelevantEntity> m_relevantEntities;
+			std::vector<TrackedEntity> m_trackedEntities;
+			std::vector<UInt32> m_trackedIndices; //< indexed by entity index (without version)
+			entt::registry& m_registry;
+			entt::scoped_connection m_disabledConstructConnection;
+			entt::scoped_connection m_interestDestroyConnection;
+			entt::scoped_connection m_nodeDestroyConnection;
+			float m_cellSize;
+			float m_invCellSize;
+			UInt32 m_maxUpdateInterval;
+			UInt32 m_tick;
+	};
+}
+
+#include <Nazara/Network/Systems/InterestSystem.inl>
+
+#endif // NAZARA_NETWORK_SYSTEMS_INTERESTSYSTEM_HPP
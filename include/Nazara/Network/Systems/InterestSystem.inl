@@ -0,0 +1,55 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <cmath>
+
+namespace Nz
+{
+	inline float InterestSystem::GetCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	inline UInt32 InterestSystem::GetMaxUpdateInterval() const
+	{
+		return m_maxUpdateInterval;
+	}
+
+	inline std::size_t InterestSystem::GetTrackedEntityCount() const
+	{
+		return m_trackedEntities.size();
+	}
+
+	/*!
+	* \brief Sets the update interval of entities at the edge of an observer radius
+	*
+	* The update interval of an entity grows linearly with its distance to the observer, from 1 tick to this interval, and is divided by the entity priority.
+	*
+	* \param maxUpdateInterval Maximum interval in ticks, 1 to update every relevant entity on every tick (defaults to 8)
+	*/
+	inline void InterestSystem::SetMaxUpdateInterval(UInt32 maxUpdateInterval)
+	{
+		NazaraAssert(maxUpdateInterval > 0, "update interval must be at least one tick");
+		m_maxUpdateInterval = maxUpdateInterval;
+	}
+
+	inline Int64 InterestSystem::GetCellCoordinate(float value) const
+	{
+		return static_cast<Int64>(std::floor(value * m_invCellSize));
+	}
+
+	inline UInt64 InterestSystem::GetCellKey(const Vector3f& position) const
+	{
+		return GetCellKey(GetCellCoordinate(position.x), GetCellCoordinate(position.y), GetCellCoordinate(position.z));
+	}
+
+	inline UInt64 InterestSystem::GetCellKey(Int64 x, Int64 y, Int64 z)
+	{
+		// 21 bits per axis, coordinates wrap around (which only means far away cells may share the same bucket)
+		constexpr UInt64 AxisMask = (1ull << 21) - 1;
+
+		return ((static_cast<UInt64>(x) & AxisMask) << 42) | ((static_cast<UInt64>(y) & AxisMask) << 21) | (static_cast<UInt64>(z) & AxisMask);
+	}
+}
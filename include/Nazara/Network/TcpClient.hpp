@@ -9,9 +9,13 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <deque>
+#include <memory>
+#include <span>
 #include <string>
 
 namespace Nz
@@ -20,31 +24,47 @@ namespace Nz
 
 	class NAZARA_NETWORK_API TcpClient : public AbstractSocket, public Stream
 	{
+		friend class SocketCompletionQueue;
 		friend class TcpServer;
 
 		public:
+			struct FramingConfig;
+
 			inline TcpClient();
 			TcpClient(TcpClient&& tcpClient) noexcept = default;
 			~TcpClient() = default;
 
 			SocketState Connect(const IpAddress& remoteAddress);
 			SocketState Connect(const std::string& hostName, NetProtocol protocol = NetProtocol::Any, const std::string& service = "http", ResolveError* error = nullptr);
+
+			ByteArray AcquireMessageBuffer(std::size_t size);
+
+			void DisableFraming();
 			inline void Disconnect();
 
+			void EnableFraming(const FramingConfig& config);
 			void EnableLowDelay(bool lowDelay);
 			void EnableKeepAlive(bool keepAlive, UInt64 msTime = 10000, UInt64 msInterval = 1000);
 
+			bool FlushMessages();
+
 			inline UInt64 GetKeepAliveInterval() const;
 			inline UInt64 GetKeepAliveTime() const;
+			inline std::size_t GetQueuedMessageSize() const;
 			inline IpAddress GetRemoteAddress() const;
 			UInt64 GetSize() const override;
 
+			inline bool IsFramingEnabled() const;
 			inline bool IsLowDelayEnabled() const;
 			inline bool IsKeepAliveEnabled() const;
 
 			SocketState PollForConnected(UInt64 waitDuration = 0);
 
+			bool QueueMessage(const void* data, std::size_t size);
+			bool QueueMessage(ByteArray&& message);
+
 			bool Receive(void* buffer, std::size_t size, std::size_t* received);
+			bool ReceiveMessage(std::span<const UInt8>* message);
 
 			bool Send(const void* buffer, std::size_t size, std::size_t* sent);
 			bool SendMultiple(const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
@@ -53,29 +73,50 @@ namespace Nz
 
 			inline TcpClient& operator=(TcpClient&& tcpClient) = default;
 
+			struct FramingConfig
+			{
+				std::shared_ptr<ByteArrayPool> bufferPool; //< can be shared by connections living on the same thread, a pool is created if null
+				std::size_t corkThreshold = 16 * 1024; //< queued bytes triggering a flush, 0 flushes every message
+				std::size_t maxMessageSize = 16 * 1024 * 1024;
+				std::size_t receiveBufferSize = 64 * 1024;
+				std::size_t sendChunkSize = 16 * 1024;
+				MessageLengthPrefix lengthPrefix = MessageLengthPrefix::VarInt;
+			};
+
 		private:
+			bool AppendToSendQueue(const void* data, std::size_t size);
 			void FlushStream() override;
 
 			void OnClose() override;
 			void OnOpened() override;
 
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			void ReserveReceiveSpace(std::size_t frameSize);
 			void Reset(SocketHandle handle, const IpAddress& peerAddress);
 			bool SeekStreamCursor(UInt64 offset) override;
 			UInt64 TellStreamCursor() const override;
 			bool TestStreamEnd() const override;
 			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
 
-			struct PendingPacket
+			struct SendSegment
 			{
-				std::size_t received = 0;
 				ByteArray data;
-				UInt16 netcode;
-				bool headerReceived = false;
+				std::size_t offset = 0;
+				bool isChunk;
+			};
+
+			struct MessageFraming
+			{
+				std::deque<SendSegment> sendQueue;
+				std::size_t queuedSize = 0;
+				std::size_t receiveBegin = 0;
+				std::size_t receiveEnd = 0;
+				ByteArray receiveBuffer; //< messages are handed out as views of this buffer
+				FramingConfig config;
 			};
 
+			std::unique_ptr<MessageFraming> m_framing;
 			IpAddress m_peerAddress;
-			PendingPacket m_pendingPacket;
 			UInt64 m_keepAliveInterval;
 			UInt64 m_keepAliveTime;
 			bool m_isKeepAliveEnabled;
@@ -50,6 +50,16 @@ namespace Nz
 		return m_keepAliveTime;
 	}
 
+	/*!
+	* \brief Gets the size of the framed messages waiting to be sent (length prefixes included)
+	* \return Number of bytes queued by QueueMessage and not sent yet
+	*/
+
+	inline std::size_t TcpClient::GetQueuedMessageSize() const
+	{
+		return (m_framing) ? m_framing->queuedSize : 0;
+	}
+
 	/*!
 	* \brief Gets the remote address
 	* \return Address of peer
@@ -60,6 +70,16 @@ namespace Nz
 		return m_peerAddress;
 	}
 
+	/*!
+	* \brief Checks whether the framed message mode is enabled
+	* \return true If it is the case
+	*/
+
+	inline bool TcpClient::IsFramingEnabled() const
+	{
+		return m_framing != nullptr;
+	}
+
 	/*!
 	* \brief Checks whether low delay is enabled
 	* \return true If it is the case
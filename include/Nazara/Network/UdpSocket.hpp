@@ -29,11 +29,13 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			bool EnableReusePort(bool reusePort);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 
 			inline bool IsBroadcastingEnabled() const;
+			inline bool IsReusePortEnabled() const;
 
 			std::size_t QueryMaxDatagramSize();
 
@@ -52,6 +54,7 @@ namespace Nz
 
 			IpAddress m_boundAddress;
 			bool m_isBroadCastingEnabled;
+			bool m_isReusePortEnabled;
 	};
 }
 
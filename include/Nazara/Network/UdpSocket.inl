@@ -34,7 +34,9 @@ namespace Nz
 
 	inline UdpSocket::UdpSocket(UdpSocket&& udpSocket) noexcept :
 	AbstractSocket(std::move(udpSocket)),
-	m_boundAddress(std::move(udpSocket.m_boundAddress))
+	m_boundAddress(std::move(udpSocket.m_boundAddress)),
+	m_isBroadCastingEnabled(udpSocket.m_isBroadCastingEnabled),
+	m_isReusePortEnabled(udpSocket.m_isReusePortEnabled)
 	{
 	}
 
@@ -111,5 +113,15 @@ namespace Nz
 	{
 		return m_isBroadCastingEnabled;
 	}
+
+	/*!
+	* \brief Checks whether the port can be shared with other sockets
+	* \return true If it is the case
+	*/
+
+	inline bool UdpSocket::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
 }
 
@@ -7,8 +7,12 @@
 #ifndef NAZARA_NETWORK_WEBSERVICE_HPP
 #define NAZARA_NETWORK_WEBSERVICE_HPP
 
+#include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/WebRequest.hpp>
+#ifndef NAZARA_PLATFORM_WEB
+#include <Nazara/Network/SocketPoller.hpp>
+#endif
 #include <NazaraUtils/FunctionRef.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
 #include <unordered_map>
@@ -30,9 +34,9 @@ namespace Nz
 
 		public:
 #ifndef NAZARA_PLATFORM_WEB
-			WebService(const CurlLibrary& library);
+			WebService(const CurlLibrary& library, WebServicePollMode pollMode = WebServicePollMode::Perform);
 #else
-			WebService();
+			WebService(WebServicePollMode pollMode = WebServicePollMode::Perform);
 #endif
 			WebService(const WebService&) = delete;
 			WebService(WebService&&) = delete;
@@ -43,26 +47,38 @@ namespace Nz
 			inline std::unique_ptr<WebRequest> CreateGetRequest(const std::string& url, WebRequest::ResultCallback callback);
 			inline std::unique_ptr<WebRequest> CreatePostRequest(const std::string& url, WebRequest::ResultCallback callback);
 
+			inline WebServicePollMode GetPollMode() const;
 			inline const std::string& GetUserAgent() const;
 
-			bool Poll();
+			bool Poll(int msTimeout = 0);
 
 			void QueueRequest(const FunctionRef<bool(WebRequest& request)>& builder);
 			void QueueRequest(std::unique_ptr<WebRequest>&& request);
 
+			void SetMaxConnections(std::size_t maxConnections);
+			void SetMaxHostConnections(std::size_t maxConnections);
+
 			WebService& operator=(const WebService&) = delete;
 			WebService& operator=(WebService&&) = delete;
 
 		private:
 #ifndef NAZARA_PLATFORM_WEB
+			CURL* AcquireEasyHandle();
 			inline const CurlLibrary& GetCurlLibrary() const;
+			bool ProcessFinishedTransfers();
+			void ReleaseEasyHandle(CURL* handle);
 #endif
 
 			std::string m_userAgent;
 #ifndef NAZARA_PLATFORM_WEB
 			std::unordered_map<CURL*, std::unique_ptr<WebRequest>> m_activeRequests;
+			std::vector<CURL*> m_idleHandles;
+			std::vector<SocketPoller::ReadyEvent> m_readyEvents;
 			const CurlLibrary& m_curl;
 			MovablePtr<CURLM> m_curlMulti;
+			SocketPoller m_poller;
+			Time m_timerDeadline;
+			bool m_isTimerActive;
 #else
 			struct FinishedRequest
 			{
@@ -73,6 +89,7 @@ namespace Nz
 			std::unordered_map<emscripten_fetch_t*, std::unique_ptr<WebRequest>> m_activeRequests;
 			std::vector<FinishedRequest> m_finishedRequests;
 #endif
+			WebServicePollMode m_pollMode;
 	};
 }
 
@@ -30,6 +30,11 @@ namespace Nz
 		return request;
 	}
 
+	inline WebServicePollMode WebService::GetPollMode() const
+	{
+		return m_pollMode;
+	}
+
 	inline const std::string& WebService::GetUserAgent() const
 	{
 		return m_userAgent;
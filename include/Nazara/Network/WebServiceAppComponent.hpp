@@ -9,6 +9,7 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/ApplicationComponent.hpp>
+#include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/WebRequest.hpp>
 #include <NazaraUtils/FunctionRef.hpp>
@@ -20,7 +21,7 @@ namespace Nz
 	class NAZARA_NETWORK_API WebServiceAppComponent final : public ApplicationComponent
 	{
 		public:
-			WebServiceAppComponent(ApplicationBase& app);
+			WebServiceAppComponent(ApplicationBase& app, WebServicePollMode pollMode = WebServicePollMode::Perform);
 			WebServiceAppComponent(const WebServiceAppComponent&) = delete;
 			WebServiceAppComponent(WebServiceAppComponent&&) = delete;
 			~WebServiceAppComponent() = default;
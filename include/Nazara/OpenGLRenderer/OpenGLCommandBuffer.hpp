@@ -55,6 +55,7 @@ namespace Nz
 			inline void CopyBuffer(GLuint source, GLuint target, UInt64 size, UInt64 sourceOffset = 0, UInt64 targetOffset = 0);
 			inline void CopyBuffer(const UploadPool::Allocation& allocation, GLuint target, UInt64 size, UInt64 sourceOffset = 0, UInt64 targetOffset = 0);
 			inline void CopyTexture(const OpenGLTexture& source, const Boxui& sourceBox, const OpenGLTexture& target, const Vector3ui& targetPoint);
+			inline void CopyTexture(const UploadPool::Allocation& allocation, const OpenGLTexture& target, const Boxui& targetBox, UInt8 targetLevel);
 
 			inline void Dispatch(UInt32 numGroupsX, UInt32 numGroupsY, UInt32 numGroupsZ);
 
@@ -94,6 +95,7 @@ namespace Nz
 	cb(CopyBufferCommand) \
 	cb(CopyBufferFromMemoryCommand) \
 	cb(CopyTextureCommand) \
+	cb(CopyTextureFromMemoryCommand) \
 	cb(DispatchCommand) \
 	cb(DrawCommand) \
 	cb(DrawIndexedCommand) \
@@ -126,6 +128,7 @@ namespace Nz
 			inline void Execute(const GL::Context* context, const CopyBufferCommand& command);
 			inline void Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command);
 			inline void Execute(const GL::Context* context, const CopyTextureCommand& command);
+			inline void Execute(const GL::Context* context, const CopyTextureFromMemoryCommand& command);
 			inline void Execute(const GL::Context* context, const DispatchCommand& command);
 			inline void Execute(const GL::Context* context, const DrawCommand& command);
 			inline void Execute(const GL::Context* context, const DrawIndexedCommand& command);
@@ -196,6 +199,14 @@ namespace Nz
 				UInt64 targetOffset;
 			};
 
+			struct CopyTextureFromMemoryCommand
+			{
+				const void* memory;
+				const OpenGLTexture* target;
+				Boxui targetBox;
+				UInt8 targetLevel;
+			};
+
 			struct ShaderBindings
 			{
 				std::vector<std::pair<const OpenGLRenderPipelineLayout*, const OpenGLShaderBinding*>> shaderBindings;
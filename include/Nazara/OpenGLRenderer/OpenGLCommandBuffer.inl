@@ -147,6 +147,18 @@ namespace Nz
 		m_commands.emplace_back(std::move(copyTexture));
 	}
 
+	inline void OpenGLCommandBuffer::CopyTexture(const UploadPool::Allocation& allocation, const OpenGLTexture& target, const Boxui& targetBox, UInt8 targetLevel)
+	{
+		CopyTextureFromMemoryCommand copyTexture = {
+			allocation.mappedPtr,
+			&target,
+			targetBox,
+			targetLevel
+		};
+
+		m_commands.emplace_back(std::move(copyTexture));
+	}
+
 	inline void OpenGLCommandBuffer::Dispatch(UInt32 numGroupsX, UInt32 numGroupsY, UInt32 numGroupsZ)
 	{
 		if (!m_currentComputeStates.pipeline)
@@ -53,6 +53,8 @@ namespace Nz
 			static inline GL::TextureTarget ToTextureTarget(ImageType imageType);
 
 		private:
+			bool UpdateCompressed(const GL::Context& context, GLenum internalFormat, const void* ptr, const Boxui& box, UInt8 level);
+
 			std::optional<TextureViewInfo> m_viewInfo;
 			std::shared_ptr<OpenGLTexture> m_parentTexture;
 			GL::Texture m_texture;
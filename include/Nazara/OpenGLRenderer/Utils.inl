@@ -19,6 +19,11 @@ namespace Nz
 		switch (pixelFormat)
 		{
 			case PixelFormat::A8:               return GLTextureFormat{ GL_R8,                 GL_RED,             GL_UNSIGNED_BYTE,                  GL_ONE,   GL_ONE,   GL_ONE,  GL_RED };
+			case PixelFormat::BC4:              return GLTextureFormat{ GL_COMPRESSED_RED_RGTC1_EXT,                GL_RED,  GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+			case PixelFormat::BC5:              return GLTextureFormat{ GL_COMPRESSED_RED_GREEN_RGTC2_EXT,          GL_RG,   GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+			case PixelFormat::BC6H:             return GLTextureFormat{ GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_EXT,  GL_RGB,  GL_HALF_FLOAT,    GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+			case PixelFormat::BC7:              return GLTextureFormat{ GL_COMPRESSED_RGBA_BPTC_UNORM_EXT,          GL_RGBA, GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+			case PixelFormat::BC7_SRGB:         return GLTextureFormat{ GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_EXT,    GL_RGBA, GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
 			case PixelFormat::BGR8:             return GLTextureFormat{ GL_RGB8,               GL_RGB,             GL_UNSIGNED_BYTE,                  GL_BLUE,  GL_GREEN, GL_RED,  GL_ALPHA };
 			case PixelFormat::BGR8_SRGB:        return GLTextureFormat{ GL_SRGB8,              GL_RGB,             GL_UNSIGNED_BYTE,                  GL_BLUE,  GL_GREEN, GL_RED,  GL_ALPHA };
 			case PixelFormat::BGRA8:            return GLTextureFormat{ GL_SRGB8_ALPHA8,       GL_RGBA,            GL_UNSIGNED_BYTE,                  GL_BLUE,  GL_GREEN, GL_RED,  GL_ALPHA };
@@ -28,6 +33,9 @@ namespace Nz
 			case PixelFormat::Depth24Stencil8:  return GLTextureFormat{ GL_DEPTH24_STENCIL8,   GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8,              GL_RED,   GL_GREEN, GL_ZERO, GL_ZERO };
 			case PixelFormat::Depth32F:         return GLTextureFormat{ GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT,                          GL_RED,   GL_ZERO,  GL_ZERO, GL_ZERO };
 			case PixelFormat::Depth32FStencil8: return GLTextureFormat{ GL_DEPTH32F_STENCIL8,  GL_DEPTH_STENCIL,   GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_RED,   GL_GREEN, GL_ZERO, GL_ZERO };
+			case PixelFormat::DXT1:             return GLTextureFormat{ GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,           GL_RGBA, GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+			case PixelFormat::DXT3:             return GLTextureFormat{ GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,           GL_RGBA, GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+			case PixelFormat::DXT5:             return GLTextureFormat{ GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,           GL_RGBA, GL_UNSIGNED_BYTE, GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
 			case PixelFormat::L8:               return GLTextureFormat{ GL_R8,                 GL_RED,             GL_UNSIGNED_BYTE,                  GL_RED,   GL_RED,   GL_RED,  GL_ONE };
 			case PixelFormat::LA8:              return GLTextureFormat{ GL_RG8,                GL_RG,              GL_UNSIGNED_BYTE,                  GL_RED,   GL_RED,   GL_RED,  GL_GREEN };
 			case PixelFormat::R8:               return GLTextureFormat{ GL_R8,                 GL_RED,             GL_UNSIGNED_BYTE,                  GL_RED,   GL_GREEN, GL_BLUE, GL_ALPHA };
@@ -65,6 +65,8 @@ namespace Nz::GL
 		ShaderImageLoadStore,
 		SpirV,
 		StorageBuffers,
+		TextureCompressionBptc,
+		TextureCompressionRgtc,
 		TextureCompressionS3tc,
 		TextureFilterAnisotropic,
 		TextureView,
@@ -63,6 +63,7 @@ namespace Nz
 			inline void CopyBuffer(const UploadPool::Allocation& allocation, const RenderBufferView& target);
 			virtual void CopyBuffer(const UploadPool::Allocation& allocation, const RenderBufferView& target, UInt64 size, UInt64 fromOffset = 0, UInt64 toOffset = 0) = 0;
 			virtual void CopyTexture(const Texture& fromTexture, const Boxui& fromBox, TextureLayout fromLayout, const Texture& toTexture, const Vector3ui& toPos, TextureLayout toLayout) = 0;
+			virtual void CopyTexture(const UploadPool::Allocation& allocation, const Texture& toTexture, const Boxui& toBox, UInt8 toLevel, TextureLayout toLayout) = 0;
 
 			virtual void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0) = 0;
 			virtual void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 firstInstance = 0) = 0;
@@ -50,6 +50,8 @@ namespace Nz
 				Vector2f corners[4];
 				AbstractImage* atlas;
 				bool flipped;
+				float distanceFieldEdge; //< atlas value of the glyph edge (moved outward for outlines)
+				float distanceFieldSmoothing; //< half width of the antialiasing ramp, in atlas values
 				int renderOrder;
 			};
 
@@ -19,6 +19,7 @@
 #include <Nazara/TextRenderer/Export.hpp>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -29,6 +30,7 @@ namespace Nz
 
 	class Font;
 	class FontData;
+	class TaskScheduler;
 
 	struct FontGlyph;
 
@@ -42,6 +44,7 @@ namespace Nz
 		friend class TextRenderer;
 
 		public:
+			struct DistanceFieldParams;
 			struct Glyph;
 			struct SizeInfo;
 			using Params = FontParams;
@@ -63,10 +66,15 @@ namespace Nz
 			const std::shared_ptr<AbstractAtlas>& GetAtlas() const;
 			std::size_t GetCachedGlyphCount(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
 			std::size_t GetCachedGlyphCount() const;
+			float GetDistanceFieldEdge(unsigned int characterSize, float outlineThickness) const;
+			const DistanceFieldParams& GetDistanceFieldParams() const;
+			float GetDistanceFieldSmoothing(unsigned int characterSize) const;
 			std::string GetFamilyName() const;
 			int GetKerning(unsigned int characterSize, char32_t first, char32_t second) const;
 			const Glyph& GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
 			unsigned int GetGlyphBorder() const;
+			FontGlyphMode GetGlyphMode() const;
+			float GetGlyphScale(unsigned int characterSize) const;
 			unsigned int GetMinimumStepSize() const;
 			const SizeInfo& GetSizeInfo(unsigned int characterSize) const;
 			std::string GetStyleName() const;
@@ -74,10 +82,12 @@ namespace Nz
 			bool IsValid() const;
 
 			bool Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
-			bool Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet) const;
+			bool Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet, TaskScheduler* taskScheduler = nullptr) const;
 
 			void SetAtlas(std::shared_ptr<AbstractAtlas> atlas);
+			void SetDistanceFieldParams(const DistanceFieldParams& params);
 			void SetGlyphBorder(unsigned int borderSize);
+			void SetGlyphMode(FontGlyphMode glyphMode);
 			void SetMinimumStepSize(unsigned int minimumStepSize);
 
 			Font& operator=(const Font&) = delete;
@@ -96,6 +106,12 @@ namespace Nz
 			static void SetDefaultGlyphBorder(unsigned int borderSize);
 			static void SetDefaultMinimumStepSize(unsigned int minimumStepSize);
 
+			struct DistanceFieldParams
+			{
+				unsigned int glyphSize = 48; //< character size distance field glyphs are generated at
+				unsigned int spread = 6;     //< maximal distance (in pixels at glyphSize) encoded around the glyph edge
+			};
+
 			struct Glyph
 			{
 				std::size_t layerIndex;
@@ -130,8 +146,13 @@ namespace Nz
 			using GlyphMap = std::unordered_map<char32_t, Glyph>;
 
 			UInt64 ComputeKey(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
+			bool ExtractCachedGlyph(FontData& fontData, unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* glyph) const;
+			bool ExtractDistanceFieldGlyph(FontData& fontData, char32_t character, TextStyleFlags style, FontGlyph* glyph) const;
+			void GetCachedGlyphParameters(unsigned int& characterSize, float& outlineThickness) const;
+			void GetSupportedGlyphParameters(TextStyleFlags& style, float& outlineThickness) const;
 			void OnAtlasCleared(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
+			void OnAtlasRectsRelocated(const AbstractAtlas* atlas, std::size_t layerIndex, AbstractImage* layer, SparsePtr<const Rectui> oldRects, SparsePtr<const Rectui> newRects, std::size_t count);
 			const Glyph& PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
 
 			static bool Initialize();
@@ -139,12 +160,16 @@ namespace Nz
 
 			NazaraSlot(AbstractAtlas, OnAtlasCleared, m_atlasClearedSlot);
 			NazaraSlot(AbstractAtlas, OnAtlasLayerChange, m_atlasLayerChangeSlot);
+			NazaraSlot(AbstractAtlas, OnAtlasRectsRelocated, m_atlasRectsRelocatedSlot);
 
 			std::shared_ptr<AbstractAtlas> m_atlas;
 			std::unique_ptr<FontData> m_data;
 			mutable std::unordered_map<UInt64, std::unordered_map<UInt64, int>> m_kerningCache;
 			mutable std::unordered_map<UInt64, GlyphMap> m_glyphes;
 			mutable std::unordered_map<UInt64, SizeInfo> m_sizeInfoCache;
+			mutable std::vector<std::unique_ptr<FontData>> m_workerData;
+			DistanceFieldParams m_distanceFieldParams;
+			FontGlyphMode m_glyphMode;
 			unsigned int m_glyphBorder;
 			unsigned int m_minimumStepSize;
 			bool m_fontHasKerning;
@@ -10,6 +10,7 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/TextRenderer/Export.hpp>
+#include <memory>
 #include <string>
 
 namespace Nz
@@ -22,6 +23,8 @@ namespace Nz
 			FontData() = default;
 			virtual ~FontData();
 
+			virtual std::unique_ptr<FontData> Clone() const;
+
 			virtual bool ExtractGlyph(unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* dst) = 0;
 
 			virtual std::string GetFamilyName() const = 0;
@@ -11,7 +11,9 @@
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/TextRenderer/AbstractTextDrawer.hpp>
 #include <Nazara/TextRenderer/Font.hpp>
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Nz
@@ -104,11 +106,12 @@ namespace Nz
 			inline void ConnectFontSlots();
 			inline void DisconnectFontSlots();
 			bool GenerateGlyph(Glyph& glyph, char32_t character, float outlineThickness, bool lineWrap, const Font& font, const Color& color, TextStyleFlags style, float lineSpacingOffset, unsigned int characterSize, int renderOrder, int* advance) const;
-			void GenerateGlyphs(const Font& font, const Color& color, TextStyleFlags style, unsigned int characterSize, const Color& outlineColor, float characterSpacingOffset, float lineSpacingOffset, float outlineThickness, std::string_view text) const;
+			void GenerateGlyphs(std::size_t blockIndex, std::size_t textOffset, char32_t previousCharacter) const;
 			inline float GetLineHeight(const Block& block) const;
 			inline float GetLineHeight(float lineSpacingOffset, const Font::SizeInfo& sizeInfo) const;
 			inline std::size_t HandleFontAddition(const std::shared_ptr<Font>& font);
 			inline void InvalidateGlyphs();
+			inline void InvalidateGlyphs(std::size_t blockIndex, std::size_t textOffset = 0);
 			inline void ReleaseFont(std::size_t fontIndex);
 			inline bool ShouldLineWrap(float size) const;
 
@@ -134,6 +137,18 @@ namespace Nz
 				unsigned int characterSize;
 			};
 
+			// Layout state right after a line feed, the layout of the text before it doesn't depend on what follows
+			struct LineBreak
+			{
+				Rectf bounds;
+				Rectf lineBounds;
+				std::size_t blockIndex;
+				std::size_t glyphCount;
+				std::size_t lineCount;
+				std::size_t textOffset;
+				float drawPosY;
+			};
+
 			struct FontData
 			{
 				std::shared_ptr<Font> font;
@@ -149,12 +164,15 @@ namespace Nz
 			Color m_currentOutlineColor;
 			TextStyleFlags m_currentStyle;
 			std::shared_ptr<Font> m_currentFont;
+			std::size_t m_invalidBlockIndex;
+			std::size_t m_invalidTextOffset;
 			mutable std::size_t m_lastSeparatorGlyph;
 			std::unordered_map<std::shared_ptr<Font>, std::size_t> m_fontIndexes;
 			std::vector<Block> m_blocks;
 			std::vector<FontData> m_fonts;
 			mutable std::vector<Glyph> m_glyphs;
 			mutable std::vector<Line> m_lines;
+			mutable std::vector<LineBreak> m_lineBreaks;
 			mutable Rectf m_bounds;
 			mutable Vector2f m_drawPos;
 			mutable bool m_glyphUpdated;
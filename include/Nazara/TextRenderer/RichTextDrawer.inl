@@ -140,6 +140,7 @@ namespace Nz
 	{
 		m_bounds = Rectf::Zero(); //< Compute bounds as float to speedup bounds computation (as casting between floats and integers is costly)
 		m_lastSeparatorGlyph = InvalidGlyph;
+		m_lineBreaks.clear();
 		m_lines.clear();
 		m_glyphs.clear();
 		m_glyphUpdated = true;
@@ -264,7 +265,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].characterSize = characterSize;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockCharacterSpacingOffset(std::size_t index, float offset)
@@ -272,7 +273,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].characterSpacingOffset = offset;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockColor(std::size_t index, const Color& color)
@@ -280,7 +281,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].color = color;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockFont(std::size_t index, std::shared_ptr<Font> font)
@@ -297,7 +298,7 @@ namespace Nz
 			m_blocks[index].fontIndex = fontIndex;
 		}
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockLineSpacingOffset(std::size_t index, float offset)
@@ -305,7 +306,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].lineSpacingOffset = offset;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockOutlineColor(std::size_t index, const Color& color)
@@ -313,7 +314,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].outlineColor = color;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockOutlineThickness(std::size_t index, float thickness)
@@ -321,7 +322,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].outlineThickness = thickness;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockStyle(std::size_t index, TextStyleFlags style)
@@ -329,7 +330,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].style = style;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockText(std::size_t index, std::string str)
@@ -338,6 +339,11 @@ namespace Nz
 
 		std::size_t previousLength = m_blocks[index].text.size(); //< FIXME: Count Unicode glyphs
 
+		// Only the text following the first modified character has to be laid out again
+		const std::string& previousText = m_blocks[index].text;
+		auto [textIt, strIt] = std::mismatch(previousText.begin(), previousText.end(), str.begin(), str.end());
+		InvalidateGlyphs(index, std::distance(previousText.begin(), textIt));
+
 		m_blocks[index].text = std::move(str);
 
 		std::size_t newLength = m_blocks[index].text.size(); //< FIXME: Count Unicode glyphs
@@ -347,8 +353,6 @@ namespace Nz
 			for (std::size_t i = index + 1; i < m_blocks.size(); ++i)
 				m_blocks[i].glyphIndex += delta;
 		}
-
-		InvalidateGlyphs();
 	}
 
 	inline void RichTextDrawer::SetCharacterSize(unsigned int characterSize)
@@ -393,6 +397,18 @@ namespace Nz
 
 	inline void RichTextDrawer::InvalidateGlyphs()
 	{
+		InvalidateGlyphs(0, 0);
+	}
+
+	inline void RichTextDrawer::InvalidateGlyphs(std::size_t blockIndex, std::size_t textOffset)
+	{
+		// Keep the lowest position if the glyphs were already invalidated
+		if (m_glyphUpdated || std::make_pair(blockIndex, textOffset) < std::make_pair(m_invalidBlockIndex, m_invalidTextOffset))
+		{
+			m_invalidBlockIndex = blockIndex;
+			m_invalidTextOffset = textOffset;
+		}
+
 		m_glyphUpdated = false;
 	}
 
@@ -11,6 +11,7 @@
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/TextRenderer/AbstractTextDrawer.hpp>
 #include <Nazara/TextRenderer/Font.hpp>
+#include <algorithm>
 #include <vector>
 
 namespace Nz
@@ -76,12 +77,13 @@ namespace Nz
 			inline void DisconnectFontSlots();
 
 			bool GenerateGlyph(Glyph& glyph, char32_t character, float outlineThickness, bool lineWrap, Color color, int renderOrder, int* advance) const;
-			void GenerateGlyphs(std::string_view text) const;
+			void GenerateGlyphs(std::size_t textOffset) const;
 
 			inline float GetLineHeight(const Font::SizeInfo& sizeInfo) const;
 
 			inline void InvalidateColor();
 			inline void InvalidateGlyphs();
+			inline void InvalidateGlyphs(std::size_t textOffset);
 
 			void OnFontAtlasLayerChanged(const Font* font, AbstractImage* oldLayer, AbstractImage* newLayer);
 			void OnFontInvalidated(const Font* font);
@@ -90,10 +92,21 @@ namespace Nz
 			inline bool ShouldLineWrap(float size) const;
 
 			inline void UpdateGlyphColor() const;
-			inline void UpdateGlyphs() const;
+			void UpdateGlyphs() const;
 
 			static constexpr std::size_t InvalidGlyph = std::numeric_limits<std::size_t>::max();
 
+			// Layout state right after a line feed, the layout of the text before it doesn't depend on what follows
+			struct LineBreak
+			{
+				Rectf bounds;
+				Rectf lineBounds;
+				std::size_t glyphCount;
+				std::size_t lineCount;
+				std::size_t textOffset;
+				float drawPosY;
+			};
+
 			NazaraSlot(Font, OnFontAtlasChanged, m_atlasChangedSlot);
 			NazaraSlot(Font, OnFontAtlasLayerChanged, m_atlasLayerChangedSlot);
 			NazaraSlot(Font, OnFontGlyphCacheCleared, m_glyphCacheClearedSlot);
@@ -102,6 +115,8 @@ namespace Nz
 			mutable std::size_t m_lastSeparatorGlyph;
 			mutable std::vector<Glyph> m_glyphs;
 			mutable std::vector<Line> m_lines;
+			mutable std::vector<LineBreak> m_lineBreaks;
+			std::size_t m_invalidTextOffset;
 			std::string m_text;
 			Color m_color;
 			Color m_outlineColor;
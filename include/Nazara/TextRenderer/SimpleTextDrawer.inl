@@ -6,6 +6,7 @@
 namespace Nz
 {
 	inline SimpleTextDrawer::SimpleTextDrawer() :
+	m_invalidTextOffset(0),
 	m_color(Color::White()),
 	m_outlineColor(Color::Black()),
 	m_style(TextStyle_Regular),
@@ -21,6 +22,7 @@ namespace Nz
 	}
 
 	inline SimpleTextDrawer::SimpleTextDrawer(const SimpleTextDrawer& drawer) :
+	m_invalidTextOffset(0),
 	m_text(drawer.m_text),
 	m_color(drawer.m_color),
 	m_outlineColor(drawer.m_outlineColor),
@@ -43,9 +45,12 @@ namespace Nz
 
 	inline void SimpleTextDrawer::AppendText(std::string_view str)
 	{
+		std::size_t textOffset = m_text.size();
 		m_text.append(str);
+
+		// Appending doesn't change the layout of the existing text
 		if (m_glyphUpdated)
-			GenerateGlyphs(str);
+			GenerateGlyphs(textOffset);
 	}
 
 	inline float SimpleTextDrawer::GetCharacterSpacingOffset() const
@@ -143,11 +148,13 @@ namespace Nz
 
 	inline void SimpleTextDrawer::SetText(std::string str)
 	{
-		if (m_text != str)
+		auto [textIt, strIt] = std::mismatch(m_text.begin(), m_text.end(), str.begin(), str.end());
+		if (textIt != m_text.end() || strIt != str.end())
 		{
-			m_text = std::move(str);
+			// Only the text following the first modified character has to be laid out again
+			InvalidateGlyphs(std::distance(m_text.begin(), textIt));
 
-			InvalidateGlyphs();
+			m_text = std::move(str);
 		}
 	}
 
@@ -235,13 +242,20 @@ namespace Nz
 		m_characterSize = std::move(drawer.m_characterSize);
 		m_characterSpacingOffset = drawer.m_characterSpacingOffset;
 		m_color = std::move(drawer.m_color);
+		m_drawPos = drawer.m_drawPos;
 		m_glyphs = std::move(drawer.m_glyphs);
 		m_glyphUpdated = std::move(drawer.m_glyphUpdated);
 		m_font = std::move(drawer.m_font);
+		m_invalidTextOffset = drawer.m_invalidTextOffset;
+		m_lastSeparatorGlyph = drawer.m_lastSeparatorGlyph;
+		m_lastSeparatorPosition = drawer.m_lastSeparatorPosition;
+		m_lineBreaks = std::move(drawer.m_lineBreaks);
+		m_lines = std::move(drawer.m_lines);
 		m_lineSpacingOffset = drawer.m_lineSpacingOffset;
 		m_maxLineWidth = drawer.m_maxLineWidth;
 		m_outlineColor = std::move(drawer.m_outlineColor);
 		m_outlineThickness = std::move(drawer.m_outlineThickness);
+		m_previousCharacter = drawer.m_previousCharacter;
 		m_style = std::move(drawer.m_style);
 		m_text = std::move(drawer.m_text);
 
@@ -338,6 +352,15 @@ namespace Nz
 
 	inline void SimpleTextDrawer::InvalidateGlyphs()
 	{
+		InvalidateGlyphs(0);
+	}
+
+	inline void SimpleTextDrawer::InvalidateGlyphs(std::size_t textOffset)
+	{
+		// Keep the lowest offset if the glyphs were already invalidated
+		if (m_glyphUpdated || textOffset < m_invalidTextOffset)
+			m_invalidTextOffset = textOffset;
+
 		m_glyphUpdated = false;
 	}
 
@@ -370,13 +393,5 @@ namespace Nz
 
 		m_colorUpdated = true;
 	}
-
-	inline void SimpleTextDrawer::UpdateGlyphs() const
-	{
-		NazaraAssert(m_font && m_font->IsValid(), "Invalid font");
-
-		ClearGlyphs();
-		GenerateGlyphs(m_text);
-	}
 }
 
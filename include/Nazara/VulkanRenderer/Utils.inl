@@ -13,6 +13,14 @@ namespace Nz
 		switch (format)
 		{
 			case VK_FORMAT_B8G8R8A8_UNORM:     return PixelFormat::BGRA8;
+			case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: return PixelFormat::DXT1;
+			case VK_FORMAT_BC2_UNORM_BLOCK:    return PixelFormat::DXT3;
+			case VK_FORMAT_BC3_UNORM_BLOCK:    return PixelFormat::DXT5;
+			case VK_FORMAT_BC4_UNORM_BLOCK:    return PixelFormat::BC4;
+			case VK_FORMAT_BC5_UNORM_BLOCK:    return PixelFormat::BC5;
+			case VK_FORMAT_BC6H_UFLOAT_BLOCK:  return PixelFormat::BC6H;
+			case VK_FORMAT_BC7_UNORM_BLOCK:    return PixelFormat::BC7;
+			case VK_FORMAT_BC7_SRGB_BLOCK:     return PixelFormat::BC7_SRGB;
 			case VK_FORMAT_B8G8R8A8_SRGB:      return PixelFormat::BGRA8_SRGB;
 			case VK_FORMAT_D16_UNORM:          return PixelFormat::Depth16;
 			case VK_FORMAT_D16_UNORM_S8_UINT:  return PixelFormat::Depth16Stencil8;
@@ -137,10 +145,13 @@ namespace Nz
 			case ComponentType::Float2:     return VK_FORMAT_R32G32_SFLOAT;
 			case ComponentType::Float3:     return VK_FORMAT_R32G32B32_SFLOAT;
 			case ComponentType::Float4:     return VK_FORMAT_R32G32B32A32_SFLOAT;
+			case ComponentType::Half2:      return VK_FORMAT_R16G16_SFLOAT;
 			case ComponentType::Int1:       return VK_FORMAT_R32_SINT;
 			case ComponentType::Int2:       return VK_FORMAT_R32G32_SINT;
 			case ComponentType::Int3:       return VK_FORMAT_R32G32B32_SINT;
 			case ComponentType::Int4:       return VK_FORMAT_R32G32B32A32_SINT;
+			case ComponentType::Short2Norm: return VK_FORMAT_R16G16_SNORM;
+			case ComponentType::Short4Norm: return VK_FORMAT_R16G16B16A16_SNORM;
 		}
 
 		NazaraErrorFmt("unhandled ComponentType {0:#x})", UnderlyingCast(componentType));
@@ -273,6 +284,11 @@ namespace Nz
 		switch (pixelFormat)
 		{
 			// TODO: Fill this switch
+			case PixelFormat::BC4:              return VK_FORMAT_BC4_UNORM_BLOCK;
+			case PixelFormat::BC5:              return VK_FORMAT_BC5_UNORM_BLOCK;
+			case PixelFormat::BC6H:             return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+			case PixelFormat::BC7:              return VK_FORMAT_BC7_UNORM_BLOCK;
+			case PixelFormat::BC7_SRGB:         return VK_FORMAT_BC7_SRGB_BLOCK;
 			case PixelFormat::BGR8:             return VK_FORMAT_B8G8R8_UNORM;
 			case PixelFormat::BGR8_SRGB:        return VK_FORMAT_B8G8R8_SRGB;
 			case PixelFormat::BGRA8:            return VK_FORMAT_B8G8R8A8_UNORM;
@@ -283,6 +299,9 @@ namespace Nz
 			case PixelFormat::Depth24Stencil8:  return VK_FORMAT_D24_UNORM_S8_UINT;
 			case PixelFormat::Depth32F:         return VK_FORMAT_D32_SFLOAT;
 			case PixelFormat::Depth32FStencil8: return VK_FORMAT_D32_SFLOAT_S8_UINT;
+			case PixelFormat::DXT1:             return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+			case PixelFormat::DXT3:             return VK_FORMAT_BC2_UNORM_BLOCK;
+			case PixelFormat::DXT5:             return VK_FORMAT_BC3_UNORM_BLOCK;
 			case PixelFormat::R8:               return VK_FORMAT_R8_UNORM;
 			case PixelFormat::RG8:              return VK_FORMAT_R8G8_UNORM;
 			case PixelFormat::RGB8:             return VK_FORMAT_R8G8B8_UNORM;
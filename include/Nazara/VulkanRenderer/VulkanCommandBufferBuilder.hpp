@@ -44,6 +44,7 @@ namespace Nz
 			void CopyBuffer(const RenderBufferView& source, const RenderBufferView& target, UInt64 size, UInt64 sourceOffset = 0, UInt64 targetOffset = 0) override;
 			void CopyBuffer(const UploadPool::Allocation& allocation, const RenderBufferView& target, UInt64 size, UInt64 sourceOffset = 0, UInt64 targetOffset = 0) override;
 			void CopyTexture(const Texture& fromTexture, const Boxui& fromBox, TextureLayout fromLayout, const Texture& toTexture, const Vector3ui& toPos, TextureLayout toLayout) override;
+			void CopyTexture(const UploadPool::Allocation& allocation, const Texture& toTexture, const Boxui& toBox, UInt8 toLevel, TextureLayout toLayout) override;
 
 			void Dispatch(UInt32 workgroupX, UInt32 workgroupY, UInt32 workgroupZ) override;
 
@@ -50,6 +50,7 @@
 #include <Nazara/Widgets/SimpleLabelWidget.hpp>
 #include <Nazara/Widgets/SimpleWidgetStyles.hpp>
 #include <Nazara/Widgets/TextAreaWidget.hpp>
+#include <Nazara/Widgets/VirtualListWidget.hpp>
 #include <Nazara/Widgets/Widgets.hpp>
 #include <Nazara/Widgets/WidgetTheme.hpp>
 
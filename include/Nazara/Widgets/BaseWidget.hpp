@@ -122,9 +122,11 @@ namespace Nz
 			void DestroyEntity(entt::entity entity);
 
 			inline int GetBaseRenderLayer() const;
+			inline const BaseWidget* GetParentWidget() const;
 			inline entt::registry& GetRegistry();
 			inline const entt::registry& GetRegistry() const;
 
+			void InvalidateLayout();
 			void InvalidateNode(Invalidation invalidation) override;
 
 			Recti GetScissorBox() const;
@@ -185,6 +187,7 @@ namespace Nz
 
 			std::optional<entt::entity> m_backgroundEntity;
 			std::size_t m_canvasIndex;
+			std::size_t m_layoutQueueIndex;
 			std::shared_ptr<Sprite> m_backgroundSprite;
 			std::shared_ptr<WidgetTheme> m_theme;
 			std::vector<WidgetEntity> m_entities;
@@ -200,6 +203,7 @@ namespace Nz
 			Vector2f m_size;
 			BaseWidget* m_parentWidget;
 			bool m_disableVisibilitySignal;
+			bool m_isLayoutInvalidated;
 			bool m_visible;
 			int m_baseRenderLayer;
 			int m_renderLayerCount;
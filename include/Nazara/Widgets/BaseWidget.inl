@@ -9,6 +9,7 @@ namespace Nz
 {
 	inline BaseWidget::BaseWidget(std::shared_ptr<WidgetTheme> theme) :
 	m_canvasIndex(InvalidCanvasIndex),
+	m_layoutQueueIndex(InvalidCanvasIndex),
 	m_theme(std::move(theme)),
 	m_registry(nullptr),
 	m_canvas(nullptr),
@@ -21,6 +22,7 @@ namespace Nz
 	m_size(50.f, 50.f),
 	m_parentWidget(nullptr),
 	m_disableVisibilitySignal(false),
+	m_isLayoutInvalidated(false),
 	m_visible(true),
 	m_baseRenderLayer(0),
 	m_renderLayerCount(1)
@@ -298,6 +300,11 @@ namespace Nz
 		return m_baseRenderLayer + ((m_backgroundEntity.has_value()) ? 1 : 0);
 	}
 
+	inline const BaseWidget* BaseWidget::GetParentWidget() const
+	{
+		return m_parentWidget;
+	}
+
 	inline entt::registry& BaseWidget::GetRegistry()
 	{
 		assert(m_registry);
@@ -12,6 +12,9 @@
 #include <Nazara/Widgets/BaseWidget.hpp>
 #include <entt/entity/registry.hpp>
 #include <bitset>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Nz
 {
@@ -25,10 +28,16 @@ namespace Nz
 			Canvas(Canvas&&) = delete;
 			inline ~Canvas();
 
+			void EnableDeferredLayout(bool enable = true);
+
 			inline entt::registry& GetRegistry();
 			inline const entt::registry& GetRegistry() const;
 			inline UInt32 GetRenderMask() const;
 
+			inline bool IsDeferredLayoutEnabled() const;
+
+			void UpdateLayout();
+
 			Canvas& operator=(const Canvas&) = delete;
 			Canvas& operator=(Canvas&&) = delete;
 
@@ -40,16 +49,20 @@ namespace Nz
 			NazaraSignal(OnUnhandledKeyReleased, const WindowEventHandler* /*eventHandler*/, const WindowEvent::KeyEvent& /*event*/);
 
 		protected:
+			void CancelWidgetLayoutInvalidation(std::size_t index);
+
 			inline void ClearKeyboardOwner(std::size_t canvasIndex);
 			inline void ClearMouseOwner(std::size_t canvasIndex);
 
 			inline bool IsKeyboardOwner(std::size_t canvasIndex) const;
 			inline bool IsMouseOwner(std::size_t canvasIndex) const;
+			inline bool IsUpdatingLayout() const;
 
 			inline std::size_t GetMouseEventTarget() const;
 
 			inline void NotifyWidgetBoxUpdate(std::size_t index);
 			inline void NotifyWidgetCursorUpdate(std::size_t index);
+			inline std::size_t NotifyWidgetLayoutInvalidation(BaseWidget* widget);
 
 			std::size_t RegisterWidget(BaseWidget* widget);
 
@@ -73,13 +86,21 @@ namespace Nz
 			void OnEventTextEntered(const WindowEventHandler* eventHandler, const WindowEvent::TextEvent& event);
 			void OnEventTextEdited(const WindowEventHandler* eventHandler, const WindowEvent::EditEvent& event);
 
+			void InsertIntoGrid(std::size_t index);
+			void RemoveFromGrid(std::size_t index);
+			void RenameInGrid(std::size_t index, std::size_t oldIndex);
+
 			void UpdateHoveredWidget(int x, int y);
+			void UpdateWidgetGrid(std::size_t index);
 
 			struct WidgetEntry
 			{
 				BaseWidget* widget;
 				Boxf box;
+				Recti gridCells; //< range of m_widgetGrid cells referencing this widget
 				SystemCursor cursor;
+				bool isInGrid = false;
+				bool isLarge = false; //< box covers too many cells, referenced by m_largeWidgets instead of the grid
 			};
 
 			NazaraSlot(WindowEventHandler, OnKeyPressed, m_keyPressedSlot);
@@ -99,8 +120,15 @@ namespace Nz
 			std::size_t m_keyboardOwner;
 			std::size_t m_hoveredWidget;
 			std::size_t m_mouseOwner;
+			std::unordered_map<UInt64, std::vector<std::size_t>> m_widgetGrid;
+			std::vector<std::pair<std::size_t, std::size_t>> m_layoutOrder; //< depth and index in m_invalidatedLayoutWidgets
+			std::vector<std::size_t> m_hoverCandidates;
+			std::vector<std::size_t> m_largeWidgets;
+			std::vector<BaseWidget*> m_invalidatedLayoutWidgets; //< null entries are widgets destroyed before being laid out
 			std::vector<WidgetEntry> m_widgetEntries;
 			entt::registry& m_registry;
+			bool m_isDeferredLayoutEnabled;
+			bool m_isUpdatingLayout;
 	};
 }
 
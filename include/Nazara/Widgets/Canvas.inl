@@ -11,6 +11,9 @@ namespace Nz
 		// Destroy children explicitly because they signal us when getting destroyed, and that can't happen after our own destruction
 		DestroyChildren();
 
+		// Our layout queue is about to be destroyed
+		m_layoutQueueIndex = InvalidCanvasIndex;
+
 		// Prevent our parent from trying to call us
 		m_canvasIndex = InvalidCanvasIndex;
 	}
@@ -30,6 +33,11 @@ namespace Nz
 		return m_renderMask;
 	}
 
+	inline bool Canvas::IsDeferredLayoutEnabled() const
+	{
+		return m_isDeferredLayoutEnabled;
+	}
+
 	inline void Canvas::ClearKeyboardOwner(std::size_t canvasIndex)
 	{
 		if (m_keyboardOwner == canvasIndex)
@@ -52,6 +60,11 @@ namespace Nz
 		return m_mouseOwner == canvasIndex;
 	}
 
+	inline bool Canvas::IsUpdatingLayout() const
+	{
+		return m_isUpdatingLayout;
+	}
+
 	inline std::size_t Canvas::GetMouseEventTarget() const
 	{
 		if (m_mouseOwner != InvalidCanvasIndex)
@@ -68,6 +81,8 @@ namespace Nz
 		Nz::Vector2f size = entry.widget->GetSize();
 
 		entry.box = Boxf(pos.x, pos.y, pos.z, size.x, size.y, 1.f);
+
+		UpdateWidgetGrid(index);
 	}
 
 	inline void Canvas::NotifyWidgetCursorUpdate(std::size_t index)
@@ -79,6 +94,14 @@ namespace Nz
 			m_cursorController->UpdateCursor(Nz::Cursor::Get(entry.cursor));
 	}
 
+	inline std::size_t Canvas::NotifyWidgetLayoutInvalidation(BaseWidget* widget)
+	{
+		std::size_t index = m_invalidatedLayoutWidgets.size();
+		m_invalidatedLayoutWidgets.push_back(widget);
+
+		return index;
+	}
+
 	inline void Canvas::SetKeyboardOwner(std::size_t canvasIndex)
 	{
 		if (m_keyboardOwner != canvasIndex)
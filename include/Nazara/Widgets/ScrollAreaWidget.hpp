@@ -41,11 +41,13 @@ namespace Nz
 		private:
 			void Layout() override;
 
+			void OnChildPreferredSizeUpdated(const BaseWidget* child) override;
 			bool OnMouseWheelMoved(int x, int y, float delta) override;
 
 			std::unique_ptr<ScrollAreaWidgetStyle> m_style;
 			BaseWidget* m_content;
 			ScrollbarWidget* m_horizontalScrollbar;
+			bool m_isLayingOut;
 			bool m_isScrollbarEnabled;
 			bool m_hasScrollbar;
 	};
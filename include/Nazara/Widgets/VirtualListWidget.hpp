@@ -0,0 +1,88 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Widgets module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_WIDGETS_VIRTUALLISTWIDGET_HPP
+#define NAZARA_WIDGETS_VIRTUALLISTWIDGET_HPP
+
+#include <Nazara/Widgets/BaseWidget.hpp>
+#include <functional>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_WIDGETS_API VirtualListWidget : public BaseWidget
+	{
+		public:
+			using ItemFactory = std::function<BaseWidget*(VirtualListWidget* list)>;
+			using ItemHeightCallback = std::function<float(std::size_t itemIndex)>;
+			using ItemUpdater = std::function<void(BaseWidget* item, std::size_t itemIndex)>;
+
+			VirtualListWidget(BaseWidget* parent, ItemFactory itemFactory, ItemUpdater itemUpdater);
+			VirtualListWidget(const VirtualListWidget&) = delete;
+			VirtualListWidget(VirtualListWidget&&) = delete;
+			~VirtualListWidget() = default;
+
+			inline std::size_t GetColumnCount() const;
+			inline std::size_t GetItemCount() const;
+			inline float GetItemHeight() const;
+			inline std::size_t GetItemWidgetCount() const;
+			inline std::size_t GetOverscanRowCount() const;
+			inline std::size_t GetRowCount() const;
+			float GetRowOffset(std::size_t rowIndex) const;
+			inline std::size_t GetVisibleItemCount() const;
+
+			void RefreshItem(std::size_t itemIndex);
+			void RefreshItemHeights(std::size_t firstItemIndex = 0);
+			void RefreshItems();
+
+			void SetColumnCount(std::size_t columnCount);
+			void SetItemCount(std::size_t itemCount);
+			void SetItemHeight(float itemHeight);
+			void SetItemHeightCallback(ItemHeightCallback itemHeightCallback);
+			inline void SetOverscanRowCount(std::size_t overscanRowCount);
+
+			void SetRenderingRect(const Rectf& renderingRect) override;
+
+			VirtualListWidget& operator=(const VirtualListWidget&) = delete;
+			VirtualListWidget& operator=(VirtualListWidget&&) = delete;
+
+		private:
+			std::size_t FindRow(float offset) const;
+			float GetRowHeight(std::size_t rowIndex) const;
+
+			void Layout() override;
+
+			void ShowChildren(bool show) override;
+
+			void UpdateHeightIndex(std::size_t firstRow);
+
+			struct Item
+			{
+				BaseWidget* widget;
+				std::size_t index;
+			};
+
+			ItemFactory m_itemFactory;
+			ItemHeightCallback m_itemHeightCallback;
+			ItemUpdater m_itemUpdater;
+			std::vector<BaseWidget*> m_freeWidgets;
+			std::vector<Item> m_items;
+			std::vector<float> m_rowOffsets; //< prefix sum of row heights, only used with variable heights
+			std::size_t m_columnCount;
+			std::size_t m_firstItem;
+			std::size_t m_itemCount;
+			std::size_t m_lastItem;
+			std::size_t m_overscanRowCount;
+			Vector2f m_itemLayoutSize;
+			float m_itemHeight;
+			bool m_itemPositionsInvalidated;
+			bool m_refreshItems;
+	};
+}
+
+#include <Nazara/Widgets/VirtualListWidget.inl>
+
+#endif // NAZARA_WIDGETS_VIRTUALLISTWIDGET_HPP
@@ -0,0 +1,48 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Widgets module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	inline std::size_t VirtualListWidget::GetColumnCount() const
+	{
+		return m_columnCount;
+	}
+
+	inline std::size_t VirtualListWidget::GetItemCount() const
+	{
+		return m_itemCount;
+	}
+
+	inline float VirtualListWidget::GetItemHeight() const
+	{
+		return m_itemHeight;
+	}
+
+	inline std::size_t VirtualListWidget::GetItemWidgetCount() const
+	{
+		return m_items.size() + m_freeWidgets.size();
+	}
+
+	inline std::size_t VirtualListWidget::GetOverscanRowCount() const
+	{
+		return m_overscanRowCount;
+	}
+
+	inline std::size_t VirtualListWidget::GetRowCount() const
+	{
+		return (m_itemCount + m_columnCount - 1) / m_columnCount;
+	}
+
+	inline std::size_t VirtualListWidget::GetVisibleItemCount() const
+	{
+		return m_items.size();
+	}
+
+	inline void VirtualListWidget::SetOverscanRowCount(std::size_t overscanRowCount)
+	{
+		m_overscanRowCount = overscanRowCount;
+		InvalidateLayout();
+	}
+}
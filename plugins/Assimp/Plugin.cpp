@@ -885,6 +885,9 @@ Nz::Result<std::shared_ptr<Nz::Mesh>, Nz::ResourceLoadingError> LoadMesh(Nz::Str
 	for (const auto& pair : materialData)
 		mesh->SetMaterialData(pair.second.first, pair.second.second);
 
+	if (parameters.lodCount > 0)
+		mesh->GenerateLods(parameters);
+
 	return mesh;
 }
 
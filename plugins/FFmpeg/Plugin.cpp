@@ -136,7 +136,8 @@ namespace
 
 				for (;;)
 				{
-					if (int errCode = av_read_frame(m_formatContext, &packet); errCode < 0)
+					// With frame threading the decoder holds back a few frames, try to get one before feeding it another packet
+					if (int errCode = avcodec_receive_frame(m_codecContext, m_rawFrame); errCode < 0)
 					{
 						if (errCode == AVERROR_EOF)
 						{
@@ -149,29 +150,42 @@ namespace
 							return false;
 						}
 
+						if (errCode != AVERROR(EAGAIN))
+						{
+							NazaraErrorFmt("failed to receive frame: {0}", ErrorToString(errCode));
+							return false;
+						}
+					}
+					else
+						break;
+
+					if (int errCode = av_read_frame(m_formatContext, &packet); errCode < 0)
+					{
+						if (errCode == AVERROR_EOF)
+						{
+							// Enter draining mode to retrieve the frames still being decoded
+							avcodec_send_packet(m_codecContext, nullptr);
+							continue;
+						}
+
 						NazaraErrorFmt("failed to read frame: {0}", ErrorToString(errCode));
 						return false;
 					}
 
 					if (packet.stream_index != m_videoStream)
-						continue;
-
-					if (int errCode = avcodec_send_packet(m_codecContext, &packet); errCode < 0)
 					{
-						NazaraErrorFmt("failed to send packet: {0}", ErrorToString(errCode));
-						return false;
+						av_packet_unref(&packet);
+						continue;
 					}
 
-					if (int errCode = avcodec_receive_frame(m_codecContext, m_rawFrame); errCode < 0)
-					{
-						if (errCode == AVERROR(EAGAIN))
-							continue;
+					int errCode = avcodec_send_packet(m_codecContext, &packet);
+					av_packet_unref(&packet);
 
-						NazaraErrorFmt("failed to receive frame: {0}", ErrorToString(errCode));
+					if (errCode < 0)
+					{
+						NazaraErrorFmt("failed to send packet: {0}", ErrorToString(errCode));
 						return false;
 					}
-
-					break;
 				}
 
 				sws_scale(m_conversionContext, m_rawFrame->data, m_rawFrame->linesize, 0, m_codecContext->height, m_rgbaFrame->data, m_rgbaFrame->linesize);
@@ -239,6 +253,10 @@ namespace
 					return Nz::Err(Nz::ResourceLoadingError::Internal);
 				}
 
+				// Let FFmpeg decode multiple frames in parallel (frame count is picked from the number of cores)
+				m_codecContext->thread_count = 0;
+				m_codecContext->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
 				if (int errCode = avcodec_open2(m_codecContext, m_codec, nullptr); errCode < 0)
 				{
 					NazaraErrorFmt("could not open codec: {0}", ErrorToString(errCode));
@@ -278,6 +296,9 @@ namespace
 				// TODO
 				avio_seek(m_ioContext, 0, SEEK_SET);
 				avformat_seek_file(m_formatContext, m_videoStream, std::numeric_limits<Nz::Int64>::min(), 0, std::numeric_limits<Nz::Int64>::max(), 0);
+
+				// Drop frames (and leave draining mode) from before the seek
+				avcodec_flush_buffers(m_codecContext);
 			}
 
 			bool SetFile(const std::filesystem::path& filePath)
@@ -10,4 +10,21 @@ namespace Nz
 	{
 		OnAtlasRelease(this);
 	}
+
+	/*!
+	* \brief Inserts multiple images at once
+	* \return True if every image was inserted
+	*
+	* The default implementation inserts images one by one, atlases able to pack rectangles together should override it
+	*/
+	bool AbstractAtlas::Insert(SparsePtr<const Image> images, SparsePtr<Rectui> rects, SparsePtr<bool> flipped, SparsePtr<std::size_t> layerIndices, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!Insert(images[i], &rects[i], &flipped[i], &layerIndices[i]))
+				return false;
+		}
+
+		return true;
+	}
 }
@@ -30,10 +30,18 @@
 #include <Nazara/Core/Joint.hpp>
 #include <Nazara/Core/Mesh.hpp>
 #include <Nazara/Core/SkeletalMesh.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Math/Angle.hpp>
 #include <algorithm>
+#include <array>
+#include <numeric>
+#include <span>
 #include <unordered_map>
 
+#ifdef NAZARA_ARCH_x86_64
+#include <xmmintrin.h>
+#endif
+
 namespace Nz
 {
 	namespace NAZARA_ANONYMOUS_NAMESPACE
@@ -170,44 +178,7 @@ namespace Nz
 
 		// Source: https://code.google.com/p/vcacne/
 		// Auteur: Michael Georgoulpoulos
-		// Selon ce papier: http://home.comcast.net/~tom_forsyth/papers/fast_vert_cache_opt.html
-		// Modifié pour les besoins du moteur
-		///TODO: Déplacer dans un fichier à part ?
-		struct VertexCacheData
-		{
-			int positionInCache = -1;
-			float score = 0.f;
-			int totalValence = 0; // total number of triangles using this vertex
-			int remainingValence = 0; // number of triangles using it but not yet rendered
-			std::vector<int> triIndices; // indices to the indices that use this vertex
-			bool calculated; // was the score calculated during this iteration?
-
-			int FindTriangle(int tri)
-			{
-				for (unsigned int i = 0; i < triIndices.size(); ++i)
-					if (triIndices[i] == tri) return i;
-
-				return -1;
-			}
-
-			void MoveTriangleToEnd(int tri)
-			{
-				auto it = std::find(triIndices.begin(), triIndices.end(), tri);
-				NazaraAssert(it != triIndices.end(), "Triangle not found");
-
-				triIndices.erase(it);
-				triIndices.push_back(tri);
-			}
-		};
-
-		struct TriangleCacheData
-		{
-			bool rendered = false; // has the triangle been added to the draw list yet?
-			float current_score = 0.f; // sum of the score of its vertices
-			int verts[3] = {-1, -1, -1}; // indices to the triangle's vertices
-			bool calculated = false; // was the score calculated during this iteration?
-		};
-
+		// Simulates a 32-entries LRU cache to count cache misses
 		class VertexCache
 		{
 			public:
@@ -283,351 +254,1027 @@ namespace Nz
 				UInt32 m_misses; // cache miss count
 		};
 
+		// Linear-speed vertex cache optimization
+		// Selon ce papier: https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
 		class VertexCacheOptimizer
 		{
 			public:
-				enum Result
-				{
-					Success,
-					Fail_BadIndex,
-					Fail_NoVerts
-				};
+				static constexpr std::size_t CacheSize = 32;
+				static constexpr std::size_t MaxValence = 32;
 
 				VertexCacheOptimizer()
 				{
-					// initialize constants
-					m_cacheDecayPower = 1.5f;
-					m_lastTriScore = 0.75f;
-					m_valenceBoostScale = 2.0f;
-					m_valenceBoostPower = 0.5f;
+					constexpr float CacheDecayPower = 1.5f;
+					constexpr float LastTriScore = 0.75f;
+					constexpr float ValenceBoostScale = 2.0f;
+					constexpr float ValenceBoostPower = 0.5f;
+
+					// m_cacheScores[0] is used for vertices outside of the cache
+					m_cacheScores[0] = 0.f;
+					for (std::size_t i = 0; i < CacheSize; ++i)
+					{
+						if (i < 3)
+						{
+							// This vertex was used in the last triangle, so it has a fixed score, whichever of the three it's in.
+							// Otherwise, you can get very different answers depending on whether you add the triangle 1,2,3 or 3,1,2 - which is silly.
+							m_cacheScores[i + 1] = LastTriScore;
+						}
+						else
+						{
+							// Points for being high in the cache
+							const float Scaler = 1.0f / (CacheSize - 3);
+							m_cacheScores[i + 1] = std::pow(1.0f - (i - 3) * Scaler, CacheDecayPower);
+						}
+					}
 
-					m_bestTri = 0;
+					// Bonus points for having a low number of tris still to use the vert, so we get rid of lone verts quickly
+					m_valenceScores[0] = 0.f;
+					for (std::size_t i = 1; i <= MaxValence; ++i)
+						m_valenceScores[i] = ValenceBoostScale * std::pow(static_cast<float>(i), -ValenceBoostPower);
 				}
 
-				// stores new indices in place
-				Result Optimize(IndexIterator indices, UInt32 indexCount)
+				// Reorders triangles in place
+				void Optimize(UInt32* indices, std::size_t indexCount, UInt32 vertexCount)
 				{
-					if (indexCount == 0)
-						return Fail_NoVerts;
+					std::size_t triangleCount = indexCount / 3;
+					if (triangleCount == 0)
+						return;
+
+					// Build vertex to triangle adjacency (each vertex references a range in m_adjacency)
+					m_liveTriangles.assign(vertexCount, 0);
+					for (std::size_t i = 0; i < triangleCount * 3; ++i)
+						m_liveTriangles[indices[i]]++;
+
+					m_adjacencyOffsets.resize(vertexCount);
+					UInt32 offset = 0;
+					for (UInt32 i = 0; i < vertexCount; ++i)
+					{
+						m_adjacencyOffsets[i] = offset;
+						offset += m_liveTriangles[i];
+					}
+
+					m_adjacency.resize(triangleCount * 3);
+					m_vertexScores.resize(vertexCount);
+					{
+						std::vector<UInt32> cursors(m_adjacencyOffsets);
+						for (std::size_t i = 0; i < triangleCount; ++i)
+						{
+							for (std::size_t j = 0; j < 3; ++j)
+								m_adjacency[cursors[indices[i * 3 + j]]++] = SafeCast<UInt32>(i);
+						}
+					}
+
+					for (UInt32 i = 0; i < vertexCount; ++i)
+						m_vertexScores[i] = GetVertexScore(-1, m_liveTriangles[i]);
 
-					// find vertex count
-					int max_vert = *std::max_element(indices, indices + indexCount);
+					m_triangleScores.resize(triangleCount);
+					for (std::size_t i = 0; i < triangleCount; ++i)
+						m_triangleScores[i] = m_vertexScores[indices[i * 3 + 0]] + m_vertexScores[indices[i * 3 + 1]] + m_vertexScores[indices[i * 3 + 2]];
 
-					Result res = Init(indices, indexCount, max_vert + 1);
-					if (res != Success)
-						return res;
+					m_emittedTriangles.assign(triangleCount, false);
+					m_output.resize(triangleCount * 3);
 
-					// iterate until Iterate returns false
-					while (Iterate());
+					// Cache is three entries larger than the simulated one, to keep track of vertices being pushed out by the current triangle
+					std::array<UInt32, CacheSize + 3> cache;
+					std::array<UInt32, CacheSize + 3> newCache;
+					std::size_t cacheCount = 0;
 
-					// rewrite optimized index list
-					for (int index : m_drawList)
+					std::size_t currentTriangle = 0;
+					std::size_t inputCursor = 1;
+
+					for (std::size_t outputTriangle = 0; outputTriangle < triangleCount; ++outputTriangle)
 					{
-						*indices++ = m_triangles[index].verts[0];
-						*indices++ = m_triangles[index].verts[1];
-						*indices++ = m_triangles[index].verts[2];
+						UInt32 a = indices[currentTriangle * 3 + 0];
+						UInt32 b = indices[currentTriangle * 3 + 1];
+						UInt32 c = indices[currentTriangle * 3 + 2];
+
+						m_output[outputTriangle * 3 + 0] = a;
+						m_output[outputTriangle * 3 + 1] = b;
+						m_output[outputTriangle * 3 + 2] = c;
+
+						// Push triangle vertices on top of the cache
+						std::size_t newCacheCount = 0;
+						newCache[newCacheCount++] = a;
+						newCache[newCacheCount++] = b;
+						newCache[newCacheCount++] = c;
+
+						for (std::size_t i = 0; i < cacheCount; ++i)
+						{
+							UInt32 vertex = cache[i];
+							if (vertex != a && vertex != b && vertex != c)
+								newCache[newCacheCount++] = vertex;
+						}
+
+						// Remove emitted triangle from its vertices adjacency
+						for (UInt32 vertex : { a, b, c })
+						{
+							UInt32* triangles = &m_adjacency[m_adjacencyOffsets[vertex]];
+							UInt32& liveTriangles = m_liveTriangles[vertex];
+							for (UInt32 i = 0; i < liveTriangles; ++i)
+							{
+								if (triangles[i] == currentTriangle)
+								{
+									std::swap(triangles[i], triangles[liveTriangles - 1]);
+									liveTriangles--;
+									break;
+								}
+							}
+						}
+
+						m_emittedTriangles[currentTriangle] = true;
+
+						// Update scores of vertices whose cache position changed along with their triangles, and pick the next best triangle
+						std::size_t bestTriangle = std::numeric_limits<std::size_t>::max();
+						float bestScore = 0.f;
+						for (std::size_t i = 0; i < newCacheCount; ++i)
+						{
+							UInt32 vertex = newCache[i];
+							UInt32 liveTriangles = m_liveTriangles[vertex];
+							if (liveTriangles == 0)
+								continue;
+
+							float score = GetVertexScore((i < CacheSize) ? int(i) : -1, liveTriangles);
+							float scoreDiff = score - m_vertexScores[vertex];
+							m_vertexScores[vertex] = score;
+
+							const UInt32* triangles = &m_adjacency[m_adjacencyOffsets[vertex]];
+							for (UInt32 j = 0; j < liveTriangles; ++j)
+							{
+								UInt32 triangle = triangles[j];
+
+								float triangleScore = m_triangleScores[triangle] + scoreDiff;
+								m_triangleScores[triangle] = triangleScore;
+
+								if (triangleScore > bestScore)
+								{
+									bestScore = triangleScore;
+									bestTriangle = triangle;
+								}
+							}
+						}
+
+						cacheCount = std::min(newCacheCount, CacheSize);
+						std::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+
+						// Dead end, no triangle left using cached vertices: pick next triangle in input order
+						if (bestTriangle == std::numeric_limits<std::size_t>::max())
+						{
+							while (inputCursor < triangleCount && m_emittedTriangles[inputCursor])
+								inputCursor++;
+
+							bestTriangle = inputCursor;
+						}
+
+						currentTriangle = bestTriangle;
 					}
 
-					return Success;
+					std::copy(m_output.begin(), m_output.end(), indices);
 				}
 
 			private:
-				float CalculateVertexScore(VertexCacheData& vertex) const
+				float GetVertexScore(int cachePosition, UInt32 liveTriangles) const
 				{
-					if (vertex.remainingValence <= 0)
-						// No tri needs this vertex!
-						return -1.0f;
+					if (liveTriangles == 0)
+						return -1.f; // No tri needs this vertex!
 
-					float ret;
-					if (vertex.positionInCache < 0)
-					{
-						// Vertex is not in FIFO cache - no score.
-						ret = 0.0f;
-					}
-					else
+					return m_cacheScores[cachePosition + 1] + m_valenceScores[std::min<std::size_t>(liveTriangles, MaxValence)];
+				}
+
+				std::array<float, CacheSize + 1> m_cacheScores;
+				std::array<float, MaxValence + 1> m_valenceScores;
+				std::vector<bool> m_emittedTriangles;
+				std::vector<float> m_triangleScores;
+				std::vector<float> m_vertexScores;
+				std::vector<UInt32> m_adjacency;
+				std::vector<UInt32> m_adjacencyOffsets;
+				std::vector<UInt32> m_liveTriangles;
+				std::vector<UInt32> m_output;
+		};
+
+		/*********************************Overdraw**********************************/
+
+		// Overdraw optimization from "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" (Sander, Nehab, Barczak)
+		// Triangles are split in clusters which are then sorted to draw outer-facing ones first
+		class OverdrawOptimizer
+		{
+			public:
+				// FIFO cache size used to detect cluster boundaries
+				static constexpr UInt32 CacheSize = 16;
+
+				void Optimize(UInt32* indices, std::size_t indexCount, SparsePtr<const Vector3f> positions, UInt32 vertexCount, float threshold)
+				{
+					std::size_t triangleCount = indexCount / 3;
+					if (triangleCount == 0)
+						return;
+
+					m_cacheTimestamps.assign(vertexCount, 0);
+					m_timestamp = CacheSize + 1;
+
+					GenerateHardBoundaries(indices, triangleCount);
+					GenerateSoftBoundaries(indices, triangleCount, threshold);
+
+					std::size_t clusterCount = m_softBoundaries.size();
+
+					// Mesh centroid
+					Vector3f meshCentroid = Vector3f::Zero();
+					for (std::size_t i = 0; i < triangleCount * 3; ++i)
+						meshCentroid += positions[indices[i]];
+
+					meshCentroid /= float(triangleCount * 3);
+
+					// Sort clusters by how much they face away from the mesh center
+					m_clusterSortKeys.resize(clusterCount);
+					for (std::size_t cluster = 0; cluster < clusterCount; ++cluster)
 					{
-						if (vertex.positionInCache < 3)
-						{
-							// This vertex was used in the last triangle,
-							// so it has a fixed score, whichever of the three
-							// it's in. Otherwise, you can get very different
-							// answers depending on whether you add
-							// the triangle 1,2,3 or 3,1,2 - which is silly.
-							ret = m_lastTriScore;
-						}
-						else
+						std::size_t first = m_softBoundaries[cluster];
+						std::size_t last = (cluster + 1 < clusterCount) ? m_softBoundaries[cluster + 1] : triangleCount;
+
+						Vector3f clusterCentroid = Vector3f::Zero();
+						Vector3f clusterNormal = Vector3f::Zero();
+						float clusterArea = 0.f;
+
+						for (std::size_t i = first; i < last; ++i)
 						{
-							// Points for being high in the cache.
-							const float Scaler = 1.0f / (32  - 3);
-							ret = 1.0f - (vertex.positionInCache - 3) * Scaler;
-							ret = std::pow(ret, m_cacheDecayPower);
+							const Vector3f& p0 = positions[indices[i * 3 + 0]];
+							const Vector3f& p1 = positions[indices[i * 3 + 1]];
+							const Vector3f& p2 = positions[indices[i * 3 + 2]];
+
+							Vector3f normal = (p1 - p0).CrossProduct(p2 - p0);
+							float area = normal.GetLength();
+
+							clusterCentroid += (p0 + p1 + p2) * (area / 3.f);
+							clusterNormal += normal;
+							clusterArea += area;
 						}
+
+						if (clusterArea > 0.f)
+							clusterCentroid /= clusterArea;
+
+						float normalLength = clusterNormal.GetLength();
+						if (normalLength > 0.f)
+							clusterNormal /= normalLength;
+
+						m_clusterSortKeys[cluster] = (clusterCentroid - meshCentroid).DotProduct(clusterNormal);
 					}
 
-					// Bonus points for having a low number of tris still to
-					// use the vert, so we get rid of lone verts quickly.
-					float valence_boost = std::pow(static_cast<float>(vertex.remainingValence), -m_valenceBoostPower);
-					ret += m_valenceBoostScale * valence_boost;
+					m_clusterOrder.resize(clusterCount);
+					std::iota(m_clusterOrder.begin(), m_clusterOrder.end(), 0);
+					std::stable_sort(m_clusterOrder.begin(), m_clusterOrder.end(), [&](std::size_t lhs, std::size_t rhs)
+					{
+						return m_clusterSortKeys[lhs] > m_clusterSortKeys[rhs];
+					});
 
-					return ret;
+					m_output.resize(triangleCount * 3);
+					std::size_t outputOffset = 0;
+					for (std::size_t cluster : m_clusterOrder)
+					{
+						std::size_t first = m_softBoundaries[cluster];
+						std::size_t last = (cluster + 1 < clusterCount) ? m_softBoundaries[cluster + 1] : triangleCount;
+
+						std::copy(indices + first * 3, indices + last * 3, m_output.begin() + outputOffset);
+						outputOffset += (last - first) * 3;
+					}
+
+					std::copy(m_output.begin(), m_output.end(), indices);
+				}
+
+			private:
+				void FlushCache()
+				{
+					m_timestamp += CacheSize + 1;
 				}
 
-				// returns the index of the triangle with the highest score
-				// (or -1, if there aren't any active triangles)
-				int FullScoreRecalculation()
+				void GenerateHardBoundaries(const UInt32* indices, std::size_t triangleCount)
 				{
-					// calculate score for all vertices
-					for (VertexCacheData& vertex : m_vertices)
-						vertex.score = CalculateVertexScore(vertex);
+					FlushCache();
 
-					// calculate scores for all active triangles
-					float maxScore = std::numeric_limits<float>::lowest();
-					int maxScoreTri = -1;
+					m_hardBoundaries.clear();
+					for (std::size_t i = 0; i < triangleCount; ++i)
+					{
+						// A triangle missing all its vertices is most likely the start of a disjoint patch of the mesh
+						UInt32 missCount = UpdateCache(indices[i * 3 + 0], indices[i * 3 + 1], indices[i * 3 + 2]);
+						if (i == 0 || missCount == 3)
+							m_hardBoundaries.push_back(i);
+					}
+				}
 
-					for (unsigned int i = 0; i < m_triangles.size(); ++i)
+				void GenerateSoftBoundaries(const UInt32* indices, std::size_t triangleCount, float threshold)
+				{
+					m_softBoundaries.clear();
+					for (std::size_t cluster = 0; cluster < m_hardBoundaries.size(); ++cluster)
 					{
-						if (m_triangles[i].rendered)
-							continue;
+						std::size_t first = m_hardBoundaries[cluster];
+						std::size_t last = (cluster + 1 < m_hardBoundaries.size()) ? m_hardBoundaries[cluster + 1] : triangleCount;
+
+						// Compute cluster ACMR
+						FlushCache();
 
-						// sum the score of all the triangle's vertices
-						float sc = m_vertices[m_triangles[i].verts[0]].score +
-						           m_vertices[m_triangles[i].verts[1]].score +
-						           m_vertices[m_triangles[i].verts[2]].score;
+						UInt32 clusterMisses = 0;
+						for (std::size_t i = first; i < last; ++i)
+							clusterMisses += UpdateCache(indices[i * 3 + 0], indices[i * 3 + 1], indices[i * 3 + 2]);
 
-						m_triangles[i].current_score = sc;
+						float clusterThreshold = threshold * (float(clusterMisses) / float(last - first));
 
-						if (sc > maxScore)
+						// Split the cluster each time its running ACMR goes below the threshold
+						std::size_t clusterStart = m_softBoundaries.size();
+						m_softBoundaries.push_back(first);
+
+						FlushCache();
+
+						UInt32 runningMisses = 0;
+						UInt32 runningTriangles = 0;
+						for (std::size_t i = first; i < last; ++i)
 						{
-							maxScore = sc;
-							maxScoreTri = i;
+							runningMisses += UpdateCache(indices[i * 3 + 0], indices[i * 3 + 1], indices[i * 3 + 2]);
+							runningTriangles++;
+
+							if (float(runningMisses) / float(runningTriangles) <= clusterThreshold)
+							{
+								m_softBoundaries.push_back(i + 1);
+
+								FlushCache();
+								runningMisses = 0;
+								runningTriangles = 0;
+							}
 						}
-					}
 
-					return maxScoreTri;
+						// The last boundary either points to the end of the cluster (and is empty) or has a poor ACMR, merge it with the previous one
+						if (m_softBoundaries.size() - clusterStart > 1)
+							m_softBoundaries.pop_back();
+					}
 				}
 
-				Result InitialPass()
+				UInt32 UpdateCache(UInt32 a, UInt32 b, UInt32 c)
 				{
-					for (std::size_t i = 0; i < m_indices.size(); ++i)
+					UInt32 missCount = 0;
+					for (UInt32 vertex : { a, b, c })
 					{
-						UInt32 index = m_indices[i];
-						if (index >= m_vertices.size())
-							return Fail_BadIndex;
+						if (m_timestamp - m_cacheTimestamps[vertex] > CacheSize)
+						{
+							m_cacheTimestamps[vertex] = m_timestamp++;
+							missCount++;
+						}
+					}
 
-						m_vertices[index].totalValence++;
-						m_vertices[index].remainingValence++;
+					return missCount;
+				}
 
-						m_vertices[index].triIndices.push_back(SafeCast<int>(i / 3));
-					}
+				std::vector<float> m_clusterSortKeys;
+				std::vector<std::size_t> m_clusterOrder;
+				std::vector<std::size_t> m_hardBoundaries;
+				std::vector<std::size_t> m_softBoundaries;
+				std::vector<UInt32> m_cacheTimestamps;
+				std::vector<UInt32> m_output;
+				UInt32 m_timestamp;
+		};
+
+		std::vector<UInt32> CopyIndices(IndexIterator indices, UInt32 indexCount, UInt32* vertexCount)
+		{
+			std::vector<UInt32> indexData(indexCount);
+
+			UInt32 maxIndex = 0;
+			for (UInt32 i = 0; i < indexCount; ++i)
+			{
+				UInt32 index = indices[i];
+				indexData[i] = index;
+				maxIndex = std::max(maxIndex, index);
+			}
+
+			if (vertexCount)
+				*vertexCount = (indexCount > 0) ? maxIndex + 1 : 0;
+
+			return indexData;
+		}
+
+		void WriteIndices(IndexIterator indices, const std::vector<UInt32>& indexData)
+		{
+			for (UInt32 index : indexData)
+				*indices++ = index;
+		}
+
+		/******************************Simplification*******************************/
+
+		// Mesh simplification using iterative edge collapses sorted by their quadric error
+		// Selon ce papier: "Surface Simplification Using Quadric Error Metrics" (Garland, Heckbert)
+		struct Quadric
+		{
+			void AddPlane(const Vector3f& normal, float distance, float planeWeight)
+			{
+				a00 += planeWeight * normal.x * normal.x;
+				a01 += planeWeight * normal.x * normal.y;
+				a02 += planeWeight * normal.x * normal.z;
+				a11 += planeWeight * normal.y * normal.y;
+				a12 += planeWeight * normal.y * normal.z;
+				a22 += planeWeight * normal.z * normal.z;
+				b0 += planeWeight * normal.x * distance;
+				b1 += planeWeight * normal.y * distance;
+				b2 += planeWeight * normal.z * distance;
+				c += planeWeight * distance * distance;
+				weight += planeWeight;
+			}
+
+			// Returns the weighted mean of the squared distances of the point to the planes
+			double Evaluate(const Vector3f& point) const
+			{
+				double x = point.x;
+				double y = point.y;
+				double z = point.z;
+
+				double error = a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + a11 * y * y + 2.0 * a12 * y * z + a22 * z * z;
+				error += 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+
+				return (weight > 0.0) ? std::abs(error) / weight : 0.0;
+			}
+
+			Quadric operator+(const Quadric& quadric) const
+			{
+				Quadric result = *this;
+				result += quadric;
+
+				return result;
+			}
+
+			Quadric& operator+=(const Quadric& quadric)
+			{
+				a00 += quadric.a00;
+				a01 += quadric.a01;
+				a02 += quadric.a02;
+				a11 += quadric.a11;
+				a12 += quadric.a12;
+				a22 += quadric.a22;
+				b0 += quadric.b0;
+				b1 += quadric.b1;
+				b2 += quadric.b2;
+				c += quadric.c;
+				weight += quadric.weight;
+
+				return *this;
+			}
 
-					m_bestTri = FullScoreRecalculation();
+			double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+			double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+			double c = 0.0;
+			double weight = 0.0;
+		};
 
-					return Success;
+		class MeshSimplifier
+		{
+			public:
+				MeshSimplifier(std::vector<UInt32> indices, SparsePtr<const Vector3f> positions, UInt32 vertexCount) :
+				m_indices(std::move(indices)),
+				m_positions(vertexCount)
+				{
+					// Errors are computed on normalized positions so they're relative to the mesh size
+					Boxf aabb = ComputeAABB(positions, vertexCount);
+					float scale = std::max({ aabb.width, aabb.height, aabb.depth });
+					float invScale = (scale > 0.f) ? 1.f / scale : 0.f;
+
+					Vector3f origin(aabb.x, aabb.y, aabb.z);
+					for (UInt32 i = 0; i < vertexCount; ++i)
+						m_positions[i] = (positions[i] - origin) * invScale;
+
+					BuildPositionRemap();
+					LockBorderAndSeamVertices();
+					ComputeQuadrics();
 				}
 
-				Result Init(IndexIterator indices, UInt32 indexCount, UInt32 vertexCount)
+				std::size_t Simplify(std::size_t targetIndexCount, float targetError, float* resultError)
 				{
-					// clear the draw list
-					m_drawList.clear();
+					double maxError = double(targetError) * double(targetError);
+					double reachedError = 0.0;
 
-					// allocate and initialize vertices and triangles
-					m_vertices.clear(); // to force rebuild every element
-					m_vertices.resize(vertexCount);
+					UInt32 vertexCount = SafeCast<UInt32>(m_positions.size());
+					m_collapseLocked.resize(vertexCount);
+					m_collapseRemap.resize(vertexCount);
 
-					m_triangles.clear();
-					for (UInt32 i = 0; i < indexCount; i += 3)
+					while (m_indices.size() > targetIndexCount)
 					{
-						TriangleCacheData dat;
-						for (unsigned int j = 0; j < 3; ++j)
-							dat.verts[j] = indices[i + j];
+						BuildAdjacency();
+						CollectCollapses();
+
+						std::sort(m_collapses.begin(), m_collapses.end(), [](const EdgeCollapse& lhs, const EdgeCollapse& rhs) { return lhs.error < rhs.error; });
+
+						std::size_t triangleToRemove = (m_indices.size() - targetIndexCount) / 3;
+						std::size_t removedTriangles = 0;
+						std::size_t collapseCount = 0;
+
+						std::fill(m_collapseLocked.begin(), m_collapseLocked.end(), false);
+						std::iota(m_collapseRemap.begin(), m_collapseRemap.end(), 0);
+
+						for (const EdgeCollapse& collapse : m_collapses)
+						{
+							if (collapse.error > maxError || removedTriangles >= triangleToRemove)
+								break;
+
+							UInt32 from = m_positionRemap[collapse.from];
+							UInt32 to = m_positionRemap[collapse.to];
+
+							// Vertices around a collapse are locked for the remainder of the pass, this ensures adjacency is up to date
+							if (m_collapseLocked[from] || m_collapseLocked[to])
+								continue;
+
+							if (HasTriangleFlip(from, to))
+								continue;
+
+							for (UInt32 triangle : GetAdjacentTriangles(from))
+							{
+								for (std::size_t i = 0; i < 3; ++i)
+								{
+									UInt32 vertex = m_positionRemap[m_indices[triangle * 3 + i]];
+									m_collapseLocked[vertex] = true;
+
+									if (vertex == to)
+										removedTriangles++;
+								}
+							}
 
-						m_triangles.push_back(dat);
+							m_collapseRemap[collapse.from] = collapse.to;
+							m_quadrics[to] += m_quadrics[from];
+
+							reachedError = std::max(reachedError, collapse.error);
+							collapseCount++;
+						}
+
+						if (collapseCount == 0)
+							break;
+
+						ApplyCollapses();
 					}
 
-					// copy the indices
-					m_indices.resize(indexCount);
-					for (UInt32 i = 0; i < indexCount; ++i)
-						m_indices[i] = indices[i];
+					if (resultError)
+						*resultError = float(std::sqrt(reachedError));
 
-					m_vertexCache.Clear();
-					m_bestTri = -1;
+					return m_indices.size();
+				}
 
-					return InitialPass();
+				const std::vector<UInt32>& GetIndices() const
+				{
+					return m_indices;
 				}
 
-				void AddTriangleToDrawList(int tri)
+			private:
+				struct EdgeCollapse
 				{
-					// reset all cache positions
-					for (unsigned int i = 0; i < 32; ++i)
+					UInt32 from;
+					UInt32 to;
+					double error;
+				};
+
+				void ApplyCollapses()
+				{
+					std::size_t indexCount = 0;
+					for (std::size_t i = 0; i < m_indices.size(); i += 3)
 					{
-						int ind = m_vertexCache.GetVertex(i);
-						if (ind < 0)
+						UInt32 a = m_collapseRemap[m_indices[i + 0]];
+						UInt32 b = m_collapseRemap[m_indices[i + 1]];
+						UInt32 c = m_collapseRemap[m_indices[i + 2]];
+
+						UInt32 ra = m_positionRemap[a];
+						UInt32 rb = m_positionRemap[b];
+						UInt32 rc = m_positionRemap[c];
+
+						// Skip degenerate triangles
+						if (ra == rb || rb == rc || rc == ra)
 							continue;
 
-						m_vertices[ind].positionInCache = -1;
+						m_indices[indexCount++] = a;
+						m_indices[indexCount++] = b;
+						m_indices[indexCount++] = c;
 					}
 
-					TriangleCacheData* t = &m_triangles[tri];
-					if (t->rendered)
-						return; // triangle is already in the draw list
+					m_indices.resize(indexCount);
+				}
+
+				void BuildAdjacency()
+				{
+					std::size_t vertexCount = m_positions.size();
 
-					for (int vert : t->verts)
+					m_adjacencyOffsets.assign(vertexCount + 1, 0);
+					for (UInt32 index : m_indices)
+						m_adjacencyOffsets[m_positionRemap[index] + 1]++;
+
+					for (std::size_t i = 0; i < vertexCount; ++i)
+						m_adjacencyOffsets[i + 1] += m_adjacencyOffsets[i];
+
+					m_adjacency.resize(m_indices.size());
+
+					m_adjacencyCursors.assign(m_adjacencyOffsets.begin(), m_adjacencyOffsets.end() - 1);
+					for (std::size_t i = 0; i < m_indices.size(); ++i)
+						m_adjacency[m_adjacencyCursors[m_positionRemap[m_indices[i]]]++] = SafeCast<UInt32>(i / 3);
+				}
+
+				void BuildPositionRemap()
+				{
+					struct PositionHasher
 					{
-						// add all triangle vertices to the cache
-						m_vertexCache.AddVertex(vert);
+						std::size_t operator()(const Vector3f& position) const
+						{
+							std::size_t seed = 0;
+							HashCombine(seed, position.x);
+							HashCombine(seed, position.y);
+							HashCombine(seed, position.z);
 
-						VertexCacheData *v = &m_vertices[vert];
+							return seed;
+						}
+					};
 
-						// decrease remaining valence
-						v->remainingValence--;
+					// Vertices sharing the same position (such as vertices on UV seams) are treated as one
+					std::unordered_map<Vector3f, UInt32, PositionHasher> positionToVertex;
+					positionToVertex.reserve(m_positions.size());
 
-						// move the added triangle to the end of the vertex's
-						// triangle index list, so that the first 'remaining_valence'
-						// triangles in the list are the active ones
-						v->MoveTriangleToEnd(tri);
+					m_positionRemap.resize(m_positions.size());
+					for (UInt32 i = 0; i < m_positions.size(); ++i)
+					{
+						Vector3f position = m_positions[i] + Vector3f::Zero(); //< turns -0 into +0
+						m_positionRemap[i] = positionToVertex.emplace(position, i).first->second;
 					}
+				}
 
-					m_drawList.push_back(tri);
+				void CollectCollapses()
+				{
+					m_collapses.clear();
+					for (std::size_t i = 0; i < m_indices.size(); i += 3)
+					{
+						for (std::size_t j = 0; j < 3; ++j)
+						{
+							UInt32 a = m_indices[i + j];
+							UInt32 b = m_indices[i + (j + 1) % 3];
+
+							UInt32 ra = m_positionRemap[a];
+							UInt32 rb = m_positionRemap[b];
+
+							// Manifold edges are shared by two triangles, only consider them once
+							if (ra >= rb)
+								continue;
+
+							bool canCollapseA = !m_locked[ra];
+							bool canCollapseB = !m_locked[rb];
+							if (!canCollapseA && !canCollapseB)
+								continue;
+
+							Quadric quadric = m_quadrics[ra] + m_quadrics[rb];
+							double errorAB = (canCollapseA) ? quadric.Evaluate(m_positions[rb]) : std::numeric_limits<double>::infinity();
+							double errorBA = (canCollapseB) ? quadric.Evaluate(m_positions[ra]) : std::numeric_limits<double>::infinity();
 
-					t->rendered = true;
+							if (errorAB <= errorBA)
+								m_collapses.push_back({ a, b, errorAB });
+							else
+								m_collapses.push_back({ b, a, errorBA });
+						}
+					}
+				}
 
-					// update all vertex cache positions
-					for (unsigned int i = 0; i < 32; ++i)
+				void ComputeQuadrics()
+				{
+					m_quadrics.resize(m_positions.size());
+					for (std::size_t i = 0; i < m_indices.size(); i += 3)
 					{
-						int ind = m_vertexCache.GetVertex(i);
-						if (ind < 0)
+						UInt32 a = m_positionRemap[m_indices[i + 0]];
+						UInt32 b = m_positionRemap[m_indices[i + 1]];
+						UInt32 c = m_positionRemap[m_indices[i + 2]];
+
+						Vector3f normal = (m_positions[b] - m_positions[a]).CrossProduct(m_positions[c] - m_positions[a]);
+						float area = normal.GetLength();
+						if (area <= 0.f)
 							continue;
 
-						m_vertices[ind].positionInCache = i;
+						normal /= area;
+
+						Quadric quadric;
+						quadric.AddPlane(normal, -normal.DotProduct(m_positions[a]), area);
+
+						m_quadrics[a] += quadric;
+						m_quadrics[b] += quadric;
+						m_quadrics[c] += quadric;
 					}
 				}
 
-				// Optimization: to avoid duplicate calculations during the same iteration,
-				// both vertices and triangles have a 'calculated' flag. This flag
-				// must be cleared at the beginning of the iteration to all *active* triangles
-				// that have one or more of their vertices currently cached, and all their
-				// other vertices.
-				// If there aren't any active triangles in the cache, the function returns
-				// false and full recalculation is performed.
-				bool CleanCalculationFlags()
+				std::span<const UInt32> GetAdjacentTriangles(UInt32 vertex) const
 				{
-					bool ret = false;
-					for (unsigned int i = 0; i < 32; ++i)
+					return std::span<const UInt32>(&m_adjacency[m_adjacencyOffsets[vertex]], m_adjacencyOffsets[vertex + 1] - m_adjacencyOffsets[vertex]);
+				}
+
+				bool HasTriangleFlip(UInt32 from, UInt32 to) const
+				{
+					for (UInt32 triangle : GetAdjacentTriangles(from))
 					{
-						int vert = m_vertexCache.GetVertex(i);
-						if (vert < 0)
+						std::array<UInt32, 3> vertices;
+						for (std::size_t i = 0; i < 3; ++i)
+							vertices[i] = m_positionRemap[m_indices[triangle * 3 + i]];
+
+						// This triangle will be removed by the collapse
+						if (vertices[0] == to || vertices[1] == to || vertices[2] == to)
 							continue;
 
-						VertexCacheData *v = &m_vertices[vert];
+						std::array<Vector3f, 3> positions;
+						for (std::size_t i = 0; i < 3; ++i)
+							positions[i] = m_positions[vertices[i]];
 
-						for (int triIndex = 0; triIndex < v->remainingValence; triIndex++)
+						Vector3f oldNormal = (positions[1] - positions[0]).CrossProduct(positions[2] - positions[0]);
+
+						for (std::size_t i = 0; i < 3; ++i)
 						{
-							TriangleCacheData* t = &m_triangles[v->triIndices[triIndex]];
+							if (vertices[i] == from)
+								positions[i] = m_positions[to];
+						}
+
+						Vector3f newNormal = (positions[1] - positions[0]).CrossProduct(positions[2] - positions[0]);
+						if (oldNormal.DotProduct(newNormal) <= 0.f)
+							return true;
+					}
+
+					return false;
+				}
 
-							// we actually found a triangle to process
-							ret = true;
+				void LockBorderAndSeamVertices()
+				{
+					m_locked.assign(m_positions.size(), false);
+
+					// Vertices with multiple attributes sets for the same position can't be collapsed without breaking the seam
+					std::vector<UInt32> firstVertex(m_positions.size(), std::numeric_limits<UInt32>::max());
+					for (UInt32 index : m_indices)
+					{
+						UInt32& first = firstVertex[m_positionRemap[index]];
+						if (first == std::numeric_limits<UInt32>::max())
+							first = index;
+						else if (first != index)
+							m_locked[m_positionRemap[index]] = true;
+					}
 
-							// clear triangle flag
-							t->calculated = false;
+					// Border (and non-manifold) edges aren't shared by exactly two triangles, their vertices are locked to preserve the mesh outline
+					std::unordered_map<UInt64, UInt32> edgeUsage;
+					edgeUsage.reserve(m_indices.size());
+					for (std::size_t i = 0; i < m_indices.size(); i += 3)
+					{
+						for (std::size_t j = 0; j < 3; ++j)
+						{
+							UInt32 a = m_positionRemap[m_indices[i + j]];
+							UInt32 b = m_positionRemap[m_indices[i + (j + 1) % 3]];
+							if (a > b)
+								std::swap(a, b);
 
-							// clear vertex flags
-							for (int vertIndex : t->verts)
-								m_vertices[vertIndex].calculated = false;
+							edgeUsage[UInt64(a) << 32 | b]++;
 						}
 					}
 
-					return ret;
+					for (auto&& [edge, usage] : edgeUsage)
+					{
+						if (usage != 2)
+						{
+							m_locked[UInt32(edge >> 32)] = true;
+							m_locked[UInt32(edge & 0xFFFFFFFF)] = true;
+						}
+					}
 				}
 
-				void TriangleScoreRecalculation(int tri)
-				{
-					TriangleCacheData* t = &m_triangles[tri];
+				std::vector<bool> m_collapseLocked;
+				std::vector<bool> m_locked;
+				std::vector<EdgeCollapse> m_collapses;
+				std::vector<Quadric> m_quadrics;
+				std::vector<UInt32> m_adjacency;
+				std::vector<UInt32> m_adjacencyCursors;
+				std::vector<UInt32> m_adjacencyOffsets;
+				std::vector<UInt32> m_collapseRemap;
+				std::vector<UInt32> m_indices;
+				std::vector<UInt32> m_positionRemap;
+				std::vector<Vector3f> m_positions;
+		};
+
+		/************************************Skin***********************************/
+
+		// Ranges smaller than this won't be split between workers
+		constexpr UInt32 SkinningMinVertexPerTask = 2048;
 
-					// calculate vertex scores
-					float sum = 0.f;
-					for (int vert : t->verts)
+		struct SkinningMatrix
+		{
+			// Row-major 3x4 matrix, the last column holds the translation
+			alignas(16) float rows[3][4];
+
+			static SkinningMatrix FromMatrix(const Matrix4f& matrix)
+			{
+				// Matrix4 transforms row vectors, transpose it
+				return SkinningMatrix{
 					{
-						VertexCacheData& v = m_vertices[vert];
-						float sc = v.score;
-						if (!v.calculated)
-							sc = CalculateVertexScore(v);
-
-						v.score = sc;
-						v.calculated = true;
-						sum += sc;
+						{ matrix.m11, matrix.m21, matrix.m31, matrix.m41 },
+						{ matrix.m12, matrix.m22, matrix.m32, matrix.m42 },
+						{ matrix.m13, matrix.m23, matrix.m33, matrix.m43 }
 					}
+				};
+			}
+		};
+
+		struct SkinningDualQuaternion
+		{
+			// Stored as (x, y, z, w) to make blending easier
+			Vector4f real;
+			Vector4f dual;
+
+			static SkinningDualQuaternion FromMatrix(const Matrix4f& matrix)
+			{
+				// Dual quaternions can only represent rigid transformations, scale is ignored
+				Quaternionf rotation = matrix.GetRotation();
+				rotation.Normalize();
+
+				Vector3f translation = matrix.GetTranslation();
+				Vector3f rotationAxis(rotation.x, rotation.y, rotation.z);
+				Vector3f dualAxis = 0.5f * (rotation.w * translation + translation.CrossProduct(rotationAxis));
+
+				SkinningDualQuaternion dualQuaternion;
+				dualQuaternion.real = Vector4f(rotation.x, rotation.y, rotation.z, rotation.w);
+				dualQuaternion.dual = Vector4f(dualAxis.x, dualAxis.y, dualAxis.z, -0.5f * translation.DotProduct(rotationAxis));
+
+				return dualQuaternion;
+			}
+		};
+
+		void CopySkinningUv(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+		{
+			if (!skinningInfos.outputUv)
+				return;
+
+			NazaraAssert(skinningInfos.inputUv, "missing input uv");
+
+			UInt32 endVertex = startVertex + vertexCount;
+			for (UInt32 i = startVertex; i < endVertex; ++i)
+				skinningInfos.outputUv[i] = skinningInfos.inputUv[i];
+		}
+
+		template<typename F>
+		void DispatchSkinning(UInt32 startVertex, UInt32 vertexCount, TaskScheduler* taskScheduler, const F& func)
+		{
+			if (!taskScheduler)
+			{
+				func(startVertex, startVertex + vertexCount);
+				return;
+			}
+
+			taskScheduler->ParallelForRange(vertexCount, SkinningMinVertexPerTask, [&](std::size_t firstVertex, std::size_t lastVertex)
+			{
+				func(startVertex + static_cast<UInt32>(firstVertex), startVertex + static_cast<UInt32>(lastVertex));
+			});
+		}
+
+		UInt32 GetSkinningJointCount(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+		{
+			if (skinningInfos.jointCount > 0)
+				return skinningInfos.jointCount;
+
+			Int32 maxJointIndex = 0;
 
-					t->current_score = sum;
-					t->calculated = true;
+			UInt32 endVertex = startVertex + vertexCount;
+			for (UInt32 i = startVertex; i < endVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				maxJointIndex = std::max({ maxJointIndex, jointIndices.x, jointIndices.y, jointIndices.z, jointIndices.w });
+			}
+
+			return static_cast<UInt32>(maxJointIndex) + 1;
+		}
+
+		void SkinDualQuaternionRange(const SkinningData& skinningInfos, const SkinningDualQuaternion* dualQuaternions, UInt32 firstVertex, UInt32 lastVertex)
+		{
+			bool hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
+			bool hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
+			bool hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
+
+			for (UInt32 i = firstVertex; i < lastVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+				// Make sure we blend every quaternion in the same hemisphere as the first one (shortest path)
+				const Vector4f& pivot = dualQuaternions[jointIndices[0]].real;
+
+				Vector4f real = Vector4f::Zero();
+				Vector4f dual = Vector4f::Zero();
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					const SkinningDualQuaternion& dualQuaternion = dualQuaternions[jointIndices[j]];
+
+					float weight = jointWeights[j];
+					if (dualQuaternion.real.DotProduct(pivot) < 0.f)
+						weight = -weight;
+
+					real += dualQuaternion.real * weight;
+					dual += dualQuaternion.dual * weight;
 				}
 
-				int PartialScoreRecalculation()
+				float invLength = 1.f / std::sqrt(real.DotProduct(real));
+				real *= invLength;
+				dual *= invLength;
+
+				Vector3f realAxis(real.x, real.y, real.z);
+				auto Rotate = [&](const Vector3f& vec)
 				{
-					// iterate through all the vertices of the cache
-					float maxScore = std::numeric_limits<float>::lowest();
-					int maxScoreTri = -1;
+					Vector3f t = 2.f * realAxis.CrossProduct(vec);
+					return vec + real.w * t + realAxis.CrossProduct(t);
+				};
 
-					for (unsigned int i = 0; i < 32; ++i)
-					{
-						int vert = m_vertexCache.GetVertex(i);
-						if (vert < 0)
-							continue;
+				if (hasPositions)
+				{
+					Vector3f dualAxis(dual.x, dual.y, dual.z);
+					Vector3f translation = 2.f * (real.w * dualAxis - dual.w * realAxis + realAxis.CrossProduct(dualAxis));
 
-						const VertexCacheData* v = &m_vertices[vert];
+					skinningInfos.outputPositions[i] = Rotate(skinningInfos.inputPositions[i]) + translation;
+				}
 
-						// iterate through all *active* triangles of this vertex
-						for (int j = 0; j < v->remainingValence; j++)
-						{
-							int tri = v->triIndices[j];
-							TriangleCacheData* t = &m_triangles[tri];
-							if (!t->calculated)
-								// calculate triangle score
-								TriangleScoreRecalculation(tri);
+				if (hasNormals)
+					skinningInfos.outputNormals[i] = Rotate(skinningInfos.inputNormals[i]).GetNormal();
 
-							float sc = t->current_score;
+				if (hasTangents)
+					skinningInfos.outputTangents[i] = Rotate(skinningInfos.inputTangents[i]).GetNormal();
+			}
+		}
 
-							// we actually found a triangle to process
-							if (sc > maxScore)
-							{
-								maxScore = sc;
-								maxScoreTri = tri;
-							}
-						}
-					}
+		template<bool HasPositions, bool HasNormals, bool HasTangents>
+		void SkinLinearBlendRange(const SkinningData& skinningInfos, const SkinningMatrix* matrices, UInt32 firstVertex, UInt32 lastVertex)
+		{
+			for (UInt32 i = firstVertex; i < lastVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+#ifdef NAZARA_ARCH_x86_64
+				// Blend the four joint matrices one row at a time (SSE2 is always available on x86_64)
+				__m128 row0 = _mm_setzero_ps();
+				__m128 row1 = _mm_setzero_ps();
+				__m128 row2 = _mm_setzero_ps();
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					const SkinningMatrix& matrix = matrices[jointIndices[j]];
+					__m128 weight = _mm_set1_ps(jointWeights[j]);
 
-					return maxScoreTri;
+					row0 = _mm_add_ps(row0, _mm_mul_ps(_mm_load_ps(matrix.rows[0]), weight));
+					row1 = _mm_add_ps(row1, _mm_mul_ps(_mm_load_ps(matrix.rows[1]), weight));
+					row2 = _mm_add_ps(row2, _mm_mul_ps(_mm_load_ps(matrix.rows[2]), weight));
 				}
 
-				// returns true while there are more steps to take
-				// false when optimization is complete
-				bool Iterate()
+				// Transpose to get the X, Y and Z basis vectors and the translation
+				__m128 row3 = _mm_setzero_ps();
+				_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+				auto Transform = [&](const Vector3f& vec, bool translate)
 				{
-					if (m_drawList.size() == m_triangles.size())
-						return false;
+					__m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(row0, _mm_set1_ps(vec.x)), _mm_mul_ps(row1, _mm_set1_ps(vec.y))), _mm_mul_ps(row2, _mm_set1_ps(vec.z)));
+					if (translate)
+						result = _mm_add_ps(result, row3);
 
-					// add the selected triangle to the draw list
-					AddTriangleToDrawList(m_bestTri);
+					alignas(16) float values[4];
+					_mm_store_ps(values, result);
 
-					// recalculate vertex and triangle scores and
-					// select the best triangle for the next iteration
-					m_bestTri = (CleanCalculationFlags()) ? PartialScoreRecalculation() : FullScoreRecalculation();
+					return Vector3f(values[0], values[1], values[2]);
+				};
+#else
+				SkinningMatrix blendedMatrix = {};
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					const SkinningMatrix& matrix = matrices[jointIndices[j]];
+					float weight = jointWeights[j];
 
-					return true;
+					for (std::size_t row = 0; row < 3; ++row)
+					{
+						for (std::size_t column = 0; column < 4; ++column)
+							blendedMatrix.rows[row][column] += matrix.rows[row][column] * weight;
+					}
 				}
 
-				std::vector<VertexCacheData> m_vertices;
-				std::vector<TriangleCacheData> m_triangles;
-				std::vector<UInt32> m_indices;
-				std::vector<int> m_drawList;
-				VertexCache m_vertexCache;
-				int m_bestTri; // the next triangle to add to the render list
-
-				// CalculateVertexScore constants
-				float m_cacheDecayPower;
-				float m_lastTriScore;
-				float m_valenceBoostScale;
-				float m_valenceBoostPower;
-		};
+				auto Transform = [&](const Vector3f& vec, bool translate)
+				{
+					float w = (translate) ? 1.f : 0.f;
+
+					const auto& rows = blendedMatrix.rows;
+					return Vector3f(rows[0][0] * vec.x + rows[0][1] * vec.y + rows[0][2] * vec.z + rows[0][3] * w,
+					                rows[1][0] * vec.x + rows[1][1] * vec.y + rows[1][2] * vec.z + rows[1][3] * w,
+					                rows[2][0] * vec.x + rows[2][1] * vec.y + rows[2][2] * vec.z + rows[2][3] * w);
+				};
+#endif
+
+				if constexpr (HasPositions)
+					skinningInfos.outputPositions[i] = Transform(skinningInfos.inputPositions[i], true);
+
+				if constexpr (HasNormals)
+					skinningInfos.outputNormals[i] = Transform(skinningInfos.inputNormals[i], false).GetNormal();
+
+				if constexpr (HasTangents)
+					skinningInfos.outputTangents[i] = Transform(skinningInfos.inputTangents[i], false).GetNormal();
+			}
+		}
+
+		/*******************************Quantization********************************/
+
+		constexpr float SNorm16Max = 32767.f;
+
+		float DequantizeSNorm16(Int16 value)
+		{
+			// Matches the GPU conversion of normalized formats (-32768 and -32767 both map to -1)
+			return std::max(value / SNorm16Max, -1.f);
+		}
+
+		Int16 QuantizeSNorm16(float value)
+		{
+			value = std::clamp(value, -1.f, 1.f) * SNorm16Max;
+			return static_cast<Int16>((value >= 0.f) ? value + 0.5f : value - 0.5f);
+		}
 	}
 
 	/**********************************Compute**********************************/
@@ -665,12 +1312,28 @@ namespace Nz
 			*vertexCount = xVertexCount*2 + yVertexCount*2 + zVertexCount*2;
 	}
 
-	UInt32 ComputeCacheMissCount(IndexIterator indices, UInt32 indexCount)
+	UInt32 ComputeCacheMissCount(IndexIterator indices, UInt32 indexCount, float* acmr, float* atvr)
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
 
 		VertexCache cache(indices, indexCount);
-		return cache.GetMissCount();
+		UInt32 missCount = cache.GetMissCount();
+
+		// Average cache miss ratio (transformed vertices per triangle)
+		if (acmr)
+			*acmr = (indexCount >= 3) ? float(missCount) / float(indexCount / 3) : 0.f;
+
+		// Average transform to vertex ratio (1.0 being the optimum)
+		if (atvr)
+		{
+			std::vector<UInt32> indexData = CopyIndices(indices, indexCount, nullptr);
+			std::sort(indexData.begin(), indexData.end());
+			std::size_t uniqueVertexCount = std::unique(indexData.begin(), indexData.end()) - indexData.begin();
+
+			*atvr = (uniqueVertexCount > 0) ? float(missCount) / float(uniqueVertexCount) : 0.f;
+		}
+
+		return missCount;
 	}
 
 	void ComputeConeIndexVertexCount(unsigned int subdivision, UInt32* indexCount, UInt32* vertexCount)
@@ -720,6 +1383,16 @@ namespace Nz
 			*vertexCount = horizontalVertexCount*verticalVertexCount;
 	}
 
+	PositionQuantization ComputePositionQuantization(const Boxf& aabb)
+	{
+		PositionQuantization quantization;
+		quantization.offset = aabb.GetCenter();
+		// Flat axes keep a non-zero scale so quantizing never divides by zero
+		quantization.scale = Vector3f::Max(aabb.GetLengths() * 0.5f, Vector3f(std::numeric_limits<float>::min()));
+
+		return quantization;
+	}
+
 	void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, UInt32* indexCount, UInt32* vertexCount)
 	{
 		if (indexCount)
@@ -1057,77 +1730,311 @@ namespace Nz
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
 
+		NazaraAssert(indexCount % 3 == 0, "index count must be a multiple of 3");
+
+		UInt32 vertexCount;
+		std::vector<UInt32> indexData = CopyIndices(indices, indexCount, &vertexCount);
+
 		VertexCacheOptimizer optimizer;
-		if (optimizer.Optimize(indices, indexCount) != VertexCacheOptimizer::Success)
-			NazaraWarning("Indices optimizer failed");
+		optimizer.Optimize(indexData.data(), indexData.size(), vertexCount);
+
+		WriteIndices(indices, indexData);
+	}
+
+	void OptimizeOverdraw(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positions, float threshold)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(indexCount % 3 == 0, "index count must be a multiple of 3");
+		NazaraAssert(positions, "invalid positions");
+
+		UInt32 vertexCount;
+		std::vector<UInt32> indexData = CopyIndices(indices, indexCount, &vertexCount);
+
+		OverdrawOptimizer optimizer;
+		optimizer.Optimize(indexData.data(), indexData.size(), positions, vertexCount, threshold);
+
+		WriteIndices(indices, indexData);
+	}
+
+	UInt32 OptimizeVertexFetch(IndexIterator indices, UInt32 indexCount, UInt32 vertexCount, UInt32* remap)
+	{
+		NazaraAssert(remap, "invalid remap table");
+
+		constexpr UInt32 InvalidIndex = std::numeric_limits<UInt32>::max();
+		std::fill(remap, remap + vertexCount, InvalidIndex);
+
+		// Vertices are renumbered by order of first use
+		UInt32 nextVertex = 0;
+		for (UInt32 i = 0; i < indexCount; ++i)
+		{
+			IndexIterator::Reference index = indices[i];
+
+			UInt32 vertex = index;
+			NazaraAssert(vertex < vertexCount, "index out of range");
+
+			if (remap[vertex] == InvalidIndex)
+				remap[vertex] = nextVertex++;
+
+			index = remap[vertex];
+		}
+
+		UInt32 usedVertexCount = nextVertex;
+
+		// Unused vertices are moved at the end
+		for (UInt32 i = 0; i < vertexCount; ++i)
+		{
+			if (remap[i] == InvalidIndex)
+				remap[i] = nextVertex++;
+		}
+
+		return usedVertexCount;
+	}
+
+	/*********************************Quantize**********************************/
+
+	Vector3f DecodeOctahedral(const Vector2i16& encodedVector)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		Vector3f vector;
+		vector.x = DequantizeSNorm16(encodedVector.x);
+		vector.y = DequantizeSNorm16(encodedVector.y);
+		vector.z = 1.f - std::abs(vector.x) - std::abs(vector.y);
+
+		// Unfold the lower hemisphere (must stay in sync with the Math.Octahedral shader module)
+		float t = std::max(-vector.z, 0.f);
+		vector.x += (vector.x >= 0.f) ? -t : t;
+		vector.y += (vector.y >= 0.f) ? -t : t;
+
+		return vector.GetNormal();
+	}
+
+	void DequantizeNormals(SparsePtr<const Vector2i16> normals, UInt32 vertexCount, SparsePtr<Vector3f> output)
+	{
+		for (UInt32 i = 0; i < vertexCount; ++i)
+			*output++ = DecodeOctahedral(*normals++);
+	}
+
+	void DequantizePositions(SparsePtr<const Vector4i16> positions, UInt32 vertexCount, const PositionQuantization& quantization, SparsePtr<Vector3f> output)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		for (UInt32 i = 0; i < vertexCount; ++i)
+		{
+			const Vector4i16& position = *positions++;
+			*output++ = quantization.offset + Vector3f(DequantizeSNorm16(position.x), DequantizeSNorm16(position.y), DequantizeSNorm16(position.z)) * quantization.scale;
+		}
+	}
+
+	void DequantizeTexCoords(SparsePtr<const Vector2ui16> texCoords, UInt32 vertexCount, SparsePtr<Vector2f> output)
+	{
+		for (UInt32 i = 0; i < vertexCount; ++i)
+		{
+			const Vector2ui16& texCoord = *texCoords++;
+			*output++ = Vector2f(HalfToFloat(texCoord.x), HalfToFloat(texCoord.y));
+		}
+	}
+
+	Vector2i16 EncodeOctahedral(const Vector3f& vector)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		float l1Norm = std::abs(vector.x) + std::abs(vector.y) + std::abs(vector.z);
+		if (l1Norm <= 0.f)
+			return Vector2i16(0, 0);
+
+		// Project the vector on the octahedron, and fold its lower hemisphere over the upper one
+		float x = vector.x / l1Norm;
+		float y = vector.y / l1Norm;
+		if (vector.z < 0.f)
+		{
+			float foldedX = (1.f - std::abs(y)) * ((x >= 0.f) ? 1.f : -1.f);
+			float foldedY = (1.f - std::abs(x)) * ((y >= 0.f) ? 1.f : -1.f);
+			x = foldedX;
+			y = foldedY;
+		}
+
+		return Vector2i16(QuantizeSNorm16(x), QuantizeSNorm16(y));
+	}
+
+	UInt16 FloatToHalf(float value)
+	{
+		// Rounds to nearest even, see https://gist.github.com/rygorous/2156668
+		UInt32 bits = BitCast<UInt32>(value);
+		UInt32 sign = (bits >> 16) & 0x8000;
+		bits &= 0x7FFFFFFF;
+
+		UInt32 result;
+		if (bits >= 0x47800000) //< too large for a half (or Inf/NaN)
+			result = (bits > 0x7F800000) ? 0x7E00 : 0x7C00;
+		else if (bits < 0x38800000) //< subnormal half (or zero), let the FPU round the mantissa
+			result = BitCast<UInt32>(BitCast<float>(bits) + 0.5f) - 0x3F000000;
+		else
+		{
+			UInt32 mantissaOdd = (bits >> 13) & 1;
+			bits += 0xC8000FFF; //< rebias exponent ((15 - 127) << 23) and round
+			bits += mantissaOdd;
+			result = bits >> 13;
+		}
+
+		return static_cast<UInt16>(result | sign);
+	}
+
+	float HalfToFloat(UInt16 value)
+	{
+		constexpr UInt32 shiftedExponent = 0x7C00 << 13;
+
+		UInt32 bits = UInt32(value & 0x7FFF) << 13;
+		UInt32 exponent = bits & shiftedExponent;
+		bits += (127 - 15) << 23;
+
+		if (exponent == shiftedExponent) //< Inf/NaN
+			bits += (128 - 16) << 23;
+		else if (exponent == 0) //< zero/subnormal, renormalize
+		{
+			bits += 1 << 23;
+			bits = BitCast<UInt32>(BitCast<float>(bits) - BitCast<float>(UInt32(113 << 23)));
+		}
+
+		bits |= UInt32(value & 0x8000) << 16;
+		return BitCast<float>(bits);
+	}
+
+	void QuantizeNormals(SparsePtr<const Vector3f> normals, UInt32 vertexCount, SparsePtr<Vector2i16> output)
+	{
+		for (UInt32 i = 0; i < vertexCount; ++i)
+			*output++ = EncodeOctahedral(*normals++);
+	}
+
+	void QuantizePositions(SparsePtr<const Vector3f> positions, UInt32 vertexCount, const PositionQuantization& quantization, SparsePtr<Vector4i16> output)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		Vector3f invScale = Vector3f(1.f) / quantization.scale;
+		for (UInt32 i = 0; i < vertexCount; ++i)
+		{
+			Vector3f position = (*positions++ - quantization.offset) * invScale;
+			// w is set to 1 so the attribute can also be read as an homogeneous position
+			*output++ = Vector4i16(QuantizeSNorm16(position.x), QuantizeSNorm16(position.y), QuantizeSNorm16(position.z), Int16(SNorm16Max));
+		}
+	}
+
+	void QuantizeTexCoords(SparsePtr<const Vector2f> texCoords, UInt32 vertexCount, SparsePtr<Vector2ui16> output)
+	{
+		for (UInt32 i = 0; i < vertexCount; ++i)
+		{
+			const Vector2f& texCoord = *texCoords++;
+			*output++ = Vector2ui16(FloatToHalf(texCoord.x), FloatToHalf(texCoord.y));
+		}
+	}
+
+	/*********************************Simplify**********************************/
+
+	UInt32 SimplifyIndices(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positions, UInt32 vertexCount, UInt32 targetIndexCount, float targetError, UInt32* destination, float* resultError)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(indexCount % 3 == 0, "index count must be a multiple of 3");
+		NazaraAssert(positions, "invalid positions");
+		NazaraAssert(destination, "invalid destination");
+
+		MeshSimplifier simplifier(CopyIndices(indices, indexCount, nullptr), positions, vertexCount);
+		std::size_t simplifiedIndexCount = simplifier.Simplify(targetIndexCount, targetError, resultError);
+
+		const std::vector<UInt32>& simplifiedIndices = simplifier.GetIndices();
+		std::copy(simplifiedIndices.begin(), simplifiedIndices.end(), destination);
+
+		return SafeCast<UInt32>(simplifiedIndexCount);
 	}
 
 	/************************************Skin***********************************/
 
-	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	void SkinDualQuaternionBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount, TaskScheduler* taskScheduler)
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
 		NazaraAssert(skinningInfos.inputJointIndices, "missing input joint indices");
 		NazaraAssert(skinningInfos.inputJointWeights, "missing input joint weights");
 
-		UInt32 endVertex = startVertex + vertexCount - 1;
+		if (vertexCount == 0)
+			return;
+
 		if (skinningInfos.outputPositions || skinningInfos.outputNormals || skinningInfos.outputTangents)
 		{
 			NazaraAssert(skinningInfos.joints, "missing skeleton joints");
+			NazaraAssert(!skinningInfos.outputPositions || skinningInfos.inputPositions, "missing input positions");
+			NazaraAssert(!skinningInfos.outputNormals || skinningInfos.inputNormals, "missing input normals");
+			NazaraAssert(!skinningInfos.outputTangents || skinningInfos.inputTangents, "missing input tangents");
 
-			if (skinningInfos.outputPositions)
-				NazaraAssert(skinningInfos.inputPositions, "missing input positions");
-
-			if (skinningInfos.outputNormals)
-				NazaraAssert(skinningInfos.inputNormals, "missing input positions");
+			// Joint skinning matrices are lazily computed and can't be queried from multiple threads, convert them once here
+			UInt32 jointCount = GetSkinningJointCount(skinningInfos, startVertex, vertexCount);
 
-			if (skinningInfos.outputTangents)
-				NazaraAssert(skinningInfos.inputTangents, "missing input positions");
+			std::vector<SkinningDualQuaternion> dualQuaternions(jointCount);
+			for (UInt32 i = 0; i < jointCount; ++i)
+				dualQuaternions[i] = SkinningDualQuaternion::FromMatrix(skinningInfos.joints[i].GetSkinningMatrix());
 
-			bool hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
-			bool hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
-			bool hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
-
-			for (UInt32 i = startVertex; i <= endVertex; ++i)
+			DispatchSkinning(startVertex, vertexCount, taskScheduler, [&](UInt32 firstVertex, UInt32 lastVertex)
 			{
-				Vector3f finalPosition = Vector3f::Zero();
-				Vector3f finalNormal = Vector3f::Zero();
-				Vector3f finalTangent = Vector3f::Zero();
+				SkinDualQuaternionRange(skinningInfos, dualQuaternions.data(), firstVertex, lastVertex);
+			});
+		}
 
-				for (Int32 j = 0; j < 4; ++j)
-				{
-					Int32 jointIndex = skinningInfos.inputJointIndices[i][j];
+		CopySkinningUv(skinningInfos, startVertex, vertexCount);
+	}
 
-					Matrix4f mat = skinningInfos.joints[jointIndex].GetSkinningMatrix();
-					mat *= skinningInfos.inputJointWeights[i][j];
+	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount, TaskScheduler* taskScheduler)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-					// Hopefully the branch predictor will help here
-					if (hasPositions)
-						finalPosition += mat.Transform(skinningInfos.inputPositions[i]);
+		NazaraAssert(skinningInfos.inputJointIndices, "missing input joint indices");
+		NazaraAssert(skinningInfos.inputJointWeights, "missing input joint weights");
 
-					if (hasNormals)
-						finalNormal += mat.Transform(skinningInfos.inputNormals[i], 0.f);
+		if (vertexCount == 0)
+			return;
 
-					if (hasTangents)
-						finalTangent += mat.Transform(skinningInfos.inputTangents[i], 0.f);
-				}
+		if (skinningInfos.outputPositions || skinningInfos.outputNormals || skinningInfos.outputTangents)
+		{
+			NazaraAssert(skinningInfos.joints, "missing skeleton joints");
+			NazaraAssert(!skinningInfos.outputPositions || skinningInfos.inputPositions, "missing input positions");
+			NazaraAssert(!skinningInfos.outputNormals || skinningInfos.inputNormals, "missing input normals");
+			NazaraAssert(!skinningInfos.outputTangents || skinningInfos.inputTangents, "missing input tangents");
 
-				if (hasPositions)
-					skinningInfos.outputPositions[i] = finalPosition;
+			// Joint skinning matrices are lazily computed and can't be queried from multiple threads, convert them once here
+			UInt32 jointCount = GetSkinningJointCount(skinningInfos, startVertex, vertexCount);
 
-				if (hasNormals)
-					skinningInfos.outputNormals[i] = finalNormal.GetNormal();
+			std::vector<SkinningMatrix> matrices(jointCount);
+			for (UInt32 i = 0; i < jointCount; ++i)
+				matrices[i] = SkinningMatrix::FromMatrix(skinningInfos.joints[i].GetSkinningMatrix());
 
-				if (hasTangents)
-					skinningInfos.outputTangents[i] = finalTangent.GetNormal();
+			bool hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
+			bool hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
+			bool hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
+
+			using SkinFunc = void(*)(const SkinningData& skinningInfos, const SkinningMatrix* matrices, UInt32 firstVertex, UInt32 lastVertex);
+
+			// Select a specialized kernel to get rid of per-vertex branches
+			constexpr std::array<SkinFunc, 8> kernels = {
+				nullptr,
+				&SkinLinearBlendRange<true,  false, false>,
+				&SkinLinearBlendRange<false, true,  false>,
+				&SkinLinearBlendRange<true,  true,  false>,
+				&SkinLinearBlendRange<false, false, true>,
+				&SkinLinearBlendRange<true,  false, true>,
+				&SkinLinearBlendRange<false, true,  true>,
+				&SkinLinearBlendRange<true,  true,  true>
+			};
+
+			SkinFunc kernel = kernels[(hasPositions ? 1 : 0) | (hasNormals ? 2 : 0) | (hasTangents ? 4 : 0)];
+			if (kernel)
+			{
+				DispatchSkinning(startVertex, vertexCount, taskScheduler, [&](UInt32 firstVertex, UInt32 lastVertex)
+				{
+					kernel(skinningInfos, matrices.data(), firstVertex, lastVertex);
+				});
 			}
 		}
 
-		if (skinningInfos.outputUv)
-		{
-			NazaraAssert(skinningInfos.inputUv, "missing input uv");
-
-			for (UInt64 i = startVertex; i <= endVertex; ++i)
-				skinningInfos.outputUv[i] = skinningInfos.inputUv[i];
-		}
+		CopySkinningUv(skinningInfos, startVertex, vertexCount);
 	}
 }
@@ -0,0 +1,1753 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/BlockCompression.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#ifdef NAZARA_ARCH_x86_64
+#include <emmintrin.h>
+#endif
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// BC7 two-subset partitions (bit i is set when texel i belongs to the second subset)
+		constexpr std::array<UInt16, 64> s_bc7PartitionMasks = {
+			0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+			0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+			0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+			0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+			0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+			0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+			0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+			0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+		};
+
+		// BC7 three-subset partitions (two bits per texel, texel 0 in the least significant bits)
+		constexpr std::array<UInt32, 64> s_bc7Partition3Masks = {
+			0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+			0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+			0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+			0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+			0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+			0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+			0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+			0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254
+		};
+
+		// Index of the texel of the second subset whose index is stored with one less bit
+		constexpr std::array<UInt8, 64> s_bc7AnchorIndices = {
+			15, 15, 15, 15, 15, 15, 15, 15,
+			15, 15, 15, 15, 15, 15, 15, 15,
+			15,  2,  8,  2,  2,  8,  8, 15,
+			 2,  8,  2,  2,  8,  8,  2,  2,
+			15, 15,  6,  8,  2,  8, 15, 15,
+			 2,  8,  2,  2,  2, 15, 15,  6,
+			 6,  2,  6,  8, 15, 15,  2,  2,
+			15, 15, 15, 15, 15,  2,  2, 15
+		};
+
+		// Anchor texels of the second and third subsets of three-subset partitions
+		constexpr std::array<UInt8, 64> s_bc7Partition3SecondAnchorIndices = {
+			 3,  3, 15, 15,  8,  3, 15, 15,
+			 8,  8,  6,  6,  6,  5,  3,  3,
+			 3,  3,  8, 15,  3,  3,  6, 10,
+			 5,  8,  8,  6,  8,  5, 15, 15,
+			 8, 15,  3,  5,  6, 10,  8, 15,
+			15,  3, 15,  5, 15, 15, 15, 15,
+			 3, 15,  5,  5,  5,  8,  5, 10,
+			 5, 10,  8, 13, 15, 12,  3,  3
+		};
+
+		constexpr std::array<UInt8, 64> s_bc7Partition3ThirdAnchorIndices = {
+			15,  8,  8,  3, 15, 15,  3,  8,
+			15, 15, 15, 15, 15, 15, 15,  8,
+			15,  8, 15,  3, 15,  8, 15,  8,
+			 3, 15,  6, 10, 15, 15, 10,  8,
+			15,  3, 15, 10, 10,  8,  9, 10,
+			 6, 15,  8, 15,  3,  6,  6,  8,
+			15,  3, 15, 15, 15, 15, 15, 15,
+			15, 15, 15, 15,  3, 15, 15,  8
+		};
+
+		constexpr std::array<UInt32, 4> s_weights2 = { 0, 21, 43, 64 };
+		constexpr std::array<UInt32, 8> s_weights3 = { 0, 9, 18, 27, 37, 46, 55, 64 };
+		constexpr std::array<UInt32, 16> s_weights4 = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		// Interpolation factors toward the second endpoint, per index
+		constexpr std::array<float, 4> s_bc1Weights3 = { 0.f, 1.f, 0.5f, 0.f };
+		constexpr std::array<float, 4> s_bc1Weights4 = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+
+		struct BC7ModeInfo
+		{
+			UInt8 subsetCount;
+			UInt8 partitionBits;
+			UInt8 rotationBits;
+			UInt8 indexSelectionBits;
+			UInt8 colorBits;
+			UInt8 alphaBits;
+			UInt8 endpointPBits;
+			UInt8 sharedPBits;
+			UInt8 indexBits;
+			UInt8 secondaryIndexBits;
+		};
+
+		constexpr std::array<BC7ModeInfo, 8> s_bc7Modes = { {
+			{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+			{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+			{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+			{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+			{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+			{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+			{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+			{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 }
+		} };
+
+		// Endpoint component (endpoint * 3 + channel) of a BC6H header field
+		enum BC6HValue : UInt8
+		{
+			Rw, Gw, Bw,
+			Rx, Gx, Bx,
+			Ry, Gy, By,
+			Rz, Gz, Bz
+		};
+
+		struct BC6HField
+		{
+			BC6HValue value;
+			UInt8 firstBit;
+			UInt8 bitCount;
+			bool isReversed = false; //< bits are stored from the most significant one
+		};
+
+		struct BC6HModeInfo
+		{
+			UInt8 mode;
+			UInt8 regionCount;
+			bool isTransformed;
+			UInt8 endpointBits;
+			std::array<UInt8, 3> deltaBits;
+			UInt8 fieldCount;
+			std::array<BC6HField, 23> fields;
+		};
+
+		// Header layout of each BC6H mode, following the mode bits (two regions modes are followed by the partition index)
+		constexpr std::array<BC6HModeInfo, 14> s_bc6hModes = { {
+			{ 0x00, 2, true, 10, { 5, 5, 5 }, 19, { {
+				{ Gy, 4, 1 }, { By, 4, 1 }, { Bz, 4, 1 }, { Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 5 }, { Gz, 4, 1 }, { Gy, 0, 4 }, { Gx, 0, 5 },
+				{ Bz, 0, 1 }, { Gz, 0, 4 }, { Bx, 0, 5 }, { Bz, 1, 1 }, { By, 0, 4 }, { Ry, 0, 5 }, { Bz, 2, 1 }, { Rz, 0, 5 }, { Bz, 3, 1 }
+			} } },
+			{ 0x01, 2, true, 7, { 6, 6, 6 }, 23, { {
+				{ Gy, 5, 1 }, { Gz, 4, 1 }, { Gz, 5, 1 }, { Rw, 0, 7 }, { Bz, 0, 1 }, { Bz, 1, 1 }, { By, 4, 1 }, { Gw, 0, 7 }, { By, 5, 1 }, { Bz, 2, 1 },
+				{ Gy, 4, 1 }, { Bw, 0, 7 }, { Bz, 3, 1 }, { Bz, 5, 1 }, { Bz, 4, 1 }, { Rx, 0, 6 }, { Gy, 0, 4 }, { Gx, 0, 6 }, { Gz, 0, 4 }, { Bx, 0, 6 },
+				{ By, 0, 4 }, { Ry, 0, 6 }, { Rz, 0, 6 }
+			} } },
+			{ 0x02, 2, true, 11, { 5, 4, 4 }, 18, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 5 }, { Rw, 10, 1 }, { Gy, 0, 4 }, { Gx, 0, 4 }, { Gw, 10, 1 }, { Bz, 0, 1 }, { Gz, 0, 4 },
+				{ Bx, 0, 4 }, { Bw, 10, 1 }, { Bz, 1, 1 }, { By, 0, 4 }, { Ry, 0, 5 }, { Bz, 2, 1 }, { Rz, 0, 5 }, { Bz, 3, 1 }
+			} } },
+			{ 0x06, 2, true, 11, { 4, 5, 4 }, 20, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 4 }, { Rw, 10, 1 }, { Gz, 4, 1 }, { Gy, 0, 4 }, { Gx, 0, 5 }, { Gw, 10, 1 }, { Gz, 0, 4 },
+				{ Bx, 0, 4 }, { Bw, 10, 1 }, { Bz, 1, 1 }, { By, 0, 4 }, { Ry, 0, 4 }, { Bz, 0, 1 }, { Bz, 2, 1 }, { Rz, 0, 4 }, { Gy, 4, 1 }, { Bz, 3, 1 }
+			} } },
+			{ 0x0A, 2, true, 11, { 4, 4, 5 }, 20, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 4 }, { Rw, 10, 1 }, { By, 4, 1 }, { Gy, 0, 4 }, { Gx, 0, 4 }, { Gw, 10, 1 }, { Bz, 0, 1 },
+				{ Gz, 0, 4 }, { Bx, 0, 5 }, { Bw, 10, 1 }, { By, 0, 4 }, { Ry, 0, 4 }, { Bz, 1, 1 }, { Bz, 2, 1 }, { Rz, 0, 4 }, { Bz, 4, 1 }, { Bz, 3, 1 }
+			} } },
+			{ 0x0E, 2, true, 9, { 5, 5, 5 }, 19, { {
+				{ Rw, 0, 9 }, { By, 4, 1 }, { Gw, 0, 9 }, { Gy, 4, 1 }, { Bw, 0, 9 }, { Bz, 4, 1 }, { Rx, 0, 5 }, { Gz, 4, 1 }, { Gy, 0, 4 }, { Gx, 0, 5 },
+				{ Bz, 0, 1 }, { Gz, 0, 4 }, { Bx, 0, 5 }, { Bz, 1, 1 }, { By, 0, 4 }, { Ry, 0, 5 }, { Bz, 2, 1 }, { Rz, 0, 5 }, { Bz, 3, 1 }
+			} } },
+			{ 0x12, 2, true, 8, { 6, 5, 5 }, 19, { {
+				{ Rw, 0, 8 }, { Gz, 4, 1 }, { By, 4, 1 }, { Gw, 0, 8 }, { Bz, 2, 1 }, { Gy, 4, 1 }, { Bw, 0, 8 }, { Bz, 3, 1 }, { Bz, 4, 1 }, { Rx, 0, 6 },
+				{ Gy, 0, 4 }, { Gx, 0, 5 }, { Bz, 0, 1 }, { Gz, 0, 4 }, { Bx, 0, 5 }, { Bz, 1, 1 }, { By, 0, 4 }, { Ry, 0, 6 }, { Rz, 0, 6 }
+			} } },
+			{ 0x16, 2, true, 8, { 5, 6, 5 }, 21, { {
+				{ Rw, 0, 8 }, { Bz, 0, 1 }, { By, 4, 1 }, { Gw, 0, 8 }, { Gy, 5, 1 }, { Gy, 4, 1 }, { Bw, 0, 8 }, { Gz, 5, 1 }, { Bz, 4, 1 }, { Rx, 0, 5 },
+				{ Gz, 4, 1 }, { Gy, 0, 4 }, { Gx, 0, 6 }, { Gz, 0, 4 }, { Bx, 0, 5 }, { Bz, 1, 1 }, { By, 0, 4 }, { Ry, 0, 5 }, { Bz, 2, 1 }, { Rz, 0, 5 },
+				{ Bz, 3, 1 }
+			} } },
+			{ 0x1A, 2, true, 8, { 5, 5, 6 }, 21, { {
+				{ Rw, 0, 8 }, { Bz, 1, 1 }, { By, 4, 1 }, { Gw, 0, 8 }, { By, 5, 1 }, { Gy, 4, 1 }, { Bw, 0, 8 }, { Bz, 5, 1 }, { Bz, 4, 1 }, { Rx, 0, 5 },
+				{ Gz, 4, 1 }, { Gy, 0, 4 }, { Gx, 0, 5 }, { Bz, 0, 1 }, { Gz, 0, 4 }, { Bx, 0, 6 }, { By, 0, 4 }, { Ry, 0, 5 }, { Bz, 2, 1 }, { Rz, 0, 5 },
+				{ Bz, 3, 1 }
+			} } },
+			{ 0x1E, 2, false, 6, { 6, 6, 6 }, 23, { {
+				{ Rw, 0, 6 }, { Gz, 4, 1 }, { Bz, 0, 1 }, { Bz, 1, 1 }, { By, 4, 1 }, { Gw, 0, 6 }, { Gy, 5, 1 }, { By, 5, 1 }, { Bz, 2, 1 }, { Gy, 4, 1 },
+				{ Bw, 0, 6 }, { Gz, 5, 1 }, { Bz, 3, 1 }, { Bz, 5, 1 }, { Bz, 4, 1 }, { Rx, 0, 6 }, { Gy, 0, 4 }, { Gx, 0, 6 }, { Gz, 0, 4 }, { Bx, 0, 6 },
+				{ By, 0, 4 }, { Ry, 0, 6 }, { Rz, 0, 6 }
+			} } },
+			{ 0x03, 1, false, 10, { 10, 10, 10 }, 6, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 10 }, { Gx, 0, 10 }, { Bx, 0, 10 }
+			} } },
+			{ 0x07, 1, true, 11, { 9, 9, 9 }, 9, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 9 }, { Rw, 10, 1 }, { Gx, 0, 9 }, { Gw, 10, 1 }, { Bx, 0, 9 }, { Bw, 10, 1 }
+			} } },
+			{ 0x0B, 1, true, 12, { 8, 8, 8 }, 9, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 8 }, { Rw, 10, 2, true }, { Gx, 0, 8 }, { Gw, 10, 2, true }, { Bx, 0, 8 }, { Bw, 10, 2, true }
+			} } },
+			{ 0x0F, 1, true, 16, { 4, 4, 4 }, 9, { {
+				{ Rw, 0, 10 }, { Gw, 0, 10 }, { Bw, 0, 10 }, { Rx, 0, 4 }, { Rw, 10, 6, true }, { Gx, 0, 4 }, { Gw, 10, 6, true }, { Bx, 0, 4 }, { Bw, 10, 6, true }
+			} } }
+		} };
+
+		// BC6H and BC7 blocks are little-endian bitstreams
+		class BlockBitReader
+		{
+			public:
+				explicit BlockBitReader(const UInt8* block) :
+				m_block(block),
+				m_bitPosition(0)
+				{
+				}
+
+				UInt32 Read(unsigned int bitCount)
+				{
+					UInt32 value = 0;
+					for (unsigned int i = 0; i < bitCount; ++i, ++m_bitPosition)
+						value |= UInt32((m_block[m_bitPosition >> 3] >> (m_bitPosition & 7)) & 1) << i;
+
+					return value;
+				}
+
+			private:
+				const UInt8* m_block;
+				unsigned int m_bitPosition;
+		};
+
+		class BlockBitWriter
+		{
+			public:
+				explicit BlockBitWriter(UInt8* block) :
+				m_block(block),
+				m_bitPosition(0)
+				{
+					std::memset(m_block, 0, 16);
+				}
+
+				void Write(UInt32 value, unsigned int bitCount)
+				{
+					for (unsigned int i = 0; i < bitCount; ++i, ++m_bitPosition)
+						m_block[m_bitPosition >> 3] |= UInt8(((value >> i) & 1) << (m_bitPosition & 7));
+				}
+
+			private:
+				UInt8* m_block;
+				unsigned int m_bitPosition;
+		};
+
+		struct TexelBlock
+		{
+			alignas(16) float channels[4][16];
+		};
+
+		TexelBlock LoadTexels(const UInt8* texels)
+		{
+			TexelBlock block;
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				for (UInt32 c = 0; c < 4; ++c)
+					block.channels[c][i] = texels[i * 4 + c];
+			}
+
+			return block;
+		}
+
+		UInt32 GetRefinementCount(BlockCompressionQuality quality)
+		{
+			switch (quality)
+			{
+				case BlockCompressionQuality::Fast:   return 0;
+				case BlockCompressionQuality::Normal: return 1;
+				case BlockCompressionQuality::High:   return 4;
+			}
+
+			return 1;
+		}
+
+		void ComputeBoundingBoxEndpoints(const TexelBlock& texels, UInt16 texelMask, UInt32 channelCount, float* endpoint0, float* endpoint1)
+		{
+			float minValues[4];
+			float maxValues[4];
+			float mean[4] = {};
+			std::fill(minValues, minValues + 4, std::numeric_limits<float>::max());
+			std::fill(maxValues, maxValues + 4, std::numeric_limits<float>::lowest());
+
+			UInt32 texelCount = 0;
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if ((texelMask & (1 << i)) == 0)
+					continue;
+
+				for (UInt32 c = 0; c < channelCount; ++c)
+				{
+					minValues[c] = std::min(minValues[c], texels.channels[c][i]);
+					maxValues[c] = std::max(maxValues[c], texels.channels[c][i]);
+					mean[c] += texels.channels[c][i];
+				}
+				texelCount++;
+			}
+
+			if (texelCount == 0)
+			{
+				std::fill(endpoint0, endpoint0 + channelCount, 0.f);
+				std::fill(endpoint1, endpoint1 + channelCount, 0.f);
+				return;
+			}
+
+			for (UInt32 c = 0; c < channelCount; ++c)
+				mean[c] /= texelCount;
+
+			// Use the other diagonal for channels varying in the opposite direction of the first one
+			for (UInt32 c = 1; c < channelCount; ++c)
+			{
+				float covariance = 0.f;
+				for (UInt32 i = 0; i < 16; ++i)
+				{
+					if (texelMask & (1 << i))
+						covariance += (texels.channels[0][i] - mean[0]) * (texels.channels[c][i] - mean[c]);
+				}
+
+				if (covariance < 0.f)
+					std::swap(minValues[c], maxValues[c]);
+			}
+
+			std::copy(minValues, minValues + channelCount, endpoint0);
+			std::copy(maxValues, maxValues + channelCount, endpoint1);
+		}
+
+		void ComputePrincipalEndpoints(const TexelBlock& texels, UInt16 texelMask, UInt32 channelCount, float* endpoint0, float* endpoint1)
+		{
+			float mean[4] = {};
+			UInt32 texelCount = 0;
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if ((texelMask & (1 << i)) == 0)
+					continue;
+
+				for (UInt32 c = 0; c < channelCount; ++c)
+					mean[c] += texels.channels[c][i];
+
+				texelCount++;
+			}
+
+			if (texelCount == 0)
+			{
+				std::fill(endpoint0, endpoint0 + channelCount, 0.f);
+				std::fill(endpoint1, endpoint1 + channelCount, 0.f);
+				return;
+			}
+
+			for (UInt32 c = 0; c < channelCount; ++c)
+				mean[c] /= texelCount;
+
+			float covariance[4][4] = {};
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if ((texelMask & (1 << i)) == 0)
+					continue;
+
+				for (UInt32 a = 0; a < channelCount; ++a)
+				{
+					float diffA = texels.channels[a][i] - mean[a];
+					for (UInt32 b = a; b < channelCount; ++b)
+						covariance[a][b] += diffA * (texels.channels[b][i] - mean[b]);
+				}
+			}
+
+			for (UInt32 a = 0; a < channelCount; ++a)
+			{
+				for (UInt32 b = 0; b < a; ++b)
+					covariance[a][b] = covariance[b][a];
+			}
+
+			// Power iteration, starting from the channel with the largest variance
+			UInt32 startChannel = 0;
+			for (UInt32 c = 1; c < channelCount; ++c)
+			{
+				if (covariance[c][c] > covariance[startChannel][startChannel])
+					startChannel = c;
+			}
+
+			float axis[4] = {};
+			for (UInt32 c = 0; c < channelCount; ++c)
+				axis[c] = covariance[startChannel][c];
+
+			for (UInt32 iteration = 0; iteration < 8; ++iteration)
+			{
+				float nextAxis[4] = {};
+				float maxComponent = 0.f;
+				for (UInt32 a = 0; a < channelCount; ++a)
+				{
+					for (UInt32 b = 0; b < channelCount; ++b)
+						nextAxis[a] += covariance[a][b] * axis[b];
+
+					maxComponent = std::max(maxComponent, std::abs(nextAxis[a]));
+				}
+
+				if (maxComponent <= 0.f)
+					break;
+
+				for (UInt32 c = 0; c < channelCount; ++c)
+					axis[c] = nextAxis[c] / maxComponent;
+			}
+
+			float axisLength = 0.f;
+			for (UInt32 c = 0; c < channelCount; ++c)
+				axisLength += axis[c] * axis[c];
+
+			axisLength = std::sqrt(axisLength);
+			if (axisLength < 1e-6f)
+			{
+				// Every texel has the same value
+				std::copy(mean, mean + channelCount, endpoint0);
+				std::copy(mean, mean + channelCount, endpoint1);
+				return;
+			}
+
+			for (UInt32 c = 0; c < channelCount; ++c)
+				axis[c] /= axisLength;
+
+			float minProjection = std::numeric_limits<float>::max();
+			float maxProjection = std::numeric_limits<float>::lowest();
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if ((texelMask & (1 << i)) == 0)
+					continue;
+
+				float projection = 0.f;
+				for (UInt32 c = 0; c < channelCount; ++c)
+					projection += (texels.channels[c][i] - mean[c]) * axis[c];
+
+				minProjection = std::min(minProjection, projection);
+				maxProjection = std::max(maxProjection, projection);
+			}
+
+			for (UInt32 c = 0; c < channelCount; ++c)
+			{
+				endpoint0[c] = mean[c] + axis[c] * minProjection;
+				endpoint1[c] = mean[c] + axis[c] * maxProjection;
+			}
+		}
+
+		// Picks the closest palette entry of every texel of the mask and returns the total squared error
+		float FitIndices(const TexelBlock& texels, UInt16 texelMask, const float (*palette)[4], UInt32 paletteSize, UInt32 channelCount, UInt8* indices)
+		{
+			float totalError = 0.f;
+
+#ifdef NAZARA_ARCH_x86_64
+			for (UInt32 group = 0; group < 16; group += 4)
+			{
+				UInt32 groupMask = (texelMask >> group) & 0xF;
+				if (groupMask == 0)
+					continue;
+
+				__m128 bestError = _mm_set1_ps(std::numeric_limits<float>::max());
+				__m128i bestIndex = _mm_setzero_si128();
+				for (UInt32 p = 0; p < paletteSize; ++p)
+				{
+					__m128 error = _mm_setzero_ps();
+					for (UInt32 c = 0; c < channelCount; ++c)
+					{
+						__m128 diff = _mm_sub_ps(_mm_load_ps(&texels.channels[c][group]), _mm_set1_ps(palette[p][c]));
+						error = _mm_add_ps(error, _mm_mul_ps(diff, diff));
+					}
+
+					__m128i isBetter = _mm_castps_si128(_mm_cmplt_ps(error, bestError));
+					bestError = _mm_min_ps(error, bestError);
+					bestIndex = _mm_or_si128(_mm_and_si128(isBetter, _mm_set1_epi32(int(p))), _mm_andnot_si128(isBetter, bestIndex));
+				}
+
+				alignas(16) float errors[4];
+				alignas(16) Int32 bestIndices[4];
+				_mm_store_ps(errors, bestError);
+				_mm_store_si128(reinterpret_cast<__m128i*>(bestIndices), bestIndex);
+
+				for (UInt32 i = 0; i < 4; ++i)
+				{
+					if (groupMask & (1 << i))
+					{
+						indices[group + i] = UInt8(bestIndices[i]);
+						totalError += errors[i];
+					}
+				}
+			}
+#else
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if ((texelMask & (1 << i)) == 0)
+					continue;
+
+				float bestError = std::numeric_limits<float>::max();
+				UInt32 bestIndex = 0;
+				for (UInt32 p = 0; p < paletteSize; ++p)
+				{
+					float error = 0.f;
+					for (UInt32 c = 0; c < channelCount; ++c)
+					{
+						float diff = texels.channels[c][i] - palette[p][c];
+						error += diff * diff;
+					}
+
+					if (error < bestError)
+					{
+						bestError = error;
+						bestIndex = p;
+					}
+				}
+
+				indices[i] = UInt8(bestIndex);
+				totalError += bestError;
+			}
+#endif
+
+			return totalError;
+		}
+
+		// Least-squares endpoints for the current indices, returns false if the system is degenerate (all texels on the same index)
+		bool RefineEndpoints(const TexelBlock& texels, UInt16 texelMask, const UInt8* indices, const float* indexWeights, UInt32 channelCount, float* endpoint0, float* endpoint1)
+		{
+			float a = 0.f;
+			float b = 0.f;
+			float c = 0.f;
+			float sum0[4] = {};
+			float sum1[4] = {};
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if ((texelMask & (1 << i)) == 0)
+					continue;
+
+				float weight = indexWeights[indices[i]];
+				float invWeight = 1.f - weight;
+				a += invWeight * invWeight;
+				b += invWeight * weight;
+				c += weight * weight;
+
+				for (UInt32 channel = 0; channel < channelCount; ++channel)
+				{
+					sum0[channel] += invWeight * texels.channels[channel][i];
+					sum1[channel] += weight * texels.channels[channel][i];
+				}
+			}
+
+			float determinant = a * c - b * b;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			float invDeterminant = 1.f / determinant;
+			for (UInt32 channel = 0; channel < channelCount; ++channel)
+			{
+				endpoint0[channel] = (c * sum0[channel] - b * sum1[channel]) * invDeterminant;
+				endpoint1[channel] = (a * sum1[channel] - b * sum0[channel]) * invDeterminant;
+			}
+
+			return true;
+		}
+
+		UInt32 Interpolate(UInt32 value0, UInt32 value1, UInt32 weight)
+		{
+			return ((64 - weight) * value0 + weight * value1 + 32) >> 6;
+		}
+
+		/*********************************BC1*********************************/
+
+		UInt16 QuantizeRGB565(const float* color)
+		{
+			UInt32 r = UInt32(std::clamp(color[0] * (31.f / 255.f) + 0.5f, 0.f, 31.f));
+			UInt32 g = UInt32(std::clamp(color[1] * (63.f / 255.f) + 0.5f, 0.f, 63.f));
+			UInt32 b = UInt32(std::clamp(color[2] * (31.f / 255.f) + 0.5f, 0.f, 31.f));
+
+			return UInt16((r << 11) | (g << 5) | b);
+		}
+
+		void ExpandRGB565(UInt16 color, UInt32* rgb)
+		{
+			UInt32 r = (color >> 11) & 0x1F;
+			UInt32 g = (color >> 5) & 0x3F;
+			UInt32 b = color & 0x1F;
+
+			rgb[0] = (r << 3) | (r >> 2);
+			rgb[1] = (g << 2) | (g >> 4);
+			rgb[2] = (b << 3) | (b >> 2);
+		}
+
+		void BuildBC1Palette(UInt16 color0, UInt16 color1, bool fourColors, UInt32 (&palette)[4][4])
+		{
+			ExpandRGB565(color0, palette[0]);
+			ExpandRGB565(color1, palette[1]);
+			palette[0][3] = 255;
+			palette[1][3] = 255;
+
+			if (fourColors)
+			{
+				for (UInt32 c = 0; c < 3; ++c)
+				{
+					palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+					palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+				}
+				palette[2][3] = 255;
+				palette[3][3] = 255;
+			}
+			else
+			{
+				for (UInt32 c = 0; c < 3; ++c)
+					palette[2][c] = (palette[0][c] + palette[1][c] + 1) / 2;
+
+				palette[2][3] = 255;
+
+				// Transparent black
+				palette[3][0] = 0;
+				palette[3][1] = 0;
+				palette[3][2] = 0;
+				palette[3][3] = 0;
+			}
+		}
+
+		// BC2 and BC3 color blocks are always decoded using four colors
+		void EncodeBC1Color(const TexelBlock& texels, UInt16 transparentMask, bool forceFourColors, BlockCompressionQuality quality, UInt8* block)
+		{
+			UInt16 opaqueMask = UInt16(~transparentMask);
+
+			UInt16 bestColor0 = 0;
+			UInt16 bestColor1 = 0;
+			bool bestFourColors = (transparentMask == 0);
+			float bestError = std::numeric_limits<float>::max();
+			UInt8 bestIndices[16] = {};
+
+			if (opaqueMask != 0)
+			{
+				float initialEndpoint0[3];
+				float initialEndpoint1[3];
+				if (quality == BlockCompressionQuality::Fast)
+					ComputeBoundingBoxEndpoints(texels, opaqueMask, 3, initialEndpoint0, initialEndpoint1);
+				else
+					ComputePrincipalEndpoints(texels, opaqueMask, 3, initialEndpoint0, initialEndpoint1);
+
+				auto TryEndpoints = [&](const float* endpoint0, const float* endpoint1, bool fourColors, UInt8* indices)
+				{
+					UInt16 color0 = QuantizeRGB565(endpoint0);
+					UInt16 color1 = QuantizeRGB565(endpoint1);
+
+					UInt32 palette[4][4];
+					BuildBC1Palette(color0, color1, fourColors, palette);
+
+					float paletteValues[4][4];
+					for (UInt32 p = 0; p < 4; ++p)
+					{
+						for (UInt32 c = 0; c < 4; ++c)
+							paletteValues[p][c] = float(palette[p][c]);
+					}
+
+					// Only the 3-color mode last entry is transparent and never used for opaque texels
+					float error = FitIndices(texels, opaqueMask, paletteValues, (fourColors) ? 4 : 3, 3, indices);
+					if (error < bestError)
+					{
+						bestError = error;
+						bestColor0 = color0;
+						bestColor1 = color1;
+						bestFourColors = fourColors;
+						std::copy(indices, indices + 16, bestIndices);
+					}
+				};
+
+				UInt32 refinementCount = GetRefinementCount(quality);
+				for (bool fourColors : { true, false })
+				{
+					if (fourColors && transparentMask != 0)
+						continue;
+
+					// The 3-color mode is required for transparent texels and sometimes better for opaque blocks
+					if (!fourColors && (forceFourColors || (transparentMask == 0 && quality != BlockCompressionQuality::High)))
+						continue;
+
+					float endpoint0[3];
+					float endpoint1[3];
+					std::copy(initialEndpoint0, initialEndpoint0 + 3, endpoint0);
+					std::copy(initialEndpoint1, initialEndpoint1 + 3, endpoint1);
+
+					UInt8 indices[16] = {};
+					TryEndpoints(endpoint0, endpoint1, fourColors, indices);
+					for (UInt32 i = 0; i < refinementCount; ++i)
+					{
+						if (!RefineEndpoints(texels, opaqueMask, indices, (fourColors) ? s_bc1Weights4.data() : s_bc1Weights3.data(), 3, endpoint0, endpoint1))
+							break;
+
+						TryEndpoints(endpoint0, endpoint1, fourColors, indices);
+					}
+				}
+			}
+
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				if (transparentMask & (1 << i))
+					bestIndices[i] = 3;
+			}
+
+			// The decoder picks the mode from the endpoints order
+			if (bestFourColors)
+			{
+				if (bestColor0 < bestColor1)
+				{
+					std::swap(bestColor0, bestColor1);
+					for (UInt8& index : bestIndices)
+						index ^= 1;
+				}
+				else if (bestColor0 == bestColor1 && !forceFourColors)
+				{
+					// Would be decoded as 3-color mode, every palette entry being the same use the first one
+					std::fill(bestIndices, bestIndices + 16, UInt8(0));
+				}
+			}
+			else if (bestColor0 > bestColor1)
+			{
+				std::swap(bestColor0, bestColor1);
+				for (UInt8& index : bestIndices)
+				{
+					if (index < 2)
+						index ^= 1;
+				}
+			}
+
+			UInt32 indexBits = 0;
+			for (UInt32 i = 0; i < 16; ++i)
+				indexBits |= UInt32(bestIndices[i]) << (i * 2);
+
+			block[0] = UInt8(bestColor0 & 0xFF);
+			block[1] = UInt8(bestColor0 >> 8);
+			block[2] = UInt8(bestColor1 & 0xFF);
+			block[3] = UInt8(bestColor1 >> 8);
+			for (UInt32 i = 0; i < 4; ++i)
+				block[4 + i] = UInt8(indexBits >> (i * 8));
+		}
+
+		void DecodeBC1Color(const UInt8* block, bool forceFourColors, UInt8* texels)
+		{
+			UInt16 color0 = UInt16(block[0] | (block[1] << 8));
+			UInt16 color1 = UInt16(block[2] | (block[3] << 8));
+
+			UInt32 palette[4][4];
+			BuildBC1Palette(color0, color1, forceFourColors || color0 > color1, palette);
+
+			UInt32 indexBits = UInt32(block[4]) | (UInt32(block[5]) << 8) | (UInt32(block[6]) << 16) | (UInt32(block[7]) << 24);
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				const UInt32* color = palette[(indexBits >> (i * 2)) & 3];
+				for (UInt32 c = 0; c < 4; ++c)
+					texels[i * 4 + c] = UInt8(color[c]);
+			}
+		}
+
+		/*********************************BC4*********************************/
+
+		void BuildBC4Palette(UInt8 value0, UInt8 value1, UInt8 (&palette)[8])
+		{
+			palette[0] = value0;
+			palette[1] = value1;
+
+			if (value0 > value1)
+			{
+				for (UInt32 i = 1; i < 7; ++i)
+					palette[i + 1] = UInt8(((7 - i) * value0 + i * value1 + 3) / 7);
+			}
+			else
+			{
+				for (UInt32 i = 1; i < 5; ++i)
+					palette[i + 1] = UInt8(((5 - i) * value0 + i * value1 + 2) / 5);
+
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+		}
+
+		UInt32 FitBC4Indices(const UInt8* values, UInt8 value0, UInt8 value1, UInt8* indices)
+		{
+			UInt8 palette[8];
+			BuildBC4Palette(value0, value1, palette);
+
+			UInt32 totalError = 0;
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				UInt32 bestError = std::numeric_limits<UInt32>::max();
+				for (UInt32 p = 0; p < 8; ++p)
+				{
+					int diff = int(values[i]) - int(palette[p]);
+					UInt32 error = UInt32(diff * diff);
+					if (error < bestError)
+					{
+						bestError = error;
+						indices[i] = UInt8(p);
+					}
+				}
+
+				totalError += bestError;
+			}
+
+			return totalError;
+		}
+
+		void EncodeBC4Channel(const UInt8* values, BlockCompressionQuality quality, UInt8* block)
+		{
+			UInt8 minValue = 255;
+			UInt8 maxValue = 0;
+			UInt8 minInnerValue = 255;
+			UInt8 maxInnerValue = 0;
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				minValue = std::min(minValue, values[i]);
+				maxValue = std::max(maxValue, values[i]);
+
+				// 0 and 255 are always part of the 6 values palette
+				if (values[i] != 0 && values[i] != 255)
+				{
+					minInnerValue = std::min(minInnerValue, values[i]);
+					maxInnerValue = std::max(maxInnerValue, values[i]);
+				}
+			}
+
+			if (minInnerValue > maxInnerValue)
+			{
+				minInnerValue = 0;
+				maxInnerValue = 0;
+			}
+
+			UInt8 bestValue0 = 0;
+			UInt8 bestValue1 = 0;
+			UInt8 bestIndices[16] = {};
+			UInt32 bestError = std::numeric_limits<UInt32>::max();
+
+			auto TryEndpoints = [&](UInt8 value0, UInt8 value1)
+			{
+				UInt8 indices[16];
+				UInt32 error = FitBC4Indices(values, value0, value1, indices);
+				if (error < bestError)
+				{
+					bestError = error;
+					bestValue0 = value0;
+					bestValue1 = value1;
+					std::copy(indices, indices + 16, bestIndices);
+				}
+			};
+
+			// 8 values mode (or a single exact value if the block is uniform)
+			TryEndpoints(maxValue, minValue);
+
+			if (quality != BlockCompressionQuality::Fast && bestError > 0)
+				TryEndpoints(minInnerValue, maxInnerValue);
+
+			if (quality == BlockCompressionQuality::High && bestError > 0)
+			{
+				constexpr int SearchRadius = 3;
+
+				for (bool eightValues : { true, false })
+				{
+					int baseValue0 = (eightValues) ? maxValue : minInnerValue;
+					int baseValue1 = (eightValues) ? minValue : maxInnerValue;
+
+					for (int offset0 = -SearchRadius; offset0 <= SearchRadius; ++offset0)
+					{
+						for (int offset1 = -SearchRadius; offset1 <= SearchRadius; ++offset1)
+						{
+							UInt8 value0 = UInt8(std::clamp(baseValue0 + offset0, 0, 255));
+							UInt8 value1 = UInt8(std::clamp(baseValue1 + offset1, 0, 255));
+							if ((value0 > value1) != eightValues)
+								continue;
+
+							TryEndpoints(value0, value1);
+						}
+					}
+				}
+			}
+
+			UInt64 indexBits = 0;
+			for (UInt32 i = 0; i < 16; ++i)
+				indexBits |= UInt64(bestIndices[i]) << (i * 3);
+
+			block[0] = bestValue0;
+			block[1] = bestValue1;
+			for (UInt32 i = 0; i < 6; ++i)
+				block[2 + i] = UInt8(indexBits >> (i * 8));
+		}
+
+		void DecodeBC4Channel(const UInt8* block, UInt8* texels, std::size_t stride)
+		{
+			UInt8 palette[8];
+			BuildBC4Palette(block[0], block[1], palette);
+
+			UInt64 indexBits = 0;
+			for (UInt32 i = 0; i < 6; ++i)
+				indexBits |= UInt64(block[2 + i]) << (i * 8);
+
+			for (UInt32 i = 0; i < 16; ++i)
+				texels[i * stride] = palette[(indexBits >> (i * 3)) & 7];
+		}
+
+		void ExtractChannel(const UInt8* texels, UInt32 channel, UInt8* values)
+		{
+			for (UInt32 i = 0; i < 16; ++i)
+				values[i] = texels[i * 4 + channel];
+		}
+
+		/*********************************BC6H********************************/
+
+		float ClampToUnsignedHalf(UInt16 value)
+		{
+			// Negative values cannot be represented, infinity and NaN are clamped to the largest finite value
+			if (value & 0x8000)
+				return 0.f;
+
+			return float(std::min<UInt16>(value, 0x7BFF));
+		}
+
+		UInt32 UnquantizeBC6HComponent(UInt32 value, UInt32 precision)
+		{
+			if (precision >= 15 || value == 0)
+				return value;
+
+			if (value == (1u << precision) - 1)
+				return 0xFFFF;
+
+			return ((value << 16) + 0x8000) >> precision;
+		}
+
+		UInt32 FinishBC6HComponent(UInt32 value)
+		{
+			return (value * 31) >> 6;
+		}
+
+		UInt32 QuantizeBC6HComponent(float value)
+		{
+			// Inverse of FinishBC6HComponent(UnquantizeBC6HComponent(x))
+			int baseValue = int(std::floor((value * 64.f / 31.f - 32.f) / 64.f));
+
+			UInt32 bestValue = 0;
+			float bestError = std::numeric_limits<float>::max();
+			for (int candidate = baseValue; candidate <= baseValue + 1; ++candidate)
+			{
+				UInt32 quantized = UInt32(std::clamp(candidate, 0, 1023));
+				float error = std::abs(float(FinishBC6HComponent(UnquantizeBC6HComponent(quantized, 10))) - value);
+				if (error < bestError)
+				{
+					bestError = error;
+					bestValue = quantized;
+				}
+			}
+
+			return bestValue;
+		}
+
+		void EncodeBC6H(const UInt8* texelData, BlockCompressionQuality quality, UInt8* block)
+		{
+			UInt16 halfTexels[16 * 4];
+			std::memcpy(halfTexels, texelData, sizeof(halfTexels));
+
+			// Endpoints are fitted on the half bit patterns, which is what the format interpolates
+			TexelBlock texels;
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				for (UInt32 c = 0; c < 3; ++c)
+					texels.channels[c][i] = ClampToUnsignedHalf(halfTexels[i * 4 + c]);
+			}
+
+			float endpoint0[3];
+			float endpoint1[3];
+			if (quality == BlockCompressionQuality::Fast)
+				ComputeBoundingBoxEndpoints(texels, 0xFFFF, 3, endpoint0, endpoint1);
+			else
+				ComputePrincipalEndpoints(texels, 0xFFFF, 3, endpoint0, endpoint1);
+
+			UInt32 bestEndpoints[2][3] = {};
+			UInt8 bestIndices[16] = {};
+			float bestError = std::numeric_limits<float>::max();
+
+			auto TryEndpoints = [&](const float* candidate0, const float* candidate1, UInt8* indices)
+			{
+				UInt32 quantized[2][3];
+				UInt32 unquantized[2][3];
+				for (UInt32 c = 0; c < 3; ++c)
+				{
+					quantized[0][c] = QuantizeBC6HComponent(candidate0[c]);
+					quantized[1][c] = QuantizeBC6HComponent(candidate1[c]);
+					unquantized[0][c] = UnquantizeBC6HComponent(quantized[0][c], 10);
+					unquantized[1][c] = UnquantizeBC6HComponent(quantized[1][c], 10);
+				}
+
+				float palette[16][4] = {};
+				for (UInt32 p = 0; p < 16; ++p)
+				{
+					for (UInt32 c = 0; c < 3; ++c)
+						palette[p][c] = float(FinishBC6HComponent(Interpolate(unquantized[0][c], unquantized[1][c], s_weights4[p])));
+				}
+
+				float error = FitIndices(texels, 0xFFFF, palette, 16, 3, indices);
+				if (error < bestError)
+				{
+					bestError = error;
+					std::memcpy(bestEndpoints, quantized, sizeof(quantized));
+					std::copy(indices, indices + 16, bestIndices);
+				}
+			};
+
+			float indexWeights[16];
+			for (UInt32 i = 0; i < 16; ++i)
+				indexWeights[i] = s_weights4[i] / 64.f;
+
+			UInt8 indices[16] = {};
+			TryEndpoints(endpoint0, endpoint1, indices);
+
+			UInt32 refinementCount = GetRefinementCount(quality);
+			for (UInt32 i = 0; i < refinementCount; ++i)
+			{
+				if (!RefineEndpoints(texels, 0xFFFF, indices, indexWeights, 3, endpoint0, endpoint1))
+					break;
+
+				TryEndpoints(endpoint0, endpoint1, indices);
+			}
+
+			// The first texel index is stored without its most significant bit
+			if (bestIndices[0] & 8)
+			{
+				std::swap(bestEndpoints[0], bestEndpoints[1]);
+				for (UInt8& index : bestIndices)
+					index = 15 - index;
+			}
+
+			// Mode 11 (single region, 10 bits endpoints, 4 bits indices)
+			BlockBitWriter writer(block);
+			writer.Write(0x03, 5);
+			for (UInt32 e = 0; e < 2; ++e)
+			{
+				for (UInt32 c = 0; c < 3; ++c)
+					writer.Write(bestEndpoints[e][c], 10);
+			}
+
+			for (UInt32 i = 0; i < 16; ++i)
+				writer.Write(bestIndices[i], (i == 0) ? 3 : 4);
+		}
+
+		bool DecodeBC6H(const UInt8* block, UInt8* texelData)
+		{
+			UInt16 halfTexels[16 * 4];
+
+			BlockBitReader reader(block);
+			UInt32 mode = reader.Read(2);
+			if (mode >= 2)
+				mode |= reader.Read(3) << 2;
+
+			auto it = std::find_if(s_bc6hModes.begin(), s_bc6hModes.end(), [&](const BC6HModeInfo& modeInfo) { return modeInfo.mode == mode; });
+			if (it == s_bc6hModes.end())
+			{
+				// Reserved modes decode to black
+				for (UInt32 i = 0; i < 16; ++i)
+				{
+					halfTexels[i * 4 + 0] = 0;
+					halfTexels[i * 4 + 1] = 0;
+					halfTexels[i * 4 + 2] = 0;
+					halfTexels[i * 4 + 3] = 0x3C00;
+				}
+
+				std::memcpy(texelData, halfTexels, sizeof(halfTexels));
+				return true;
+			}
+
+			const BC6HModeInfo& modeInfo = *it;
+
+			// Endpoints are stored as w, x (first region) and y, z (second region)
+			UInt32 endpoints[4][3] = {};
+			for (UInt32 i = 0; i < modeInfo.fieldCount; ++i)
+			{
+				const BC6HField& field = modeInfo.fields[i];
+				UInt32 value = reader.Read(field.bitCount);
+				if (field.isReversed)
+				{
+					UInt32 reversedValue = 0;
+					for (UInt32 bit = 0; bit < field.bitCount; ++bit)
+						reversedValue |= ((value >> bit) & 1) << (field.bitCount - bit - 1);
+
+					value = reversedValue;
+				}
+
+				endpoints[field.value / 3][field.value % 3] |= value << field.firstBit;
+			}
+
+			UInt32 partition = (modeInfo.regionCount == 2) ? reader.Read(5) : 0;
+			UInt32 endpointCount = modeInfo.regionCount * 2U;
+
+			UInt32 endpointMask = (1u << modeInfo.endpointBits) - 1;
+			for (UInt32 c = 0; c < 3; ++c)
+			{
+				// Other endpoints are stored as signed deltas from the first one
+				if (modeInfo.isTransformed)
+				{
+					UInt32 deltaSignBit = 1u << (modeInfo.deltaBits[c] - 1);
+					for (UInt32 e = 1; e < endpointCount; ++e)
+					{
+						UInt32 delta = (endpoints[e][c] ^ deltaSignBit) - deltaSignBit; //< sign extension
+						endpoints[e][c] = (endpoints[0][c] + delta) & endpointMask;
+					}
+				}
+
+				for (UInt32 e = 0; e < endpointCount; ++e)
+					endpoints[e][c] = UnquantizeBC6HComponent(endpoints[e][c], modeInfo.endpointBits);
+			}
+
+			// BC6H uses the first 32 BC7 two-subset partitions
+			UInt16 partitionMask = (modeInfo.regionCount == 2) ? s_bc7PartitionMasks[partition] : 0;
+			UInt32 secondAnchorIndex = (modeInfo.regionCount == 2) ? s_bc7AnchorIndices[partition] : 0;
+			UInt32 indexBits = (modeInfo.regionCount == 2) ? 3 : 4;
+
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				UInt32 index = reader.Read(indexBits - ((i == 0 || i == secondAnchorIndex) ? 1 : 0));
+				UInt32 weight = (indexBits == 3) ? s_weights3[index] : s_weights4[index];
+
+				UInt32 region = (partitionMask >> i) & 1;
+				for (UInt32 c = 0; c < 3; ++c)
+					halfTexels[i * 4 + c] = UInt16(FinishBC6HComponent(Interpolate(endpoints[region * 2][c], endpoints[region * 2 + 1][c], weight)));
+
+				halfTexels[i * 4 + 3] = 0x3C00; //< 1.0
+			}
+
+			std::memcpy(texelData, halfTexels, sizeof(halfTexels));
+			return true;
+		}
+
+		/*********************************BC7*********************************/
+
+		UInt32 ExpandBC7Component(UInt32 value, UInt32 precision)
+		{
+			return (value << (8 - precision)) | (value >> (2 * precision - 8));
+		}
+
+		// Returns the value (without p-bit) which, once the p-bit appended and expanded to 8 bits, is the closest to the input
+		UInt32 QuantizeBC7Component(float value, UInt32 pBit, UInt32 precision)
+		{
+			UInt32 maxValue = (1u << (precision - 1)) - 1;
+			float scaled = value * float((1u << precision) - 1) / 255.f;
+			int baseValue = int(std::floor((scaled - float(pBit)) * 0.5f));
+
+			UInt32 bestValue = 0;
+			float bestError = std::numeric_limits<float>::max();
+			for (int candidate = baseValue; candidate <= baseValue + 1; ++candidate)
+			{
+				UInt32 quantized = UInt32(std::clamp(candidate, 0, int(maxValue)));
+				float error = std::abs(float(ExpandBC7Component((quantized << 1) | pBit, precision)) - value);
+				if (error < bestError)
+				{
+					bestError = error;
+					bestValue = quantized;
+				}
+			}
+
+			return bestValue;
+		}
+
+		struct BC7Mode6Encoding
+		{
+			UInt32 endpoints[2][4];
+			UInt32 pBits[2];
+			UInt8 indices[16];
+			float error = std::numeric_limits<float>::max();
+		};
+
+		struct BC7Mode1Encoding
+		{
+			UInt32 partition;
+			UInt32 endpoints[2][2][3];
+			UInt32 pBits[2];
+			UInt8 indices[16];
+			float error = std::numeric_limits<float>::max();
+		};
+
+		BC7Mode6Encoding EncodeBC7Mode6(const TexelBlock& texels, BlockCompressionQuality quality)
+		{
+			BC7Mode6Encoding bestEncoding;
+
+			float endpoint0[4];
+			float endpoint1[4];
+			if (quality == BlockCompressionQuality::Fast)
+				ComputeBoundingBoxEndpoints(texels, 0xFFFF, 4, endpoint0, endpoint1);
+			else
+				ComputePrincipalEndpoints(texels, 0xFFFF, 4, endpoint0, endpoint1);
+
+			auto TryEndpoints = [&](const float* candidate0, const float* candidate1, UInt8* indices)
+			{
+				float bestCandidateError = std::numeric_limits<float>::max();
+
+				auto TryPBits = [&](UInt32 pBit0, UInt32 pBit1)
+				{
+					BC7Mode6Encoding encoding;
+					encoding.pBits[0] = pBit0;
+					encoding.pBits[1] = pBit1;
+
+					float palette[16][4];
+					UInt32 values[2][4];
+					for (UInt32 c = 0; c < 4; ++c)
+					{
+						encoding.endpoints[0][c] = QuantizeBC7Component(candidate0[c], pBit0, 8);
+						encoding.endpoints[1][c] = QuantizeBC7Component(candidate1[c], pBit1, 8);
+						values[0][c] = (encoding.endpoints[0][c] << 1) | pBit0;
+						values[1][c] = (encoding.endpoints[1][c] << 1) | pBit1;
+					}
+
+					for (UInt32 p = 0; p < 16; ++p)
+					{
+						for (UInt32 c = 0; c < 4; ++c)
+							palette[p][c] = float(Interpolate(values[0][c], values[1][c], s_weights4[p]));
+					}
+
+					encoding.error = FitIndices(texels, 0xFFFF, palette, 16, 4, encoding.indices);
+					if (encoding.error < bestCandidateError)
+					{
+						bestCandidateError = encoding.error;
+						std::copy(encoding.indices, encoding.indices + 16, indices);
+					}
+
+					if (encoding.error < bestEncoding.error)
+						bestEncoding = encoding;
+				};
+
+				if (quality == BlockCompressionQuality::Fast)
+				{
+					// Pick the p-bit of each endpoint minimizing its own quantization error
+					UInt32 pBits[2];
+					const float* candidates[2] = { candidate0, candidate1 };
+					for (UInt32 e = 0; e < 2; ++e)
+					{
+						float pBitErrors[2] = {};
+						for (UInt32 pBit = 0; pBit < 2; ++pBit)
+						{
+							for (UInt32 c = 0; c < 4; ++c)
+							{
+								float diff = float((QuantizeBC7Component(candidates[e][c], pBit, 8) << 1) | pBit) - candidates[e][c];
+								pBitErrors[pBit] += diff * diff;
+							}
+						}
+
+						pBits[e] = (pBitErrors[1] < pBitErrors[0]) ? 1 : 0;
+					}
+
+					TryPBits(pBits[0], pBits[1]);
+				}
+				else
+				{
+					for (UInt32 pBit0 = 0; pBit0 < 2; ++pBit0)
+					{
+						for (UInt32 pBit1 = 0; pBit1 < 2; ++pBit1)
+							TryPBits(pBit0, pBit1);
+					}
+				}
+			};
+
+			float indexWeights[16];
+			for (UInt32 i = 0; i < 16; ++i)
+				indexWeights[i] = s_weights4[i] / 64.f;
+
+			UInt8 indices[16] = {};
+			TryEndpoints(endpoint0, endpoint1, indices);
+
+			UInt32 refinementCount = GetRefinementCount(quality);
+			for (UInt32 i = 0; i < refinementCount; ++i)
+			{
+				if (!RefineEndpoints(texels, 0xFFFF, indices, indexWeights, 4, endpoint0, endpoint1))
+					break;
+
+				TryEndpoints(endpoint0, endpoint1, indices);
+			}
+
+			return bestEncoding;
+		}
+
+		// Fits the endpoints of one subset of a mode 1 block (6 bits RGB endpoints, shared p-bit, 3 bits indices)
+		float EncodeBC7Mode1Subset(const TexelBlock& texels, UInt16 subsetMask, const float* endpoint0, const float* endpoint1, UInt32 (&endpoints)[2][3], UInt32& subsetPBit, UInt8* indices)
+		{
+			float bestError = std::numeric_limits<float>::max();
+			for (UInt32 pBit = 0; pBit < 2; ++pBit)
+			{
+				UInt32 quantized[2][3];
+				UInt32 values[2][3];
+				for (UInt32 c = 0; c < 3; ++c)
+				{
+					quantized[0][c] = QuantizeBC7Component(endpoint0[c], pBit, 7);
+					quantized[1][c] = QuantizeBC7Component(endpoint1[c], pBit, 7);
+					values[0][c] = ExpandBC7Component((quantized[0][c] << 1) | pBit, 7);
+					values[1][c] = ExpandBC7Component((quantized[1][c] << 1) | pBit, 7);
+				}
+
+				float palette[8][4] = {};
+				for (UInt32 p = 0; p < 8; ++p)
+				{
+					for (UInt32 c = 0; c < 3; ++c)
+						palette[p][c] = float(Interpolate(values[0][c], values[1][c], s_weights3[p]));
+				}
+
+				UInt8 candidateIndices[16];
+				float error = FitIndices(texels, subsetMask, palette, 8, 3, candidateIndices);
+				if (error < bestError)
+				{
+					bestError = error;
+					subsetPBit = pBit;
+					std::memcpy(endpoints, quantized, sizeof(quantized));
+					for (UInt32 i = 0; i < 16; ++i)
+					{
+						if (subsetMask & (1 << i))
+							indices[i] = candidateIndices[i];
+					}
+				}
+			}
+
+			return bestError;
+		}
+
+		BC7Mode1Encoding EncodeBC7Mode1(const TexelBlock& texels, BlockCompressionQuality quality)
+		{
+			BC7Mode1Encoding bestEncoding;
+			float bestFloatEndpoints[2][2][3];
+
+			for (UInt32 partition = 0; partition < s_bc7PartitionMasks.size(); ++partition)
+			{
+				UInt16 subsetMasks[2] = { UInt16(~s_bc7PartitionMasks[partition]), s_bc7PartitionMasks[partition] };
+
+				BC7Mode1Encoding encoding;
+				encoding.partition = partition;
+				encoding.error = 0.f;
+
+				float floatEndpoints[2][2][3];
+				for (UInt32 subset = 0; subset < 2 && encoding.error < bestEncoding.error; ++subset)
+				{
+					ComputePrincipalEndpoints(texels, subsetMasks[subset], 3, floatEndpoints[subset][0], floatEndpoints[subset][1]);
+					encoding.error += EncodeBC7Mode1Subset(texels, subsetMasks[subset], floatEndpoints[subset][0], floatEndpoints[subset][1], encoding.endpoints[subset], encoding.pBits[subset], encoding.indices);
+				}
+
+				if (encoding.error < bestEncoding.error)
+				{
+					bestEncoding = encoding;
+					std::memcpy(bestFloatEndpoints, floatEndpoints, sizeof(floatEndpoints));
+				}
+			}
+
+			float indexWeights[8];
+			for (UInt32 i = 0; i < 8; ++i)
+				indexWeights[i] = s_weights3[i] / 64.f;
+
+			// Refine the best partition subsets independently
+			UInt16 partitionMask = s_bc7PartitionMasks[bestEncoding.partition];
+			UInt16 subsetMasks[2] = { UInt16(~partitionMask), partitionMask };
+
+			UInt32 refinementCount = GetRefinementCount(quality);
+			for (UInt32 subset = 0; subset < 2; ++subset)
+			{
+				// Error of the subset alone
+				UInt32 endpoints[2][3];
+				UInt32 pBit;
+				UInt8 indices[16];
+				std::copy(bestEncoding.indices, bestEncoding.indices + 16, indices);
+				float subsetError = EncodeBC7Mode1Subset(texels, subsetMasks[subset], bestFloatEndpoints[subset][0], bestFloatEndpoints[subset][1], endpoints, pBit, indices);
+
+				float* endpoint0 = bestFloatEndpoints[subset][0];
+				float* endpoint1 = bestFloatEndpoints[subset][1];
+				for (UInt32 i = 0; i < refinementCount; ++i)
+				{
+					if (!RefineEndpoints(texels, subsetMasks[subset], indices, indexWeights, 3, endpoint0, endpoint1))
+						break;
+
+					UInt8 refinedIndices[16];
+					std::copy(indices, indices + 16, refinedIndices);
+
+					float refinedError = EncodeBC7Mode1Subset(texels, subsetMasks[subset], endpoint0, endpoint1, endpoints, pBit, refinedIndices);
+					std::copy(refinedIndices, refinedIndices + 16, indices);
+
+					if (refinedError < subsetError)
+					{
+						bestEncoding.error -= subsetError - refinedError;
+						subsetError = refinedError;
+
+						std::memcpy(bestEncoding.endpoints[subset], endpoints, sizeof(endpoints));
+						bestEncoding.pBits[subset] = pBit;
+						for (UInt32 t = 0; t < 16; ++t)
+						{
+							if (subsetMasks[subset] & (1 << t))
+								bestEncoding.indices[t] = indices[t];
+						}
+					}
+				}
+			}
+
+			return bestEncoding;
+		}
+
+		void WriteBC7Mode1(BC7Mode1Encoding& encoding, UInt8* block)
+		{
+			UInt16 partitionMask = s_bc7PartitionMasks[encoding.partition];
+			UInt32 anchorIndices[2] = { 0, s_bc7AnchorIndices[encoding.partition] };
+
+			// Anchor texels are stored without their most significant index bit
+			for (UInt32 subset = 0; subset < 2; ++subset)
+			{
+				if ((encoding.indices[anchorIndices[subset]] & 4) == 0)
+					continue;
+
+				std::swap(encoding.endpoints[subset][0], encoding.endpoints[subset][1]);
+				for (UInt32 i = 0; i < 16; ++i)
+				{
+					if (((partitionMask >> i) & 1) == subset)
+						encoding.indices[i] = 7 - encoding.indices[i];
+				}
+			}
+
+			BlockBitWriter writer(block);
+			writer.Write(1 << 1, 2);
+			writer.Write(encoding.partition, 6);
+
+			for (UInt32 c = 0; c < 3; ++c)
+			{
+				for (UInt32 subset = 0; subset < 2; ++subset)
+				{
+					writer.Write(encoding.endpoints[subset][0][c], 6);
+					writer.Write(encoding.endpoints[subset][1][c], 6);
+				}
+			}
+
+			writer.Write(encoding.pBits[0], 1);
+			writer.Write(encoding.pBits[1], 1);
+
+			for (UInt32 i = 0; i < 16; ++i)
+				writer.Write(encoding.indices[i], (i == anchorIndices[0] || i == anchorIndices[1]) ? 2 : 3);
+		}
+
+		void WriteBC7Mode6(BC7Mode6Encoding& encoding, UInt8* block)
+		{
+			// The first texel is stored without its most significant index bit
+			if (encoding.indices[0] & 8)
+			{
+				std::swap(encoding.endpoints[0], encoding.endpoints[1]);
+				std::swap(encoding.pBits[0], encoding.pBits[1]);
+				for (UInt8& index : encoding.indices)
+					index = 15 - index;
+			}
+
+			BlockBitWriter writer(block);
+			writer.Write(1 << 6, 7);
+
+			for (UInt32 c = 0; c < 4; ++c)
+			{
+				writer.Write(encoding.endpoints[0][c], 7);
+				writer.Write(encoding.endpoints[1][c], 7);
+			}
+
+			writer.Write(encoding.pBits[0], 1);
+			writer.Write(encoding.pBits[1], 1);
+
+			for (UInt32 i = 0; i < 16; ++i)
+				writer.Write(encoding.indices[i], (i == 0) ? 3 : 4);
+		}
+
+		void EncodeBC7(const UInt8* texelData, BlockCompressionQuality quality, UInt8* block)
+		{
+			TexelBlock texels = LoadTexels(texelData);
+
+			BC7Mode6Encoding mode6 = EncodeBC7Mode6(texels, quality);
+
+			// Two subsets mode for opaque blocks (as alpha is implicitly 255)
+			if (quality == BlockCompressionQuality::High && mode6.error > 0.f)
+			{
+				bool isOpaque = std::all_of(texels.channels[3], texels.channels[3] + 16, [](float alpha) { return alpha == 255.f; });
+				if (isOpaque)
+				{
+					BC7Mode1Encoding mode1 = EncodeBC7Mode1(texels, quality);
+					if (mode1.error < mode6.error)
+						return WriteBC7Mode1(mode1, block);
+				}
+			}
+
+			WriteBC7Mode6(mode6, block);
+		}
+
+		bool DecodeBC7(const UInt8* block, UInt8* texels)
+		{
+			BlockBitReader reader(block);
+
+			UInt32 mode = 0;
+			while (mode < 8 && reader.Read(1) == 0)
+				mode++;
+
+			if (mode >= 8)
+			{
+				// Reserved mode, decoded as transparent black
+				std::memset(texels, 0, 16 * 4);
+				return true;
+			}
+
+			const BC7ModeInfo& modeInfo = s_bc7Modes[mode];
+
+			UInt32 partition = reader.Read(modeInfo.partitionBits);
+			UInt32 rotation = reader.Read(modeInfo.rotationBits);
+			UInt32 indexSelection = reader.Read(modeInfo.indexSelectionBits);
+
+			UInt32 endpointCount = modeInfo.subsetCount * 2U;
+			UInt32 endpoints[6][4];
+			for (UInt32 c = 0; c < 3; ++c)
+			{
+				for (UInt32 e = 0; e < endpointCount; ++e)
+					endpoints[e][c] = reader.Read(modeInfo.colorBits);
+			}
+
+			for (UInt32 e = 0; e < endpointCount; ++e)
+				endpoints[e][3] = (modeInfo.alphaBits > 0) ? reader.Read(modeInfo.alphaBits) : 255;
+
+			UInt32 colorPrecision = modeInfo.colorBits;
+			UInt32 alphaPrecision = modeInfo.alphaBits;
+			if (modeInfo.endpointPBits || modeInfo.sharedPBits)
+			{
+				UInt32 pBits[6];
+				if (modeInfo.endpointPBits)
+				{
+					for (UInt32 e = 0; e < endpointCount; ++e)
+						pBits[e] = reader.Read(1);
+				}
+				else
+				{
+					for (UInt32 subset = 0; subset < modeInfo.subsetCount; ++subset)
+						pBits[subset * 2] = pBits[subset * 2 + 1] = reader.Read(1);
+				}
+
+				for (UInt32 e = 0; e < endpointCount; ++e)
+				{
+					for (UInt32 c = 0; c < 3; ++c)
+						endpoints[e][c] = (endpoints[e][c] << 1) | pBits[e];
+
+					if (modeInfo.alphaBits > 0)
+						endpoints[e][3] = (endpoints[e][3] << 1) | pBits[e];
+				}
+
+				colorPrecision++;
+				if (alphaPrecision > 0)
+					alphaPrecision++;
+			}
+
+			for (UInt32 e = 0; e < endpointCount; ++e)
+			{
+				for (UInt32 c = 0; c < 3; ++c)
+					endpoints[e][c] = ExpandBC7Component(endpoints[e][c], colorPrecision);
+
+				if (alphaPrecision > 0)
+					endpoints[e][3] = ExpandBC7Component(endpoints[e][3], alphaPrecision);
+			}
+
+			// Subset of each texel (two bits per texel) and anchor texels, whose index is stored with one less bit (0 when unused)
+			UInt32 subsets = 0;
+			UInt32 secondAnchorIndex = 0;
+			UInt32 thirdAnchorIndex = 0;
+			if (modeInfo.subsetCount == 2)
+			{
+				UInt16 partitionMask = s_bc7PartitionMasks[partition];
+				for (UInt32 i = 0; i < 16; ++i)
+					subsets |= UInt32((partitionMask >> i) & 1) << (i * 2);
+
+				secondAnchorIndex = s_bc7AnchorIndices[partition];
+			}
+			else if (modeInfo.subsetCount == 3)
+			{
+				subsets = s_bc7Partition3Masks[partition];
+				secondAnchorIndex = s_bc7Partition3SecondAnchorIndices[partition];
+				thirdAnchorIndex = s_bc7Partition3ThirdAnchorIndices[partition];
+			}
+
+			UInt32 indices[16];
+			for (UInt32 i = 0; i < 16; ++i)
+				indices[i] = reader.Read(modeInfo.indexBits - ((i == 0 || i == secondAnchorIndex || i == thirdAnchorIndex) ? 1 : 0));
+
+			UInt32 secondaryIndices[16];
+			if (modeInfo.secondaryIndexBits > 0)
+			{
+				for (UInt32 i = 0; i < 16; ++i)
+					secondaryIndices[i] = reader.Read(modeInfo.secondaryIndexBits - ((i == 0) ? 1 : 0));
+			}
+
+			auto GetWeight = [](UInt32 indexBits, UInt32 index)
+			{
+				switch (indexBits)
+				{
+					case 2: return s_weights2[index];
+					case 3: return s_weights3[index];
+					default: return s_weights4[index];
+				}
+			};
+
+			for (UInt32 i = 0; i < 16; ++i)
+			{
+				UInt32 subset = (subsets >> (i * 2)) & 3;
+				const UInt32* endpoint0 = endpoints[subset * 2];
+				const UInt32* endpoint1 = endpoints[subset * 2 + 1];
+
+				UInt32 colorWeight;
+				UInt32 alphaWeight;
+				if (modeInfo.secondaryIndexBits > 0)
+				{
+					if (indexSelection == 0)
+					{
+						colorWeight = GetWeight(modeInfo.indexBits, indices[i]);
+						alphaWeight = GetWeight(modeInfo.secondaryIndexBits, secondaryIndices[i]);
+					}
+					else
+					{
+						colorWeight = GetWeight(modeInfo.secondaryIndexBits, secondaryIndices[i]);
+						alphaWeight = GetWeight(modeInfo.indexBits, indices[i]);
+					}
+				}
+				else
+					colorWeight = alphaWeight = GetWeight(modeInfo.indexBits, indices[i]);
+
+				UInt8* texel = &texels[i * 4];
+				for (UInt32 c = 0; c < 3; ++c)
+					texel[c] = UInt8(Interpolate(endpoint0[c], endpoint1[c], colorWeight));
+
+				texel[3] = UInt8(Interpolate(endpoint0[3], endpoint1[3], alphaWeight));
+
+				if (rotation > 0)
+					std::swap(texel[rotation - 1], texel[3]);
+			}
+
+			return true;
+		}
+	}
+
+	namespace BlockCompression
+	{
+		void EncodeBlock(PixelFormat format, const UInt8* texels, UInt8* block, const BlockCompressionParams& params)
+		{
+			NAZARA_USE_ANONYMOUS_NAMESPACE
+
+			switch (format)
+			{
+				case PixelFormat::BC4:
+				{
+					UInt8 values[16];
+					ExtractChannel(texels, 0, values);
+					EncodeBC4Channel(values, params.quality, block);
+					break;
+				}
+
+				case PixelFormat::BC5:
+				{
+					UInt8 values[16];
+					ExtractChannel(texels, 0, values);
+					EncodeBC4Channel(values, params.quality, block);
+					ExtractChannel(texels, 1, values);
+					EncodeBC4Channel(values, params.quality, block + 8);
+					break;
+				}
+
+				case PixelFormat::BC6H:
+					EncodeBC6H(texels, params.quality, block);
+					break;
+
+				case PixelFormat::BC7:
+				case PixelFormat::BC7_SRGB:
+					EncodeBC7(texels, params.quality, block);
+					break;
+
+				case PixelFormat::DXT1:
+				{
+					UInt16 transparentMask = 0;
+					for (UInt32 i = 0; i < 16; ++i)
+					{
+						if (texels[i * 4 + 3] < params.alphaThreshold)
+							transparentMask |= UInt16(1 << i);
+					}
+
+					EncodeBC1Color(LoadTexels(texels), transparentMask, false, params.quality, block);
+					break;
+				}
+
+				case PixelFormat::DXT3:
+				{
+					UInt64 alphaBits = 0;
+					for (UInt32 i = 0; i < 16; ++i)
+						alphaBits |= UInt64((texels[i * 4 + 3] + 8) / 17) << (i * 4);
+
+					for (UInt32 i = 0; i < 8; ++i)
+						block[i] = UInt8(alphaBits >> (i * 8));
+
+					EncodeBC1Color(LoadTexels(texels), 0, true, params.quality, block + 8);
+					break;
+				}
+
+				case PixelFormat::DXT5:
+				{
+					UInt8 values[16];
+					ExtractChannel(texels, 3, values);
+					EncodeBC4Channel(values, params.quality, block);
+					EncodeBC1Color(LoadTexels(texels), 0, true, params.quality, block + 8);
+					break;
+				}
+
+				default:
+					NazaraAssertFmt(false, "unhandled compressed format {0}", PixelFormatInfo::GetName(format));
+					break;
+			}
+		}
+
+		bool DecodeBlock(PixelFormat format, const UInt8* block, UInt8* texels)
+		{
+			NAZARA_USE_ANONYMOUS_NAMESPACE
+
+			switch (format)
+			{
+				case PixelFormat::BC4:
+				case PixelFormat::BC5:
+				{
+					for (UInt32 i = 0; i < 16; ++i)
+					{
+						texels[i * 4 + 1] = 0;
+						texels[i * 4 + 2] = 0;
+						texels[i * 4 + 3] = 255;
+					}
+
+					DecodeBC4Channel(block, texels, 4);
+					if (format == PixelFormat::BC5)
+						DecodeBC4Channel(block + 8, texels + 1, 4);
+
+					return true;
+				}
+
+				case PixelFormat::BC6H:
+					return DecodeBC6H(block, texels);
+
+				case PixelFormat::BC7:
+				case PixelFormat::BC7_SRGB:
+					return DecodeBC7(block, texels);
+
+				case PixelFormat::DXT1:
+					DecodeBC1Color(block, false, texels);
+					return true;
+
+				case PixelFormat::DXT3:
+				{
+					DecodeBC1Color(block + 8, true, texels);
+					for (UInt32 i = 0; i < 16; ++i)
+						texels[i * 4 + 3] = UInt8(((block[i / 2] >> ((i % 2) * 4)) & 0xF) * 17);
+
+					return true;
+				}
+
+				case PixelFormat::DXT5:
+					DecodeBC1Color(block + 8, true, texels);
+					DecodeBC4Channel(block, texels + 3, 4);
+					return true;
+
+				default:
+					break;
+			}
+
+			NazaraErrorFmt("unhandled compressed format {0}", PixelFormatInfo::GetName(format));
+			return false;
+		}
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_BLOCKCOMPRESSION_HPP
+#define NAZARA_CORE_BLOCKCOMPRESSION_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+
+namespace Nz::BlockCompression
+{
+	// Texels are the 4x4 texels of a block in row-major order, stored using PixelFormatInfo::GetDecompressedFormat(format)
+	void EncodeBlock(PixelFormat format, const UInt8* texels, UInt8* block, const BlockCompressionParams& params);
+	bool DecodeBlock(PixelFormat format, const UInt8* block, UInt8* texels);
+}
+
+#endif // NAZARA_CORE_BLOCKCOMPRESSION_HPP
@@ -0,0 +1,190 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/BufferedImageStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ImageStream.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/ThreadExt.hpp>
+
+namespace Nz
+{
+	BufferedImageStream::BufferedImageStream(std::shared_ptr<ImageStream> imageStream, std::size_t bufferedFrameCount, bool loop) :
+	m_imageStream(std::move(imageStream)),
+	m_readIndex(0),
+	m_readyFrameCount(0),
+	m_seekFrameIndex(0),
+	m_hasPendingSeek(false),
+	m_hasPresentedFrame(false),
+	m_isEndReached(false),
+	m_isLooping(loop),
+	m_stopDecoder(false)
+	{
+		NazaraAssert(m_imageStream, "invalid image stream");
+		NazaraAssert(bufferedFrameCount >= 2, "at least two frames must be buffered");
+
+		// Properties are cached as the image stream belongs to the decoder thread from now on
+		m_frameCount = m_imageStream->GetFrameCount();
+		m_pixelFormat = m_imageStream->GetPixelFormat();
+		m_size = m_imageStream->GetSize();
+
+		// Every frame lives in a single allocation, decoding never allocates
+		m_frameSize = PixelFormatInfo::ComputeSize(m_pixelFormat, m_size.x, m_size.y, 1);
+		m_frameArena = std::make_unique<UInt8[]>(m_frameSize * bufferedFrameCount);
+
+		m_frames.resize(bufferedFrameCount);
+		for (std::size_t i = 0; i < bufferedFrameCount; ++i)
+		{
+			m_frames[i].pixels = &m_frameArena[i * m_frameSize];
+			m_frames[i].index = 0;
+			m_frames[i].time = Time::Zero();
+		}
+
+		m_decoderThread = std::thread(&BufferedImageStream::DecoderThread, this);
+	}
+
+	BufferedImageStream::~BufferedImageStream()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_stopDecoder = true;
+		}
+		m_decoderCondition.notify_one();
+
+		m_decoderThread.join();
+	}
+
+	/*!
+	* \brief Returns the most recent decoded frame whose presentation time is before timestamp, without waiting for the decoder
+	* \return Frame to present or nullptr if no frame is ready yet
+	*
+	* Frames older than the returned one are given back to the decoder, the returned frame stays valid until the next call to FetchFrame or Seek.
+	* If the next frame isn't decoded yet, the previously returned frame is returned again.
+	*/
+	const BufferedImageStream::Frame* BufferedImageStream::FetchFrame(Time timestamp)
+	{
+		bool releasedFrames = false;
+		const Frame* frame = nullptr;
+		{
+			std::lock_guard lock(m_mutex);
+
+			while (m_readyFrameCount > 0 && m_frames[m_readIndex].time <= timestamp)
+			{
+				m_hasPresentedFrame = true;
+				m_readIndex = (m_readIndex + 1) % m_frames.size();
+				m_readyFrameCount--;
+
+				releasedFrames = true;
+			}
+
+			if (m_hasPresentedFrame)
+				frame = &m_frames[(m_readIndex + m_frames.size() - 1) % m_frames.size()];
+		}
+
+		if (releasedFrames)
+			m_decoderCondition.notify_one();
+
+		return frame;
+	}
+
+	std::size_t BufferedImageStream::GetReadyFrameCount() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_readyFrameCount;
+	}
+
+	bool BufferedImageStream::IsFinished() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_isEndReached && m_readyFrameCount == 0;
+	}
+
+	/*!
+	* \brief Drops every buffered frame and restarts decoding at frameIndex
+	*
+	* This doesn't wait for the decoder, FetchFrame will return nullptr until the first frame is decoded.
+	*/
+	void BufferedImageStream::Seek(UInt64 frameIndex)
+	{
+		NazaraAssertFmt(frameIndex <= m_frameCount, "frame index out of range ({0} > {1})", frameIndex, m_frameCount);
+
+		{
+			std::lock_guard lock(m_mutex);
+			m_hasPendingSeek = true;
+			m_hasPresentedFrame = false;
+			m_isEndReached = false;
+			m_readyFrameCount = 0;
+			m_seekFrameIndex = frameIndex;
+		}
+		m_decoderCondition.notify_one();
+	}
+
+	void BufferedImageStream::DecoderThread()
+	{
+		SetCurrentThreadName("NzImageStreamDecoder");
+
+		UInt64 frameIndex = m_imageStream->Tell();
+		Time timeOffset = Time::Zero();
+
+		std::unique_lock lock(m_mutex);
+		for (;;)
+		{
+			m_decoderCondition.wait(lock, [&] { return m_stopDecoder || m_hasPendingSeek || (!m_isEndReached && HasFreeFrame()); });
+			if (m_stopDecoder)
+				break;
+
+			if (m_hasPendingSeek)
+			{
+				m_hasPendingSeek = false;
+
+				frameIndex = m_seekFrameIndex;
+				timeOffset = Time::Zero();
+
+				// Seeking may have to decode the previous frames (GIF), don't block the consumer in the meantime
+				lock.unlock();
+				m_imageStream->Seek(frameIndex);
+				lock.lock();
+				continue;
+			}
+
+			// Frames are consumed in order, so the slot following the ready frames is never read until it's published
+			std::size_t writeIndex = (m_readIndex + m_readyFrameCount) % m_frames.size();
+
+			lock.unlock();
+
+			Time frameTime;
+			bool decoded = m_imageStream->DecodeNextFrame(&m_frameArena[writeIndex * m_frameSize], &frameTime);
+
+			lock.lock();
+
+			// The consumer seeked during decoding, this frame is outdated
+			if (m_hasPendingSeek || m_stopDecoder)
+				continue;
+
+			if (!decoded)
+			{
+				// frameTime holds the end of the stream
+				if (m_isLooping && frameIndex > 0)
+				{
+					frameIndex = 0;
+					timeOffset += frameTime;
+
+					lock.unlock();
+					m_imageStream->Seek(0);
+					lock.lock();
+				}
+				else
+					m_isEndReached = true;
+
+				continue;
+			}
+
+			Frame& frame = m_frames[writeIndex];
+			frame.index = frameIndex++;
+			frame.time = timeOffset + frameTime;
+
+			m_readyFrameCount++;
+		}
+	}
+}
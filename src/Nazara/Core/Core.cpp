@@ -17,6 +17,7 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/VertexDeclaration.hpp>
 #include <Nazara/Core/Formats/DDSLoader.hpp>
+#include <Nazara/Core/Formats/DDSSaver.hpp>
 #include <Nazara/Core/Formats/GIFLoader.hpp>
 #include <Nazara/Core/Formats/MD2Loader.hpp>
 #include <Nazara/Core/Formats/MD5AnimLoader.hpp>
@@ -70,6 +71,7 @@ namespace Nz
 
 		// Image
 		m_imageLoader.RegisterLoader(Loaders::GetImageLoader_DDS()); // DDS Loader (DirectX format)
+		m_imageSaver.RegisterSaver(Loaders::GetImageSaver_DDS()); // DDS Saver (DirectX format, keeps mipmaps and layers)
 		m_imageLoader.RegisterLoader(Loaders::GetImageLoader_PCX()); // .pcx loader (1, 4, 8, 24 bits)
 	}
 
@@ -3,9 +3,166 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/Formats/DDSConstants.hpp>
+#include <array>
+#include <utility>
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// When multiple DXGI formats map to the same pixel format, the first one is used when saving
+		constexpr std::array s_formatMapping = {
+			std::make_pair(DXGI_FORMAT_A8_UNORM,             PixelFormat::A8),
+			std::make_pair(DXGI_FORMAT_B8G8R8A8_UNORM,       PixelFormat::BGRA8),
+			std::make_pair(DXGI_FORMAT_B8G8R8A8_UNORM_SRGB,  PixelFormat::BGRA8_SRGB),
+			std::make_pair(DXGI_FORMAT_BC1_UNORM,            PixelFormat::DXT1),
+			std::make_pair(DXGI_FORMAT_BC2_UNORM,            PixelFormat::DXT3),
+			std::make_pair(DXGI_FORMAT_BC3_UNORM,            PixelFormat::DXT5),
+			std::make_pair(DXGI_FORMAT_BC4_UNORM,            PixelFormat::BC4),
+			std::make_pair(DXGI_FORMAT_BC5_UNORM,            PixelFormat::BC5),
+			std::make_pair(DXGI_FORMAT_BC6H_UF16,            PixelFormat::BC6H),
+			std::make_pair(DXGI_FORMAT_BC7_UNORM,            PixelFormat::BC7),
+			std::make_pair(DXGI_FORMAT_BC7_UNORM_SRGB,       PixelFormat::BC7_SRGB),
+			std::make_pair(DXGI_FORMAT_R8_UNORM,             PixelFormat::R8),
+			std::make_pair(DXGI_FORMAT_R8_SINT,              PixelFormat::R8I),
+			std::make_pair(DXGI_FORMAT_R8_UINT,              PixelFormat::R8UI),
+			std::make_pair(DXGI_FORMAT_R16_UNORM,            PixelFormat::R16),
+			std::make_pair(DXGI_FORMAT_R16_FLOAT,            PixelFormat::R16F),
+			std::make_pair(DXGI_FORMAT_R16_SINT,             PixelFormat::R16I),
+			std::make_pair(DXGI_FORMAT_R16_UINT,             PixelFormat::R16UI),
+			std::make_pair(DXGI_FORMAT_R32_FLOAT,            PixelFormat::R32F),
+			std::make_pair(DXGI_FORMAT_R32_SINT,             PixelFormat::R32I),
+			std::make_pair(DXGI_FORMAT_R32_UINT,             PixelFormat::R32UI),
+			std::make_pair(DXGI_FORMAT_R8G8_UNORM,           PixelFormat::RG8),
+			std::make_pair(DXGI_FORMAT_R8G8_SINT,            PixelFormat::RG8I),
+			std::make_pair(DXGI_FORMAT_R8G8_UINT,            PixelFormat::RG8UI),
+			std::make_pair(DXGI_FORMAT_R16G16_UNORM,         PixelFormat::RG16),
+			std::make_pair(DXGI_FORMAT_R16G16_FLOAT,         PixelFormat::RG16F),
+			std::make_pair(DXGI_FORMAT_R16G16_SINT,          PixelFormat::RG16I),
+			std::make_pair(DXGI_FORMAT_R16G16_UINT,          PixelFormat::RG16UI),
+			std::make_pair(DXGI_FORMAT_R32G32_FLOAT,         PixelFormat::RG32F),
+			std::make_pair(DXGI_FORMAT_R32G32_SINT,          PixelFormat::RG32I),
+			std::make_pair(DXGI_FORMAT_R32G32_UINT,          PixelFormat::RG32UI),
+			std::make_pair(DXGI_FORMAT_R32G32B32_FLOAT,      PixelFormat::RGB32F),
+			std::make_pair(DXGI_FORMAT_R32G32B32_SINT,       PixelFormat::RGB32I),
+			std::make_pair(DXGI_FORMAT_R32G32B32_UINT,       PixelFormat::RGB32UI),
+			std::make_pair(DXGI_FORMAT_R8G8B8A8_UNORM,       PixelFormat::RGBA8),
+			std::make_pair(DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,  PixelFormat::RGBA8_SRGB),
+			std::make_pair(DXGI_FORMAT_R16G16B16A16_FLOAT,   PixelFormat::RGBA16F),
+			std::make_pair(DXGI_FORMAT_R16G16B16A16_SINT,    PixelFormat::RGBA16I),
+			std::make_pair(DXGI_FORMAT_R16G16B16A16_UINT,    PixelFormat::RGBA16UI),
+			std::make_pair(DXGI_FORMAT_R32G32B32A32_FLOAT,   PixelFormat::RGBA32F),
+			std::make_pair(DXGI_FORMAT_R32G32B32A32_SINT,    PixelFormat::RGBA32I),
+			std::make_pair(DXGI_FORMAT_R32G32B32A32_UINT,    PixelFormat::RGBA32UI),
+
+			// Load-only (no matching normalized format)
+			std::make_pair(DXGI_FORMAT_R16G16B16A16_SNORM,   PixelFormat::RGBA16I),
+			std::make_pair(DXGI_FORMAT_R16G16B16A16_UNORM,   PixelFormat::RGBA16UI)
+		};
+	}
+
+	DXGI_FORMAT GetDXGIFormat(PixelFormat format)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		for (auto&& [dxgiFormat, pixelFormat] : s_formatMapping)
+		{
+			if (pixelFormat == format)
+				return dxgiFormat;
+		}
+
+		return DXGI_FORMAT_UNKNOWN;
+	}
+
+	PixelFormat GetPixelFormat(DXGI_FORMAT format)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		for (auto&& [dxgiFormat, pixelFormat] : s_formatMapping)
+		{
+			if (dxgiFormat == format)
+				return pixelFormat;
+		}
+
+		return PixelFormat::Undefined;
+	}
+
+	bool Serialize(SerializationContext& context, const DDSHeader& header)
+	{
+		if (!Serialize(context, header.size))
+			return false;
+		if (!Serialize(context, header.flags))
+			return false;
+		if (!Serialize(context, header.height))
+			return false;
+		if (!Serialize(context, header.width))
+			return false;
+		if (!Serialize(context, header.pitch))
+			return false;
+		if (!Serialize(context, header.depth))
+			return false;
+		if (!Serialize(context, header.levelCount))
+			return false;
+
+		for (unsigned int i = 0; i < CountOf(header.reserved1); ++i)
+		{
+			if (!Serialize(context, header.reserved1[i]))
+				return false;
+		}
+
+		if (!Serialize(context, header.format))
+			return false;
+
+		for (unsigned int i = 0; i < CountOf(header.ddsCaps); ++i)
+		{
+			if (!Serialize(context, header.ddsCaps[i]))
+				return false;
+		}
+
+		if (!Serialize(context, header.reserved2))
+			return false;
+
+		return true;
+	}
+
+	bool Serialize(SerializationContext& context, const DDSHeaderDX10Ext& header)
+	{
+		if (!Serialize(context, UInt32(header.dxgiFormat)))
+			return false;
+		if (!Serialize(context, UInt32(header.resourceDimension)))
+			return false;
+		if (!Serialize(context, header.miscFlag))
+			return false;
+		if (!Serialize(context, header.arraySize))
+			return false;
+		if (!Serialize(context, header.reserved))
+			return false;
+
+		return true;
+	}
+
+	bool Serialize(SerializationContext& context, const DDSPixelFormat& pixelFormat)
+	{
+		if (!Serialize(context, pixelFormat.size))
+			return false;
+		if (!Serialize(context, pixelFormat.flags))
+			return false;
+		if (!Serialize(context, pixelFormat.fourCC))
+			return false;
+		if (!Serialize(context, pixelFormat.bpp))
+			return false;
+		if (!Serialize(context, pixelFormat.redMask))
+			return false;
+		if (!Serialize(context, pixelFormat.greenMask))
+			return false;
+		if (!Serialize(context, pixelFormat.blueMask))
+			return false;
+		if (!Serialize(context, pixelFormat.alphaMask))
+			return false;
+
+		return true;
+	}
+
 	bool Unserialize(SerializationContext& context, DDSHeader* header)
 	{
 		if (!Unserialize(context, &header->size))
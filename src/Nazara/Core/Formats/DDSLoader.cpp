@@ -59,7 +59,9 @@ namespace Nz
 				if (header.flags & DDSD_DEPTH)
 					depth = std::max(header.depth, 1U);
 
-				UInt8 levelCount = (parameters.levelCount > 0) ? std::min(parameters.levelCount, SafeCast<UInt8>(header.levelCount)) : SafeCast<UInt8>(header.levelCount);
+				// A DDS file without mipmap count has a single level
+				UInt8 fileLevelCount = SafeCast<UInt8>(std::max(header.levelCount, 1U));
+				UInt8 levelCount = (parameters.levelCount > 0) ? std::min(parameters.levelCount, fileLevelCount) : fileLevelCount;
 
 				// First, identify the type
 				ImageType type;
@@ -71,32 +73,45 @@ namespace Nz
 				if (!IdentifyPixelFormat(header, headerDX10, &format))
 					return Nz::Err(ResourceLoadingError::Unsupported);
 
-				std::shared_ptr<Image> image = std::make_shared<Image>(type, format, width, height, depth, levelCount);
-
-				// Read all mipmap levels
-				for (UInt8 i = 0; i < image->GetLevelCount(); i++)
+				unsigned int layerCount = 1;
+				if (type == ImageType::Cubemap)
+					layerCount = 6;
+				else if (type == ImageType::E2D_Array)
 				{
-					std::size_t byteCount = PixelFormatInfo::ComputeSize(format, width, height, depth);
+					layerCount = headerDX10.arraySize;
+					depth = layerCount;
+				}
 
-					UInt8* ptr = image->GetPixels(0, 0, 0, i);
+				std::shared_ptr<Image> image = std::make_shared<Image>(type, format, width, height, depth, levelCount);
+				levelCount = image->GetLevelCount();
 
-					if (byteStream.Read(ptr, byteCount) != byteCount)
+				// Layered images are stored as a complete mipmap chain per layer, whereas Image stores all layers of a level together
+				for (unsigned int layer = 0; layer < layerCount; ++layer)
+				{
+					for (UInt8 level = 0; level < fileLevelCount; ++level)
 					{
-						NazaraErrorFmt("failed to read level #{0}", i);
-						return Nz::Err(ResourceLoadingError::DecodingError);
-					}
-
-					if (width > 1)
-						width >>= 1;
+						std::size_t byteCount = PixelFormatInfo::ComputeSize(format, std::max(width >> level, 1U), std::max(height >> level, 1U), (type == ImageType::E3D) ? std::max(depth >> level, 1U) : 1U);
+						if (level >= levelCount)
+						{
+							// Skip levels we're not interested in (only required if another layer follows)
+							if (layer + 1 < layerCount && !stream.SetCursorPos(stream.GetCursorPos() + byteCount))
+							{
+								NazaraErrorFmt("failed to skip level #{0}", level);
+								return Nz::Err(ResourceLoadingError::DecodingError);
+							}
 
-					if (height > 1)
-						height >>= 1;
+							continue;
+						}
 
-					if (depth > 1)
-						depth >>= 1;
+						UInt8* ptr = image->GetPixels(0, 0, 0, level) + layer * byteCount;
+						if (byteStream.Read(ptr, byteCount) != byteCount)
+						{
+							NazaraErrorFmt("failed to read level #{0}", level);
+							return Nz::Err(ResourceLoadingError::DecodingError);
+						}
+					}
 				}
 
-
 				if (parameters.loadFormat != PixelFormat::Undefined)
 					image->Convert(parameters.loadFormat);
 
@@ -182,44 +197,26 @@ namespace Nz
 							break;
 
 						case D3DFMT_DXT5:
-							*format = PixelFormat::DXT3;
+							*format = PixelFormat::DXT5;
+							break;
+
+						case D3DFMT_ATI1:
+						case D3DFMT_BC4U:
+							*format = PixelFormat::BC4;
+							break;
+
+						case D3DFMT_ATI2:
+						case D3DFMT_BC5U:
+							*format = PixelFormat::BC5;
 							break;
 
 						case D3DFMT_DX10:
 						{
-							switch (headerExt.dxgiFormat)
+							*format = GetPixelFormat(headerExt.dxgiFormat);
+							if (*format == PixelFormat::Undefined)
 							{
-								case DXGI_FORMAT_R32G32B32A32_FLOAT:
-									*format = PixelFormat::RGBA32F;
-									break;
-								case DXGI_FORMAT_R32G32B32A32_UINT:
-									*format = PixelFormat::RGBA32UI;
-									break;
-								case DXGI_FORMAT_R32G32B32A32_SINT:
-									*format = PixelFormat::RGBA32I;
-									break;
-								case DXGI_FORMAT_R32G32B32_FLOAT:
-									*format = PixelFormat::RGB32F;
-									break;
-								case DXGI_FORMAT_R32G32B32_UINT:
-									//*format = PixelFormat::RGB32U;
-									return false;
-								case DXGI_FORMAT_R32G32B32_SINT:
-									*format = PixelFormat::RGB32I;
-									break;
-								case DXGI_FORMAT_R16G16B16A16_SNORM:
-								case DXGI_FORMAT_R16G16B16A16_SINT:
-								case DXGI_FORMAT_R16G16B16A16_UINT:
-									*format = PixelFormat::RGBA16I;
-									break;
-								case DXGI_FORMAT_R16G16B16A16_UNORM:
-									*format = PixelFormat::RGBA16UI;
-									break;
-
-								default:
-									//TODO
-									NazaraError("TODO");
-									break;
+								NazaraErrorFmt("unhandled DXGI format {0}", UnderlyingCast(headerExt.dxgiFormat));
+								return false;
 							}
 							break;
 						}
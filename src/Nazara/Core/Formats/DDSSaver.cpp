@@ -0,0 +1,190 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Formats/DDSSaver.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/Formats/DDSConstants.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Formats without a DXGI equivalent are saved using the closest format able to represent them
+		PixelFormat GetFallbackFormat(PixelFormat format)
+		{
+			switch (format)
+			{
+				case PixelFormat::BGR8_SRGB:
+				case PixelFormat::RGB8_SRGB:
+					return PixelFormat::RGBA8_SRGB;
+
+				case PixelFormat::RGB16F:
+					return PixelFormat::RGBA16F;
+
+				case PixelFormat::RGB16I:
+					return PixelFormat::RGBA16I;
+
+				case PixelFormat::RGB16UI:
+					return PixelFormat::RGBA16UI;
+
+				default:
+					return PixelFormat::RGBA8;
+			}
+		}
+
+		bool IsSupported(std::string_view extension)
+		{
+			return extension == ".dds";
+		}
+
+		bool SaveToStream(const Image& image, std::string_view format, Stream& stream, const ImageParams& parameters)
+		{
+			NazaraUnused(format);
+			NazaraUnused(parameters);
+
+			if (!image.IsValid())
+			{
+				NazaraError("invalid image");
+				return false;
+			}
+
+			ImageType type = image.GetType();
+			if (type == ImageType::E1D_Array)
+			{
+				NazaraError("1D texture arrays are not supported");
+				return false;
+			}
+
+			Image tempImage(image); //< We're using COW here to prevent Image copy unless required
+
+			DXGI_FORMAT dxgiFormat = GetDXGIFormat(tempImage.GetFormat());
+			if (dxgiFormat == DXGI_FORMAT_UNKNOWN)
+			{
+				PixelFormat fallbackFormat = GetFallbackFormat(tempImage.GetFormat());
+				if (!tempImage.Convert(fallbackFormat))
+				{
+					NazaraErrorFmt("failed to convert image from {0} to {1}", PixelFormatInfo::GetName(tempImage.GetFormat()), PixelFormatInfo::GetName(fallbackFormat));
+					return false;
+				}
+
+				dxgiFormat = GetDXGIFormat(fallbackFormat);
+			}
+
+			PixelFormat pixelFormat = tempImage.GetFormat();
+			bool isCompressed = PixelFormatInfo::IsCompressed(pixelFormat);
+			UInt8 levelCount = tempImage.GetLevelCount();
+
+			DDSHeader header = {};
+			header.size = 124;
+			header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
+			header.width = tempImage.GetWidth();
+			header.height = tempImage.GetHeight();
+			header.levelCount = levelCount;
+			header.format.size = 32;
+			header.format.flags = DDPF_FOURCC;
+			header.format.fourCC = D3DFMT_DX10;
+			header.ddsCaps[0] = DDSCAPS_TEXTURE;
+
+			if (isCompressed)
+			{
+				header.flags |= DDSD_LINEARSIZE;
+				header.pitch = SafeCast<UInt32>(PixelFormatInfo::ComputeSize(pixelFormat, header.width, header.height, 1));
+			}
+			else
+			{
+				header.flags |= DDSD_PITCH;
+				header.pitch = header.width * PixelFormatInfo::GetBytesPerPixel(pixelFormat);
+			}
+
+			if (levelCount > 1)
+			{
+				header.flags |= DDSD_MIPMAPCOUNT;
+				header.ddsCaps[0] |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+			}
+
+			DDSHeaderDX10Ext headerDX10 = {};
+			headerDX10.dxgiFormat = dxgiFormat;
+			headerDX10.arraySize = 1;
+
+			unsigned int layerCount = 1;
+			switch (type)
+			{
+				case ImageType::E1D:
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE1D;
+					break;
+
+				case ImageType::E2D:
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+					break;
+
+				case ImageType::E2D_Array:
+					layerCount = tempImage.GetDepth();
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+					headerDX10.arraySize = layerCount;
+					break;
+
+				case ImageType::E3D:
+					header.flags |= DDSD_DEPTH;
+					header.depth = tempImage.GetDepth();
+					header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+					header.ddsCaps[1] |= DDSCAPS2_VOLUME;
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE3D;
+					break;
+
+				case ImageType::Cubemap:
+					layerCount = 6;
+					header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+					header.ddsCaps[1] |= DDSCAPS2_CUBEMAP | DDSCAPS2_CUBEMAP_ALLFACES;
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+					headerDX10.miscFlag = D3D10_RESOURCE_MISC_TEXTURECUBE;
+					break;
+
+				case ImageType::E1D_Array:
+					break;
+			}
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness::LittleEndian);
+
+			byteStream << DDS_Magic;
+			byteStream << header;
+			byteStream << headerDX10;
+
+			// Layered images are stored as a complete mipmap chain per layer, whereas Image stores all layers of a level together
+			for (unsigned int layer = 0; layer < layerCount; ++layer)
+			{
+				for (UInt8 level = 0; level < levelCount; ++level)
+				{
+					std::size_t byteCount = tempImage.GetMemoryUsage(level) / layerCount;
+					const UInt8* ptr = tempImage.GetConstPixels(0, 0, 0, level) + layer * byteCount;
+
+					if (stream.Write(ptr, byteCount) != byteCount)
+					{
+						NazaraErrorFmt("failed to write level #{0}", level);
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		ImageSaver::Entry GetImageSaver_DDS()
+		{
+			NAZARA_USE_ANONYMOUS_NAMESPACE
+
+			ImageSaver::Entry entry;
+			entry.formatSupport = IsSupported;
+			entry.streamSaver = SaveToStream;
+
+			return entry;
+		}
+	}
+}
@@ -0,0 +1,18 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_FORMATS_DDSSAVER_HPP
+#define NAZARA_CORE_FORMATS_DDSSAVER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Image.hpp>
+
+namespace Nz::Loaders
+{
+	ImageSaver::Entry GetImageSaver_DDS();
+}
+
+#endif // NAZARA_CORE_FORMATS_DDSSAVER_HPP
@@ -155,7 +155,7 @@ namespace Nz
 
 			stream.SetCursorPos(streamPos);
 
-			if (!parser.Parse(stream, reservedVertexCount))
+			if (!parser.Parse(stream, reservedVertexCount, parameters.taskScheduler))
 			{
 				NazaraError("OBJ parser failed");
 				return Err(ResourceLoadingError::DecodingError);
@@ -256,9 +256,6 @@ namespace Nz
 
 				indexMapper.Unmap(); // Pour laisser les autres tâches affecter l'index buffer
 
-				if (parameters.optimizeIndexBuffers)
-					indexBuffer->Optimize();
-
 				// Remplissage des vertices
 
 				bool hasNormals = true;
@@ -334,6 +331,13 @@ namespace Nz
 			}
 			mesh->SetMaterialCount(parser.GetMaterialCount());
 
+			// Optimisation des triangles (cache, overdraw) et des vertices (ordre d'utilisation), une fois les positions connues
+			if (parameters.optimizeIndexBuffers)
+				mesh->Optimize(parameters.taskScheduler);
+
+			if (parameters.lodCount > 0)
+				mesh->GenerateLods(parameters);
+
 			if (parameters.center)
 				mesh->Recenter();
 
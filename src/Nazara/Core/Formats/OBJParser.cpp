@@ -6,10 +6,16 @@
 #include <Nazara/Core/Export.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
+#include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/PathUtils.hpp>
 #include <tsl/ordered_map.h>
+#include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <unordered_map>
 
@@ -17,6 +23,446 @@
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Files smaller than two chunks are parsed on the calling thread
+		constexpr std::size_t MinChunkSize = 1024 * 1024;
+
+		// Shortest line declaring an element ("f 1 2 3" or "v 0 0 0" and its line ending), used to bound count hints
+		constexpr std::size_t MinElementLineSize = 8;
+
+		enum class CommandType
+		{
+			Face,
+			FaceCountHint,
+			Group,
+			InvalidFace,
+			MtlLib,
+			Unrecognized,
+			UseMtl,
+			VertexCountHint
+		};
+
+		struct Command
+		{
+			CommandType type;
+			unsigned int line;
+			std::size_t data; //< first face vertex for faces, count for hints, string index otherwise
+			std::size_t vertexCount;
+			std::size_t normalCount;
+			std::size_t positionCount;
+			std::size_t texCoordCount;
+		};
+
+		struct RawFaceVertex
+		{
+			int normal;
+			int position;
+			int texCoord;
+		};
+
+		struct ParsedChunk
+		{
+			std::string_view content;
+			std::vector<Command> commands;
+			std::vector<RawFaceVertex> faceVertices;
+			std::vector<std::string> strings;
+			std::vector<Vector3f> normals;
+			std::vector<Vector4f> positions;
+			std::vector<Vector3f> texCoords;
+			unsigned int lineCount = 0;
+		};
+
+		bool IsWhitespace(char c)
+		{
+			switch (c)
+			{
+				case ' ':
+				case '\f':
+				case '\n':
+				case '\r':
+				case '\t':
+				case '\v':
+					return true;
+
+				default:
+					return false;
+			}
+		}
+
+		// Mimics scanf %d/%f behavior: leading whitespaces are skipped and cursor is left untouched on failure
+		template<typename T>
+		bool ParseNumber(const char*& cursor, const char* end, T& value)
+		{
+			const char* ptr = cursor;
+			while (ptr != end && IsWhitespace(*ptr))
+				++ptr;
+
+			if (ptr != end && *ptr == '+')
+			{
+				++ptr;
+				if (ptr != end && *ptr == '-')
+					return false;
+			}
+
+			if constexpr (std::is_floating_point_v<T>)
+			{
+#ifdef __cpp_lib_to_chars
+				auto [last, ec] = std::from_chars(ptr, end, value);
+				if (ec == std::errc{})
+				{
+					cursor = last;
+					return true;
+				}
+				else if (ec != std::errc::result_out_of_range)
+					return false;
+
+				// Out of range values are handled by strtof, which gives infinity or zero like sscanf did
+#endif
+				// Also used when floating-point std::from_chars is not available on this standard library
+				char buffer[64];
+				std::size_t length = std::min<std::size_t>(end - ptr, CountOf(buffer) - 1);
+				std::memcpy(buffer, ptr, length);
+				buffer[length] = '\0';
+
+				char* bufferLast;
+				value = std::strtof(buffer, &bufferLast);
+				if (bufferLast == buffer)
+					return false;
+
+				cursor = ptr + (bufferLast - buffer);
+			}
+			else
+			{
+				auto [last, ec] = std::from_chars(ptr, end, value);
+				if (ec != std::errc{})
+					return false;
+
+				cursor = last;
+			}
+
+			return true;
+		}
+
+		// Parses p, p/t, p//n or p/t/n the same way the previous sscanf-based parser did
+		bool ParseFaceVertex(const char*& cursor, const char* end, RawFaceVertex& vertex)
+		{
+			const char* ptr = cursor;
+			if (!ParseNumber(ptr, end, vertex.position))
+				return false;
+
+			if (ptr != end && *ptr == '/')
+			{
+				const char* texCoordPtr = ptr + 1;
+				if (ParseNumber(texCoordPtr, end, vertex.texCoord))
+				{
+					if (texCoordPtr != end && *texCoordPtr == '/')
+					{
+						const char* normalPtr = texCoordPtr + 1;
+						if (ParseNumber(normalPtr, end, vertex.normal))
+						{
+							cursor = normalPtr;
+							return true;
+						}
+					}
+
+					cursor = texCoordPtr;
+					return true;
+				}
+				else if (texCoordPtr != end && *texCoordPtr == '/')
+				{
+					const char* normalPtr = texCoordPtr + 1;
+					if (ParseNumber(normalPtr, end, vertex.normal))
+					{
+						cursor = normalPtr;
+						return true;
+					}
+				}
+			}
+
+			cursor = ptr;
+			return true;
+		}
+
+		void ParseChunk(ParsedChunk& chunk)
+		{
+			auto PushCommand = [&](CommandType type, std::string_view str = {})
+			{
+				Command& command = chunk.commands.emplace_back();
+				command.type = type;
+				command.line = chunk.lineCount;
+				command.data = chunk.strings.size();
+
+				chunk.strings.emplace_back(str);
+			};
+
+			auto PushUnrecognized = [&](std::string_view line)
+			{
+				// Unrecognized lines are only reported in strict mode, don't bother storing them otherwise
+#if NAZARA_CORE_STRICT_RESOURCE_PARSING
+				PushCommand(CommandType::Unrecognized, line);
+#else
+				NazaraUnused(line);
+#endif
+			};
+
+			// Some softwares write comments to gives the number of vertex/faces an importer can expect
+			auto ParseCountHint = [&](std::string_view comment)
+			{
+				auto GetCount = [&](std::string_view prefix, std::size_t& count)
+				{
+					if (!StartsWith(comment, prefix))
+						return false;
+
+					const char* cursor = comment.data() + prefix.size();
+					unsigned int value;
+					if (!ParseNumber(cursor, comment.data() + comment.size(), value))
+						return false;
+
+					// Don't trust the hint further than what this chunk could hold
+					count = std::min<std::size_t>(value, chunk.content.size() / MinElementLineSize);
+					return true;
+				};
+
+				auto PushHint = [&](CommandType type, std::size_t count)
+				{
+					Command& command = chunk.commands.emplace_back();
+					command.type = type;
+					command.line = chunk.lineCount;
+					command.data = count;
+				};
+
+				std::size_t count;
+				if (GetCount("# position count:", count))
+					chunk.positions.reserve(count);
+				else if (GetCount("# normal count:", count))
+					chunk.normals.reserve(count);
+				else if (GetCount("# texcoords count:", count))
+					chunk.texCoords.reserve(count);
+				else if (GetCount("# face count:", count))
+					PushHint(CommandType::FaceCountHint, count);
+				else if (GetCount("# vertex count:", count))
+					PushHint(CommandType::VertexCountHint, count);
+			};
+
+			std::string_view content = chunk.content;
+			while (!content.empty())
+			{
+				std::size_t lineEnd = content.find('\n');
+				std::string_view line = content.substr(0, lineEnd);
+				content.remove_prefix((lineEnd != content.npos) ? lineEnd + 1 : content.size());
+
+				chunk.lineCount++;
+
+				if (std::size_t p = line.find('#'); p != line.npos)
+				{
+					if (Trim(line.substr(0, p)).empty())
+						ParseCountHint(line.substr(p));
+
+					if (p > 0)
+						line = line.substr(0, p - 1);
+					else
+						line = {};
+				}
+
+				line = Trim(line);
+				if (line.empty())
+					continue;
+
+				const char* lineEndPtr = line.data() + line.size();
+
+				switch (std::tolower(static_cast<unsigned char>(line[0])))
+				{
+					case 'f': //< Face
+					{
+						if (line.size() < 7) // Since we only treat triangles, this is the minimum length of a face line (f 1 2 3)
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						std::size_t vertexCount = std::count(line.begin(), line.end(), ' ');
+						if (vertexCount < 3)
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						std::size_t firstVertex = chunk.faceVertices.size();
+						chunk.faceVertices.resize(firstVertex + vertexCount);
+
+						bool error = false;
+						const char* cursor = line.data() + 2;
+						for (std::size_t i = 0; i < vertexCount; ++i)
+						{
+							RawFaceVertex& vertex = chunk.faceVertices[firstVertex + i];
+							vertex = RawFaceVertex{ 0, 0, 0 };
+
+							if (!ParseFaceVertex(cursor, lineEndPtr, vertex))
+							{
+								error = true;
+								break;
+							}
+						}
+
+						if (error)
+						{
+							chunk.faceVertices.resize(firstVertex);
+#if NAZARA_CORE_STRICT_RESOURCE_PARSING
+							PushCommand(CommandType::InvalidFace, line);
+#else
+							PushCommand(CommandType::InvalidFace);
+#endif
+							break;
+						}
+
+						Command& command = chunk.commands.emplace_back();
+						command.type = CommandType::Face;
+						command.line = chunk.lineCount;
+						command.data = firstVertex;
+						command.vertexCount = vertexCount;
+						command.normalCount = chunk.normals.size();
+						command.positionCount = chunk.positions.size();
+						command.texCoordCount = chunk.texCoords.size();
+						break;
+					}
+
+					case 'm': //< MTLLib
+					{
+						constexpr std::string_view prefix = "mtllib ";
+						if (!StartsWith(line, prefix))
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						PushCommand(CommandType::MtlLib, line.substr(prefix.size()));
+						break;
+					}
+
+					case 'g': //< Group (inside a mesh)
+					case 'o': //< Object (defines a mesh)
+					{
+						if (line.size() <= 2 || line[1] != ' ')
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						std::string_view objectName = line.substr(2);
+						if (objectName.empty())
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						PushCommand(CommandType::Group, objectName);
+						break;
+					}
+
+#if NAZARA_CORE_STRICT_RESOURCE_PARSING
+					case 's': //< Smooth
+						if (line.size() <= 2 || line[1] == ' ')
+						{
+							std::string_view param = (line.size() > 2) ? line.substr(2) : std::string_view{};
+							if (param != "all" && param != "on" && param != "off" && !IsNumber(param))
+								PushUnrecognized(line);
+						}
+						else
+							PushUnrecognized(line);
+						break;
+#endif
+
+					case 'u': //< Usemtl
+					{
+						constexpr std::string_view prefix = "usemtl ";
+						if (!StartsWith(line, prefix))
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						std::string_view newMatName = line.substr(prefix.size());
+						if (newMatName.empty())
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						PushCommand(CommandType::UseMtl, newMatName);
+						break;
+					}
+
+					case 'v': //< Position/Normal/Texcoords
+					{
+						if (line.size() < 7)
+						{
+							PushUnrecognized(line);
+							break;
+						}
+
+						if (IsWhitespace(line[1]))
+						{
+							Vector4f vertex(Vector3f::Zero(), 1.f);
+							const char* cursor = line.data() + 2;
+
+							unsigned int paramCount = 0;
+							for (float* component : { &vertex.x, &vertex.y, &vertex.z, &vertex.w })
+							{
+								if (!ParseNumber(cursor, lineEndPtr, *component))
+									break;
+
+								paramCount++;
+							}
+
+							if (paramCount >= 1)
+								chunk.positions.push_back(vertex);
+							else
+								PushUnrecognized(line);
+						}
+						else if ((line[1] == 'n' || line[1] == 't') && IsWhitespace(line[2]))
+						{
+							Vector3f value(Vector3f::Zero());
+							const char* cursor = line.data() + 3;
+
+							unsigned int paramCount = 0;
+							for (float* component : { &value.x, &value.y, &value.z })
+							{
+								if (!ParseNumber(cursor, lineEndPtr, *component))
+									break;
+
+								paramCount++;
+							}
+
+							if (line[1] == 'n')
+							{
+								if (paramCount == 3)
+									chunk.normals.push_back(value);
+								else
+									PushUnrecognized(line);
+							}
+							else
+							{
+								if (paramCount >= 2)
+									chunk.texCoords.push_back(value);
+								else
+									PushUnrecognized(line);
+							}
+						}
+						else
+							PushUnrecognized(line);
+
+						break;
+					}
+
+					default:
+						PushUnrecognized(line);
+						break;
+				}
+			}
+		}
+	}
+
 	bool OBJParser::Check(Stream& stream)
 	{
 		m_currentStream = &stream;
@@ -88,23 +534,59 @@ namespace Nz
 		return false;
 	}
 
-	bool OBJParser::Parse(Nz::Stream& stream, std::size_t reservedVertexCount)
+	bool OBJParser::Parse(Nz::Stream& stream, std::size_t reservedVertexCount, TaskScheduler* taskScheduler)
 	{
-		m_currentStream = &stream;
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
 		m_errorCount = 0;
-		m_keepLastLine = false;
 		m_lineCount = 0;
 
-		// force stream in text mode, reset it at the end
-		CallOnExit resetTextMode([&stream]
+		// Bulk read the remaining of the stream (or directly use the mapped memory if possible), line splitting is handled by the chunk parser
+		std::string_view fileContent;
+		std::unique_ptr<char[]> fileBuffer;
+
+		UInt64 cursorPos = stream.GetCursorPos();
+		UInt64 streamSize = stream.GetSize();
+		std::size_t contentSize = (streamSize > cursorPos) ? SafeCast<std::size_t>(streamSize - cursorPos) : 0;
+		if (stream.IsMemoryMapped())
 		{
-			stream.EnableTextMode(false);
-		});
+			fileContent = std::string_view(static_cast<const char*>(stream.GetMappedPointer()) + cursorPos, contentSize);
+			stream.SetCursorPos(streamSize);
+		}
+		else
+		{
+			fileBuffer = std::make_unique<char[]>(contentSize);
+			contentSize = stream.Read(fileBuffer.get(), contentSize);
+			fileContent = std::string_view(fileBuffer.get(), contentSize);
+		}
 
-		if ((stream.GetStreamOptions() & StreamOption::Text) == 0)
-			stream.EnableTextMode(true);
+		// Split the file in chunks at line boundaries, each chunk is parsed independently (and in parallel if we can)
+		std::size_t chunkCount = 1;
+		if (taskScheduler && fileContent.size() >= MinChunkSize * 2)
+			chunkCount = std::min<std::size_t>(fileContent.size() / MinChunkSize, taskScheduler->GetWorkerCount() * 4);
+
+		std::vector<ParsedChunk> chunks(chunkCount);
+		{
+			std::size_t chunkBegin = 0;
+			for (std::size_t i = 0; i < chunkCount; ++i)
+			{
+				std::size_t chunkEnd = fileContent.size();
+				if (i != chunkCount - 1)
+				{
+					chunkEnd = std::max(chunkBegin, fileContent.size() * (i + 1) / chunkCount);
+					chunkEnd = fileContent.find('\n', chunkEnd);
+					chunkEnd = (chunkEnd != fileContent.npos) ? chunkEnd + 1 : fileContent.size();
+				}
+
+				chunks[i].content = fileContent.substr(chunkBegin, chunkEnd - chunkBegin);
+				chunkBegin = chunkEnd;
+			}
+		}
+
+		if (chunkCount > 1)
+			taskScheduler->ParallelFor(chunkCount, [&](std::size_t chunkIndex) { ParseChunk(chunks[chunkIndex]); });
 		else
-			resetTextMode.Reset();
+			ParseChunk(chunks.front());
 
 		std::string matName, meshName;
 		matName = meshName = "default";
@@ -115,17 +597,26 @@ namespace Nz
 		m_positions.clear();
 		m_texCoords.clear();
 
-		// Reserve some space for incoming vertices
-		m_normals.reserve(reservedVertexCount);
-		m_positions.reserve(reservedVertexCount);
-		m_texCoords.reserve(reservedVertexCount);
+		std::size_t normalCount = 0;
+		std::size_t positionCount = 0;
+		std::size_t texCoordCount = 0;
+		for (const ParsedChunk& chunk : chunks)
+		{
+			normalCount += chunk.normals.size();
+			positionCount += chunk.positions.size();
+			texCoordCount += chunk.texCoords.size();
+		}
+
+		m_normals.reserve(std::max(normalCount, reservedVertexCount));
+		m_positions.reserve(std::max(positionCount, reservedVertexCount));
+		m_texCoords.reserve(std::max(texCoordCount, reservedVertexCount));
 
 		// Sort meshes by material and group
 		using MatPair = std::pair<Mesh, unsigned int>;
 		tsl::ordered_map<std::string, tsl::ordered_map<std::string, MatPair>> meshesByName;
 
-		UInt32 faceReserve = 0;
-		UInt32 vertexReserve = 0;
+		std::size_t faceReserve = 0;
+		std::size_t vertexReserve = 0;
 		unsigned int matCount = 0;
 		auto GetMaterial = [&] (const std::string& mesh, const std::string& mat) -> Mesh*
 		{
@@ -147,304 +638,164 @@ namespace Nz
 		// On prépare le mesh par défaut
 		Mesh* currentMesh = nullptr;
 
-		while (Advance(false))
+		// Merge chunks in order, this is where face indices get remapped to the global arrays
+		unsigned int lineOffset = 0;
+		for (ParsedChunk& chunk : chunks)
 		{
-			switch (std::tolower(m_currentLine[0]))
-			{
-				case '#': //< Comment
-					// Some softwares write comments to gives the number of vertex/faces an importer can expect
-					unsigned int data;
-					if (std::sscanf(m_currentLine.data(), "# position count: %u", &data) == 1)
-						m_positions.reserve(data);
-					else if (std::sscanf(m_currentLine.data(), "# normal count: %u", &data) == 1)
-						m_normals.reserve(data);
-					else if (std::sscanf(m_currentLine.data(), "# texcoords count: %u", &data) == 1)
-						m_texCoords.reserve(data);
-					else if (std::sscanf(m_currentLine.data(), "# face count: %u", &data) == 1)
-						faceReserve = data;
-					else if (std::sscanf(m_currentLine.data(), "# vertex count: %u", &data) == 1)
-						vertexReserve = data;
+			std::size_t normalOffset = m_normals.size();
+			std::size_t positionOffset = m_positions.size();
+			std::size_t texCoordOffset = m_texCoords.size();
 
-					break;
+			m_normals.insert(m_normals.end(), chunk.normals.begin(), chunk.normals.end());
+			m_positions.insert(m_positions.end(), chunk.positions.begin(), chunk.positions.end());
+			m_texCoords.insert(m_texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
 
-				case 'f': //< Face
+			for (const Command& command : chunk.commands)
+			{
+				m_lineCount = lineOffset + command.line;
+
+				switch (command.type)
 				{
-					if (m_currentLine.size() < 7) // Since we only treat triangles, this is the minimum length of a face line (f 1 2 3)
+					case CommandType::Face:
 					{
-						#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
-						break;
-					}
+						// Element counts at the time the face was declared, as indices are only allowed to reference already declared elements
+						int declaredNormalCount = static_cast<int>(normalOffset + command.normalCount);
+						int declaredPositionCount = static_cast<int>(positionOffset + command.positionCount);
+						int declaredTexCoordCount = static_cast<int>(texCoordOffset + command.texCoordCount);
 
-					std::size_t vertexCount = std::count(m_currentLine.begin(), m_currentLine.end(), ' ');
-					if (vertexCount < 3)
-					{
-						#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
-						break;
-					}
+						if (!currentMesh)
+							currentMesh = GetMaterial(meshName, matName);
 
-					if (!currentMesh)
-						currentMesh = GetMaterial(meshName, matName);
+						Face face;
+						face.firstVertex = currentMesh->vertices.size();
+						face.vertexCount = command.vertexCount;
 
-					Face face;
-					face.firstVertex = currentMesh->vertices.size();
-					face.vertexCount = vertexCount;
+						currentMesh->vertices.resize(face.firstVertex + face.vertexCount, FaceVertex{0, 0, 0});
 
-					currentMesh->vertices.resize(face.firstVertex + vertexCount, FaceVertex{0, 0, 0});
+						bool error = false;
+						for (std::size_t i = 0; i < face.vertexCount; ++i)
+						{
+							const RawFaceVertex& rawVertex = chunk.faceVertices[command.data + i];
 
-					bool error = false;
-					unsigned int pos = 2;
-					for (unsigned int i = 0; i < vertexCount; ++i)
-					{
-						int offset;
-						int n = 0;
-						int p = 0;
-						int t = 0;
+							int n = rawVertex.normal;
+							int p = rawVertex.position;
+							int t = rawVertex.texCoord;
 
-						if (std::sscanf(&m_currentLine[pos], "%d/%d/%d%n", &p, &t, &n, &offset) != 3)
-						{
-							if (std::sscanf(&m_currentLine[pos], "%d//%d%n", &p, &n, &offset) != 2)
+							if (p < 0)
 							{
-								if (std::sscanf(&m_currentLine[pos], "%d/%d%n", &p, &t, &offset) != 2)
+								p += declaredPositionCount;
+								if (p < 0)
 								{
-									if (std::sscanf(&m_currentLine[pos], "%d%n", &p, &offset) != 1)
-									{
-										#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-										if (!UnrecognizedLine())
-											return false;
-										#endif
-										error = true;
-										break;
-									}
+									Error("Vertex index out of range (" + std::to_string(p) + " < 0");
+									error = true;
+									break;
 								}
+
+								++p;
 							}
-						}
 
-						if (p < 0)
-						{
-							p += static_cast<int>(m_positions.size());
-							if (p < 0)
+							if (n < 0)
 							{
-								Error("Vertex index out of range (" + std::to_string(p) + " < 0");
-								error = true;
-								break;
+								n += declaredNormalCount;
+								if (n < 0)
+								{
+									Error("Normal index out of range (" + std::to_string(n) + " < 0");
+									error = true;
+									break;
+								}
+
+								++n;
 							}
 
-							++p;
-						}
+							if (t < 0)
+							{
+								t += declaredTexCoordCount;
+								if (t < 0)
+								{
+									Error("Texture coordinates index out of range (" + std::to_string(t) + " < 0");
+									error = true;
+									break;
+								}
 
-						if (n < 0)
-						{
-							n += static_cast<int>(m_normals.size());
-							if (n < 0)
+								++t;
+							}
+
+							if (p > declaredPositionCount)
 							{
-								Error("Normal index out of range (" + std::to_string(n) + " < 0");
+								Error("Vertex index out of range (" + std::to_string(p) + " >= " + std::to_string(declaredPositionCount) + ')');
 								error = true;
 								break;
 							}
-
-							++n;
-						}
-
-						if (t < 0)
-						{
-							t += static_cast<int>(m_texCoords.size());
-							if (t < 0)
+							else if (n != 0 && n > declaredNormalCount)
 							{
-								Error("Texture coordinates index out of range (" + std::to_string(t) + " < 0");
+								Error("Normal index out of range (" + std::to_string(n) + " >= " + std::to_string(declaredNormalCount) + ')');
+								error = true;
+								break;
+							}
+							else if (t != 0 && t > declaredTexCoordCount)
+							{
+								Error("TexCoord index out of range (" + std::to_string(t) + " >= " + std::to_string(declaredTexCoordCount) + ')');
 								error = true;
 								break;
 							}
 
-							++t;
-						}
-
-						if (static_cast<std::size_t>(p) > m_positions.size())
-						{
-							Error("Vertex index out of range (" + std::to_string(p) + " >= " + std::to_string(m_positions.size()) + ')');
-							error = true;
-							break;
-						}
-						else if (n != 0 && static_cast<std::size_t>(n) > m_normals.size())
-						{
-							Error("Normal index out of range (" + std::to_string(n) + " >= " + std::to_string(m_normals.size()) + ')');
-							error = true;
-							break;
-						}
-						else if (t != 0 && static_cast<std::size_t>(t) > m_texCoords.size())
-						{
-							Error("TexCoord index out of range (" + std::to_string(t) + " >= " + std::to_string(m_texCoords.size()) + ')');
-							error = true;
-							break;
+							currentMesh->vertices[face.firstVertex + i].normal = static_cast<UInt32>(n);
+							currentMesh->vertices[face.firstVertex + i].position = static_cast<UInt32>(p);
+							currentMesh->vertices[face.firstVertex + i].texCoord = static_cast<UInt32>(t);
 						}
 
-						currentMesh->vertices[face.firstVertex + i].normal = static_cast<UInt32>(n);
-						currentMesh->vertices[face.firstVertex + i].position = static_cast<UInt32>(p);
-						currentMesh->vertices[face.firstVertex + i].texCoord = static_cast<UInt32>(t);
-
-						pos += offset;
-					}
-
-					if (!error)
-						currentMesh->faces.push_back(std::move(face));
-					else
-						currentMesh->vertices.resize(face.firstVertex); //< Remove vertices
-
-					break;
-				}
-
-				case 'm': //< MTLLib
-				{
-					const char prefix[] = "mtllib ";
-					if (!StartsWith(m_currentLine, prefix))
-					{
-#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
+						if (!error)
+							currentMesh->faces.push_back(std::move(face));
+						else
+							currentMesh->vertices.resize(face.firstVertex); //< Remove vertices
 
 						break;
 					}
 
-					m_mtlLib = m_currentLine.substr(sizeof(prefix) - 1);
-					break;
-				}
-
-				case 'g': //< Group (inside a mesh)
-				case 'o': //< Object (defines a mesh)
-				{
-					if (m_currentLine.size() <= 2 || m_currentLine[1] != ' ')
-					{
-#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
+					case CommandType::FaceCountHint:
+						faceReserve = command.data;
 						break;
-					}
 
-					std::string objectName = m_currentLine.substr(2);
-					if (objectName.empty())
-					{
-						#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
+					case CommandType::Group:
+						meshName = std::move(chunk.strings[command.data]);
+						currentMesh = nullptr;
 						break;
-					}
 
-					meshName = objectName;
-					currentMesh = nullptr;
-					break;
-				}
+					case CommandType::InvalidFace:
+						// Faces which failed to parse still register their mesh
+						if (!currentMesh)
+							currentMesh = GetMaterial(meshName, matName);
 
-#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-				case 's': //< Smooth
-					if (m_currentLine.size() <= 2 || m_currentLine[1] == ' ')
-					{
-						std::string param = m_currentLine.substr(2);
-						if (param != "all" && param != "on" && param != "off" && !IsNumber(param))
-						{
-							if (!UnrecognizedLine())
-								return false;
-						}
-					}
-					else if (!UnrecognizedLine())
-						return false;
-					break;
-#endif
+						[[fallthrough]];
 
-				case 'u': //< Usemtl
-				{
-					const char prefix[] = "usemtl ";
-					if (!StartsWith(m_currentLine, prefix))
-					{
+					case CommandType::Unrecognized:
 #if NAZARA_CORE_STRICT_RESOURCE_PARSING
+						m_currentLine = std::move(chunk.strings[command.data]);
 						if (!UnrecognizedLine())
 							return false;
 #endif
 
 						break;
-					}
 
-					std::string newMatName = m_currentLine.substr(sizeof(prefix) - 1);
-					if (newMatName.empty())
-					{
-#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
+					case CommandType::MtlLib:
+						m_mtlLib = chunk.strings[command.data];
 						break;
-					}
-
-					matName = std::move(newMatName);
-					currentMesh = nullptr;
-					break;
-				}
 
-				case 'v': //< Position/Normal/Texcoords
-				{
-					if (m_currentLine.size() < 7)
-					{
-#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
+					case CommandType::UseMtl:
+						matName = std::move(chunk.strings[command.data]);
+						currentMesh = nullptr;
 						break;
-					}
-
-					if (std::isspace(m_currentLine[1]))
-					{
-						Vector4f vertex(Vector3f::Zero(), 1.f);
-						unsigned int paramCount = std::sscanf(&m_currentLine[2], " %f %f %f %f", &vertex.x, &vertex.y, &vertex.z, &vertex.w);
-						if (paramCount >= 1)
-							m_positions.push_back(vertex);
-						#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					else if (m_currentLine[1] == 'n' && std::isspace(m_currentLine[2]))
-					{
-						Vector3f normal(Vector3f::Zero());
-						unsigned int paramCount = std::sscanf(&m_currentLine[3], " %f %f %f", &normal.x, &normal.y, &normal.z);
-						if (paramCount == 3)
-							m_normals.push_back(normal);
-						#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					else if (m_currentLine[1] == 't' && std::isspace(m_currentLine[2]))
-					{
-						Vector3f uvw(Vector3f::Zero());
-						unsigned int paramCount = std::sscanf(&m_currentLine[3], " %f %f %f", &uvw.x, &uvw.y, &uvw.z);
-						if (paramCount >= 2)
-							m_texCoords.push_back(uvw);
-						#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-					else if (!UnrecognizedLine())
-						return false;
-					#endif
 
-					break;
+					case CommandType::VertexCountHint:
+						vertexReserve = command.data;
+						break;
 				}
-
-				default:
-					#if NAZARA_CORE_STRICT_RESOURCE_PARSING
-					if (!UnrecognizedLine())
-						return false;
-					#endif
-					break;
 			}
+
+			lineOffset += chunk.lineCount;
+
+			// Free chunk memory as soon as possible
+			chunk = ParsedChunk{};
 		}
 
 		std::unordered_map<std::string, unsigned int> materials;
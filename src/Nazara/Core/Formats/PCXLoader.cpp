@@ -314,6 +314,19 @@ namespace Nz
 					return Err(ResourceLoadingError::DecodingError);
 			}
 
+			// Fill the additional levels requested by the parameters (before conversion, as block compressed images cannot be filtered)
+			if (UInt8 levelCount = image->GetLevelCount(); levelCount > 1)
+			{
+				ImageMipmapParams mipmapParams;
+				mipmapParams.levelCount = levelCount;
+
+				if (!image->GenerateMipmaps(mipmapParams))
+				{
+					NazaraError("failed to generate mipmaps");
+					return Err(ResourceLoadingError::Internal);
+				}
+			}
+
 			if (parameters.loadFormat != PixelFormat::Undefined)
 				image->Convert(parameters.loadFormat);
 
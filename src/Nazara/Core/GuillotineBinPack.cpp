@@ -292,7 +292,7 @@ namespace Nz
 	* \return true if each rectangle could be inserted
 	*
 	* \param rects List of rectangles
-	* \param flipped List of flipped rectangles
+	* \param flipped List of flipped rectangles, rectangles are never flipped if it's null
 	* \param inserted List of inserted rectangles
 	* \param count Count of rectangles
 	* \param merge Merge possible
@@ -307,6 +307,9 @@ namespace Nz
 		for (unsigned int i = 0; i < count; ++i)
 			remainingRects[i] = &rects[i];
 
+		// Rectangles can only be flipped if the caller can know about it
+		bool allowFlip = (flipped != nullptr);
+
 		// Pack rectangles one at a time until we have cleared the rects array of all rectangles.
 		while (!remainingRects.empty())
 		{
@@ -335,7 +338,7 @@ namespace Nz
 						break;
 					}
 					// If flipping this rectangle is a perfect match, pick that then.
-					else if (rect.height == freeRect.width && rect.width == freeRect.height)
+					else if (allowFlip && rect.height == freeRect.width && rect.width == freeRect.height)
 					{
 						bestFreeRect = i;
 						bestRect = j;
@@ -357,7 +360,7 @@ namespace Nz
 						}
 					}
 					// If not, then perhaps flipping sideways will make it fit?
-					else if (rect.height <= freeRect.width && rect.width <= freeRect.height)
+					else if (allowFlip && rect.height <= freeRect.width && rect.width <= freeRect.height)
 					{
 						int score = ScoreByHeuristic(rect.height, rect.width, freeRect, rectChoice);
 						if (score < bestScore)
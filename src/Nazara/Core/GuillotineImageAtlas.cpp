@@ -4,15 +4,35 @@
 
 #include <Nazara/Core/GuillotineImageAtlas.hpp>
 #include <Nazara/Core/Export.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
 
 namespace Nz
 {
 	namespace
 	{
 		constexpr Vector2ui s_guillotineAtlasStartSize(512);
+
+		// The bin packer looks for the best rectangle/free space pair among all the remaining rectangles, which is quadratic in the number of rectangles
+		// inserting by batches keeps most of the packing quality of a global insertion for a bounded cost
+		constexpr std::size_t s_guillotineAtlasBatchSize = 64;
+
+		// Pack the biggest rectangles first, smaller ones fill the gaps
+		bool IsPackedBefore(const Rectui& lhs, const Rectui& rhs)
+		{
+			unsigned int lhsSize = std::max(lhs.width, lhs.height);
+			unsigned int rhsSize = std::max(rhs.width, rhs.height);
+			if (lhsSize != rhsSize)
+				return lhsSize > rhsSize;
+
+			return lhs.width * lhs.height > rhs.width * rhs.height;
+		}
 	}
 
 	GuillotineImageAtlas::GuillotineImageAtlas() :
+	m_packingAlgorithm(BinPackAlgorithm::Guillotine),
 	m_rectChoiceHeuristic(GuillotineBinPack::RectBestAreaFit),
 	m_rectSplitHeuristic(GuillotineBinPack::SplitMinimizeArea),
 	m_maxLayerSize(16384)
@@ -25,14 +45,74 @@ namespace Nz
 		OnAtlasCleared(this);
 	}
 
+	/*!
+	* \brief Repacks the live rectangles of a layer to reclaim the space lost to fragmentation
+	* \return true if the layer was repacked
+	*
+	* \param layerIndex Index of the layer to defragment
+	*
+	* Rectangles keep their orientation and their pixels are moved to a new image of the same size, which replaces the layer image (triggering OnAtlasLayerChange).
+	* OnAtlasRectsRelocated is triggered beforehand so users can update the rectangles they got from Insert.
+	*
+	* \remark Layers are defragmented one at a time, which allows to spread the work over multiple frames
+	* \remark The layer is repacked using the current packing algorithm, and is left untouched if its rectangles can't fit in it
+	*/
+	bool GuillotineImageAtlas::Defragment(std::size_t layerIndex)
+	{
+		NazaraAssertFmt(layerIndex < m_layers.size(), "layer index out of range ({0} >= {1})", layerIndex, m_layers.size());
+
+		Layer& layer = m_layers[layerIndex];
+
+		// Queued glyphs have to be in the layer image before being moved
+		ProcessGlyphQueue(layer);
+
+		std::vector<Rectui> oldRects;
+		oldRects.reserve(layer.entries.size());
+		for (auto&& [key, rect] : layer.entries)
+			oldRects.push_back(rect);
+
+		std::sort(oldRects.begin(), oldRects.end(), IsPackedBefore);
+
+		Layer newLayer;
+		newLayer.binPack = CreateBinPack(std::visit([](auto&& binPack) { return binPack.GetSize(); }, layer.binPack));
+
+		// Rectangles can't be flipped as they already hold their pixels
+		std::vector<Rectui> newRects = oldRects;
+		for (std::size_t batchStart = 0; batchStart < newRects.size(); batchStart += s_guillotineAtlasBatchSize)
+		{
+			unsigned int batchCount = SafeCast<unsigned int>(std::min(s_guillotineAtlasBatchSize, newRects.size() - batchStart));
+			if (!InsertIntoBinPack(newLayer, &newRects[batchStart], nullptr, nullptr, batchCount))
+				return false;
+		}
+
+		newLayer.image = RelocateImage(layer.image, oldRects.data(), newRects.data(), oldRects.size());
+		if (!newLayer.image)
+			return false;
+
+		for (const Rectui& rect : newRects)
+			newLayer.entries.emplace(GetEntryKey(rect), rect);
+
+		OnAtlasRectsRelocated(this, layerIndex, layer.image.get(), oldRects.data(), newRects.data(), oldRects.size());
+		OnAtlasLayerChange(this, layer.image.get(), newLayer.image.get());
+
+		layer = std::move(newLayer);
+		return true;
+	}
+
 	void GuillotineImageAtlas::Free(SparsePtr<const Rectui> rects, SparsePtr<std::size_t> layers, std::size_t count)
 	{
 		for (std::size_t i = 0; i < count; ++i)
 		{
 			NazaraAssertFmt(layers[i] < m_layers.size(), "Rectangle #{0} belongs to an out-of-bounds layer ({1} >= {2})", i, layers[i], m_layers.size());
 
-			m_layers[layers[i]].binPack.FreeRectangle(rects[i]);
-			m_layers[layers[i]].freedRectangles++;
+			Layer& layer = m_layers[layers[i]];
+
+			auto it = layer.entries.find(GetEntryKey(rects[i]));
+			NazaraAssertFmt(it != layer.entries.end(), "Rectangle #{0} is not allocated in layer {1}", i, layers[i]);
+
+			std::visit([&](auto&& binPack) { binPack.FreeRectangle(it->second); }, layer.binPack);
+			layer.entries.erase(it);
+			layer.freedRectangles++;
 		}
 	}
 
@@ -41,6 +121,11 @@ namespace Nz
 		return m_maxLayerSize;
 	}
 
+	BinPackAlgorithm GuillotineImageAtlas::GetPackingAlgorithm() const
+	{
+		return m_packingAlgorithm;
+	}
+
 	GuillotineBinPack::FreeRectChoiceHeuristic GuillotineImageAtlas::GetRectChoiceHeuristic() const
 	{
 		return m_rectChoiceHeuristic;
@@ -66,6 +151,20 @@ namespace Nz
 		return m_layers.size();
 	}
 
+	/*!
+	* \brief Gets the ratio of a layer area used by live rectangles
+	*
+	* \param layerIndex Index of the layer
+	*
+	* \see Defragment
+	*/
+	float GuillotineImageAtlas::GetLayerOccupancy(std::size_t layerIndex) const
+	{
+		NazaraAssertFmt(layerIndex < m_layers.size(), "layer index out of range ({0} >= {1})", layerIndex, m_layers.size());
+
+		return std::visit([](auto&& binPack) { return binPack.GetOccupancy(); }, m_layers[layerIndex].binPack);
+	}
+
 	DataStoreFlags GuillotineImageAtlas::GetStorage() const
 	{
 		return DataStorage::Software;
@@ -73,28 +172,31 @@ namespace Nz
 
 	bool GuillotineImageAtlas::Insert(const Image& image, Rectui* rect, bool* flipped, std::size_t* layerIndex)
 	{
+		// New layers start at a fixed size even if the maximum layer size is lower
+		unsigned int maxLayerSize = std::max(m_maxLayerSize, s_guillotineAtlasStartSize.x);
+		if (std::max(rect->width, rect->height) > maxLayerSize)
+		{
+			NazaraErrorFmt("rectangle ({0}x{1}) is bigger than the maximum layer size ({2})", rect->width, rect->height, maxLayerSize);
+			return false;
+		}
+
 		// Ensure there's at least one layer before inserting
 		if (m_layers.empty())
-			m_layers.emplace_back();
+			m_layers.emplace_back().binPack = CreateBinPack(Vector2ui::Zero());
 
 		// Reserve some space for that rectangle (pixel copy only happens in ProcessGlyphQueue)
 		for (std::size_t i = 0; i < m_layers.size(); ++i)
 		{
 			Layer& layer = m_layers[i];
 
-			// Try to reduce fragmentation by merging free rectangles if at least X rectangles were freed before inserting
-			if (layer.freedRectangles > 10)
+			if (InsertIntoBinPack(layer, rect, flipped, nullptr, 1))
 			{
-				while (layer.binPack.MergeFreeRectangles());
-				layer.freedRectangles = 0;
-			}
+				layer.entries.emplace(GetEntryKey(*rect), *rect);
 
-			if (layer.binPack.Insert(rect, flipped, 1, false, m_rectChoiceHeuristic, m_rectSplitHeuristic))
-			{
 				// Found some space, queue glyph copy
 				layer.queuedGlyphs.resize(layer.queuedGlyphs.size()+1);
 				QueuedGlyph& glyph = layer.queuedGlyphs.back();
-				glyph.flipped = *flipped;
+				glyph.flipped = (flipped) ? *flipped : false;
 				glyph.image = image; // Copy-On-Write
 				glyph.rect = *rect;
 
@@ -103,41 +205,108 @@ namespace Nz
 			}
 			else if (i == m_layers.size() - 1)
 			{
-				// Last layer and glyph can't be inserted, try to double the layer size
-				Vector2ui newSize = layer.binPack.GetSize() * 2;
-				if (newSize == Vector2ui::Zero())
-					newSize = s_guillotineAtlasStartSize;
-
-				// Limit image atlas size to prevent allocating too much contiguous memory blocks
-				if (newSize.x <= m_maxLayerSize && newSize.y <= m_maxLayerSize && ResizeLayer(layer, newSize))
-				{
-					// Atlas has been enlarged successfully, re-run iteration
-					layer.binPack.Expand(newSize);
+				// Last layer and glyph can't be inserted, try to enlarge it
+				std::size_t layerCount = m_layers.size();
+				if (!GrowLastLayer())
+					return false;
 
+				// Atlas has been enlarged successfully, re-run iteration (a new layer will be processed on next iteration)
+				if (m_layers.size() == layerCount)
 					i--;
-				}
-				else
-				{
-					// Atlas cannot be enlarged, make a new layer
-					newSize = s_guillotineAtlasStartSize;
+			}
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	bool GuillotineImageAtlas::Insert(SparsePtr<const Image> images, SparsePtr<Rectui> rects, SparsePtr<bool> flipped, SparsePtr<std::size_t> layerIndices, std::size_t count)
+	{
+		constexpr std::size_t BatchSize = s_guillotineAtlasBatchSize;
+
+		// New layers start at a fixed size even if the maximum layer size is lower
+		unsigned int maxLayerSize = std::max(m_maxLayerSize, s_guillotineAtlasStartSize.x);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (std::max(rects[i].width, rects[i].height) > maxLayerSize)
+			{
+				NazaraErrorFmt("rectangle #{0} ({1}x{2}) is bigger than the maximum layer size ({3})", i, rects[i].width, rects[i].height, maxLayerSize);
+				return false;
+			}
+		}
+
+		// Ensure there's at least one layer before inserting
+		if (m_layers.empty())
+			m_layers.emplace_back().binPack = CreateBinPack(Vector2ui::Zero());
+
+		std::vector<std::size_t> order(count);
+		std::iota(order.begin(), order.end(), std::size_t(0));
+		std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs)
+		{
+			return IsPackedBefore(rects[lhs], rects[rhs]);
+		});
+
+		std::vector<std::size_t> pendingRects;
+		Rectui batchRects[BatchSize];
+		bool batchFlipped[BatchSize];
+		bool batchInserted[BatchSize];
 
-					Layer newLayer;
-					if (!ResizeLayer(newLayer, newSize))
+		for (std::size_t batchStart = 0; batchStart < count; batchStart += BatchSize)
+		{
+			pendingRects.assign(order.begin() + batchStart, order.begin() + std::min(batchStart + BatchSize, count));
+
+			std::size_t layerIndex = 0;
+			for (;;)
+			{
+				Layer& layer = m_layers[layerIndex];
+
+				for (std::size_t i = 0; i < pendingRects.size(); ++i)
+					batchRects[i] = rects[pendingRects[i]];
+
+				InsertIntoBinPack(layer, batchRects, batchFlipped, batchInserted, SafeCast<unsigned int>(pendingRects.size()));
+
+				std::size_t remainingCount = 0;
+				for (std::size_t i = 0; i < pendingRects.size(); ++i)
+				{
+					std::size_t rectIndex = pendingRects[i];
+					if (!batchInserted[i])
 					{
-						NazaraError("failed to allocate new layer, we are probably out of memory");
-						return false;
+						pendingRects[remainingCount++] = rectIndex;
+						continue;
 					}
 
-					newLayer.binPack.Reset(newSize);
+					rects[rectIndex] = batchRects[i];
+					flipped[rectIndex] = batchFlipped[i];
+					layerIndices[rectIndex] = layerIndex;
 
-					m_layers.emplace_back(std::move(newLayer));
+					layer.entries.emplace(GetEntryKey(batchRects[i]), batchRects[i]);
 
-					// This new layer will be processed on next iteration
+					// Pixel copy only happens in ProcessGlyphQueue, once for every glyph queued in the layer
+					QueuedGlyph& glyph = layer.queuedGlyphs.emplace_back();
+					glyph.flipped = batchFlipped[i];
+					glyph.image = images[rectIndex]; // Copy-On-Write
+					glyph.rect = batchRects[i];
+				}
+				pendingRects.resize(remainingCount);
+
+				if (pendingRects.empty())
+					break;
+
+				if (layerIndex < m_layers.size() - 1)
+					layerIndex++;
+				else
+				{
+					// Last layer and some rectangles can't be inserted, try to enlarge it
+					std::size_t layerCount = m_layers.size();
+					if (!GrowLastLayer())
+						return false;
+
+					if (m_layers.size() != layerCount)
+						layerIndex++;
 				}
 			}
 		}
 
-		NAZARA_UNREACHABLE();
+		return true;
 	}
 
 	void GuillotineImageAtlas::SetMaxLayerSize(unsigned int maxLayerSize)
@@ -145,6 +314,18 @@ namespace Nz
 		m_maxLayerSize = maxLayerSize;
 	}
 
+	/*!
+	* \brief Sets the algorithm used to pack rectangles in new layers
+	*
+	* \param algorithm Packing algorithm
+	*
+	* \remark Existing layers keep their packing algorithm until they are defragmented or cleared
+	*/
+	void GuillotineImageAtlas::SetPackingAlgorithm(BinPackAlgorithm algorithm)
+	{
+		m_packingAlgorithm = algorithm;
+	}
+
 	void GuillotineImageAtlas::SetRectChoiceHeuristic(GuillotineBinPack::FreeRectChoiceHeuristic heuristic)
 	{
 		m_rectChoiceHeuristic = heuristic;
@@ -155,6 +336,17 @@ namespace Nz
 		m_rectSplitHeuristic = heuristic;
 	}
 
+	std::shared_ptr<AbstractImage> GuillotineImageAtlas::RelocateImage(const std::shared_ptr<AbstractImage>& oldImage, const Rectui* oldRects, const Rectui* newRects, std::size_t count) const
+	{
+		const Image& oldLayer = static_cast<const Image&>(*oldImage);
+
+		std::shared_ptr<Image> newImage = std::make_shared<Image>(ImageType::E2D, PixelFormat::A8, oldLayer.GetWidth(), oldLayer.GetHeight());
+		for (std::size_t i = 0; i < count; ++i)
+			newImage->Copy(oldLayer, Boxui(oldRects[i].x, oldRects[i].y, 0, oldRects[i].width, oldRects[i].height, 1), Vector3ui(newRects[i].x, newRects[i].y, 0));
+
+		return newImage;
+	}
+
 	std::shared_ptr<AbstractImage> GuillotineImageAtlas::ResizeImage(const std::shared_ptr<AbstractImage>& oldImage, const Vector2ui& size) const
 	{
 		std::shared_ptr<Image> newImage = std::make_shared<Image>(ImageType::E2D, PixelFormat::A8, size.x, size.y);
@@ -180,6 +372,72 @@ namespace Nz
 		return true;
 	}
 
+	bool GuillotineImageAtlas::GrowLastLayer()
+	{
+		Layer& layer = m_layers.back();
+
+		// Try to double the layer size
+		Vector2ui newSize = std::visit([](auto&& binPack) { return binPack.GetSize(); }, layer.binPack) * 2;
+		if (newSize == Vector2ui::Zero())
+			newSize = s_guillotineAtlasStartSize;
+
+		// Limit image atlas size to prevent allocating too much contiguous memory blocks
+		if (newSize.x <= m_maxLayerSize && newSize.y <= m_maxLayerSize && ResizeLayer(layer, newSize))
+		{
+			std::visit([&](auto&& binPack) { binPack.Expand(newSize); }, layer.binPack);
+			return true;
+		}
+
+		// Atlas cannot be enlarged, make a new layer
+		newSize = s_guillotineAtlasStartSize;
+
+		Layer newLayer;
+		if (!ResizeLayer(newLayer, newSize))
+		{
+			NazaraError("failed to allocate new layer, we are probably out of memory");
+			return false;
+		}
+
+		newLayer.binPack = CreateBinPack(newSize);
+
+		m_layers.emplace_back(std::move(newLayer));
+		return true;
+	}
+
+	auto GuillotineImageAtlas::CreateBinPack(const Vector2ui& size) const -> BinPack
+	{
+		switch (m_packingAlgorithm)
+		{
+			case BinPackAlgorithm::Guillotine: return GuillotineBinPack(size);
+			case BinPackAlgorithm::MaxRects:   return MaxRectsBinPack(size);
+			case BinPackAlgorithm::Skyline:    return SkylineBinPack(size);
+		}
+
+		NAZARA_UNREACHABLE();
+	}
+
+	bool GuillotineImageAtlas::InsertIntoBinPack(Layer& layer, Rectui* rects, bool* flipped, bool* inserted, unsigned int count)
+	{
+		return std::visit([&](auto&& binPack)
+		{
+			using T = std::decay_t<decltype(binPack)>;
+
+			if constexpr (std::is_same_v<T, GuillotineBinPack>)
+			{
+				// Try to reduce fragmentation by merging free rectangles if at least X rectangles were freed before inserting
+				if (layer.freedRectangles > 10)
+				{
+					while (binPack.MergeFreeRectangles());
+					layer.freedRectangles = 0;
+				}
+
+				return binPack.Insert(rects, flipped, inserted, count, false, m_rectChoiceHeuristic, m_rectSplitHeuristic);
+			}
+			else
+				return binPack.Insert(rects, flipped, inserted, count);
+		}, layer.binPack);
+	}
+
 	void GuillotineImageAtlas::ProcessGlyphQueue(Layer& layer) const
 	{
 		std::vector<UInt8> pixelBuffer;
@@ -247,4 +505,9 @@ namespace Nz
 
 		layer.queuedGlyphs.clear();
 	}
+
+	UInt64 GuillotineImageAtlas::GetEntryKey(const Rectui& rect)
+	{
+		return (UInt64(rect.x) << 32) | rect.y;
+	}
 }
@@ -9,8 +9,17 @@
 #include <Nazara/Core/Export.hpp>
 #include <Nazara/Core/PixelFormat.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <NazaraUtils/MathUtils.hpp>
 #include <NazaraUtils/StackArray.hpp>
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <vector>
+
+#ifdef NAZARA_ARCH_x86_64
+#include <xmmintrin.h>
+#endif
 
 ///TODO: Rajouter des warnings (Formats compressés avec les méthodes Copy/Update, tests taille dans Copy)
 ///TODO: Rendre les méthodes exception-safe (faire usage du RAII)
@@ -28,10 +37,310 @@ namespace Nz
 			return std::max(size >> level, 1U);
 		}
 
+		inline unsigned int GetImageLevelDepth(ImageType type, unsigned int depth, UInt8 level)
+		{
+			// Cubemap faces and array layers are stored like depth slices, but mipmapping doesn't reduce their count
+			switch (type)
+			{
+				case ImageType::Cubemap:
+					return 6;
+
+				case ImageType::E2D_Array:
+					return depth;
+
+				default:
+					return GetImageLevelSize(depth, level);
+			}
+		}
+
 		inline UInt8* GetPixelPtr(UInt8* base, UInt8 bpp, unsigned int x, unsigned int y, unsigned int z, unsigned int width, unsigned int height)
 		{
 			return &base[(width*(height*z + y) + x)*bpp];
 		}
+
+		/************************************** Mipmaps **************************************/
+
+		constexpr std::size_t MipmapMinTexelPerTask = 16 * 1024;
+
+		// Kaiser window parameters (same as NVTT defaults)
+		constexpr double KaiserAlpha = 4.0;
+		constexpr double KaiserWidth = 3.0;
+
+		constexpr double LanczosWidth = 3.0;
+
+		// For each destination texel, the source texels contributing to it and their (normalized) weights
+		struct MipmapKernel
+		{
+			std::vector<UInt32> firstContribution; //< dstSize + 1 entries
+			std::vector<UInt32> sourceIndices;
+			std::vector<float> weights;
+		};
+
+		double Sinc(double x)
+		{
+			if (std::abs(x) < 1.0e-6)
+				return 1.0;
+
+			x *= Pi<double>;
+			return std::sin(x) / x;
+		}
+
+		double BesselI0(double x)
+		{
+			// Power series, converges quickly for the small values used by the Kaiser window
+			double sum = 1.0;
+			double term = 1.0;
+			double halfX = x * 0.5;
+			for (unsigned int k = 1; k < 32; ++k)
+			{
+				term *= halfX / k;
+				double squaredTerm = term * term;
+				sum += squaredTerm;
+				if (squaredTerm < sum * 1.0e-12)
+					break;
+			}
+
+			return sum;
+		}
+
+		double EvaluateMipmapFilter(MipmapFilter filter, double x)
+		{
+			switch (filter)
+			{
+				case MipmapFilter::Box:
+					return (std::abs(x) <= 0.5) ? 1.0 : 0.0;
+
+				case MipmapFilter::Kaiser:
+				{
+					double t = x / KaiserWidth;
+					if (std::abs(t) >= 1.0)
+						return 0.0;
+
+					return Sinc(x) * BesselI0(KaiserAlpha * std::sqrt(1.0 - t * t)) / BesselI0(KaiserAlpha);
+				}
+
+				case MipmapFilter::Lanczos:
+				{
+					if (std::abs(x) >= LanczosWidth)
+						return 0.0;
+
+					return Sinc(x) * Sinc(x / LanczosWidth);
+				}
+			}
+
+			NazaraErrorFmt("unhandled mipmap filter {0:#x}", UnderlyingCast(filter));
+			return 0.0;
+		}
+
+		double GetMipmapFilterWidth(MipmapFilter filter)
+		{
+			switch (filter)
+			{
+				case MipmapFilter::Box:     return 0.5;
+				case MipmapFilter::Kaiser:  return KaiserWidth;
+				case MipmapFilter::Lanczos: return LanczosWidth;
+			}
+
+			return 0.0;
+		}
+
+		UInt32 AddressTexel(long long index, unsigned int size, bool wrap)
+		{
+			long long lastIndex = static_cast<long long>(size) - 1;
+			if (wrap)
+				return SafeCast<UInt32>(((index % static_cast<long long>(size)) + size) % size);
+			else
+				return SafeCast<UInt32>(std::clamp(index, 0LL, lastIndex));
+		}
+
+		MipmapKernel BuildMipmapKernel(MipmapFilter filter, unsigned int srcSize, unsigned int dstSize, bool wrap)
+		{
+			MipmapKernel kernel;
+			kernel.firstContribution.reserve(dstSize + 1);
+
+			double scale = double(srcSize) / dstSize;
+			double radius = GetMipmapFilterWidth(filter) * scale;
+
+			for (unsigned int dst = 0; dst < dstSize; ++dst)
+			{
+				std::size_t firstContribution = kernel.weights.size();
+				kernel.firstContribution.push_back(SafeCast<UInt32>(firstContribution));
+
+				if (filter == MipmapFilter::Box)
+				{
+					// Exact area coverage, so that odd sizes are handled correctly
+					double start = dst * scale;
+					double end = start + scale;
+
+					long long firstTexel = static_cast<long long>(std::floor(start));
+					long long lastTexel = static_cast<long long>(std::ceil(end));
+					for (long long i = firstTexel; i < lastTexel; ++i)
+					{
+						double overlap = std::min(end, double(i + 1)) - std::max(start, double(i));
+						if (overlap <= 0.0)
+							continue;
+
+						kernel.sourceIndices.push_back(AddressTexel(i, srcSize, wrap));
+						kernel.weights.push_back(float(overlap));
+					}
+				}
+				else
+				{
+					double center = (dst + 0.5) * scale;
+
+					long long firstTexel = static_cast<long long>(std::floor(center - radius));
+					long long lastTexel = static_cast<long long>(std::ceil(center + radius));
+					for (long long i = firstTexel; i <= lastTexel; ++i)
+					{
+						double weight = EvaluateMipmapFilter(filter, (i + 0.5 - center) / scale);
+						if (weight == 0.0)
+							continue;
+
+						kernel.sourceIndices.push_back(AddressTexel(i, srcSize, wrap));
+						kernel.weights.push_back(float(weight));
+					}
+				}
+
+				float weightSum = 0.f;
+				for (std::size_t i = firstContribution; i < kernel.weights.size(); ++i)
+					weightSum += kernel.weights[i];
+
+				for (std::size_t i = firstContribution; i < kernel.weights.size(); ++i)
+					kernel.weights[i] /= weightSum;
+			}
+
+			kernel.firstContribution.push_back(SafeCast<UInt32>(kernel.weights.size()));
+
+			return kernel;
+		}
+
+		template<typename F>
+		void DispatchMipmapJobs(std::size_t jobCount, std::size_t texelPerJob, TaskScheduler* taskScheduler, const F& func)
+		{
+			if (!taskScheduler || texelPerJob == 0)
+			{
+				func(0, jobCount);
+				return;
+			}
+
+			taskScheduler->ParallelForRange(jobCount, (MipmapMinTexelPerTask + texelPerJob - 1) / texelPerJob, [&](std::size_t firstJob, std::size_t lastJob)
+			{
+				func(firstJob, lastJob);
+			});
+		}
+
+		// Filters lines of RGBA32F texels along their length
+		void ResampleLines(const float* src, float* dst, const MipmapKernel& kernel, unsigned int srcWidth, unsigned int dstWidth, std::size_t firstLine, std::size_t lastLine)
+		{
+			for (std::size_t line = firstLine; line < lastLine; ++line)
+			{
+				const float* srcLine = src + line * srcWidth * 4;
+				float* dstLine = dst + line * dstWidth * 4;
+
+				for (unsigned int x = 0; x < dstWidth; ++x)
+				{
+					UInt32 first = kernel.firstContribution[x];
+					UInt32 last = kernel.firstContribution[x + 1];
+
+#ifdef NAZARA_ARCH_x86_64
+					__m128 sum = _mm_setzero_ps();
+					for (UInt32 i = first; i < last; ++i)
+						sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(srcLine + kernel.sourceIndices[i] * 4), _mm_set1_ps(kernel.weights[i])));
+
+					_mm_storeu_ps(dstLine + x * 4, sum);
+#else
+					float sum[4] = { 0.f, 0.f, 0.f, 0.f };
+					for (UInt32 i = first; i < last; ++i)
+					{
+						const float* texel = srcLine + kernel.sourceIndices[i] * 4;
+						for (unsigned int c = 0; c < 4; ++c)
+							sum[c] += texel[c] * kernel.weights[i];
+					}
+
+					for (unsigned int c = 0; c < 4; ++c)
+						dstLine[x * 4 + c] = sum[c];
+#endif
+				}
+			}
+		}
+
+		// Filters blocks of rows (rows of a slice or slices of a volume) by blending whole rows together, job index is block * dstRowCount + dstRow
+		void ResampleRows(const float* src, float* dst, const MipmapKernel& kernel, std::size_t rowSize, unsigned int srcRowCount, unsigned int dstRowCount, std::size_t firstJob, std::size_t lastJob)
+		{
+			for (std::size_t job = firstJob; job < lastJob; ++job)
+			{
+				std::size_t block = job / dstRowCount;
+				std::size_t row = job % dstRowCount;
+
+				const float* srcBlock = src + block * srcRowCount * rowSize;
+				float* dstRow = dst + job * rowSize;
+
+				UInt32 first = kernel.firstContribution[row];
+				UInt32 last = kernel.firstContribution[row + 1];
+
+				std::fill(dstRow, dstRow + rowSize, 0.f);
+				for (UInt32 i = first; i < last; ++i)
+				{
+					const float* srcRow = srcBlock + kernel.sourceIndices[i] * rowSize;
+					float weight = kernel.weights[i];
+
+					std::size_t offset = 0;
+#ifdef NAZARA_ARCH_x86_64
+					__m128 weights = _mm_set1_ps(weight);
+					for (; offset + 4 <= rowSize; offset += 4)
+						_mm_storeu_ps(dstRow + offset, _mm_add_ps(_mm_loadu_ps(dstRow + offset), _mm_mul_ps(_mm_loadu_ps(srcRow + offset), weights)));
+#endif
+					for (; offset < rowSize; ++offset)
+						dstRow[offset] += srcRow[offset] * weight;
+				}
+			}
+		}
+
+		float ComputeAlphaCoverage(const float* texels, std::size_t texelCount, float alphaReference, float alphaScale)
+		{
+			std::size_t coveredTexels = 0;
+			for (std::size_t i = 0; i < texelCount; ++i)
+			{
+				if (texels[i * 4 + 3] * alphaScale > alphaReference)
+					coveredTexels++;
+			}
+
+			return float(coveredTexels) / texelCount;
+		}
+
+		// Finds the alpha scale giving the closest coverage to the target (coverage grows with the scale)
+		float FindAlphaCoverageScale(const float* texels, std::size_t texelCount, float alphaReference, float targetCoverage)
+		{
+			float minScale = 0.f;
+			float maxScale = 4.f;
+			float scale = 1.f;
+			for (unsigned int i = 0; i < 10; ++i)
+			{
+				float coverage = ComputeAlphaCoverage(texels, texelCount, alphaReference, scale);
+				if (coverage < targetCoverage)
+					minScale = scale;
+				else if (coverage > targetCoverage)
+					maxScale = scale;
+				else
+					break;
+
+				scale = (minScale + maxScale) * 0.5f;
+			}
+
+			return scale;
+		}
+
+		PixelFormat GetSRGBFormat(PixelFormat format)
+		{
+			switch (format)
+			{
+				case PixelFormat::BGR8:  return PixelFormat::BGR8_SRGB;
+				case PixelFormat::BGRA8: return PixelFormat::BGRA8_SRGB;
+				case PixelFormat::RGB8:  return PixelFormat::RGB8_SRGB;
+				case PixelFormat::RGBA8: return PixelFormat::RGBA8_SRGB;
+				default:                 return format;
+			}
+		}
 	}
 
 	bool ImageParams::IsValid() const
@@ -77,15 +386,24 @@ namespace Nz
 		Destroy();
 	}
 
-	bool Image::Convert(PixelFormat newFormat)
+	bool Image::Convert(PixelFormat newFormat, TaskScheduler* taskScheduler)
+	{
+		return Convert(newFormat, BlockCompressionParams{}, taskScheduler);
+	}
+
+	bool Image::Convert(PixelFormat newFormat, const BlockCompressionParams& compressionParams, TaskScheduler* taskScheduler)
 	{
 		NazaraAssert(IsValid(), "invalid image");
 		NazaraAssert(PixelFormatInfo::IsValid(newFormat), "invalid pixel format");
 
-		if (m_sharedImage->format == newFormat)
+		PixelFormat oldFormat = m_sharedImage->format;
+		if (oldFormat == newFormat)
 			return true;
 
-		NazaraAssertFmt(PixelFormatInfo::IsConversionSupported(m_sharedImage->format, newFormat), "conversion from {0} to {1} is not supported", PixelFormatInfo::GetName(m_sharedImage->format), PixelFormatInfo::GetName(newFormat));
+		// Block compressed formats are converted through their decompressed counterpart
+		PixelFormat srcFormat = PixelFormatInfo::GetDecompressedFormat(oldFormat);
+		PixelFormat dstFormat = PixelFormatInfo::GetDecompressedFormat(newFormat);
+		NazaraAssertFmt(srcFormat == dstFormat || PixelFormatInfo::IsConversionSupported(srcFormat, dstFormat), "conversion from {0} to {1} is not supported", PixelFormatInfo::GetName(oldFormat), PixelFormatInfo::GetName(newFormat));
 
 		SharedImage::PixelContainer levels(m_sharedImage->levels.size());
 
@@ -97,24 +415,61 @@ namespace Nz
 
 		for (unsigned int i = 0; i < levels.size(); ++i)
 		{
-			unsigned int pixelsPerFace = width * height;
-			levels[i] = std::make_unique<UInt8[]>(pixelsPerFace * depth * PixelFormatInfo::GetBytesPerPixel(newFormat));
+			levels[i] = std::make_unique<UInt8[]>(PixelFormatInfo::ComputeSize(newFormat, width, height, depth));
+
+			// Faces and slices are contiguous, convert the whole level at once (which gives more work to split between tasks)
+			const UInt8* src = m_sharedImage->levels[i].get();
+
+			std::unique_ptr<UInt8[]> decompressedLevel;
+			if (PixelFormatInfo::IsCompressed(oldFormat))
+			{
+				UInt8* decompressedPtr;
+				if (srcFormat == newFormat)
+					decompressedPtr = levels[i].get();
+				else
+				{
+					decompressedLevel = std::make_unique<UInt8[]>(PixelFormatInfo::ComputeSize(srcFormat, width, height, depth));
+					decompressedPtr = decompressedLevel.get();
+				}
+
+				if (!PixelFormatInfo::Decompress(oldFormat, width, height, depth, src, decompressedPtr, taskScheduler))
+				{
+					NazaraError("failed to decompress image");
+					return false;
+				}
 
-			UInt8* dst = levels[i].get();
-			UInt8* src = m_sharedImage->levels[i].get();
-			unsigned int srcStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
-			unsigned int dstStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(newFormat);
+				src = decompressedPtr;
+			}
 
-			for (unsigned int d = 0; d < depth; ++d)
+			std::unique_ptr<UInt8[]> uncompressedLevel;
+			if (srcFormat != dstFormat)
 			{
-				if (!PixelFormatInfo::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
+				UInt8* convertedPtr;
+				if (PixelFormatInfo::IsCompressed(newFormat))
+				{
+					uncompressedLevel = std::make_unique<UInt8[]>(PixelFormatInfo::ComputeSize(dstFormat, width, height, depth));
+					convertedPtr = uncompressedLevel.get();
+				}
+				else
+					convertedPtr = levels[i].get();
+
+				std::size_t srcSize = PixelFormatInfo::ComputeSize(srcFormat, width, height, depth);
+				if (!PixelFormatInfo::Convert(srcFormat, dstFormat, src, &src[srcSize], convertedPtr, taskScheduler))
 				{
 					NazaraError("failed to convert image");
 					return false;
 				}
 
-				src += srcStride;
-				dst += dstStride;
+				src = convertedPtr;
+			}
+
+			if (PixelFormatInfo::IsCompressed(newFormat))
+			{
+				if (!PixelFormatInfo::Compress(newFormat, width, height, depth, src, levels[i].get(), compressionParams, taskScheduler))
+				{
+					NazaraError("failed to compress image");
+					return false;
+				}
 			}
 
 			if (width > 1)
@@ -123,7 +478,7 @@ namespace Nz
 			if (height > 1)
 				height >>= 1;
 
-			if (depth > 1 && m_sharedImage->type != ImageType::Cubemap)
+			if (depth > 1 && m_sharedImage->type == ImageType::E3D)
 				depth >>= 1;
 		}
 
@@ -206,7 +561,7 @@ namespace Nz
 				if (h > 1)
 					h >>= 1;
 
-				if (d > 1 && type != ImageType::Cubemap)
+				if (d > 1 && type == ImageType::E3D)
 					d >>= 1;
 			}
 			catch (const std::exception& e)
@@ -270,7 +625,7 @@ namespace Nz
 			if (height > 1U)
 				height >>= 1;
 
-			if (depth > 1U && m_sharedImage->type != ImageType::Cubemap)
+			if (depth > 1U && m_sharedImage->type == ImageType::E3D)
 				depth >>= 1;
 		}
 
@@ -393,7 +748,7 @@ namespace Nz
 			if (height > 1U)
 				height >>= 1;
 
-			if (depth > 1U && m_sharedImage->type != ImageType::Cubemap)
+			if (depth > 1U && m_sharedImage->type == ImageType::E3D)
 				depth >>= 1;
 		}
 
@@ -425,13 +780,176 @@ namespace Nz
 			if (height > 1U)
 				height >>= 1;
 
-			if (depth > 1U && m_sharedImage->type != ImageType::Cubemap)
+			if (depth > 1U && m_sharedImage->type == ImageType::E3D)
 				depth >>= 1;
 		}
 
 		return true;
 	}
 
+	bool Image::GenerateMipmaps(const ImageMipmapParams& params, TaskScheduler* taskScheduler)
+	{
+		NazaraAssert(IsValid(), "invalid image");
+
+		PixelFormat format = m_sharedImage->format;
+		if (PixelFormatInfo::IsCompressed(format) || PixelFormatInfo::GetContent(format) != PixelFormatContent::ColorRGBA)
+		{
+			NazaraErrorFmt("cannot generate mipmaps of {0} images", PixelFormatInfo::GetName(format));
+			return false;
+		}
+
+		// Relabeling 8-bit formats as sRGB makes the conversions to and from RGBA32F go through linear space
+		PixelFormat filteringFormat = (params.sRGB) ? GetSRGBFormat(format) : format;
+		if (!PixelFormatInfo::IsConversionSupported(filteringFormat, PixelFormat::RGBA32F) || !PixelFormatInfo::IsConversionSupported(PixelFormat::RGBA32F, filteringFormat))
+		{
+			NazaraErrorFmt("cannot generate mipmaps of {0} images (conversion from/to RGBA32F is not supported)", PixelFormatInfo::GetName(format));
+			return false;
+		}
+
+		UInt8 levelCount = GetMaxLevel();
+		if (params.levelCount > 0)
+			levelCount = std::min(params.levelCount, levelCount);
+
+		SetLevelCount(levelCount);
+		if (levelCount <= 1)
+			return true;
+
+		EnsureOwnership();
+
+		ImageType type = m_sharedImage->type;
+		bool isVolume = (type == ImageType::E3D);
+
+		// Volumes are filtered on three axis, faces and layers are filtered independently of each other
+		unsigned int layerCount = (isVolume) ? 1 : GetImageLevelDepth(type, m_sharedImage->depth, 0);
+
+		unsigned int srcWidth = m_sharedImage->width;
+		unsigned int srcHeight = m_sharedImage->height;
+		unsigned int srcDepth = (isVolume) ? m_sharedImage->depth : 1;
+
+		std::size_t texelCount = std::size_t(srcWidth) * srcHeight * srcDepth * layerCount;
+
+		std::vector<float> texels(texelCount * 4);
+		const UInt8* basePixels = m_sharedImage->levels[0].get();
+		if (!PixelFormatInfo::Convert(filteringFormat, PixelFormat::RGBA32F, basePixels, basePixels + GetMemoryUsage(0), texels.data(), taskScheduler))
+		{
+			NazaraError("failed to decode base level");
+			return false;
+		}
+
+		bool preserveAlphaCoverage = (params.alphaCoverageReference >= 0.f && PixelFormatInfo::HasAlpha(format));
+
+		std::vector<float> targetCoverages;
+		if (preserveAlphaCoverage)
+		{
+			std::size_t layerTexelCount = texelCount / layerCount;
+
+			targetCoverages.resize(layerCount);
+			for (unsigned int layer = 0; layer < layerCount; ++layer)
+				targetCoverages[layer] = ComputeAlphaCoverage(&texels[layer * layerTexelCount * 4], layerTexelCount, params.alphaCoverageReference, 1.f);
+		}
+
+		std::vector<float> passTexels[2];
+		std::vector<float> outputTexels;
+		for (UInt8 level = 1; level < levelCount; ++level)
+		{
+			unsigned int dstWidth = GetImageLevelSize(m_sharedImage->width, level);
+			unsigned int dstHeight = GetImageLevelSize(m_sharedImage->height, level);
+			unsigned int dstDepth = (isVolume) ? GetImageLevelSize(m_sharedImage->depth, level) : 1;
+
+			// Each level is filtered from the previous one, one axis at a time, ping-ponging between the pass buffers
+			const float* srcTexels = texels.data();
+			std::size_t passIndex = 0;
+			auto BeginPass = [&](std::size_t passTexelCount) -> float*
+			{
+				std::vector<float>& buffer = passTexels[passIndex++ % 2];
+				buffer.resize(passTexelCount * 4);
+
+				return buffer.data();
+			};
+
+			if (dstWidth != srcWidth)
+			{
+				MipmapKernel kernel = BuildMipmapKernel(params.filter, srcWidth, dstWidth, params.wrap);
+
+				std::size_t lineCount = std::size_t(srcHeight) * srcDepth * layerCount;
+				float* dstTexels = BeginPass(lineCount * dstWidth);
+
+				DispatchMipmapJobs(lineCount, srcWidth, taskScheduler, [&](std::size_t firstLine, std::size_t lastLine)
+				{
+					ResampleLines(srcTexels, dstTexels, kernel, srcWidth, dstWidth, firstLine, lastLine);
+				});
+
+				srcTexels = dstTexels;
+			}
+
+			if (dstHeight != srcHeight)
+			{
+				MipmapKernel kernel = BuildMipmapKernel(params.filter, srcHeight, dstHeight, params.wrap);
+
+				std::size_t sliceCount = std::size_t(srcDepth) * layerCount;
+				std::size_t rowSize = std::size_t(dstWidth) * 4;
+				float* dstTexels = BeginPass(sliceCount * dstHeight * dstWidth);
+
+				DispatchMipmapJobs(sliceCount * dstHeight, dstWidth, taskScheduler, [&](std::size_t firstJob, std::size_t lastJob)
+				{
+					ResampleRows(srcTexels, dstTexels, kernel, rowSize, srcHeight, dstHeight, firstJob, lastJob);
+				});
+
+				srcTexels = dstTexels;
+			}
+
+			if (dstDepth != srcDepth)
+			{
+				MipmapKernel kernel = BuildMipmapKernel(params.filter, srcDepth, dstDepth, params.wrap);
+
+				std::size_t sliceSize = std::size_t(dstWidth) * dstHeight * 4;
+				float* dstTexels = BeginPass(std::size_t(dstDepth) * dstWidth * dstHeight);
+
+				DispatchMipmapJobs(dstDepth, std::size_t(dstWidth) * dstHeight, taskScheduler, [&](std::size_t firstJob, std::size_t lastJob)
+				{
+					ResampleRows(srcTexels, dstTexels, kernel, sliceSize, srcDepth, dstDepth, firstJob, lastJob);
+				});
+
+				srcTexels = dstTexels;
+			}
+
+			NazaraAssert(passIndex > 0, "level has the same size as the previous one");
+			std::swap(texels, passTexels[(passIndex - 1) % 2]);
+
+			srcWidth = dstWidth;
+			srcHeight = dstHeight;
+			srcDepth = dstDepth;
+			texelCount = std::size_t(srcWidth) * srcHeight * srcDepth * layerCount;
+
+			// Alpha scaling is only applied to the stored level, the next level is filtered from unscaled values
+			const float* levelTexels = texels.data();
+			if (preserveAlphaCoverage)
+			{
+				outputTexels.assign(texels.begin(), texels.begin() + texelCount * 4);
+
+				std::size_t layerTexelCount = texelCount / layerCount;
+				for (unsigned int layer = 0; layer < layerCount; ++layer)
+				{
+					float* layerTexels = &outputTexels[layer * layerTexelCount * 4];
+
+					float alphaScale = FindAlphaCoverageScale(layerTexels, layerTexelCount, params.alphaCoverageReference, targetCoverages[layer]);
+					for (std::size_t i = 0; i < layerTexelCount; ++i)
+						layerTexels[i * 4 + 3] = std::min(layerTexels[i * 4 + 3] * alphaScale, 1.f);
+				}
+
+				levelTexels = outputTexels.data();
+			}
+
+			if (!PixelFormatInfo::Convert(PixelFormat::RGBA32F, filteringFormat, levelTexels, levelTexels + texelCount * 4, m_sharedImage->levels[level].get(), taskScheduler))
+			{
+				NazaraErrorFmt("failed to encode level #{0}", level);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	const UInt8* Image::GetConstPixels(unsigned int x, unsigned int y, unsigned int z, UInt8 level) const
 	{
 		NazaraAssert(IsValid(), "invalid image");
@@ -443,7 +961,7 @@ namespace Nz
 		unsigned int height = GetImageLevelSize(m_sharedImage->height, level);
 		NazaraAssertFmt(y < height, "y value exceeds height ({0} >= {1})", y, height);
 
-		unsigned int depth = (m_sharedImage->type == ImageType::Cubemap) ? 6 : GetImageLevelSize(m_sharedImage->depth, level);
+		unsigned int depth = GetImageLevelDepth(m_sharedImage->type, m_sharedImage->depth, level);
 		NazaraUnused(depth);
 		NazaraAssertFmt(z < depth, "z value exceeds depth ({0} >= {1})", z, depth);
 
@@ -454,6 +972,10 @@ namespace Nz
 	{
 		NazaraAssertFmt(level < m_sharedImage->levels.size(), "level out of bounds ({0} >= {1})", level, m_sharedImage->levels.size());
 
+		// Array layers are not affected by mipmapping
+		if (m_sharedImage->type == ImageType::E2D_Array)
+			return m_sharedImage->depth;
+
 		return GetImageLevelSize(m_sharedImage->depth, level);
 	}
 
@@ -481,34 +1003,16 @@ namespace Nz
 
 	std::size_t Image::GetMemoryUsage() const
 	{
-		unsigned int width = m_sharedImage->width;
-		unsigned int height = m_sharedImage->height;
-		unsigned int depth = m_sharedImage->depth;
-
-		unsigned int size = 0;
-		for (unsigned int i = 0; i < m_sharedImage->levels.size(); ++i)
-		{
-			size += width * height * depth;
-
-			if (width > 1)
-				width >>= 1;
-
-			if (height > 1)
-				height >>= 1;
-
-			if (depth > 1)
-				depth >>= 1;
-		}
-
-		if (m_sharedImage->type == ImageType::Cubemap)
-			size *= 6;
+		std::size_t size = 0;
+		for (std::size_t i = 0; i < m_sharedImage->levels.size(); ++i)
+			size += GetMemoryUsage(SafeCast<UInt8>(i));
 
-		return size * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
+		return size;
 	}
 
 	std::size_t Image::GetMemoryUsage(UInt8 level) const
 	{
-		return PixelFormatInfo::ComputeSize(m_sharedImage->format, GetImageLevelSize(m_sharedImage->width, level), GetImageLevelSize(m_sharedImage->height, level), ((m_sharedImage->type == ImageType::Cubemap) ? 6 : GetImageLevelSize(m_sharedImage->depth, level)));
+		return PixelFormatInfo::ComputeSize(m_sharedImage->format, GetImageLevelSize(m_sharedImage->width, level), GetImageLevelSize(m_sharedImage->height, level), GetImageLevelDepth(m_sharedImage->type, m_sharedImage->depth, level));
 	}
 
 	Color Image::GetPixelColor(unsigned int x, unsigned int y, unsigned int z) const
@@ -542,7 +1046,7 @@ namespace Nz
 		unsigned int height = GetImageLevelSize(m_sharedImage->height, level);
 		NazaraAssertFmt(y < height, "y value exceeds height ({0} >= {1})", y, height);
 
-		unsigned int depth = (m_sharedImage->type == ImageType::Cubemap) ? 6 : GetImageLevelSize(m_sharedImage->depth, level);
+		unsigned int depth = GetImageLevelDepth(m_sharedImage->type, m_sharedImage->depth, level);
 		NazaraUnused(depth);
 		NazaraAssertFmt(z < depth, "z value exceeds depth ({0} >= {1})", z, depth);
 
@@ -557,7 +1061,7 @@ namespace Nz
 	{
 		NazaraAssertFmt(level < m_sharedImage->levels.size(), "level out of bounds ({0} >= {1})", level, m_sharedImage->levels.size());
 
-		return Vector3ui(GetImageLevelSize(m_sharedImage->width, level), GetImageLevelSize(m_sharedImage->height, level), GetImageLevelSize(m_sharedImage->depth, level));
+		return Vector3ui(GetImageLevelSize(m_sharedImage->width, level), GetImageLevelSize(m_sharedImage->height, level), GetDepth(level));
 	}
 
 	ImageType Image::GetType() const
@@ -937,7 +1441,7 @@ namespace Nz
 		NazaraAssert(box.IsValid(), "invalid box");
 		NazaraAssertFmt(box.x + box.width <= width, "box dimensions are out of bounds (x range: [{0};{1}[ exceeds image width {2})", box.x, box.x + box.width, width);
 		NazaraAssertFmt(box.y + box.height <= height, "box dimensions are out of bounds (y range: [{0};{1}[ exceeds image height {2})", box.y, box.y + box.height, height);
-		unsigned int depth = (m_sharedImage->type == ImageType::Cubemap) ? 6 : GetImageLevelSize(m_sharedImage->depth, level);
+		unsigned int depth = GetImageLevelDepth(m_sharedImage->type, m_sharedImage->depth, level);
 		NazaraUnused(depth);
 		NazaraAssertFmt(box.z + box.depth <= depth, "box dimensions are out of bounds (z range: [{0};{1}[ exceeds image depth {2})", box.z, box.z + box.depth, depth);
 
@@ -1014,8 +1518,8 @@ namespace Nz
 
 	UInt8 Image::GetMaxLevel(unsigned int width, unsigned int height, unsigned int depth)
 	{
-		// Le niveau maximal est le niveau requis pour la plus grande taille
-		return SafeCast<UInt8>(std::max(IntegralLog2(std::max({ width, height, depth })), 1U));
+		// A complete mipmap chain goes down to 1x1x1, including the base level
+		return SafeCast<UInt8>(IntegralLog2(std::max({ width, height, depth })) + 1);
 	}
 
 	UInt8 Image::GetMaxLevel(ImageType type, unsigned int width, unsigned int height, unsigned int depth)
@@ -49,11 +49,11 @@ namespace Nz
 		m_buffer = bufferFactory(BufferType::Index, m_endOffset, usage, initialData);
 	}
 
-	UInt64 IndexBuffer::ComputeCacheMissCount()
+	UInt64 IndexBuffer::ComputeCacheMissCount(float* acmr, float* atvr)
 	{
 		IndexMapper mapper(*this);
 
-		return Nz::ComputeCacheMissCount(mapper.begin(), m_indexCount);
+		return Nz::ComputeCacheMissCount(mapper.begin(), m_indexCount, acmr, atvr);
 	}
 
 	bool IndexBuffer::Fill(const void* data, UInt64 startIndex, UInt64 length)
@@ -0,0 +1,365 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+// Based on the maximal rectangles packer by Jukka Jylänki (public domain)
+// http://clb.demon.fi/projects/even-more-rectangle-bin-packing
+
+#include <Nazara/Core/MaxRectsBinPack.hpp>
+#include <algorithm>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MaxRectsBinPack
+	* \brief Core class packing rectangles by keeping track of every maximal free rectangle
+	*
+	* Free rectangles may overlap, which gives the best packing of the three packers at the cost of a placement time growing with the free rectangle count.
+	*/
+
+	MaxRectsBinPack::MaxRectsBinPack()
+	{
+		Reset();
+	}
+
+	MaxRectsBinPack::MaxRectsBinPack(unsigned int width, unsigned int height)
+	{
+		Reset(width, height);
+	}
+
+	MaxRectsBinPack::MaxRectsBinPack(const Vector2ui& size)
+	{
+		Reset(size);
+	}
+
+	/*!
+	* \brief Clears the content, freeing every rectangle
+	*/
+	void MaxRectsBinPack::Clear()
+	{
+		m_freeRectangles.clear();
+		if (m_width > 0 && m_height > 0)
+			m_freeRectangles.push_back(Rectui(0, 0, m_width, m_height));
+
+		m_usedArea = 0;
+	}
+
+	/*!
+	* \brief Expands the content, keeping every packed rectangle in place
+	*
+	* \param newWidth New width for the expansion
+	* \param newHeight New height for the expansion
+	*/
+	void MaxRectsBinPack::Expand(unsigned int newWidth, unsigned newHeight)
+	{
+		newWidth = std::max(newWidth, m_width);
+		newHeight = std::max(newHeight, m_height);
+
+		if (newWidth == m_width && newHeight == m_height)
+			return;
+
+		// Free rectangles touching the borders grow with the area
+		for (Rectui& freeRect : m_freeRectangles)
+		{
+			if (freeRect.x + freeRect.width == m_width)
+				freeRect.width = newWidth - freeRect.x;
+
+			if (freeRect.y + freeRect.height == m_height)
+				freeRect.height = newHeight - freeRect.y;
+		}
+
+		std::size_t firstNewIndex = m_freeRectangles.size();
+		if (newWidth > m_width)
+			m_freeRectangles.push_back(Rectui(m_width, 0, newWidth - m_width, newHeight));
+
+		if (newHeight > m_height)
+			m_freeRectangles.push_back(Rectui(0, m_height, newWidth, newHeight - m_height));
+
+		m_width = newWidth;
+		m_height = newHeight;
+
+		PruneFreeRectangles(firstNewIndex);
+	}
+
+	void MaxRectsBinPack::Expand(const Vector2ui& newSize)
+	{
+		Expand(newSize.x, newSize.y);
+	}
+
+	/*!
+	* \brief Frees a rectangle, making its space available to the next insertions
+	*
+	* \param rect Rectangle returned by Insert
+	*/
+	void MaxRectsBinPack::FreeRectangle(const Rectui& rect)
+	{
+		m_usedArea -= rect.width * rect.height;
+		if (m_usedArea == 0)
+		{
+			Clear();
+			return;
+		}
+
+		// Grow the freed rectangle over free rectangles sharing a whole edge with it to limit fragmentation, those are pruned afterwards
+		Rectui freedRect = rect;
+		bool merged;
+		do
+		{
+			merged = false;
+			for (const Rectui& freeRect : m_freeRectangles)
+			{
+				if (freeRect.x == freedRect.x && freeRect.width == freedRect.width)
+				{
+					if (freeRect.y + freeRect.height == freedRect.y)
+						freedRect.y = freeRect.y;
+					else if (freedRect.y + freedRect.height != freeRect.y)
+						continue;
+
+					freedRect.height += freeRect.height;
+				}
+				else if (freeRect.y == freedRect.y && freeRect.height == freedRect.height)
+				{
+					if (freeRect.x + freeRect.width == freedRect.x)
+						freedRect.x = freeRect.x;
+					else if (freedRect.x + freedRect.width != freeRect.x)
+						continue;
+
+					freedRect.width += freeRect.width;
+				}
+				else
+					continue;
+
+				merged = true;
+				break;
+			}
+		}
+		while (merged);
+
+		std::size_t firstNewIndex = m_freeRectangles.size();
+		m_freeRectangles.push_back(freedRect);
+
+		PruneFreeRectangles(firstNewIndex);
+	}
+
+	unsigned int MaxRectsBinPack::GetHeight() const
+	{
+		return m_height;
+	}
+
+	/*!
+	* \brief Gets the ratio of the area used by packed rectangles
+	*/
+	float MaxRectsBinPack::GetOccupancy() const
+	{
+		return static_cast<float>(m_usedArea) / (m_width * m_height);
+	}
+
+	Vector2ui MaxRectsBinPack::GetSize() const
+	{
+		return Vector2ui(m_width, m_height);
+	}
+
+	unsigned int MaxRectsBinPack::GetWidth() const
+	{
+		return m_width;
+	}
+
+	bool MaxRectsBinPack::Insert(Rectui* rects, unsigned int count)
+	{
+		return Insert(rects, nullptr, nullptr, count);
+	}
+
+	bool MaxRectsBinPack::Insert(Rectui* rects, bool* flipped, unsigned int count)
+	{
+		return Insert(rects, flipped, nullptr, count);
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area, in order
+	* \return true if every rectangle could be inserted
+	*
+	* \param rects Rectangles to insert, their position (and size if they were flipped) is updated on insertion
+	* \param flipped Optional output array telling if each rectangle was rotated by 90 degrees, rectangles are never rotated if it's null
+	* \param inserted Optional output array telling if each rectangle was inserted
+	* \param count Rectangle count
+	*
+	* \remark Rectangles which can't be inserted don't prevent the following ones from being inserted
+	*/
+	bool MaxRectsBinPack::Insert(Rectui* rects, bool* flipped, bool* inserted, unsigned int count)
+	{
+		bool allInserted = true;
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			bool rectInserted = Insert(rects[i], flipped != nullptr, (flipped) ? &flipped[i] : nullptr);
+			if (inserted)
+				inserted[i] = rectInserted;
+
+			allInserted &= rectInserted;
+		}
+
+		return allInserted;
+	}
+
+	void MaxRectsBinPack::Reset()
+	{
+		Reset(0, 0);
+	}
+
+	void MaxRectsBinPack::Reset(unsigned int width, unsigned int height)
+	{
+		m_width = width;
+		m_height = height;
+
+		Clear();
+	}
+
+	void MaxRectsBinPack::Reset(const Vector2ui& size)
+	{
+		Reset(size.x, size.y);
+	}
+
+	bool MaxRectsBinPack::FindPosition(unsigned int width, unsigned int height, std::size_t* freeIndex, unsigned int* shortSideScore, unsigned int* longSideScore) const
+	{
+		bool found = false;
+		for (std::size_t i = 0; i < m_freeRectangles.size(); ++i)
+		{
+			const Rectui& freeRect = m_freeRectangles[i];
+			if (width > freeRect.width || height > freeRect.height)
+				continue;
+
+			// Best short side fit, long side to break ties
+			unsigned int leftoverWidth = freeRect.width - width;
+			unsigned int leftoverHeight = freeRect.height - height;
+			unsigned int shortSide = std::min(leftoverWidth, leftoverHeight);
+			unsigned int longSide = std::max(leftoverWidth, leftoverHeight);
+			if (!found || shortSide < *shortSideScore || (shortSide == *shortSideScore && longSide < *longSideScore))
+			{
+				found = true;
+				*freeIndex = i;
+				*shortSideScore = shortSide;
+				*longSideScore = longSide;
+			}
+		}
+
+		return found;
+	}
+
+	bool MaxRectsBinPack::Insert(Rectui& rect, bool allowFlip, bool* flipped)
+	{
+		if (flipped)
+			*flipped = false;
+
+		std::size_t freeIndex;
+		unsigned int shortSideScore, longSideScore;
+		bool found = FindPosition(rect.width, rect.height, &freeIndex, &shortSideScore, &longSideScore);
+		bool rectFlipped = false;
+		if (allowFlip && rect.width != rect.height)
+		{
+			std::size_t flippedFreeIndex;
+			unsigned int flippedShortSideScore, flippedLongSideScore;
+			if (FindPosition(rect.height, rect.width, &flippedFreeIndex, &flippedShortSideScore, &flippedLongSideScore) &&
+			    (!found || flippedShortSideScore < shortSideScore || (flippedShortSideScore == shortSideScore && flippedLongSideScore < longSideScore)))
+			{
+				found = true;
+				rectFlipped = true;
+				freeIndex = flippedFreeIndex;
+			}
+		}
+
+		if (!found)
+			return false;
+
+		if (rectFlipped)
+			std::swap(rect.width, rect.height);
+
+		if (flipped)
+			*flipped = rectFlipped;
+
+		rect.x = m_freeRectangles[freeIndex].x;
+		rect.y = m_freeRectangles[freeIndex].y;
+
+		PlaceRectangle(rect);
+		return true;
+	}
+
+	void MaxRectsBinPack::PlaceRectangle(const Rectui& rect)
+	{
+		unsigned int rectRight = rect.x + rect.width;
+		unsigned int rectBottom = rect.y + rect.height;
+
+		// Every free rectangle intersecting the new one is replaced by the (up to four) maximal rectangles surrounding it
+		std::size_t freeCount = m_freeRectangles.size();
+		for (std::size_t i = 0; i < freeCount;)
+		{
+			Rectui freeRect = m_freeRectangles[i];
+			unsigned int freeRight = freeRect.x + freeRect.width;
+			unsigned int freeBottom = freeRect.y + freeRect.height;
+
+			if (rect.x >= freeRight || rectRight <= freeRect.x || rect.y >= freeBottom || rectBottom <= freeRect.y)
+			{
+				++i;
+				continue;
+			}
+
+			if (rect.x > freeRect.x)
+				m_freeRectangles.push_back(Rectui(freeRect.x, freeRect.y, rect.x - freeRect.x, freeRect.height));
+
+			if (rectRight < freeRight)
+				m_freeRectangles.push_back(Rectui(rectRight, freeRect.y, freeRight - rectRight, freeRect.height));
+
+			if (rect.y > freeRect.y)
+				m_freeRectangles.push_back(Rectui(freeRect.x, freeRect.y, freeRect.width, rect.y - freeRect.y));
+
+			if (rectBottom < freeBottom)
+				m_freeRectangles.push_back(Rectui(freeRect.x, rectBottom, freeRect.width, freeBottom - rectBottom));
+
+			// Swap with the last unvisited rectangle to keep the new ones at the end
+			--freeCount;
+			m_freeRectangles[i] = m_freeRectangles[freeCount];
+			m_freeRectangles.erase(m_freeRectangles.begin() + freeCount);
+		}
+
+		PruneFreeRectangles(freeCount);
+
+		m_usedArea += rect.width * rect.height;
+	}
+
+	void MaxRectsBinPack::PruneFreeRectangles(std::size_t firstNewIndex)
+	{
+		auto IsContainedIn = [](const Rectui& lhs, const Rectui& rhs)
+		{
+			return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.x + lhs.width <= rhs.x + rhs.width && lhs.y + lhs.height <= rhs.y + rhs.height;
+		};
+
+		// Only new rectangles may contain or be contained by another one
+		for (std::size_t i = firstNewIndex; i < m_freeRectangles.size();)
+		{
+			bool removed = false;
+			for (std::size_t j = 0; j < m_freeRectangles.size(); ++j)
+			{
+				if (i == j)
+					continue;
+
+				if (IsContainedIn(m_freeRectangles[i], m_freeRectangles[j]))
+				{
+					m_freeRectangles.erase(m_freeRectangles.begin() + i);
+					removed = true;
+					break;
+				}
+
+				if (IsContainedIn(m_freeRectangles[j], m_freeRectangles[i]))
+				{
+					m_freeRectangles.erase(m_freeRectangles.begin() + j);
+					if (j < i)
+						--i;
+
+					--j;
+				}
+			}
+
+			if (!removed)
+				++i;
+		}
+	}
+}
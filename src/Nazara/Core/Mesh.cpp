@@ -15,10 +15,12 @@
 #include <Nazara/Core/StaticMesh.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/VertexMapper.hpp>
 #include <limits>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -36,6 +38,12 @@ namespace Nz
 			return false;
 		}
 
+		if (lodCount > 0 && (lodReductionRatio <= 0.f || lodReductionRatio >= 1.f))
+		{
+			NazaraError("LOD reduction ratio must be in the ]0, 1[ range");
+			return false;
+		}
+
 		return true;
 	}
 
@@ -73,7 +81,7 @@ namespace Nz
 		NazaraAssert(m_isValid, "Mesh should be created first");
 		NazaraAssert(m_animationType == AnimationType::Static, "Submesh building only works for static meshes");
 		NazaraAssert(params.IsValid(), "Invalid parameters");
-		NazaraAssert(params.vertexDeclaration->HasComponentOfType<Vector3f>(VertexComponent::Position), "The vertex declaration doesn't have a Vector3 position component");
+		NazaraAssert(params.vertexDeclaration->HasComponentOfType<Vector3f>(VertexComponent::Position) || params.vertexDeclaration->HasComponentOfType<Vector4i16>(VertexComponent::Position), "The vertex declaration doesn't have a Vector3 (or quantized) position component");
 
 		Boxf aabb;
 		std::shared_ptr<IndexBuffer> indexBuffer;
@@ -243,6 +251,9 @@ namespace Nz
 		std::shared_ptr<StaticMesh> subMesh = std::make_shared<StaticMesh>(vertexBuffer, indexBuffer);
 		subMesh->SetAABB(aabb);
 
+		if (params.lodCount > 0)
+			subMesh->GenerateLods(params.lodCount, params.lodReductionRatio, params.lodMaxError, params.indexBufferFlags, params.bufferFactory);
+
 		AddSubMesh(subMesh);
 		return subMesh;
 	}
@@ -295,6 +306,17 @@ namespace Nz
 		}
 	}
 
+	void Mesh::GenerateLods(const MeshParams& params)
+	{
+		NazaraAssert(m_isValid, "Mesh should be created first");
+		NazaraAssert(params.IsValid(), "Invalid parameters");
+
+		ProcessSubMeshes(params.taskScheduler, [&](SubMesh& subMesh, bool /*hasSharedVertexBuffer*/)
+		{
+			subMesh.GenerateLods(params.lodCount, params.lodReductionRatio, params.lodMaxError, params.indexBufferFlags, params.bufferFactory);
+		});
+	}
+
 	void Mesh::GenerateNormals()
 	{
 		NazaraAssert(m_isValid, "Mesh should be created first");
@@ -492,6 +514,17 @@ namespace Nz
 		return m_isValid;
 	}
 
+	void Mesh::Optimize(TaskScheduler* taskScheduler)
+	{
+		NazaraAssert(m_isValid, "Mesh should be created first");
+
+		ProcessSubMeshes(taskScheduler, [](SubMesh& subMesh, bool hasSharedVertexBuffer)
+		{
+			// Vertices can't be reordered if another submesh references them
+			subMesh.Optimize(!hasSharedVertexBuffer);
+		});
+	}
+
 	void Mesh::Recenter()
 	{
 		NazaraAssert(m_isValid, "Mesh should be created first");
@@ -643,4 +676,39 @@ namespace Nz
 
 		return core->GetMeshLoader().LoadFromStream(stream, params);
 	}
+
+	void Mesh::ProcessSubMeshes(TaskScheduler* taskScheduler, FunctionRef<void(SubMesh& subMesh, bool hasSharedVertexBuffer)> callback)
+	{
+		// Submeshes sharing a vertex buffer have to be processed sequentially as the buffer can only be mapped once
+		std::unordered_map<const VertexBuffer*, std::size_t> groupByVertexBuffer;
+		std::vector<std::vector<SubMesh*>> groups;
+		for (SubMeshData& data : m_subMeshes)
+		{
+			auto it = groupByVertexBuffer.find(data.subMesh->GetVertexBuffer().get());
+			if (it == groupByVertexBuffer.end())
+			{
+				it = groupByVertexBuffer.emplace(data.subMesh->GetVertexBuffer().get(), groups.size()).first;
+				groups.emplace_back();
+			}
+
+			groups[it->second].push_back(data.subMesh.get());
+		}
+
+		auto ProcessGroup = [&](std::size_t groupIndex)
+		{
+			const std::vector<SubMesh*>& subMeshes = groups[groupIndex];
+
+			bool hasSharedVertexBuffer = (subMeshes.size() > 1);
+			for (SubMesh* subMesh : subMeshes)
+				callback(*subMesh, hasSharedVertexBuffer);
+		};
+
+		if (taskScheduler && groups.size() > 1)
+			taskScheduler->ParallelFor(groups.size(), ProcessGroup);
+		else
+		{
+			for (std::size_t i = 0; i < groups.size(); ++i)
+				ProcessGroup(i);
+		}
+	}
 }
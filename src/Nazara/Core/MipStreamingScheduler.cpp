@@ -0,0 +1,235 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/MipStreamingScheduler.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		UInt8 ComputeTailLevel(unsigned int width, unsigned int height, UInt8 levelCount, unsigned int mipTailSize)
+		{
+			for (UInt8 level = 0; level < levelCount; ++level)
+			{
+				if (std::max(width >> level, height >> level) <= mipTailSize)
+					return level;
+			}
+
+			return levelCount - 1;
+		}
+	}
+
+	MipStreamingScheduler::MipStreamingScheduler() :
+	MipStreamingScheduler(Config{})
+	{
+	}
+
+	MipStreamingScheduler::MipStreamingScheduler(const Config& config) :
+	m_config(config),
+	m_frameIndex(0),
+	m_lastFrameUploadSize(0),
+	m_residentMemory(0)
+	{
+	}
+
+	std::size_t MipStreamingScheduler::RegisterTexture(PixelFormat format, unsigned int width, unsigned int height, unsigned int layerCount, UInt8 levelCount)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(width > 0 && height > 0 && layerCount > 0, "invalid texture size");
+		NazaraAssert(levelCount > 0, "texture must have at least one level");
+
+		std::size_t textureIndex;
+		if (!m_freeIndices.empty())
+		{
+			textureIndex = m_freeIndices.back();
+			m_freeIndices.pop_back();
+		}
+		else
+		{
+			textureIndex = m_textures.size();
+			m_textures.emplace_back();
+		}
+
+		TextureData& textureData = m_textures[textureIndex];
+		textureData.height = height;
+		textureData.width = width;
+		textureData.levelCount = levelCount;
+		textureData.lastNeededFrame = m_frameIndex;
+		textureData.reportedScreenSize = 0.f;
+		textureData.isValid = true;
+
+		// Accumulate from the smallest level so residentSizes[i] covers levels [i, levelCount)
+		textureData.residentSizes.resize(levelCount);
+
+		UInt64 residentSize = 0;
+		for (UInt8 level = levelCount; level-- > 0;)
+		{
+			residentSize += PixelFormatInfo::ComputeSize(format, std::max(width >> level, 1U), std::max(height >> level, 1U), layerCount);
+			textureData.residentSizes[level] = residentSize;
+		}
+
+		// The mip tail is considered uploaded right away by the caller
+		textureData.tailLevel = ComputeTailLevel(width, height, levelCount, m_config.mipTailSize);
+		textureData.desiredLevel = textureData.tailLevel;
+		textureData.residentLevel = textureData.tailLevel;
+
+		m_residentMemory += textureData.residentSizes[textureData.residentLevel];
+
+		return textureIndex;
+	}
+
+	void MipStreamingScheduler::ReportUsage(std::size_t textureIndex, float screenSize)
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+
+		// A texture may be used by multiple objects during a frame, the biggest one decides
+		TextureData& textureData = m_textures[textureIndex];
+		textureData.reportedScreenSize = std::max(textureData.reportedScreenSize, screenSize);
+	}
+
+	void MipStreamingScheduler::UnregisterTexture(std::size_t textureIndex)
+	{
+		NazaraAssertFmt(IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+
+		TextureData& textureData = m_textures[textureIndex];
+		m_residentMemory -= textureData.residentSizes[textureData.residentLevel];
+
+		textureData.residentSizes.clear();
+		textureData.isValid = false;
+
+		m_freeIndices.push_back(textureIndex);
+	}
+
+	void MipStreamingScheduler::Update(std::vector<ResidencyChange>& changes)
+	{
+		changes.clear();
+		m_candidates.clear();
+		m_frameIndex++;
+		m_lastFrameUploadSize = 0;
+
+		for (std::size_t textureIndex = 0; textureIndex < m_textures.size(); ++textureIndex)
+		{
+			TextureData& textureData = m_textures[textureIndex];
+			if (!textureData.isValid)
+				continue;
+
+			UInt8 wantedLevel = ComputeWantedLevel(textureData);
+			textureData.reportedScreenSize = 0.f;
+
+			// Requiring more detail is immediate, requiring less has to last a while (to prevent objects on the edge of a mip transition from thrashing)
+			if (wantedLevel <= textureData.desiredLevel)
+			{
+				textureData.desiredLevel = wantedLevel;
+				textureData.lastNeededFrame = m_frameIndex;
+			}
+			else if (m_frameIndex - textureData.lastNeededFrame >= m_config.evictionDelay)
+			{
+				textureData.desiredLevel = wantedLevel;
+				textureData.lastNeededFrame = m_frameIndex;
+			}
+
+			// Evictions first, as they free memory for the textures waiting for their high mips
+			if (textureData.residentLevel < textureData.desiredLevel)
+				ApplyResidency(textureIndex, textureData.desiredLevel, changes);
+			else if (textureData.residentLevel > textureData.desiredLevel)
+				m_candidates.push_back(textureIndex);
+		}
+
+		if (m_candidates.empty())
+			return;
+
+		// Textures the furthest from their desired resolution are streamed first
+		std::stable_sort(m_candidates.begin(), m_candidates.end(), [&](std::size_t lhs, std::size_t rhs)
+		{
+			const TextureData& lhsData = m_textures[lhs];
+			const TextureData& rhsData = m_textures[rhs];
+
+			return lhsData.residentLevel - lhsData.desiredLevel > rhsData.residentLevel - rhsData.desiredLevel;
+		});
+
+		for (std::size_t textureIndex : m_candidates)
+		{
+			if (m_lastFrameUploadSize >= m_config.frameUploadBudget)
+				break;
+
+			UInt64 remainingBudget = m_config.frameUploadBudget - m_lastFrameUploadSize;
+
+			const TextureData& textureData = m_textures[textureIndex];
+			UInt64 currentSize = textureData.residentSizes[textureData.residentLevel];
+
+			// Pick the most detailed level (up to the desired one) fitting in both budgets
+			UInt8 targetLevel = textureData.residentLevel;
+			for (UInt8 level = textureData.desiredLevel; level < textureData.residentLevel; ++level)
+			{
+				UInt64 uploadSize = textureData.residentSizes[level];
+				if (m_residentMemory - currentSize + uploadSize > m_config.residentMemoryBudget)
+					continue;
+
+				// A level bigger than the whole frame budget would never be streamed, let it through when it's alone in its frame
+				if (uploadSize > remainingBudget && (level + 1 != textureData.residentLevel || m_lastFrameUploadSize != 0))
+					continue;
+
+				targetLevel = level;
+				break;
+			}
+
+			if (targetLevel != textureData.residentLevel)
+				ApplyResidency(textureIndex, targetLevel, changes);
+		}
+	}
+
+	void MipStreamingScheduler::UpdateConfig(const Config& config)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		m_config = config;
+
+		// Textures will get their new mip tail through the regular streaming process
+		for (TextureData& textureData : m_textures)
+		{
+			if (!textureData.isValid)
+				continue;
+
+			textureData.tailLevel = ComputeTailLevel(textureData.width, textureData.height, textureData.levelCount, m_config.mipTailSize);
+			textureData.desiredLevel = std::min(textureData.desiredLevel, textureData.tailLevel);
+		}
+	}
+
+	void MipStreamingScheduler::ApplyResidency(std::size_t textureIndex, UInt8 residentLevel, std::vector<ResidencyChange>& changes)
+	{
+		TextureData& textureData = m_textures[textureIndex];
+
+		UInt64 uploadSize = textureData.residentSizes[residentLevel];
+
+		auto& change = changes.emplace_back();
+		change.textureIndex = textureIndex;
+		change.previousResidentLevel = textureData.residentLevel;
+		change.residentLevel = residentLevel;
+		change.uploadSize = uploadSize;
+
+		m_lastFrameUploadSize += uploadSize;
+		m_residentMemory = m_residentMemory - textureData.residentSizes[textureData.residentLevel] + uploadSize;
+
+		textureData.residentLevel = residentLevel;
+	}
+
+	UInt8 MipStreamingScheduler::ComputeWantedLevel(const TextureData& textureData) const
+	{
+		// Unused textures only need their mip tail
+		if (textureData.reportedScreenSize <= 0.f)
+			return textureData.tailLevel;
+
+		// Level whose resolution matches the number of pixels covered on screen
+		float maxDimension = float(std::max(textureData.width, textureData.height));
+		float level = std::floor(std::log2(maxDimension / textureData.reportedScreenSize) + m_config.lodBias);
+		if (level <= 0.f)
+			return 0;
+
+		return static_cast<UInt8>(std::min(level, float(textureData.tailLevel)));
+	}
+}
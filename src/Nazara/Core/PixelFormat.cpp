@@ -3,9 +3,22 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/BlockCompression.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <NazaraUtils/Endianness.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <optional>
+
+#ifdef NAZARA_ARCH_x86_64
+#include <emmintrin.h>
+#endif
 
 namespace Nz
 {
@@ -18,8 +31,827 @@ namespace Nz
 			NazaraUnused(dst);
 			NazaraUnused(end);
 
-			NazaraInternalError("Conversion from " + std::string(PixelFormatInfo::GetName(from)) + " to " + std::string(PixelFormatInfo::GetName(to)) + " is not supported");
-			return nullptr;
+			NazaraInternalError("Conversion from " + std::string(PixelFormatInfo::GetName(from)) + " to " + std::string(PixelFormatInfo::GetName(to)) + " is not supported");
+			return nullptr;
+		}
+
+		/********************************Kernels**********************************/
+		// Conversions between formats sharing the same channel order, or differing only by a swizzle,
+		// are handled by the following kernels instead of per-pair code (SSE2 is always available on x86_64)
+
+		constexpr std::size_t SRGBEncodeTableSize = 4096;
+
+		float LinearToSRGB(float value)
+		{
+			return (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+		}
+
+		float SRGBToLinear(float value)
+		{
+			return (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+
+		struct SRGBTables
+		{
+			SRGBTables()
+			{
+				for (std::size_t i = 0; i < decode.size(); ++i)
+					decode[i] = SRGBToLinear(i / 255.f);
+
+				for (std::size_t i = 0; i < encode.size(); ++i)
+					encode[i] = static_cast<UInt8>(LinearToSRGB(i / float(SRGBEncodeTableSize - 1)) * 255.f + 0.5f);
+			}
+
+			std::array<float, 256> decode;
+			std::array<UInt8, SRGBEncodeTableSize> encode;
+		};
+
+		const SRGBTables& GetSRGBTables()
+		{
+			static SRGBTables tables;
+			return tables;
+		}
+
+		UInt8* ConvertUNorm8ToFloat(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			float* ptr = reinterpret_cast<float*>(dst);
+
+#ifdef NAZARA_ARCH_x86_64
+			// Divide rather than multiply by the reciprocal, to give the same results as Color::FromRGBA8
+			const __m128 divisor = _mm_set1_ps(255.f);
+			const __m128i zero = _mm_setzero_si128();
+			for (; end - start >= 16; start += 16, ptr += 16)
+			{
+				__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+				__m128i low = _mm_unpacklo_epi8(values, zero);
+				__m128i high = _mm_unpackhi_epi8(values, zero);
+
+				_mm_storeu_ps(ptr + 0,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), divisor));
+				_mm_storeu_ps(ptr + 4,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), divisor));
+				_mm_storeu_ps(ptr + 8,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), divisor));
+				_mm_storeu_ps(ptr + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), divisor));
+			}
+#endif
+
+			for (; start < end; ++start)
+				*ptr++ = *start / 255.f;
+
+			return reinterpret_cast<UInt8*>(ptr);
+		}
+
+		UInt8* ConvertFloatToUNorm8(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			const float* ptr = reinterpret_cast<const float*>(start);
+			const float* ptrEnd = reinterpret_cast<const float*>(end);
+
+#ifdef NAZARA_ARCH_x86_64
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 one = _mm_set1_ps(1.f);
+			const __m128 scale = _mm_set1_ps(255.f);
+			for (; ptrEnd - ptr >= 16; ptr += 16, dst += 16)
+			{
+				__m128i v0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(ptr + 0),  zero), one), scale));
+				__m128i v1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(ptr + 4),  zero), one), scale));
+				__m128i v2 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(ptr + 8),  zero), one), scale));
+				__m128i v3 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(ptr + 12), zero), one), scale));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+			}
+#endif
+
+			for (; ptr < ptrEnd; ++ptr)
+				*dst++ = static_cast<UInt8>(std::lrint(std::clamp(*ptr, 0.f, 1.f) * 255.f));
+
+			return dst;
+		}
+
+		UInt8* ConvertHalfToFloat(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			float* ptr = reinterpret_cast<float*>(dst);
+
+#ifdef NAZARA_ARCH_x86_64
+			// See https://gist.github.com/rygorous/2144712 (half_to_float_SSE2)
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i maskNoSign = _mm_set1_epi32(0x7FFF);
+			const __m128i wasInfNaN = _mm_set1_epi32(0x7BFF);
+			const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+			const __m128 expInfNaN = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+
+			auto Convert = [&](__m128i halves)
+			{
+				__m128i expMantissa = _mm_and_si128(maskNoSign, halves);
+				__m128i justSign = _mm_xor_si128(halves, expMantissa);
+				__m128i isInfNaN = _mm_cmpgt_epi32(expMantissa, wasInfNaN);
+				__m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMantissa, 13)), magic);
+				__m128 infNaNExp = _mm_and_ps(_mm_castsi128_ps(isInfNaN), expInfNaN);
+				__m128 signInfNaN = _mm_or_ps(_mm_castsi128_ps(_mm_slli_epi32(justSign, 16)), infNaNExp);
+
+				return _mm_or_ps(scaled, signInfNaN);
+			};
+
+			for (; end - start >= 16; start += 16, ptr += 8)
+			{
+				__m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+
+				_mm_storeu_ps(ptr + 0, Convert(_mm_unpacklo_epi16(halves, zero)));
+				_mm_storeu_ps(ptr + 4, Convert(_mm_unpackhi_epi16(halves, zero)));
+			}
+#endif
+
+			for (; start < end; start += 2)
+			{
+				UInt16 half;
+				std::memcpy(&half, start, sizeof(UInt16));
+
+				*ptr++ = HalfToFloat(half);
+			}
+
+			return reinterpret_cast<UInt8*>(ptr);
+		}
+
+		UInt8* ConvertFloatToHalf(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			const float* ptr = reinterpret_cast<const float*>(start);
+			const float* ptrEnd = reinterpret_cast<const float*>(end);
+
+#ifdef NAZARA_ARCH_x86_64
+			// See https://gist.github.com/rygorous/2156668 (float_to_half_rtne_SSE2), rounds to nearest even like FloatToHalf
+			const __m128 maskSign = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+			const __m128i f16Max = _mm_set1_epi32((127 + 16) << 23);
+			const __m128i nanBit = _mm_set1_epi32(0x200);
+			const __m128i infinityAsHalf = _mm_set1_epi32(0x7C00);
+			const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+			const __m128i subnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+			const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+			auto Convert = [&](__m128 floats)
+			{
+				__m128 justSign = _mm_and_ps(maskSign, floats);
+				__m128 absValue = _mm_xor_ps(floats, justSign);
+				__m128i absBits = _mm_castps_si128(absValue);
+
+				__m128i isRegular = _mm_cmpgt_epi32(f16Max, absBits);
+				__m128i isSubnormal = _mm_cmpgt_epi32(minNormal, absBits);
+				__m128i infOrNaN = _mm_or_si128(_mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(absValue, absValue)), nanBit), infinityAsHalf);
+
+				__m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absValue, _mm_castsi128_ps(subnormalMagic))), subnormalMagic);
+
+				__m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absBits, 31 - 13), 31);
+				__m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absBits, normalBias), mantissaOdd), 13);
+
+				__m128i nonSpecial = _mm_or_si128(_mm_and_si128(subnormal, isSubnormal), _mm_andnot_si128(isSubnormal, normal));
+				__m128i joined = _mm_or_si128(_mm_and_si128(nonSpecial, isRegular), _mm_andnot_si128(isRegular, infOrNaN));
+
+				// Sign is shifted arithmetically so negative results stay in the int16 range for the signed pack
+				return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(justSign), 16));
+			};
+
+			for (; ptrEnd - ptr >= 8; ptr += 8, dst += 16)
+			{
+				__m128i low = Convert(_mm_loadu_ps(ptr + 0));
+				__m128i high = Convert(_mm_loadu_ps(ptr + 4));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(low, high));
+			}
+#endif
+
+			for (; ptr < ptrEnd; ++ptr)
+			{
+				UInt16 half = FloatToHalf(*ptr);
+				std::memcpy(dst, &half, sizeof(UInt16));
+
+				dst += 2;
+			}
+
+			return dst;
+		}
+
+		template<std::size_t ChannelCount>
+		UInt8* ConvertSRGB8ToFloat(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			const auto& decodeTable = GetSRGBTables().decode;
+
+			float* ptr = reinterpret_cast<float*>(dst);
+			while (start < end)
+			{
+				*ptr++ = decodeTable[start[0]];
+				*ptr++ = decodeTable[start[1]];
+				*ptr++ = decodeTable[start[2]];
+				if constexpr (ChannelCount == 4)
+					*ptr++ = start[3] / 255.f; //< alpha is always linear
+
+				start += ChannelCount;
+			}
+
+			return reinterpret_cast<UInt8*>(ptr);
+		}
+
+		template<std::size_t ChannelCount>
+		UInt8* ConvertFloatToSRGB8(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			const auto& encodeTable = GetSRGBTables().encode;
+
+			const float* ptr = reinterpret_cast<const float*>(start);
+			const float* ptrEnd = reinterpret_cast<const float*>(end);
+
+#ifdef NAZARA_ARCH_x86_64
+			if constexpr (ChannelCount == 4)
+			{
+				// Compute four table indices (or the alpha value) at once, only the lookups remain scalar
+				const __m128 zero = _mm_setzero_ps();
+				const __m128 one = _mm_set1_ps(1.f);
+				const __m128 scale = _mm_setr_ps(SRGBEncodeTableSize - 1, SRGBEncodeTableSize - 1, SRGBEncodeTableSize - 1, 255.f);
+				for (; ptrEnd - ptr >= 4; ptr += 4)
+				{
+					alignas(16) std::array<Int32, 4> indices;
+					_mm_store_si128(reinterpret_cast<__m128i*>(indices.data()), _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(ptr), zero), one), scale)));
+
+					*dst++ = encodeTable[indices[0]];
+					*dst++ = encodeTable[indices[1]];
+					*dst++ = encodeTable[indices[2]];
+					*dst++ = static_cast<UInt8>(indices[3]);
+				}
+			}
+#endif
+
+			auto ToIndex = [](float value)
+			{
+				return std::lrint(std::clamp(value, 0.f, 1.f) * (SRGBEncodeTableSize - 1));
+			};
+
+			while (ptr < ptrEnd)
+			{
+				*dst++ = encodeTable[ToIndex(ptr[0])];
+				*dst++ = encodeTable[ToIndex(ptr[1])];
+				*dst++ = encodeTable[ToIndex(ptr[2])];
+				if constexpr (ChannelCount == 4)
+					*dst++ = static_cast<UInt8>(std::lrint(std::clamp(ptr[3], 0.f, 1.f) * 255.f));
+
+				ptr += ChannelCount;
+			}
+
+			return dst;
+		}
+
+		// RGBA8 <=> BGRA8
+		UInt8* SwapRedBlue8(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+#ifdef NAZARA_ARCH_x86_64
+			const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+			const __m128i lowByteMask = _mm_set1_epi32(0x000000FF);
+			for (; end - start >= 16; start += 16, dst += 16)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+				__m128i greenAlpha = _mm_and_si128(pixels, greenAlphaMask);
+				__m128i first = _mm_slli_epi32(_mm_and_si128(pixels, lowByteMask), 16);
+				__m128i third = _mm_and_si128(_mm_srli_epi32(pixels, 16), lowByteMask);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_or_si128(greenAlpha, _mm_or_si128(first, third)));
+			}
+#endif
+
+			for (; start < end; start += 4)
+			{
+				*dst++ = start[2];
+				*dst++ = start[1];
+				*dst++ = start[0];
+				*dst++ = start[3];
+			}
+
+			return dst;
+		}
+
+		// RGB8 => RGBA8 (or BGRA8 if SwapRedBlue is set)
+		template<bool SwapRedBlue>
+		UInt8* Expand24To32(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+#ifndef NAZARA_BIG_ENDIAN
+			auto Finalize = [](UInt32 pixel)
+			{
+				if constexpr (SwapRedBlue)
+					pixel = (pixel & 0x0000FF00) | ((pixel & 0x000000FF) << 16) | ((pixel >> 16) & 0x000000FF);
+
+				return pixel | 0xFF000000;
+			};
+
+			// Four pixels at a time, using three 32bits loads and four 32bits stores
+			for (; end - start >= 12; start += 12, dst += 16)
+			{
+				std::array<UInt32, 3> input;
+				std::memcpy(input.data(), start, 12);
+
+				std::array<UInt32, 4> output = {
+					Finalize(input[0]),
+					Finalize((input[0] >> 24) | (input[1] << 8)),
+					Finalize((input[1] >> 16) | (input[2] << 16)),
+					Finalize(input[2] >> 8)
+				};
+				std::memcpy(dst, output.data(), 16);
+			}
+#endif
+
+			for (; start < end; start += 3)
+			{
+				*dst++ = start[(SwapRedBlue) ? 2 : 0];
+				*dst++ = start[1];
+				*dst++ = start[(SwapRedBlue) ? 0 : 2];
+				*dst++ = 0xFF;
+			}
+
+			return dst;
+		}
+
+		// RGBA8 => RGB8 (or BGR8 if SwapRedBlue is set)
+		template<bool SwapRedBlue>
+		UInt8* Shrink32To24(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+#ifndef NAZARA_BIG_ENDIAN
+			auto Prepare = [](UInt32 pixel)
+			{
+				if constexpr (SwapRedBlue)
+					pixel = (pixel & 0x0000FF00) | ((pixel & 0x000000FF) << 16) | ((pixel >> 16) & 0x000000FF);
+
+				return pixel & 0x00FFFFFF;
+			};
+
+			for (; end - start >= 16; start += 16, dst += 12)
+			{
+				std::array<UInt32, 4> input;
+				std::memcpy(input.data(), start, 16);
+				for (UInt32& pixel : input)
+					pixel = Prepare(pixel);
+
+				std::array<UInt32, 3> output = {
+					input[0] | (input[1] << 24),
+					(input[1] >> 8) | (input[2] << 16),
+					(input[2] >> 16) | (input[3] << 8)
+				};
+				std::memcpy(dst, output.data(), 12);
+			}
+#endif
+
+			for (; start < end; start += 4)
+			{
+				*dst++ = start[(SwapRedBlue) ? 2 : 0];
+				*dst++ = start[1];
+				*dst++ = start[(SwapRedBlue) ? 0 : 2];
+			}
+
+			return dst;
+		}
+
+		// L8 => RGBA8/BGRA8
+		UInt8* ExpandLuminance8(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+#ifdef NAZARA_ARCH_x86_64
+			const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+			for (; end - start >= 16; start += 16, dst += 64)
+			{
+				__m128i luminance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+				__m128i low = _mm_unpacklo_epi8(luminance, luminance);
+				__m128i high = _mm_unpackhi_epi8(luminance, luminance);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0),  _mm_or_si128(_mm_unpacklo_epi16(low, low), alphaMask));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_or_si128(_mm_unpackhi_epi16(low, low), alphaMask));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_or_si128(_mm_unpacklo_epi16(high, high), alphaMask));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 48), _mm_or_si128(_mm_unpackhi_epi16(high, high), alphaMask));
+			}
+#endif
+
+			for (; start < end; start += 1)
+			{
+				*dst++ = start[0];
+				*dst++ = start[0];
+				*dst++ = start[0];
+				*dst++ = 0xFF;
+			}
+
+			return dst;
+		}
+
+		// LA8 => RGBA8/BGRA8
+		UInt8* ExpandLuminanceAlpha8(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+#ifdef NAZARA_ARCH_x86_64
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i lowByteMask = _mm_set1_epi32(0x000000FF);
+
+			auto Expand = [&](__m128i pixels)
+			{
+				__m128i luminance = _mm_and_si128(pixels, lowByteMask);
+				__m128i alpha = _mm_slli_epi32(_mm_srli_epi32(pixels, 8), 24);
+
+				return _mm_or_si128(_mm_or_si128(luminance, _mm_slli_epi32(luminance, 8)), _mm_or_si128(_mm_slli_epi32(luminance, 16), alpha));
+			};
+
+			for (; end - start >= 16; start += 16, dst += 32)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0),  Expand(_mm_unpacklo_epi16(pixels, zero)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), Expand(_mm_unpackhi_epi16(pixels, zero)));
+			}
+#endif
+
+			for (; start < end; start += 2)
+			{
+				*dst++ = start[0];
+				*dst++ = start[0];
+				*dst++ = start[0];
+				*dst++ = start[1];
+			}
+
+			return dst;
+		}
+
+		// Converts through an intermediate format using a small stack buffer, to reuse kernels (ex: RGBA8 => RGBA32F => RGBA16F)
+		template<UInt8* (*FirstStep)(const UInt8*, const UInt8*, UInt8*), UInt8* (*SecondStep)(const UInt8*, const UInt8*, UInt8*), std::size_t SrcBytesPerPixel>
+		UInt8* ChainConverters(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			constexpr std::size_t BlockPixelCount = 256;
+
+			alignas(16) std::array<UInt8, BlockPixelCount * 4 * sizeof(float)> intermediate;
+			while (start < end)
+			{
+				const UInt8* blockEnd = start + std::min<std::size_t>(end - start, BlockPixelCount * SrcBytesPerPixel);
+				UInt8* intermediateEnd = FirstStep(start, blockEnd, intermediate.data());
+				dst = SecondStep(intermediate.data(), intermediateEnd, dst);
+
+				start = blockEnd;
+			}
+
+			return dst;
+		}
+
+		/****************************Generic conversion*****************************/
+		// Description of the memory layout of an uncompressed color format, used to convert between any pair of formats
+		// by decoding pixels to floating-point RGBA and encoding them back (masks are not used as they're not reliable enough for this)
+		struct ChannelLayout
+		{
+			UInt8 offset = 0; //< in bits (relative to the 16bits word for packed formats)
+			UInt8 size = 0; //< in bits, zero if the channel is not stored
+		};
+
+		struct PixelLayout
+		{
+			std::array<ChannelLayout, 4> channels; //< red, green, blue, alpha
+			std::array<float, 4> defaultValues = { 0.f, 0.f, 0.f, 1.f };
+			PixelFormatSubType type;
+			UInt8 bytesPerPixel = 0;
+			bool isLuminance = false; //< red channel holds the luminance
+			bool isNormalized = false;
+			bool isPacked = false;
+			bool isSRGB = false;
+		};
+
+		constexpr std::size_t GenericBlockPixelCount = 64;
+
+		bool IsFloatingPoint(PixelFormatSubType type)
+		{
+			return type == PixelFormatSubType::Float || type == PixelFormatSubType::Half;
+		}
+
+		PixelLayout BuildByteLayout(PixelFormatSubType type, bool normalized, UInt8 channelSize, std::array<int, 4> channelIndices)
+		{
+			PixelLayout layout;
+			layout.type = type;
+			layout.isNormalized = normalized;
+
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				if (channelIndices[i] < 0)
+					continue;
+
+				layout.channels[i].offset = SafeCast<UInt8>(channelIndices[i] * channelSize);
+				layout.channels[i].size = channelSize;
+			}
+
+			return layout;
+		}
+
+		PixelLayout BuildPackedLayout(std::array<ChannelLayout, 4> channels)
+		{
+			PixelLayout layout;
+			layout.channels = channels;
+			layout.type = PixelFormatSubType::Unsigned;
+			layout.isNormalized = true;
+			layout.isPacked = true;
+
+			return layout;
+		}
+
+		std::optional<PixelLayout> GetPixelLayout(PixelFormat format)
+		{
+			constexpr std::array<int, 4> R = { 0, -1, -1, -1 };
+			constexpr std::array<int, 4> RG = { 0, 1, -1, -1 };
+			constexpr std::array<int, 4> RGB = { 0, 1, 2, -1 };
+			constexpr std::array<int, 4> RGBA = { 0, 1, 2, 3 };
+			constexpr std::array<int, 4> BGR = { 2, 1, 0, -1 };
+			constexpr std::array<int, 4> BGRA = { 2, 1, 0, 3 };
+
+			constexpr PixelFormatSubType Float = PixelFormatSubType::Float;
+			constexpr PixelFormatSubType Half = PixelFormatSubType::Half;
+			constexpr PixelFormatSubType Int = PixelFormatSubType::Int;
+			constexpr PixelFormatSubType Unsigned = PixelFormatSubType::Unsigned;
+
+			PixelLayout layout;
+			switch (format)
+			{
+				case PixelFormat::A8:
+					layout = BuildByteLayout(Unsigned, true, 8, { -1, -1, -1, 0 });
+					layout.defaultValues = { 1.f, 1.f, 1.f, 1.f };
+					break;
+
+				case PixelFormat::L8:
+					layout = BuildByteLayout(Unsigned, true, 8, R);
+					layout.isLuminance = true;
+					break;
+
+				case PixelFormat::LA8:
+					layout = BuildByteLayout(Unsigned, true, 8, { 0, -1, -1, 1 });
+					layout.isLuminance = true;
+					break;
+
+				case PixelFormat::RGBA4:    layout = BuildPackedLayout({ { { 12, 4 }, { 8, 4 }, { 4, 4 }, { 0, 4 } } }); break;
+				case PixelFormat::RGB5A1:   layout = BuildPackedLayout({ { { 11, 5 }, { 6, 5 }, { 1, 5 }, { 0, 1 } } }); break;
+
+				case PixelFormat::BGR8:
+				case PixelFormat::BGR8_SRGB:  layout = BuildByteLayout(Unsigned, true, 8, BGR); break;
+				case PixelFormat::BGRA8:
+				case PixelFormat::BGRA8_SRGB: layout = BuildByteLayout(Unsigned, true, 8, BGRA); break;
+				case PixelFormat::RGB8:
+				case PixelFormat::RGB8_SRGB:  layout = BuildByteLayout(Unsigned, true, 8, RGB); break;
+				case PixelFormat::RGBA8:
+				case PixelFormat::RGBA8_SRGB: layout = BuildByteLayout(Unsigned, true, 8, RGBA); break;
+
+				case PixelFormat::R8:       layout = BuildByteLayout(Unsigned, true,  8,  R);    break;
+				case PixelFormat::R8I:      layout = BuildByteLayout(Int,      false, 8,  R);    break;
+				case PixelFormat::R8UI:     layout = BuildByteLayout(Unsigned, false, 8,  R);    break;
+				case PixelFormat::R16:      layout = BuildByteLayout(Unsigned, true,  16, R);    break;
+				case PixelFormat::R16F:     layout = BuildByteLayout(Half,     false, 16, R);    break;
+				case PixelFormat::R16I:     layout = BuildByteLayout(Int,      false, 16, R);    break;
+				case PixelFormat::R16UI:    layout = BuildByteLayout(Unsigned, false, 16, R);    break;
+				case PixelFormat::R32F:     layout = BuildByteLayout(Float,    false, 32, R);    break;
+				case PixelFormat::R32I:     layout = BuildByteLayout(Int,      false, 32, R);    break;
+				case PixelFormat::R32UI:    layout = BuildByteLayout(Unsigned, false, 32, R);    break;
+				case PixelFormat::RG8:      layout = BuildByteLayout(Unsigned, true,  8,  RG);   break;
+				case PixelFormat::RG8I:     layout = BuildByteLayout(Int,      false, 8,  RG);   break;
+				case PixelFormat::RG8UI:    layout = BuildByteLayout(Unsigned, false, 8,  RG);   break;
+				case PixelFormat::RG16:     layout = BuildByteLayout(Unsigned, true,  16, RG);   break;
+				case PixelFormat::RG16F:    layout = BuildByteLayout(Half,     false, 16, RG);   break;
+				case PixelFormat::RG16I:    layout = BuildByteLayout(Int,      false, 16, RG);   break;
+				case PixelFormat::RG16UI:   layout = BuildByteLayout(Unsigned, false, 16, RG);   break;
+				case PixelFormat::RG32F:    layout = BuildByteLayout(Float,    false, 32, RG);   break;
+				case PixelFormat::RG32I:    layout = BuildByteLayout(Int,      false, 32, RG);   break;
+				case PixelFormat::RG32UI:   layout = BuildByteLayout(Unsigned, false, 32, RG);   break;
+				case PixelFormat::RGB16F:   layout = BuildByteLayout(Half,     false, 16, RGB);  break;
+				case PixelFormat::RGB16I:   layout = BuildByteLayout(Int,      false, 16, RGB);  break;
+				case PixelFormat::RGB16UI:  layout = BuildByteLayout(Unsigned, false, 16, RGB);  break;
+				case PixelFormat::RGB32F:   layout = BuildByteLayout(Float,    false, 32, RGB);  break;
+				case PixelFormat::RGB32I:   layout = BuildByteLayout(Int,      false, 32, RGB);  break;
+				case PixelFormat::RGB32UI:  layout = BuildByteLayout(Unsigned, false, 32, RGB);  break;
+				case PixelFormat::RGBA16F:  layout = BuildByteLayout(Half,     false, 16, RGBA); break;
+				case PixelFormat::RGBA16I:  layout = BuildByteLayout(Int,      false, 16, RGBA); break;
+				case PixelFormat::RGBA16UI: layout = BuildByteLayout(Unsigned, false, 16, RGBA); break;
+				case PixelFormat::RGBA32F:  layout = BuildByteLayout(Float,    false, 32, RGBA); break;
+				case PixelFormat::RGBA32I:  layout = BuildByteLayout(Int,      false, 32, RGBA); break;
+				case PixelFormat::RGBA32UI: layout = BuildByteLayout(Unsigned, false, 32, RGBA); break;
+
+				default:
+					return std::nullopt; //< compressed, depth and stencil formats
+			}
+
+			switch (format)
+			{
+				case PixelFormat::BGR8_SRGB:
+				case PixelFormat::BGRA8_SRGB:
+				case PixelFormat::RGB8_SRGB:
+				case PixelFormat::RGBA8_SRGB:
+					layout.isSRGB = true;
+					break;
+
+				default:
+					break;
+			}
+
+			layout.bytesPerPixel = PixelFormatInfo::GetBytesPerPixel(format);
+			return layout;
+		}
+
+		template<typename T>
+		T ReadValue(const UInt8* ptr)
+		{
+			T value;
+			std::memcpy(&value, ptr, sizeof(T));
+
+			return value;
+		}
+
+		template<typename T>
+		void WriteValue(UInt8* ptr, T value)
+		{
+			std::memcpy(ptr, &value, sizeof(T));
+		}
+
+		template<typename T>
+		T EncodeInteger(float value, bool normalized)
+		{
+			constexpr double MinValue = double(std::numeric_limits<T>::min());
+			constexpr double MaxValue = double(std::numeric_limits<T>::max());
+
+			double result = (normalized) ? std::clamp(double(value), 0.0, 1.0) * MaxValue : std::clamp(double(value), MinValue, MaxValue);
+			return static_cast<T>(std::nearbyint(result));
+		}
+
+		float DecodeChannel(const PixelLayout& layout, const UInt8* ptr, UInt8 size)
+		{
+			switch (layout.type)
+			{
+				case PixelFormatSubType::Float:
+					return ReadValue<float>(ptr);
+
+				case PixelFormatSubType::Half:
+					return HalfToFloat(ReadValue<UInt16>(ptr));
+
+				case PixelFormatSubType::Int:
+				{
+					switch (size)
+					{
+						case 8:  return float(ReadValue<Int8>(ptr));
+						case 16: return float(ReadValue<Int16>(ptr));
+						case 32: return float(ReadValue<Int32>(ptr));
+					}
+					break;
+				}
+
+				case PixelFormatSubType::Unsigned:
+				{
+					float divisor = 1.f;
+					if (layout.isNormalized)
+						divisor = float((UInt64(1) << size) - 1);
+
+					switch (size)
+					{
+						case 8:  return float(ReadValue<UInt8>(ptr)) / divisor;
+						case 16: return float(ReadValue<UInt16>(ptr)) / divisor;
+						case 32: return float(ReadValue<UInt32>(ptr)) / divisor;
+					}
+					break;
+				}
+
+				default:
+					break;
+			}
+
+			NazaraInternalError("unhandled channel type");
+			return 0.f;
+		}
+
+		void EncodeChannel(const PixelLayout& layout, UInt8* ptr, UInt8 size, float value)
+		{
+			switch (layout.type)
+			{
+				case PixelFormatSubType::Float:
+					return WriteValue(ptr, value);
+
+				case PixelFormatSubType::Half:
+					return WriteValue(ptr, FloatToHalf(value));
+
+				case PixelFormatSubType::Int:
+				{
+					switch (size)
+					{
+						case 8:  return WriteValue(ptr, EncodeInteger<Int8>(value, false));
+						case 16: return WriteValue(ptr, EncodeInteger<Int16>(value, false));
+						case 32: return WriteValue(ptr, EncodeInteger<Int32>(value, false));
+					}
+					break;
+				}
+
+				case PixelFormatSubType::Unsigned:
+				{
+					switch (size)
+					{
+						case 8:  return WriteValue(ptr, EncodeInteger<UInt8>(value, layout.isNormalized));
+						case 16: return WriteValue(ptr, EncodeInteger<UInt16>(value, layout.isNormalized));
+						case 32: return WriteValue(ptr, EncodeInteger<UInt32>(value, layout.isNormalized));
+					}
+					break;
+				}
+
+				default:
+					break;
+			}
+
+			NazaraInternalError("unhandled channel type");
+		}
+
+		void DecodePixels(const PixelLayout& layout, const UInt8* src, std::size_t pixelCount, bool decodeSRGB, float* dst)
+		{
+			for (std::size_t i = 0; i < pixelCount; ++i)
+			{
+				UInt16 packedValue = 0;
+				if (layout.isPacked)
+				{
+					packedValue = ReadValue<UInt16>(src);
+#ifdef NAZARA_BIG_ENDIAN
+					packedValue = ByteSwap(packedValue);
+#endif
+				}
+
+				for (std::size_t channelIndex = 0; channelIndex < 4; ++channelIndex)
+				{
+					const ChannelLayout& channel = layout.channels[channelIndex];
+					if (channel.size == 0)
+						dst[channelIndex] = layout.defaultValues[channelIndex];
+					else if (layout.isPacked)
+					{
+						UInt16 maxValue = static_cast<UInt16>((1 << channel.size) - 1);
+						dst[channelIndex] = float((packedValue >> channel.offset) & maxValue) / maxValue;
+					}
+					else
+						dst[channelIndex] = DecodeChannel(layout, src + channel.offset / 8, channel.size);
+				}
+
+				if (layout.isLuminance)
+					dst[1] = dst[2] = dst[0];
+
+				if (decodeSRGB)
+				{
+					for (std::size_t channelIndex = 0; channelIndex < 3; ++channelIndex)
+						dst[channelIndex] = SRGBToLinear(dst[channelIndex]);
+				}
+
+				src += layout.bytesPerPixel;
+				dst += 4;
+			}
+		}
+
+		void EncodePixels(const PixelLayout& layout, const float* src, std::size_t pixelCount, bool encodeSRGB, UInt8* dst)
+		{
+			for (std::size_t i = 0; i < pixelCount; ++i)
+			{
+				std::array<float, 4> color = { src[0], src[1], src[2], src[3] };
+				if (encodeSRGB)
+				{
+					for (std::size_t channelIndex = 0; channelIndex < 3; ++channelIndex)
+						color[channelIndex] = LinearToSRGB(std::clamp(color[channelIndex], 0.f, 1.f));
+				}
+
+				if (layout.isLuminance)
+					color[0] = color[0] * 0.3f + color[1] * 0.59f + color[2] * 0.11f;
+
+				UInt16 packedValue = 0;
+				for (std::size_t channelIndex = 0; channelIndex < 4; ++channelIndex)
+				{
+					const ChannelLayout& channel = layout.channels[channelIndex];
+					if (channel.size == 0)
+						continue;
+
+					if (layout.isPacked)
+					{
+						UInt16 maxValue = static_cast<UInt16>((1 << channel.size) - 1);
+						packedValue |= static_cast<UInt16>(std::lrint(std::clamp(color[channelIndex], 0.f, 1.f) * maxValue) << channel.offset);
+					}
+					else
+						EncodeChannel(layout, dst + channel.offset / 8, channel.size, color[channelIndex]);
+				}
+
+				if (layout.isPacked)
+				{
+#ifdef NAZARA_BIG_ENDIAN
+					packedValue = ByteSwap(packedValue);
+#endif
+					WriteValue(dst, packedValue);
+				}
+
+				src += 4;
+				dst += layout.bytesPerPixel;
+			}
+		}
+
+		UInt8* ConvertGeneric(const PixelLayout& srcLayout, const PixelLayout& dstLayout, const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			// sRGB formats are converted to linear space only when going to (or coming from) a floating-point format,
+			// normalized formats don't carry any colorspace information and are reinterpreted as-is
+			bool decodeSRGB = srcLayout.isSRGB && IsFloatingPoint(dstLayout.type);
+			bool encodeSRGB = dstLayout.isSRGB && IsFloatingPoint(srcLayout.type);
+
+			std::array<float, GenericBlockPixelCount * 4> colors;
+
+			std::size_t pixelCount = (end - start) / srcLayout.bytesPerPixel;
+			while (pixelCount > 0)
+			{
+				std::size_t blockPixelCount = std::min(pixelCount, GenericBlockPixelCount);
+				DecodePixels(srcLayout, start, blockPixelCount, decodeSRGB, colors.data());
+				EncodePixels(dstLayout, colors.data(), blockPixelCount, encodeSRGB, dst);
+
+				start += blockPixelCount * srcLayout.bytesPerPixel;
+				dst += blockPixelCount * dstLayout.bytesPerPixel;
+				pixelCount -= blockPixelCount;
+			}
+
+			return dst;
 		}
 
 		/**********************************A8***********************************/
@@ -91,7 +923,7 @@ namespace Nz
 				start += 1;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -114,23 +946,13 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGR8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return Expand24To32<false>(start, end, dst);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGR8, PixelFormat::BGR8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			//FIXME: Not correct
+			// Relabeling only, normalized formats don't carry colorspace information
 			std::size_t count = end - start;
 			std::memcpy(dst, start, count);
 			return dst + count;
@@ -219,23 +1041,13 @@ namespace Nz
 				start += 3;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGR8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return Expand24To32<true>(start, end, dst);
 		}
 
 		template<>
@@ -252,7 +1064,7 @@ namespace Nz
 				start += 3;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		/**********************************BGRA8**********************************/
@@ -272,22 +1084,13 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::BGR8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-
-				start += 4;
-			}
-
-			return dst;
+			return Shrink32To24<false>(start, end, dst);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::BGRA8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			//FIXME: Not correct
+			// Relabeling only, normalized formats don't carry colorspace information
 			std::size_t count = end - start;
 			std::memcpy(dst, start, count);
 			return dst + count;
@@ -339,7 +1142,7 @@ namespace Nz
 				start += 4;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -367,32 +1170,13 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::RGB8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-
-				start += 4;
-			}
-
-			return dst;
+			return Shrink32To24<true>(start, end, dst);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = start[3];
-
-				start += 4;
-			}
-
-			return dst;
+			return SwapRedBlue8(start, end, dst);
 		}
 
 		template<>
@@ -409,7 +1193,7 @@ namespace Nz
 				start += 4;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		/***********************************L8************************************/
@@ -431,17 +1215,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::L8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = 0xFF;
-
-				start += 1;
-			}
-
-			return dst;
+			return ExpandLuminance8(start, end, dst);
 		}
 
 		template<>
@@ -518,23 +1292,13 @@ namespace Nz
 				start += 1;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::L8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = 0xFF;
-
-				start += 1;
-			}
-
-			return dst;
+			return ExpandLuminance8(start, end, dst);
 		}
 
 		template<>
@@ -551,7 +1315,7 @@ namespace Nz
 				start += 1;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		/***********************************LA8***********************************/
@@ -586,17 +1350,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::LA8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = start[1];
-
-				start += 2;
-			}
-
-			return dst;
+			return ExpandLuminanceAlpha8(start, end, dst);
 		}
 
 		template<>
@@ -666,23 +1420,13 @@ namespace Nz
 				start += 2;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::LA8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = start[0];
-				*dst++ = start[1];
-
-				start += 2;
-			}
-
-			return dst;
+			return ExpandLuminanceAlpha8(start, end, dst);
 		}
 
 		template<>
@@ -699,7 +1443,7 @@ namespace Nz
 				start += 2;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		/*********************************RGBA4***********************************/
@@ -1042,7 +1786,7 @@ namespace Nz
 				start += 2;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -1086,17 +1830,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return Expand24To32<true>(start, end, dst);
 		}
 
 		template<>
@@ -1167,13 +1901,13 @@ namespace Nz
 				start += 3;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::RGB8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			//FIXME: Not correct
+			// Relabeling only, normalized formats don't carry colorspace information
 			std::size_t count = end - start;
 			std::memcpy(dst, start, count);
 			return dst + count;
@@ -1182,17 +1916,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return Expand24To32<false>(start, end, dst);
 		}
 
 		template<>
@@ -1209,7 +1933,7 @@ namespace Nz
 				start += 3;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		/**********************************RGBA8**********************************/
@@ -1229,32 +1953,13 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::BGR8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-
-				start += 4;
-			}
-
-			return dst;
+			return Shrink32To24<true>(start, end, dst);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = start[3];
-
-				start += 4;
-			}
-
-			return dst;
+			return SwapRedBlue8(start, end, dst);
 		}
 
 		template<>
@@ -1309,16 +2014,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGB8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-
-				start += 4;
-			}
-
-			return dst;
+			return Shrink32To24<false>(start, end, dst);
 		}
 
 		template<>
@@ -1340,65 +2036,177 @@ namespace Nz
 				start += 4;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGBA8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			//FIXME: Not correct
+			// Relabeling only, normalized formats don't carry colorspace information
 			std::size_t count = end - start;
 			std::memcpy(dst, start, count);
 			return dst + count;
 		}
 
-		template<>
-		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGBA32F>(const UInt8* start, const UInt8* end, UInt8* dst)
+		template<PixelFormat Format1, PixelFormat Format2>
+		void RegisterConverter()
 		{
-			float* ptr = reinterpret_cast<float*>(dst);
-			while (start < end)
+			PixelFormatInfo::SetConvertFunction(Format1, Format2, &ConvertPixels<Format1, Format2>);
+		}
+
+		// Block rows are independent from each other, which makes them the unit of work of (de)compression tasks
+		template<typename F>
+		bool ProcessBlockRows(std::size_t blockRowCount, std::size_t blocksPerRow, TaskScheduler* taskScheduler, const F& func)
+		{
+			constexpr std::size_t MinBlockPerTask = 256;
+
+			if (!taskScheduler || blocksPerRow == 0)
+				return func(0, blockRowCount);
+
+			std::atomic_bool succeeded = true;
+			taskScheduler->ParallelForRange(blockRowCount, (MinBlockPerTask + blocksPerRow - 1) / blocksPerRow, [&](std::size_t firstRow, std::size_t lastRow)
 			{
-				*ptr++ = start[0] / 255.f;
-				*ptr++ = start[1] / 255.f;
-				*ptr++ = start[2] / 255.f;
-				*ptr++ = start[3] / 255.f;
+				if (!func(firstRow, lastRow))
+					succeeded = false;
+			});
 
-				start += 4;
-			}
+			return succeeded;
+		}
+	}
 
-			return dst;
+	bool PixelFormatInfo::Compress(PixelFormat dstFormat, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst, const BlockCompressionParams& params, TaskScheduler* taskScheduler)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(IsValid(dstFormat), "invalid pixel format");
+		NazaraAssert(src, "invalid source pointer");
+		NazaraAssert(dst, "invalid destination pointer");
+
+		UInt8 blockSize = GetBlockSize(dstFormat);
+		if (blockSize == 0)
+		{
+			NazaraErrorFmt("{0} is not a block compressed format", GetName(dstFormat));
+			return false;
 		}
 
-		/**********************************RGBA32F**********************************/
-		template<>
-		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
+		PixelFormat srcFormat = GetDecompressedFormat(dstFormat);
+		UInt8 bpp = GetBytesPerPixel(srcFormat);
+
+		std::size_t blocksPerRow = (width + 3) / 4;
+		std::size_t blockRowsPerSlice = (height + 3) / 4;
+
+		const UInt8* srcPtr = static_cast<const UInt8*>(src);
+		UInt8* dstPtr = static_cast<UInt8*>(dst);
+
+		return ProcessBlockRows(blockRowsPerSlice * depth, blocksPerRow, taskScheduler, [&](std::size_t firstRow, std::size_t lastRow)
 		{
-			while (start < end)
+			// Four RGBA texels of up to 8 bytes (RGBA16F for BC6H)
+			UInt8 texels[16 * 8];
+			for (std::size_t row = firstRow; row < lastRow; ++row)
 			{
-				const float* ptr = reinterpret_cast<const float*>(start);
+				std::size_t z = row / blockRowsPerSlice;
+				std::size_t blockY = row % blockRowsPerSlice;
 
-				*dst++ = static_cast<UInt8>(ptr[0] * 255.f);
-				*dst++ = static_cast<UInt8>(ptr[1] * 255.f);
-				*dst++ = static_cast<UInt8>(ptr[2] * 255.f);
-				*dst++ = static_cast<UInt8>(ptr[3] * 255.f);
+				const UInt8* slice = srcPtr + z * width * height * bpp;
+				UInt8* block = dstPtr + row * blocksPerRow * blockSize;
+				for (std::size_t blockX = 0; blockX < blocksPerRow; ++blockX)
+				{
+					// Texels outside of the image are clamped to the edge
+					for (std::size_t y = 0; y < 4; ++y)
+					{
+						std::size_t srcY = std::min<std::size_t>(blockY * 4 + y, height - 1);
+						for (std::size_t x = 0; x < 4; ++x)
+						{
+							std::size_t srcX = std::min<std::size_t>(blockX * 4 + x, width - 1);
+							std::memcpy(&texels[(y * 4 + x) * bpp], &slice[(srcY * width + srcX) * bpp], bpp);
+						}
+					}
 
-				start += 16;
+					BlockCompression::EncodeBlock(dstFormat, texels, block, params);
+					block += blockSize;
+				}
 			}
 
-			return dst;
-		}
+			return true;
+		});
+	}
 
-		template<>
-		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
+	bool PixelFormatInfo::ConvertParallel(const ConvertFunction& func, UInt8 srcBytesPerPixel, UInt8 dstBytesPerPixel, const UInt8* start, const UInt8* end, UInt8* dst, TaskScheduler& taskScheduler)
+	{
+		constexpr std::size_t MinPixelPerTask = 16 * 1024;
+		constexpr std::size_t PixelGranularity = 16;
+
+		// Compressed formats cannot be split on pixel boundaries
+		if (srcBytesPerPixel == 0 || dstBytesPerPixel == 0)
+			return func(start, end, dst) != nullptr;
+
+		// Tasks are split on groups of pixels to keep every task on the vectorized path of the kernels
+		std::size_t pixelCount = (end - start) / srcBytesPerPixel;
+		std::size_t groupCount = (pixelCount + PixelGranularity - 1) / PixelGranularity;
+
+		std::atomic_bool succeeded = true;
+		taskScheduler.ParallelForRange(groupCount, MinPixelPerTask / PixelGranularity, [&](std::size_t firstGroup, std::size_t lastGroup)
 		{
-			return ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8>(start, end, dst);
-		}
+			std::size_t firstPixel = firstGroup * PixelGranularity;
+			std::size_t lastPixel = std::min(lastGroup * PixelGranularity, pixelCount);
+			if (!func(start + firstPixel * srcBytesPerPixel, start + lastPixel * srcBytesPerPixel, dst + firstPixel * dstBytesPerPixel))
+				succeeded = false;
+		});
 
-		template<PixelFormat Format1, PixelFormat Format2>
-		void RegisterConverter()
+		return succeeded;
+	}
+
+	bool PixelFormatInfo::Decompress(PixelFormat srcFormat, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst, TaskScheduler* taskScheduler)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(IsValid(srcFormat), "invalid pixel format");
+		NazaraAssert(src, "invalid source pointer");
+		NazaraAssert(dst, "invalid destination pointer");
+
+		UInt8 blockSize = GetBlockSize(srcFormat);
+		if (blockSize == 0)
 		{
-			PixelFormatInfo::SetConvertFunction(Format1, Format2, &ConvertPixels<Format1, Format2>);
+			NazaraErrorFmt("{0} is not a block compressed format", GetName(srcFormat));
+			return false;
 		}
+
+		PixelFormat dstFormat = GetDecompressedFormat(srcFormat);
+		UInt8 bpp = GetBytesPerPixel(dstFormat);
+
+		std::size_t blocksPerRow = (width + 3) / 4;
+		std::size_t blockRowsPerSlice = (height + 3) / 4;
+
+		const UInt8* srcPtr = static_cast<const UInt8*>(src);
+		UInt8* dstPtr = static_cast<UInt8*>(dst);
+
+		return ProcessBlockRows(blockRowsPerSlice * depth, blocksPerRow, taskScheduler, [&](std::size_t firstRow, std::size_t lastRow)
+		{
+			UInt8 texels[16 * 8];
+			for (std::size_t row = firstRow; row < lastRow; ++row)
+			{
+				std::size_t z = row / blockRowsPerSlice;
+				std::size_t blockY = row % blockRowsPerSlice;
+
+				UInt8* slice = dstPtr + z * width * height * bpp;
+				const UInt8* block = srcPtr + row * blocksPerRow * blockSize;
+				for (std::size_t blockX = 0; blockX < blocksPerRow; ++blockX)
+				{
+					if (!BlockCompression::DecodeBlock(srcFormat, block, texels))
+						return false;
+
+					// Only write texels inside the image
+					std::size_t blockWidth = std::min<std::size_t>(4, width - blockX * 4);
+					std::size_t blockHeight = std::min<std::size_t>(4, height - blockY * 4);
+					for (std::size_t y = 0; y < blockHeight; ++y)
+						std::memcpy(&slice[((blockY * 4 + y) * width + blockX * 4) * bpp], &texels[y * 4 * bpp], blockWidth * bpp);
+
+					block += blockSize;
+				}
+			}
+
+			return true;
+		});
 	}
 
 	bool PixelFormatInfo::Flip(PixelFlipping flipping, PixelFormat format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
@@ -1501,6 +2309,11 @@ namespace Nz
 
 		// Setup informations about every pixel format
 		SetupPixelFormat(PixelFormat::A8,               PixelFormatDescription("A8",               PixelFormatContent::ColorRGBA,    0,                  0,                  0,                  0xFF,               PixelFormatSubType::Unsigned));
+		SetupPixelFormat(PixelFormat::BC4,              PixelFormatDescription("BC4",              PixelFormatContent::ColorRGBA,    8,                                                                              PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC5,              PixelFormatDescription("BC5",              PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC6H,             PixelFormatDescription("BC6H",             PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC7,              PixelFormatDescription("BC7",              PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC7_SRGB,         PixelFormatDescription("BC7_SRGB",         PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
 		SetupPixelFormat(PixelFormat::BGR8,             PixelFormatDescription("BGR8",             PixelFormatContent::ColorRGBA,    0x0000FF,           0x00FF00,           0xFF0000,           0,                  PixelFormatSubType::Unsigned));
 		SetupPixelFormat(PixelFormat::BGR8_SRGB,        PixelFormatDescription("BGR8_SRGB",        PixelFormatContent::ColorRGBA,    0x0000FF,           0x00FF00,           0xFF0000,           0,                  PixelFormatSubType::Unsigned));
 		SetupPixelFormat(PixelFormat::BGRA8,            PixelFormatDescription("BGRA8",            PixelFormatContent::ColorRGBA,    0x0000FF00,         0x00FF0000,         0xFF000000,         0x000000FF,         PixelFormatSubType::Unsigned));
@@ -1611,74 +2424,8 @@ namespace Nz
 		RegisterConverter<PixelFormat::BGRA8, PixelFormat::RGBA8>();
 		RegisterConverter<PixelFormat::BGRA8, PixelFormat::RGBA32F>();
 
-		/**********************************DXT1***********************************/
-		///TODO: Décompresseur DXT1
-	/*
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::BGR8>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::BGRA8>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::DXT3>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::DXT5>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::L8>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::LA8>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB16F>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB16I>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB32F>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB32I>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA16F>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA16I>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA32F>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA32I>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB5A1>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB8>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA4>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA8>();
-	*/
-
-		/**********************************DXT3***********************************/
-		///TODO: Décompresseur DXT3
-	/*
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::BGR8>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::BGRA8>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::DXT1>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::DXT5>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::L8>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::LA8>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB16F>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB16I>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB32F>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB32I>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA16F>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA16I>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA32F>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA32I>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB5A1>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB8>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA4>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA8>();
-	*/
-
-		/**********************************DXT5***********************************/
-		///TODO: Décompresseur DXT5
-	/*
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::BGR8>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::BGRA8>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::DXT1>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::DXT3>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::L8>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::LA8>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB16F>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB16I>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB32F>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB32I>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA16F>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA16I>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA32F>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA32I>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB5A1>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB8>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA4>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA8>();
-	*/
+		/****************************Block compressed*****************************/
+		// Blocks cannot be converted texel by texel, see Compress and Decompress (which Image::Convert relies on)
 
 		/***********************************L8************************************/
 		RegisterConverter<PixelFormat::L8, PixelFormat::BGR8>();
@@ -1790,11 +2537,76 @@ namespace Nz
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGB8>();
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA4>();
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA8_SRGB>();
-		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA32F>();
 
-		/**********************************RGBA32F**********************************/
-		RegisterConverter<PixelFormat::RGBA32F, PixelFormat::RGBA8>();
-		RegisterConverter<PixelFormat::RGBA32F, PixelFormat::RGBA8_SRGB>();
+		/*********************************Kernels*********************************/
+		struct ChannelFormats
+		{
+			PixelFormat unorm8Format;
+			PixelFormat halfFormat;
+			PixelFormat floatFormat;
+		};
+
+		for (const ChannelFormats& formats : { ChannelFormats{ PixelFormat::R8, PixelFormat::R16F, PixelFormat::R32F }, ChannelFormats{ PixelFormat::RG8, PixelFormat::RG16F, PixelFormat::RG32F }, ChannelFormats{ PixelFormat::RGB8, PixelFormat::RGB16F, PixelFormat::RGB32F }, ChannelFormats{ PixelFormat::RGBA8, PixelFormat::RGBA16F, PixelFormat::RGBA32F } })
+		{
+			SetConvertFunction(formats.unorm8Format, formats.floatFormat, &ConvertUNorm8ToFloat);
+			SetConvertFunction(formats.floatFormat, formats.unorm8Format, &ConvertFloatToUNorm8);
+			SetConvertFunction(formats.halfFormat, formats.floatFormat, &ConvertHalfToFloat);
+			SetConvertFunction(formats.floatFormat, formats.halfFormat, &ConvertFloatToHalf);
+		}
+
+		SetConvertFunction(PixelFormat::R8,    PixelFormat::R16F,    &ChainConverters<ConvertUNorm8ToFloat, ConvertFloatToHalf, 1>);
+		SetConvertFunction(PixelFormat::RG8,   PixelFormat::RG16F,   &ChainConverters<ConvertUNorm8ToFloat, ConvertFloatToHalf, 2>);
+		SetConvertFunction(PixelFormat::RGB8,  PixelFormat::RGB16F,  &ChainConverters<ConvertUNorm8ToFloat, ConvertFloatToHalf, 3>);
+		SetConvertFunction(PixelFormat::RGBA8, PixelFormat::RGBA16F, &ChainConverters<ConvertUNorm8ToFloat, ConvertFloatToHalf, 4>);
+
+		SetConvertFunction(PixelFormat::R16F,    PixelFormat::R8,    &ChainConverters<ConvertHalfToFloat, ConvertFloatToUNorm8, 2>);
+		SetConvertFunction(PixelFormat::RG16F,   PixelFormat::RG8,   &ChainConverters<ConvertHalfToFloat, ConvertFloatToUNorm8, 4>);
+		SetConvertFunction(PixelFormat::RGB16F,  PixelFormat::RGB8,  &ChainConverters<ConvertHalfToFloat, ConvertFloatToUNorm8, 6>);
+		SetConvertFunction(PixelFormat::RGBA16F, PixelFormat::RGBA8, &ChainConverters<ConvertHalfToFloat, ConvertFloatToUNorm8, 8>);
+
+		SetConvertFunction(PixelFormat::RGB8_SRGB,  PixelFormat::RGB32F,     &ConvertSRGB8ToFloat<3>);
+		SetConvertFunction(PixelFormat::RGBA8_SRGB, PixelFormat::RGBA32F,    &ConvertSRGB8ToFloat<4>);
+		SetConvertFunction(PixelFormat::RGB32F,     PixelFormat::RGB8_SRGB,  &ConvertFloatToSRGB8<3>);
+		SetConvertFunction(PixelFormat::RGBA32F,    PixelFormat::RGBA8_SRGB, &ConvertFloatToSRGB8<4>);
+		SetConvertFunction(PixelFormat::RGB8_SRGB,  PixelFormat::RGB16F,     &ChainConverters<ConvertSRGB8ToFloat<3>, ConvertFloatToHalf, 3>);
+		SetConvertFunction(PixelFormat::RGBA8_SRGB, PixelFormat::RGBA16F,    &ChainConverters<ConvertSRGB8ToFloat<4>, ConvertFloatToHalf, 4>);
+		SetConvertFunction(PixelFormat::RGB16F,     PixelFormat::RGB8_SRGB,  &ChainConverters<ConvertHalfToFloat, ConvertFloatToSRGB8<3>, 6>);
+		SetConvertFunction(PixelFormat::RGBA16F,    PixelFormat::RGBA8_SRGB, &ChainConverters<ConvertHalfToFloat, ConvertFloatToSRGB8<4>, 8>);
+
+		SetConvertFunction(PixelFormat::BGRA8_SRGB, PixelFormat::RGBA8_SRGB, &SwapRedBlue8);
+		SetConvertFunction(PixelFormat::RGBA8_SRGB, PixelFormat::BGRA8_SRGB, &SwapRedBlue8);
+		SetConvertFunction(PixelFormat::BGR8_SRGB,  PixelFormat::BGRA8_SRGB, &Expand24To32<false>);
+		SetConvertFunction(PixelFormat::BGR8_SRGB,  PixelFormat::RGBA8_SRGB, &Expand24To32<true>);
+		SetConvertFunction(PixelFormat::RGB8_SRGB,  PixelFormat::RGBA8_SRGB, &Expand24To32<false>);
+		SetConvertFunction(PixelFormat::RGB8_SRGB,  PixelFormat::BGRA8_SRGB, &Expand24To32<true>);
+		SetConvertFunction(PixelFormat::BGRA8_SRGB, PixelFormat::BGR8_SRGB,  &Shrink32To24<false>);
+		SetConvertFunction(PixelFormat::BGRA8_SRGB, PixelFormat::RGB8_SRGB,  &Shrink32To24<true>);
+		SetConvertFunction(PixelFormat::RGBA8_SRGB, PixelFormat::RGB8_SRGB,  &Shrink32To24<false>);
+		SetConvertFunction(PixelFormat::RGBA8_SRGB, PixelFormat::BGR8_SRGB,  &Shrink32To24<true>);
+
+		/*********************************Generic*********************************/
+		// Every other pair of uncompressed color formats goes through the (slower) generic conversion
+		for (auto&& [srcFormat, convertFunctions] : s_convertFunctions.iter_kv())
+		{
+			std::optional<PixelLayout> srcLayout = GetPixelLayout(srcFormat);
+			if (!srcLayout)
+				continue;
+
+			for (auto&& [dstFormat, convertFunction] : convertFunctions.iter_kv())
+			{
+				if (srcFormat == dstFormat || convertFunction)
+					continue;
+
+				std::optional<PixelLayout> dstLayout = GetPixelLayout(dstFormat);
+				if (!dstLayout)
+					continue;
+
+				convertFunction = [srcLayout = *srcLayout, dstLayout = *dstLayout](const UInt8* start, const UInt8* end, UInt8* dst)
+				{
+					return ConvertGeneric(srcLayout, dstLayout, start, end, dst);
+				};
+			}
+		}
 
 		return true;
 	}
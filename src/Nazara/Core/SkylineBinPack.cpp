@@ -0,0 +1,419 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+// Based on the skyline bottom-left packer by Jukka Jylänki (public domain)
+// http://clb.demon.fi/projects/even-more-rectangle-bin-packing
+
+#include <Nazara/Core/SkylineBinPack.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::SkylineBinPack
+	* \brief Core class packing rectangles on top of each other, keeping track of the top edge ("skyline") of the packed rectangles
+	*
+	* Placing a rectangle only looks at the skyline segments, whose count is bounded by the bin width and doesn't grow with the number of packed rectangles.
+	* Gaps left below the skyline and freed rectangles are kept in a waste list which is looked at first.
+	*/
+
+	SkylineBinPack::SkylineBinPack()
+	{
+		Reset();
+	}
+
+	SkylineBinPack::SkylineBinPack(unsigned int width, unsigned int height)
+	{
+		Reset(width, height);
+	}
+
+	SkylineBinPack::SkylineBinPack(const Vector2ui& size)
+	{
+		Reset(size);
+	}
+
+	/*!
+	* \brief Clears the content, freeing every rectangle
+	*/
+	void SkylineBinPack::Clear()
+	{
+		m_skyline.clear();
+		if (m_width > 0)
+			m_skyline.push_back(Segment{ 0, 0, m_width });
+
+		m_wastedRectangles.clear();
+		m_usedArea = 0;
+	}
+
+	/*!
+	* \brief Expands the content, keeping every packed rectangle in place
+	*
+	* \param newWidth New width for the expansion
+	* \param newHeight New height for the expansion
+	*/
+	void SkylineBinPack::Expand(unsigned int newWidth, unsigned newHeight)
+	{
+		if (newWidth > m_width)
+		{
+			if (!m_skyline.empty() && m_skyline.back().y == 0)
+				m_skyline.back().width += newWidth - m_width;
+			else
+				m_skyline.push_back(Segment{ m_width, 0, newWidth - m_width });
+
+			m_width = newWidth;
+		}
+
+		// The skyline only limits the height when placing rectangles
+		m_height = std::max(m_height, newHeight);
+	}
+
+	void SkylineBinPack::Expand(const Vector2ui& newSize)
+	{
+		Expand(newSize.x, newSize.y);
+	}
+
+	/*!
+	* \brief Frees a rectangle, making its space available to the next insertions
+	*
+	* \param rect Rectangle returned by Insert
+	*/
+	void SkylineBinPack::FreeRectangle(const Rectui& rect)
+	{
+		m_usedArea -= rect.width * rect.height;
+
+		// Freed rectangles are never merged back into the skyline, start over once everything is freed
+		if (m_usedArea == 0)
+		{
+			Clear();
+			return;
+		}
+
+		// Wasted rectangles don't overlap, absorb the ones sharing a whole edge with the freed rectangle to limit fragmentation
+		Rectui freedRect = rect;
+		bool merged;
+		do
+		{
+			merged = false;
+			for (auto it = m_wastedRectangles.begin(); it != m_wastedRectangles.end(); ++it)
+			{
+				const Rectui& wastedRect = *it;
+				if (wastedRect.x == freedRect.x && wastedRect.width == freedRect.width)
+				{
+					if (wastedRect.y + wastedRect.height == freedRect.y)
+						freedRect.y = wastedRect.y;
+					else if (freedRect.y + freedRect.height != wastedRect.y)
+						continue;
+
+					freedRect.height += wastedRect.height;
+				}
+				else if (wastedRect.y == freedRect.y && wastedRect.height == freedRect.height)
+				{
+					if (wastedRect.x + wastedRect.width == freedRect.x)
+						freedRect.x = wastedRect.x;
+					else if (freedRect.x + freedRect.width != wastedRect.x)
+						continue;
+
+					freedRect.width += wastedRect.width;
+				}
+				else
+					continue;
+
+				m_wastedRectangles.erase(it);
+				merged = true;
+				break;
+			}
+		}
+		while (merged);
+
+		m_wastedRectangles.push_back(freedRect);
+	}
+
+	unsigned int SkylineBinPack::GetHeight() const
+	{
+		return m_height;
+	}
+
+	/*!
+	* \brief Gets the ratio of the area used by packed rectangles
+	*/
+	float SkylineBinPack::GetOccupancy() const
+	{
+		return static_cast<float>(m_usedArea) / (m_width * m_height);
+	}
+
+	Vector2ui SkylineBinPack::GetSize() const
+	{
+		return Vector2ui(m_width, m_height);
+	}
+
+	unsigned int SkylineBinPack::GetWidth() const
+	{
+		return m_width;
+	}
+
+	bool SkylineBinPack::Insert(Rectui* rects, unsigned int count)
+	{
+		return Insert(rects, nullptr, nullptr, count);
+	}
+
+	bool SkylineBinPack::Insert(Rectui* rects, bool* flipped, unsigned int count)
+	{
+		return Insert(rects, flipped, nullptr, count);
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area, in order
+	* \return true if every rectangle could be inserted
+	*
+	* \param rects Rectangles to insert, their position (and size if they were flipped) is updated on insertion
+	* \param flipped Optional output array telling if each rectangle was rotated by 90 degrees, rectangles are never rotated if it's null
+	* \param inserted Optional output array telling if each rectangle was inserted
+	* \param count Rectangle count
+	*
+	* \remark Rectangles which can't be inserted don't prevent the following ones from being inserted
+	*/
+	bool SkylineBinPack::Insert(Rectui* rects, bool* flipped, bool* inserted, unsigned int count)
+	{
+		bool allInserted = true;
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			bool rectInserted = Insert(rects[i], flipped != nullptr, (flipped) ? &flipped[i] : nullptr);
+			if (inserted)
+				inserted[i] = rectInserted;
+
+			allInserted &= rectInserted;
+		}
+
+		return allInserted;
+	}
+
+	void SkylineBinPack::Reset()
+	{
+		Reset(0, 0);
+	}
+
+	void SkylineBinPack::Reset(unsigned int width, unsigned int height)
+	{
+		m_width = width;
+		m_height = height;
+
+		Clear();
+	}
+
+	void SkylineBinPack::Reset(const Vector2ui& size)
+	{
+		Reset(size.x, size.y);
+	}
+
+	bool SkylineBinPack::FindSkylinePosition(unsigned int width, unsigned int height, std::size_t* segmentIndex, unsigned int* y, unsigned int* score, unsigned int* scoreWidth) const
+	{
+		bool found = false;
+		for (std::size_t i = 0; i < m_skyline.size(); ++i)
+		{
+			const Segment& segment = m_skyline[i];
+			if (segment.x + width > m_width)
+				break; //< following segments start even further to the right
+
+			// The rectangle lies on the highest segment it covers
+			unsigned int rectY = segment.y;
+			unsigned int remainingWidth = width;
+			for (std::size_t j = i; remainingWidth > 0; ++j)
+			{
+				assert(j < m_skyline.size());
+				rectY = std::max(rectY, m_skyline[j].y);
+				remainingWidth -= std::min(remainingWidth, m_skyline[j].width);
+			}
+
+			if (rectY + height > m_height)
+				continue;
+
+			// Bottom-left: lowest top edge first, narrowest segment to break ties
+			unsigned int rectScore = rectY + height;
+			if (!found || rectScore < *score || (rectScore == *score && segment.width < *scoreWidth))
+			{
+				found = true;
+				*segmentIndex = i;
+				*y = rectY;
+				*score = rectScore;
+				*scoreWidth = segment.width;
+			}
+		}
+
+		return found;
+	}
+
+	bool SkylineBinPack::FindWastePosition(unsigned int width, unsigned int height, std::size_t* wasteIndex, unsigned int* score) const
+	{
+		bool found = false;
+		for (std::size_t i = 0; i < m_wastedRectangles.size(); ++i)
+		{
+			const Rectui& wastedRect = m_wastedRectangles[i];
+			if (width > wastedRect.width || height > wastedRect.height)
+				continue;
+
+			// Best short side fit
+			unsigned int rectScore = std::min(wastedRect.width - width, wastedRect.height - height);
+			if (!found || rectScore < *score)
+			{
+				found = true;
+				*wasteIndex = i;
+				*score = rectScore;
+			}
+		}
+
+		return found;
+	}
+
+	bool SkylineBinPack::Insert(Rectui& rect, bool allowFlip, bool* flipped)
+	{
+		if (flipped)
+			*flipped = false;
+
+		// Try filling the gaps first
+		std::size_t wasteIndex;
+		unsigned int wasteScore;
+		bool wasteFound = FindWastePosition(rect.width, rect.height, &wasteIndex, &wasteScore);
+		bool wasteFlipped = false;
+		if (allowFlip && rect.width != rect.height)
+		{
+			std::size_t flippedWasteIndex;
+			unsigned int flippedWasteScore;
+			if (FindWastePosition(rect.height, rect.width, &flippedWasteIndex, &flippedWasteScore) && (!wasteFound || flippedWasteScore < wasteScore))
+			{
+				wasteFound = true;
+				wasteFlipped = true;
+				wasteIndex = flippedWasteIndex;
+			}
+		}
+
+		if (wasteFound)
+		{
+			if (wasteFlipped)
+				std::swap(rect.width, rect.height);
+
+			if (flipped)
+				*flipped = wasteFlipped;
+
+			PlaceInWaste(wasteIndex, rect);
+			return true;
+		}
+
+		std::size_t segmentIndex;
+		unsigned int y, score, scoreWidth;
+		bool found = FindSkylinePosition(rect.width, rect.height, &segmentIndex, &y, &score, &scoreWidth);
+		bool skylineFlipped = false;
+		if (allowFlip && rect.width != rect.height)
+		{
+			std::size_t flippedSegmentIndex;
+			unsigned int flippedY, flippedScore, flippedScoreWidth;
+			if (FindSkylinePosition(rect.height, rect.width, &flippedSegmentIndex, &flippedY, &flippedScore, &flippedScoreWidth) && (!found || flippedScore < score || (flippedScore == score && flippedScoreWidth < scoreWidth)))
+			{
+				found = true;
+				skylineFlipped = true;
+				segmentIndex = flippedSegmentIndex;
+				y = flippedY;
+			}
+		}
+
+		if (!found)
+			return false;
+
+		if (skylineFlipped)
+			std::swap(rect.width, rect.height);
+
+		if (flipped)
+			*flipped = skylineFlipped;
+
+		rect.x = m_skyline[segmentIndex].x;
+		rect.y = y;
+
+		PlaceOnSkyline(segmentIndex, rect);
+		return true;
+	}
+
+	void SkylineBinPack::PlaceInWaste(std::size_t wasteIndex, Rectui& rect)
+	{
+		Rectui freeRect = m_wastedRectangles[wasteIndex];
+		m_wastedRectangles.erase(m_wastedRectangles.begin() + wasteIndex);
+
+		rect.x = freeRect.x;
+		rect.y = freeRect.y;
+
+		// Split the leftover space along the shorter leftover axis, keeping the biggest possible free rectangle
+		unsigned int leftoverWidth = freeRect.width - rect.width;
+		unsigned int leftoverHeight = freeRect.height - rect.height;
+
+		Rectui rightRect;
+		Rectui bottomRect;
+		if (leftoverWidth < leftoverHeight)
+		{
+			rightRect = Rectui(freeRect.x + rect.width, freeRect.y, leftoverWidth, rect.height);
+			bottomRect = Rectui(freeRect.x, freeRect.y + rect.height, freeRect.width, leftoverHeight);
+		}
+		else
+		{
+			rightRect = Rectui(freeRect.x + rect.width, freeRect.y, leftoverWidth, freeRect.height);
+			bottomRect = Rectui(freeRect.x, freeRect.y + rect.height, rect.width, leftoverHeight);
+		}
+
+		if (rightRect.width > 0 && rightRect.height > 0)
+			m_wastedRectangles.push_back(rightRect);
+
+		if (bottomRect.width > 0 && bottomRect.height > 0)
+			m_wastedRectangles.push_back(bottomRect);
+
+		m_usedArea += rect.width * rect.height;
+	}
+
+	void SkylineBinPack::PlaceOnSkyline(std::size_t segmentIndex, const Rectui& rect)
+	{
+		unsigned int rectRight = rect.x + rect.width;
+
+		// Space between the rectangle and the segments below it is lost for the skyline, keep it in the waste list
+		for (std::size_t i = segmentIndex; i < m_skyline.size() && m_skyline[i].x < rectRight; ++i)
+		{
+			const Segment& segment = m_skyline[i];
+			if (segment.y < rect.y)
+			{
+				unsigned int wasteRight = std::min(segment.x + segment.width, rectRight);
+				m_wastedRectangles.push_back(Rectui(segment.x, segment.y, wasteRight - segment.x, rect.y - segment.y));
+			}
+		}
+
+		m_skyline.insert(m_skyline.begin() + segmentIndex, Segment{ rect.x, rect.y + rect.height, rect.width });
+
+		// Shrink or remove the segments covered by the new one
+		std::size_t nextIndex = segmentIndex + 1;
+		while (nextIndex < m_skyline.size() && m_skyline[nextIndex].x < rectRight)
+		{
+			Segment& segment = m_skyline[nextIndex];
+			if (segment.x + segment.width <= rectRight)
+				m_skyline.erase(m_skyline.begin() + nextIndex);
+			else
+			{
+				unsigned int shrink = rectRight - segment.x;
+				segment.x += shrink;
+				segment.width -= shrink;
+				break;
+			}
+		}
+
+		// Merge neighbor segments at the same height
+		std::size_t firstIndex = (segmentIndex > 0) ? segmentIndex - 1 : 0;
+		for (std::size_t i = firstIndex; i + 1 < m_skyline.size() && i <= segmentIndex + 1;)
+		{
+			if (m_skyline[i].y == m_skyline[i + 1].y)
+			{
+				m_skyline[i].width += m_skyline[i + 1].width;
+				m_skyline.erase(m_skyline.begin() + i + 1);
+			}
+			else
+				++i;
+		}
+
+		m_usedArea += rect.width * rect.height;
+	}
+}
@@ -3,10 +3,14 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Export.hpp>
+#include <Nazara/Core/IndexMapper.hpp>
 #include <Nazara/Core/TriangleIterator.hpp>
 #include <Nazara/Core/VertexMapper.hpp>
+#include <cstring>
+#include <vector>
 
 namespace Nz
 {
@@ -18,13 +22,78 @@ namespace Nz
 
 	SubMesh::~SubMesh() = default;
 
+	void SubMesh::AddLod(std::shared_ptr<IndexBuffer> indexBuffer, float error)
+	{
+		NazaraAssert(indexBuffer, "invalid index buffer");
+		NazaraAssert(m_lods.empty() || m_lods.back().error <= error, "levels of detail must be added from the most to the least detailed");
+
+		m_lods.push_back({ std::move(indexBuffer), error });
+	}
+
+	void SubMesh::ClearLods()
+	{
+		m_lods.clear();
+	}
+
+	void SubMesh::GenerateLods(std::size_t lodCount, float reductionRatio, float maxError, BufferUsageFlags usage, const BufferFactory& bufferFactory)
+	{
+		NazaraAssert(reductionRatio > 0.f && reductionRatio < 1.f, "reduction ratio must be in the ]0, 1[ range");
+
+		m_lods.clear();
+
+		if (m_primitiveMode != PrimitiveMode::TriangleList)
+			return;
+
+		const std::shared_ptr<IndexBuffer>& indexBuffer = GetIndexBuffer();
+		const std::shared_ptr<VertexBuffer>& vertexBuffer = GetVertexBuffer();
+		if (!indexBuffer || !vertexBuffer)
+			return;
+
+		VertexMapper vertexMapper(*vertexBuffer);
+		SparsePtr<const Vector3f> positions = vertexMapper.GetComponentPtr<const Vector3f>(VertexComponent::Position);
+		if (!positions)
+			return;
+
+		IndexMapper indexMapper(*indexBuffer);
+		UInt32 indexCount = indexBuffer->GetIndexCount();
+		UInt32 vertexCount = vertexBuffer->GetVertexCount();
+
+		std::vector<UInt32> lodIndices(indexCount);
+
+		// Each level is simplified from the full detail mesh to get an accurate error
+		UInt32 previousIndexCount = indexCount;
+		for (std::size_t i = 0; i < lodCount; ++i)
+		{
+			UInt32 targetIndexCount = static_cast<UInt32>(previousIndexCount * reductionRatio) / 3 * 3;
+
+			float error;
+			UInt32 lodIndexCount = SimplifyIndices(indexMapper.begin(), indexCount, positions, vertexCount, targetIndexCount, maxError, lodIndices.data(), &error);
+
+			// Stop when the error threshold prevents further simplification
+			if (lodIndexCount == 0 || lodIndexCount >= previousIndexCount)
+				break;
+
+			std::shared_ptr<IndexBuffer> lodIndexBuffer = std::make_shared<IndexBuffer>(indexBuffer->GetIndexType(), lodIndexCount, usage, bufferFactory);
+			{
+				IndexMapper lodIndexMapper(*lodIndexBuffer);
+				for (UInt32 j = 0; j < lodIndexCount; ++j)
+					lodIndexMapper.Set(j, lodIndices[j]);
+
+				OptimizeIndices(lodIndexMapper.begin(), lodIndexCount);
+			}
+
+			m_lods.push_back({ std::move(lodIndexBuffer), error });
+			previousIndexCount = lodIndexCount;
+		}
+	}
+
 	void SubMesh::GenerateNormals()
 	{
 		VertexMapper mapper(*this);
 		UInt32 vertexCount = mapper.GetVertexCount();
 
 		SparsePtr<Vector3f> normals = mapper.GetComponentPtr<Vector3f>(VertexComponent::Normal);
-		SparsePtr<Vector3f> positions = mapper.GetComponentPtr<Vector3f>(VertexComponent::Position);
+		SparsePtr<const Vector3f> positions = mapper.GetComponentPtr<const Vector3f>(VertexComponent::Position);
 		if (!normals || !positions)
 			return;
 
@@ -57,7 +126,7 @@ namespace Nz
 		UInt32 vertexCount = mapper.GetVertexCount();
 
 		SparsePtr<Vector3f> normals = mapper.GetComponentPtr<Vector3f>(VertexComponent::Normal);
-		SparsePtr<Vector3f> positions = mapper.GetComponentPtr<Vector3f>(VertexComponent::Position);
+		SparsePtr<const Vector3f> positions = mapper.GetComponentPtr<const Vector3f>(VertexComponent::Position);
 		SparsePtr<Vector3f> tangents = mapper.GetComponentPtr<Vector3f>(VertexComponent::Tangent);
 		SparsePtr<Vector2f> texCoords = mapper.GetComponentPtr<Vector2f>(VertexComponent::TexCoord);
 		if (!texCoords)
@@ -121,7 +190,7 @@ namespace Nz
 		VertexMapper mapper(*this);
 
 		SparsePtr<Vector3f> normals = mapper.GetComponentPtr<Vector3f>(VertexComponent::Normal);
-		SparsePtr<Vector3f> positions = mapper.GetComponentPtr<Vector3f>(VertexComponent::Position);
+		SparsePtr<const Vector3f> positions = mapper.GetComponentPtr<const Vector3f>(VertexComponent::Position);
 		SparsePtr<Vector3f> tangents = mapper.GetComponentPtr<Vector3f>(VertexComponent::Tangent);
 		SparsePtr<Vector2f> texCoords = mapper.GetComponentPtr<Vector2f>(VertexComponent::TexCoord);
 		if (!texCoords)
@@ -202,6 +271,17 @@ namespace Nz
 		return 0;
 	}
 
+	auto SubMesh::GetLod(std::size_t lodIndex) const -> const Lod&
+	{
+		NazaraAssertFmt(lodIndex < m_lods.size(), "LOD index out of range ({0} >= {1})", lodIndex, m_lods.size());
+		return m_lods[lodIndex];
+	}
+
+	std::size_t SubMesh::GetLodCount() const
+	{
+		return m_lods.size();
+	}
+
 	std::size_t SubMesh::GetMaterialIndex() const
 	{
 		return m_matIndex;
@@ -212,6 +292,62 @@ namespace Nz
 		m_primitiveMode = mode;
 	}
 
+	void SubMesh::Optimize(bool reorderVertices)
+	{
+		if (m_primitiveMode != PrimitiveMode::TriangleList)
+			return;
+
+		const std::shared_ptr<IndexBuffer>& indexBuffer = GetIndexBuffer();
+		const std::shared_ptr<VertexBuffer>& vertexBuffer = GetVertexBuffer();
+		if (!indexBuffer || !vertexBuffer)
+			return;
+
+		UInt32 indexCount = indexBuffer->GetIndexCount();
+		UInt32 vertexCount = vertexBuffer->GetVertexCount();
+
+		IndexMapper indexMapper(*indexBuffer);
+
+		// Reorder triangles for post-transform cache efficiency first
+		OptimizeIndices(indexMapper.begin(), indexCount);
+
+		for (Lod& lod : m_lods)
+		{
+			IndexMapper lodIndexMapper(*lod.indexBuffer);
+			OptimizeIndices(lodIndexMapper.begin(), lod.indexBuffer->GetIndexCount());
+		}
+
+		// then sort clusters of triangles to reduce overdraw while keeping most of the cache efficiency
+		{
+			VertexMapper vertexMapper(*vertexBuffer);
+			if (SparsePtr<const Vector3f> positions = vertexMapper.GetComponentPtr<const Vector3f>(VertexComponent::Position))
+				OptimizeOverdraw(indexMapper.begin(), indexCount, positions);
+		}
+
+		// and finally reorder vertices in the order they're used to improve pre-transform cache efficiency
+		if (reorderVertices)
+		{
+			std::vector<UInt32> remap(vertexCount);
+			OptimizeVertexFetch(indexMapper.begin(), indexCount, vertexCount, remap.data());
+
+			// Levels of detail reference the same vertices
+			for (Lod& lod : m_lods)
+			{
+				IndexMapper lodIndexMapper(*lod.indexBuffer);
+				for (UInt32 i = 0; i < lodIndexMapper.GetIndexCount(); ++i)
+					lodIndexMapper.Set(i, remap[lodIndexMapper.Get(i)]);
+			}
+
+			UInt64 stride = vertexBuffer->GetStride();
+
+			UInt8* vertices = static_cast<UInt8*>(vertexBuffer->Map(0, vertexCount));
+			std::vector<UInt8> vertexData(vertices, vertices + vertexCount * stride);
+			for (UInt32 i = 0; i < vertexCount; ++i)
+				std::memcpy(&vertices[remap[i] * stride], &vertexData[i * stride], stride);
+
+			vertexBuffer->Unmap();
+		}
+	}
+
 	void SubMesh::SetMaterialIndex(std::size_t matIndex)
 	{
 		m_matIndex = matIndex;
@@ -4,9 +4,11 @@
 
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ThreadExt.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <concurrentqueue.h>
+#include <atomic>
 #include <mutex>
 #include <new>
 #include <random>
@@ -30,7 +32,7 @@ namespace Nz
 	struct TaskScheduler::Data
 	{
 		std::atomic_uint remainingTasks = 0;
-		std::size_t nextWorkerIndex = 0;
+		std::atomic_size_t nextWorkerIndex = 0;
 		std::vector<Worker> workers;
 		unsigned int workerCount;
 	};
@@ -196,11 +198,9 @@ namespace Nz
 	{
 		m_data->remainingTasks++;
 
-		Worker& worker = m_data->workers[m_data->nextWorkerIndex++];
-		worker.AddTask(std::move(task));
-
-		if (m_data->nextWorkerIndex >= m_data->workers.size())
-			m_data->nextWorkerIndex = 0;
+		// Tasks can be added from multiple threads (including workers)
+		std::size_t workerIndex = m_data->nextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % m_data->workers.size();
+		m_data->workers[workerIndex].AddTask(std::move(task));
 	}
 
 	unsigned int TaskScheduler::GetWorkerCount() const
@@ -208,6 +208,112 @@ namespace Nz
 		return m_data->workerCount;
 	}
 
+	/*!
+	* \brief Runs a batch of jobs on the workers and waits for them
+	*
+	* Unlike WaitForTasks, only the jobs of this call are waited for, and the calling thread executes jobs as well.
+	* This makes it safe to call from a task running on this scheduler, and concurrently from multiple threads.
+	*
+	* \param jobCount Number of jobs to run
+	* \param job Function called once per job index, from any thread
+	*/
+	void TaskScheduler::ParallelFor(std::size_t jobCount, FunctionRef<void(std::size_t jobIndex)> job)
+	{
+		if (jobCount <= 1)
+		{
+			if (jobCount == 1)
+				job(0);
+
+			return;
+		}
+
+		struct Batch
+		{
+			Batch(std::size_t count, FunctionRef<void(std::size_t jobIndex)> func) :
+			job(func),
+			jobCount(count)
+			{
+			}
+
+			std::atomic_size_t completedJobs = 0;
+			std::atomic_size_t nextJob = 0;
+			FunctionRef<void(std::size_t jobIndex)> job;
+			std::size_t jobCount;
+		};
+
+		// Tasks may start after every job was executed (and this function returned), the batch has to outlive them
+		auto batch = std::make_shared<Batch>(jobCount, job);
+
+		auto RunJobs = [](Batch& batch)
+		{
+			std::size_t executedJobs = 0;
+			for (;;)
+			{
+				std::size_t jobIndex = batch.nextJob.fetch_add(1);
+				if (jobIndex >= batch.jobCount)
+					break;
+
+				batch.job(jobIndex);
+				executedJobs++;
+			}
+
+			if (executedJobs > 0 && batch.completedJobs.fetch_add(executedJobs) + executedJobs == batch.jobCount)
+				batch.completedJobs.notify_all();
+		};
+
+		std::size_t taskCount = std::min<std::size_t>(jobCount - 1, m_data->workerCount);
+		for (std::size_t i = 0; i < taskCount; ++i)
+			AddTask([batch, RunJobs] { RunJobs(*batch); });
+
+		RunJobs(*batch);
+
+		// Wait for jobs still running on workers
+		for (;;)
+		{
+			std::size_t completedJobs = batch->completedJobs.load();
+			if (completedJobs == jobCount)
+				break;
+
+			batch->completedJobs.wait(completedJobs);
+		}
+	}
+
+	/*!
+	* \brief Splits a range in contiguous parts processed in parallel, and waits for them
+	*
+	* The range is split in up to four parts per worker, each one having at least minCountPerTask elements (the range is processed by the calling thread if too small).
+	*
+	* \param count Size of the range
+	* \param minCountPerTask Minimum part size
+	* \param job Function called with the [first, last) bounds of each part, from any thread
+	*
+	* \see ParallelFor
+	*/
+	void TaskScheduler::ParallelForRange(std::size_t count, std::size_t minCountPerTask, FunctionRef<void(std::size_t first, std::size_t last)> job)
+	{
+		NazaraAssert(minCountPerTask > 0, "minimum count per task must be positive");
+
+		std::size_t taskCount = std::min<std::size_t>(count / minCountPerTask, std::size_t(m_data->workerCount) * 4);
+		if (taskCount <= 1)
+		{
+			if (count > 0)
+				job(0, count);
+
+			return;
+		}
+
+		ParallelFor(taskCount, [&](std::size_t taskIndex)
+		{
+			job(count * taskIndex / taskCount, count * (taskIndex + 1) / taskCount);
+		});
+	}
+
+	/*!
+	* \brief Waits until every task of the scheduler has been executed
+	*
+	* \remark This waits for all tasks, including those added by other threads, and must not be called from a task of this scheduler (it would wait for itself).
+	* To wait for a specific set of jobs, use ParallelFor instead.
+	*/
 	void TaskScheduler::WaitForTasks()
 	{
 		// Wait until remaining task counter reaches 0
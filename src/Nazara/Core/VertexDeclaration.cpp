@@ -25,10 +25,13 @@ namespace Nz
 			2 * sizeof(float),    // ComponentType::Float2
 			3 * sizeof(float),    // ComponentType::Float3
 			4 * sizeof(float),    // ComponentType::Float4
+			2 * sizeof(UInt16),   // ComponentType::Half2
 			1 * sizeof(UInt32),   // ComponentType::Int1
 			2 * sizeof(UInt32),   // ComponentType::Int2
 			3 * sizeof(UInt32),   // ComponentType::Int3
 			4 * sizeof(UInt32),   // ComponentType::Int4
+			2 * sizeof(Int16),    // ComponentType::Short2Norm
+			4 * sizeof(Int16),    // ComponentType::Short4Norm
 		};
 	}
 
@@ -81,10 +84,13 @@ namespace Nz
 			case ComponentType::Float2:
 			case ComponentType::Float3:
 			case ComponentType::Float4:
+			case ComponentType::Half2:
 			case ComponentType::Int1:
 			case ComponentType::Int2:
 			case ComponentType::Int3:
 			case ComponentType::Int4:
+			case ComponentType::Short2Norm:
+			case ComponentType::Short4Norm:
 				return true;
 		}
 
@@ -345,6 +351,58 @@ namespace Nz
 
 			NazaraAssert(s_declarations[VertexLayout::XYZ_UV]->GetStride() == sizeof(VertexStruct_XYZ_UV), "Invalid stride for declaration VertexLayout::XYZ_UV");
 
+			// VertexLayout::XYZ_Normal_UV_Tangent_Quantized : VertexStruct_XYZ_Normal_UV_Tangent_Quantized
+			s_declarations[VertexLayout::XYZ_Normal_UV_Tangent_Quantized] = NewDeclaration(VertexInputRate::Vertex, {
+				{
+					VertexComponent::Position,
+					ComponentType::Short4Norm,
+					0
+				},
+				{
+					VertexComponent::Normal,
+					ComponentType::Short2Norm,
+					0
+				},
+				{
+					VertexComponent::TexCoord,
+					ComponentType::Half2,
+					0
+				},
+				{
+					VertexComponent::Tangent,
+					ComponentType::Short2Norm,
+					0
+				}
+			});
+
+			NazaraAssert(s_declarations[VertexLayout::XYZ_Normal_UV_Tangent_Quantized]->GetStride() == sizeof(VertexStruct_XYZ_Normal_UV_Tangent_Quantized), "Invalid stride for declaration VertexLayout::XYZ_Normal_UV_Tangent_Quantized");
+
+			// VertexLayout::XYZ_Color_UV_DistanceField : VertexStruct_XYZ_Color_UV_DistanceField
+			s_declarations[VertexLayout::XYZ_Color_UV_DistanceField] = NewDeclaration(VertexInputRate::Vertex, {
+				{
+					VertexComponent::Position,
+					ComponentType::Float3,
+					0
+				},
+				{
+					VertexComponent::Color,
+					ComponentType::Float4,
+					0
+				},
+				{
+					VertexComponent::TexCoord,
+					ComponentType::Float2,
+					0
+				},
+				{
+					VertexComponent::DistanceField,
+					ComponentType::Float2,
+					0
+				}
+			});
+
+			NazaraAssert(s_declarations[VertexLayout::XYZ_Color_UV_DistanceField]->GetStride() == sizeof(VertexStruct_XYZ_Color_UV_DistanceField), "Invalid stride for declaration VertexLayout::XYZ_Color_UV_DistanceField");
+
 			// VertexLayout::Matrix4 : Matrix4f
 			s_declarations[VertexLayout::Matrix4] = NewDeclaration(VertexInputRate::Vertex, {
 				{
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/VertexMapper.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/BufferMapper.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/SkeletalMesh.hpp>
@@ -39,18 +40,140 @@ namespace Nz
 		}
 
 		m_mapper.Map(*buffer, 0, buffer->GetVertexCount());
+		m_vertexBuffer = buffer.get();
 	}
 
-	VertexMapper::VertexMapper(VertexBuffer& vertexBuffer)
+	VertexMapper::VertexMapper(VertexBuffer& vertexBuffer) :
+	m_vertexBuffer(&vertexBuffer)
 	{
 		ErrorFlags flags(ErrorMode::ThrowException);
 		m_mapper.Map(vertexBuffer, 0, vertexBuffer.GetVertexCount());
 	}
 
-	VertexMapper::~VertexMapper() = default;
+	VertexMapper::~VertexMapper()
+	{
+		EncodeComponents();
+	}
 
 	void VertexMapper::Unmap()
 	{
+		EncodeComponents();
 		m_mapper.Unmap();
 	}
+
+	void* VertexMapper::DecodeComponent(VertexComponent component, std::size_t componentIndex, ComponentType decodedType, bool writeBack)
+	{
+		const VertexDeclaration& declaration = *m_vertexBuffer->GetVertexDeclaration();
+
+		const VertexDeclaration::Component* componentData = declaration.FindComponent(component, componentIndex);
+		if (!componentData || componentData->type == decodedType || GetDecodedType(componentData->type) != decodedType)
+			return nullptr;
+
+		for (DecodedComponent& decodedComponent : m_decodedComponents)
+		{
+			if (decodedComponent.component == componentData)
+			{
+				decodedComponent.writeBack |= writeBack;
+				return decodedComponent.data.data();
+			}
+		}
+
+		UInt32 vertexCount = m_vertexBuffer->GetVertexCount();
+		UInt8* componentPtr = static_cast<UInt8*>(m_mapper.GetPointer()) + componentData->offset;
+		std::size_t stride = declaration.GetStride();
+
+		auto& decodedComponent = m_decodedComponents.emplace_back();
+		decodedComponent.component = componentData;
+		decodedComponent.writeBack = writeBack;
+
+		switch (componentData->type)
+		{
+			case ComponentType::Half2:
+				decodedComponent.data.resize(vertexCount * 2);
+				DequantizeTexCoords(SparsePtr<const Vector2ui16>(componentPtr, stride), vertexCount, reinterpret_cast<Vector2f*>(decodedComponent.data.data()));
+				break;
+
+			case ComponentType::Short2Norm:
+				decodedComponent.data.resize(vertexCount * 3);
+				DequantizeNormals(SparsePtr<const Vector2i16>(componentPtr, stride), vertexCount, reinterpret_cast<Vector3f*>(decodedComponent.data.data()));
+				break;
+
+			case ComponentType::Short4Norm:
+			{
+				PositionQuantization quantization;
+				if (component == VertexComponent::Position)
+					quantization = m_vertexBuffer->GetPositionQuantization();
+
+				decodedComponent.data.resize(vertexCount * 3);
+				DequantizePositions(SparsePtr<const Vector4i16>(componentPtr, stride), vertexCount, quantization, reinterpret_cast<Vector3f*>(decodedComponent.data.data()));
+				break;
+			}
+
+			default:
+				NazaraInternalErrorFmt("unexpected component type {0:#x}", UnderlyingCast(componentData->type));
+				m_decodedComponents.pop_back();
+				return nullptr;
+		}
+
+		return decodedComponent.data.data();
+	}
+
+	void VertexMapper::EncodeComponents()
+	{
+		if (m_decodedComponents.empty())
+			return;
+
+		UInt32 vertexCount = m_vertexBuffer->GetVertexCount();
+		std::size_t stride = m_vertexBuffer->GetVertexDeclaration()->GetStride();
+
+		for (const DecodedComponent& decodedComponent : m_decodedComponents)
+		{
+			if (!decodedComponent.writeBack)
+				continue;
+
+			UInt8* componentPtr = static_cast<UInt8*>(m_mapper.GetPointer()) + decodedComponent.component->offset;
+			switch (decodedComponent.component->type)
+			{
+				case ComponentType::Half2:
+					QuantizeTexCoords(reinterpret_cast<const Vector2f*>(decodedComponent.data.data()), vertexCount, SparsePtr<Vector2ui16>(componentPtr, stride));
+					break;
+
+				case ComponentType::Short2Norm:
+					QuantizeNormals(reinterpret_cast<const Vector3f*>(decodedComponent.data.data()), vertexCount, SparsePtr<Vector2i16>(componentPtr, stride));
+					break;
+
+				case ComponentType::Short4Norm:
+				{
+					const Vector3f* positions = reinterpret_cast<const Vector3f*>(decodedComponent.data.data());
+
+					PositionQuantization quantization;
+					if (decodedComponent.component->component == VertexComponent::Position)
+					{
+						// Positions may have been moved outside of the previous range
+						quantization = ComputePositionQuantization(ComputeAABB(positions, vertexCount));
+						m_vertexBuffer->SetPositionQuantization(quantization);
+					}
+
+					QuantizePositions(positions, vertexCount, quantization, SparsePtr<Vector4i16>(componentPtr, stride));
+					break;
+				}
+
+				default:
+					break;
+			}
+		}
+
+		m_decodedComponents.clear();
+	}
+
+	ComponentType VertexMapper::GetDecodedType(ComponentType type)
+	{
+		switch (type)
+		{
+			case ComponentType::Half2:      return ComponentType::Float2;
+			case ComponentType::Short2Norm: return ComponentType::Float3; //< octahedral-encoded direction
+			case ComponentType::Short4Norm: return ComponentType::Float3;
+			default:                        return type;
+		}
+	}
 }
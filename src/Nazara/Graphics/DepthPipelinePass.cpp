@@ -15,17 +15,23 @@ namespace Nz
 {
 	void DepthPipelinePass::Prepare(FrameData& frameData)
 	{
-		if (m_lastVisibilityHash != frameData.visibilityHash || m_rebuildElements) //< FIXME
+		// Levels of detail depend on the viewer, elements have to be rebuilt when one of them changes
+		std::size_t lodHash = SelectLods(m_viewer->GetViewerInstance(), frameData.visibleRenderables, m_lodLevels);
+
+		if (m_lastVisibilityHash != frameData.visibilityHash || m_lastLodHash != lodHash || m_rebuildElements) //< FIXME
 		{
 			frameData.renderResources.PushForRelease(std::move(m_renderElements));
 			m_renderElements.clear();
 
-			for (const auto& renderableData : frameData.visibleRenderables)
+			for (std::size_t i = 0; i < frameData.visibleRenderables.size(); ++i)
 			{
+				const auto& renderableData = frameData.visibleRenderables[i];
+
 				InstancedRenderable::ElementData elementData{
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
-					renderableData.worldInstance
+					renderableData.worldInstance,
+					m_lodLevels[i]
 				};
 
 				renderableData.instancedRenderable->BuildElement(m_elementRegistry, elementData, m_passIndex, m_renderElements);
@@ -42,6 +48,7 @@ namespace Nz
 
 			m_renderQueueRegistry.Finalize();
 
+			m_lastLodHash = lodHash;
 			m_lastVisibilityHash = frameData.visibilityHash;
 			m_rebuildElements = true;
 		}
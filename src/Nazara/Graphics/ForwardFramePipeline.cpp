@@ -383,6 +383,9 @@ namespace Nz
 		}
 		m_removedWorldInstances.Clear();
 
+		// Stream texture levels based on the usage reported by the passes during the previous frame
+		Graphics::Instance()->GetTextureStreamer().Update(renderResources);
+
 		bool frameGraphInvalidated = false;
 		if (m_rebuildFrameGraph)
 		{
@@ -22,6 +22,7 @@ namespace Nz
 {
 	ForwardPipelinePass::ForwardPipelinePass(PassData& passData, std::string passName, const ParameterList& /*parameters*/) :
 	FramePipelinePass(FramePipelineNotification::ElementInvalidation | FramePipelineNotification::MaterialInstanceRegistration),
+	m_lastLodHash(0),
 	m_lastVisibilityHash(0),
 	m_passName(std::move(passName)),
 	m_viewer(passData.viewer),
@@ -45,17 +46,38 @@ namespace Nz
 	{
 		NazaraAssert(frameData.visibleLights, "visible lights must be valid");
 
-		if (m_lastVisibilityHash != frameData.visibilityHash || m_rebuildElements) //< FIXME
+		// Levels of detail depend on the viewer, elements have to be rebuilt when one of them changes
+		std::size_t lodHash = SelectLods(m_viewer->GetViewerInstance(), frameData.visibleRenderables, m_lodLevels, &m_screenSizes);
+
+		// Screen sizes also decide which mip levels of streamed textures should be resident
+		TextureStreamer& textureStreamer = Graphics::Instance()->GetTextureStreamer();
+		if (textureStreamer.HasTextures())
+		{
+			for (std::size_t i = 0; i < frameData.visibleRenderables.size(); ++i)
+			{
+				const InstancedRenderable* instancedRenderable = frameData.visibleRenderables[i].instancedRenderable;
+				for (std::size_t materialIndex = 0; materialIndex < instancedRenderable->GetMaterialCount(); ++materialIndex)
+				{
+					if (const auto& materialInstance = instancedRenderable->GetMaterial(materialIndex))
+						textureStreamer.ReportUsage(*materialInstance, m_screenSizes[i]);
+				}
+			}
+		}
+
+		if (m_lastVisibilityHash != frameData.visibilityHash || m_lastLodHash != lodHash || m_rebuildElements) //< FIXME
 		{
 			frameData.renderResources.PushForRelease(std::move(m_renderElements));
 			m_renderElements.clear();
 
-			for (const auto& renderableData : frameData.visibleRenderables)
+			for (std::size_t i = 0; i < frameData.visibleRenderables.size(); ++i)
 			{
+				const auto& renderableData = frameData.visibleRenderables[i];
+
 				InstancedRenderable::ElementData elementData{
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
-					renderableData.worldInstance
+					renderableData.worldInstance,
+					m_lodLevels[i]
 				};
 
 				renderableData.instancedRenderable->BuildElement(m_elementRegistry, elementData, m_forwardPassIndex, m_renderElements);
@@ -72,6 +94,7 @@ namespace Nz
 
 			m_renderQueueRegistry.Finalize();
 
+			m_lastLodHash = lodHash;
 			m_lastVisibilityHash = frameData.visibilityHash;
 			InvalidateElements();
 		}
@@ -3,6 +3,10 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Graphics/FramePipelinePass.hpp>
+#include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/ViewerInstance.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <algorithm>
 
 namespace Nz
 {
@@ -19,4 +23,46 @@ namespace Nz
 	void FramePipelinePass::UnregisterMaterialInstance(const MaterialInstance& /*materialInstance*/)
 	{
 	}
+
+	std::size_t FramePipelinePass::SelectLods(const ViewerInstance& viewerInstance, const std::vector<VisibleRenderable>& visibleRenderables, std::vector<std::size_t>& lodLevels, std::vector<float>* screenSizes)
+	{
+		const Matrix4f& projectionMatrix = viewerInstance.GetProjectionMatrix();
+		const Vector3f& eyePosition = viewerInstance.GetEyePosition();
+
+		// Orthographic projections don't depend on the distance to the viewer
+		bool isPerspective = (projectionMatrix.m34 != 0.f);
+
+		// Pixels covered by one unit (at a distance of one for perspective projections)
+		float pixelScale = std::abs(projectionMatrix.m22) * viewerInstance.GetTargetSize().y * 0.5f;
+		float nearPlane = viewerInstance.GetNearPlane();
+
+		std::size_t lodHash = 0;
+
+		lodLevels.resize(visibleRenderables.size());
+		if (screenSizes)
+			screenSizes->resize(visibleRenderables.size());
+
+		for (std::size_t i = 0; i < visibleRenderables.size(); ++i)
+		{
+			const VisibleRenderable& renderableData = visibleRenderables[i];
+
+			const Matrix4f& worldMatrix = renderableData.worldInstance->GetWorldMatrix();
+			const Boxf& aabb = renderableData.instancedRenderable->GetAABB();
+
+			Vector3f scale = worldMatrix.GetScale();
+			float screenSize = aabb.GetLengths().GetLength() * std::max({ scale.x, scale.y, scale.z }) * pixelScale;
+			if (isPerspective)
+				screenSize /= std::max(worldMatrix.Transform(aabb.GetCenter()).Distance(eyePosition), nearPlane);
+
+			if (screenSizes)
+				(*screenSizes)[i] = screenSize;
+
+			std::size_t lodLevel = renderableData.instancedRenderable->SelectLod(screenSize);
+			lodLevels[i] = lodLevel;
+
+			lodHash = lodHash * 23 + lodLevel;
+		}
+
+		return lodHash;
+	}
 }
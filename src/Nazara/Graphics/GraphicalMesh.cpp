@@ -3,15 +3,36 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Graphics/GraphicalMesh.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/SoftwareBuffer.hpp>
 #include <Nazara/Core/StaticMesh.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <array>
 #include <cassert>
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		std::shared_ptr<RenderBuffer> BuildMeshDataBuffer(RenderDevice& renderDevice, const PositionQuantization& quantization)
+		{
+			std::array<UInt8, PredefinedMeshOffsets.totalSize> meshData = {};
+			AccessByOffset<Vector3f&>(meshData.data(), PredefinedMeshOffsets.positionOffsetOffset) = quantization.offset;
+			AccessByOffset<Vector3f&>(meshData.data(), PredefinedMeshOffsets.positionScaleOffset) = quantization.scale;
+
+			std::shared_ptr<RenderBuffer> meshDataBuffer = renderDevice.InstantiateBuffer(BufferType::Uniform, meshData.size(), BufferUsage::DeviceLocal | BufferUsage::Write);
+			if (!meshDataBuffer->Fill(meshData.data(), 0, meshData.size()))
+				throw std::runtime_error("failed to fill mesh data buffer");
+
+			return meshDataBuffer;
+		}
+	}
+
 	std::shared_ptr<GraphicalMesh> GraphicalMesh::BuildFromMesh(const Mesh& mesh)
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
 		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
 
 		std::shared_ptr<GraphicalMesh> gfxMesh = std::make_shared<GraphicalMesh>();
@@ -28,18 +49,35 @@ namespace Nz
 
 			GraphicalMesh::SubMesh submeshData;
 
-			const std::shared_ptr<const IndexBuffer>& indexBuffer = staticMesh.GetIndexBuffer();
-			if (indexBuffer)
+			auto UploadIndexBuffer = [&](const IndexBuffer& indexBuffer)
 			{
-				assert(indexBuffer->GetBuffer()->GetStorage() == DataStorage::Software);
-				const SoftwareBuffer* indexBufferContent = static_cast<const SoftwareBuffer*>(indexBuffer->GetBuffer().get());
+				assert(indexBuffer.GetBuffer()->GetStorage() == DataStorage::Software);
+				const SoftwareBuffer* indexBufferContent = static_cast<const SoftwareBuffer*>(indexBuffer.GetBuffer().get());
 
-				submeshData.indexBuffer = renderDevice->InstantiateBuffer(BufferType::Index, indexBuffer->GetStride() * indexBuffer->GetIndexCount(), BufferUsage::DeviceLocal | BufferUsage::Write);
-				if (!submeshData.indexBuffer->Fill(indexBufferContent->GetData() + indexBuffer->GetStartOffset(), 0, indexBuffer->GetEndOffset() - indexBuffer->GetStartOffset()))
+				std::shared_ptr<RenderBuffer> renderBuffer = renderDevice->InstantiateBuffer(BufferType::Index, indexBuffer.GetStride() * indexBuffer.GetIndexCount(), BufferUsage::DeviceLocal | BufferUsage::Write);
+				if (!renderBuffer->Fill(indexBufferContent->GetData() + indexBuffer.GetStartOffset(), 0, indexBuffer.GetEndOffset() - indexBuffer.GetStartOffset()))
 					throw std::runtime_error("failed to fill index buffer");
 
+				return renderBuffer;
+			};
+
+			const std::shared_ptr<const IndexBuffer>& indexBuffer = staticMesh.GetIndexBuffer();
+			if (indexBuffer)
+			{
+				submeshData.indexBuffer = UploadIndexBuffer(*indexBuffer);
 				submeshData.indexCount = indexBuffer->GetIndexCount();
 				submeshData.indexType = indexBuffer->GetIndexType();
+
+				for (std::size_t j = 0; j < subMesh.GetLodCount(); ++j)
+				{
+					const Nz::SubMesh::Lod& lod = subMesh.GetLod(j);
+					assert(lod.indexBuffer->GetIndexType() == submeshData.indexType);
+
+					auto& lodData = submeshData.lods.emplace_back();
+					lodData.indexBuffer = UploadIndexBuffer(*lod.indexBuffer);
+					lodData.indexCount = lod.indexBuffer->GetIndexCount();
+					lodData.error = lod.error;
+				}
 			}
 			else
 				submeshData.indexCount = vertexBuffer->GetVertexCount();
@@ -50,6 +88,10 @@ namespace Nz
 
 			submeshData.vertexDeclaration = vertexBuffer->GetVertexDeclaration();
 
+			// Quantized positions have to be remapped by the vertex shader, the quantization is captured along with the vertices (see UpdateSubMeshPositionQuantization)
+			if (const auto* positionComponent = submeshData.vertexDeclaration->FindComponent(VertexComponent::Position, 0); positionComponent && positionComponent->type == ComponentType::Short4Norm)
+				submeshData.meshDataBuffer = BuildMeshDataBuffer(*renderDevice, vertexBuffer->GetPositionQuantization());
+
 			gfxMesh->AddSubMesh(std::move(submeshData));
 		}
 
@@ -57,4 +99,26 @@ namespace Nz
 
 		return gfxMesh;
 	}
+
+	/*!
+	* \brief Updates the position quantization of a submesh
+	*
+	* Vertices and their position quantization are uploaded when the graphical mesh is built, this has to be called if the vertex buffer of a submesh is refilled with positions using another quantization.
+	*
+	* \param subMeshIndex Index of a submesh with quantized positions
+	* \param quantization New quantization, usually the one of the source VertexBuffer after its positions were written back (see VertexMapper)
+	*/
+	void GraphicalMesh::UpdateSubMeshPositionQuantization(std::size_t subMeshIndex, const PositionQuantization& quantization)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(subMeshIndex < m_subMeshes.size(), "invalid submesh index");
+		SubMesh& subMesh = m_subMeshes[subMeshIndex];
+		NazaraAssert(subMesh.meshDataBuffer, "submesh positions are not quantized");
+
+		// Previous buffer may still be used by frames in flight, replace it instead of filling it
+		subMesh.meshDataBuffer = BuildMeshDataBuffer(*Graphics::Instance()->GetRenderDevice(), quantization);
+
+		OnInvalidated(this);
+	}
 }
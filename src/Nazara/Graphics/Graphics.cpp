@@ -61,6 +61,10 @@ namespace Nz
 			#include <Nazara/Graphics/Resources/Shaders/Modules/Engine/LightShadow.nzslb.h>
 		};
 
+		const UInt8 r_meshDataModule[] = {
+			#include <Nazara/Graphics/Resources/Shaders/Modules/Engine/MeshData.nzslb.h>
+		};
+
 		const UInt8 r_skeletalDataModule[] = {
 			#include <Nazara/Graphics/Resources/Shaders/Modules/Engine/SkeletalData.nzslb.h>
 		};
@@ -93,6 +97,10 @@ namespace Nz
 			#include <Nazara/Graphics/Resources/Shaders/Modules/Math/Depth.nzslb.h>
 		};
 
+		const UInt8 r_mathOctahedralModule[] = {
+			#include <Nazara/Graphics/Resources/Shaders/Modules/Math/Octahedral.nzslb.h>
+		};
+
 		// Passes
 		const UInt8 r_gammaCorrectionPass[] = {
 			#include <Nazara/Graphics/Resources/Shaders/Passes/GammaCorrection.nzslb.h>
@@ -148,6 +156,7 @@ namespace Nz
 
 		m_renderPassCache.emplace(*m_renderDevice);
 		m_samplerCache.emplace(m_renderDevice);
+		m_textureStreamer.emplace(m_renderDevice, config.textureStreaming);
 
 		SelectDepthStencilFormats();
 
@@ -198,6 +207,7 @@ namespace Nz
 		MaterialPipeline::Uninitialize();
 		m_renderPassCache.reset();
 		m_samplerCache.reset();
+		m_textureStreamer.reset();
 		m_blitPipeline.reset();
 		m_blitPipelineLayout.reset();
 		m_defaultMaterials = DefaultMaterials{};
@@ -495,6 +505,8 @@ namespace Nz
 		RegisterEmbedShaderModule(r_mathConstantsModule);
 		RegisterEmbedShaderModule(r_mathCookTorrancePBRModule);
 		RegisterEmbedShaderModule(r_mathDepthModule);
+		RegisterEmbedShaderModule(r_mathOctahedralModule);
+		RegisterEmbedShaderModule(r_meshDataModule);
 		RegisterEmbedShaderModule(r_phongMaterialShader);
 		RegisterEmbedShaderModule(r_physicallyBasedMaterialShader);
 		RegisterEmbedShaderModule(r_skinningDataModule);
@@ -23,6 +23,39 @@ namespace Nz
 		return DataStorage::Hardware;
 	}
 
+	/*!
+	* \brief Moves rectangles of an image to a new image of the same size
+	* \return New texture
+	*
+	* \param oldImage Image holding the rectangles
+	* \param oldRects Rectangles to copy from the old image
+	* \param newRects Position of the rectangles in the new image
+	* \param count Rectangle count
+	*
+	* \remark Produces a NazaraError if relocation failed
+	*/
+	std::shared_ptr<AbstractImage> GuillotineTextureAtlas::RelocateImage(const std::shared_ptr<AbstractImage>& oldImage, const Rectui* oldRects, const Rectui* newRects, std::size_t count) const
+	{
+		const Texture& oldTexture = static_cast<const Texture&>(*oldImage);
+		Vector3ui size = oldTexture.GetSize();
+
+		std::shared_ptr<AbstractImage> newImage = ResizeImage(nullptr, Vector2ui(size.x, size.y));
+		if (!newImage)
+			return nullptr;
+
+		Texture& newTexture = static_cast<Texture&>(*newImage);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!newTexture.Copy(oldTexture, Boxui(oldRects[i].x, oldRects[i].y, 0, oldRects[i].width, oldRects[i].height, 1), Vector3ui(newRects[i].x, newRects[i].y, 0)))
+			{
+				NazaraError("failed to relocate texture rectangle");
+				return nullptr;
+			}
+		}
+
+		return newImage;
+	}
+
 	/*!
 	* \brief Resizes the image
 	* \return Updated texture
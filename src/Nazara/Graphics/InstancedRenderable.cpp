@@ -7,4 +7,15 @@
 namespace Nz
 {
 	InstancedRenderable::~InstancedRenderable() = default;
+
+	/*!
+	* \brief Selects the level of detail to use
+	* \return Level of detail index, passed to BuildElement (zero being the most detailed)
+	*
+	* \param screenSize Projected diameter of the renderable, in pixels
+	*/
+	std::size_t InstancedRenderable::SelectLod(float /*screenSize*/) const
+	{
+		return 0;
+	}
 }
@@ -93,6 +93,9 @@ namespace Nz
 			if (auto it = block->uniformBlocks.find("LightData"); it != block->uniformBlocks.end())
 				m_engineShaderBindings[EngineShaderBinding::LightDataUbo] = it->second.bindingIndex;
 
+			if (auto it = block->uniformBlocks.find("MeshData"); it != block->uniformBlocks.end())
+				m_engineShaderBindings[EngineShaderBinding::MeshDataUbo] = it->second.bindingIndex;
+
 			if (auto it = block->uniformBlocks.find("ViewerData"); it != block->uniformBlocks.end())
 				m_engineShaderBindings[EngineShaderBinding::ViewerDataUbo] = it->second.bindingIndex;
 
@@ -141,12 +144,20 @@ namespace Nz
 								config.optionValues["VertexColorLoc"_opt] = locationIndex;
 								break;
 
+							case VertexComponent::DistanceField:
+								config.optionValues["VertexDistanceFieldLoc"_opt] = locationIndex;
+								break;
+
 							case VertexComponent::Normal:
 								config.optionValues["VertexNormalLoc"_opt] = locationIndex;
+								if (component.type == ComponentType::Short2Norm)
+									config.optionValues["VertexNormalOctahedral"_opt] = true;
 								break;
 
 							case VertexComponent::Position:
 								config.optionValues["VertexPositionLoc"_opt] = locationIndex;
+								if (component.type == ComponentType::Short4Norm)
+									config.optionValues["VertexPositionQuantized"_opt] = true;
 								break;
 
 							case VertexComponent::SizeSinCos:
@@ -155,6 +166,8 @@ namespace Nz
 
 							case VertexComponent::Tangent:
 								config.optionValues["VertexTangentLoc"_opt] = locationIndex;
+								if (component.type == ComponentType::Short2Norm)
+									config.optionValues["VertexTangentOctahedral"_opt] = true;
 								break;
 
 							case VertexComponent::TexCoord:
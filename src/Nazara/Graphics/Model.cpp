@@ -19,7 +19,8 @@ namespace Nz
 	}
 
 	Model::Model(std::shared_ptr<GraphicalMesh> graphicalMesh) :
-	m_graphicalMesh(std::move(graphicalMesh))
+	m_graphicalMesh(std::move(graphicalMesh)),
+	m_lodThreshold(1.f)
 	{
 		m_submeshes.reserve(m_graphicalMesh->GetSubMeshCount());
 		for (std::size_t i = 0; i < m_graphicalMesh->GetSubMeshCount(); ++i)
@@ -55,14 +56,15 @@ namespace Nz
 
 			MaterialPassFlags passFlags = submeshData.material->GetPassFlags(passIndex);
 
-			const auto& indexBuffer = m_graphicalMesh->GetIndexBuffer(i);
+			const auto& indexBuffer = m_graphicalMesh->GetIndexBuffer(i, elementData.lodLevel);
 			const auto& vertexBuffer = m_graphicalMesh->GetVertexBuffer(i);
+			const auto& meshDataBuffer = m_graphicalMesh->GetMeshDataBuffer(i);
 			const auto& renderPipeline = materialPipeline->GetRenderPipeline(submeshData.vertexBufferData.data(), submeshData.vertexBufferData.size());
 
-			std::size_t indexCount = m_graphicalMesh->GetIndexCount(i);
+			std::size_t indexCount = m_graphicalMesh->GetIndexCount(i, elementData.lodLevel);
 			IndexType indexType = m_graphicalMesh->GetIndexType(i);
 
-			elements.emplace_back(registry.AllocateElement<RenderSubmesh>(GetRenderLayer(), submeshData.material, passFlags, renderPipeline, *elementData.worldInstance, elementData.skeletonInstance, indexCount, indexType, indexBuffer, vertexBuffer, *elementData.scissorBox));
+			elements.emplace_back(registry.AllocateElement<RenderSubmesh>(GetRenderLayer(), submeshData.material, passFlags, renderPipeline, *elementData.worldInstance, elementData.skeletonInstance, indexCount, indexType, indexBuffer, vertexBuffer, meshDataBuffer, *elementData.scissorBox));
 		}
 	}
 
@@ -100,6 +102,19 @@ namespace Nz
 		return m_graphicalMesh->GetVertexBuffer(subMeshIndex);
 	}
 
+	std::size_t Model::SelectLod(float screenSize) const
+	{
+		// Use the least detailed level whose simplification error stays under the threshold once projected on screen
+		// (errors are relative to submeshes size, which is less or equal to the model one, thus this is conservative)
+		for (std::size_t lodLevel = m_graphicalMesh->GetLodCount() - 1; lodLevel > 0; --lodLevel)
+		{
+			if (m_graphicalMesh->GetLodError(lodLevel) * screenSize <= m_lodThreshold)
+				return lodLevel;
+		}
+
+		return 0;
+	}
+
 	std::shared_ptr<Model> Model::LoadFromFile(const std::filesystem::path& filePath, const ModelParams& params)
 	{
 		Graphics* graphics = Graphics::Instance();
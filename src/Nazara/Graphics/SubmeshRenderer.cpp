@@ -32,6 +32,7 @@ namespace Nz
 		Recti invalidScissorBox(-1, -1, -1, -1);
 
 		const RenderBuffer* currentIndexBuffer = nullptr;
+		const RenderBuffer* currentMeshDataBuffer = nullptr;
 		const RenderBuffer* currentVertexBuffer = nullptr;
 		const MaterialInstance* currentMaterialInstance = nullptr;
 		const RenderPipeline* currentPipeline = nullptr;
@@ -95,6 +96,12 @@ namespace Nz
 				currentVertexBuffer = vertexBuffer;
 			}
 
+			if (const RenderBuffer* meshDataBuffer = submesh.GetMeshDataBuffer(); currentMeshDataBuffer != meshDataBuffer)
+			{
+				FlushDrawData();
+				currentMeshDataBuffer = meshDataBuffer;
+			}
+
 			if (const SkeletonInstance* skeletonInstance = submesh.GetSkeletonInstance(); currentSkeletonInstance != skeletonInstance)
 			{
 				FlushDrawData();
@@ -224,6 +231,16 @@ namespace Nz
 					};
 				}
 
+				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::MeshDataUbo); bindingIndex != Material::InvalidBindingIndex && currentMeshDataBuffer)
+				{
+					auto& bindingEntry = m_bindingCache.emplace_back();
+					bindingEntry.bindingIndex = bindingIndex;
+					bindingEntry.content = ShaderBinding::UniformBufferBinding{
+						currentMeshDataBuffer,
+						0, currentMeshDataBuffer->GetSize()
+					};
+				}
+
 				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::SkeletalDataUbo); bindingIndex != Material::InvalidBindingIndex && currentSkeletonInstance)
 				{
 					const auto& skeletalBuffer = currentSkeletonInstance->GetSkeletalBuffer();
@@ -10,12 +10,14 @@
 #include <Nazara/TextRenderer/AbstractTextDrawer.hpp>
 #include <Nazara/TextRenderer/Font.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
+#include <unordered_map>
 
 namespace Nz
 {
 	TextSprite::TextSprite(std::shared_ptr<MaterialInstance> material) :
 	InstancedRenderable(),
-	m_material(std::move(material))
+	m_material(std::move(material)),
+	m_useDistanceField(false)
 	{
 		if (!m_material)
 			m_material = MaterialInstance::GetDefault(MaterialType::Basic, MaterialInstancePreset::Transparent);
@@ -29,7 +31,8 @@ namespace Nz
 
 		MaterialPassFlags passFlags = m_material->GetPassFlags(passIndex);
 
-		const std::shared_ptr<VertexDeclaration>& vertexDeclaration = VertexDeclaration::Get(VertexLayout::XYZ_Color_UV);
+		// Distance field glyphs need their edge and smoothing values, which selects the distance field path of the material
+		const std::shared_ptr<VertexDeclaration>& vertexDeclaration = VertexDeclaration::Get((m_useDistanceField) ? VertexLayout::XYZ_Color_UV_DistanceField : VertexLayout::XYZ_Color_UV);
 
 		RenderPipelineInfo::VertexBufferData vertexBufferData = {
 			0,
@@ -42,8 +45,16 @@ namespace Nz
 			const RenderKey& key = pair.first;
 			RenderIndices& indices = pair.second;
 
-			if (indices.count > 0)
-				elements.emplace_back(registry.AllocateElement<RenderSpriteChain>(GetRenderLayer() + key.renderOrder, m_material, passFlags, renderPipeline, *elementData.worldInstance, vertexDeclaration, key.texture->shared_from_this(), indices.count, &m_vertices[indices.first * 4], *elementData.scissorBox));
+			if (indices.count == 0)
+				continue;
+
+			const void* spriteData;
+			if (m_useDistanceField)
+				spriteData = &m_distanceFieldVertices[indices.first * 4];
+			else
+				spriteData = &m_vertices[indices.first * 4];
+
+			elements.emplace_back(registry.AllocateElement<RenderSpriteChain>(GetRenderLayer() + key.renderOrder, m_material, passFlags, renderPipeline, *elementData.worldInstance, vertexDeclaration, key.texture->shared_from_this(), indices.count, spriteData, *elementData.scissorBox));
 		}
 	}
 
@@ -72,10 +83,15 @@ namespace Nz
 			pair.second.used = false;
 
 		// ... until they are marked as used by the drawer
+		m_useDistanceField = false;
+
 		std::size_t fontCount = drawer.GetFontCount();
 		for (std::size_t i = 0; i < fontCount; ++i)
 		{
 			Font& font = *drawer.GetFont(i);
+			if (font.GetGlyphMode() == FontGlyphMode::DistanceField)
+				m_useDistanceField = true;
+
 			const AbstractAtlas* atlas = font.GetAtlas().get();
 			NazaraAssert(atlas->GetStorage() == DataStorage::Hardware, "Font uses a non-hardware atlas which cannot be used by text sprites");
 
@@ -87,6 +103,7 @@ namespace Nz
 
 				atlasSlots.clearSlot.Connect(atlas->OnAtlasCleared, this, &TextSprite::OnAtlasInvalidated);
 				atlasSlots.layerChangeSlot.Connect(atlas->OnAtlasLayerChange, this, &TextSprite::OnAtlasLayerChange);
+				atlasSlots.rectsRelocatedSlot.Connect(atlas->OnAtlasRectsRelocated, this, &TextSprite::OnAtlasRectsRelocated);
 				atlasSlots.releaseSlot.Connect(atlas->OnAtlasRelease, this, &TextSprite::OnAtlasInvalidated);
 			}
 
@@ -137,7 +154,17 @@ namespace Nz
 			visibleGlyphCount++;
 		}
 
-		m_vertices.resize(visibleGlyphCount * 4);
+		// Bitmap glyphs are rendered through the distance field path as well when mixed with distance field glyphs (their edge and smoothing values leave the coverage unchanged)
+		if (m_useDistanceField)
+		{
+			m_distanceFieldVertices.resize(visibleGlyphCount * 4);
+			m_vertices.clear();
+		}
+		else
+		{
+			m_vertices.resize(visibleGlyphCount * 4);
+			m_distanceFieldVertices.clear();
+		}
 
 		// Attributes indices and reinitialize glyph count to zero to use it as a counter in the next loop
 		// This is because the 1st glyph can use texture A, the 2nd glyph can use texture B and the 3th glyph C can use texture A again
@@ -201,11 +228,16 @@ namespace Nz
 			{
 				// Set the position, color and UV of our vertices
 				// Remember that indices->count is a counter here, not a count value
-				m_vertices[offset].color = glyph.color;
-				m_vertices[offset].position = glyph.corners[cornerIndex];
-				m_vertices[offset].position.y = bounds.height - m_vertices[offset].position.y;
-				m_vertices[offset].position *= scale;
-				m_vertices[offset].uv = uvRect.GetCorner((glyph.flipped) ? flippedCorners[cornerIndex] : normalCorners[cornerIndex]);
+				VertexStruct_XYZ_Color_UV& vertex = (m_useDistanceField) ? m_distanceFieldVertices[offset] : m_vertices[offset];
+				vertex.color = glyph.color;
+				vertex.position = glyph.corners[cornerIndex];
+				vertex.position.y = bounds.height - vertex.position.y;
+				vertex.position *= scale;
+				vertex.uv = uvRect.GetCorner((glyph.flipped) ? flippedCorners[cornerIndex] : normalCorners[cornerIndex]);
+
+				if (m_useDistanceField)
+					m_distanceFieldVertices[offset].distanceField = Vector2f(glyph.distanceFieldEdge, glyph.distanceFieldSmoothing);
+
 				offset++;
 			}
 
@@ -271,11 +303,15 @@ namespace Nz
 			}
 
 			// Adjust texture coordinates by size ratio
-			SparsePtr<Vector2f> texCoordPtr(&m_vertices[indices.first].uv, sizeof(VertexStruct_XY_Color_UV));
 			for (unsigned int i = 0; i < indices.count; ++i)
 			{
 				for (unsigned int j = 0; j < 4; ++j)
-					m_vertices[i * 4 + j].uv *= scale;
+				{
+					std::size_t vertexIndex = (indices.first + i) * 4 + j;
+
+					VertexStruct_XYZ_Color_UV& vertex = (m_useDistanceField) ? m_distanceFieldVertices[vertexIndex] : m_vertices[vertexIndex];
+					vertex.uv *= scale;
+				}
 			}
 
 			newRenderInfos.emplace(RenderKey{ newTexture, renderKey.renderOrder }, indices);
@@ -285,4 +321,85 @@ namespace Nz
 
 		OnElementInvalidated(this);
 	}
+
+	/*!
+	* \brief Handle the relocation of rectangles in an atlas layer
+	*
+	* \param atlas Atlas being defragmented
+	* \param layerIndex Index of the layer
+	* \param layer Layer whose rectangles have been moved
+	* \param oldRects Previous position of the rectangles
+	* \param newRects New position of the rectangles
+	* \param count Rectangle count
+	*/
+	void TextSprite::OnAtlasRectsRelocated([[maybe_unused]] const AbstractAtlas* atlas, [[maybe_unused]] std::size_t layerIndex, AbstractImage* layer, SparsePtr<const Rectui> oldRects, SparsePtr<const Rectui> newRects, std::size_t count)
+	{
+		assert(m_atlases.find(atlas) != m_atlases.end());
+
+		Texture* texture = static_cast<Texture*>(layer);
+		Vector2f textureSize = Vector2f(Vector2ui(texture->GetSize()));
+
+		// Glyphs only know their rectangle without border, find the atlas rectangle containing each quad using a coarse grid
+		constexpr unsigned int CellSize = 64;
+
+		auto GetCellKey = [](unsigned int x, unsigned int y)
+		{
+			return (UInt64(x / CellSize) << 32) | (y / CellSize);
+		};
+
+		std::unordered_multimap<UInt64, std::size_t> cells;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Rectui& rect = oldRects[i];
+			for (unsigned int y = rect.y / CellSize; y <= (rect.y + rect.height - 1) / CellSize; ++y)
+			{
+				for (unsigned int x = rect.x / CellSize; x <= (rect.x + rect.width - 1) / CellSize; ++x)
+					cells.emplace(GetCellKey(x * CellSize, y * CellSize), i);
+			}
+		}
+
+		bool updated = false;
+		for (auto&& [renderKey, indices] : m_renderInfos)
+		{
+			if (renderKey.texture != texture)
+				continue;
+
+			for (unsigned int i = 0; i < indices.count; ++i)
+			{
+				std::size_t firstVertex = (indices.first + i) * 4;
+				auto GetVertex = [&](std::size_t j) -> VertexStruct_XYZ_Color_UV&
+				{
+					return (m_useDistanceField) ? m_distanceFieldVertices[firstVertex + j] : m_vertices[firstVertex + j];
+				};
+
+				// The quad center is always inside its rectangle, no matter the rounding of UVs
+				Vector2f center = Vector2f::Zero();
+				for (std::size_t j = 0; j < 4; ++j)
+					center += GetVertex(j).uv;
+
+				center *= textureSize / 4.f;
+
+				Vector2ui pixel(static_cast<unsigned int>(center.x), static_cast<unsigned int>(center.y));
+
+				auto range = cells.equal_range(GetCellKey(pixel.x, pixel.y));
+				for (auto it = range.first; it != range.second; ++it)
+				{
+					const Rectui& oldRect = oldRects[it->second];
+					if (!oldRect.Contains(pixel.x, pixel.y))
+						continue;
+
+					const Rectui& newRect = newRects[it->second];
+					Vector2f offset = (Vector2f(float(newRect.x), float(newRect.y)) - Vector2f(float(oldRect.x), float(oldRect.y))) / textureSize;
+					for (std::size_t j = 0; j < 4; ++j)
+						GetVertex(j).uv += offset;
+
+					updated = true;
+					break;
+				}
+			}
+		}
+
+		if (updated)
+			OnElementInvalidated(this);
+	}
 }
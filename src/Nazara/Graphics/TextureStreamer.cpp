@@ -0,0 +1,230 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Graphics/TextureStreamer.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Graphics/MaterialInstance.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderResources.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Renderer/UploadPool.hpp>
+#include <NazaraUtils/PathUtils.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Nz
+{
+	TextureStreamer::TextureStreamer(std::shared_ptr<RenderDevice> renderDevice, const MipStreamingScheduler::Config& config) :
+	m_renderDevice(std::move(renderDevice)),
+	m_scheduler(config)
+	{
+	}
+
+	TextureStreamer::~TextureStreamer() = default;
+
+	void TextureStreamer::BindTexture(std::size_t textureIndex, const std::shared_ptr<MaterialInstance>& materialInstance, std::string_view propertyName)
+	{
+		std::size_t propertyIndex = materialInstance->FindTextureProperty(propertyName);
+		if (propertyIndex == MaterialInstance::InvalidPropertyIndex)
+		{
+			NazaraErrorFmt("material has no texture property named \"{0}\"", propertyName);
+			return;
+		}
+
+		BindTexture(textureIndex, materialInstance, propertyIndex);
+	}
+
+	void TextureStreamer::BindTexture(std::size_t textureIndex, const std::shared_ptr<MaterialInstance>& materialInstance, std::size_t propertyIndex)
+	{
+		NazaraAssertFmt(m_scheduler.IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+		NazaraAssert(materialInstance, "invalid material instance");
+
+		// A destroyed material instance may have left its address to this one, forget about it before binding
+		if (m_materialTextures.contains(materialInstance.get()))
+			ReleaseExpiredBindings();
+
+		StreamedTexture& streamedTexture = m_textures[textureIndex];
+		streamedTexture.bindings.push_back({ materialInstance, propertyIndex, materialInstance.get() });
+
+		materialInstance->SetTextureProperty(propertyIndex, streamedTexture.texture);
+
+		std::vector<std::size_t>& materialTextures = m_materialTextures[materialInstance.get()];
+		if (std::find(materialTextures.begin(), materialTextures.end(), textureIndex) == materialTextures.end())
+			materialTextures.push_back(textureIndex);
+	}
+
+	std::size_t TextureStreamer::RegisterTexture(std::shared_ptr<const Image> image)
+	{
+		NazaraAssert(image, "invalid image");
+
+		if (image->GetType() != ImageType::E2D)
+		{
+			NazaraError("only 2D textures can be streamed");
+			return InvalidTextureIndex;
+		}
+
+		// Streaming requires mipmaps, build them on the CPU if the image has none
+		if (image->GetLevelCount() == 1 && !PixelFormatInfo::IsCompressed(image->GetFormat()))
+		{
+			std::shared_ptr<Image> mipmappedImage = std::make_shared<Image>(*image);
+			if (!mipmappedImage->GenerateMipmaps())
+			{
+				NazaraError("failed to generate mipmaps");
+				return InvalidTextureIndex;
+			}
+
+			image = std::move(mipmappedImage);
+		}
+
+		std::size_t textureIndex = m_scheduler.RegisterTexture(image->GetFormat(), image->GetWidth(), image->GetHeight(), 1, image->GetLevelCount());
+		if (textureIndex >= m_textures.size())
+			m_textures.resize(textureIndex + 1);
+
+		// The mip tail is uploaded right away so the texture can be used immediately
+		UInt8 tailLevel = m_scheduler.GetTailLevel(textureIndex);
+
+		std::shared_ptr<Texture> texture = InstantiateTexture(*image, tailLevel);
+		for (UInt8 level = tailLevel; level < image->GetLevelCount(); ++level)
+		{
+			if (!texture->Update(image->GetConstPixels(0, 0, 0, level), Boxui(Vector3ui::Zero(), image->GetSize(level)), 0, 0, level - tailLevel))
+			{
+				NazaraErrorFmt("failed to upload level #{0}", level);
+				m_scheduler.UnregisterTexture(textureIndex);
+				return InvalidTextureIndex;
+			}
+		}
+
+		StreamedTexture& streamedTexture = m_textures[textureIndex];
+		streamedTexture.image = std::move(image);
+		streamedTexture.texture = std::move(texture);
+
+		return textureIndex;
+	}
+
+	void TextureStreamer::ReportUsage(const MaterialInstance& materialInstance, float screenSize)
+	{
+		auto it = m_materialTextures.find(&materialInstance);
+		if (it == m_materialTextures.end())
+			return;
+
+		for (std::size_t textureIndex : it->second)
+			m_scheduler.ReportUsage(textureIndex, screenSize);
+	}
+
+	void TextureStreamer::UnregisterTexture(std::size_t textureIndex)
+	{
+		NazaraAssertFmt(m_scheduler.IsValid(textureIndex), "invalid texture index {0}", textureIndex);
+
+		StreamedTexture& streamedTexture = m_textures[textureIndex];
+		for (const MaterialBinding& binding : streamedTexture.bindings)
+		{
+			auto it = m_materialTextures.find(binding.materialKey);
+			if (it != m_materialTextures.end())
+			{
+				std::erase(it->second, textureIndex);
+				if (it->second.empty())
+					m_materialTextures.erase(it);
+			}
+		}
+
+		// Material instances keep a reference on the texture they use, the texture stays alive as long as they do
+		streamedTexture = StreamedTexture{};
+		m_scheduler.UnregisterTexture(textureIndex);
+	}
+
+	void TextureStreamer::Update(RenderResources& renderResources)
+	{
+		ReleaseExpiredBindings();
+
+		m_scheduler.Update(m_residencyChanges);
+		if (m_residencyChanges.empty())
+			return;
+
+		UploadPool& uploadPool = renderResources.GetUploadPool();
+
+		// Every resident level of the new texture is uploaded through the upload pool, the previous texture is kept alive until the GPU is done with it
+		renderResources.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Texture streaming", Color::Cyan());
+			{
+				for (const MipStreamingScheduler::ResidencyChange& residencyChange : m_residencyChanges)
+				{
+					StreamedTexture& streamedTexture = m_textures[residencyChange.textureIndex];
+					const Image& image = *streamedTexture.image;
+
+					std::shared_ptr<Texture> texture = InstantiateTexture(image, residencyChange.residentLevel);
+
+					builder.TextureBarrier(PipelineStage::TopOfPipe, PipelineStage::Transfer, {}, MemoryAccess::TransferWrite, TextureLayout::Undefined, TextureLayout::TransferDestination, *texture);
+
+					for (UInt8 level = residencyChange.residentLevel; level < image.GetLevelCount(); ++level)
+					{
+						std::size_t levelSize = image.GetMemoryUsage(level);
+
+						// Copies from buffers require an offset aligned to the texel (or block) size
+						auto& allocation = uploadPool.Allocate(levelSize, 16);
+						std::memcpy(allocation.mappedPtr, image.GetConstPixels(0, 0, 0, level), levelSize);
+
+						builder.CopyTexture(allocation, *texture, Boxui(Vector3ui::Zero(), image.GetSize(level)), level - residencyChange.residentLevel, TextureLayout::TransferDestination);
+					}
+
+					builder.TextureBarrier(PipelineStage::Transfer, PipelineStage::FragmentShader, MemoryAccess::TransferWrite, MemoryAccess::ShaderRead, TextureLayout::TransferDestination, TextureLayout::ColorInput, *texture);
+
+					renderResources.PushForRelease(std::move(streamedTexture.texture));
+					streamedTexture.texture = std::move(texture);
+				}
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Transfer);
+
+		for (const MipStreamingScheduler::ResidencyChange& residencyChange : m_residencyChanges)
+		{
+			StreamedTexture& streamedTexture = m_textures[residencyChange.textureIndex];
+			for (const MaterialBinding& binding : streamedTexture.bindings)
+			{
+				if (std::shared_ptr<MaterialInstance> materialInstance = binding.materialInstance.lock())
+					materialInstance->SetTextureProperty(binding.propertyIndex, streamedTexture.texture);
+			}
+		}
+	}
+
+	std::shared_ptr<Texture> TextureStreamer::InstantiateTexture(const Image& image, UInt8 firstLevel) const
+	{
+		TextureInfo textureInfo;
+		textureInfo.pixelFormat = image.GetFormat();
+		textureInfo.type = ImageType::E2D;
+		textureInfo.levelCount = image.GetLevelCount() - firstLevel;
+		textureInfo.width = Texture::GetLevelSize(image.GetWidth(), firstLevel);
+		textureInfo.height = Texture::GetLevelSize(image.GetHeight(), firstLevel);
+
+		std::shared_ptr<Texture> texture = m_renderDevice->InstantiateTexture(textureInfo);
+		texture->SetFilePath(image.GetFilePath());
+		if (std::string debugName = PathToString(image.GetFilePath()); !debugName.empty())
+			texture->UpdateDebugName(debugName);
+
+		return texture;
+	}
+
+	void TextureStreamer::ReleaseExpiredBindings()
+	{
+		for (std::size_t textureIndex = 0; textureIndex < m_textures.size(); ++textureIndex)
+		{
+			std::erase_if(m_textures[textureIndex].bindings, [&](const MaterialBinding& binding)
+			{
+				if (!binding.materialInstance.expired())
+					return false;
+
+				auto it = m_materialTextures.find(binding.materialKey);
+				if (it != m_materialTextures.end())
+				{
+					std::erase(it->second, textureIndex);
+					if (it->second.empty())
+						m_materialTextures.erase(it);
+				}
+
+				return true;
+			});
+		}
+	}
+}
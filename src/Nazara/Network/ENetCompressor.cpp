@@ -3,8 +3,109 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
 
 namespace Nz
 {
+	/*!
+	* \ingroup network
+	* \class Nz::ENetCompressor
+	* \brief Network class that compresses outgoing ENet datagrams and decompresses incoming ones
+	*
+	* Compress returns 0 to send a datagram uncompressed and Decompress returns 0 to reject a datagram.
+	* Implementations can record their statistics using RecordCompression and RecordDecompression.
+	*
+	* \see ENetLZ4Compressor
+	* \see ENetRangeCoderCompressor
+	*/
+
 	ENetCompressor::~ENetCompressor() = default;
+
+	/*!
+	* \brief Gets the statistics of a single peer
+	* \return Compression statistics of the peer, nullptr if nothing was recorded for this peer
+	*
+	* \param peer Peer to query
+	*/
+	auto ENetCompressor::GetPeerStatistics(const ENetPeer* peer) const -> const Statistics*
+	{
+		NazaraAssert(peer, "invalid peer");
+
+		std::size_t peerId = peer->GetPeerId();
+		if (peerId >= m_peerStatistics.size())
+			return nullptr;
+
+		return &m_peerStatistics[peerId];
+	}
+
+	/*!
+	* \brief Clears global and per-peer statistics
+	*/
+	void ENetCompressor::ResetStatistics()
+	{
+		m_globalStatistics = Statistics{};
+		m_peerStatistics.clear();
+	}
+
+	/*!
+	* \brief Records a Compress call
+	*
+	* \param peer Destination peer (may be null)
+	* \param inputSize Size of the datagram before compression
+	* \param compressedSize Size after compression, 0 if the datagram is sent uncompressed
+	* \param duration Time spent compressing
+	*/
+	void ENetCompressor::RecordCompression(const ENetPeer* peer, std::size_t inputSize, std::size_t compressedSize, Time duration)
+	{
+		auto Record = [&](Statistics& statistics)
+		{
+			statistics.compressionTime += duration;
+			statistics.inputSize += inputSize;
+
+			if (compressedSize > 0)
+			{
+				statistics.compressedPacketCount++;
+				statistics.outputSize += compressedSize;
+			}
+			else
+			{
+				statistics.uncompressedPacketCount++;
+				statistics.outputSize += inputSize;
+			}
+		};
+
+		Record(m_globalStatistics);
+
+		if (peer)
+		{
+			std::size_t peerId = peer->GetPeerId();
+			if (peerId >= m_peerStatistics.size())
+				m_peerStatistics.resize(peerId + 1);
+
+			Record(m_peerStatistics[peerId]);
+		}
+	}
+
+	/*!
+	* \brief Records a Decompress call
+	*
+	* \param peer Source peer (may be null)
+	* \param duration Time spent decompressing
+	*/
+	void ENetCompressor::RecordDecompression(const ENetPeer* peer, Time duration)
+	{
+		m_globalStatistics.decompressedPacketCount++;
+		m_globalStatistics.decompressionTime += duration;
+
+		if (peer)
+		{
+			std::size_t peerId = peer->GetPeerId();
+			if (peerId >= m_peerStatistics.size())
+				m_peerStatistics.resize(peerId + 1);
+
+			m_peerStatistics[peerId].decompressedPacketCount++;
+			m_peerStatistics[peerId].decompressionTime += duration;
+		}
+	}
 }
@@ -335,6 +335,12 @@ namespace Nz
 
 		if (address.IsValid() && !address.IsLoopback())
 		{
+			if (m_isReusePortEnabled && !m_socket.EnableReusePort(true))
+			{
+				NazaraErrorFmt("failed to enable port sharing: {0}", ErrorToString(m_socket.GetLastError()));
+				return false;
+			}
+
 			if (m_socket.Bind(address) != SocketState::Bound)
 			{
 				NazaraErrorFmt("failed to bind address {0}", address.ToString());
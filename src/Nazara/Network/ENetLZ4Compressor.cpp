@@ -0,0 +1,373 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <NazaraUtils/StackArray.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// LZ4 block format constraints
+		constexpr std::size_t LastLiteralSize = 5;  //< the last five bytes are always literals
+		constexpr std::size_t MatchSafeDistance = 12; //< no match can start within the last twelve bytes
+		constexpr std::size_t MaxOffset = std::numeric_limits<UInt16>::max();
+		constexpr std::size_t MinMatchLength = 4;
+
+		// Random access to the datagram buffers, as if they were contiguous
+		class GatheredInput
+		{
+			public:
+				GatheredInput(const NetBuffer* buffers, std::size_t bufferCount, std::size_t* offsets) :
+				m_buffers(buffers),
+				m_offsets(offsets),
+				m_bufferCount(bufferCount)
+				{
+					offsets[0] = 0;
+					for (std::size_t i = 0; i < bufferCount; ++i)
+						offsets[i + 1] = offsets[i] + buffers[i].dataLength;
+				}
+
+				UInt8* Copy(std::size_t position, std::size_t size, UInt8* output) const
+				{
+					Cursor cursor = GetCursor(position);
+					while (size > 0)
+					{
+						std::size_t copySize = std::min(size, cursor.Remaining());
+						std::memcpy(output, cursor.ptr, copySize);
+
+						output += copySize;
+						size -= copySize;
+						cursor.Advance(copySize);
+					}
+
+					return output;
+				}
+
+				std::size_t MatchLength(std::size_t position, std::size_t matchPosition, std::size_t maxLength) const
+				{
+					Cursor first = GetCursor(position);
+					Cursor second = GetCursor(matchPosition);
+
+					std::size_t length = 0;
+					while (length < maxLength)
+					{
+						std::size_t spanSize = std::min({ first.Remaining(), second.Remaining(), maxLength - length });
+
+						std::size_t i = 0;
+						for (; i + sizeof(UInt64) <= spanSize; i += sizeof(UInt64))
+						{
+							UInt64 firstValue;
+							std::memcpy(&firstValue, first.ptr + i, sizeof(UInt64));
+
+							UInt64 secondValue;
+							std::memcpy(&secondValue, second.ptr + i, sizeof(UInt64));
+
+							if (UInt64 diff = firstValue ^ secondValue)
+							{
+								if constexpr (std::endian::native == std::endian::little)
+									return length + i + std::countr_zero(diff) / 8;
+								else
+									return length + i + std::countl_zero(diff) / 8;
+							}
+						}
+
+						for (; i < spanSize; ++i)
+						{
+							if (first.ptr[i] != second.ptr[i])
+								return length + i;
+						}
+
+						length += spanSize;
+						first.Advance(spanSize);
+						second.Advance(spanSize);
+					}
+
+					return length;
+				}
+
+				UInt32 Read32(std::size_t position) const
+				{
+					UInt32 value;
+
+					Cursor cursor = GetCursor(position);
+					if (cursor.Remaining() >= sizeof(UInt32))
+						std::memcpy(&value, cursor.ptr, sizeof(UInt32));
+					else
+						Copy(position, sizeof(UInt32), reinterpret_cast<UInt8*>(&value));
+
+					return value;
+				}
+
+			private:
+				struct Cursor
+				{
+					void Advance(std::size_t size)
+					{
+						ptr += size;
+						Normalize();
+					}
+
+					void Normalize()
+					{
+						while (ptr == end && buffer + 1 < bufferEnd)
+						{
+							++buffer;
+							ptr = static_cast<const UInt8*>(buffer->data);
+							end = ptr + buffer->dataLength;
+						}
+					}
+
+					std::size_t Remaining() const
+					{
+						return end - ptr;
+					}
+
+					const NetBuffer* buffer;
+					const NetBuffer* bufferEnd;
+					const UInt8* ptr;
+					const UInt8* end;
+				};
+
+				Cursor GetCursor(std::size_t position) const
+				{
+					// Last buffer starting at or before position (skipping empty buffers)
+					std::size_t bufferIndex = std::upper_bound(m_offsets, m_offsets + m_bufferCount, position) - m_offsets - 1;
+
+					Cursor cursor;
+					cursor.buffer = &m_buffers[bufferIndex];
+					cursor.bufferEnd = m_buffers + m_bufferCount;
+					cursor.ptr = static_cast<const UInt8*>(cursor.buffer->data) + (position - m_offsets[bufferIndex]);
+					cursor.end = static_cast<const UInt8*>(cursor.buffer->data) + cursor.buffer->dataLength;
+					cursor.Normalize();
+
+					return cursor;
+				}
+
+				const NetBuffer* m_buffers;
+				const std::size_t* m_offsets;
+				std::size_t m_bufferCount;
+		};
+
+		UInt8* WriteLength(UInt8* output, std::size_t length)
+		{
+			for (; length >= 0xFF; length -= 0xFF)
+				*output++ = 0xFF;
+
+			*output++ = static_cast<UInt8>(length);
+			return output;
+		}
+
+		// Upper bound of the encoded size of a sequence
+		std::size_t SequenceMaxSize(std::size_t literalLength, std::size_t matchLength)
+		{
+			return 1 + (literalLength / 0xFF + 1) + literalLength + 2 + (matchLength / 0xFF + 1);
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetLZ4Compressor
+	* \brief Network class compressing ENet datagrams using the LZ4 block format
+	*
+	* This compressor favors speed over ratio: matches are found using a single-entry hash table and the datagram buffers are read in place,
+	* without being concatenated first. Datagrams which wouldn't shrink are sent uncompressed.
+	*/
+
+	/*!
+	* \brief Compresses a datagram
+	* \return Compressed size, 0 if the datagram should be sent uncompressed
+	*
+	* \param peer Destination peer
+	* \param buffers Datagram buffers
+	* \param bufferCount Number of buffers
+	* \param totalInputSize Sum of the buffers sizes
+	* \param output Output buffer
+	* \param maxOutputSize Output buffer size
+	*/
+	std::size_t ENetLZ4Compressor::Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		Time startTime = GetElapsedNanoseconds();
+		std::size_t compressedSize = CompressBuffers(buffers, bufferCount, totalInputSize, output, maxOutputSize);
+		RecordCompression(peer, totalInputSize, compressedSize, GetElapsedNanoseconds() - startTime);
+
+		return compressedSize;
+	}
+
+	/*!
+	* \brief Decompresses a datagram
+	* \return Decompressed size, 0 if the datagram is corrupted or doesn't fit in the output buffer
+	*
+	* \param peer Source peer
+	* \param input Compressed datagram
+	* \param inputSize Compressed datagram size
+	* \param output Output buffer
+	* \param maxOutputSize Output buffer size
+	*/
+	std::size_t ENetLZ4Compressor::Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		Time startTime = GetElapsedNanoseconds();
+		std::size_t decompressedSize = DecompressBuffer(input, inputSize, output, maxOutputSize);
+		if (decompressedSize > 0)
+			RecordDecompression(peer, GetElapsedNanoseconds() - startTime);
+
+		return decompressedSize;
+	}
+
+	std::size_t ENetLZ4Compressor::CompressBuffers(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		// Too small to contain a match, or too big for our position table (ENet datagrams are bounded by the MTU)
+		if (totalInputSize < MatchSafeDistance + 1 || totalInputSize >= std::numeric_limits<UInt16>::max())
+			return 0;
+
+		StackArray<std::size_t> offsets = NazaraStackArray(std::size_t, bufferCount + 1);
+		GatheredInput input(buffers, bufferCount, offsets.data());
+
+		m_hashTable.fill(0);
+
+		// Compressing is only worth it if we save at least one byte
+		UInt8* outputPtr = output;
+		UInt8* outputEnd = output + std::min(maxOutputSize, totalInputSize - 1);
+
+		std::size_t anchor = 0;
+		std::size_t position = 0;
+		std::size_t matchLimit = totalInputSize - MatchSafeDistance;
+		while (position < matchLimit)
+		{
+			UInt32 sequence = input.Read32(position);
+			UInt32 hash = (sequence * 2654435761U) >> (32 - HashBits);
+
+			std::size_t candidate = m_hashTable[hash];
+			m_hashTable[hash] = static_cast<UInt16>(position + 1);
+
+			if (candidate == 0 || position - (candidate - 1) > MaxOffset || input.Read32(candidate - 1) != sequence)
+			{
+				// Skip faster through incompressible data
+				position += 1 + ((position - anchor) >> 6);
+				continue;
+			}
+
+			std::size_t matchPosition = candidate - 1;
+			std::size_t matchLength = MinMatchLength + input.MatchLength(position + MinMatchLength, matchPosition + MinMatchLength, totalInputSize - LastLiteralSize - position - MinMatchLength);
+			std::size_t literalLength = position - anchor;
+
+			if (SequenceMaxSize(literalLength, matchLength) > static_cast<std::size_t>(outputEnd - outputPtr))
+				return 0;
+
+			UInt8* token = outputPtr++;
+			*token = static_cast<UInt8>((std::min<std::size_t>(literalLength, 0x0F) << 4) | std::min<std::size_t>(matchLength - MinMatchLength, 0x0F));
+
+			if (literalLength >= 0x0F)
+				outputPtr = WriteLength(outputPtr, literalLength - 0x0F);
+
+			outputPtr = input.Copy(anchor, literalLength, outputPtr);
+
+			std::size_t offset = position - matchPosition;
+			*outputPtr++ = static_cast<UInt8>(offset & 0xFF);
+			*outputPtr++ = static_cast<UInt8>(offset >> 8);
+
+			if (matchLength - MinMatchLength >= 0x0F)
+				outputPtr = WriteLength(outputPtr, matchLength - MinMatchLength - 0x0F);
+
+			position += matchLength;
+			anchor = position;
+		}
+
+		// Last literals
+		std::size_t literalLength = totalInputSize - anchor;
+		if (1 + (literalLength / 0xFF + 1) + literalLength > static_cast<std::size_t>(outputEnd - outputPtr))
+			return 0;
+
+		*outputPtr++ = static_cast<UInt8>(std::min<std::size_t>(literalLength, 0x0F) << 4);
+		if (literalLength >= 0x0F)
+			outputPtr = WriteLength(outputPtr, literalLength - 0x0F);
+
+		outputPtr = input.Copy(anchor, literalLength, outputPtr);
+
+		return outputPtr - output;
+	}
+
+	std::size_t ENetLZ4Compressor::DecompressBuffer(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const UInt8* inputPtr = input;
+		const UInt8* inputEnd = input + inputSize;
+		UInt8* outputPtr = output;
+		UInt8* outputEnd = output + maxOutputSize;
+
+		auto ReadLength = [&](std::size_t& length)
+		{
+			UInt8 byte;
+			do
+			{
+				if (inputPtr >= inputEnd)
+					return false;
+
+				byte = *inputPtr++;
+				length += byte;
+			}
+			while (byte == 0xFF);
+
+			return true;
+		};
+
+		while (inputPtr < inputEnd)
+		{
+			UInt8 token = *inputPtr++;
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 0x0F && !ReadLength(literalLength))
+				return 0;
+
+			if (literalLength > static_cast<std::size_t>(inputEnd - inputPtr) || literalLength > static_cast<std::size_t>(outputEnd - outputPtr))
+				return 0;
+
+			std::memcpy(outputPtr, inputPtr, literalLength);
+			inputPtr += literalLength;
+			outputPtr += literalLength;
+
+			// The last sequence has no match
+			if (inputPtr == inputEnd)
+				break;
+
+			if (inputEnd - inputPtr < 2)
+				return 0;
+
+			std::size_t offset = inputPtr[0] | (inputPtr[1] << 8);
+			inputPtr += 2;
+
+			if (offset == 0 || offset > static_cast<std::size_t>(outputPtr - output))
+				return 0;
+
+			std::size_t matchLength = token & 0x0F;
+			if (matchLength == 0x0F && !ReadLength(matchLength))
+				return 0;
+
+			matchLength += MinMatchLength;
+			if (matchLength > static_cast<std::size_t>(outputEnd - outputPtr))
+				return 0;
+
+			// Matches may overlap the bytes they produce (repeating patterns)
+			const UInt8* matchPtr = outputPtr - offset;
+			if (offset >= matchLength)
+				std::memcpy(outputPtr, matchPtr, matchLength);
+			else
+			{
+				for (std::size_t i = 0; i < matchLength; ++i)
+					outputPtr[i] = matchPtr[i];
+			}
+
+			outputPtr += matchLength;
+		}
+
+		return outputPtr - output;
+	}
+}
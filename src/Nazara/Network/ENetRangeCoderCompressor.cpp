@@ -0,0 +1,381 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <algorithm>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		constexpr unsigned int ProbabilityBits = 11;
+		constexpr UInt16 InitialProbability = 1 << (ProbabilityBits - 1);
+		constexpr unsigned int AdaptationShift = 4; //< faster than LZMA (5), datagrams are too short for slow adaptation to pay off
+		constexpr UInt32 TopValue = 1 << 24;
+
+		constexpr std::size_t MaxSizePrefixLength = 5;
+
+		// Trailing zeros of the encoded data are trimmed (the decoder reads zeros past the end of its input), up to the size of the decoder initial read
+		constexpr std::size_t MaxTrimmedByteCount = 4;
+
+		// Probabilities can't go over 2033/2048 (see AdaptationShift), which costs at least 0.0106 bit per bit and thus 0.085 bit per byte
+		// Every encoded byte can't give more than ~94 bytes, this is used to reject corrupted sizes before decoding anything
+		constexpr std::size_t MaxDecodedBytePerEncodedByte = 96;
+
+		std::size_t SelectContext(UInt8 previousByte)
+		{
+			return previousByte >> 5;
+		}
+
+		// Binary range coder (as used by LZMA)
+		class RangeEncoder
+		{
+			public:
+				RangeEncoder(UInt8* output, UInt8* outputEnd) :
+				m_outputPtr(output),
+				m_outputEnd(outputEnd),
+				m_low(0),
+				m_cacheSize(1),
+				m_range(0xFFFFFFFF),
+				m_cache(0),
+				m_isFirstByte(true),
+				m_overflow(false)
+				{
+				}
+
+				void EncodeBit(UInt16& probability, unsigned int bit)
+				{
+					UInt32 bound = (m_range >> ProbabilityBits) * probability;
+					if (bit == 0)
+					{
+						m_range = bound;
+						probability += ((1 << ProbabilityBits) - probability) >> AdaptationShift;
+					}
+					else
+					{
+						m_low += bound;
+						m_range -= bound;
+						probability -= probability >> AdaptationShift;
+					}
+
+					while (m_range < TopValue)
+					{
+						m_range <<= 8;
+						ShiftLow();
+					}
+				}
+
+				void EncodeByte(UInt16* probabilities, UInt8 byte)
+				{
+					unsigned int node = 1;
+					for (int i = 7; i >= 0; --i)
+					{
+						unsigned int bit = (byte >> i) & 1;
+						EncodeBit(probabilities[node], bit);
+						node = (node << 1) | bit;
+					}
+				}
+
+				UInt8* Flush()
+				{
+					for (unsigned int i = 0; i < 5; ++i)
+						ShiftLow();
+
+					return m_outputPtr;
+				}
+
+				bool HasOverflowed() const
+				{
+					return m_overflow;
+				}
+
+			private:
+				void ShiftLow()
+				{
+					if (static_cast<UInt32>(m_low) < 0xFF000000 || (m_low >> 32) != 0)
+					{
+						UInt8 carry = static_cast<UInt8>(m_low >> 32);
+						UInt8 byte = m_cache;
+						do
+						{
+							WriteByte(static_cast<UInt8>(byte + carry));
+							byte = 0xFF;
+						}
+						while (--m_cacheSize != 0);
+
+						m_cache = static_cast<UInt8>(m_low >> 24);
+					}
+
+					m_cacheSize++;
+					m_low = (m_low & 0x00FFFFFF) << 8;
+				}
+
+				void WriteByte(UInt8 byte)
+				{
+					// The first byte is always zero, the decoder doesn't need it
+					if (m_isFirstByte)
+					{
+						m_isFirstByte = false;
+						return;
+					}
+
+					if (m_outputPtr < m_outputEnd)
+						*m_outputPtr++ = byte;
+					else
+						m_overflow = true;
+				}
+
+				UInt8* m_outputPtr;
+				UInt8* m_outputEnd;
+				UInt64 m_low;
+				UInt64 m_cacheSize;
+				UInt32 m_range;
+				UInt8 m_cache;
+				bool m_isFirstByte;
+				bool m_overflow;
+		};
+
+		class RangeDecoder
+		{
+			public:
+				RangeDecoder(const UInt8* input, const UInt8* inputEnd) :
+				m_inputPtr(input),
+				m_inputEnd(inputEnd),
+				m_pastEndByteCount(0),
+				m_code(0),
+				m_range(0xFFFFFFFF)
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+						m_code = (m_code << 8) | ReadByte();
+				}
+
+				unsigned int DecodeBit(UInt16& probability)
+				{
+					unsigned int bit;
+
+					UInt32 bound = (m_range >> ProbabilityBits) * probability;
+					if (m_code < bound)
+					{
+						m_range = bound;
+						probability += ((1 << ProbabilityBits) - probability) >> AdaptationShift;
+						bit = 0;
+					}
+					else
+					{
+						m_code -= bound;
+						m_range -= bound;
+						probability -= probability >> AdaptationShift;
+						bit = 1;
+					}
+
+					while (m_range < TopValue)
+					{
+						m_range <<= 8;
+						m_code = (m_code << 8) | ReadByte();
+					}
+
+					return bit;
+				}
+
+				UInt8 DecodeByte(UInt16* probabilities)
+				{
+					unsigned int node = 1;
+					while (node < 0x100)
+						node = (node << 1) | DecodeBit(probabilities[node]);
+
+					return static_cast<UInt8>(node);
+				}
+
+				// Valid data is read up to its end, and not further than the trimmed zeros
+				bool HasReadPastTrimmedBytes() const
+				{
+					return m_pastEndByteCount > MaxTrimmedByteCount;
+				}
+
+				bool IsValidEnd() const
+				{
+					return m_inputPtr == m_inputEnd && !HasReadPastTrimmedBytes();
+				}
+
+			private:
+				UInt8 ReadByte()
+				{
+					if (m_inputPtr < m_inputEnd)
+						return *m_inputPtr++;
+
+					// Trailing zeros are trimmed by the encoder
+					m_pastEndByteCount++;
+					return 0;
+				}
+
+				const UInt8* m_inputPtr;
+				const UInt8* m_inputEnd;
+				std::size_t m_pastEndByteCount;
+				UInt32 m_code;
+				UInt32 m_range;
+		};
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetRangeCoderCompressor
+	* \brief Network class compressing ENet datagrams using an adaptive range coder
+	*
+	* Like ENet's original range coder, this compressor learns byte statistics from scratch for every datagram and favors ratio over speed.
+	* Bytes are coded bit per bit with probabilities depending on the previous byte, which adapt quickly to the short repetitive content of game datagrams.
+	* Datagrams which wouldn't shrink are sent uncompressed.
+	*/
+
+	/*!
+	* \brief Compresses a datagram
+	* \return Compressed size, 0 if the datagram should be sent uncompressed
+	*
+	* \param peer Destination peer
+	* \param buffers Datagram buffers
+	* \param bufferCount Number of buffers
+	* \param totalInputSize Sum of the buffers sizes
+	* \param output Output buffer
+	* \param maxOutputSize Output buffer size
+	*/
+	std::size_t ENetRangeCoderCompressor::Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		Time startTime = GetElapsedNanoseconds();
+		std::size_t compressedSize = CompressBuffers(buffers, bufferCount, totalInputSize, output, maxOutputSize);
+		RecordCompression(peer, totalInputSize, compressedSize, GetElapsedNanoseconds() - startTime);
+
+		return compressedSize;
+	}
+
+	/*!
+	* \brief Decompresses a datagram
+	* \return Decompressed size, 0 if the datagram is corrupted or doesn't fit in the output buffer
+	*
+	* \param peer Source peer
+	* \param input Compressed datagram
+	* \param inputSize Compressed datagram size
+	* \param output Output buffer
+	* \param maxOutputSize Output buffer size
+	*/
+	std::size_t ENetRangeCoderCompressor::Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		Time startTime = GetElapsedNanoseconds();
+		std::size_t decompressedSize = DecompressBuffer(input, inputSize, output, maxOutputSize);
+		if (decompressedSize > 0)
+			RecordDecompression(peer, GetElapsedNanoseconds() - startTime);
+
+		return decompressedSize;
+	}
+
+	std::size_t ENetRangeCoderCompressor::CompressBuffers(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (totalInputSize == 0)
+			return 0;
+
+		// Compressing is only worth it if we save at least one byte
+		UInt8* outputEnd = output + std::min(maxOutputSize, totalInputSize - 1);
+
+		// Decompressed size, as a varint
+		UInt8* outputPtr = output;
+		std::size_t remainingSize = totalInputSize;
+		do
+		{
+			if (outputPtr >= outputEnd)
+				return 0;
+
+			UInt8 byte = static_cast<UInt8>(remainingSize & 0x7F);
+			remainingSize >>= 7;
+			if (remainingSize != 0)
+				byte |= 0x80;
+
+			*outputPtr++ = byte;
+		}
+		while (remainingSize != 0);
+
+		ResetModel();
+
+		RangeEncoder encoder(outputPtr, outputEnd);
+
+		UInt8 previousByte = 0;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			const UInt8* data = static_cast<const UInt8*>(buffers[i].data);
+			for (std::size_t j = 0; j < buffers[i].dataLength; ++j)
+			{
+				encoder.EncodeByte(m_model[SelectContext(previousByte)].data(), data[j]);
+				previousByte = data[j];
+			}
+
+			if (encoder.HasOverflowed())
+				return 0;
+		}
+
+		UInt8* encodedEnd = encoder.Flush();
+		if (encoder.HasOverflowed())
+			return 0;
+
+		// The decoder reads zeros past the end of its input
+		for (std::size_t i = 0; i < MaxTrimmedByteCount && encodedEnd > outputPtr && encodedEnd[-1] == 0; ++i)
+			--encodedEnd;
+
+		return encodedEnd - output;
+	}
+
+	std::size_t ENetRangeCoderCompressor::DecompressBuffer(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const UInt8* inputPtr = input;
+		const UInt8* inputEnd = input + inputSize;
+
+		std::size_t decompressedSize = 0;
+		for (std::size_t i = 0;; ++i)
+		{
+			if (i >= MaxSizePrefixLength || inputPtr >= inputEnd)
+				return 0;
+
+			UInt8 byte = *inputPtr++;
+			decompressedSize |= std::size_t(byte & 0x7F) << (7 * i);
+			if ((byte & 0x80) == 0)
+				break;
+		}
+
+		if (decompressedSize == 0 || decompressedSize > maxOutputSize)
+			return 0;
+
+		// Don't spend time decoding sizes the encoded data couldn't hold
+		std::size_t encodedSize = static_cast<std::size_t>(inputEnd - inputPtr) + MaxTrimmedByteCount;
+		if (decompressedSize / MaxDecodedBytePerEncodedByte >= encodedSize)
+			return 0;
+
+		ResetModel();
+
+		RangeDecoder decoder(inputPtr, inputEnd);
+
+		UInt8 previousByte = 0;
+		for (std::size_t i = 0; i < decompressedSize; ++i)
+		{
+			output[i] = decoder.DecodeByte(m_model[SelectContext(previousByte)].data());
+			previousByte = output[i];
+
+			if (decoder.HasReadPastTrimmedBytes())
+				return 0;
+		}
+
+		// Reject truncated data as well as data followed by garbage
+		if (!decoder.IsValidEnd())
+			return 0;
+
+		return decompressedSize;
+	}
+
+	void ENetRangeCoderCompressor::ResetModel()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		for (auto& contextModel : m_model)
+			contextModel.fill(InitialProbability);
+	}
+}
@@ -0,0 +1,365 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ThreadExt.hpp>
+#include <concurrentqueue.h>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+namespace Nz
+{
+	struct ENetShardedHost::Command
+	{
+		enum class Type
+		{
+			Broadcast,
+			Disconnect,
+			Send
+		};
+
+		ByteArray packet;
+		ENetPacketFlags flags;
+		PeerToken token;
+		Type type;
+		UInt32 data;
+		UInt8 channelId;
+	};
+
+	struct ENetShardedHost::Shard
+	{
+		ENetHost host;
+		moodycamel::ConcurrentQueue<Command> commands;
+		std::atomic_bool running = false;
+		std::atomic<UInt32> totalReceivedPackets = 0;
+		std::atomic<UInt32> totalSentPackets = 0;
+		std::atomic<UInt64> totalReceivedData = 0;
+		std::atomic<UInt64> totalSentData = 0;
+		std::size_t shardIndex;
+		std::thread thread;
+	};
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetShardedHost
+	* \brief Network class running several ENet hosts on their own thread, all listening on the same port
+	*
+	* Each shard is a regular ENetHost bound with port sharing (SO_REUSEPORT), the kernel dispatching incoming datagrams by source address.
+	* A client always reaches the same shard as long as the shard set stays the same, so each shard owns its peers and no locking is required to service them.
+	*
+	* Events are handled on the thread of the shard which received them, where the host and its peers can be used directly.
+	* Other threads talk to peers through PeerToken, commands being pushed to a lock-free queue drained by the shard before servicing its host.
+	* Shards wait at most the service timeout (1ms by default, see SetServiceTimeout) for datagrams, which bounds both command latency and idle wakeups.
+	*
+	* \remark Port sharing is only available on Linux and BSD-like systems, other platforms can only run a single shard.
+	*/
+
+	ENetShardedHost::ENetShardedHost() :
+	m_serviceTimeout(1),
+	m_isRunning(false)
+	{
+	}
+
+	ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Sends a packet to every connected peer of every shard
+	*
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet payload, copied for every shard
+	*
+	* \remark This can be called from any thread
+	*/
+	void ENetShardedHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	{
+		NazaraAssert(!m_shards.empty(), "Host hasn't been created");
+
+		for (std::size_t i = 0; i < m_shards.size(); ++i)
+		{
+			Command command;
+			command.type = Command::Type::Broadcast;
+			command.channelId = channelId;
+			command.flags = flags;
+			command.packet = (i + 1 < m_shards.size()) ? packet : std::move(packet);
+
+			m_shards[i]->commands.enqueue(std::move(command));
+		}
+	}
+
+	/*!
+	* \brief Creates the shard hosts, all bound to the same address
+	* \return true if every shard was created
+	*
+	* \param listenAddress Address to listen on, its port cannot be zero when using multiple shards
+	* \param shardCount Number of hosts (and threads) to create
+	* \param peerCountPerShard Maximum number of peers of each shard
+	* \param channelCount Maximum number of channels per peer
+	* \param incomingBandwidth Incoming bandwidth of each shard, 0 for unlimited
+	* \param outgoingBandwidth Outgoing bandwidth of each shard, 0 for unlimited
+	*
+	* \remark Shards are not serviced until Start is called, allowing them to be configured (e.g. with a compressor) using GetShardHost
+	*/
+	bool ENetShardedHost::Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount, UInt32 incomingBandwidth, UInt32 outgoingBandwidth)
+	{
+		NazaraAssert(m_shards.empty(), "Host has already been created");
+		NazaraAssert(listenAddress.IsValid() && !listenAddress.IsLoopback(), "Invalid listening address");
+		NazaraAssert(shardCount > 0, "Invalid shard count");
+
+		if (shardCount > std::numeric_limits<UInt16>::max())
+		{
+			NazaraErrorFmt("shard count exceeds maximum shard count ({0})", std::numeric_limits<UInt16>::max());
+			return false;
+		}
+
+		if (shardCount > 1 && listenAddress.GetPort() == 0)
+		{
+			NazaraError("multiple shards cannot listen on a random port");
+			return false;
+		}
+
+		m_shards.reserve(shardCount);
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			auto& shard = m_shards.emplace_back(std::make_unique<Shard>());
+			shard->shardIndex = i;
+			shard->host.EnableReusePort(shardCount > 1);
+
+			if (!shard->host.Create(listenAddress, peerCountPerShard, channelCount, incomingBandwidth, outgoingBandwidth))
+			{
+				NazaraErrorFmt("failed to create shard #{0}", i);
+				m_shards.clear();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Stops the shards and destroys their hosts
+	*/
+	void ENetShardedHost::Destroy()
+	{
+		Stop();
+		m_shards.clear();
+	}
+
+	/*!
+	* \brief Disconnects a peer
+	*
+	* \param token Token of the peer
+	* \param data Data to send to the peer along the disconnection
+	*
+	* \remark This can be called from any thread, stale tokens are ignored
+	*/
+	void ENetShardedHost::Disconnect(const PeerToken& token, UInt32 data)
+	{
+		NazaraAssert(token.shardIndex < m_shards.size(), "Invalid shard index");
+
+		Command command;
+		command.type = Command::Type::Disconnect;
+		command.token = token;
+		command.data = data;
+
+		m_shards[token.shardIndex]->commands.enqueue(std::move(command));
+	}
+
+	/*!
+	* \brief Gets the host of a shard
+	* \return Shard host
+	*
+	* \param shardIndex Index of the shard
+	*
+	* \remark While shards are running, hosts must only be used from the event handler of their own shard
+	*/
+	ENetHost& ENetShardedHost::GetShardHost(std::size_t shardIndex)
+	{
+		NazaraAssert(shardIndex < m_shards.size(), "Invalid shard index");
+		return m_shards[shardIndex]->host;
+	}
+
+	/*!
+	* \brief Gets the number of packets received by all shards
+	* \return Total received packets, updated by each shard after servicing its host
+	*/
+	UInt32 ENetShardedHost::GetTotalReceivedPackets() const
+	{
+		UInt32 total = 0;
+		for (const auto& shard : m_shards)
+			total += shard->totalReceivedPackets.load(std::memory_order_relaxed);
+
+		return total;
+	}
+
+	/*!
+	* \brief Gets the number of bytes received by all shards
+	* \return Total received data, updated by each shard after servicing its host
+	*/
+	UInt64 ENetShardedHost::GetTotalReceivedData() const
+	{
+		UInt64 total = 0;
+		for (const auto& shard : m_shards)
+			total += shard->totalReceivedData.load(std::memory_order_relaxed);
+
+		return total;
+	}
+
+	/*!
+	* \brief Gets the number of bytes sent by all shards
+	* \return Total sent data, updated by each shard after servicing its host
+	*/
+	UInt64 ENetShardedHost::GetTotalSentData() const
+	{
+		UInt64 total = 0;
+		for (const auto& shard : m_shards)
+			total += shard->totalSentData.load(std::memory_order_relaxed);
+
+		return total;
+	}
+
+	/*!
+	* \brief Gets the number of packets sent by all shards
+	* \return Total sent packets, updated by each shard after servicing its host
+	*/
+	UInt32 ENetShardedHost::GetTotalSentPackets() const
+	{
+		UInt32 total = 0;
+		for (const auto& shard : m_shards)
+			total += shard->totalSentPackets.load(std::memory_order_relaxed);
+
+		return total;
+	}
+
+	/*!
+	* \brief Sends a packet to a peer
+	*
+	* \param token Token of the peer
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet payload
+	*
+	* \remark This can be called from any thread, packets sent to stale tokens are dropped
+	*/
+	void ENetShardedHost::Send(const PeerToken& token, UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	{
+		NazaraAssert(token.shardIndex < m_shards.size(), "Invalid shard index");
+
+		Command command;
+		command.type = Command::Type::Send;
+		command.token = token;
+		command.channelId = channelId;
+		command.flags = flags;
+		command.packet = std::move(packet);
+
+		m_shards[token.shardIndex]->commands.enqueue(std::move(command));
+	}
+
+	/*!
+	* \brief Starts servicing every shard on its own thread
+	*
+	* \param eventHandler Callback receiving the events of every shard, called concurrently from the shard threads
+	*/
+	void ENetShardedHost::Start(EventHandler eventHandler)
+	{
+		NazaraAssert(!m_shards.empty(), "Host hasn't been created");
+		NazaraAssert(!m_isRunning, "Host is already running");
+
+		m_eventHandler = std::move(eventHandler);
+
+		for (auto& shardPtr : m_shards)
+		{
+			Shard& shard = *shardPtr;
+			shard.running = true;
+			shard.thread = std::thread([this, &shard]
+			{
+				SetCurrentThreadName(fmt::format("NzENetShard #{0}", shard.shardIndex).c_str());
+				RunShard(shard);
+			});
+		}
+
+		m_isRunning = true;
+	}
+
+	/*!
+	* \brief Stops servicing the shards and waits for their threads to exit
+	*
+	* Hosts and their peers are left as is, commands which weren't processed yet are kept until shards are restarted.
+	*/
+	void ENetShardedHost::Stop()
+	{
+		if (!m_isRunning)
+			return;
+
+		for (auto& shard : m_shards)
+			shard->running = false;
+
+		for (auto& shard : m_shards)
+			shard->thread.join();
+
+		m_isRunning = false;
+	}
+
+	void ENetShardedHost::RunShard(Shard& shard)
+	{
+		ENetHost& host = shard.host;
+
+		auto GetPeer = [&](const PeerToken& token) -> ENetPeer*
+		{
+			// Peer slots are reused, the connect id tells us if the token still refers to the same connection
+			if (token.peerId >= host.m_peers.size())
+				return nullptr;
+
+			ENetPeer& peer = host.m_peers[token.peerId];
+			if (!peer.IsConnected() || peer.GetConnectId() != token.connectId)
+				return nullptr;
+
+			return &peer;
+		};
+
+		Command command;
+		while (shard.running.load(std::memory_order_relaxed))
+		{
+			while (shard.commands.try_dequeue(command))
+			{
+				switch (command.type)
+				{
+					case Command::Type::Broadcast:
+						host.Broadcast(command.channelId, command.flags, std::move(command.packet));
+						break;
+
+					case Command::Type::Disconnect:
+						if (ENetPeer* peer = GetPeer(command.token))
+							peer->Disconnect(command.data);
+						break;
+
+					case Command::Type::Send:
+						if (ENetPeer* peer = GetPeer(command.token))
+							peer->Send(command.channelId, command.flags, std::move(command.packet));
+						break;
+				}
+			}
+
+			ENetEvent event;
+			int result = host.Service(&event, m_serviceTimeout);
+			while (result > 0)
+			{
+				if (m_eventHandler)
+					m_eventHandler(shard.shardIndex, host, event);
+
+				result = host.Service(&event, 0);
+			}
+
+			shard.totalReceivedPackets.store(host.GetTotalReceivedPackets(), std::memory_order_relaxed);
+			shard.totalReceivedData.store(host.GetTotalReceivedData(), std::memory_order_relaxed);
+			shard.totalSentData.store(host.GetTotalSentData(), std::memory_order_relaxed);
+			shard.totalSentPackets.store(host.GetTotalSentPackets(), std::memory_order_relaxed);
+		}
+	}
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/EntitySnapshot.hpp>
+#include <algorithm>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::EntitySnapshot
+	* \brief Quantized state of a set of entities at a given tick
+	*
+	* Entities are sorted by network id, each one storing the mask of its replicated components and the quantized words of their fields (in schema order).
+	* Snapshots are immutable once captured or decoded, allowing them to be shared between the encoders of several clients.
+	*
+	* \see EntitySnapshotSchema
+	*/
+
+	/*!
+	* \brief Finds an entity by its network id
+	* \return Entity, or nullptr if it's not part of the snapshot
+	*
+	* \param networkId Network id of the entity
+	*/
+	auto EntitySnapshot::FindEntity(UInt32 networkId) const -> const Entity*
+	{
+		auto it = std::lower_bound(m_entities.begin(), m_entities.end(), networkId, [](const Entity& entity, UInt32 id) { return entity.networkId < id; });
+		if (it == m_entities.end() || it->networkId != networkId)
+			return nullptr;
+
+		return &*it;
+	}
+}
@@ -0,0 +1,451 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/EntitySnapshotDecoder.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Network/EntitySnapshotEncoder.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		bool ReadVarUInt(SerializationContext& context, UInt32* value)
+		{
+			UInt64 prefix;
+			if (!UnserializeBits(context, &prefix, 1))
+				return false;
+
+			unsigned int bitCount = 4;
+			if (prefix != 0)
+			{
+				if (!UnserializeBits(context, &prefix, 1))
+					return false;
+
+				bitCount = (prefix != 0) ? 32 : 10;
+			}
+
+			UInt64 result;
+			if (!UnserializeBits(context, &result, bitCount))
+				return false;
+
+			*value = static_cast<UInt32>(result);
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::EntitySnapshotDecoder
+	* \brief Rebuilds entity snapshots sent by an EntitySnapshotEncoder and applies them to a registry
+	*
+	* Decoded snapshots are kept so the next ones can be decoded against them, the client having to acknowledge their tick to the server.
+	* Snapshots older than the baseline of a decoded snapshot are dropped, as the encoder no longer uses them.
+	*
+	* \see EntitySnapshotEncoder
+	*/
+
+	/*!
+	* \brief Constructs a decoder
+	*
+	* \param schema Schema used by the server, components must have been added in the same order
+	* \param maxSnapshotHistory Maximum number of decoded snapshots to keep as possible baselines
+	*/
+	EntitySnapshotDecoder::EntitySnapshotDecoder(std::shared_ptr<const EntitySnapshotSchema> schema, std::size_t maxSnapshotHistory) :
+	m_schema(std::move(schema)),
+	m_maxSnapshotHistory(maxSnapshotHistory)
+	{
+		NazaraAssert(m_schema, "invalid schema");
+		NazaraAssert(m_maxSnapshotHistory > 0, "at least one snapshot must be kept");
+	}
+
+	/*!
+	* \brief Updates a registry to match a snapshot
+	*
+	* Entities are created for network ids which weren't applied before, and destroyed when they are no longer part of the snapshot.
+	* Replicated components are added, updated or removed, other components are left untouched.
+	*
+	* \param registry Registry to update, which must be the same for every call (until Reset is called)
+	* \param snapshot Snapshot to apply, usually the last decoded one
+	*/
+	void EntitySnapshotDecoder::Apply(entt::registry& registry, const EntitySnapshot& snapshot)
+	{
+		for (auto it = m_entities.begin(); it != m_entities.end();)
+		{
+			if (!snapshot.FindEntity(it->first))
+			{
+				if (registry.valid(it->second.entity))
+					registry.destroy(it->second.entity);
+
+				it = m_entities.erase(it);
+			}
+			else
+				++it;
+		}
+
+		std::size_t componentCount = m_schema->GetComponentCount();
+		for (std::size_t i = 0; i < snapshot.GetEntityCount(); ++i)
+		{
+			const EntitySnapshot::Entity& snapshotEntity = snapshot.GetEntity(i);
+
+			ReplicatedEntity& replicatedEntity = m_entities[snapshotEntity.networkId];
+			if (!registry.valid(replicatedEntity.entity))
+			{
+				replicatedEntity.entity = registry.create();
+				replicatedEntity.componentMask = 0;
+			}
+
+			const UInt32* words = snapshot.GetWords(snapshotEntity);
+			for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+			{
+				UInt32 componentBit = UInt32(1) << componentIndex;
+				if (snapshotEntity.componentMask & componentBit)
+				{
+					m_schema->ApplyComponent(registry, replicatedEntity.entity, componentIndex, words);
+					words += m_schema->GetComponent(componentIndex).wordCount;
+				}
+				else if (replicatedEntity.componentMask & componentBit)
+					m_schema->RemoveComponent(registry, replicatedEntity.entity, componentIndex);
+			}
+
+			replicatedEntity.componentMask = snapshotEntity.componentMask;
+		}
+	}
+
+	/*!
+	* \brief Decodes a snapshot from a packet payload
+	* \return Decoded snapshot, or nullptr if the snapshot was invalid or older than the last decoded one
+	*
+	* \param data Payload
+	* \param size Payload size
+	*/
+	std::shared_ptr<const EntitySnapshot> EntitySnapshotDecoder::Decode(const void* data, std::size_t size)
+	{
+		MemoryView stream(data, size);
+
+		SerializationContext context;
+		context.stream = &stream;
+
+		return Decode(context);
+	}
+
+	/*!
+	* \brief Decodes a snapshot from a serialization context
+	* \return Decoded snapshot, or nullptr if the snapshot was invalid or older than the last decoded one
+	*
+	* Decoding fails if the snapshot refers to a baseline which was dropped, which can happen if the client doesn't acknowledge snapshots for too long.
+	* In this case the client should reset both its decoder and the server-side encoder.
+	*
+	* \param context Context to read the snapshot from
+	*/
+	std::shared_ptr<const EntitySnapshot> EntitySnapshotDecoder::Decode(SerializationContext& context)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		UInt64 tick;
+		UInt64 baselineTick;
+		if (!UnserializeBits(context, &tick, 32) || !UnserializeBits(context, &baselineTick, 32))
+		{
+			NazaraError("failed to read snapshot header");
+			return nullptr;
+		}
+
+		// Snapshots are usually sent unreliably and may arrive out of order
+		if (m_lastSnapshot && tick <= m_lastSnapshot->GetTick())
+			return nullptr;
+
+		const EntitySnapshot* baseline = nullptr;
+		if (baselineTick != EntitySnapshotEncoder::NoBaseline)
+		{
+			auto it = std::find_if(m_snapshots.begin(), m_snapshots.end(), [&](const std::shared_ptr<const EntitySnapshot>& snapshot) { return snapshot->GetTick() == baselineTick; });
+			if (it == m_snapshots.end())
+			{
+				NazaraErrorFmt("snapshot #{0} refers to unknown baseline #{1}", tick, baselineTick);
+				return nullptr;
+			}
+
+			baseline = it->get();
+		}
+
+		UInt32 removedCount;
+		if (!ReadVarUInt(context, &removedCount))
+		{
+			NazaraError("failed to read removed entity count");
+			return nullptr;
+		}
+
+		std::size_t baselineEntityCount = (baseline) ? baseline->GetEntityCount() : 0;
+		if (removedCount > baselineEntityCount)
+		{
+			NazaraErrorFmt("removed entity count ({0}) exceeds baseline entity count ({1})", removedCount, baselineEntityCount);
+			return nullptr;
+		}
+
+		std::vector<UInt32> removedEntities(removedCount);
+		UInt32 previousId = 0;
+		for (UInt32 i = 0; i < removedCount; ++i)
+		{
+			UInt32 gap;
+			if (!ReadVarUInt(context, &gap))
+			{
+				NazaraError("failed to read removed entity");
+				return nullptr;
+			}
+
+			if (i > 0 && gap == 0)
+			{
+				NazaraError("removed entities are not sorted");
+				return nullptr;
+			}
+
+			if (gap > std::numeric_limits<UInt32>::max() - previousId)
+			{
+				NazaraError("removed entity id overflows");
+				return nullptr;
+			}
+
+			removedEntities[i] = previousId + gap;
+			previousId = removedEntities[i];
+		}
+
+		UInt32 updateCount;
+		if (!ReadVarUInt(context, &updateCount))
+		{
+			NazaraError("failed to read entity count");
+			return nullptr;
+		}
+
+		std::shared_ptr<EntitySnapshot> snapshot = std::make_shared<EntitySnapshot>(static_cast<UInt32>(tick));
+
+		// Copies baseline entities which weren't updated nor removed, up to an entity id
+		std::size_t baselineIndex = 0;
+		std::size_t removedIndex = 0;
+		auto CopyBaselineEntities = [&](UInt64 lastNetworkId)
+		{
+			for (; baselineIndex < baselineEntityCount && baseline->GetEntity(baselineIndex).networkId < lastNetworkId; ++baselineIndex)
+			{
+				const EntitySnapshot::Entity& baselineEntity = baseline->GetEntity(baselineIndex);
+				while (removedIndex < removedEntities.size() && removedEntities[removedIndex] < baselineEntity.networkId)
+					removedIndex++;
+
+				if (removedIndex < removedEntities.size() && removedEntities[removedIndex] == baselineEntity.networkId)
+					continue;
+
+				const UInt32* words = baseline->GetWords(baselineEntity);
+				UInt32 firstWord = static_cast<UInt32>(snapshot->m_words.size());
+				snapshot->m_words.insert(snapshot->m_words.end(), words, words + m_schema->GetWordCount(baselineEntity.componentMask));
+				snapshot->m_entities.push_back({ baselineEntity.componentMask, firstWord, baselineEntity.networkId });
+			}
+		};
+
+		std::size_t componentCount = m_schema->GetComponentCount();
+		UInt32 validComponentMask = (componentCount < 32) ? (UInt32(1) << componentCount) - 1 : 0xFFFFFFFF;
+
+		previousId = 0;
+		for (UInt32 i = 0; i < updateCount; ++i)
+		{
+			UInt32 gap;
+			if (!ReadVarUInt(context, &gap))
+			{
+				NazaraError("failed to read entity id");
+				return nullptr;
+			}
+
+			if (i > 0 && gap == 0)
+			{
+				NazaraError("entities are not sorted");
+				return nullptr;
+			}
+
+			if (gap > std::numeric_limits<UInt32>::max() - previousId)
+			{
+				NazaraError("entity id overflows");
+				return nullptr;
+			}
+
+			UInt32 networkId = previousId + gap;
+			previousId = networkId;
+
+			CopyBaselineEntities(networkId);
+
+			const EntitySnapshot::Entity* baselineEntity = nullptr;
+			if (baselineIndex < baselineEntityCount && baseline->GetEntity(baselineIndex).networkId == networkId)
+				baselineEntity = &baseline->GetEntity(baselineIndex++);
+
+			UInt32 firstWord = static_cast<UInt32>(snapshot->m_words.size());
+
+			UInt64 componentMask;
+			if (!baselineEntity)
+			{
+				if (!UnserializeBits(context, &componentMask, static_cast<unsigned int>(componentCount)) || !DecodeComponents(context, static_cast<UInt32>(componentMask), snapshot->m_words))
+				{
+					NazaraErrorFmt("failed to read entity {0}", networkId);
+					return nullptr;
+				}
+
+				if (componentMask & ~UInt64(validComponentMask))
+				{
+					NazaraErrorFmt("entity {0} has unknown components", networkId);
+					return nullptr;
+				}
+
+				snapshot->m_entities.push_back({ static_cast<UInt32>(componentMask), firstWord, networkId });
+				continue;
+			}
+
+			bool maskChanged;
+			if (!Unserialize(context, &maskChanged))
+			{
+				NazaraErrorFmt("failed to read entity {0}", networkId);
+				return nullptr;
+			}
+
+			componentMask = baselineEntity->componentMask;
+			if (maskChanged && !UnserializeBits(context, &componentMask, static_cast<unsigned int>(componentCount)))
+			{
+				NazaraErrorFmt("failed to read entity {0} component mask", networkId);
+				return nullptr;
+			}
+
+			if (componentMask & ~UInt64(validComponentMask))
+			{
+				NazaraErrorFmt("entity {0} has unknown components", networkId);
+				return nullptr;
+			}
+
+			const UInt32* baselineWords = baseline->GetWords(*baselineEntity);
+			for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+			{
+				UInt32 componentBit = UInt32(1) << componentIndex;
+				const auto& component = m_schema->GetComponent(componentIndex);
+
+				bool inSnapshot = (componentMask & componentBit) != 0;
+				bool inBaseline = (baselineEntity->componentMask & componentBit) != 0;
+
+				if (inSnapshot && !inBaseline)
+				{
+					if (!DecodeComponents(context, componentBit, snapshot->m_words))
+					{
+						NazaraErrorFmt("failed to read entity {0} component #{1}", networkId, componentIndex);
+						return nullptr;
+					}
+				}
+				else if (inSnapshot && inBaseline)
+				{
+					bool componentChanged = false;
+					if (!component.fields.empty() && !Unserialize(context, &componentChanged))
+					{
+						NazaraErrorFmt("failed to read entity {0} component #{1}", networkId, componentIndex);
+						return nullptr;
+					}
+
+					if (componentChanged)
+					{
+						const UInt32* baselineFieldWords = baselineWords;
+						for (const auto& field : component.fields)
+						{
+							bool fieldChanged = true;
+							if (component.fields.size() > 1 && !Unserialize(context, &fieldChanged))
+							{
+								NazaraErrorFmt("failed to read entity {0} component #{1}", networkId, componentIndex);
+								return nullptr;
+							}
+
+							for (std::size_t j = 0; j < field.wordCount; ++j)
+							{
+								UInt64 word = baselineFieldWords[j];
+								if (fieldChanged && !UnserializeBits(context, &word, field.wordBitCount))
+								{
+									NazaraErrorFmt("failed to read entity {0} component #{1}", networkId, componentIndex);
+									return nullptr;
+								}
+
+								snapshot->m_words.push_back(static_cast<UInt32>(word));
+							}
+
+							baselineFieldWords += field.wordCount;
+						}
+					}
+					else
+						snapshot->m_words.insert(snapshot->m_words.end(), baselineWords, baselineWords + component.wordCount);
+				}
+
+				if (inBaseline)
+					baselineWords += component.wordCount;
+			}
+
+			snapshot->m_entities.push_back({ static_cast<UInt32>(componentMask), firstWord, networkId });
+		}
+
+		CopyBaselineEntities(UInt64(std::numeric_limits<UInt32>::max()) + 1);
+
+		// The server no longer uses snapshots older than the baseline it just used
+		if (baseline)
+		{
+			while (!m_snapshots.empty() && m_snapshots.front()->GetTick() < baselineTick)
+				m_snapshots.pop_front();
+		}
+
+		m_snapshots.push_back(snapshot);
+		if (m_snapshots.size() > m_maxSnapshotHistory)
+			m_snapshots.pop_front();
+
+		m_lastSnapshot = snapshot;
+
+		return snapshot;
+	}
+
+	/*!
+	* \brief Gets the local entity replicating a network entity
+	* \return Local entity, or entt::null if the network entity wasn't applied
+	*
+	* \param networkId Network id of the entity (its identifier on the server)
+	*/
+	entt::entity EntitySnapshotDecoder::GetEntity(UInt32 networkId) const
+	{
+		auto it = m_entities.find(networkId);
+		if (it == m_entities.end())
+			return entt::null;
+
+		return it->second.entity;
+	}
+
+	/*!
+	* \brief Forgets every snapshot and replicated entity, without touching the registry
+	*/
+	void EntitySnapshotDecoder::Reset()
+	{
+		m_entities.clear();
+		m_lastSnapshot.reset();
+		m_snapshots.clear();
+	}
+
+	bool EntitySnapshotDecoder::DecodeComponents(SerializationContext& context, UInt32 componentMask, std::vector<UInt32>& words)
+	{
+		std::size_t componentCount = m_schema->GetComponentCount();
+		for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+		{
+			if ((componentMask & (UInt32(1) << componentIndex)) == 0)
+				continue;
+
+			for (const auto& field : m_schema->GetComponent(componentIndex).fields)
+			{
+				for (std::size_t i = 0; i < field.wordCount; ++i)
+				{
+					UInt64 word;
+					if (!UnserializeBits(context, &word, field.wordBitCount))
+						return false;
+
+					words.push_back(static_cast<UInt32>(word));
+				}
+			}
+		}
+
+		return true;
+	}
+}
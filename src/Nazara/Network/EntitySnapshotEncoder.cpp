@@ -0,0 +1,301 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/EntitySnapshotEncoder.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Small values (entity id gaps, counts) are prefixed: '0' + 4 bits, '10' + 10 bits or '11' + 32 bits
+		bool WriteVarUInt(SerializationContext& context, UInt32 value)
+		{
+			if (value < (1u << 4))
+				return SerializeBits(context, UInt64(value) << 1, 1 + 4);
+			else if (value < (1u << 10))
+				return SerializeBits(context, 0b01 | (UInt64(value) << 2), 2 + 10);
+			else
+				return SerializeBits(context, 0b11 | (UInt64(value) << 2), 2 + 32);
+		}
+
+		struct EntityUpdate
+		{
+			const EntitySnapshot::Entity* baselineEntity;
+			const EntitySnapshot::Entity* entity;
+		};
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::EntitySnapshotEncoder
+	* \brief Bit-packs entity snapshots for one client, delta-encoding them against the last snapshot it acknowledged
+	*
+	* Every encoded snapshot is kept until the client acknowledges it (or a more recent one), the acknowledged snapshot becoming the baseline of the next ones.
+	* Only entities which changed since the baseline are sent, along with the list of entities which were removed.
+	* For those, only components and fields which changed are sent, each one using a single bit when it didn't.
+	*
+	* Until a snapshot is acknowledged, snapshots are encoded in full, which means they can be sent unreliably: a lost snapshot is implicitly resent by the next ones.
+	*
+	* \see EntitySnapshotDecoder
+	*/
+
+	/*!
+	* \brief Constructs an encoder
+	*
+	* \param schema Schema used to capture snapshots
+	* \param maxPendingSnapshots Maximum number of unacknowledged snapshots to keep, the oldest ones being dropped (and their acknowledgments ignored)
+	*/
+	EntitySnapshotEncoder::EntitySnapshotEncoder(std::shared_ptr<const EntitySnapshotSchema> schema, std::size_t maxPendingSnapshots) :
+	m_schema(std::move(schema)),
+	m_maxPendingSnapshots(maxPendingSnapshots)
+	{
+		NazaraAssert(m_schema, "invalid schema");
+		NazaraAssert(m_maxPendingSnapshots > 0, "at least one snapshot must be kept");
+	}
+
+	/*!
+	* \brief Acknowledges the reception of a snapshot by the client, making it the baseline of the next snapshots
+	* \return true if the snapshot is the new baseline, false if it was unknown or older than the current baseline
+	*
+	* \param tick Tick of the snapshot received by the client
+	*/
+	bool EntitySnapshotEncoder::Acknowledge(UInt32 tick)
+	{
+		auto it = std::find_if(m_pendingSnapshots.begin(), m_pendingSnapshots.end(), [&](const std::shared_ptr<const EntitySnapshot>& snapshot) { return snapshot->GetTick() == tick; });
+		if (it == m_pendingSnapshots.end())
+			return false;
+
+		m_baseline = std::move(*it);
+		m_pendingSnapshots.erase(m_pendingSnapshots.begin(), std::next(it));
+
+		return true;
+	}
+
+	/*!
+	* \brief Encodes a snapshot into a new buffer
+	* \return Encoded snapshot, which can be sent as a packet payload
+	*
+	* \param snapshot Snapshot to encode, its tick must be greater than the tick of the previously encoded snapshots
+	*/
+	ByteArray EntitySnapshotEncoder::Encode(std::shared_ptr<const EntitySnapshot> snapshot)
+	{
+		ByteArray data;
+		MemoryStream stream(&data, OpenMode::Write);
+
+		SerializationContext context;
+		context.stream = &stream;
+
+		if (!Encode(context, std::move(snapshot)))
+			return {};
+
+		return data;
+	}
+
+	/*!
+	* \brief Encodes a snapshot into a serialization context
+	* \return true if the snapshot was successfully written
+	*
+	* \param context Context to write the snapshot to, bits are flushed once the snapshot is written
+	* \param snapshot Snapshot to encode, its tick must be greater than the tick of the previously encoded snapshots
+	*/
+	bool EntitySnapshotEncoder::Encode(SerializationContext& context, std::shared_ptr<const EntitySnapshot> snapshot)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(snapshot, "invalid snapshot");
+		NazaraAssert(snapshot->GetTick() != NoBaseline, "invalid snapshot tick");
+		NazaraAssert(m_pendingSnapshots.empty() || m_pendingSnapshots.back()->GetTick() < snapshot->GetTick(), "snapshot tick must increase");
+
+		const EntitySnapshot* baseline = m_baseline.get();
+		std::size_t componentCount = m_schema->GetComponentCount();
+
+		if (!SerializeBits(context, snapshot->GetTick(), 32))
+			return false;
+
+		if (!SerializeBits(context, (baseline) ? baseline->GetTick() : NoBaseline, 32))
+			return false;
+
+		// Find removed, added and updated entities (both lists are sorted by network id)
+		std::vector<UInt32> removedEntities;
+		std::vector<EntityUpdate> entityUpdates;
+
+		std::size_t baselineIndex = 0;
+		std::size_t baselineEntityCount = (baseline) ? baseline->GetEntityCount() : 0;
+		for (std::size_t i = 0; i < snapshot->GetEntityCount(); ++i)
+		{
+			const EntitySnapshot::Entity& entity = snapshot->GetEntity(i);
+			for (; baselineIndex < baselineEntityCount && baseline->GetEntity(baselineIndex).networkId < entity.networkId; ++baselineIndex)
+				removedEntities.push_back(baseline->GetEntity(baselineIndex).networkId);
+
+			if (baselineIndex < baselineEntityCount && baseline->GetEntity(baselineIndex).networkId == entity.networkId)
+			{
+				const EntitySnapshot::Entity& baselineEntity = baseline->GetEntity(baselineIndex++);
+				if (baselineEntity.componentMask == entity.componentMask)
+				{
+					std::size_t wordCount = m_schema->GetWordCount(entity.componentMask);
+					if (std::memcmp(baseline->GetWords(baselineEntity), snapshot->GetWords(entity), wordCount * sizeof(UInt32)) == 0)
+						continue;
+				}
+
+				entityUpdates.push_back({ &baselineEntity, &entity });
+			}
+			else
+				entityUpdates.push_back({ nullptr, &entity });
+		}
+
+		for (; baselineIndex < baselineEntityCount; ++baselineIndex)
+			removedEntities.push_back(baseline->GetEntity(baselineIndex).networkId);
+
+		// Entity ids are sent as the gap from the previous one
+		if (!WriteVarUInt(context, SafeCast<UInt32>(removedEntities.size())))
+			return false;
+
+		UInt32 previousId = 0;
+		for (UInt32 networkId : removedEntities)
+		{
+			if (!WriteVarUInt(context, networkId - previousId))
+				return false;
+
+			previousId = networkId;
+		}
+
+		if (!WriteVarUInt(context, SafeCast<UInt32>(entityUpdates.size())))
+			return false;
+
+		previousId = 0;
+		for (const EntityUpdate& update : entityUpdates)
+		{
+			const EntitySnapshot::Entity& entity = *update.entity;
+			if (!WriteVarUInt(context, entity.networkId - previousId))
+				return false;
+
+			previousId = entity.networkId;
+
+			const UInt32* words = snapshot->GetWords(entity);
+			if (!update.baselineEntity)
+			{
+				// New entity (the decoder knows it from the baseline), send everything
+				if (!SerializeBits(context, entity.componentMask, static_cast<unsigned int>(componentCount)))
+					return false;
+
+				if (!EncodeComponents(context, entity.componentMask, words))
+					return false;
+
+				continue;
+			}
+
+			const EntitySnapshot::Entity& baselineEntity = *update.baselineEntity;
+			const UInt32* baselineWords = baseline->GetWords(baselineEntity);
+
+			bool maskChanged = (entity.componentMask != baselineEntity.componentMask);
+			if (!Serialize(context, maskChanged))
+				return false;
+
+			if (maskChanged && !SerializeBits(context, entity.componentMask, static_cast<unsigned int>(componentCount)))
+				return false;
+
+			for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+			{
+				UInt32 componentBit = UInt32(1) << componentIndex;
+				const auto& component = m_schema->GetComponent(componentIndex);
+
+				bool inSnapshot = (entity.componentMask & componentBit) != 0;
+				bool inBaseline = (baselineEntity.componentMask & componentBit) != 0;
+
+				if (inSnapshot && !inBaseline)
+				{
+					if (!EncodeComponents(context, componentBit, words))
+						return false;
+				}
+				else if (inSnapshot && inBaseline && !component.fields.empty())
+				{
+					bool componentChanged = std::memcmp(words, baselineWords, component.wordCount * sizeof(UInt32)) != 0;
+					if (!Serialize(context, componentChanged))
+						return false;
+
+					if (componentChanged)
+					{
+						const UInt32* fieldWords = words;
+						const UInt32* baselineFieldWords = baselineWords;
+						for (const auto& field : component.fields)
+						{
+							// A single field necessarily changed
+							bool fieldChanged = true;
+							if (component.fields.size() > 1)
+							{
+								fieldChanged = std::memcmp(fieldWords, baselineFieldWords, field.wordCount * sizeof(UInt32)) != 0;
+								if (!Serialize(context, fieldChanged))
+									return false;
+							}
+
+							if (fieldChanged)
+							{
+								for (std::size_t i = 0; i < field.wordCount; ++i)
+								{
+									if (!SerializeBits(context, fieldWords[i], field.wordBitCount))
+										return false;
+								}
+							}
+
+							fieldWords += field.wordCount;
+							baselineFieldWords += field.wordCount;
+						}
+					}
+				}
+
+				if (inSnapshot)
+					words += component.wordCount;
+
+				if (inBaseline)
+					baselineWords += component.wordCount;
+			}
+		}
+
+		context.FlushBits();
+
+		m_pendingSnapshots.push_back(std::move(snapshot));
+		if (m_pendingSnapshots.size() > m_maxPendingSnapshots)
+			m_pendingSnapshots.pop_front();
+
+		return true;
+	}
+
+	/*!
+	* \brief Forgets every snapshot, the next one being encoded in full
+	*
+	* This should be called when the client state is reset (e.g. after a reconnection)
+	*/
+	void EntitySnapshotEncoder::Reset()
+	{
+		m_baseline.reset();
+		m_pendingSnapshots.clear();
+	}
+
+	bool EntitySnapshotEncoder::EncodeComponents(SerializationContext& context, UInt32 componentMask, const UInt32* words)
+	{
+		std::size_t componentCount = m_schema->GetComponentCount();
+		for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+		{
+			if ((componentMask & (UInt32(1) << componentIndex)) == 0)
+				continue;
+
+			for (const auto& field : m_schema->GetComponent(componentIndex).fields)
+			{
+				for (std::size_t i = 0; i < field.wordCount; ++i)
+				{
+					if (!SerializeBits(context, *words++, field.wordBitCount))
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <algorithm>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::EntitySnapshotSchema
+	* \brief Describes which components of an entt registry are replicated, and how their fields are quantized
+	*
+	* Each field is quantized to one or more integer words of a fixed bit count (e.g. a float in a range, a rotation using the smallest three method).
+	* Snapshots store those words, which are then bit-packed and delta-encoded by EntitySnapshotEncoder.
+	*
+	* Entities are identified over the network by the integral value of their entt identifier (including its version), a recycled identifier is thus seen as a new entity.
+	*
+	* \remark Server and clients must build the same schema, components being identified by the order in which they were added
+	*/
+
+	/*!
+	* \brief Writes quantized values into a component of an entity, creating it if required
+	*
+	* \param registry Registry owning the entity
+	* \param entity Entity to update
+	* \param componentIndex Index of the component in the schema
+	* \param words Quantized values of the component fields, as stored in a snapshot
+	*/
+	void EntitySnapshotSchema::ApplyComponent(entt::registry& registry, entt::entity entity, std::size_t componentIndex, const UInt32* words) const
+	{
+		NazaraAssert(componentIndex < m_components.size(), "component index out of range");
+
+		const Component& component = m_components[componentIndex];
+		void* componentPtr = component.getOrEmplace(registry, entity);
+		for (const Field& field : component.fields)
+		{
+			field.dequantize(words, componentPtr);
+			words += field.wordCount;
+		}
+	}
+
+	/*!
+	* \brief Captures the state of every entity having at least one replicated component
+	* \return Snapshot of the registry
+	*
+	* \param registry Registry to capture
+	* \param tick Tick of the snapshot, which must increase with every capture
+	*/
+	std::shared_ptr<EntitySnapshot> EntitySnapshotSchema::Capture(const entt::registry& registry, UInt32 tick) const
+	{
+		std::vector<entt::entity> entities;
+		for (const Component& component : m_components)
+			component.collectEntities(registry, entities);
+
+		return Capture(registry, tick, entities.data(), entities.size());
+	}
+
+	/*!
+	* \brief Captures the state of a set of entities
+	* \return Snapshot of the entities
+	*
+	* \param registry Registry owning the entities
+	* \param tick Tick of the snapshot, which must increase with every capture
+	* \param entities Entities to capture, in any order (duplicates, invalid entities and entities without replicated components are ignored)
+	* \param entityCount Number of entities
+	*/
+	std::shared_ptr<EntitySnapshot> EntitySnapshotSchema::Capture(const entt::registry& registry, UInt32 tick, const entt::entity* entities, std::size_t entityCount) const
+	{
+		static_assert(sizeof(std::underlying_type_t<entt::entity>) <= sizeof(UInt32), "network ids are 32bits");
+
+		std::vector<UInt32> networkIds;
+		networkIds.reserve(entityCount);
+		for (std::size_t i = 0; i < entityCount; ++i)
+			networkIds.push_back(static_cast<UInt32>(entt::to_integral(entities[i])));
+
+		std::sort(networkIds.begin(), networkIds.end());
+		networkIds.erase(std::unique(networkIds.begin(), networkIds.end()), networkIds.end());
+
+		std::shared_ptr<EntitySnapshot> snapshot = std::make_shared<EntitySnapshot>(tick);
+		snapshot->m_entities.reserve(networkIds.size());
+
+		for (UInt32 networkId : networkIds)
+		{
+			entt::entity entity = static_cast<entt::entity>(networkId);
+			if (!registry.valid(entity))
+				continue;
+
+			UInt32 componentMask = 0;
+			UInt32 firstWord = static_cast<UInt32>(snapshot->m_words.size());
+			for (std::size_t i = 0; i < m_components.size(); ++i)
+			{
+				const Component& component = m_components[i];
+				const void* componentPtr = component.tryGet(registry, entity);
+				if (!componentPtr)
+					continue;
+
+				componentMask |= UInt32(1) << i;
+
+				std::size_t wordOffset = snapshot->m_words.size();
+				snapshot->m_words.resize(wordOffset + component.wordCount);
+
+				UInt32* words = &snapshot->m_words[wordOffset];
+				for (const Field& field : component.fields)
+				{
+					field.quantize(componentPtr, words);
+					words += field.wordCount;
+				}
+			}
+
+			if (componentMask != 0)
+				snapshot->m_entities.push_back({ componentMask, firstWord, networkId });
+		}
+
+		return snapshot;
+	}
+}
@@ -0,0 +1,413 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/Linux/IoUringSocketCompletionQueueImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		int IoUringEnter(int ringFd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, std::size_t argSize)
+		{
+			return static_cast<int>(syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, arg, argSize));
+		}
+
+		int IoUringRegister(int ringFd, unsigned int opcode, const void* arg, unsigned int argCount)
+		{
+			return static_cast<int>(syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount));
+		}
+
+		int IoUringSetup(unsigned int entries, io_uring_params* params)
+		{
+			return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+		}
+
+		// Ring heads and tails are shared with the kernel
+		unsigned int LoadAcquire(const unsigned int* value)
+		{
+			return std::atomic_ref<unsigned int>(*const_cast<unsigned int*>(value)).load(std::memory_order_acquire);
+		}
+
+		void StoreRelease(unsigned int* value, unsigned int newValue)
+		{
+			std::atomic_ref<unsigned int>(*value).store(newValue, std::memory_order_release);
+		}
+	}
+
+	IoUringSocketCompletionQueueImpl::IoUringSocketCompletionQueueImpl(const SocketCompletionQueue::Config& config) :
+	SocketCompletionQueueImpl(config),
+	m_operationPool(config.queueDepth),
+	m_completionEntries(nullptr),
+	m_submissionEntries(nullptr),
+	m_inFlightCount(0),
+	m_completionRing(nullptr),
+	m_submissionRing(nullptr),
+	m_ringFd(-1),
+	m_hasRegisteredBuffers(false)
+	{
+	}
+
+	IoUringSocketCompletionQueueImpl::~IoUringSocketCompletionQueueImpl()
+	{
+		if (m_submissionEntries)
+			munmap(m_submissionEntries, m_submissionEntriesSize);
+
+		if (m_completionRing && m_completionRing != m_submissionRing)
+			munmap(m_completionRing, m_completionRingSize);
+
+		if (m_submissionRing)
+			munmap(m_submissionRing, m_submissionRingSize);
+
+		// Closing the ring cancels in-flight operations
+		if (m_ringFd >= 0)
+			close(m_ringFd);
+	}
+
+	SocketCompletionBackend IoUringSocketCompletionQueueImpl::GetBackend() const
+	{
+		return SocketCompletionBackend::IoUring;
+	}
+
+	std::size_t IoUringSocketCompletionQueueImpl::GetPendingOperationCount() const
+	{
+		return m_inFlightCount + m_queuedOperations.size();
+	}
+
+	bool IoUringSocketCompletionQueueImpl::Initialize(UInt32 queueDepth)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+
+		m_ringFd = IoUringSetup(queueDepth, &params);
+		if (m_ringFd < 0)
+		{
+			NazaraWarningFmt("failed to setup io_uring: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		// Waiting with a timeout requires IORING_ENTER_EXT_ARG (Linux 5.11), which also guarantees every operation we use is supported
+		if ((params.features & IORING_FEAT_EXT_ARG) == 0)
+		{
+			NazaraWarning("io_uring lacks IORING_FEAT_EXT_ARG support (Linux 5.11+ is required)");
+			return false;
+		}
+
+		m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+		m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+		bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMapping)
+		{
+			m_submissionRingSize = std::max(m_submissionRingSize, m_completionRingSize);
+			m_completionRingSize = m_submissionRingSize;
+		}
+
+		void* submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+		if (submissionRing == MAP_FAILED)
+		{
+			NazaraWarningFmt("failed to map io_uring submission ring: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		m_submissionRing = submissionRing;
+
+		if (!singleMapping)
+		{
+			void* completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+			if (completionRing == MAP_FAILED)
+			{
+				NazaraWarningFmt("failed to map io_uring completion ring: {0}", Error::GetLastSystemError());
+				return false;
+			}
+
+			m_completionRing = completionRing;
+		}
+		else
+			m_completionRing = m_submissionRing;
+
+		m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+		void* submissionEntries = mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+		if (submissionEntries == MAP_FAILED)
+		{
+			NazaraWarningFmt("failed to map io_uring submission entries: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		m_submissionEntries = static_cast<io_uring_sqe*>(submissionEntries);
+
+		UInt8* submissionRingPtr = static_cast<UInt8*>(m_submissionRing);
+		m_submissionArray = reinterpret_cast<unsigned int*>(submissionRingPtr + params.sq_off.array);
+		m_submissionHead = reinterpret_cast<unsigned int*>(submissionRingPtr + params.sq_off.head);
+		m_submissionTail = reinterpret_cast<unsigned int*>(submissionRingPtr + params.sq_off.tail);
+		m_submissionMask = *reinterpret_cast<unsigned int*>(submissionRingPtr + params.sq_off.ring_mask);
+		m_submissionEntryCount = *reinterpret_cast<unsigned int*>(submissionRingPtr + params.sq_off.ring_entries);
+
+		UInt8* completionRingPtr = static_cast<UInt8*>(m_completionRing);
+		m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRingPtr + params.cq_off.cqes);
+		m_completionHead = reinterpret_cast<unsigned int*>(completionRingPtr + params.cq_off.head);
+		m_completionTail = reinterpret_cast<unsigned int*>(completionRingPtr + params.cq_off.tail);
+		m_completionMask = *reinterpret_cast<unsigned int*>(completionRingPtr + params.cq_off.ring_mask);
+		m_completionEntryCount = *reinterpret_cast<unsigned int*>(completionRingPtr + params.cq_off.ring_entries);
+
+		// Register the buffer pool once so the kernel doesn't have to map pages for each receive operation,
+		// this may fail because of RLIMIT_MEMLOCK in which case pooled buffers are used as regular buffers
+		if (!m_bufferStorage.empty())
+		{
+			iovec poolVector;
+			poolVector.iov_base = m_bufferStorage.data();
+			poolVector.iov_len = m_bufferStorage.size();
+
+			m_hasRegisteredBuffers = (IoUringRegister(m_ringFd, IORING_REGISTER_BUFFERS, &poolVector, 1) == 0);
+		}
+
+		return true;
+	}
+
+	void IoUringSocketCompletionQueueImpl::Submit(const Operation& operation)
+	{
+		// Operations are only pushed to the submission queue on Wait, to submit them in a single syscall
+		std::size_t poolIndex;
+		PendingOperation* pendingOperation = m_operationPool.Allocate(poolIndex);
+		pendingOperation->operation = operation;
+		pendingOperation->poolIndex = poolIndex;
+
+		m_queuedOperations.push_back(poolIndex);
+	}
+
+	unsigned int IoUringSocketCompletionQueueImpl::Wait(int msTimeout, SocketError* error)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		ClearCompletions();
+		FillSubmissionQueue();
+
+		if (m_inFlightCount == 0)
+		{
+			if (error)
+				*error = SocketError::NoError;
+
+			return 0;
+		}
+
+		unsigned int toSubmit = *m_submissionTail - LoadAcquire(m_submissionHead);
+		bool hasCompletions = (LoadAcquire(m_completionTail) != *m_completionHead);
+		bool shouldWait = (!hasCompletions && msTimeout != 0);
+
+		if (toSubmit > 0 || shouldWait)
+		{
+			__kernel_timespec timeout;
+			io_uring_getevents_arg waitArgs;
+			std::memset(&waitArgs, 0, sizeof(waitArgs));
+
+			unsigned int flags = 0;
+			if (shouldWait)
+			{
+				flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+				if (msTimeout > 0)
+				{
+					timeout.tv_sec = msTimeout / 1000;
+					timeout.tv_nsec = (msTimeout % 1000) * 1'000'000LL;
+					waitArgs.ts = reinterpret_cast<UInt64>(&timeout);
+				}
+			}
+
+			if (IoUringEnter(m_ringFd, toSubmit, (shouldWait) ? 1 : 0, flags, (shouldWait) ? &waitArgs : nullptr, (shouldWait) ? sizeof(waitArgs) : 0) < 0)
+			{
+				int errorCode = errno;
+				if (errorCode == EINTR)
+				{
+					if (error)
+						*error = SocketError::Interrupted;
+
+					return 0;
+				}
+
+				// ETIME means the wait timed out
+				if (errorCode != ETIME)
+				{
+					if (error)
+						*error = SocketImpl::TranslateErrorToSocketError(errorCode);
+
+					return 0;
+				}
+			}
+		}
+
+		unsigned int completionCount = ReapCompletions();
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return completionCount;
+	}
+
+	void IoUringSocketCompletionQueueImpl::FillSubmissionQueue()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		unsigned int tail = *m_submissionTail; //< only written by us
+		unsigned int head = LoadAcquire(m_submissionHead);
+
+		// Never have more operations in flight than the completion queue can hold
+		while (!m_queuedOperations.empty() && tail - head < m_submissionEntryCount && m_inFlightCount < m_completionEntryCount)
+		{
+			PendingOperation& pendingOperation = *m_operationPool.RetrieveFromIndex(m_queuedOperations.front());
+			m_queuedOperations.pop_front();
+
+			unsigned int entryIndex = tail & m_submissionMask;
+			PrepareEntry(m_submissionEntries[entryIndex], pendingOperation);
+			m_submissionArray[entryIndex] = entryIndex;
+
+			tail++;
+			m_inFlightCount++;
+		}
+
+		StoreRelease(m_submissionTail, tail);
+	}
+
+	void IoUringSocketCompletionQueueImpl::PrepareEntry(io_uring_sqe& entry, PendingOperation& pendingOperation)
+	{
+		const Operation& operation = pendingOperation.operation;
+
+		std::memset(&entry, 0, sizeof(entry));
+		entry.fd = operation.handle;
+		entry.user_data = pendingOperation.poolIndex;
+
+		auto PrepareMessage = [&](socklen_t addressLength)
+		{
+			pendingOperation.ioVector.iov_base = operation.buffer;
+			pendingOperation.ioVector.iov_len = operation.size;
+
+			std::memset(&pendingOperation.message, 0, sizeof(pendingOperation.message));
+			pendingOperation.message.msg_name = pendingOperation.addressBuffer.data();
+			pendingOperation.message.msg_namelen = addressLength;
+			pendingOperation.message.msg_iov = &pendingOperation.ioVector;
+			pendingOperation.message.msg_iovlen = 1;
+
+			entry.addr = reinterpret_cast<UInt64>(&pendingOperation.message);
+			entry.len = 1;
+		};
+
+		switch (operation.type)
+		{
+			case SocketOperation::Accept:
+				pendingOperation.addressBuffer.fill(0);
+				pendingOperation.addressLength = static_cast<socklen_t>(pendingOperation.addressBuffer.size());
+
+				entry.opcode = IORING_OP_ACCEPT;
+				entry.addr = reinterpret_cast<UInt64>(pendingOperation.addressBuffer.data());
+				entry.addr2 = reinterpret_cast<UInt64>(&pendingOperation.addressLength);
+				break;
+
+			case SocketOperation::Receive:
+				// Reads on registered buffers honor O_NONBLOCK instead of waiting for data, only use them on blocking sockets
+				if (operation.bufferIndex != SocketCompletionQueue::InvalidBufferIndex && m_hasRegisteredBuffers && operation.isBlocking)
+				{
+					entry.opcode = IORING_OP_READ_FIXED;
+					entry.buf_index = 0; //< the whole pool is registered as a single buffer
+				}
+				else
+					entry.opcode = IORING_OP_RECV;
+
+				entry.addr = reinterpret_cast<UInt64>(operation.buffer);
+				entry.len = SafeCast<UInt32>(operation.size);
+				break;
+
+			case SocketOperation::ReceiveFrom:
+				pendingOperation.addressBuffer.fill(0);
+
+				entry.opcode = IORING_OP_RECVMSG;
+				PrepareMessage(static_cast<socklen_t>(pendingOperation.addressBuffer.size()));
+				break;
+
+			case SocketOperation::Send:
+				entry.opcode = IORING_OP_SEND;
+				entry.addr = reinterpret_cast<UInt64>(operation.buffer);
+				entry.len = SafeCast<UInt32>(operation.size);
+				entry.msg_flags = MSG_NOSIGNAL;
+				break;
+
+			case SocketOperation::SendTo:
+				entry.opcode = IORING_OP_SENDMSG;
+				entry.msg_flags = MSG_NOSIGNAL;
+				PrepareMessage(IpAddressImpl::ToSockAddr(operation.address, pendingOperation.addressBuffer.data()));
+				break;
+		}
+	}
+
+	unsigned int IoUringSocketCompletionQueueImpl::ReapCompletions()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		unsigned int head = *m_completionHead; //< only written by us
+		unsigned int tail = LoadAcquire(m_completionTail);
+
+		for (; head != tail; ++head)
+		{
+			const io_uring_cqe& completionEntry = m_completionEntries[head & m_completionMask];
+
+			std::size_t poolIndex = SafeCast<std::size_t>(completionEntry.user_data);
+			int result = completionEntry.res;
+
+			m_inFlightCount--;
+
+			// Older kernels may report non-blocking sockets as not ready instead of waiting for them, retry on next wait
+			if (result == -EAGAIN)
+			{
+				m_queuedOperations.push_back(poolIndex);
+				continue;
+			}
+
+			PendingOperation& pendingOperation = *m_operationPool.RetrieveFromIndex(poolIndex);
+			const Operation& operation = pendingOperation.operation;
+
+			if (result < 0)
+				PushCompletion(operation, SocketImpl::TranslateErrorToSocketError(-result), 0);
+			else
+			{
+				switch (operation.type)
+				{
+					case SocketOperation::Accept:
+						PushAcceptCompletion(operation, result, IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(pendingOperation.addressBuffer.data())));
+						break;
+
+					case SocketOperation::Receive:
+						// Receiving zero bytes on a stream means the connection has been closed
+						if (result == 0 && operation.socketType == SocketType::TCP)
+							PushCompletion(operation, SocketError::ConnectionClosed, 0);
+						else
+							PushCompletion(operation, SocketError::NoError, SafeCast<std::size_t>(result));
+						break;
+
+					case SocketOperation::ReceiveFrom:
+						PushCompletion(operation, SocketError::NoError, SafeCast<std::size_t>(result), IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(pendingOperation.addressBuffer.data())));
+						break;
+
+					case SocketOperation::Send:
+					case SocketOperation::SendTo:
+						PushCompletion(operation, SocketError::NoError, SafeCast<std::size_t>(result));
+						break;
+				}
+			}
+
+			m_operationPool.Free(poolIndex);
+		}
+
+		StoreRelease(m_completionHead, head);
+
+		return SafeCast<unsigned int>(m_completions.size());
+	}
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_LINUX_IOURINGSOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_NETWORK_LINUX_IOURINGSOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/SocketCompletionQueueImpl.hpp>
+#include <Nazara/Network/Posix/IpAddressImpl.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <deque>
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace Nz
+{
+	// Submits operations to the kernel through an io_uring instance (using raw syscalls, without liburing)
+	class IoUringSocketCompletionQueueImpl final : public SocketCompletionQueueImpl
+	{
+		public:
+			IoUringSocketCompletionQueueImpl(const SocketCompletionQueue::Config& config);
+			~IoUringSocketCompletionQueueImpl();
+
+			SocketCompletionBackend GetBackend() const override;
+			std::size_t GetPendingOperationCount() const override;
+
+			bool Initialize(UInt32 queueDepth);
+
+			void Submit(const Operation& operation) override;
+
+			unsigned int Wait(int msTimeout, SocketError* error) override;
+
+		private:
+			struct PendingOperation
+			{
+				Operation operation;
+				IpAddressImpl::SockAddrBuffer addressBuffer;
+				iovec ioVector;
+				msghdr message;
+				socklen_t addressLength;
+				std::size_t poolIndex;
+			};
+
+			void FillSubmissionQueue();
+			void PrepareEntry(io_uring_sqe& entry, PendingOperation& pendingOperation);
+			unsigned int ReapCompletions();
+
+			std::deque<std::size_t> m_queuedOperations; //< operations waiting for room in the submission queue
+			MemoryPool<PendingOperation> m_operationPool; //< stable addresses, the kernel reads addresses and messages until completion
+			io_uring_cqe* m_completionEntries;
+			io_uring_sqe* m_submissionEntries;
+			std::size_t m_completionRingSize;
+			std::size_t m_inFlightCount;
+			std::size_t m_submissionEntriesSize;
+			std::size_t m_submissionRingSize;
+			unsigned int* m_completionHead;
+			unsigned int* m_completionTail;
+			unsigned int* m_submissionArray;
+			unsigned int* m_submissionHead;
+			unsigned int* m_submissionTail;
+			unsigned int m_completionEntryCount;
+			unsigned int m_completionMask;
+			unsigned int m_submissionEntryCount;
+			unsigned int m_submissionMask;
+			void* m_completionRing;
+			void* m_submissionRing;
+			int m_ringFd;
+			bool m_hasRegisteredBuffers;
+	};
+}
+
+#endif // NAZARA_NETWORK_LINUX_IOURINGSOCKETCOMPLETIONQUEUEIMPL_HPP
@@ -11,9 +11,13 @@
 
 namespace Nz
 {
-	SocketPollerImpl::SocketPollerImpl()
+	SocketPollerImpl::SocketPollerImpl() :
+	m_waitIndex(0)
 	{
 		m_handle = epoll_create1(0);
+
+		m_events.resize(SocketPoller::DefaultEventCapacity);
+		m_readyEvents.reserve(SocketPoller::DefaultEventCapacity);
 	}
 
 	SocketPollerImpl::~SocketPollerImpl()
@@ -23,49 +27,92 @@ namespace Nz
 
 	void SocketPollerImpl::Clear()
 	{
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
+		// Recreating the epoll instance is cheaper than removing every socket from it
+		close(m_handle);
+		m_handle = epoll_create1(0);
+
+		m_readyEvents.clear();
 		m_sockets.clear();
 	}
 
+	std::size_t SocketPollerImpl::GetEventCapacity() const
+	{
+		return m_events.size();
+	}
+
+	std::span<const SocketPoller::ReadyEvent> SocketPollerImpl::GetReadyEvents() const
+	{
+		return m_readyEvents;
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		return m_readyToReadSockets.count(socket) != 0;
+		auto it = m_sockets.find(socket);
+		if (it == m_sockets.end())
+			return false;
+
+		const Registration& registration = it->second;
+		return registration.waitIndex == m_waitIndex && (registration.readyEvents & SocketPollEvent::Read);
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		return m_readyToWriteSockets.count(socket) != 0;
+		auto it = m_sockets.find(socket);
+		if (it == m_sockets.end())
+			return false;
+
+		const Registration& registration = it->second;
+		return registration.waitIndex == m_waitIndex && (registration.readyEvents & SocketPollEvent::Write);
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
 	{
-		return m_sockets.count(socket) != 0;
+		return m_sockets.find(socket) != m_sockets.end();
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags)
 	{
-		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
+		auto it = m_sockets.find(socket);
+		NazaraAssert(it != m_sockets.end(), "Socket is not registered");
+
+		Registration& registration = it->second;
 
 		epoll_event entry;
 		std::memset(&entry, 0, sizeof(epoll_event));
 
-		entry.data.fd = socket;
+		entry.data.ptr = &registration;
+		entry.events = BuildEpollEvents(eventFlags, registration.pollMode);
 
-		if (eventFlags & SocketPollEvent::Read)
-			entry.events |= EPOLLIN;
+		if (epoll_ctl(m_handle, EPOLL_CTL_MOD, socket, &entry) != 0)
+		{
+			NazaraErrorFmt("failed to modify socket in epoll structure (errno {0}: {1})", errno, Error::GetLastSystemError());
+			return false;
+		}
 
-		if (eventFlags & SocketPollEvent::Write)
-			entry.events |= EPOLLOUT;
+		return true;
+	}
+
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode pollMode)
+	{
+		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
+
+		Registration& registration = m_sockets[socket];
+		registration.pollMode = pollMode;
+		registration.userdata = userdata;
+
+		epoll_event entry;
+		std::memset(&entry, 0, sizeof(epoll_event));
+
+		entry.data.ptr = &registration;
+		entry.events = BuildEpollEvents(eventFlags, pollMode);
 
 		if (epoll_ctl(m_handle, EPOLL_CTL_ADD, socket, &entry) != 0)
 		{
 			NazaraErrorFmt("failed to add socket to epoll structure (errno {0}: {1})", errno, Error::GetLastSystemError());
+			m_sockets.erase(socket);
 			return false;
 		}
 
-		m_sockets.insert(socket);
-
 		return true;
 	}
 
@@ -73,24 +120,26 @@ namespace Nz
 	{
 		NazaraAssert(IsRegistered(socket), "Socket is not registered");
 
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
 		m_sockets.erase(socket);
 
 		if (epoll_ctl(m_handle, EPOLL_CTL_DEL, socket, nullptr) != 0)
 			NazaraWarningFmt("an error occured while removing socket from epoll structure (errno {0}: {1})", errno, Error::GetLastSystemError());
 	}
 
-	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
+	void SocketPollerImpl::SetEventCapacity(std::size_t eventCapacity)
 	{
-		int activeSockets;
+		m_events.resize(eventCapacity);
+		m_events.shrink_to_fit();
 
-		// Reset status of sockets
-		m_events.resize(m_sockets.size());
-		std::memset(m_events.data(), 0, m_events.size() * sizeof(epoll_event));
+		m_readyEvents.reserve(eventCapacity);
+	}
+
+	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
+	{
+		m_readyEvents.clear();
 
-		activeSockets = epoll_wait(m_handle, m_events.data(), static_cast<int>(m_events.size()), static_cast<int>(msTimeout));
-		if (activeSockets == -1)
+		int eventCount = epoll_wait(m_handle, m_events.data(), static_cast<int>(m_events.size()), static_cast<int>(msTimeout));
+		if (eventCount == -1)
 		{
 			if (error)
 				*error = SocketImpl::TranslateErrorToSocketError(errno);
@@ -98,33 +147,53 @@ namespace Nz
 			return 0;
 		}
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
-		if (activeSockets > 0)
+		// Ready states of the previous wait are invalidated by incrementing the wait index
+		m_waitIndex++;
+
+		for (int i = 0; i < eventCount; ++i)
 		{
-			int socketCount = activeSockets;
-			for (int i = 0; i < socketCount; ++i)
+			UInt32 events = m_events[i].events;
+
+			SocketPollEventFlags readyEvents;
+			if (events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+				readyEvents |= SocketPollEvent::Read;
+
+			if (events & (EPOLLOUT | EPOLLERR))
+				readyEvents |= SocketPollEvent::Write;
+
+			if (!readyEvents)
 			{
-				if (m_events[i].events & (EPOLLIN | EPOLLOUT | EPOLLHUP | EPOLLERR))
-				{
-					if (m_events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
-						m_readyToReadSockets.insert(m_events[i].data.fd);
-
-					if (m_events[i].events & (EPOLLOUT | EPOLLERR))
-						m_readyToWriteSockets.insert(m_events[i].data.fd);
-				}
-				else
-				{
-					// static_cast is required because the field are packed and cannot be taken by reference
-					NazaraWarningFmt("Descriptor {0} was returned by epoll without EPOLLIN nor EPOLLOUT flags (events: {1:#x}", static_cast<int>(m_events[i].data.fd), static_cast<unsigned int>(m_events[i].events));
-					activeSockets--;
-				}
+				NazaraWarningFmt("Descriptor was returned by epoll without EPOLLIN nor EPOLLOUT flags (events: {0:#x})", static_cast<unsigned int>(events));
+				continue;
 			}
+
+			Registration& registration = *static_cast<Registration*>(m_events[i].data.ptr);
+			registration.readyEvents = readyEvents;
+			registration.waitIndex = m_waitIndex;
+
+			auto& readyEvent = m_readyEvents.emplace_back();
+			readyEvent.events = readyEvents;
+			readyEvent.userdata = registration.userdata;
 		}
 
 		if (error)
 			*error = SocketError::NoError;
 
-		return activeSockets;
+		return static_cast<unsigned int>(m_readyEvents.size());
+	}
+
+	UInt32 SocketPollerImpl::BuildEpollEvents(SocketPollEventFlags eventFlags, SocketPollMode pollMode)
+	{
+		UInt32 events = 0;
+		if (eventFlags & SocketPollEvent::Read)
+			events |= EPOLLIN;
+
+		if (eventFlags & SocketPollEvent::Write)
+			events |= EPOLLOUT;
+
+		if (pollMode == SocketPollMode::EdgeTriggered)
+			events |= EPOLLET;
+
+		return events;
 	}
 }
@@ -9,7 +9,9 @@
 
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
-#include <unordered_set>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <span>
+#include <unordered_map>
 #include <vector>
 #include <sys/epoll.h>
 
@@ -23,20 +25,37 @@ namespace Nz
 
 			void Clear();
 
+			std::size_t GetEventCapacity() const;
+			std::span<const SocketPoller::ReadyEvent> GetReadyEvents() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode pollMode);
 			void UnregisterSocket(SocketHandle socket);
 
+			void SetEventCapacity(std::size_t eventCapacity);
+
 			unsigned int Wait(int msTimeout, SocketError* error);
 
 		private:
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
-			std::unordered_set<SocketHandle> m_sockets;
+			struct Registration
+			{
+				void* userdata;
+				SocketPollEventFlags readyEvents;
+				SocketPollMode pollMode;
+				UInt64 waitIndex = 0; //< index of the last Wait call which reported this socket
+			};
+
+			static UInt32 BuildEpollEvents(SocketPollEventFlags eventFlags, SocketPollMode pollMode);
+
+			std::unordered_map<SocketHandle, Registration> m_sockets; //< epoll_event::data.ptr points to registrations (node-based container, pointers are stable)
 			std::vector<epoll_event> m_events;
+			std::vector<SocketPoller::ReadyEvent> m_readyEvents;
+			UInt64 m_waitIndex;
 			int m_handle;
 	};
 }
@@ -59,7 +59,7 @@ namespace Nz
 		SocketImpl::Uninitialize();
 	}
 
-	std::unique_ptr<WebService> Network::InstantiateWebService()
+	std::unique_ptr<WebService> Network::InstantiateWebService(WebServicePollMode pollMode)
 	{
 #ifndef NAZARA_PLATFORM_WEB
 		if (!m_curlLibrary)
@@ -71,9 +71,9 @@ namespace Nz
 			m_curlLibrary = std::move(curlLibrary);
 		}
 
-		return std::make_unique<WebService>(*m_curlLibrary);
+		return std::make_unique<WebService>(*m_curlLibrary, pollMode);
 #else
-		return std::make_unique<WebService>();
+		return std::make_unique<WebService>(pollMode);
 #endif
 	}
 
@@ -0,0 +1,210 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/PollerSocketCompletionQueueImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+#include <Nazara/Network/Win32/SocketImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+#include <Nazara/Network/Posix/SocketImpl.hpp>
+#else
+#error Missing implementation: Socket
+#endif
+
+namespace Nz
+{
+	PollerSocketCompletionQueueImpl::PollerSocketCompletionQueueImpl(const SocketCompletionQueue::Config& config) :
+	SocketCompletionQueueImpl(config),
+	m_pendingOperationCount(0)
+	{
+	}
+
+	SocketCompletionBackend PollerSocketCompletionQueueImpl::GetBackend() const
+	{
+		return SocketCompletionBackend::Poller;
+	}
+
+	std::size_t PollerSocketCompletionQueueImpl::GetPendingOperationCount() const
+	{
+		return m_pendingOperationCount;
+	}
+
+	void PollerSocketCompletionQueueImpl::Submit(const Operation& operation)
+	{
+		PendingSocket& pendingSocket = m_sockets[operation.handle];
+		pendingSocket.handle = operation.handle;
+
+		switch (operation.type)
+		{
+			case SocketOperation::Accept:
+			case SocketOperation::Receive:
+			case SocketOperation::ReceiveFrom:
+				pendingSocket.readOperations.push_back(operation);
+				break;
+
+			case SocketOperation::Send:
+			case SocketOperation::SendTo:
+				pendingSocket.writeOperations.push_back(operation);
+				break;
+		}
+
+		m_pendingOperationCount++;
+
+		UpdateWatchedEvents(pendingSocket);
+	}
+
+	unsigned int PollerSocketCompletionQueueImpl::Wait(int msTimeout, SocketError* error)
+	{
+		ClearCompletions();
+
+		if (m_pendingOperationCount == 0)
+		{
+			if (error)
+				*error = SocketError::NoError;
+
+			return 0;
+		}
+
+		if (m_poller.Wait(msTimeout, error) == 0)
+			return 0;
+
+		for (const SocketPoller::ReadyEvent& readyEvent : m_poller.GetReadyEvents())
+		{
+			PendingSocket& pendingSocket = *static_cast<PendingSocket*>(readyEvent.userdata);
+
+			// Only execute one operation per direction, a second one could block if the socket is in blocking mode
+			if (readyEvent.events & SocketPollEvent::Read)
+				ExecuteFirst(pendingSocket.readOperations);
+
+			if (readyEvent.events & SocketPollEvent::Write)
+				ExecuteFirst(pendingSocket.writeOperations);
+
+			UpdateWatchedEvents(pendingSocket); //< may erase the pending socket
+		}
+
+		return SafeCast<unsigned int>(m_completions.size());
+	}
+
+	bool PollerSocketCompletionQueueImpl::Execute(const Operation& operation)
+	{
+		SocketError error;
+		switch (operation.type)
+		{
+			case SocketOperation::Accept:
+			{
+				IpAddress peerAddress;
+				SocketHandle acceptedHandle = SocketImpl::Accept(operation.handle, &peerAddress, &error);
+				if (acceptedHandle == SocketImpl::InvalidHandle)
+				{
+					PushCompletion(operation, error, 0);
+					return true;
+				}
+
+				PushAcceptCompletion(operation, acceptedHandle, peerAddress);
+				return true;
+			}
+
+			case SocketOperation::Receive:
+			{
+				int read;
+				if (!SocketImpl::Receive(operation.handle, operation.buffer, SafeCast<int>(operation.size), &read, &error))
+				{
+					PushCompletion(operation, error, 0);
+					return true;
+				}
+
+				if (read == 0)
+					return false; //< would block
+
+				PushCompletion(operation, SocketError::NoError, SafeCast<std::size_t>(read));
+				return true;
+			}
+
+			case SocketOperation::ReceiveFrom:
+			{
+				IpAddress from;
+				int read;
+				if (!SocketImpl::ReceiveFrom(operation.handle, operation.buffer, SafeCast<int>(operation.size), &from, &read, &error))
+				{
+					PushCompletion(operation, error, 0);
+					return true;
+				}
+
+				if (read == 0)
+					return false; //< would block
+
+				PushCompletion(operation, SocketError::NoError, SafeCast<std::size_t>(read), from);
+				return true;
+			}
+
+			case SocketOperation::Send:
+			case SocketOperation::SendTo:
+			{
+				int sent;
+				bool succeeded;
+				if (operation.type == SocketOperation::Send)
+					succeeded = SocketImpl::Send(operation.handle, operation.buffer, SafeCast<int>(operation.size), &sent, &error);
+				else
+					succeeded = SocketImpl::SendTo(operation.handle, operation.buffer, SafeCast<int>(operation.size), operation.address, &sent, &error);
+
+				if (!succeeded)
+				{
+					PushCompletion(operation, error, 0);
+					return true;
+				}
+
+				if (sent == 0)
+					return false; //< would block
+
+				PushCompletion(operation, SocketError::NoError, SafeCast<std::size_t>(sent));
+				return true;
+			}
+		}
+
+		NazaraErrorFmt("unhandled socket operation {0:#x}", UnderlyingCast(operation.type));
+		return false;
+	}
+
+	void PollerSocketCompletionQueueImpl::ExecuteFirst(std::deque<Operation>& operations)
+	{
+		if (operations.empty())
+			return;
+
+		if (Execute(operations.front()))
+		{
+			operations.pop_front();
+			m_pendingOperationCount--;
+		}
+	}
+
+	void PollerSocketCompletionQueueImpl::UpdateWatchedEvents(PendingSocket& pendingSocket)
+	{
+		SocketPollEventFlags watchedEvents;
+		if (!pendingSocket.readOperations.empty())
+			watchedEvents |= SocketPollEvent::Read;
+
+		if (!pendingSocket.writeOperations.empty())
+			watchedEvents |= SocketPollEvent::Write;
+
+		if (watchedEvents == pendingSocket.watchedEvents)
+			return;
+
+		if (!watchedEvents)
+		{
+			SocketHandle handle = pendingSocket.handle;
+			m_poller.UnregisterSocket(handle);
+			m_sockets.erase(handle); //< pendingSocket is invalid after this line
+			return;
+		}
+
+		if (pendingSocket.watchedEvents)
+			m_poller.ModifySocket(pendingSocket.handle, watchedEvents);
+		else
+			m_poller.RegisterSocket(pendingSocket.handle, watchedEvents, &pendingSocket, SocketPollMode::LevelTriggered);
+
+		pendingSocket.watchedEvents = watchedEvents;
+	}
+}
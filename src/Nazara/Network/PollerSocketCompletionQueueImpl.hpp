@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_POLLERSOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_NETWORK_POLLERSOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/SocketCompletionQueueImpl.hpp>
+#include <deque>
+#include <unordered_map>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+#include <Nazara/Network/Win32/SocketPollerImpl.hpp>
+#elif defined(NAZARA_PLATFORM_LINUX)
+#include <Nazara/Network/Linux/SocketPollerImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+#include <Nazara/Network/Posix/SocketPollerImpl.hpp>
+#else
+#error Missing implementation: SocketPoller
+#endif
+
+namespace Nz
+{
+	// Emulates completions by executing operations when the socket poller reports their socket as ready
+	class PollerSocketCompletionQueueImpl final : public SocketCompletionQueueImpl
+	{
+		public:
+			PollerSocketCompletionQueueImpl(const SocketCompletionQueue::Config& config);
+			~PollerSocketCompletionQueueImpl() = default;
+
+			SocketCompletionBackend GetBackend() const override;
+			std::size_t GetPendingOperationCount() const override;
+
+			void Submit(const Operation& operation) override;
+
+			unsigned int Wait(int msTimeout, SocketError* error) override;
+
+		private:
+			struct PendingSocket
+			{
+				std::deque<Operation> readOperations;  //< Accept, Receive and ReceiveFrom
+				std::deque<Operation> writeOperations; //< Send and SendTo
+				SocketHandle handle;
+				SocketPollEventFlags watchedEvents;
+			};
+
+			bool Execute(const Operation& operation);
+			void ExecuteFirst(std::deque<Operation>& operations);
+			void UpdateWatchedEvents(PendingSocket& pendingSocket);
+
+			std::unordered_map<SocketHandle, PendingSocket> m_sockets; //< registered to the poller with a pointer to the pending socket (node-based container, pointers are stable)
+			std::size_t m_pendingOperationCount;
+			SocketPollerImpl m_poller;
+	};
+}
+
+#endif // NAZARA_NETWORK_POLLERSOCKETCOMPLETIONQUEUEIMPL_HPP
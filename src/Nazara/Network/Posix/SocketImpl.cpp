@@ -926,6 +926,34 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+
+#ifdef SO_REUSEPORT
+		int option = reusePort;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&option), sizeof(option)) == -1)
+		{
+			if (error)
+				*error = TranslateErrorToSocketError(errno);
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#else
+		NazaraUnused(reusePort);
+
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
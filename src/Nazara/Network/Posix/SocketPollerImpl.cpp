@@ -8,22 +8,49 @@
 
 namespace Nz
 {
+	SocketPollerImpl::SocketPollerImpl() :
+	m_eventCapacity(SocketPoller::DefaultEventCapacity),
+	m_waitIndex(0)
+	{
+		m_readyEvents.reserve(m_eventCapacity);
+	}
+
 	void SocketPollerImpl::Clear()
 	{
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		m_allSockets.clear();
+		m_readyEvents.clear();
+		m_registrations.clear();
 		m_sockets.clear();
 	}
 
+	std::size_t SocketPollerImpl::GetEventCapacity() const
+	{
+		return m_eventCapacity;
+	}
+
+	std::span<const SocketPoller::ReadyEvent> SocketPollerImpl::GetReadyEvents() const
+	{
+		return m_readyEvents;
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		return m_readyToReadSockets.count(socket) != 0;
+		auto it = m_allSockets.find(socket);
+		if (it == m_allSockets.end())
+			return false;
+
+		const Registration& registration = m_registrations[it->second];
+		return registration.waitIndex == m_waitIndex && (registration.readyEvents & SocketPollEvent::Read);
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		return m_readyToWriteSockets.count(socket) != 0;
+		auto it = m_allSockets.find(socket);
+		if (it == m_allSockets.end())
+			return false;
+
+		const Registration& registration = m_registrations[it->second];
+		return registration.waitIndex == m_waitIndex && (registration.readyEvents & SocketPollEvent::Write);
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
@@ -31,25 +58,33 @@ namespace Nz
 		return m_allSockets.count(socket) != 0;
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	{
+		auto it = m_allSockets.find(socket);
+		NazaraAssert(it != m_allSockets.end(), "Socket is not registered");
+
+		m_sockets[it->second].events = BuildPollEvents(eventFlags);
+		return true;
+	}
+
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode /*pollMode*/)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		// poll has no edge-triggered mode, level-triggered mode reports a superset of its events
+
 		PollSocket entry = {
 			socket,
-			0,
+			BuildPollEvents(eventFlags),
 			0
 		};
 
-		if (eventFlags & SocketPollEvent::Read)
-			entry.events |= POLLRDNORM;
-
-		if (eventFlags & SocketPollEvent::Write)
-			entry.events |= POLLWRNORM;
-
 		m_allSockets[socket] = m_sockets.size();
 		m_sockets.emplace_back(entry);
 
+		Registration& registration = m_registrations.emplace_back();
+		registration.userdata = userdata;
+
 		return true;
 	}
 
@@ -68,44 +103,58 @@ namespace Nz
 
 			// Now move it properly (lastElement is invalid after the following line) and pop it
 			m_sockets[entry] = std::move(m_sockets.back());
+			m_registrations[entry] = std::move(m_registrations.back());
 		}
 		m_sockets.pop_back();
+		m_registrations.pop_back();
 
 		m_allSockets.erase(socket);
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
+	}
+
+	void SocketPollerImpl::SetEventCapacity(std::size_t eventCapacity)
+	{
+		// poll reports every ready socket, capacity is only used to preallocate the ready events
+		m_eventCapacity = eventCapacity;
+		m_readyEvents.reserve(m_eventCapacity);
 	}
 
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
-		unsigned int activeSockets;
+		m_readyEvents.clear();
+
+		unsigned int activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
 
-		// Reset status of sockets
-		activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
+		// Ready states of the previous wait are invalidated by incrementing the wait index
+		m_waitIndex++;
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		if (activeSockets > 0U)
 		{
 			unsigned int socketRemaining = activeSockets;
-			for (PollSocket& entry : m_sockets)
+			for (std::size_t i = 0; i < m_sockets.size(); ++i)
 			{
+				PollSocket& entry = m_sockets[i];
 				if (!entry.revents)
 					continue;
 
-				if (entry.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
+				SocketPollEventFlags readyEvents;
+				if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
+					readyEvents |= SocketPollEvent::Read;
+
+				if (entry.revents & (POLLWRNORM | POLLERR))
+					readyEvents |= SocketPollEvent::Write;
+
+				if (readyEvents)
 				{
-					if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
-						m_readyToReadSockets.insert(entry.fd);
+					Registration& registration = m_registrations[i];
+					registration.readyEvents = readyEvents;
+					registration.waitIndex = m_waitIndex;
 
-					if (entry.revents & (POLLWRNORM | POLLERR))
-						m_readyToWriteSockets.insert(entry.fd);
+					auto& readyEvent = m_readyEvents.emplace_back();
+					readyEvent.events = readyEvents;
+					readyEvent.userdata = registration.userdata;
 				}
 				else
-				{
 					NazaraWarningFmt("Socket {0} was returned by poll without POLLRDNORM nor POLLWRNORM events (events: {1:#x})", entry.fd, entry.revents);
-					activeSockets--;
-				}
 
 				entry.revents = 0;
 
@@ -114,6 +163,18 @@ namespace Nz
 			}
 		}
 
-		return activeSockets;
+		return static_cast<unsigned int>(m_readyEvents.size());
+	}
+
+	short SocketPollerImpl::BuildPollEvents(SocketPollEventFlags eventFlags)
+	{
+		short events = 0;
+		if (eventFlags & SocketPollEvent::Read)
+			events |= POLLRDNORM;
+
+		if (eventFlags & SocketPollEvent::Write)
+			events |= POLLWRNORM;
+
+		return events;
 	}
 }
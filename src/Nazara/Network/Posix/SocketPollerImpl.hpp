@@ -8,9 +8,10 @@
 #define NAZARA_NETWORK_POSIX_SOCKETPOLLERIMPL_HPP
 
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <span>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 namespace Nz
@@ -18,25 +19,43 @@ namespace Nz
 	class SocketPollerImpl
 	{
 		public:
-			SocketPollerImpl() = default;
+			SocketPollerImpl();
 			~SocketPollerImpl() = default;
 
 			void Clear();
 
+			std::size_t GetEventCapacity() const;
+			std::span<const SocketPoller::ReadyEvent> GetReadyEvents() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode pollMode);
 			void UnregisterSocket(SocketHandle socket);
 
+			void SetEventCapacity(std::size_t eventCapacity);
+
 			unsigned int Wait(int msTimeout, SocketError* error);
 
 		private:
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
+			struct Registration
+			{
+				void* userdata;
+				SocketPollEventFlags readyEvents;
+				UInt64 waitIndex = 0; //< index of the last Wait call which reported this socket
+			};
+
+			static short BuildPollEvents(SocketPollEventFlags eventFlags);
+
 			std::unordered_map<SocketHandle, std::size_t> m_allSockets;
 			std::vector<PollSocket> m_sockets;
+			std::vector<Registration> m_registrations; //< same indices as m_sockets
+			std::vector<SocketPoller::ReadyEvent> m_readyEvents;
+			std::size_t m_eventCapacity;
+			UInt64 m_waitIndex;
 	};
 }
 
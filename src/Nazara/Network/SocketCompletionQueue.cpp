@@ -0,0 +1,402 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Algorithm.hpp>
+#include <Nazara/Network/PollerSocketCompletionQueueImpl.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+
+#if defined(NAZARA_PLATFORM_LINUX)
+#include <Nazara/Network/Linux/IoUringSocketCompletionQueueImpl.hpp>
+#endif
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SocketCompletionQueue
+	* \brief Network class executing socket operations asynchronously and reporting their completion
+	*
+	* Unlike SocketPoller which reports sockets ready for an operation (which then has to be executed using a syscall),
+	* operations are submitted to the queue and Wait reports the operations which completed, with their results.
+	*
+	* On Linux, operations are executed by the kernel using io_uring, reducing the number of syscalls to one per Wait call.
+	* When io_uring is unavailable (or on other platforms), operations are executed when a SocketPoller reports their socket as ready.
+	*
+	* \remark Buffers and sockets given to an operation must stay valid until the operation completes
+	* \remark Multiple pending operations of the same kind on a stream socket may complete in any order
+	*/
+
+	/*!
+	* \brief Constructs a SocketCompletionQueue object with default settings
+	*/
+	SocketCompletionQueue::SocketCompletionQueue() :
+	SocketCompletionQueue(Config{})
+	{
+	}
+
+	/*!
+	* \brief Constructs a SocketCompletionQueue object
+	*
+	* \param config Queue settings, if io_uring is requested but unavailable the queue falls back to the poller backend
+	*/
+	SocketCompletionQueue::SocketCompletionQueue(const Config& config)
+	{
+		NazaraAssert(config.queueDepth > 0, "queue depth must be over zero");
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		if (config.backend == SocketCompletionBackend::IoUring)
+		{
+			auto ioUringImpl = std::make_unique<IoUringSocketCompletionQueueImpl>(config);
+			if (ioUringImpl->Initialize(config.queueDepth))
+				m_impl = std::move(ioUringImpl);
+			else
+				NazaraWarning("io_uring is not available, falling back to poller backend");
+		}
+#endif
+
+		if (!m_impl)
+			m_impl = std::make_unique<PollerSocketCompletionQueueImpl>(config);
+	}
+
+	SocketCompletionQueue::SocketCompletionQueue(SocketCompletionQueue&&) noexcept = default;
+
+	/*!
+	* \brief Destructs the SocketCompletionQueue
+	*
+	* \remark Pending operations are cancelled
+	*/
+	SocketCompletionQueue::~SocketCompletionQueue() = default;
+
+	/*!
+	* \brief Queues the acceptation of a connection on a listening socket
+	*
+	* \param server Listening server socket
+	* \param newClient Client socket which will be reset to the accepted connection when the operation completes successfully
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued
+	*/
+	bool SocketCompletionQueue::Accept(TcpServer& server, TcpClient* newClient, void* userdata)
+	{
+		NazaraAssert(server.GetState() == SocketState::Bound, "Server isn't listening");
+		NazaraAssert(newClient, "Invalid client socket");
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.buffer = nullptr;
+		operation.bufferIndex = InvalidBufferIndex;
+		operation.client = newClient;
+		operation.handle = server.GetNativeHandle();
+		operation.isBlocking = server.IsBlockingEnabled();
+		operation.size = 0;
+		operation.socketType = SocketType::TCP;
+		operation.type = SocketOperation::Accept;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Returns the backend used to execute operations
+	*/
+	SocketCompletionBackend SocketCompletionQueue::GetBackend() const
+	{
+		return m_impl->GetBackend();
+	}
+
+	/*!
+	* \brief Returns the content of a pooled buffer
+	*
+	* \param bufferIndex Index of the buffer, as reported by a completion
+	*/
+	std::span<UInt8> SocketCompletionQueue::GetBuffer(UInt32 bufferIndex)
+	{
+		return m_impl->GetBuffer(bufferIndex);
+	}
+
+	/*!
+	* \brief Returns the content of a pooled buffer
+	*
+	* \param bufferIndex Index of the buffer, as reported by a completion
+	*/
+	std::span<const UInt8> SocketCompletionQueue::GetBuffer(UInt32 bufferIndex) const
+	{
+		return m_impl->GetBuffer(bufferIndex);
+	}
+
+	/*!
+	* \brief Returns the size of every pooled buffer
+	*/
+	std::size_t SocketCompletionQueue::GetBufferSize() const
+	{
+		return m_impl->GetBufferSize();
+	}
+
+	/*!
+	* \brief Returns the operations which completed during the last Wait call
+	*
+	* \remark The returned span is invalidated by the next Wait call
+	*/
+	std::span<const SocketCompletionQueue::Completion> SocketCompletionQueue::GetCompletions() const
+	{
+		return m_impl->GetCompletions();
+	}
+
+	/*!
+	* \brief Returns the number of operations which didn't complete yet
+	*/
+	std::size_t SocketCompletionQueue::GetPendingOperationCount() const
+	{
+		return m_impl->GetPendingOperationCount();
+	}
+
+	/*!
+	* \brief Queues the reception of data on a connected socket
+	*
+	* \param socket Connected socket
+	* \param buffer Buffer receiving the data, it must stay valid until the operation completes
+	* \param size Size of the buffer
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued
+	*/
+	bool SocketCompletionQueue::Receive(AbstractSocket& socket, void* buffer, std::size_t size, void* userdata)
+	{
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.buffer = buffer;
+		operation.bufferIndex = InvalidBufferIndex;
+		operation.client = nullptr;
+		operation.handle = socket.GetNativeHandle();
+		operation.isBlocking = socket.IsBlockingEnabled();
+		operation.size = size;
+		operation.socketType = socket.GetType();
+		operation.type = SocketOperation::Receive;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Queues the reception of a datagram along with its sender address
+	*
+	* \param socket Bound UDP socket
+	* \param buffer Buffer receiving the datagram, it must stay valid until the operation completes
+	* \param size Size of the buffer
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued
+	*/
+	bool SocketCompletionQueue::ReceiveFrom(UdpSocket& socket, void* buffer, std::size_t size, void* userdata)
+	{
+		NazaraAssert(socket.GetState() == SocketState::Bound, "Socket must be bound first");
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.buffer = buffer;
+		operation.bufferIndex = InvalidBufferIndex;
+		operation.client = nullptr;
+		operation.handle = socket.GetNativeHandle();
+		operation.isBlocking = socket.IsBlockingEnabled();
+		operation.size = size;
+		operation.socketType = SocketType::UDP;
+		operation.type = SocketOperation::ReceiveFrom;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Queues the reception of a datagram in a pooled buffer
+	*
+	* The completion reports the index of the buffer holding the datagram, which has to be released using ReleaseBuffer.
+	*
+	* \param socket Bound UDP socket
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued, false if every pooled buffer is in use
+	*/
+	bool SocketCompletionQueue::ReceiveFromPooled(UdpSocket& socket, void* userdata)
+	{
+		NazaraAssert(socket.GetState() == SocketState::Bound, "Socket must be bound first");
+
+		UInt32 bufferIndex = m_impl->AcquireBuffer();
+		if (bufferIndex == InvalidBufferIndex)
+			return false;
+
+		std::span<UInt8> buffer = m_impl->GetBuffer(bufferIndex);
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.buffer = buffer.data();
+		operation.bufferIndex = bufferIndex;
+		operation.client = nullptr;
+		operation.handle = socket.GetNativeHandle();
+		operation.isBlocking = socket.IsBlockingEnabled();
+		operation.size = buffer.size();
+		operation.socketType = SocketType::UDP;
+		operation.type = SocketOperation::ReceiveFrom;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Queues the reception of data in a pooled buffer
+	*
+	* The completion reports the index of the buffer holding the data, which has to be released using ReleaseBuffer.
+	* With io_uring, the buffer pool is registered to the kernel which saves mapping the buffer for every operation.
+	*
+	* \param socket Connected socket
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued, false if every pooled buffer is in use
+	*/
+	bool SocketCompletionQueue::ReceivePooled(AbstractSocket& socket, void* userdata)
+	{
+		UInt32 bufferIndex = m_impl->AcquireBuffer();
+		if (bufferIndex == InvalidBufferIndex)
+			return false;
+
+		std::span<UInt8> buffer = m_impl->GetBuffer(bufferIndex);
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.buffer = buffer.data();
+		operation.bufferIndex = bufferIndex;
+		operation.client = nullptr;
+		operation.handle = socket.GetNativeHandle();
+		operation.isBlocking = socket.IsBlockingEnabled();
+		operation.size = buffer.size();
+		operation.socketType = socket.GetType();
+		operation.type = SocketOperation::Receive;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Gives back a pooled buffer reported by a completion
+	*
+	* \param bufferIndex Index of the buffer
+	*/
+	void SocketCompletionQueue::ReleaseBuffer(UInt32 bufferIndex)
+	{
+		m_impl->ReleaseBuffer(bufferIndex);
+	}
+
+	/*!
+	* \brief Queues the sending of data on a connected socket
+	*
+	* \param socket Connected socket
+	* \param buffer Data to send, it must stay valid until the operation completes
+	* \param size Size of the data
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued
+	*
+	* \remark The completion may report less transferred bytes than size, in which case the remaining data has to be sent again
+	*/
+	bool SocketCompletionQueue::Send(AbstractSocket& socket, const void* buffer, std::size_t size, void* userdata)
+	{
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.buffer = const_cast<void*>(buffer);
+		operation.bufferIndex = InvalidBufferIndex;
+		operation.client = nullptr;
+		operation.handle = socket.GetNativeHandle();
+		operation.isBlocking = socket.IsBlockingEnabled();
+		operation.size = size;
+		operation.socketType = socket.GetType();
+		operation.type = SocketOperation::Send;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Queues the sending of a datagram
+	*
+	* \param socket UDP socket
+	* \param to Destination address
+	* \param buffer Datagram to send, it must stay valid until the operation completes
+	* \param size Size of the datagram
+	* \param userdata Pointer reported with the completion
+	*
+	* \return True if the operation was queued
+	*/
+	bool SocketCompletionQueue::SendTo(UdpSocket& socket, const IpAddress& to, const void* buffer, std::size_t size, void* userdata)
+	{
+		NazaraAssert(to.IsValid(), "Invalid ip address");
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		SocketCompletionQueueImpl::Operation operation;
+		operation.address = to;
+		operation.buffer = const_cast<void*>(buffer);
+		operation.bufferIndex = InvalidBufferIndex;
+		operation.client = nullptr;
+		operation.handle = socket.GetNativeHandle();
+		operation.isBlocking = socket.IsBlockingEnabled();
+		operation.size = size;
+		operation.socketType = SocketType::UDP;
+		operation.type = SocketOperation::SendTo;
+		operation.userdata = userdata;
+
+		m_impl->Submit(operation);
+		return true;
+	}
+
+	/*!
+	* \brief Submits queued operations and waits until at least one of them completes
+	*
+	* Completed operations can be retrieved using GetCompletions.
+	* This can be called from the application loop (with a zero timeout) or from a dedicated network thread.
+	*
+	* If error is a valid pointer, it will be used to report the last error occurred (if no error occurred, a value of NoError will be reported)
+	*
+	* \param msTimeout Maximum time to wait in milliseconds, 0 will returns immediately and -1 will block indefinitely
+	* \param error If valid, this will be used to report the error status of the operation
+	*
+	* \return Number of completed operations
+	*
+	* \remark Returns immediately if no operation is pending
+	* \remark In case of error, a NazaraError is triggered (except for interrupted errors)
+	*
+	* \see GetCompletions
+	*/
+	unsigned int SocketCompletionQueue::Wait(int msTimeout, SocketError* error)
+	{
+		SocketError waitError;
+
+		unsigned int completionCount = m_impl->Wait(msTimeout, &waitError);
+
+		// Hand accepted connections to their client sockets
+		for (const SocketCompletionQueueImpl::AcceptResult& acceptResult : m_impl->GetAcceptResults())
+			acceptResult.client->Reset(acceptResult.handle, acceptResult.peerAddress);
+
+		if (error)
+			*error = waitError;
+
+		if (waitError != SocketError::NoError)
+		{
+			if (waitError != SocketError::Interrupted) //< Do not log interrupted error
+				NazaraErrorFmt("SocketCompletionQueue encountered an error (code: {0:#x}): {1}", UnderlyingCast(waitError), ErrorToString(waitError));
+
+			return 0;
+		}
+
+		return completionCount;
+	}
+
+	SocketCompletionQueue& SocketCompletionQueue::operator=(SocketCompletionQueue&&) noexcept = default;
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/SocketCompletionQueueImpl.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+
+namespace Nz
+{
+	SocketCompletionQueueImpl::SocketCompletionQueueImpl(const SocketCompletionQueue::Config& config) :
+	m_bufferCount(config.bufferCount),
+	m_bufferSize(config.bufferSize)
+	{
+		m_bufferStorage.resize(m_bufferCount * m_bufferSize);
+
+		// Buffers are acquired from the back, start by the first one
+		m_freeBuffers.resize(m_bufferCount);
+		for (std::size_t i = 0; i < m_bufferCount; ++i)
+			m_freeBuffers[i] = SafeCast<UInt32>(m_bufferCount - i - 1);
+	}
+
+	SocketCompletionQueueImpl::~SocketCompletionQueueImpl() = default;
+
+	UInt32 SocketCompletionQueueImpl::AcquireBuffer()
+	{
+		if (m_freeBuffers.empty())
+			return SocketCompletionQueue::InvalidBufferIndex;
+
+		UInt32 bufferIndex = m_freeBuffers.back();
+		m_freeBuffers.pop_back();
+
+		return bufferIndex;
+	}
+
+	void SocketCompletionQueueImpl::ReleaseBuffer(UInt32 bufferIndex)
+	{
+		NazaraAssertFmt(bufferIndex < m_bufferCount, "buffer index out of range ({0} >= {1})", bufferIndex, m_bufferCount);
+		NazaraAssert(m_freeBuffers.size() < m_bufferCount, "every buffer has already been released");
+
+		m_freeBuffers.push_back(bufferIndex);
+	}
+
+	void SocketCompletionQueueImpl::ClearCompletions()
+	{
+		m_acceptResults.clear();
+		m_completions.clear();
+	}
+
+	void SocketCompletionQueueImpl::PushAcceptCompletion(const Operation& operation, SocketHandle acceptedHandle, const IpAddress& peerAddress)
+	{
+		auto& acceptResult = m_acceptResults.emplace_back();
+		acceptResult.client = operation.client;
+		acceptResult.handle = acceptedHandle;
+		acceptResult.peerAddress = peerAddress;
+
+		PushCompletion(operation, SocketError::NoError, 0, peerAddress);
+	}
+
+	void SocketCompletionQueueImpl::PushCompletion(const Operation& operation, SocketError error, std::size_t transferredBytes, const IpAddress& address)
+	{
+		auto& completion = m_completions.emplace_back();
+		completion.address = address;
+		completion.bufferIndex = operation.bufferIndex;
+		completion.error = error;
+		completion.operation = operation.type;
+		completion.transferredBytes = transferredBytes;
+		completion.userdata = operation.userdata;
+
+		// Failed operations don't hand their pooled buffer to the user
+		if (error != SocketError::NoError && completion.bufferIndex != SocketCompletionQueue::InvalidBufferIndex)
+		{
+			ReleaseBuffer(completion.bufferIndex);
+			completion.bufferIndex = SocketCompletionQueue::InvalidBufferIndex;
+		}
+	}
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_NETWORK_SOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/SocketHandle.hpp>
+#include <span>
+#include <vector>
+
+namespace Nz
+{
+	class SocketCompletionQueueImpl
+	{
+		public:
+			struct AcceptResult;
+			struct Operation;
+
+			SocketCompletionQueueImpl(const SocketCompletionQueue::Config& config);
+			SocketCompletionQueueImpl(const SocketCompletionQueueImpl&) = delete;
+			SocketCompletionQueueImpl(SocketCompletionQueueImpl&&) = delete;
+			virtual ~SocketCompletionQueueImpl();
+
+			UInt32 AcquireBuffer();
+
+			inline std::span<const AcceptResult> GetAcceptResults() const;
+			virtual SocketCompletionBackend GetBackend() const = 0;
+			inline std::span<UInt8> GetBuffer(UInt32 bufferIndex);
+			inline std::size_t GetBufferSize() const;
+			inline std::span<const SocketCompletionQueue::Completion> GetCompletions() const;
+			virtual std::size_t GetPendingOperationCount() const = 0;
+
+			void ReleaseBuffer(UInt32 bufferIndex);
+
+			virtual void Submit(const Operation& operation) = 0;
+
+			virtual unsigned int Wait(int msTimeout, SocketError* error) = 0;
+
+			SocketCompletionQueueImpl& operator=(const SocketCompletionQueueImpl&) = delete;
+			SocketCompletionQueueImpl& operator=(SocketCompletionQueueImpl&&) = delete;
+
+			struct AcceptResult
+			{
+				IpAddress peerAddress;
+				TcpClient* client;
+				SocketHandle handle;
+			};
+
+			struct Operation
+			{
+				IpAddress address; //< destination address (SendTo)
+				TcpClient* client; //< client receiving the accepted connection (Accept)
+				void* buffer;
+				void* userdata;
+				std::size_t size;
+				SocketHandle handle;
+				SocketOperation type;
+				SocketType socketType;
+				UInt32 bufferIndex;
+				bool isBlocking;
+			};
+
+		protected:
+			void ClearCompletions();
+			void PushAcceptCompletion(const Operation& operation, SocketHandle acceptedHandle, const IpAddress& peerAddress);
+			void PushCompletion(const Operation& operation, SocketError error, std::size_t transferredBytes, const IpAddress& address = IpAddress::Invalid);
+
+			std::vector<AcceptResult> m_acceptResults;
+			std::vector<SocketCompletionQueue::Completion> m_completions;
+			std::vector<UInt32> m_freeBuffers;
+			std::vector<UInt8> m_bufferStorage;
+			std::size_t m_bufferCount;
+			std::size_t m_bufferSize;
+	};
+}
+
+#include <Nazara/Network/SocketCompletionQueueImpl.inl>
+
+#endif // NAZARA_NETWORK_SOCKETCOMPLETIONQUEUEIMPL_HPP
@@ -0,0 +1,29 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline auto SocketCompletionQueueImpl::GetAcceptResults() const -> std::span<const AcceptResult>
+	{
+		return m_acceptResults;
+	}
+
+	inline std::span<UInt8> SocketCompletionQueueImpl::GetBuffer(UInt32 bufferIndex)
+	{
+		NazaraAssertFmt(bufferIndex < m_bufferCount, "buffer index out of range ({0} >= {1})", bufferIndex, m_bufferCount);
+		return std::span<UInt8>(&m_bufferStorage[bufferIndex * m_bufferSize], m_bufferSize);
+	}
+
+	inline std::size_t SocketCompletionQueueImpl::GetBufferSize() const
+	{
+		return m_bufferSize;
+	}
+
+	inline std::span<const SocketCompletionQueue::Completion> SocketCompletionQueueImpl::GetCompletions() const
+	{
+		return m_completions;
+	}
+}
@@ -57,6 +57,33 @@ namespace Nz
 		m_impl->Clear();
 	}
 
+	/*!
+	* \brief Returns the maximum number of ready events reported by a single Wait call
+	*
+	* \see SetEventCapacity
+	*/
+	std::size_t SocketPoller::GetEventCapacity() const
+	{
+		return m_impl->GetEventCapacity();
+	}
+
+	/*!
+	* \brief Returns the events reported by the last Wait operation
+	*
+	* Each ready socket is reported once, with the user data it was registered with and the events it is ready for.
+	* Unlike IsReadyToRead and IsReadyToWrite, this doesn't require to query every registered socket.
+	*
+	* \remark The returned span is invalidated by the next Wait or Clear call
+	*
+	* \return Ready events of the last Wait operation
+	*
+	* \see Wait
+	*/
+	std::span<const SocketPoller::ReadyEvent> SocketPoller::GetReadyEvents() const
+	{
+		return m_impl->GetReadyEvents();
+	}
+
 	/*!
 	* \brief Checks if a specific socket is ready to read data
 	*
@@ -107,16 +134,33 @@ namespace Nz
 	*
 	* A registered socket is part of the SocketPoller and will be checked by the next Wait operations.
 	*
-	* \param socket Reference to the socket to check
+	* \param socket Native handle of the socket to check
 	*
 	* \return True if the socket is registered, false otherwise
 	*
 	* \see RegisterSocket
 	* \see UnregisterSocket
 	*/
-	bool SocketPoller::IsRegistered(const AbstractSocket& socket) const
+	bool SocketPoller::IsRegistered(SocketHandle socket) const
 	{
-		return m_impl->IsRegistered(socket.GetNativeHandle());
+		return m_impl->IsRegistered(socket);
+	}
+
+	/*!
+	* \brief Changes the events watched on a registered socket
+	*
+	* This is cheaper than unregistering and registering the socket again (for example to watch for write events only while data is waiting to be sent).
+	*
+	* \param socket Native handle of the registered socket
+	* \param eventFlags Socket events to watch
+	*
+	* \return True if the watched events were changed, false otherwise
+	*/
+	bool SocketPoller::ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	{
+		NazaraAssert(IsRegistered(socket), "This socket is not registered in this SocketPoller");
+
+		return m_impl->ModifySocket(socket, eventFlags);
 	}
 
 	/*!
@@ -131,19 +175,26 @@ namespace Nz
 	* \remark It is an error to register a socket twice in the same SocketPoller.
 	* \remark The socket should not be freed while it is registered in the SocketPooler.
 	*
-	* \param socket Reference to the socket to register
+	* \remark Edge-triggered mode is only supported with epoll (Linux), other implementations fall back to level-triggered mode (which reports a superset of events)
+	*
+	* Sockets can be registered by their native handle, which allows to watch sockets owned by third-party libraries (e.g. libcurl).
+	*
+	* \param socket Native handle of the socket to register
 	* \param eventFlags Socket events to watch
+	* \param userdata Pointer reported with the socket ready events (see GetReadyEvents)
+	* \param pollMode Whether the socket should be reported as long as it is ready or only when it becomes ready
 	*
 	* \return True if the socket is registered, false otherwise
 	*
 	* \see IsRegistered
+	* \see ModifySocket
 	* \see UnregisterSocket
 	*/
-	bool SocketPoller::RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags)
+	bool SocketPoller::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode pollMode)
 	{
 		NazaraAssert(!IsRegistered(socket), "This socket is already registered in this SocketPoller");
 
-		return m_impl->RegisterSocket(socket.GetNativeHandle(), eventFlags);
+		return m_impl->RegisterSocket(socket, eventFlags, userdata, pollMode);
 	}
 
 	/*!
@@ -155,23 +206,39 @@ namespace Nz
 	*
 	* \remark It is an error to try to unregister a non-registered socket from a SocketPoller.
 	*
-	* \param socket Reference to the socket to unregister
+	* \param socket Native handle of the socket to unregister
 	*
 	* \see IsRegistered
 	* \see RegisterSocket
 	*/
-	void SocketPoller::UnregisterSocket(AbstractSocket& socket)
+	void SocketPoller::UnregisterSocket(SocketHandle socket)
 	{
 		NazaraAssert(IsRegistered(socket), "This socket is not registered in this SocketPoller");
 
-		return m_impl->UnregisterSocket(socket.GetNativeHandle());
+		return m_impl->UnregisterSocket(socket);
+	}
+
+	/*!
+	* \brief Sets the maximum number of ready events reported by a single Wait call
+	*
+	* Ready sockets which couldn't be reported are reported by the next Wait calls.
+	*
+	* \remark Only epoll (Linux) reports a limited number of events, other implementations report every ready socket
+	*
+	* \param eventCapacity Maximum number of ready events per Wait call, must be over zero
+	*/
+	void SocketPoller::SetEventCapacity(std::size_t eventCapacity)
+	{
+		NazaraAssert(eventCapacity > 0, "event capacity must be over zero");
+
+		m_impl->SetEventCapacity(eventCapacity);
 	}
 
 	/*!
 	* \brief Wait until any registered socket switches to a ready state.
 	*
 	* Waits a specific/undetermined amount of time until at least one socket part of the SocketPoller becomes ready.
-	* To query the ready state of the registered socket, use the IsReadyToRead or IsReadyToWrite functions.
+	* To retrieve the ready sockets, use GetReadyEvents or query the ready state of each registered socket using the IsReadyToRead or IsReadyToWrite functions.
 	*
 	* If error is a valid pointer, it will be used to report the last error occurred (if no error occurred, a value of NoError will be reported)
 	*
@@ -182,7 +249,9 @@ namespace Nz
 	*
 	* \remark In case of error, a NazaraError is triggered (except for interrupted errors)
 	*
-	* \see IsReady
+	* \see GetReadyEvents
+	* \see IsReadyToRead
+	* \see IsReadyToWrite
 	* \see RegisterSocket
 	*/
 	unsigned int SocketPoller::Wait(int msTimeout, SocketError* error)
@@ -202,6 +271,6 @@ namespace Nz
 			return 0;
 		}
 
-		return readySockets > 0;
+		return readySockets;
 	}
 }
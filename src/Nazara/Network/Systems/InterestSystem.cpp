@@ -0,0 +1,335 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/Systems/InterestSystem.hpp>
+#include <Nazara/Core/Components/DisabledComponent.hpp>
+#include <Nazara/Core/Components/NodeComponent.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::InterestSystem
+	* \brief Area of interest management, computing which entities are relevant to each observer (usually one per connected peer)
+	*
+	* Entities having an InterestComponent are stored in a spatial hash grid from their NodeComponent position.
+	* Each update, observers (entities having an InterestObserverComponent) query the cells overlapping their radius and get the entities entering and leaving their area of interest,
+	* as well as the relevant entities whose state should be sent this tick: close entities are updated every tick, while farther ones get updated less often (depending on their priority).
+	*
+	* The cell size should be of the same magnitude as the observer radius.
+	*
+	* \see BuildSnapshot
+	*/
+
+	InterestSystem::InterestSystem(entt::registry& registry, float cellSize) :
+	m_registry(registry),
+	m_cellSize(cellSize),
+	m_invCellSize(1.f / cellSize),
+	m_maxUpdateInterval(8),
+	m_tick(0)
+	{
+		NazaraAssert(cellSize > 0.f, "cell size must be positive");
+
+		m_disabledConstructConnection = registry.on_construct<DisabledComponent>().connect<&InterestSystem::OnEntityDisabled>(this);
+		m_interestDestroyConnection = registry.on_destroy<InterestComponent>().connect<&InterestSystem::OnInterestDestroy>(this);
+		m_nodeDestroyConnection = registry.on_destroy<NodeComponent>().connect<&InterestSystem::OnNodeDestroy>(this);
+	}
+
+	/*!
+	* \brief Builds the snapshot of the relevant entities of an observer, to be encoded by the EntitySnapshotEncoder of its peer
+	* \return Snapshot holding the relevant entities (at the world snapshot tick)
+	*
+	* Entities updated during the last update are taken from the world snapshot, the others keep the state they had in the last snapshot sent to the observer
+	* (allowing the encoder to skip them entirely once acknowledged). Relevant entities missing from the world snapshot are ignored.
+	*
+	* \param observer Observer to build the snapshot for, updated by the last call to Update
+	* \param worldSnapshot Snapshot holding the current state of all replicated entities (see EntitySnapshotSchema::Capture)
+	* \param lastSentSnapshot Last snapshot sent to the observer (see EntitySnapshotEncoder::GetLastSnapshot), nullptr to send every relevant entity state
+	*/
+	std::shared_ptr<EntitySnapshot> InterestSystem::BuildSnapshot(const InterestObserverComponent& observer, const EntitySnapshot& worldSnapshot, const EntitySnapshot* lastSentSnapshot) const
+	{
+		std::shared_ptr<EntitySnapshot> snapshot = std::make_shared<EntitySnapshot>(worldSnapshot.GetTick());
+		snapshot->m_entities.reserve(observer.m_relevantEntities.size());
+
+		// Both relevant entities and snapshot entities are sorted by network id, allowing to walk the last sent snapshot alongside
+		std::size_t lastSentIndex = 0;
+		std::size_t lastSentCount = (lastSentSnapshot) ? lastSentSnapshot->GetEntityCount() : 0;
+
+		for (const InterestObserverComponent::RelevantEntity& relevantEntity : observer.m_relevantEntities)
+		{
+			while (lastSentIndex < lastSentCount && lastSentSnapshot->m_entities[lastSentIndex].networkId < relevantEntity.networkId)
+				lastSentIndex++;
+
+			const EntitySnapshot* sourceSnapshot;
+			const EntitySnapshot::Entity* sourceEntity;
+			if (relevantEntity.lastUpdateTick != m_tick && lastSentIndex < lastSentCount && lastSentSnapshot->m_entities[lastSentIndex].networkId == relevantEntity.networkId)
+			{
+				sourceSnapshot = lastSentSnapshot;
+				sourceEntity = &lastSentSnapshot->m_entities[lastSentIndex];
+			}
+			else
+			{
+				sourceSnapshot = &worldSnapshot;
+				sourceEntity = worldSnapshot.FindEntity(relevantEntity.networkId);
+				if (!sourceEntity)
+					continue;
+			}
+
+			const UInt32* words = sourceSnapshot->GetWords(*sourceEntity);
+			std::size_t wordCount = sourceSnapshot->GetWordCount(*sourceEntity);
+
+			snapshot->m_entities.push_back({ sourceEntity->componentMask, static_cast<UInt32>(snapshot->m_words.size()), relevantEntity.networkId });
+			snapshot->m_words.insert(snapshot->m_words.end(), words, words + wordCount);
+		}
+
+		return snapshot;
+	}
+
+	/*!
+	* \brief Updates the spatial grid from entity positions and the relevant entities of every observer
+	*
+	* \param tick Current network tick, must increase between calls
+	*/
+	void InterestSystem::Update(UInt32 tick)
+	{
+		m_tick = tick;
+
+		auto entityView = m_registry.view<const NodeComponent, const InterestComponent>(entt::exclude<DisabledComponent>);
+		for (auto [entity, nodeComponent, interestComponent] : entityView.each())
+		{
+			UInt32 entityIndex = static_cast<UInt32>(entt::to_entity(entity));
+
+			UInt32 trackedIndex = (entityIndex < m_trackedIndices.size()) ? m_trackedIndices[entityIndex] : InvalidIndex;
+			if (trackedIndex == InvalidIndex)
+				trackedIndex = TrackEntity(entity);
+
+			const TrackedEntity& trackedEntity = m_trackedEntities[trackedIndex];
+			const Vector3f& position = nodeComponent.GetGlobalPosition();
+
+			UInt64 cellKey = GetCellKey(position);
+			if (cellKey != trackedEntity.cellKey)
+				MoveToCell(trackedIndex, cellKey, position, interestComponent.GetPriority());
+			else
+			{
+				CellEntry& cellEntry = (*trackedEntity.cell)[trackedEntity.cellIndex];
+				cellEntry.position = position;
+				cellEntry.priority = interestComponent.GetPriority();
+			}
+		}
+
+		auto observerView = m_registry.view<const NodeComponent, InterestObserverComponent>(entt::exclude<DisabledComponent>);
+		for (auto [entity, nodeComponent, observerComponent] : observerView.each())
+		{
+			NazaraUnused(entity);
+			UpdateObserver(observerComponent, nodeComponent.GetGlobalPosition(), tick);
+		}
+	}
+
+	void InterestSystem::MoveToCell(UInt32 trackedIndex, UInt64 cellKey, const Vector3f& position, float priority)
+	{
+		TrackedEntity& trackedEntity = m_trackedEntities[trackedIndex];
+		if (trackedEntity.cell)
+			RemoveFromCell(trackedEntity);
+
+		std::vector<CellEntry>& cell = m_cells[cellKey];
+		trackedEntity.cell = &cell;
+		trackedEntity.cellKey = cellKey;
+		trackedEntity.cellIndex = static_cast<UInt32>(cell.size());
+		cell.push_back({ position, trackedEntity.entity, static_cast<UInt32>(entt::to_integral(trackedEntity.entity)), trackedIndex, priority });
+	}
+
+	void InterestSystem::OnEntityDisabled(entt::registry& /*registry*/, entt::entity entity)
+	{
+		// Disabled entities are tracked again once enabled
+		UntrackEntity(entity);
+	}
+
+	void InterestSystem::OnInterestDestroy(entt::registry& /*registry*/, entt::entity entity)
+	{
+		UntrackEntity(entity);
+	}
+
+	void InterestSystem::OnNodeDestroy(entt::registry& /*registry*/, entt::entity entity)
+	{
+		UntrackEntity(entity);
+	}
+
+	void InterestSystem::RemoveFromCell(const TrackedEntity& trackedEntity)
+	{
+		std::vector<CellEntry>& cell = *trackedEntity.cell;
+		NazaraAssert(trackedEntity.cellIndex < cell.size(), "cell index out of range");
+
+		// Swap with the last entity of the cell
+		const CellEntry& lastEntry = cell.back();
+		m_trackedEntities[lastEntry.trackedIndex].cellIndex = trackedEntity.cellIndex;
+		cell[trackedEntity.cellIndex] = lastEntry;
+		cell.pop_back();
+
+		if (cell.empty())
+			m_cells.erase(trackedEntity.cellKey);
+	}
+
+	UInt32 InterestSystem::TrackEntity(entt::entity entity)
+	{
+		UInt32 entityIndex = static_cast<UInt32>(entt::to_entity(entity));
+		if (entityIndex >= m_trackedIndices.size())
+			m_trackedIndices.resize(entityIndex + 1, InvalidIndex);
+
+		UInt32 trackedIndex = static_cast<UInt32>(m_trackedEntities.size());
+		m_trackedIndices[entityIndex] = trackedIndex;
+
+		TrackedEntity& trackedEntity = m_trackedEntities.emplace_back();
+		trackedEntity.entity = entity;
+		trackedEntity.cell = nullptr;
+		trackedEntity.cellKey = InvalidCell;
+		trackedEntity.cellIndex = InvalidIndex;
+
+		return trackedIndex;
+	}
+
+	void InterestSystem::UntrackEntity(entt::entity entity)
+	{
+		UInt32 entityIndex = static_cast<UInt32>(entt::to_entity(entity));
+		if (entityIndex >= m_trackedIndices.size())
+			return;
+
+		UInt32 trackedIndex = m_trackedIndices[entityIndex];
+		if (trackedIndex == InvalidIndex)
+			return;
+
+		if (m_trackedEntities[trackedIndex].cell)
+			RemoveFromCell(m_trackedEntities[trackedIndex]);
+
+		m_trackedIndices[entityIndex] = InvalidIndex;
+
+		// Swap with the last tracked entity, fixing its indices
+		UInt32 lastTrackedIndex = static_cast<UInt32>(m_trackedEntities.size() - 1);
+		if (trackedIndex != lastTrackedIndex)
+		{
+			TrackedEntity& lastEntity = m_trackedEntities[lastTrackedIndex];
+			m_trackedIndices[entt::to_entity(lastEntity.entity)] = trackedIndex;
+			if (lastEntity.cell)
+				(*lastEntity.cell)[lastEntity.cellIndex].trackedIndex = trackedIndex;
+
+			m_trackedEntities[trackedIndex] = lastEntity;
+		}
+
+		m_trackedEntities.pop_back();
+	}
+
+	void InterestSystem::UpdateObserver(InterestObserverComponent& observer, const Vector3f& position, UInt32 tick)
+	{
+		float radius = observer.m_radius;
+		float squaredRadius = radius * radius;
+
+		// Gather entities in range, from every cell overlapping the observer sphere
+		m_candidates.clear();
+
+		Int64 minX = GetCellCoordinate(position.x - radius);
+		Int64 minY = GetCellCoordinate(position.y - radius);
+		Int64 minZ = GetCellCoordinate(position.z - radius);
+		Int64 maxX = GetCellCoordinate(position.x + radius);
+		Int64 maxY = GetCellCoordinate(position.y + radius);
+		Int64 maxZ = GetCellCoordinate(position.z + radius);
+
+		for (Int64 x = minX; x <= maxX; ++x)
+		{
+			for (Int64 y = minY; y <= maxY; ++y)
+			{
+				for (Int64 z = minZ; z <= maxZ; ++z)
+				{
+					auto it = m_cells.find(GetCellKey(x, y, z));
+					if (it == m_cells.end())
+						continue;
+
+					for (const CellEntry& cellEntry : it->second)
+					{
+						float squaredDistance = position.SquaredDistance(cellEntry.position);
+						if (squaredDistance <= squaredRadius)
+							m_candidates.push_back({ cellEntry.entity, cellEntry.networkId, cellEntry.priority, squaredDistance });
+					}
+				}
+			}
+		}
+
+		std::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& lhs, const Candidate& rhs) { return lhs.networkId < rhs.networkId; });
+
+		// Merge with the previous relevant set (both being sorted by network id)
+		observer.m_enteringEntities.clear();
+		observer.m_leavingEntities.clear();
+		observer.m_updatedEntities.clear();
+
+		m_dueEntities.clear();
+		m_relevantEntities.clear();
+
+		const std::vector<InterestObserverComponent::RelevantEntity>& previousEntities = observer.m_relevantEntities;
+		float maxUpdateInterval = static_cast<float>(m_maxUpdateInterval);
+		float maxIntervalFactor = (maxUpdateInterval - 1.f) / radius;
+
+		std::size_t previousIndex = 0;
+		std::size_t candidateIndex = 0;
+		while (previousIndex < previousEntities.size() || candidateIndex < m_candidates.size())
+		{
+			if (candidateIndex == m_candidates.size() || (previousIndex < previousEntities.size() && previousEntities[previousIndex].networkId < m_candidates[candidateIndex].networkId))
+			{
+				observer.m_leavingEntities.push_back(previousEntities[previousIndex].entity);
+				previousIndex++;
+				continue;
+			}
+
+			const Candidate& candidate = m_candidates[candidateIndex];
+
+			if (previousIndex == previousEntities.size() || candidate.networkId < previousEntities[previousIndex].networkId)
+			{
+				// Entering entities are always sent
+				observer.m_enteringEntities.push_back(candidate.entity);
+				m_relevantEntities.push_back({ candidate.entity, tick, candidate.networkId });
+				candidateIndex++;
+				continue;
+			}
+
+			// Entity was already relevant, its update interval grows with its distance (scaled by its priority)
+			const InterestObserverComponent::RelevantEntity& previousEntity = previousEntities[previousIndex];
+
+			float intervalFactor = std::sqrt(candidate.squaredDistance) * maxIntervalFactor / candidate.priority;
+			UInt32 updateInterval = std::min(1 + static_cast<UInt32>(std::min(intervalFactor, maxUpdateInterval)), m_maxUpdateInterval);
+
+			UInt32 elapsedTicks = tick - previousEntity.lastUpdateTick;
+			if (elapsedTicks >= updateInterval)
+			{
+				float urgency = static_cast<float>(elapsedTicks) / updateInterval * candidate.priority;
+				m_dueEntities.push_back({ urgency, static_cast<UInt32>(m_relevantEntities.size()) });
+			}
+
+			m_relevantEntities.push_back(previousEntity);
+			previousIndex++;
+			candidateIndex++;
+		}
+
+		// Only keep the most urgent entities if the observer has an update budget
+		if (observer.m_maxUpdatedEntities > 0)
+		{
+			std::size_t maxDueEntities = (observer.m_maxUpdatedEntities > observer.m_enteringEntities.size()) ? observer.m_maxUpdatedEntities - observer.m_enteringEntities.size() : 0;
+			if (m_dueEntities.size() > maxDueEntities)
+			{
+				std::nth_element(m_dueEntities.begin(), m_dueEntities.begin() + maxDueEntities, m_dueEntities.end(), [](const DueEntity& lhs, const DueEntity& rhs) { return lhs.urgency > rhs.urgency; });
+				m_dueEntities.resize(maxDueEntities);
+			}
+		}
+
+		for (const DueEntity& dueEntity : m_dueEntities)
+			m_relevantEntities[dueEntity.relevantIndex].lastUpdateTick = tick;
+
+		for (const InterestObserverComponent::RelevantEntity& relevantEntity : m_relevantEntities)
+		{
+			if (relevantEntity.lastUpdateTick == tick)
+				observer.m_updatedEntities.push_back(relevantEntity.entity);
+		}
+
+		// Keep the previous buffer around for the next observer
+		std::swap(observer.m_relevantEntities, m_relevantEntities);
+	}
+}
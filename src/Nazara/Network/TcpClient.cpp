@@ -5,7 +5,13 @@
 #include <Nazara/Network/TcpClient.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Network/Algorithm.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
  #include <NazaraUtils/CallOnExit.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
 #include <limits>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -19,10 +25,125 @@
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		constexpr std::size_t MaxLengthPrefixSize = 5;
+		constexpr std::size_t MaxSendBufferCount = 64; //< buffers gathered in a single send call
+
+		enum class LengthPrefixStatus
+		{
+			Complete,
+			Incomplete,
+			Invalid
+		};
+
+		LengthPrefixStatus DecodeLengthPrefix(MessageLengthPrefix lengthPrefix, const UInt8* data, std::size_t size, std::size_t* prefixSize, std::size_t* messageSize)
+		{
+			switch (lengthPrefix)
+			{
+				case MessageLengthPrefix::UInt16:
+				{
+					if (size < sizeof(UInt16))
+						return LengthPrefixStatus::Incomplete;
+
+					UInt16 length;
+					std::memcpy(&length, data, sizeof(length));
+
+					*prefixSize = sizeof(UInt16);
+					*messageSize = NetToHost(length);
+					return LengthPrefixStatus::Complete;
+				}
+
+				case MessageLengthPrefix::UInt32:
+				{
+					if (size < sizeof(UInt32))
+						return LengthPrefixStatus::Incomplete;
+
+					UInt32 length;
+					std::memcpy(&length, data, sizeof(length));
+
+					*prefixSize = sizeof(UInt32);
+					*messageSize = NetToHost(length);
+					return LengthPrefixStatus::Complete;
+				}
+
+				case MessageLengthPrefix::VarInt:
+				{
+					UInt64 length = 0;
+					for (std::size_t i = 0; i < MaxLengthPrefixSize; ++i)
+					{
+						if (i >= size)
+							return LengthPrefixStatus::Incomplete;
+
+						length |= UInt64(data[i] & 0x7F) << (7 * i);
+						if ((data[i] & 0x80) == 0)
+						{
+							if (length > std::numeric_limits<UInt32>::max())
+								return LengthPrefixStatus::Invalid;
+
+							*prefixSize = i + 1;
+							*messageSize = static_cast<std::size_t>(length);
+							return LengthPrefixStatus::Complete;
+						}
+					}
+
+					return LengthPrefixStatus::Invalid;
+				}
+			}
+
+			NazaraInternalErrorFmt("unhandled message length prefix {0:#x}", UnderlyingCast(lengthPrefix));
+			return LengthPrefixStatus::Invalid;
+		}
+
+		std::size_t EncodeLengthPrefix(MessageLengthPrefix lengthPrefix, std::size_t messageSize, UInt8* output)
+		{
+			switch (lengthPrefix)
+			{
+				case MessageLengthPrefix::UInt16:
+				{
+					UInt16 length = HostToNet(static_cast<UInt16>(messageSize));
+					std::memcpy(output, &length, sizeof(length));
+					return sizeof(length);
+				}
+
+				case MessageLengthPrefix::UInt32:
+				{
+					UInt32 length = HostToNet(static_cast<UInt32>(messageSize));
+					std::memcpy(output, &length, sizeof(length));
+					return sizeof(length);
+				}
+
+				case MessageLengthPrefix::VarInt:
+				{
+					std::size_t prefixSize = 0;
+					do
+					{
+						UInt8 byte = static_cast<UInt8>(messageSize & 0x7F);
+						messageSize >>= 7;
+						if (messageSize != 0)
+							byte |= 0x80;
+
+						output[prefixSize++] = byte;
+					}
+					while (messageSize != 0);
+
+					return prefixSize;
+				}
+			}
+
+			NazaraInternalErrorFmt("unhandled message length prefix {0:#x}", UnderlyingCast(lengthPrefix));
+			return 0;
+		}
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::TcpClient,l 
 	* \brief Network class that represents a client in a TCP connection
+	*
+	* Besides raw byte transfers, a TcpClient can be switched to a framed message mode (see EnableFraming), where every message is prefixed by its length.
+	* Queued messages are coalesced in pooled chunks and sent with a single gather call once the cork threshold is reached (or when FlushMessages is called),
+	* while received messages are handed out as views of a per-connection receive buffer, without being copied.
 	*/
 
 	/*!
@@ -95,6 +216,69 @@ namespace Nz
 		return Connect(hostnameAddress);
 	}
 
+	/*!
+	* \brief Acquires a buffer from the framing buffer pool
+	* \return Buffer of the requested size, to be filled and then queued using QueueMessage(ByteArray&&)
+	*
+	* \param size Size of the message
+	*
+	* \remark Framed message mode must be enabled
+	*/
+	ByteArray TcpClient::AcquireMessageBuffer(std::size_t size)
+	{
+		NazaraAssert(m_framing, "framed message mode is not enabled");
+
+		ByteArray buffer = m_framing->config.bufferPool->GetByteArray(size);
+		buffer.Resize(size);
+
+		return buffer;
+	}
+
+	/*!
+	* \brief Disables the framed message mode
+	*
+	* Messages still waiting to be sent are discarded and buffers are given back to the pool.
+	*/
+	void TcpClient::DisableFraming()
+	{
+		if (!m_framing)
+			return;
+
+		ByteArrayPool& bufferPool = *m_framing->config.bufferPool;
+		for (SendSegment& segment : m_framing->sendQueue)
+			bufferPool.ReturnByteArray(std::move(segment.data));
+
+		bufferPool.ReturnByteArray(std::move(m_framing->receiveBuffer));
+
+		m_framing.reset();
+	}
+
+	/*!
+	* \brief Enables the framed message mode
+	*
+	* In this mode, messages are sent using QueueMessage/FlushMessages and received using ReceiveMessage, each message being prefixed by its length.
+	* Both ends of the connection have to use the same length prefix.
+	*
+	* \param config Framing parameters
+	*
+	* \remark Enabling framing again discards the current framing state
+	*/
+	void TcpClient::EnableFraming(const FramingConfig& config)
+	{
+		NazaraAssert(config.receiveBufferSize > 0, "receive buffer size must be over zero");
+		NazaraAssert(config.sendChunkSize > 0, "send chunk size must be over zero");
+
+		DisableFraming();
+
+		m_framing = std::make_unique<MessageFraming>();
+		m_framing->config = config;
+		if (!m_framing->config.bufferPool)
+			m_framing->config.bufferPool = std::make_shared<ByteArrayPool>();
+
+		m_framing->receiveBuffer = m_framing->config.bufferPool->GetByteArray(config.receiveBufferSize);
+		m_framing->receiveBuffer.Resize(std::max(config.receiveBufferSize, m_framing->receiveBuffer.GetCapacity()));
+	}
+
 	/*!
 	* \brief Enables low delay in emitting
 	*
@@ -135,6 +319,64 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Sends queued framed messages
+	* \return true If no error occurred (some messages may still be queued with non-blocking sockets)
+	*
+	* Queued buffers are gathered and sent with as few calls as possible. With a non-blocking socket, this stops as soon as sending would block.
+	*
+	* \remark Framed message mode must be enabled
+	*/
+	bool TcpClient::FlushMessages()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(m_framing, "framed message mode is not enabled");
+
+		MessageFraming& framing = *m_framing;
+		while (!framing.sendQueue.empty())
+		{
+			std::array<NetBuffer, MaxSendBufferCount> buffers;
+			std::size_t bufferCount = 0;
+			for (SendSegment& segment : framing.sendQueue)
+			{
+				buffers[bufferCount].data = segment.data.GetBuffer() + segment.offset;
+				buffers[bufferCount].dataLength = segment.data.GetSize() - segment.offset;
+
+				if (++bufferCount >= buffers.size())
+					break;
+			}
+
+			std::size_t sent;
+			if (!SendMultiple(buffers.data(), bufferCount, &sent))
+				return false;
+
+			if (sent == 0)
+				break; //< would block, remaining messages stay queued
+
+			framing.queuedSize -= sent;
+
+			while (sent > 0)
+			{
+				SendSegment& segment = framing.sendQueue.front();
+
+				std::size_t remainingSize = segment.data.GetSize() - segment.offset;
+				if (sent < remainingSize)
+				{
+					segment.offset += sent;
+					break;
+				}
+
+				sent -= remainingSize;
+
+				framing.config.bufferPool->ReturnByteArray(std::move(segment.data));
+				framing.sendQueue.pop_front();
+			}
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Gets the size of the raw memory available
 	* \return Size of the memory available
@@ -189,6 +431,82 @@ namespace Nz
 		return m_state;
 	}
 
+	/*!
+	* \brief Queues a framed message, copying it
+	* \return true If the message was queued (and sent, if the cork threshold was reached) without error
+	*
+	* Small messages are coalesced in pooled chunks, which are sent once the queued size reaches the cork threshold or when FlushMessages is called.
+	*
+	* \param data Message content
+	* \param size Message size, which must not exceed the maximum message size
+	*
+	* \remark Framed message mode must be enabled
+	*/
+	bool TcpClient::QueueMessage(const void* data, std::size_t size)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(m_framing, "framed message mode is not enabled");
+		NazaraAssert(data || size == 0, "invalid data");
+
+		const FramingConfig& config = m_framing->config;
+		if (size > config.maxMessageSize || (config.lengthPrefix == MessageLengthPrefix::UInt16 && size > std::numeric_limits<UInt16>::max()) || size > std::numeric_limits<UInt32>::max())
+		{
+			NazaraErrorFmt("message size ({0}) exceeds framing limits", size);
+			return false;
+		}
+
+		std::array<UInt8, MaxLengthPrefixSize> prefix;
+		std::size_t prefixSize = EncodeLengthPrefix(config.lengthPrefix, size, prefix.data());
+
+		bool shouldFlush = AppendToSendQueue(prefix.data(), prefixSize);
+		shouldFlush = AppendToSendQueue(data, size) || shouldFlush;
+
+		return !shouldFlush || FlushMessages();
+	}
+
+	/*!
+	* \brief Queues a framed message without copying it
+	* \return true If the message was queued (and sent, if the cork threshold was reached) without error
+	*
+	* The buffer is sent as is and given back to the framing buffer pool once sent, see AcquireMessageBuffer.
+	*
+	* \param message Message content
+	*
+	* \remark Framed message mode must be enabled
+	*/
+	bool TcpClient::QueueMessage(ByteArray&& message)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(m_framing, "framed message mode is not enabled");
+
+		MessageFraming& framing = *m_framing;
+
+		std::size_t size = message.GetSize();
+		if (size > framing.config.maxMessageSize || (framing.config.lengthPrefix == MessageLengthPrefix::UInt16 && size > std::numeric_limits<UInt16>::max()) || size > std::numeric_limits<UInt32>::max())
+		{
+			NazaraErrorFmt("message size ({0}) exceeds framing limits", size);
+			return false;
+		}
+
+		std::array<UInt8, MaxLengthPrefixSize> prefix;
+		std::size_t prefixSize = EncodeLengthPrefix(framing.config.lengthPrefix, size, prefix.data());
+
+		AppendToSendQueue(prefix.data(), prefixSize);
+
+		if (size > 0)
+		{
+			auto& segment = framing.sendQueue.emplace_back();
+			segment.data = std::move(message);
+			segment.isChunk = false;
+
+			framing.queuedSize += size;
+		}
+
+		return framing.queuedSize < framing.config.corkThreshold || FlushMessages();
+	}
+
 	/*!
 	* \brief Receives the data available
 	* \return true If data received
@@ -230,6 +548,84 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives the next framed message
+	* \return true If a whole message is available, false if no message is available yet or if an error occurred (see GetLastError)
+	*
+	* With a blocking socket this waits until a whole message has been received, with a non-blocking socket this returns false once reading would block.
+	*
+	* \param message Output view of the message, valid until the next call to ReceiveMessage or DisableFraming
+	*
+	* \remark Framed message mode must be enabled
+	* \remark Receiving a message exceeding the maximum message size closes the connection with the SocketError::Packet error
+	*/
+	bool TcpClient::ReceiveMessage(std::span<const UInt8>* message)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(m_framing, "framed message mode is not enabled");
+		NazaraAssert(message, "invalid message pointer");
+
+		MessageFraming& framing = *m_framing;
+		for (;;)
+		{
+			const UInt8* data = framing.receiveBuffer.GetConstBuffer() + framing.receiveBegin;
+			std::size_t availableSize = framing.receiveEnd - framing.receiveBegin;
+
+			std::size_t frameSize;
+			std::size_t messageSize;
+			std::size_t prefixSize;
+			switch (DecodeLengthPrefix(framing.config.lengthPrefix, data, availableSize, &prefixSize, &messageSize))
+			{
+				case LengthPrefixStatus::Complete:
+				{
+					if (messageSize > framing.config.maxMessageSize)
+					{
+						NazaraErrorFmt("received message size ({0}) exceeds maximum message size ({1}), closing connection", messageSize, framing.config.maxMessageSize);
+						Close();
+						m_lastError = SocketError::Packet;
+						return false;
+					}
+
+					frameSize = prefixSize + messageSize;
+					if (availableSize >= frameSize)
+					{
+						*message = std::span<const UInt8>(data + prefixSize, messageSize);
+
+						// Rewind as soon as everything was consumed, the view stays valid as nothing is written before the next call
+						framing.receiveBegin += frameSize;
+						if (framing.receiveBegin == framing.receiveEnd)
+							framing.receiveBegin = framing.receiveEnd = 0;
+
+						return true;
+					}
+					break;
+				}
+
+				case LengthPrefixStatus::Incomplete:
+					frameSize = availableSize + 1;
+					break;
+
+				case LengthPrefixStatus::Invalid:
+					NazaraError("received an invalid message length prefix, closing connection");
+					Close();
+					m_lastError = SocketError::Packet;
+					return false;
+			}
+
+			ReserveReceiveSpace(frameSize);
+
+			std::size_t received;
+			if (!Receive(framing.receiveBuffer.GetBuffer() + framing.receiveEnd, framing.receiveBuffer.GetSize() - framing.receiveEnd, &received))
+				return false;
+
+			if (received == 0)
+				return false; //< would block
+
+			framing.receiveEnd += received;
+		}
+	}
+
 	/*!
 	* \brief Sends the data available
 	* \return true If data sended
@@ -373,6 +769,44 @@ namespace Nz
 		return m_state;
 	}
 
+	/*!
+	* \brief Appends data to the last chunk of the send queue, acquiring new chunks from the pool when needed
+	* \return true If the queued size reached the cork threshold
+	*
+	* \param data Data to append
+	* \param size Size of the data
+	*/
+	bool TcpClient::AppendToSendQueue(const void* data, std::size_t size)
+	{
+		MessageFraming& framing = *m_framing;
+
+		const UInt8* ptr = static_cast<const UInt8*>(data);
+		std::size_t remainingSize = size;
+		while (remainingSize > 0)
+		{
+			if (framing.sendQueue.empty() || !framing.sendQueue.back().isChunk || framing.sendQueue.back().data.GetSize() >= framing.sendQueue.back().data.GetCapacity())
+			{
+				auto& segment = framing.sendQueue.emplace_back();
+				segment.data = framing.config.bufferPool->GetByteArray(framing.config.sendChunkSize);
+				segment.data.Clear(true);
+				segment.data.Reserve(framing.config.sendChunkSize);
+				segment.isChunk = true;
+			}
+
+			ByteArray& chunk = framing.sendQueue.back().data;
+
+			// Never append past capacity, chunk addresses would change
+			std::size_t copySize = std::min(remainingSize, chunk.GetCapacity() - chunk.GetSize());
+			chunk.Append(ptr, copySize);
+
+			ptr += copySize;
+			remainingSize -= copySize;
+		}
+
+		framing.queuedSize += size;
+		return framing.queuedSize >= framing.config.corkThreshold;
+	}
+
 	/*!
 	* \brief Flushes the stream
 	*/
@@ -391,6 +825,18 @@ namespace Nz
 
 		m_openMode = OpenMode::NotOpen;
 		m_peerAddress = IpAddress::Invalid;
+
+		// Keep framing enabled for the next connection but drop the state of this one
+		if (m_framing)
+		{
+			for (SendSegment& segment : m_framing->sendQueue)
+				m_framing->config.bufferPool->ReturnByteArray(std::move(segment.data));
+
+			m_framing->sendQueue.clear();
+			m_framing->queuedSize = 0;
+			m_framing->receiveBegin = 0;
+			m_framing->receiveEnd = 0;
+		}
 	}
 
 	/*!
@@ -442,6 +888,43 @@ namespace Nz
 		return received;
 	}
 
+	/*!
+	* \brief Makes room for a whole frame after the unconsumed received data
+	*
+	* The partially received frame is moved back to the beginning of the receive buffer when it would not fit,
+	* the buffer is only replaced by a bigger one from the pool when the frame is bigger than the whole buffer.
+	*
+	* \param frameSize Size of the frame (length prefix included) being received
+	*/
+	void TcpClient::ReserveReceiveSpace(std::size_t frameSize)
+	{
+		MessageFraming& framing = *m_framing;
+
+		std::size_t bufferSize = framing.receiveBuffer.GetSize();
+		if (bufferSize - framing.receiveBegin >= frameSize)
+			return;
+
+		std::size_t pendingSize = framing.receiveEnd - framing.receiveBegin;
+		if (frameSize <= bufferSize)
+		{
+			std::memmove(framing.receiveBuffer.GetBuffer(), framing.receiveBuffer.GetConstBuffer() + framing.receiveBegin, pendingSize);
+		}
+		else
+		{
+			std::size_t newSize = std::bit_ceil(frameSize);
+
+			ByteArray newBuffer = framing.config.bufferPool->GetByteArray(newSize);
+			newBuffer.Resize(std::max(newSize, newBuffer.GetCapacity()));
+			std::memcpy(newBuffer.GetBuffer(), framing.receiveBuffer.GetConstBuffer() + framing.receiveBegin, pendingSize);
+
+			framing.config.bufferPool->ReturnByteArray(std::move(framing.receiveBuffer));
+			framing.receiveBuffer = std::move(newBuffer);
+		}
+
+		framing.receiveBegin = 0;
+		framing.receiveEnd = pendingSize;
+	}
+
 	/*!
 	* \brief Resets the connection with a new socket and a peer address
 	*
@@ -65,6 +65,34 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows other sockets to bind the same port
+	* \return true If the option was applied
+	*
+	* Sockets bound to the same address with this option enabled share the incoming datagrams, the kernel dispatching them by source address.
+	* This is only supported on Linux and BSD-like systems, and must be done before binding.
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark Produces a NazaraAssert if socket is invalid
+	*/
+
+	bool UdpSocket::EnableReusePort(bool reusePort)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+		NazaraAssert(m_state != SocketState::Bound, "Socket is already bound");
+
+		if (m_isReusePortEnabled != reusePort)
+		{
+			if (!SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError))
+				return false;
+
+			m_isReusePortEnabled = reusePort;
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -230,5 +258,6 @@ namespace Nz
 
 		m_boundAddress = IpAddress::Invalid;
 		m_isBroadCastingEnabled = false;
+		m_isReusePortEnabled = false;
 	}
 }
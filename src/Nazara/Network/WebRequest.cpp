@@ -19,9 +19,7 @@ namespace Nz
 	m_webService(webService),
 	m_isUserAgentSet(false)
 	{
-		auto& libcurl = m_webService.GetCurlLibrary();
-
-		m_curlHandle = libcurl.easy_init();
+		m_curlHandle = m_webService.AcquireEasyHandle();
 	}
 #else
 	WebRequest::WebRequest(WebService& webService) :
@@ -36,7 +34,7 @@ namespace Nz
 #ifndef NAZARA_PLATFORM_WEB
 		auto& libcurl = m_webService.GetCurlLibrary();
 		if (m_curlHandle)
-			libcurl.easy_cleanup(m_curlHandle);
+			m_webService.ReleaseEasyHandle(m_curlHandle);
 
 		if (m_headerList)
 			libcurl.slist_free_all(m_headerList);
@@ -11,22 +11,89 @@
 #include <emscripten/fetch.h>
 #endif
 #include <fmt/format.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 
 namespace Nz
 {
 #ifndef NAZARA_PLATFORM_WEB
-	WebService::WebService(const CurlLibrary& curl) :
-	m_curl(curl)
+	/*!
+	* \ingroup network
+	* \class Nz::WebService
+	* \brief Network class running HTTP requests asynchronously, their result callbacks being called from Poll
+	*
+	* With WebServicePollMode::Perform, every Poll call drives all active transfers, which is the simplest mode but scales poorly with the number of concurrent requests.
+	* With WebServicePollMode::SocketEvents, libcurl sockets are watched by a SocketPoller and Poll only drives transfers whose socket is ready or whose timer expired.
+	* Poll can then also wait for a transfer to progress, making it usable from a dedicated thread.
+	*
+	* In both modes, curl easy handles are pooled and reused by new requests, which keeps their DNS and TLS session caches, and connections are kept alive by the shared multi handle.
+	*/
+
+	WebService::WebService(const CurlLibrary& curl, WebServicePollMode pollMode) :
+	m_curl(curl),
+	m_isTimerActive(false),
+	m_pollMode(pollMode)
 	{
 		curl_version_info_data* curlVersionData = m_curl.version_info(CURLVERSION_NOW);
 
 		m_userAgent = fmt::format("Nazara WebService - curl/{}", curlVersionData->version);
 
 		m_curlMulti = m_curl.multi_init();
+
+		if (m_pollMode == WebServicePollMode::SocketEvents)
+		{
+			curl_socket_callback socketCallback = [](CURL* /*handle*/, curl_socket_t socket, int what, void* userdata, void* /*socketUserdata*/) -> int
+			{
+				WebService* service = static_cast<WebService*>(userdata);
+				SocketPoller& poller = service->m_poller;
+
+				if (what == CURL_POLL_REMOVE)
+				{
+					if (poller.IsRegistered(socket))
+						poller.UnregisterSocket(socket);
+
+					return 0;
+				}
+
+				SocketPollEventFlags eventFlags;
+				if (what & CURL_POLL_IN)
+					eventFlags |= SocketPollEvent::Read;
+
+				if (what & CURL_POLL_OUT)
+					eventFlags |= SocketPollEvent::Write;
+
+				bool succeeded;
+				if (poller.IsRegistered(socket))
+					succeeded = poller.ModifySocket(socket, eventFlags);
+				else
+					succeeded = poller.RegisterSocket(socket, eventFlags, reinterpret_cast<void*>(static_cast<std::uintptr_t>(socket)));
+
+				return (succeeded) ? 0 : -1;
+			};
+
+			curl_multi_timer_callback timerCallback = [](CURLM* /*multiHandle*/, long timeoutMs, void* userdata) -> int
+			{
+				WebService* service = static_cast<WebService*>(userdata);
+
+				// A negative timeout removes the timer
+				service->m_isTimerActive = (timeoutMs >= 0);
+				if (service->m_isTimerActive)
+					service->m_timerDeadline = GetElapsedNanoseconds() + Time::Milliseconds(timeoutMs);
+
+				return 0;
+			};
+
+			m_curl.multi_setopt(m_curlMulti, CURLMOPT_SOCKETFUNCTION, socketCallback);
+			m_curl.multi_setopt(m_curlMulti, CURLMOPT_SOCKETDATA, this);
+			m_curl.multi_setopt(m_curlMulti, CURLMOPT_TIMERFUNCTION, timerCallback);
+			m_curl.multi_setopt(m_curlMulti, CURLMOPT_TIMERDATA, this);
+		}
 	}
 #else
-	WebService::WebService() :
-	m_userAgent("Nazara WebService - emscripten_fetch")
+	WebService::WebService(WebServicePollMode pollMode) :
+	m_userAgent("Nazara WebService - emscripten_fetch"),
+	m_pollMode(pollMode)
 	{
 	}
 #endif
@@ -39,56 +106,100 @@ namespace Nz
 			for (auto&& [handle, request] : m_activeRequests)
 				m_curl.multi_remove_handle(m_curlMulti, handle);
 
+			// Requests give their easy handle back to the pool when destroyed
+			m_activeRequests.clear();
+
+			for (CURL* handle : m_idleHandles)
+				m_curl.easy_cleanup(handle);
+
 			m_curl.multi_cleanup(m_curlMulti);
 		}
 #endif
 	}
 
-	bool WebService::Poll()
+	/*!
+	* \brief Drives active requests and calls the result callbacks of finished ones
+	* \return true if at least one request finished
+	*
+	* \param msTimeout Maximum time to wait for a transfer to progress in milliseconds, 0 returns immediately and -1 waits until a transfer progresses
+	*
+	* \remark Waiting is only supported with WebServicePollMode::SocketEvents, msTimeout is ignored by other modes
+	*/
+	bool WebService::Poll(int msTimeout)
 	{
 #ifndef NAZARA_PLATFORM_WEB
 		assert(m_curlMulti);
 
-		int reportedActiveRequest;
-		CURLMcode err = m_curl.multi_perform(m_curlMulti, &reportedActiveRequest);
-		if (err != CURLM_OK)
+		if (m_pollMode == WebServicePollMode::Perform)
 		{
-			NazaraError(fmt::format("[WebService] curl_multi_perform failed with {0}: {1}", UnderlyingCast(err), m_curl.multi_strerror(err)));
-			return false;
+			int reportedActiveRequest;
+			CURLMcode err = m_curl.multi_perform(m_curlMulti, &reportedActiveRequest);
+			if (err != CURLM_OK)
+			{
+				NazaraError(fmt::format("[WebService] curl_multi_perform failed with {0}: {1}", UnderlyingCast(err), m_curl.multi_strerror(err)));
+				return false;
+			}
+
+			return ProcessFinishedTransfers();
 		}
 
-		bool finishedRequest = false;
+		// Don't wait past the curl timer (or at all if there's nothing to wait for)
+		int waitTimeout = (!m_activeRequests.empty()) ? msTimeout : 0;
+		if (m_isTimerActive)
+		{
+			Int64 remainingTime = (m_timerDeadline - GetElapsedNanoseconds()).AsMilliseconds();
+			int timerTimeout = static_cast<int>(std::clamp<Int64>(remainingTime, 0, std::numeric_limits<int>::max()));
 
-		CURLMsg* m;
-		do
+			waitTimeout = (waitTimeout >= 0) ? std::min(waitTimeout, timerTimeout) : timerTimeout;
+		}
+
+		m_readyEvents.clear();
+		if (waitTimeout != 0 || !m_activeRequests.empty())
 		{
-			int msgq;
-			m = m_curl.multi_info_read(m_curlMulti, &msgq);
-			if (m && (m->msg == CURLMSG_DONE))
-			{
-				CURL* handle = m->easy_handle;
+			m_poller.Wait(waitTimeout);
 
-				auto it = m_activeRequests.find(handle);
-				assert(it != m_activeRequests.end());
+			// curl socket callback may modify the poller while we're processing events
+			std::span<const SocketPoller::ReadyEvent> readyEvents = m_poller.GetReadyEvents();
+			m_readyEvents.assign(readyEvents.begin(), readyEvents.end());
+		}
 
-				WebRequest& request = *it->second;
+		int runningHandles;
+		for (const SocketPoller::ReadyEvent& readyEvent : m_readyEvents)
+		{
+			curl_socket_t socket = static_cast<curl_socket_t>(reinterpret_cast<std::uintptr_t>(readyEvent.userdata));
 
-				if (m->data.result == CURLE_OK)
-					request.TriggerSuccessCallback();
-				else
-					request.TriggerErrorCallback(m_curl.easy_strerror(m->data.result));
+			int eventMask = 0;
+			if (readyEvent.events & SocketPollEvent::Read)
+				eventMask |= CURL_CSELECT_IN;
 
-				m_curl.multi_remove_handle(m_curlMulti, handle);
+			if (readyEvent.events & SocketPollEvent::Write)
+				eventMask |= CURL_CSELECT_OUT;
 
-				m_activeRequests.erase(handle);
+			CURLMcode err = m_curl.multi_socket_action(m_curlMulti, socket, eventMask, &runningHandles);
+			if (err != CURLM_OK)
+			{
+				NazaraError(fmt::format("[WebService] curl_multi_socket_action failed with {0}: {1}", UnderlyingCast(err), m_curl.multi_strerror(err)));
+				return false;
+			}
+		}
 
-				finishedRequest = true;
+		if (m_isTimerActive && GetElapsedNanoseconds() >= m_timerDeadline)
+		{
+			// curl sets a new timer if it needs one
+			m_isTimerActive = false;
+
+			CURLMcode err = m_curl.multi_socket_action(m_curlMulti, CURL_SOCKET_TIMEOUT, 0, &runningHandles);
+			if (err != CURLM_OK)
+			{
+				NazaraError(fmt::format("[WebService] curl_multi_socket_action failed with {0}: {1}", UnderlyingCast(err), m_curl.multi_strerror(err)));
+				return false;
 			}
 		}
-		while (m);
 
-		return finishedRequest; //< returns true if at least one request finished
+		return ProcessFinishedTransfers();
 #else
+		NazaraUnused(msTimeout);
+
 		if (m_finishedRequests.empty())
 			return false;
 
@@ -193,4 +304,93 @@ namespace Nz
 		m_activeRequests.emplace(handle, std::move(request));
 #endif
 	}
+
+#ifndef NAZARA_PLATFORM_WEB
+	/*!
+	* \brief Limits the number of simultaneously open connections
+	*
+	* Requests over this limit are kept pending until a connection is available.
+	*
+	* \param maxConnections Maximum number of open connections, 0 for unlimited
+	*/
+	void WebService::SetMaxConnections(std::size_t maxConnections)
+	{
+		m_curl.multi_setopt(m_curlMulti, CURLMOPT_MAX_TOTAL_CONNECTIONS, SafeCast<long>(maxConnections));
+	}
+
+	/*!
+	* \brief Limits the number of simultaneously open connections to a single host
+	*
+	* Requests over this limit are kept pending until a connection to the host is available, which prevents flooding a backend with concurrent requests.
+	*
+	* \param maxConnections Maximum number of open connections per host, 0 for unlimited
+	*/
+	void WebService::SetMaxHostConnections(std::size_t maxConnections)
+	{
+		m_curl.multi_setopt(m_curlMulti, CURLMOPT_MAX_HOST_CONNECTIONS, SafeCast<long>(maxConnections));
+	}
+
+	CURL* WebService::AcquireEasyHandle()
+	{
+		if (m_idleHandles.empty())
+			return m_curl.easy_init();
+
+		CURL* handle = m_idleHandles.back();
+		m_idleHandles.pop_back();
+
+		return handle;
+	}
+
+	bool WebService::ProcessFinishedTransfers()
+	{
+		bool finishedRequest = false;
+
+		CURLMsg* m;
+		do
+		{
+			int msgq;
+			m = m_curl.multi_info_read(m_curlMulti, &msgq);
+			if (m && (m->msg == CURLMSG_DONE))
+			{
+				CURL* handle = m->easy_handle;
+
+				auto it = m_activeRequests.find(handle);
+				assert(it != m_activeRequests.end());
+
+				WebRequest& request = *it->second;
+
+				if (m->data.result == CURLE_OK)
+					request.TriggerSuccessCallback();
+				else
+					request.TriggerErrorCallback(m_curl.easy_strerror(m->data.result));
+
+				m_curl.multi_remove_handle(m_curlMulti, handle);
+
+				m_activeRequests.erase(handle);
+
+				finishedRequest = true;
+			}
+		}
+		while (m);
+
+		return finishedRequest; //< returns true if at least one request finished
+	}
+
+	void WebService::ReleaseEasyHandle(CURL* handle)
+	{
+		// Resetting options keeps the DNS and TLS session caches of the handle
+		m_curl.easy_reset(handle);
+		m_idleHandles.push_back(handle);
+	}
+#else
+	void WebService::SetMaxConnections(std::size_t /*maxConnections*/)
+	{
+		// Ignored, browsers enforce their own limits
+	}
+
+	void WebService::SetMaxHostConnections(std::size_t /*maxConnections*/)
+	{
+		// Ignored, browsers enforce their own limits
+	}
+#endif
 }
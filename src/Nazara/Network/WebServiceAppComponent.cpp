@@ -8,10 +8,10 @@
 
 namespace Nz
 {
-	WebServiceAppComponent::WebServiceAppComponent(ApplicationBase& app) :
+	WebServiceAppComponent::WebServiceAppComponent(ApplicationBase& app, WebServicePollMode pollMode) :
 	ApplicationComponent(app)
 	{
-		m_webService = Network::Instance()->InstantiateWebService();
+		m_webService = Network::Instance()->InstantiateWebService(pollMode);
 	}
 
 	std::unique_ptr<WebRequest> WebServiceAppComponent::AllocateRequest()
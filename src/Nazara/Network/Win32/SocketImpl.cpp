@@ -942,6 +942,18 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraUnused(reusePort);
+
+		// SO_REUSEADDR on Windows lets sockets steal the port instead of sharing the load, there is no SO_REUSEPORT equivalent
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -8,7 +8,9 @@
 
 namespace Nz
 {
-	SocketPollerImpl::SocketPollerImpl()
+	SocketPollerImpl::SocketPollerImpl() :
+	m_eventCapacity(SocketPoller::DefaultEventCapacity),
+	m_waitIndex(0)
 	{
 		#if !NAZARA_NETWORK_POLL_SUPPORT
 		FD_ZERO(&m_readSockets);
@@ -16,14 +18,14 @@ namespace Nz
 		FD_ZERO(&m_readyToWriteSockets);
 		FD_ZERO(&m_writeSockets);
 		#endif
+
+		m_readyEvents.reserve(m_eventCapacity);
 	}
 
 	void SocketPollerImpl::Clear()
 	{
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		m_allSockets.clear();
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		m_sockets.clear();
 		#else
 		FD_ZERO(&m_readSockets);
@@ -31,24 +33,57 @@ namespace Nz
 		FD_ZERO(&m_readyToWriteSockets);
 		FD_ZERO(&m_writeSockets);
 		#endif
+
+		m_readyEvents.clear();
+		m_registrations.clear();
+	}
+
+	std::size_t SocketPollerImpl::GetEventCapacity() const
+	{
+		return m_eventCapacity;
+	}
+
+	std::span<const SocketPoller::ReadyEvent> SocketPollerImpl::GetReadyEvents() const
+	{
+		return m_readyEvents;
 	}
 
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
 		#if NAZARA_NETWORK_POLL_SUPPORT
-		return m_readyToReadSockets.count(socket) != 0;
+		auto it = m_allSockets.find(socket);
+		if (it == m_allSockets.end())
+			return false;
+
+		const Registration& registration = m_registrations[it->second];
 		#else
-		return FD_ISSET(socket, const_cast<fd_set*>(&m_readyToReadSockets)) != 0; //< FD_ISSET is not const-correct
+		auto it = m_registrations.find(socket);
+		if (it == m_registrations.end())
+			return false;
+
+		const Registration& registration = it->second;
 		#endif
+
+		return registration.waitIndex == m_waitIndex && (registration.readyEvents & SocketPollEvent::Read);
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
 		#if NAZARA_NETWORK_POLL_SUPPORT
-		return m_readyToWriteSockets.count(socket) != 0;
+		auto it = m_allSockets.find(socket);
+		if (it == m_allSockets.end())
+			return false;
+
+		const Registration& registration = m_registrations[it->second];
 		#else
-		return FD_ISSET(socket, const_cast<fd_set*>(&m_readyToWriteSockets)) != 0; //< FD_ISSET is not const-correct
+		auto it = m_registrations.find(socket);
+		if (it == m_registrations.end())
+			return false;
+
+		const Registration& registration = it->second;
 		#endif
+
+		return registration.waitIndex == m_waitIndex && (registration.readyEvents & SocketPollEvent::Write);
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
@@ -56,31 +91,56 @@ namespace Nz
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		return m_allSockets.count(socket) != 0;
 		#else
-		// FD_ISSET is not const-correct
-		return FD_ISSET(socket, const_cast<fd_set*>(&m_readSockets)) != 0 ||
-		       FD_ISSET(socket, const_cast<fd_set*>(&m_writeSockets)) != 0;
+		return m_registrations.count(socket) != 0;
+		#endif
+	}
+
+	bool SocketPollerImpl::ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	{
+		NazaraAssert(IsRegistered(socket), "Socket is not registered");
+
+		#if NAZARA_NETWORK_POLL_SUPPORT
+		m_sockets[m_allSockets[socket]].events = BuildPollEvents(eventFlags);
+		#else
+		FD_CLR(socket, &m_readSockets);
+		FD_CLR(socket, &m_writeSockets);
+
+		for (std::size_t i = 0; i < 2; ++i)
+		{
+			if ((eventFlags & ((i == 0) ? SocketPollEvent::Read : SocketPollEvent::Write)) == 0)
+				continue;
+
+			fd_set& targetSet = (i == 0) ? m_readSockets : m_writeSockets;
+			if (targetSet.fd_count >= FD_SETSIZE)
+			{
+				NazaraErrorFmt("socket count exceeding hard-coded FD_SETSIZE ({0})", FD_SETSIZE);
+				return false;
+			}
+
+			FD_SET(socket, &targetSet);
+		}
 		#endif
+
+		return true;
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode /*pollMode*/)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		// Neither WSAPoll nor select have an edge-triggered mode, level-triggered mode reports a superset of its events
+
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		PollSocket entry = {
 			socket,
-			0,
+			BuildPollEvents(eventFlags),
 			0
 		};
 
-		if (eventFlags & SocketPollEvent::Read)
-			entry.events |= POLLRDNORM;
-
-		if (eventFlags & SocketPollEvent::Write)
-			entry.events |= POLLWRNORM;
-
 		m_allSockets[socket] = m_sockets.size();
 		m_sockets.emplace_back(entry);
+
+		Registration& registration = m_registrations.emplace_back();
 		#else
 		for (std::size_t i = 0; i < 2; ++i)
 		{
@@ -88,16 +148,21 @@ namespace Nz
 				continue;
 
 			fd_set& targetSet = (i == 0) ? m_readSockets : m_writeSockets;
-			if (targetSet.fd_count > FD_SETSIZE)
+			if (targetSet.fd_count >= FD_SETSIZE)
 			{
 				NazaraErrorFmt("socket count exceeding hard-coded FD_SETSIZE ({0})", FD_SETSIZE);
+				FD_CLR(socket, &m_readSockets);
 				return false;
 			}
 
 			FD_SET(socket, &targetSet);
 		}
+
+		Registration& registration = m_registrations[socket];
 		#endif
 
+		registration.userdata = userdata;
+
 		return true;
 	}
 
@@ -117,50 +182,67 @@ namespace Nz
 
 			// Now move it properly (lastElement is invalid after the following line) and pop it
 			m_sockets[entry] = std::move(m_sockets.back());
+			m_registrations[entry] = std::move(m_registrations.back());
 		}
 		m_sockets.pop_back();
+		m_registrations.pop_back();
 
 		m_allSockets.erase(socket);
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
 		#else
 		FD_CLR(socket, &m_readSockets);
 		FD_CLR(socket, &m_readyToReadSockets);
 		FD_CLR(socket, &m_readyToWriteSockets);
 		FD_CLR(socket, &m_writeSockets);
+
+		m_registrations.erase(socket);
 		#endif
 	}
 
+	void SocketPollerImpl::SetEventCapacity(std::size_t eventCapacity)
+	{
+		// WSAPoll and select report every ready socket, capacity is only used to preallocate the ready events
+		m_eventCapacity = eventCapacity;
+		m_readyEvents.reserve(m_eventCapacity);
+	}
+
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
-		unsigned int activeSockets;
+		m_readyEvents.clear();
 
 		#if NAZARA_NETWORK_POLL_SUPPORT
-		activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
+		unsigned int activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
+
+		// Ready states of the previous wait are invalidated by incrementing the wait index
+		m_waitIndex++;
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		if (activeSockets > 0U)
 		{
-			int socketRemaining = activeSockets;
-			for (PollSocket& entry : m_sockets)
+			unsigned int socketRemaining = activeSockets;
+			for (std::size_t i = 0; i < m_sockets.size(); ++i)
 			{
+				PollSocket& entry = m_sockets[i];
 				if (!entry.revents)
 					continue;
 
-				if (entry.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
+				SocketPollEventFlags readyEvents;
+				if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
+					readyEvents |= SocketPollEvent::Read;
+
+				if (entry.revents & (POLLWRNORM | POLLERR))
+					readyEvents |= SocketPollEvent::Write;
+
+				if (readyEvents)
 				{
-					if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
-						m_readyToReadSockets.insert(entry.fd);
+					Registration& registration = m_registrations[i];
+					registration.readyEvents = readyEvents;
+					registration.waitIndex = m_waitIndex;
 
-					if (entry.revents & (POLLWRNORM | POLLERR))
-						m_readyToWriteSockets.insert(entry.fd);
+					auto& readyEvent = m_readyEvents.emplace_back();
+					readyEvent.events = readyEvents;
+					readyEvent.userdata = registration.userdata;
 				}
 				else
-				{
 					NazaraWarningFmt("Socket {0} was returned by WSAPoll without POLLRDNORM nor POLLWRNORM events (events: {1:#x})", entry.fd, entry.revents);
-					activeSockets--;
-				}
 
 				entry.revents = 0;
 
@@ -172,6 +254,9 @@ namespace Nz
 		fd_set* readSet = nullptr;
 		fd_set* writeSet = nullptr;
 
+		FD_ZERO(&m_readyToReadSockets);
+		FD_ZERO(&m_readyToWriteSockets);
+
 		if (m_readSockets.fd_count > 0)
 		{
 			m_readyToReadSockets = m_readSockets;
@@ -181,13 +266,16 @@ namespace Nz
 		if (m_writeSockets.fd_count > 0)
 		{
 			m_readyToWriteSockets = m_writeSockets;
-			readSet = &m_readyToWriteSockets;
+			writeSet = &m_readyToWriteSockets;
 		}
 
 		timeval tv;
 		tv.tv_sec = static_cast<long>(msTimeout / 1000ULL);
 		tv.tv_usec = static_cast<long>((msTimeout % 1000ULL) * 1000ULL);
 
+		// Ready states of the previous wait are invalidated by incrementing the wait index
+		m_waitIndex++;
+
 		int selectValue = ::select(0xDEADBEEF, readSet, writeSet, nullptr, (msTimeout >= 0) ? &tv : nullptr); //< The first argument is ignored on Windows
 		if (selectValue == SOCKET_ERROR)
 		{
@@ -197,13 +285,58 @@ namespace Nz
 			return 0;
 		}
 
-		assert(selectValue >= 0);
-		activeSockets = static_cast<unsigned int>(selectValue);
+		// select only leaves ready sockets in the sets
+		if (readSet)
+			ReportReadySockets(m_readyToReadSockets, SocketPollEvent::Read);
+
+		if (writeSet)
+			ReportReadySockets(m_readyToWriteSockets, SocketPollEvent::Write);
 
 		if (error)
 			*error = SocketError::NoError;
 		#endif
 
-		return activeSockets;
+		return static_cast<unsigned int>(m_readyEvents.size());
+	}
+
+	#if NAZARA_NETWORK_POLL_SUPPORT
+	short SocketPollerImpl::BuildPollEvents(SocketPollEventFlags eventFlags)
+	{
+		short events = 0;
+		if (eventFlags & SocketPollEvent::Read)
+			events |= POLLRDNORM;
+
+		if (eventFlags & SocketPollEvent::Write)
+			events |= POLLWRNORM;
+
+		return events;
+	}
+	#else
+	void SocketPollerImpl::ReportReadySockets(const fd_set& readySockets, SocketPollEvent event)
+	{
+		for (u_int i = 0; i < readySockets.fd_count; ++i)
+		{
+			auto it = m_registrations.find(readySockets.fd_array[i]);
+			assert(it != m_registrations.end());
+
+			Registration& registration = it->second;
+			if (registration.waitIndex != m_waitIndex)
+			{
+				registration.readyEvents = event;
+				registration.readyEventIndex = m_readyEvents.size();
+				registration.waitIndex = m_waitIndex;
+
+				auto& readyEvent = m_readyEvents.emplace_back();
+				readyEvent.events = event;
+				readyEvent.userdata = registration.userdata;
+			}
+			else
+			{
+				// Socket was already reported as ready to read
+				registration.readyEvents |= event;
+				m_readyEvents[registration.readyEventIndex].events |= event;
+			}
+		}
 	}
+	#endif
 }
@@ -9,9 +9,10 @@
 
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/Win32/SocketImpl.hpp>
+#include <span>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 #include <WinSock2.h>
 
@@ -25,27 +26,51 @@ namespace Nz
 
 			void Clear();
 
+			std::size_t GetEventCapacity() const;
+			std::span<const SocketPoller::ReadyEvent> GetReadyEvents() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool ModifySocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode pollMode);
 			void UnregisterSocket(SocketHandle socket);
 
+			void SetEventCapacity(std::size_t eventCapacity);
+
 			unsigned int Wait(int msTimeout, SocketError* error);
 
 		private:
+			struct Registration
+			{
+				void* userdata;
+				SocketPollEventFlags readyEvents;
+				UInt64 waitIndex = 0; //< index of the last Wait call which reported this socket
+				#if !NAZARA_NETWORK_POLL_SUPPORT
+				std::size_t readyEventIndex;
+				#endif
+			};
+
 			#if NAZARA_NETWORK_POLL_SUPPORT
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
+			static short BuildPollEvents(SocketPollEventFlags eventFlags);
+
 			std::unordered_map<SocketHandle, std::size_t> m_allSockets;
 			std::vector<PollSocket> m_sockets;
+			std::vector<Registration> m_registrations; //< same indices as m_sockets
 			#else
+			void ReportReadySockets(const fd_set& readySockets, SocketPollEvent event);
+
+			std::unordered_map<SocketHandle, Registration> m_registrations;
 			fd_set m_readSockets;
 			fd_set m_readyToReadSockets;
 			fd_set m_readyToWriteSockets;
 			fd_set m_writeSockets;
 			#endif
+			std::vector<SocketPoller::ReadyEvent> m_readyEvents;
+			std::size_t m_eventCapacity;
+			UInt64 m_waitIndex;
 	};
 }
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/OpenGLRenderer/OpenGLCommandBuffer.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLCommandPool.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLComputePipeline.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLFboFramebuffer.hpp>
@@ -38,6 +39,12 @@ namespace Nz
 					attrib.type = GL_FLOAT;
 					return;
 
+				case ComponentType::Half2:
+					attrib.normalized = GL_FALSE;
+					attrib.size = 2;
+					attrib.type = GL_HALF_FLOAT;
+					return;
+
 				case ComponentType::Int1:
 				case ComponentType::Int2:
 				case ComponentType::Int3:
@@ -47,6 +54,18 @@ namespace Nz
 					attrib.type = GL_INT;
 					return;
 
+				case ComponentType::Short2Norm:
+					attrib.normalized = GL_TRUE;
+					attrib.size = 2;
+					attrib.type = GL_SHORT;
+					return;
+
+				case ComponentType::Short4Norm:
+					attrib.normalized = GL_TRUE;
+					attrib.size = 4;
+					attrib.type = GL_SHORT;
+					return;
+
 				case ComponentType::Double1:
 				case ComponentType::Double2:
 				case ComponentType::Double3:
@@ -173,6 +192,14 @@ namespace Nz
 		context->CopyTexture(*command.source, *command.target, command.sourceBox, command.targetPoint);
 	}
 
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, const CopyTextureFromMemoryCommand& command)
+	{
+		// Upload pool memory is regular memory on OpenGL, so this is a plain texture update
+		OpenGLTexture* target = const_cast<OpenGLTexture*>(command.target);
+		if (!target->Update(command.memory, command.targetBox, 0, 0, command.targetLevel))
+			NazaraErrorFmt("failed to update texture level #{0}", command.targetLevel);
+	}
+
 	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DispatchCommand& command)
 	{
 		if (!context->glDispatchCompute)
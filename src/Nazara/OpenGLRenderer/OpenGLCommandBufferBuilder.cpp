@@ -136,6 +136,13 @@ namespace Nz
 		m_commandBuffer.CopyTexture(sourceTexture, fromBox, targetTexture, toPos);
 	}
 
+	void OpenGLCommandBufferBuilder::CopyTexture(const UploadPool::Allocation& allocation, const Texture& toTexture, const Boxui& toBox, UInt8 toLevel, TextureLayout /*toLayout*/)
+	{
+		const OpenGLTexture& targetTexture = SafeCast<const OpenGLTexture&>(toTexture);
+
+		m_commandBuffer.CopyTexture(allocation, targetTexture, toBox, toLevel);
+	}
+
 	void OpenGLCommandBufferBuilder::Dispatch(UInt32 workgroupX, UInt32 workgroupY, UInt32 workgroupZ)
 	{
 		m_commandBuffer.Dispatch(workgroupX, workgroupY, workgroupZ);
@@ -295,11 +295,35 @@ namespace Nz
 			case PixelFormat::RGBA32UI:
 				return usage == TextureUsage::ColorAttachment || usage == TextureUsage::InputAttachment || usage == TextureUsage::ShaderSampling || usage == TextureUsage::ShaderReadWrite || usage == TextureUsage::TransferDestination || usage == TextureUsage::TransferSource;
 
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			case PixelFormat::BC6H:
+			case PixelFormat::BC7:
+			case PixelFormat::BC7_SRGB:
 			case PixelFormat::DXT1:
 			case PixelFormat::DXT3:
 			case PixelFormat::DXT5:
 			{
-				if (!m_referenceContext->IsExtensionSupported(GL::Extension::TextureCompressionS3tc))
+				GL::Extension extension;
+				switch (format)
+				{
+					case PixelFormat::BC4:
+					case PixelFormat::BC5:
+						extension = GL::Extension::TextureCompressionRgtc;
+						break;
+
+					case PixelFormat::BC6H:
+					case PixelFormat::BC7:
+					case PixelFormat::BC7_SRGB:
+						extension = GL::Extension::TextureCompressionBptc;
+						break;
+
+					default:
+						extension = GL::Extension::TextureCompressionS3tc;
+						break;
+				}
+
+				if (!m_referenceContext->IsExtensionSupported(extension))
 					return false;
 
 				return usage == TextureUsage::InputAttachment || usage == TextureUsage::ShaderSampling || usage == TextureUsage::TransferDestination || usage == TextureUsage::TransferSource;
@@ -148,6 +148,9 @@ namespace Nz
 
 		const GL::Context& context = m_texture.EnsureDeviceContext();
 
+		if (PixelFormatInfo::IsCompressed(m_textureInfo.pixelFormat))
+			return UpdateCompressed(context, format->internalFormat, ptr, box, level);
+
 		UInt8 bpp = PixelFormatInfo::GetBytesPerPixel(m_textureInfo.pixelFormat);
 		if (bpp % 8 == 0)
 			context.glPixelStorei(GL_UNPACK_ALIGNMENT, 8);
@@ -179,7 +182,7 @@ namespace Nz
 
 			case ImageType::Cubemap:
 			{
-				std::size_t faceSize = PixelFormatInfo::ComputeSize(m_textureInfo.pixelFormat, m_textureInfo.width, m_textureInfo.height, 1);
+				std::size_t faceSize = PixelFormatInfo::ComputeSize(m_textureInfo.pixelFormat, (srcWidth > 0) ? srcWidth : box.width, (srcHeight > 0) ? srcHeight : box.height, 1);
 				const UInt8* facePtr = static_cast<const UInt8*>(ptr);
 
 				for (GL::TextureTarget face : { GL::TextureTarget::CubemapPositiveX, GL::TextureTarget::CubemapNegativeX, GL::TextureTarget::CubemapPositiveY, GL::TextureTarget::CubemapNegativeY, GL::TextureTarget::CubemapPositiveZ, GL::TextureTarget::CubemapNegativeZ })
@@ -203,6 +206,57 @@ namespace Nz
 		return true;
 	}
 
+	bool OpenGLTexture::UpdateCompressed(const GL::Context& context, GLenum internalFormat, const void* ptr, const Boxui& box, UInt8 level)
+	{
+		// Compressed data is uploaded block by block, source data must be tightly packed
+		context.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		context.glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		context.glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+
+		GLsizei imageSize = SafeCast<GLsizei>(PixelFormatInfo::ComputeSize(m_textureInfo.pixelFormat, box.width, box.height, box.depth));
+
+		switch (m_textureInfo.type)
+		{
+			case ImageType::E1D:
+			case ImageType::E1D_Array:
+			case ImageType::E2D:
+				m_texture.CompressedTexSubImage2D(GL::TextureTarget::Target2D, level, box.x, box.y, box.width, box.height, internalFormat, imageSize, ptr);
+				break;
+
+			case ImageType::E2D_Array:
+				m_texture.CompressedTexSubImage3D(GL::TextureTarget::Target2D_Array, level, box.x, box.y, box.z, box.width, box.height, box.depth, internalFormat, imageSize, ptr);
+				break;
+
+			case ImageType::E3D:
+				m_texture.CompressedTexSubImage3D(GL::TextureTarget::Target3D, level, box.x, box.y, box.z, box.width, box.height, box.depth, internalFormat, imageSize, ptr);
+				break;
+
+			case ImageType::Cubemap:
+			{
+				GLsizei faceSize = SafeCast<GLsizei>(PixelFormatInfo::ComputeSize(m_textureInfo.pixelFormat, box.width, box.height, 1));
+				const UInt8* facePtr = static_cast<const UInt8*>(ptr);
+
+				for (GL::TextureTarget face : { GL::TextureTarget::CubemapPositiveX, GL::TextureTarget::CubemapNegativeX, GL::TextureTarget::CubemapPositiveY, GL::TextureTarget::CubemapNegativeY, GL::TextureTarget::CubemapPositiveZ, GL::TextureTarget::CubemapNegativeZ })
+				{
+					m_texture.CompressedTexSubImage2D(face, level, box.x, box.y, box.width, box.height, internalFormat, faceSize, facePtr);
+					facePtr += faceSize;
+				}
+				break;
+			}
+
+			default:
+				break;
+		}
+
+		if (!context.DidLastCallSucceed())
+		{
+			NazaraError("compressed texture update failed");
+			return false;
+		}
+
+		return true;
+	}
+
 	void OpenGLTexture::UpdateDebugName(std::string_view name)
 	{
 		m_texture.SetDebugName(name);
@@ -539,6 +539,22 @@ namespace Nz::GL
 		else if (m_supportedExtensions.count("GL_ARB_shader_storage_buffer_object"))
 			m_extensionStatus[Extension::StorageBuffers] = ExtensionStatus::ARB;
 
+		// Texture compression (BPTC)
+		if (m_params.type == ContextType::OpenGL && glVersion >= 420)
+			m_extensionStatus[Extension::TextureCompressionBptc] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_texture_compression_bptc"))
+			m_extensionStatus[Extension::TextureCompressionBptc] = ExtensionStatus::ARB;
+		else if (m_supportedExtensions.count("GL_EXT_texture_compression_bptc"))
+			m_extensionStatus[Extension::TextureCompressionBptc] = ExtensionStatus::EXT;
+
+		// Texture compression (RGTC)
+		if (m_params.type == ContextType::OpenGL && glVersion >= 300)
+			m_extensionStatus[Extension::TextureCompressionRgtc] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_texture_compression_rgtc"))
+			m_extensionStatus[Extension::TextureCompressionRgtc] = ExtensionStatus::ARB;
+		else if (m_supportedExtensions.count("GL_EXT_texture_compression_rgtc"))
+			m_extensionStatus[Extension::TextureCompressionRgtc] = ExtensionStatus::EXT;
+
 		// Texture compression (S3tc)
 		if (m_supportedExtensions.count("GL_EXT_texture_compression_s3tc"))
 			m_extensionStatus[Extension::TextureCompressionS3tc] = ExtensionStatus::EXT;
@@ -82,10 +82,27 @@ namespace Nz
 				break;
 		}
 
-		if (!params.buildMipmaps)
+		// Mipmaps baked in the image (see Image::GenerateMipmaps) are uploaded instead of being generated by the GPU
+		// GPUs cannot render to block compressed formats, so these never get generated mipmaps
+		bool hasMipmaps = (image.GetLevelCount() > 1);
+		bool buildMipmaps = params.buildMipmaps && !hasMipmaps && !PixelFormatInfo::IsCompressed(image.GetFormat());
+		if (!buildMipmaps)
 			texParams.levelCount = image.GetLevelCount();
 
-		std::shared_ptr<Texture> texture = params.renderDevice->InstantiateTexture(texParams, image.GetConstPixels(), params.buildMipmaps);
+		std::shared_ptr<Texture> texture = params.renderDevice->InstantiateTexture(texParams, image.GetConstPixels(), buildMipmaps);
+
+		for (UInt8 level = 1; level < image.GetLevelCount(); ++level)
+		{
+			Boxui levelBox(Vector3ui::Zero(), image.GetSize(level));
+			if (image.GetType() == ImageType::Cubemap)
+				levelBox.depth = 6;
+
+			if (!texture->Update(image.GetConstPixels(0, 0, 0, level), levelBox, 0, 0, level))
+			{
+				NazaraErrorFmt("failed to upload level #{0}", level);
+				return {};
+			}
+		}
 
 		texture->SetFilePath(image.GetFilePath());
 		if (std::string debugName = PathToString(texture->GetFilePath()); !debugName.empty())
@@ -6,9 +6,16 @@
 #include <Nazara/Core/Export.hpp>
 #include <Nazara/Core/GuillotineImageAtlas.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/TextRenderer/FontData.hpp>
 #include <Nazara/TextRenderer/FontGlyph.hpp>
 #include <Nazara/TextRenderer/TextRenderer.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
 
 namespace Nz
 {
@@ -17,6 +24,94 @@ namespace Nz
 		const UInt8 r_sansationRegular[] = {
 			#include <Nazara/TextRenderer/Resources/Fonts/OpenSans-Regular.ttf.h>
 		};
+
+		// Distance field glyphs are rasterized at a higher resolution to locate their edge precisely
+		constexpr int DistanceFieldSupersampling = 4;
+
+		// Below this count, rasterizing glyphs on the calling thread is faster than waking workers up
+		constexpr std::size_t MinGlyphPerWorker = 16;
+
+		int FloorDiv(int value, int divisor)
+		{
+			return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+		}
+
+		// Squared euclidean distance transform of a sampled function (Felzenszwalb & Huttenlocher), applied in place to one row or column
+		void DistanceTransform(float* values, std::size_t count, std::size_t stride, std::vector<float>& distances, std::vector<std::size_t>& parabolas, std::vector<float>& boundaries)
+		{
+			constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+			distances.resize(count);
+			parabolas.resize(count);
+			boundaries.resize(count + 1);
+
+			std::size_t k = 0;
+			parabolas[0] = 0;
+			boundaries[0] = -Infinity;
+			boundaries[1] = Infinity;
+
+			for (std::size_t q = 1; q < count; ++q)
+			{
+				float value = values[q * stride];
+				if (value == Infinity)
+					continue;
+
+				for (;;)
+				{
+					std::size_t p = parabolas[k];
+					float pValue = values[p * stride];
+
+					float intersection = (pValue == Infinity) ? -Infinity : ((value + float(q * q)) - (pValue + float(p * p))) / (2.f * (float(q) - float(p)));
+					if (intersection <= boundaries[k] && k > 0)
+					{
+						k--;
+						continue;
+					}
+
+					if (pValue == Infinity)
+					{
+						// The first sample was infinite, replace it
+						parabolas[k] = q;
+						boundaries[k + 1] = Infinity;
+					}
+					else
+					{
+						k++;
+						parabolas[k] = q;
+						boundaries[k] = intersection;
+						boundaries[k + 1] = Infinity;
+					}
+					break;
+				}
+			}
+
+			k = 0;
+			for (std::size_t q = 0; q < count; ++q)
+			{
+				while (boundaries[k + 1] < float(q))
+					k++;
+
+				std::size_t p = parabolas[k];
+				float pValue = values[p * stride];
+				distances[q] = (pValue == Infinity) ? Infinity : (float(q) - float(p)) * (float(q) - float(p)) + pValue;
+			}
+
+			for (std::size_t q = 0; q < count; ++q)
+				values[q * stride] = distances[q];
+		}
+
+		void DistanceTransform(std::vector<float>& values, std::size_t width, std::size_t height)
+		{
+			std::vector<float> distances;
+			std::vector<std::size_t> parabolas;
+			std::vector<float> boundaries;
+
+			for (std::size_t x = 0; x < width; ++x)
+				DistanceTransform(&values[x], height, width, distances, parabolas, boundaries);
+
+			for (std::size_t y = 0; y < height; ++y)
+				DistanceTransform(&values[y * width], width, 1, distances, parabolas, boundaries);
+		}
 	}
 
 	bool FontParams::IsValid() const
@@ -25,6 +120,7 @@ namespace Nz
 	}
 
 	Font::Font() :
+	m_glyphMode(FontGlyphMode::Bitmap),
 	m_glyphBorder(s_defaultGlyphBorder),
 	m_minimumStepSize(s_defaultMinimumStepSize)
 	{
@@ -48,16 +144,43 @@ namespace Nz
 			else
 			{
 				// At least one font is using this atlas, remove our glyphes
+				// Glyphs simulating a style share the atlas rectangle of the glyph they were made from, free each rectangle once
+				std::vector<std::pair<std::size_t, Rectui>> atlasRects;
 				for (auto&& [glyphKey, glyphMap] : m_glyphes)
 				{
 					NazaraUnused(glyphKey);
 					for (auto&& [character, glyph] : glyphMap)
 					{
 						NazaraUnused(character);
-						m_atlas->Free(&glyph.atlasRect, &glyph.layerIndex, 1);
+						if (!glyph.valid || glyph.atlasRect.width == 0 || glyph.atlasRect.height == 0)
+							continue;
+
+						// Atlas rectangles include the glyph border
+						Rectui atlasRect = glyph.atlasRect;
+						atlasRect.x -= m_glyphBorder;
+						atlasRect.y -= m_glyphBorder;
+						atlasRect.width += m_glyphBorder * 2;
+						atlasRect.height += m_glyphBorder * 2;
+
+						atlasRects.emplace_back(glyph.layerIndex, atlasRect);
 					}
 				}
 
+				std::sort(atlasRects.begin(), atlasRects.end(), [](const auto& lhs, const auto& rhs)
+				{
+					return std::tie(lhs.first, lhs.second.x, lhs.second.y) < std::tie(rhs.first, rhs.second.x, rhs.second.y);
+				});
+
+				atlasRects.erase(std::unique(atlasRects.begin(), atlasRects.end()), atlasRects.end());
+
+				if (!atlasRects.empty())
+				{
+					SparsePtr<const Rectui> rects(&atlasRects[0].second, sizeof(atlasRects[0]));
+					SparsePtr<std::size_t> layers(&atlasRects[0].first, sizeof(atlasRects[0]));
+
+					m_atlas->Free(rects, layers, atlasRects.size());
+				}
+
 				// Free all cached glyphes
 				m_glyphes.clear();
 
@@ -100,6 +223,7 @@ namespace Nz
 			ClearGlyphCache();
 
 			m_data.reset();
+			m_workerData.clear();
 			m_kerningCache.clear();
 			m_sizeInfoCache.clear();
 		}
@@ -118,6 +242,8 @@ namespace Nz
 
 	std::size_t Font::GetCachedGlyphCount(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const
 	{
+		GetCachedGlyphParameters(characterSize, outlineThickness);
+
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
 		auto it = m_glyphes.find(key);
 		if (it == m_glyphes.end())
@@ -135,6 +261,38 @@ namespace Nz
 		return count;
 	}
 
+	/*!
+	* \brief Gets the distance field value of the glyph edge, which is moved outward to draw outlines
+	* \return Edge value for distance field glyphs, 0.5 (the middle of the coverage) for bitmap glyphs
+	*/
+	float Font::GetDistanceFieldEdge(unsigned int characterSize, float outlineThickness) const
+	{
+		if (m_glyphMode != FontGlyphMode::DistanceField)
+			return 0.5f;
+
+		// Distances are encoded from 0.5 (edge) to 0 (spread pixels outside the glyph), at glyph size
+		float spread = float(m_distanceFieldParams.spread) * GetGlyphScale(characterSize);
+		return std::max(0.5f - outlineThickness / (2.f * spread), 0.f);
+	}
+
+	const Font::DistanceFieldParams& Font::GetDistanceFieldParams() const
+	{
+		return m_distanceFieldParams;
+	}
+
+	/*!
+	* \brief Gets the half width of the antialiasing ramp of distance field glyphs, for one pixel at characterSize
+	* \return Smoothing width for distance field glyphs, 0.5 for bitmap glyphs (which makes the distance field threshold a no-op)
+	*/
+	float Font::GetDistanceFieldSmoothing(unsigned int characterSize) const
+	{
+		if (m_glyphMode != FontGlyphMode::DistanceField)
+			return 0.5f;
+
+		float spread = float(m_distanceFieldParams.spread) * GetGlyphScale(characterSize);
+		return 1.f / (4.f * spread);
+	}
+
 	std::string Font::GetFamilyName() const
 	{
 		NazaraAssert(IsValid(), "invalid font");
@@ -166,6 +324,8 @@ namespace Nz
 
 	const Font::Glyph& Font::GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
+		GetCachedGlyphParameters(characterSize, outlineThickness);
+
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
 		return PrecacheGlyph(m_glyphes[key], characterSize, style, outlineThickness, character);
 	}
@@ -175,6 +335,23 @@ namespace Nz
 		return m_glyphBorder;
 	}
 
+	FontGlyphMode Font::GetGlyphMode() const
+	{
+		return m_glyphMode;
+	}
+
+	/*!
+	* \brief Gets the factor to apply to glyph metrics (bounds and advance) for a character size
+	* \return Ratio between characterSize and the size of distance field glyphs, 1 for bitmap glyphs
+	*/
+	float Font::GetGlyphScale(unsigned int characterSize) const
+	{
+		if (m_glyphMode != FontGlyphMode::DistanceField)
+			return 1.f;
+
+		return float(characterSize) / float(m_distanceFieldParams.glyphSize);
+	}
+
 	unsigned int Font::GetMinimumStepSize() const
 	{
 		return m_minimumStepSize;
@@ -220,25 +397,172 @@ namespace Nz
 
 	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
+		GetCachedGlyphParameters(characterSize, outlineThickness);
+
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
 		return PrecacheGlyph(m_glyphes[key], characterSize, style, outlineThickness, character).valid;
 	}
 
-	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet) const
+	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet, TaskScheduler* taskScheduler) const
 	{
 		NazaraAssert(!characterSet.empty(), "empty character set");
+		NazaraAssert(m_atlas, "font has no atlas");
 
-		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		auto& glyphMap = m_glyphes[key];
+		GetCachedGlyphParameters(characterSize, outlineThickness);
+
+		// Unsupported styles are simulated from the supported glyphs, which are the ones to rasterize
+		TextStyleFlags supportedStyle = style;
+		float supportedOutlineThickness = outlineThickness;
+		GetSupportedGlyphParameters(supportedStyle, supportedOutlineThickness);
 
-		IterateOnCodepoints(characterSet, [&](std::u32string_view characters)
+		auto& supportedGlyphMap = m_glyphes[ComputeKey(characterSize, supportedStyle, supportedOutlineThickness)];
+
+		struct PendingGlyph
 		{
-			for (char32_t character : characters)
-				PrecacheGlyph(glyphMap, characterSize, style, outlineThickness, character);
+			Image image;
+			Rectui rect;
+			Glyph* glyph;
+			std::size_t layerIndex;
+			bool flipped;
+		};
+
+		std::vector<char32_t> characters;
+		std::vector<Glyph*> glyphs;
+		IterateOnCodepoints(characterSet, [&](std::u32string_view codepoints)
+		{
+			for (char32_t character : codepoints)
+			{
+				auto [it, inserted] = supportedGlyphMap.try_emplace(character);
+				if (!inserted)
+					continue;
+
+				Glyph& glyph = it->second;
+				glyph.fauxOutlineThickness = 0.f;
+				glyph.requireFauxBold = false;
+				glyph.requireFauxItalic = false;
+				glyph.valid = false;
+
+				characters.push_back(character);
+				glyphs.push_back(&glyph);
+			}
 
 			return true;
 		});
 
+		if (!characters.empty())
+		{
+			std::vector<FontGlyph> fontGlyphs(characters.size());
+			std::vector<UInt8> extracted(characters.size()); //< not a std::vector<bool> as it is written concurrently
+
+			// FontData instances cannot be used concurrently, each worker gets its own
+			std::size_t workerCount = 1;
+			if (taskScheduler)
+			{
+				workerCount = std::min<std::size_t>(taskScheduler->GetWorkerCount(), characters.size() / MinGlyphPerWorker);
+				while (m_workerData.size() + 1 < workerCount)
+				{
+					std::unique_ptr<FontData> workerData = m_data->Clone();
+					if (!workerData)
+						break;
+
+					m_workerData.push_back(std::move(workerData));
+				}
+
+				workerCount = std::max<std::size_t>(std::min(workerCount, m_workerData.size() + 1), 1);
+			}
+
+			auto ExtractGlyphs = [&](FontData& fontData, std::size_t firstIndex)
+			{
+				// Interleave glyphs between workers to balance simple and complex glyphs
+				for (std::size_t i = firstIndex; i < characters.size(); i += workerCount)
+					extracted[i] = ExtractCachedGlyph(fontData, characterSize, characters[i], supportedStyle, supportedOutlineThickness, &fontGlyphs[i]);
+			};
+
+			if (workerCount > 1)
+			{
+				// Each job runs exactly once, so a FontData is never used by two threads at the same time
+				taskScheduler->ParallelFor(workerCount, [&](std::size_t workerIndex)
+				{
+					FontData& fontData = (workerIndex == 0) ? *m_data : *m_workerData[workerIndex - 1];
+					ExtractGlyphs(fontData, workerIndex);
+				});
+			}
+			else
+				ExtractGlyphs(*m_data, 0);
+
+			// Insert every rectangle at once, letting the atlas pack them together
+			std::vector<PendingGlyph> pendingGlyphs;
+			for (std::size_t i = 0; i < characters.size(); ++i)
+			{
+				if (!extracted[i])
+				{
+					NazaraWarningFmt("failed to extract glyph \"{0}\"", FromUtf32String(std::u32string_view(&characters[i], 1)));
+					continue;
+				}
+
+				FontGlyph& fontGlyph = fontGlyphs[i];
+
+				Glyph& glyph = *glyphs[i];
+				glyph.aabb = fontGlyph.aabb;
+				glyph.advance = fontGlyph.advance;
+				glyph.atlasRect.width = 0;
+				glyph.atlasRect.height = 0;
+
+				if (fontGlyph.image.IsValid() && fontGlyph.image.GetWidth() > 0 && fontGlyph.image.GetHeight() > 0)
+				{
+					// Add a small border to prevent GPU to sample another glyph pixel
+					PendingGlyph& pendingGlyph = pendingGlyphs.emplace_back();
+					pendingGlyph.glyph = &glyph;
+					pendingGlyph.rect = Rectui(0, 0, fontGlyph.image.GetWidth() + m_glyphBorder * 2, fontGlyph.image.GetHeight() + m_glyphBorder * 2);
+					pendingGlyph.image = std::move(fontGlyph.image);
+				}
+				else
+					glyph.valid = true;
+			}
+
+			if (!pendingGlyphs.empty())
+			{
+				SparsePtr<const Image> images(&pendingGlyphs[0].image, sizeof(PendingGlyph));
+				SparsePtr<Rectui> rects(&pendingGlyphs[0].rect, sizeof(PendingGlyph));
+				SparsePtr<bool> flipped(&pendingGlyphs[0].flipped, sizeof(PendingGlyph));
+				SparsePtr<std::size_t> layerIndices(&pendingGlyphs[0].layerIndex, sizeof(PendingGlyph));
+
+				if (!m_atlas->Insert(images, rects, flipped, layerIndices, pendingGlyphs.size()))
+				{
+					NazaraError("failed to insert glyphs into atlas");
+					return false;
+				}
+
+				for (PendingGlyph& pendingGlyph : pendingGlyphs)
+				{
+					Glyph& glyph = *pendingGlyph.glyph;
+
+					// Recenter and remove glyph border
+					glyph.atlasRect = pendingGlyph.rect;
+					glyph.atlasRect.x += m_glyphBorder;
+					glyph.atlasRect.y += m_glyphBorder;
+					glyph.atlasRect.width -= m_glyphBorder * 2;
+					glyph.atlasRect.height -= m_glyphBorder * 2;
+					glyph.flipped = pendingGlyph.flipped;
+					glyph.layerIndex = pendingGlyph.layerIndex;
+					glyph.valid = true;
+				}
+			}
+		}
+
+		// Simulated styles reference the glyphs we just cached
+		if (style != supportedStyle || outlineThickness != supportedOutlineThickness)
+		{
+			auto& glyphMap = m_glyphes[ComputeKey(characterSize, style, outlineThickness)];
+			IterateOnCodepoints(characterSet, [&](std::u32string_view codepoints)
+			{
+				for (char32_t character : codepoints)
+					PrecacheGlyph(glyphMap, characterSize, style, outlineThickness, character);
+
+				return true;
+			});
+		}
+
 		return true;
 	}
 
@@ -253,17 +577,32 @@ namespace Nz
 			{
 				m_atlasClearedSlot.Connect(m_atlas->OnAtlasCleared, this, &Font::OnAtlasCleared);
 				m_atlasLayerChangeSlot.Connect(m_atlas->OnAtlasLayerChange, this, &Font::OnAtlasLayerChange);
+				m_atlasRectsRelocatedSlot.Connect(m_atlas->OnAtlasRectsRelocated, this, &Font::OnAtlasRectsRelocated);
 			}
 			else
 			{
 				m_atlasClearedSlot.Disconnect();
 				m_atlasLayerChangeSlot.Disconnect();
+				m_atlasRectsRelocatedSlot.Disconnect();
 			}
 
 			OnFontAtlasChanged(this);
 		}
 	}
 
+	void Font::SetDistanceFieldParams(const DistanceFieldParams& params)
+	{
+		NazaraAssert(params.glyphSize > 0, "distance field glyph size cannot be zero");
+		NazaraAssert(params.spread > 0, "distance field spread cannot be zero");
+
+		if (m_distanceFieldParams.glyphSize != params.glyphSize || m_distanceFieldParams.spread != params.spread)
+		{
+			m_distanceFieldParams = params;
+			if (m_glyphMode == FontGlyphMode::DistanceField)
+				ClearGlyphCache();
+		}
+	}
+
 	void Font::SetGlyphBorder(unsigned int borderSize)
 	{
 		if (m_glyphBorder != borderSize)
@@ -273,6 +612,15 @@ namespace Nz
 		}
 	}
 
+	void Font::SetGlyphMode(FontGlyphMode glyphMode)
+	{
+		if (m_glyphMode != glyphMode)
+		{
+			m_glyphMode = glyphMode;
+			ClearGlyphCache();
+		}
+	}
+
 	void Font::SetMinimumStepSize(unsigned int minimumStepSize)
 	{
 		if (m_minimumStepSize != minimumStepSize)
@@ -373,6 +721,129 @@ namespace Nz
 		return (sizeStylePart << 32) | Nz::BitCast<Nz::UInt32>(outlineThickness);
 	}
 
+	bool Font::ExtractCachedGlyph(FontData& fontData, unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* glyph) const
+	{
+		if (m_glyphMode == FontGlyphMode::DistanceField)
+			return ExtractDistanceFieldGlyph(fontData, character, style, glyph);
+		else
+			return fontData.ExtractGlyph(characterSize, character, style, outlineThickness, glyph);
+	}
+
+	bool Font::ExtractDistanceFieldGlyph(FontData& fontData, char32_t character, TextStyleFlags style, FontGlyph* glyph) const
+	{
+		constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+		FontGlyph coverageGlyph;
+		if (!fontData.ExtractGlyph(m_distanceFieldParams.glyphSize * DistanceFieldSupersampling, character, style, 0.f, &coverageGlyph))
+			return false;
+
+		glyph->advance = (coverageGlyph.advance + DistanceFieldSupersampling / 2) / DistanceFieldSupersampling;
+
+		if (!coverageGlyph.image.IsValid())
+		{
+			glyph->aabb = Recti(FloorDiv(coverageGlyph.aabb.x, DistanceFieldSupersampling), FloorDiv(coverageGlyph.aabb.y, DistanceFieldSupersampling), 0, 0);
+			glyph->image.Destroy();
+			return true;
+		}
+
+		int spread = SafeCast<int>(m_distanceFieldParams.spread);
+		int coverageWidth = SafeCast<int>(coverageGlyph.image.GetWidth());
+		int coverageHeight = SafeCast<int>(coverageGlyph.image.GetHeight());
+
+		// The distance field covers the glyph and spread pixels around it, at glyph size
+		int left = FloorDiv(coverageGlyph.aabb.x, DistanceFieldSupersampling) - spread;
+		int top = FloorDiv(coverageGlyph.aabb.y, DistanceFieldSupersampling) - spread;
+		int right = -FloorDiv(-(coverageGlyph.aabb.x + coverageWidth), DistanceFieldSupersampling) + spread;
+		int bottom = -FloorDiv(-(coverageGlyph.aabb.y + coverageHeight), DistanceFieldSupersampling) + spread;
+
+		std::size_t fieldWidth = SafeCast<std::size_t>(right - left);
+		std::size_t fieldHeight = SafeCast<std::size_t>(bottom - top);
+
+		// Compute distances to the glyph (outside) and to its exterior (inside) at the rasterization resolution
+		std::size_t width = fieldWidth * DistanceFieldSupersampling;
+		std::size_t height = fieldHeight * DistanceFieldSupersampling;
+		int offsetX = left * DistanceFieldSupersampling - coverageGlyph.aabb.x;
+		int offsetY = top * DistanceFieldSupersampling - coverageGlyph.aabb.y;
+
+		std::vector<float> outsideDistances(width * height);
+		std::vector<float> insideDistances(width * height);
+
+		const UInt8* coverage = coverageGlyph.image.GetConstPixels();
+		for (std::size_t y = 0; y < height; ++y)
+		{
+			int coverageY = int(y) + offsetY;
+			for (std::size_t x = 0; x < width; ++x)
+			{
+				int coverageX = int(x) + offsetX;
+
+				bool inside = false;
+				if (coverageX >= 0 && coverageX < coverageWidth && coverageY >= 0 && coverageY < coverageHeight)
+					inside = coverage[coverageY * coverageWidth + coverageX] >= 128;
+
+				outsideDistances[y * width + x] = (inside) ? 0.f : Infinity;
+				insideDistances[y * width + x] = (inside) ? Infinity : 0.f;
+			}
+		}
+
+		DistanceTransform(outsideDistances, width, height);
+		DistanceTransform(insideDistances, width, height);
+
+		auto SignedDistance = [&](std::size_t x, std::size_t y)
+		{
+			// Distances are measured between pixel centers, the edge lies half a pixel away from them
+			std::size_t index = y * width + x;
+			if (insideDistances[index] > 0.f)
+				return -(std::sqrt(insideDistances[index]) - 0.5f);
+			else
+				return std::sqrt(outsideDistances[index]) - 0.5f;
+		};
+
+		glyph->aabb = Recti(left, top, SafeCast<int>(fieldWidth), SafeCast<int>(fieldHeight));
+		glyph->image.Create(ImageType::E2D, PixelFormat::A8, SafeCast<unsigned int>(fieldWidth), SafeCast<unsigned int>(fieldHeight));
+
+		UInt8* pixels = glyph->image.GetPixels();
+		for (std::size_t y = 0; y < fieldHeight; ++y)
+		{
+			for (std::size_t x = 0; x < fieldWidth; ++x)
+			{
+				// The center of a distance field texel lies between the four central pixels of its block
+				std::size_t centerX = x * DistanceFieldSupersampling + DistanceFieldSupersampling / 2;
+				std::size_t centerY = y * DistanceFieldSupersampling + DistanceFieldSupersampling / 2;
+
+				float distance = 0.25f * (SignedDistance(centerX - 1, centerY - 1) + SignedDistance(centerX, centerY - 1) + SignedDistance(centerX - 1, centerY) + SignedDistance(centerX, centerY));
+				distance /= DistanceFieldSupersampling;
+
+				// 1 inside the glyph, 0.5 on its edge and 0 at spread pixels outside of it
+				float value = std::clamp(0.5f - distance / (2.f * float(spread)), 0.f, 1.f);
+				*pixels++ = static_cast<UInt8>(value * 255.f + 0.5f);
+			}
+		}
+
+		return true;
+	}
+
+	void Font::GetCachedGlyphParameters(unsigned int& characterSize, float& outlineThickness) const
+	{
+		// A single distance field glyph serves every character size and outline thickness
+		if (m_glyphMode == FontGlyphMode::DistanceField)
+		{
+			characterSize = m_distanceFieldParams.glyphSize;
+			outlineThickness = 0.f;
+		}
+	}
+
+	void Font::GetSupportedGlyphParameters(TextStyleFlags& style, float& outlineThickness) const
+	{
+		if (style & TextStyle::Bold && !m_data->SupportsStyle(TextStyle::Bold))
+			style &= ~TextStyle::Bold;
+
+		if (style & TextStyle::Italic && !m_data->SupportsStyle(TextStyle::Italic))
+			style &= ~TextStyle::Italic;
+
+		if (outlineThickness > 0.f && !m_data->SupportsOutline(outlineThickness))
+			outlineThickness = 0.f;
+	}
+
 	void Font::OnAtlasCleared(const AbstractAtlas* atlas)
 	{
 		NazaraUnused(atlas);
@@ -411,6 +882,52 @@ namespace Nz
 		OnFontAtlasLayerChanged(this, oldLayer, newLayer);
 	}
 
+	void Font::OnAtlasRectsRelocated(const AbstractAtlas* atlas, std::size_t layerIndex, AbstractImage* layer, SparsePtr<const Rectui> oldRects, SparsePtr<const Rectui> newRects, std::size_t count)
+	{
+		NazaraUnused(atlas);
+		NazaraUnused(layer);
+
+		#ifdef NAZARA_DEBUG
+		if (m_atlas.get() != atlas)
+		{
+			NazaraInternalError("Notified by a non-listening-to resource");
+			return;
+		}
+		#endif
+
+		auto GetPositionKey = [](unsigned int x, unsigned int y)
+		{
+			return (UInt64(x) << 32) | y;
+		};
+
+		std::unordered_map<UInt64, Vector2ui> newPositions;
+		newPositions.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			newPositions.emplace(GetPositionKey(oldRects[i].x, oldRects[i].y), Vector2ui(newRects[i].x, newRects[i].y));
+
+		for (auto&& [glyphKey, glyphMap] : m_glyphes)
+		{
+			NazaraUnused(glyphKey);
+			for (auto&& [character, glyph] : glyphMap)
+			{
+				NazaraUnused(character);
+				if (!glyph.valid || glyph.layerIndex != layerIndex || glyph.atlasRect.width == 0 || glyph.atlasRect.height == 0)
+					continue;
+
+				// Atlas rectangles include the glyph border
+				auto it = newPositions.find(GetPositionKey(glyph.atlasRect.x - m_glyphBorder, glyph.atlasRect.y - m_glyphBorder));
+				if (it == newPositions.end())
+					continue; //< belongs to another font sharing the atlas
+
+				glyph.atlasRect.x = it->second.x + m_glyphBorder;
+				glyph.atlasRect.y = it->second.y + m_glyphBorder;
+			}
+		}
+
+		// Text drawers keep a copy of the atlas rectangles of their glyphs
+		OnFontAtlasChanged(this);
+	}
+
 	const Font::Glyph& Font::PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
 		auto it = glyphMap.find(character);
@@ -423,35 +940,19 @@ namespace Nz
 		NazaraAssert(m_atlas, "font has no atlas");
 
 		// Check if requested style is supported by our font (otherwise it will need to be simulated)
-		glyph.fauxOutlineThickness = 0.f;
-		glyph.requireFauxBold = false;
-		glyph.requireFauxItalic = false;
-
 		TextStyleFlags supportedStyle = style;
-		if (style & TextStyle::Bold && !m_data->SupportsStyle(TextStyle::Bold))
-		{
-			glyph.requireFauxBold = true;
-			supportedStyle &= ~TextStyle::Bold;
-		}
-
-		if (style & TextStyle::Italic && !m_data->SupportsStyle(TextStyle::Italic))
-		{
-			glyph.requireFauxItalic = true;
-			supportedStyle &= ~TextStyle::Italic;
-		}
-
 		float supportedOutlineThickness = outlineThickness;
-		if (outlineThickness > 0.f && !m_data->SupportsOutline(outlineThickness))
-		{
-			glyph.fauxOutlineThickness = supportedOutlineThickness;
-			supportedOutlineThickness = 0.f;
-		}
+		GetSupportedGlyphParameters(supportedStyle, supportedOutlineThickness);
+
+		glyph.fauxOutlineThickness = (outlineThickness != supportedOutlineThickness) ? outlineThickness : 0.f;
+		glyph.requireFauxBold = (style & TextStyle::Bold) && !(supportedStyle & TextStyle::Bold);
+		glyph.requireFauxItalic = (style & TextStyle::Italic) && !(supportedStyle & TextStyle::Italic);
 
 		// Does font support requested style?
 		if (style == supportedStyle && outlineThickness == supportedOutlineThickness)
 		{
 			FontGlyph fontGlyph;
-			if (ExtractGlyph(characterSize, character, style, outlineThickness, &fontGlyph))
+			if (ExtractCachedGlyph(*m_data, characterSize, character, style, outlineThickness, &fontGlyph))
 			{
 				if (fontGlyph.image.IsValid())
 				{
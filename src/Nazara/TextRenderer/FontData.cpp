@@ -7,4 +7,15 @@
 namespace Nz
 {
 	FontData::~FontData() = default;
+
+	/*!
+	* \brief Creates another instance of the font data, which can extract glyphs concurrently with this one
+	* \return New instance or a null pointer if the font data cannot be used from multiple threads
+	*
+	* \remark This is called from the thread owning the font data
+	*/
+	std::unique_ptr<FontData> FontData::Clone() const
+	{
+		return nullptr;
+	}
 }
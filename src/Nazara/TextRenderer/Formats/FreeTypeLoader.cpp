@@ -19,6 +19,7 @@
 #include <frozen/unordered_set.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Nz
 {
@@ -27,7 +28,6 @@ namespace Nz
 		class FreeTypeLibrary;
 
 		FT_Library s_freetypeLibrary = nullptr;
-		FT_Stroker s_freetypeStroker = nullptr;
 		std::shared_ptr<FreeTypeLibrary> s_freetypeLibraryOwner;
 		constexpr float s_freetypeScaleFactor = 1 << 6;
 		constexpr float s_freetypeInvScaleFactor = 1.f / s_freetypeScaleFactor;
@@ -70,23 +70,10 @@ namespace Nz
 			// pour ne libérer FreeType que lorsque plus personne ne l'utilise
 
 			public:
-				FreeTypeLibrary()
-				{
-					if (FT_Stroker_New(s_freetypeLibrary, &s_freetypeStroker) != 0)
-					{
-						NazaraWarning("failed to load FreeType stroker, outline will not be possible");
-						s_freetypeStroker = nullptr; //< Just in case
-					}
-				}
+				FreeTypeLibrary() = default;
 
 				~FreeTypeLibrary()
 				{
-					if (s_freetypeStroker)
-					{
-						FT_Stroker_Done(s_freetypeStroker);
-						s_freetypeStroker = nullptr;
-					}
-
 					FT_Done_FreeType(s_freetypeLibrary);
 					s_freetypeLibrary = nullptr;
 				}
@@ -97,17 +84,66 @@ namespace Nz
 			public:
 				FreeTypeStream() :
 				m_face(nullptr),
+				m_stroker(nullptr),
 				m_library(s_freetypeLibraryOwner),
+				m_memoryData(nullptr),
+				m_memorySize(0),
 				m_characterSize(0)
 				{
+					// Strokers hold state while outlining, each face has its own so they can be used from different threads
+					if (FT_Stroker_New(s_freetypeLibrary, &m_stroker) != 0)
+					{
+						NazaraWarning("failed to load FreeType stroker, outline will not be possible");
+						m_stroker = nullptr; //< Just in case
+					}
 				}
 
 				~FreeTypeStream()
 				{
+					if (m_stroker)
+						FT_Stroker_Done(m_stroker);
+
 					if (m_face)
 						FT_Done_Face(m_face);
 				}
 
+				std::unique_ptr<FontData> Clone() const override
+				{
+					// A FreeType face cannot be used from multiple threads, open the font again from memory
+					if (!m_memoryData)
+					{
+						// Fonts opened from a file or a stream are read once and shared between clones
+						if (!m_fontBuffer)
+						{
+							Stream& stream = *static_cast<Stream*>(m_stream.descriptor.pointer);
+
+							auto fontBuffer = std::make_shared<std::vector<UInt8>>(m_stream.size);
+							if (!stream.SetCursorPos(0) || stream.Read(fontBuffer->data(), fontBuffer->size()) != fontBuffer->size())
+							{
+								NazaraError("failed to read font stream");
+								return nullptr;
+							}
+
+							m_fontBuffer = std::move(fontBuffer);
+						}
+
+						m_memoryData = m_fontBuffer->data();
+						m_memorySize = m_fontBuffer->size();
+					}
+
+					std::unique_ptr<FreeTypeStream> clone = std::make_unique<FreeTypeStream>();
+					clone->SetMemory(m_memoryData, m_memorySize);
+					clone->m_fontBuffer = m_fontBuffer;
+
+					if (!clone->Open())
+					{
+						NazaraError("failed to open font clone");
+						return nullptr;
+					}
+
+					return clone;
+				}
+
 				bool ExtractGlyph(unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* dst) override
 				{
 					#ifdef NAZARA_DEBUG
@@ -158,8 +194,8 @@ namespace Nz
 
 						if (outlineThickness > 0.f)
 						{
-							FT_Stroker_Set(s_freetypeStroker, static_cast<FT_Fixed>(s_freetypeScaleFactor * outlineThickness), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-							if (FT_Glyph_Stroke(&glyph, s_freetypeStroker, 1) != 0)
+							FT_Stroker_Set(m_stroker, static_cast<FT_Fixed>(s_freetypeScaleFactor * outlineThickness), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+							if (FT_Glyph_Stroke(&glyph, m_stroker, 1) != 0)
 							{
 								NazaraError("failed to outline glyph");
 								return false;
@@ -332,10 +368,16 @@ namespace Nz
 				{
 					m_ownedStream = std::make_unique<MemoryView>(data, size);
 					SetStream(*m_ownedStream);
+
+					m_memoryData = data;
+					m_memorySize = size;
 				}
 
 				void SetStream(Stream& stream)
 				{
+					m_memoryData = nullptr;
+					m_memorySize = 0;
+
 					m_stream.base = nullptr;
 					m_stream.close = FT_StreamClose;
 					m_stream.descriptor.pointer = &stream;
@@ -350,7 +392,7 @@ namespace Nz
 
 				bool SupportsOutline(float /*outlineThickness*/) const override
 				{
-					return s_freetypeStroker != nullptr;
+					return m_stroker != nullptr;
 				}
 
 				bool SupportsStyle(TextStyleFlags style) const override
@@ -371,9 +413,13 @@ namespace Nz
 
 				FT_Open_Args m_args;
 				FT_Face m_face;
+				FT_Stroker m_stroker;
 				FT_StreamRec m_stream;
 				std::shared_ptr<FreeTypeLibrary> m_library;
+				mutable std::shared_ptr<std::vector<UInt8>> m_fontBuffer;
 				std::unique_ptr<Stream> m_ownedStream;
+				mutable const void* m_memoryData;
+				mutable std::size_t m_memorySize;
 				mutable unsigned int m_characterSize;
 		};
 
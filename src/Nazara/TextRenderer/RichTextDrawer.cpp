@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/TextRenderer/RichTextDrawer.hpp>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 
@@ -12,6 +14,8 @@ namespace Nz
 	m_currentColor(Color::White()),
 	m_currentOutlineColor(Color::Black()),
 	m_currentStyle(TextStyle_Regular),
+	m_invalidBlockIndex(0),
+	m_invalidTextOffset(0),
 	m_glyphUpdated(false),
 	m_currentCharacterSpacingOffset(0.f),
 	m_currentLineSpacingOffset(0.f),
@@ -26,6 +30,8 @@ namespace Nz
 	m_currentColor(drawer.m_currentColor),
 	m_currentOutlineColor(drawer.m_currentOutlineColor),
 	m_currentStyle(drawer.m_currentStyle),
+	m_invalidBlockIndex(0),
+	m_invalidTextOffset(0),
 	m_fontIndexes(drawer.m_fontIndexes),
 	m_blocks(drawer.m_blocks),
 	m_glyphUpdated(false),
@@ -99,11 +105,17 @@ namespace Nz
 
 			assert(newBlock.fontIndex < m_fonts.size());
 			m_fonts[newBlock.fontIndex].useCount++;
+
+			InvalidateGlyphs(m_blocks.size() - 1);
 		}
 		else
-			m_blocks.back().text += str;
+		{
+			// Appending doesn't change the layout of the text before the last line feed
+			Block& lastBlock = m_blocks.back();
+			InvalidateGlyphs(m_blocks.size() - 1, lastBlock.text.size());
 
-		InvalidateGlyphs();
+			lastBlock.text += str;
+		}
 
 		return BlockRef(*this, m_blocks.size() - 1);
 	}
@@ -194,6 +206,7 @@ namespace Nz
 		{
 			if (TestBlockProperties(m_blocks[previousBlockIndex], m_blocks[i]))
 			{
+				InvalidateGlyphs(previousBlockIndex, m_blocks[previousBlockIndex].text.size());
 				m_blocks[previousBlockIndex].text += m_blocks[i].text;
 
 				RemoveBlock(i);
@@ -219,7 +232,7 @@ namespace Nz
 			m_blocks[i].glyphIndex -= textLength;
 		}
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	void RichTextDrawer::SetMaxLineWidth(float lineWidth)
@@ -275,8 +288,14 @@ namespace Nz
 		m_fontIndexes = std::move(drawer.m_fontIndexes);
 		m_fonts = std::move(drawer.m_fonts);
 		m_glyphs = std::move(drawer.m_glyphs);
+		m_invalidBlockIndex = drawer.m_invalidBlockIndex;
+		m_invalidTextOffset = drawer.m_invalidTextOffset;
+		m_lastSeparatorGlyph = drawer.m_lastSeparatorGlyph;
+		m_lastSeparatorPosition = drawer.m_lastSeparatorPosition;
+		m_lineBreaks = std::move(drawer.m_lineBreaks);
 		m_lines = std::move(drawer.m_lines);
 		m_glyphUpdated = std::move(drawer.m_glyphUpdated);
+		m_maxLineWidth = drawer.m_maxLineWidth;
 
 		drawer.DisconnectFontSlots();
 		ConnectFontSlots();
@@ -346,7 +365,17 @@ namespace Nz
 			glyph.flipped = fontGlyph.flipped;
 			glyph.renderOrder = renderOrder;
 
+			glyph.distanceFieldEdge = font.GetDistanceFieldEdge(characterSize, outlineThickness);
+			glyph.distanceFieldSmoothing = font.GetDistanceFieldSmoothing(characterSize);
+
+			// Distance field glyphs are generated once at a fixed size and scaled to the character size
+			float glyphScale = font.GetGlyphScale(characterSize);
+
 			glyph.bounds = Rectf(fontGlyph.aabb);
+			glyph.bounds.x *= glyphScale;
+			glyph.bounds.y *= glyphScale;
+			glyph.bounds.width *= glyphScale;
+			glyph.bounds.height *= glyphScale;
 
 			if (lineWrap && ShouldLineWrap(glyph.bounds.width))
 				AppendNewLine(font, characterSize, lineSpacingOffset, m_lastSeparatorGlyph, m_lastSeparatorPosition);
@@ -356,6 +385,10 @@ namespace Nz
 
 			// Faux bold and faux outline thickness are not supported
 
+			// Distance field outlines are drawn by moving the edge inside the same quad, bitmap outlines are bigger
+			if (font.GetGlyphMode() == FontGlyphMode::DistanceField)
+				outlineThickness = 0.f;
+
 			// We "lean" the glyph to simulate italics style
 			float italic = (fontGlyph.requireFauxItalic) ? 0.208f : 0.f;
 			float italicTop = italic * glyph.bounds.y;
@@ -367,7 +400,7 @@ namespace Nz
 			glyph.corners[3] = Vector2f(glyph.bounds.x + glyph.bounds.width - italicBottom - outlineThickness, glyph.bounds.y + glyph.bounds.height - outlineThickness);
 
 			if (advance)
-				*advance = fontGlyph.advance;
+				*advance = static_cast<int>(std::round(fontGlyph.advance * glyphScale));
 
 			return true;
 		}
@@ -375,12 +408,26 @@ namespace Nz
 			return false;
 	};
 
-	void RichTextDrawer::GenerateGlyphs(const Font& font, const Color& color, TextStyleFlags style, unsigned int characterSize, const Color& outlineColor, float characterSpacingOffset, float lineSpacingOffset, float outlineThickness, std::string_view text) const
+	void RichTextDrawer::GenerateGlyphs(std::size_t blockIndex, std::size_t textOffset, char32_t previousCharacter) const
 	{
+		const Block& block = m_blocks[blockIndex];
+
+		std::string_view text = std::string_view(block.text).substr(textOffset);
 		if (text.empty())
 			return;
 
-		char32_t previousCharacter = 0;
+		assert(block.fontIndex < m_fonts.size());
+		const Font& font = *m_fonts[block.fontIndex].font;
+
+		const Color& color = block.color;
+		const Color& outlineColor = block.outlineColor;
+		TextStyleFlags style = block.style;
+		float characterSpacingOffset = block.characterSpacingOffset;
+		float lineSpacingOffset = block.lineSpacingOffset;
+		float outlineThickness = block.outlineThickness;
+		unsigned int characterSize = block.characterSize;
+
+		std::size_t lineBreakOffset = textOffset;
 
 		const Font::SizeInfo& sizeInfo = font.GetSizeInfo(characterSize);
 		float lineHeight = GetLineHeight(lineSpacingOffset, sizeInfo);
@@ -480,6 +527,16 @@ namespace Nz
 				}
 
 				m_glyphs.push_back(glyph);
+
+				if (character == '\n')
+				{
+					// Line feeds are single bytes in UTF-8, the next one in the text is the one we just handled
+					lineBreakOffset = block.text.find('\n', lineBreakOffset);
+					NazaraAssert(lineBreakOffset != std::string::npos, "line feed not found in block text");
+
+					lineBreakOffset++;
+					m_lineBreaks.push_back(LineBreak{ m_bounds, m_lines.back().bounds, blockIndex, m_glyphs.size(), m_lines.size(), lineBreakOffset, m_drawPos.y });
+				}
 			}
 
 			return true; //< continue iteration
@@ -525,7 +582,7 @@ namespace Nz
 		}
 #endif
 
-		m_glyphUpdated = false;
+		InvalidateGlyphs();
 	}
 
 	void RichTextDrawer::OnFontRelease(const Font* font)
@@ -547,6 +604,38 @@ namespace Nz
 
 	void RichTextDrawer::UpdateGlyphs() const
 	{
+		// Lines before the last line feed preceding the first modified block (or character) keep their layout
+		auto it = std::upper_bound(m_lineBreaks.begin(), m_lineBreaks.end(), std::make_pair(m_invalidBlockIndex, m_invalidTextOffset), [](const std::pair<std::size_t, std::size_t>& position, const LineBreak& lineBreak)
+		{
+			return position < std::make_pair(lineBreak.blockIndex, lineBreak.textOffset);
+		});
+
+		if (it != m_lineBreaks.begin())
+		{
+			const LineBreak& lineBreak = *std::prev(it);
+			std::size_t blockIndex = lineBreak.blockIndex;
+			std::size_t textOffset = lineBreak.textOffset;
+
+			m_bounds = lineBreak.bounds;
+			m_drawPos = Vector2f(0.f, lineBreak.drawPosY);
+			m_glyphs.resize(lineBreak.glyphCount);
+			m_lastSeparatorGlyph = lineBreak.glyphCount - 1; //< the line feed
+			m_lastSeparatorPosition = 0.f;
+			m_lines.resize(lineBreak.lineCount);
+			m_lines.back().bounds = lineBreak.lineBounds;
+
+			m_lineBreaks.erase(it, m_lineBreaks.end());
+
+			GenerateGlyphs(blockIndex, textOffset, '\n');
+			for (std::size_t i = blockIndex + 1; i < m_blocks.size(); ++i)
+				GenerateGlyphs(i, 0, 0);
+
+			// Text may end right after the line feed
+			m_bounds.ExtendTo(m_lines.back().bounds);
+			m_glyphUpdated = true;
+			return;
+		}
+
 		ClearGlyphs();
 
 		if (!m_blocks.empty())
@@ -563,13 +652,8 @@ namespace Nz
 
 			m_drawPos = Vector2f(0.f, SafeCast<float>(firstBlock.characterSize));
 
-			for (const Block& block : m_blocks)
-			{
-				assert(block.fontIndex < m_fonts.size());
-				const auto& fontData = m_fonts[block.fontIndex];
-
-				GenerateGlyphs(*fontData.font, block.color, block.style, block.characterSize, block.outlineColor, block.outlineThickness, block.characterSpacingOffset, block.lineSpacingOffset, block.text);
-			}
+			for (std::size_t i = 0; i < m_blocks.size(); ++i)
+				GenerateGlyphs(i, 0, 0);
 		}
 		else
 			m_lines.emplace_back(Line{ Rectf::Zero(), 0 }); //< Ensure there's always a line
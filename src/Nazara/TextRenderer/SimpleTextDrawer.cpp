@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/TextRenderer/SimpleTextDrawer.hpp>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 
@@ -37,7 +39,9 @@ namespace Nz
 	{
 		if (!m_glyphUpdated)
 			UpdateGlyphs();
-		else if (!m_colorUpdated)
+
+		// Glyphs kept by an incremental layout may not have the current color
+		if (!m_colorUpdated)
 			UpdateGlyphColor();
 
 		return m_glyphs[index];
@@ -128,6 +132,7 @@ namespace Nz
 		m_colorUpdated = true;
 		m_drawPos = Vector2f(0.f, SafeCast<float>(m_characterSize)); //< Our draw "cursor"
 		m_lastSeparatorGlyph = InvalidGlyph;
+		m_lineBreaks.clear();
 		m_lines.clear();
 		m_glyphs.clear();
 		m_glyphUpdated = true;
@@ -150,7 +155,17 @@ namespace Nz
 			glyph.flipped = fontGlyph.flipped;
 			glyph.renderOrder = renderOrder;
 
+			glyph.distanceFieldEdge = m_font->GetDistanceFieldEdge(m_characterSize, outlineThickness);
+			glyph.distanceFieldSmoothing = m_font->GetDistanceFieldSmoothing(m_characterSize);
+
+			// Distance field glyphs are generated once at a fixed size and scaled to the character size
+			float glyphScale = m_font->GetGlyphScale(m_characterSize);
+
 			glyph.bounds = Rectf(fontGlyph.aabb);
+			glyph.bounds.x *= glyphScale;
+			glyph.bounds.y *= glyphScale;
+			glyph.bounds.width *= glyphScale;
+			glyph.bounds.height *= glyphScale;
 
 			if (lineWrap && ShouldLineWrap(glyph.bounds.width))
 				AppendNewLine(m_lastSeparatorGlyph, m_lastSeparatorPosition);
@@ -160,6 +175,10 @@ namespace Nz
 
 			// Faux bold and faux outline thickness are not supported
 
+			// Distance field outlines are drawn by moving the edge inside the same quad, bitmap outlines are bigger
+			if (m_font->GetGlyphMode() == FontGlyphMode::DistanceField)
+				outlineThickness = 0.f;
+
 			// We "lean" the glyph to simulate italics style
 			float italic = (fontGlyph.requireFauxItalic) ? 0.208f : 0.f;
 			float italicTop = italic * glyph.bounds.y;
@@ -171,7 +190,7 @@ namespace Nz
 			glyph.corners[3] = Vector2f(glyph.bounds.x + glyph.bounds.width - italicBottom - outlineThickness, glyph.bounds.y + glyph.bounds.height - outlineThickness);
 
 			if (advance)
-				*advance = fontGlyph.advance;
+				*advance = static_cast<int>(std::round(fontGlyph.advance * glyphScale));
 
 			return true;
 		}
@@ -179,13 +198,16 @@ namespace Nz
 			return false;
 	};
 
-	void SimpleTextDrawer::GenerateGlyphs(std::string_view text) const
+	void SimpleTextDrawer::GenerateGlyphs(std::size_t textOffset) const
 	{
+		std::string_view text = std::string_view(m_text).substr(textOffset);
 		if (text.empty())
 			return;
 
 		const Font::SizeInfo& sizeInfo = m_font->GetSizeInfo(m_characterSize);
 
+		std::size_t lineBreakOffset = textOffset;
+
 		IterateOnCodepoints(text, [&](std::u32string_view characters)
 		{
 			for (char32_t character : characters)
@@ -267,6 +289,16 @@ namespace Nz
 				}
 
 				m_glyphs.push_back(glyph);
+
+				if (character == '\n')
+				{
+					// Line feeds are single bytes in UTF-8, the next one in the text is the one we just handled
+					lineBreakOffset = m_text.find('\n', lineBreakOffset);
+					NazaraAssert(lineBreakOffset != std::string::npos, "line feed not found in text");
+
+					lineBreakOffset++;
+					m_lineBreaks.push_back(LineBreak{ m_bounds, m_lines.back().bounds, m_glyphs.size(), m_lines.size(), lineBreakOffset, m_drawPos.y });
+				}
 			}
 
 			return true; //< continue iteration
@@ -274,7 +306,6 @@ namespace Nz
 
 		m_bounds.ExtendTo(m_lines.back().bounds);
 
-		m_colorUpdated = true;
 		m_glyphUpdated = true;
 	}
 
@@ -329,4 +360,42 @@ namespace Nz
 
 		SetTextFont(nullptr);
 	}
+
+	void SimpleTextDrawer::UpdateGlyphs() const
+	{
+		NazaraAssert(m_font && m_font->IsValid(), "Invalid font");
+
+		// Lines before the last line feed preceding the first modified character keep their layout
+		auto it = std::upper_bound(m_lineBreaks.begin(), m_lineBreaks.end(), m_invalidTextOffset, [](std::size_t textOffset, const LineBreak& lineBreak)
+		{
+			return textOffset < lineBreak.textOffset;
+		});
+
+		if (it == m_lineBreaks.begin())
+		{
+			ClearGlyphs();
+			GenerateGlyphs(0);
+			return;
+		}
+
+		const LineBreak& lineBreak = *std::prev(it);
+		std::size_t textOffset = lineBreak.textOffset;
+
+		m_bounds = lineBreak.bounds;
+		m_drawPos = Vector2f(0.f, lineBreak.drawPosY);
+		m_glyphs.resize(lineBreak.glyphCount);
+		m_lastSeparatorGlyph = lineBreak.glyphCount - 1; //< the line feed
+		m_lastSeparatorPosition = 0.f;
+		m_lines.resize(lineBreak.lineCount);
+		m_lines.back().bounds = lineBreak.lineBounds;
+		m_previousCharacter = '\n';
+
+		m_lineBreaks.erase(it, m_lineBreaks.end());
+
+		GenerateGlyphs(textOffset);
+
+		// Text may end right after the line feed
+		m_bounds.ExtendTo(m_lines.back().bounds);
+		m_glyphUpdated = true;
+	}
 }
@@ -591,6 +591,10 @@ namespace Nz
 		if (enabledFeatures.nonSolidFaceFilling)
 			deviceFeatures.fillModeNonSolid = VK_TRUE;
 
+		// Block compressed formats are reported through VulkanDevice::IsTextureFormatSupported
+		if (deviceInfo.features.textureCompressionBC)
+			deviceFeatures.textureCompressionBC = VK_TRUE;
+
 		VkDeviceCreateInfo createInfo = {
 			VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
 			nullptr,
@@ -338,6 +338,34 @@ namespace Nz
 		m_commandBuffer.CopyImage(vkFromTexture.GetImage(), ToVulkan(fromLayout), vkToTexture.GetImage(), ToVulkan(toLayout), region);
 	}
 
+	void VulkanCommandBufferBuilder::CopyTexture(const UploadPool::Allocation& allocation, const Texture& toTexture, const Boxui& toBox, UInt8 toLevel, TextureLayout toLayout)
+	{
+		const auto& vkAllocation = SafeCast<const VulkanUploadPool::VulkanAllocation&>(allocation);
+		const VulkanTexture& vkToTexture = SafeCast<const VulkanTexture&>(toTexture);
+
+		unsigned int toBaseLayer, toLayerCount;
+		Boxui copyBox = Image::RegionToArray(vkToTexture.GetType(), toBox, toBaseLayer, toLayerCount);
+
+		VkBufferImageCopy region = {
+			vkAllocation.offset,
+			0,
+			0,
+			vkToTexture.BuildSubresourceLayers(toLevel, toBaseLayer, toLayerCount),
+			{
+				SafeCast<Int32>(copyBox.x),
+				SafeCast<Int32>(copyBox.y),
+				SafeCast<Int32>(copyBox.z)
+			},
+			{
+				SafeCast<UInt32>(copyBox.width),
+				SafeCast<UInt32>(copyBox.height),
+				SafeCast<UInt32>(copyBox.depth)
+			}
+		};
+
+		m_commandBuffer.CopyBufferToImage(vkAllocation.buffer, vkToTexture.GetImage(), ToVulkan(toLayout), region);
+	}
+
 	void VulkanCommandBufferBuilder::Dispatch(UInt32 workgroupX, UInt32 workgroupY, UInt32 workgroupZ)
 	{
 		m_commandBuffer.Dispatch(workgroupX, workgroupY, workgroupZ);
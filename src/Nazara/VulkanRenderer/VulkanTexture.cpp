@@ -392,7 +392,7 @@ namespace Nz
 
 	bool VulkanTexture::Update(Vk::CommandBuffer& commandBuffer, std::unique_ptr<VulkanBuffer>& uploadBuffer, const void* ptr, const Boxui& box, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
 	{
-		std::size_t memorySize = box.width * box.height * box.depth * PixelFormatInfo::GetBytesPerPixel(m_textureViewInfo.pixelFormat);
+		std::size_t memorySize = PixelFormatInfo::ComputeSize(m_textureViewInfo.pixelFormat, box.width, box.height, box.depth);
 
 		uploadBuffer = std::make_unique<VulkanBuffer>(m_device, BufferType::Upload, memorySize, BufferUsage::DirectMapping);
 		void* mappedUploadBuffer = uploadBuffer->Map(0, memorySize);
@@ -403,7 +403,8 @@ namespace Nz
 		if (srcHeight == 0)
 			srcHeight = box.height;
 
-		if (srcWidth == box.width && srcHeight == box.height)
+		// Block compressed data is expected to be tightly packed
+		if ((srcWidth == box.width && srcHeight == box.height) || PixelFormatInfo::IsCompressed(m_textureViewInfo.pixelFormat))
 			std::memcpy(mappedUploadBuffer, ptr, memorySize);
 		else
 		{
@@ -475,6 +476,11 @@ namespace Nz
 		switch (pixelFormat)
 		{
 			// Regular formats
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			case PixelFormat::BC6H:
+			case PixelFormat::BC7:
+			case PixelFormat::BC7_SRGB:
 			case PixelFormat::BGR8:
 			case PixelFormat::BGR8_SRGB:
 			case PixelFormat::BGRA8:
@@ -484,6 +490,9 @@ namespace Nz
 			case PixelFormat::Depth24Stencil8:
 			case PixelFormat::Depth32F:
 			case PixelFormat::Depth32FStencil8:
+			case PixelFormat::DXT1:
+			case PixelFormat::DXT3:
+			case PixelFormat::DXT5:
 			case PixelFormat::R8:
 			case PixelFormat::RG8:
 			case PixelFormat::RGB8:
@@ -37,6 +37,10 @@ namespace Nz
 		m_registry = &m_canvas->GetRegistry();
 
 		RegisterToCanvas();
+
+		// Ensures the widget gets laid out at least once by the layout pass, even if it's resized to its default size
+		if (m_canvas->IsDeferredLayoutEnabled())
+			InvalidateLayout();
 	}
 
 	/*!
@@ -44,6 +48,9 @@ namespace Nz
 	 */
 	BaseWidget::~BaseWidget()
 	{
+		if (m_layoutQueueIndex != InvalidCanvasIndex)
+			m_canvas->CancelWidgetLayoutInvalidation(m_layoutQueueIndex);
+
 		if (m_registry)
 		{
 			for (WidgetEntity& entity : m_entities)
@@ -149,9 +156,15 @@ namespace Nz
 		newSize.Maximize(m_minimumSize);
 		newSize.Minimize(m_maximumSize);
 
+		// Layouts resize their children on every change, don't cascade through the whole subtree if nothing changed during the layout pass
+		// (outside of it, resizing a widget to its current size is still a way to lay it out again)
+		if (newSize == m_size && !m_isLayoutInvalidated && m_canvas->IsUpdatingLayout())
+			return;
+
 		NotifyParentResized(newSize);
 		m_size = newSize;
 
+		m_isLayoutInvalidated = false;
 		Layout();
 
 		OnWidgetResized(this, newSize);
@@ -281,6 +294,26 @@ namespace Nz
 		UpdatePositionAndSize();
 	}
 
+	/*!
+	* \brief Invalidates the widget layout
+	*
+	* The widget is laid out right away, unless deferred layout is enabled on its canvas (see Canvas::EnableDeferredLayout).
+	* In that case it will be laid out by the next Canvas::UpdateLayout call, and multiple invalidations happening in the same frame (children being added, preferred sizes being updated, ...) only trigger one layout.
+	*/
+	void BaseWidget::InvalidateLayout()
+	{
+		if (!m_canvas->IsDeferredLayoutEnabled())
+		{
+			Layout();
+			return;
+		}
+
+		m_isLayoutInvalidated = true;
+
+		if (m_layoutQueueIndex == InvalidCanvasIndex)
+			m_layoutQueueIndex = m_canvas->NotifyWidgetLayoutInvalidation(this);
+	}
+
 	void BaseWidget::InvalidateNode(Invalidation invalidation)
 	{
 		Node::InvalidateNode(invalidation);
@@ -451,6 +484,7 @@ namespace Nz
 		Node::SetParent(widget);
 		m_parentWidget = widget;
 
+		m_isLayoutInvalidated = false;
 		Layout();
 	}
 
@@ -4,10 +4,27 @@
 
 #include <Nazara/Widgets/Canvas.hpp>
 #include <Nazara/Widgets/DefaultWidgetTheme.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <limits>
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Widgets are referenced by every cell of the hit-testing grid their box overlaps
+		constexpr float WidgetGridCellSize = 64.f;
+
+		// Widgets covering more cells than this (panels, scroll area contents, the canvas itself) are always hit-tested
+		constexpr float WidgetGridMaxCellCount = 64.f;
+
+		UInt64 GetWidgetGridCellKey(int x, int y)
+		{
+			return (UInt64(UInt32(x)) << 32) | UInt32(y);
+		}
+	}
+
 	Canvas::Canvas(entt::registry& registry, Nz::WindowEventHandler& eventHandler, Nz::CursorControllerHandle cursorController, UInt32 renderMask, int initialRenderLayer) :
 	BaseWidget(std::make_shared<DefaultWidgetTheme>()),
 	m_cursorController(cursorController),
@@ -15,7 +32,9 @@ namespace Nz
 	m_keyboardOwner(InvalidCanvasIndex),
 	m_hoveredWidget(InvalidCanvasIndex),
 	m_mouseOwner(InvalidCanvasIndex),
-	m_registry(registry)
+	m_registry(registry),
+	m_isDeferredLayoutEnabled(false),
+	m_isUpdatingLayout(false)
 	{
 		m_canvas = this;
 		BaseWidget::m_registry = &m_registry;
@@ -39,6 +58,93 @@ namespace Nz
 		m_textEditedSlot.Connect(eventHandler.OnTextEdited, this, &Canvas::OnEventTextEdited);
 	}
 
+	/*!
+	* \brief Enables or disables deferred layout
+	*
+	* By default, widgets are laid out as soon as their layout is invalidated.
+	* When deferred layout is enabled, invalidated widgets are queued and laid out once by UpdateLayout, which must then be called every frame before rendering.
+	* Disabling it lays out every pending widget.
+	*
+	* \param enable Should widget layouts be deferred to UpdateLayout
+	*
+	* \see UpdateLayout
+	*/
+	void Canvas::EnableDeferredLayout(bool enable)
+	{
+		if (m_isDeferredLayoutEnabled == enable)
+			return;
+
+		if (!enable)
+			UpdateLayout();
+
+		m_isDeferredLayoutEnabled = enable;
+	}
+
+	/*!
+	* \brief Lays out every widget whose layout was invalidated since the last call
+	*
+	* Widgets are laid out parents first, widgets already resized (and thus laid out) by their parent layout are skipped.
+	* This is only needed when deferred layout is enabled and should then be called once per frame before rendering, it's also called before handling mouse events to keep hit-testing up to date.
+	*
+	* \see BaseWidget::InvalidateLayout
+	* \see EnableDeferredLayout
+	*/
+	void Canvas::UpdateLayout()
+	{
+		if (m_invalidatedLayoutWidgets.empty())
+			return;
+
+		m_isUpdatingLayout = true;
+
+		// Laying out widgets may invalidate other layouts (for example by updating preferred sizes), process them until there's none left
+		std::size_t firstIndex = 0;
+		while (firstIndex < m_invalidatedLayoutWidgets.size())
+		{
+			std::size_t lastIndex = m_invalidatedLayoutWidgets.size();
+
+			m_layoutOrder.clear();
+			for (std::size_t i = firstIndex; i < lastIndex; ++i)
+			{
+				BaseWidget* widget = m_invalidatedLayoutWidgets[i];
+				if (!widget)
+					continue;
+
+				std::size_t depth = 0;
+				for (BaseWidget* parent = widget->m_parentWidget; parent; parent = parent->m_parentWidget)
+					depth++;
+
+				m_layoutOrder.emplace_back(depth, i);
+			}
+
+			std::sort(m_layoutOrder.begin(), m_layoutOrder.end());
+
+			for (const auto& [depth, index] : m_layoutOrder)
+			{
+				BaseWidget* widget = m_invalidatedLayoutWidgets[index];
+				if (!widget) //< destroyed by a previous layout
+					continue;
+
+				widget->m_layoutQueueIndex = InvalidCanvasIndex;
+				if (!widget->m_isLayoutInvalidated)
+					continue; //< already laid out when resized by its parent
+
+				widget->m_isLayoutInvalidated = false;
+				widget->Layout();
+			}
+
+			firstIndex = lastIndex;
+		}
+
+		m_invalidatedLayoutWidgets.clear();
+		m_isUpdatingLayout = false;
+	}
+
+	void Canvas::CancelWidgetLayoutInvalidation(std::size_t index)
+	{
+		assert(index < m_invalidatedLayoutWidgets.size());
+		m_invalidatedLayoutWidgets[index] = nullptr;
+	}
+
 	std::size_t Canvas::RegisterWidget(BaseWidget* widget)
 	{
 		WidgetEntry box;
@@ -56,6 +162,8 @@ namespace Nz
 	{
 		WidgetEntry& entry = m_widgetEntries[index];
 
+		RemoveFromGrid(index);
+
 		if (m_hoveredWidget == index)
 			m_hoveredWidget = InvalidCanvasIndex;
 
@@ -76,6 +184,9 @@ namespace Nz
 			entry = std::move(lastEntry);
 			entry.widget->UpdateCanvasIndex(index);
 
+			if (index != lastEntryIndex)
+				RenameInGrid(index, lastEntryIndex);
+
 			if (m_hoveredWidget == lastEntryIndex)
 				m_hoveredWidget = index;
 
@@ -107,6 +218,7 @@ namespace Nz
 
 	void Canvas::OnEventMouseButtonPressed(const WindowEventHandler* eventHandler, const WindowEvent::MouseButtonEvent& event)
 	{
+		UpdateLayout();
 		UpdateHoveredWidget(event.x, event.y);
 
 		bool handled = false;
@@ -135,6 +247,8 @@ namespace Nz
 
 	void Canvas::OnEventMouseButtonRelease(const WindowEventHandler* eventHandler, const WindowEvent::MouseButtonEvent& event)
 	{
+		UpdateLayout();
+
 		bool handled = false;
 		if (std::size_t targetWidgetIndex = GetMouseEventTarget(); targetWidgetIndex != InvalidCanvasIndex)
 		{
@@ -194,6 +308,8 @@ namespace Nz
 
 	void Canvas::OnEventMouseMoved(const WindowEventHandler* eventHandler, const WindowEvent::MouseMoveEvent& event)
 	{
+		UpdateLayout();
+
 		// Don't update hovered widget while the user doesn't release its mouse
 		UpdateHoveredWidget(event.x, event.y);
 
@@ -213,6 +329,8 @@ namespace Nz
 
 	void Canvas::OnEventMouseWheelMoved(const WindowEventHandler* eventHandler, const WindowEvent::MouseWheelEvent& event)
 	{
+		UpdateLayout();
+
 		bool handled = false;
 		if (std::size_t targetWidgetIndex = GetMouseEventTarget(); targetWidgetIndex != InvalidCanvasIndex)
 		{
@@ -310,14 +428,115 @@ namespace Nz
 			m_widgetEntries[m_keyboardOwner].widget->OnTextEdited(event.text, event.length);
 	}
 
+	void Canvas::InsertIntoGrid(std::size_t index)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		WidgetEntry& entry = m_widgetEntries[index];
+		assert(!entry.isInGrid);
+
+		if (entry.isLarge)
+			m_largeWidgets.push_back(index);
+		else
+		{
+			for (int y = entry.gridCells.y; y < entry.gridCells.y + entry.gridCells.height; ++y)
+			{
+				for (int x = entry.gridCells.x; x < entry.gridCells.x + entry.gridCells.width; ++x)
+					m_widgetGrid[GetWidgetGridCellKey(x, y)].push_back(index);
+			}
+		}
+
+		entry.isInGrid = true;
+	}
+
+	void Canvas::RemoveFromGrid(std::size_t index)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		WidgetEntry& entry = m_widgetEntries[index];
+		if (!entry.isInGrid)
+			return;
+
+		auto RemoveIndex = [&](std::vector<std::size_t>& indices)
+		{
+			auto it = std::find(indices.begin(), indices.end(), index);
+			assert(it != indices.end());
+
+			*it = indices.back();
+			indices.pop_back();
+		};
+
+		if (entry.isLarge)
+			RemoveIndex(m_largeWidgets);
+		else
+		{
+			for (int y = entry.gridCells.y; y < entry.gridCells.y + entry.gridCells.height; ++y)
+			{
+				for (int x = entry.gridCells.x; x < entry.gridCells.x + entry.gridCells.width; ++x)
+				{
+					auto cellIt = m_widgetGrid.find(GetWidgetGridCellKey(x, y));
+					assert(cellIt != m_widgetGrid.end());
+
+					RemoveIndex(cellIt->second);
+					if (cellIt->second.empty())
+						m_widgetGrid.erase(cellIt);
+				}
+			}
+		}
+
+		entry.isInGrid = false;
+	}
+
+	void Canvas::RenameInGrid(std::size_t index, std::size_t oldIndex)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		WidgetEntry& entry = m_widgetEntries[index];
+		if (!entry.isInGrid)
+			return;
+
+		auto RenameIndex = [&](std::vector<std::size_t>& indices)
+		{
+			auto it = std::find(indices.begin(), indices.end(), oldIndex);
+			assert(it != indices.end());
+
+			*it = index;
+		};
+
+		if (entry.isLarge)
+			RenameIndex(m_largeWidgets);
+		else
+		{
+			for (int y = entry.gridCells.y; y < entry.gridCells.y + entry.gridCells.height; ++y)
+			{
+				for (int x = entry.gridCells.x; x < entry.gridCells.x + entry.gridCells.width; ++x)
+					RenameIndex(m_widgetGrid[GetWidgetGridCellKey(x, y)]);
+			}
+		}
+	}
+
 	void Canvas::UpdateHoveredWidget(int x, int y)
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
 		std::size_t bestEntry = InvalidCanvasIndex;
 		float bestEntryArea = std::numeric_limits<float>::infinity();
 		int bestEntryLayer = std::numeric_limits<int>::min();
 
 		Vector3f mousePos(float(x), m_size.y - float(y), 0.f);
-		for (std::size_t i = 0; i < m_widgetEntries.size(); ++i)
+
+		// Only the widgets referenced by the cell under the mouse (and the large ones) may contain it
+		m_hoverCandidates.assign(m_largeWidgets.begin(), m_largeWidgets.end());
+
+		int cellX = static_cast<int>(std::floor(mousePos.x / WidgetGridCellSize));
+		int cellY = static_cast<int>(std::floor(mousePos.y / WidgetGridCellSize));
+		if (auto it = m_widgetGrid.find(GetWidgetGridCellKey(cellX, cellY)); it != m_widgetGrid.end())
+			m_hoverCandidates.insert(m_hoverCandidates.end(), it->second.begin(), it->second.end());
+
+		// Hovering rules depend on the registration order of widgets
+		std::sort(m_hoverCandidates.begin(), m_hoverCandidates.end());
+
+		for (std::size_t i : m_hoverCandidates)
 		{
 			const Boxf& box = m_widgetEntries[i].box;
 			int layer = m_widgetEntries[i].widget->GetBaseRenderLayer();
@@ -366,4 +585,36 @@ namespace Nz
 				m_cursorController->UpdateCursor(Cursor::Get(SystemCursor::Default));
 		}
 	}
+
+	void Canvas::UpdateWidgetGrid(std::size_t index)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		WidgetEntry& entry = m_widgetEntries[index];
+
+		float minCellX = std::floor(entry.box.x / WidgetGridCellSize);
+		float minCellY = std::floor(entry.box.y / WidgetGridCellSize);
+		float maxCellX = std::floor((entry.box.x + entry.box.width) / WidgetGridCellSize);
+		float maxCellY = std::floor((entry.box.y + entry.box.height) / WidgetGridCellSize);
+
+		// Also handles non-finite boxes and boxes too far away to be represented in the grid
+		constexpr float MaxCellCoordinate = float(std::numeric_limits<Int32>::max() / 2);
+		float cellCount = (maxCellX - minCellX + 1.f) * (maxCellY - minCellY + 1.f);
+		bool isLarge = !(cellCount <= WidgetGridMaxCellCount) || !(std::abs(minCellX) < MaxCellCoordinate) || !(std::abs(minCellY) < MaxCellCoordinate);
+
+		Recti gridCells(0, 0, 0, 0);
+		if (!isLarge)
+			gridCells = Recti(int(minCellX), int(minCellY), int(maxCellX - minCellX) + 1, int(maxCellY - minCellY) + 1);
+
+		// Moving a widget inside the cells it already covers (or resizing a large one) doesn't change the grid
+		if (entry.isInGrid && entry.isLarge == isLarge && entry.gridCells == gridCells)
+			return;
+
+		RemoveFromGrid(index);
+
+		entry.gridCells = gridCells;
+		entry.isLarge = isLarge;
+
+		InsertIntoGrid(index);
+	}
 }
@@ -10,6 +10,7 @@ namespace Nz
 	ScrollAreaWidget::ScrollAreaWidget(BaseWidget* parent, BaseWidget* content) :
 	BaseWidget(parent),
 	m_content(content),
+	m_isLayingOut(false),
 	m_isScrollbarEnabled(true),
 	m_hasScrollbar(false)
 	{
@@ -59,6 +60,9 @@ namespace Nz
 
 	void ScrollAreaWidget::Layout()
 	{
+		// Resizing the content may update its preferred size, which we're already taking into account
+		m_isLayingOut = true;
+
 		float scrollBarWidth = m_horizontalScrollbar->GetPreferredWidth();
 
 		float areaWidth = GetWidth();
@@ -94,6 +98,15 @@ namespace Nz
 		}
 
 		BaseWidget::Layout();
+
+		m_isLayingOut = false;
+	}
+
+	void ScrollAreaWidget::OnChildPreferredSizeUpdated(const BaseWidget* child)
+	{
+		// Content height changed (for example items being added to a VirtualListWidget)
+		if (child == m_content && !m_isLayingOut)
+			InvalidateLayout();
 	}
 
 	bool ScrollAreaWidget::OnMouseWheelMoved(int /*x*/, int /*y*/, float delta)
@@ -0,0 +1,321 @@
+// Copyright (C) 2024 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Widgets module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Widgets/VirtualListWidget.hpp>
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace Nz
+{
+	/*!
+	* \ingroup Widgets
+	* \class VirtualListWidget
+	* \brief Widget displaying a list (or a grid) of items while only creating widgets for the visible ones
+	*
+	* Item widgets are created by the item factory (as children of the list) and bound to an item index by the item updater.
+	* They are recycled while scrolling, so only the visible items (plus a few overscan rows) exist at any time.
+	*
+	* This widget is meant to be used as the content of a ScrollAreaWidget, which resizes it to the height of all its items.
+	*/
+	VirtualListWidget::VirtualListWidget(BaseWidget* parent, ItemFactory itemFactory, ItemUpdater itemUpdater) :
+	BaseWidget(parent),
+	m_itemFactory(std::move(itemFactory)),
+	m_itemUpdater(std::move(itemUpdater)),
+	m_columnCount(1),
+	m_firstItem(0),
+	m_itemCount(0),
+	m_lastItem(0),
+	m_overscanRowCount(2),
+	m_itemLayoutSize(0.f, 0.f),
+	m_itemHeight(20.f),
+	m_itemPositionsInvalidated(false),
+	m_refreshItems(false)
+	{
+		NazaraAssert(m_itemFactory, "invalid item factory");
+		NazaraAssert(m_itemUpdater, "invalid item updater");
+	}
+
+	/*!
+	* \brief Returns the distance between the top of the list and a row
+	*/
+	float VirtualListWidget::GetRowOffset(std::size_t rowIndex) const
+	{
+		NazaraAssertFmt(rowIndex <= GetRowCount(), "row index out of range ({0} > {1})", rowIndex, GetRowCount());
+
+		if (m_rowOffsets.empty())
+			return rowIndex * m_itemHeight;
+		else
+			return m_rowOffsets[rowIndex];
+	}
+
+	void VirtualListWidget::RefreshItem(std::size_t itemIndex)
+	{
+		if (itemIndex < m_firstItem || itemIndex >= m_lastItem)
+			return;
+
+		for (const Item& item : m_items)
+		{
+			if (item.index == itemIndex)
+			{
+				m_itemUpdater(item.widget, item.index);
+				break;
+			}
+		}
+	}
+
+	/*!
+	* \brief Recomputes the height of items starting from an item index, must be called when the item height callback returns different values
+	*/
+	void VirtualListWidget::RefreshItemHeights(std::size_t firstItemIndex)
+	{
+		if (!m_itemHeightCallback)
+			return;
+
+		UpdateHeightIndex(std::min(firstItemIndex / m_columnCount, GetRowCount()));
+
+		m_itemPositionsInvalidated = true;
+		InvalidateLayout();
+	}
+
+	void VirtualListWidget::RefreshItems()
+	{
+		for (const Item& item : m_items)
+			m_itemUpdater(item.widget, item.index);
+	}
+
+	void VirtualListWidget::SetColumnCount(std::size_t columnCount)
+	{
+		NazaraAssert(columnCount > 0, "column count must be over zero");
+
+		m_columnCount = columnCount;
+		UpdateHeightIndex(0);
+
+		m_itemPositionsInvalidated = true;
+		m_refreshItems = true;
+		InvalidateLayout();
+	}
+
+	/*!
+	* \brief Changes the item count
+	*
+	* Heights of previous items are kept (see RefreshItemHeights) and visible items are refreshed.
+	*/
+	void VirtualListWidget::SetItemCount(std::size_t itemCount)
+	{
+		std::size_t previousRowCount = GetRowCount();
+
+		m_itemCount = itemCount;
+
+		// Last previous row may now contain more items
+		std::size_t firstChangedRow = std::min(previousRowCount, GetRowCount());
+		UpdateHeightIndex((firstChangedRow > 0) ? firstChangedRow - 1 : 0);
+
+		m_refreshItems = true;
+		InvalidateLayout();
+	}
+
+	void VirtualListWidget::SetItemHeight(float itemHeight)
+	{
+		m_itemHeight = itemHeight;
+		UpdateHeightIndex(0);
+
+		m_itemPositionsInvalidated = true;
+		InvalidateLayout();
+	}
+
+	/*!
+	* \brief Sets a callback giving the height of each item, allowing rows of variable heights
+	*
+	* The height of a row is the maximum height of its items.
+	* Heights are queried once for every item and kept in a prefix sum index, call RefreshItemHeights if they change.
+	*
+	* \param itemHeightCallback Callback returning the height of an item, or an empty callback to use the same height for every item (see SetItemHeight)
+	*/
+	void VirtualListWidget::SetItemHeightCallback(ItemHeightCallback itemHeightCallback)
+	{
+		m_itemHeightCallback = std::move(itemHeightCallback);
+		UpdateHeightIndex(0);
+
+		m_itemPositionsInvalidated = true;
+		InvalidateLayout();
+	}
+
+	void VirtualListWidget::SetRenderingRect(const Rectf& renderingRect)
+	{
+		BaseWidget::SetRenderingRect(renderingRect);
+
+		// Visible items depend on the rendering rect (which is updated by ScrollAreaWidget when scrolling)
+		InvalidateLayout();
+	}
+
+	std::size_t VirtualListWidget::FindRow(float offset) const
+	{
+		std::size_t rowCount = GetRowCount();
+		assert(rowCount > 0);
+
+		std::size_t rowIndex;
+		if (m_rowOffsets.empty())
+			rowIndex = (m_itemHeight > 0.f) ? static_cast<std::size_t>(std::max(offset, 0.f) / m_itemHeight) : 0;
+		else
+		{
+			auto it = std::upper_bound(m_rowOffsets.begin(), m_rowOffsets.end(), offset);
+			rowIndex = (it != m_rowOffsets.begin()) ? std::distance(m_rowOffsets.begin(), it) - 1 : 0;
+		}
+
+		return std::min(rowIndex, rowCount - 1);
+	}
+
+	float VirtualListWidget::GetRowHeight(std::size_t rowIndex) const
+	{
+		return GetRowOffset(rowIndex + 1) - GetRowOffset(rowIndex);
+	}
+
+	void VirtualListWidget::Layout()
+	{
+		BaseWidget::Layout();
+
+		Vector2f size = GetSize();
+
+		// Only items visible through our rendering rect and our parent need widgets
+		Rectf visibleRect(0.f, 0.f, size.x, size.y);
+		bool isVisible = visibleRect.Intersect(GetRenderingRect(), &visibleRect);
+		if (const BaseWidget* parent = GetParentWidget(); parent && isVisible)
+		{
+			Vector3f position = GetPosition();
+			isVisible = visibleRect.Intersect(Rectf(-position.x, -position.y, parent->GetWidth(), parent->GetHeight()), &visibleRect);
+		}
+
+		std::size_t firstItem = 0;
+		std::size_t lastItem = 0;
+
+		std::size_t rowCount = GetRowCount();
+		if (isVisible && rowCount > 0)
+		{
+			// Widget coordinates go upwards while rows are laid out from the top
+			std::size_t firstRow = FindRow(size.y - (visibleRect.y + visibleRect.height));
+			std::size_t lastRow = FindRow(size.y - visibleRect.y) + 1;
+
+			firstRow = (firstRow > m_overscanRowCount) ? firstRow - m_overscanRowCount : 0;
+			lastRow = std::min(lastRow + m_overscanRowCount, rowCount);
+
+			firstItem = firstRow * m_columnCount;
+			lastItem = std::min(lastRow * m_columnCount, m_itemCount);
+		}
+
+		float columnWidth = size.x / m_columnCount;
+		auto PlaceItem = [&](const Item& item)
+		{
+			std::size_t rowIndex = item.index / m_columnCount;
+			std::size_t columnIndex = item.index % m_columnCount;
+
+			float rowHeight = GetRowHeight(rowIndex);
+
+			item.widget->SetPosition({ columnIndex * columnWidth, size.y - GetRowOffset(rowIndex) - rowHeight });
+			item.widget->Resize({ columnWidth, rowHeight });
+		};
+
+		// Release widgets of items which are no longer visible
+		std::size_t keptItemCount = 0;
+		for (const Item& item : m_items)
+		{
+			if (item.index >= firstItem && item.index < lastItem)
+				m_items[keptItemCount++] = item;
+			else
+				m_freeWidgets.push_back(item.widget);
+		}
+		m_items.resize(keptItemCount);
+
+		bool placeItems = m_itemPositionsInvalidated || size != m_itemLayoutSize;
+		for (const Item& item : m_items)
+		{
+			if (m_refreshItems)
+				m_itemUpdater(item.widget, item.index);
+
+			if (placeItems)
+				PlaceItem(item);
+		}
+
+		// Bind released (or new) widgets to items becoming visible
+		for (std::size_t itemIndex = firstItem; itemIndex < lastItem; ++itemIndex)
+		{
+			if (itemIndex >= m_firstItem && itemIndex < m_lastItem)
+				continue;
+
+			BaseWidget* widget;
+			if (!m_freeWidgets.empty())
+			{
+				widget = m_freeWidgets.back();
+				m_freeWidgets.pop_back();
+			}
+			else
+			{
+				widget = m_itemFactory(this);
+				NazaraAssert(widget, "item factory returned an invalid widget");
+			}
+
+			Item& item = m_items.emplace_back();
+			item.index = itemIndex;
+			item.widget = widget;
+
+			m_itemUpdater(widget, itemIndex);
+			PlaceItem(item);
+
+			widget->Show(IsVisible());
+		}
+
+		for (BaseWidget* widget : m_freeWidgets)
+		{
+			if (widget->IsVisible())
+				widget->Hide();
+		}
+
+		m_firstItem = firstItem;
+		m_lastItem = lastItem;
+		m_itemLayoutSize = size;
+		m_itemPositionsInvalidated = false;
+		m_refreshItems = false;
+	}
+
+	void VirtualListWidget::ShowChildren(bool show)
+	{
+		// Don't show recycled widgets
+		if (show)
+		{
+			for (const Item& item : m_items)
+				item.widget->Show();
+		}
+		else
+			BaseWidget::ShowChildren(false);
+	}
+
+	void VirtualListWidget::UpdateHeightIndex(std::size_t firstRow)
+	{
+		std::size_t rowCount = GetRowCount();
+		if (m_itemHeightCallback)
+		{
+			m_rowOffsets.resize(rowCount + 1);
+			m_rowOffsets[0] = 0.f;
+
+			// Accumulate in double precision to prevent error from building up over millions of rows
+			double offset = m_rowOffsets[firstRow];
+			for (std::size_t rowIndex = firstRow; rowIndex < rowCount; ++rowIndex)
+			{
+				std::size_t firstItem = rowIndex * m_columnCount;
+				std::size_t lastItem = std::min(firstItem + m_columnCount, m_itemCount);
+
+				float rowHeight = 0.f;
+				for (std::size_t itemIndex = firstItem; itemIndex < lastItem; ++itemIndex)
+					rowHeight = std::max(rowHeight, m_itemHeightCallback(itemIndex));
+
+				offset += rowHeight;
+				m_rowOffsets[rowIndex + 1] = static_cast<float>(offset);
+			}
+		}
+		else
+			m_rowOffsets.clear();
+
+		SetPreferredSize({ GetPreferredWidth(), GetRowOffset(rowCount) });
+	}
+}
@@ -0,0 +1,158 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	// Glyph-like images, small and mostly taller than wide
+	constexpr std::size_t imageCount = 20'000;
+	constexpr std::size_t churnCount = 50'000;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<unsigned int> widthDis(4, 40);
+	std::uniform_int_distribution<unsigned int> heightDis(8, 48);
+
+	std::vector<Nz::Image> images(imageCount);
+	for (Nz::Image& image : images)
+	{
+		image.Create(Nz::ImageType::E2D, Nz::PixelFormat::A8, widthDis(randEngine), heightDis(randEngine));
+		std::memset(image.GetPixels(), 0xFF, image.GetWidth() * image.GetHeight());
+	}
+
+	constexpr std::array<std::pair<Nz::BinPackAlgorithm, const char*>, 3> algorithms = {
+		std::make_pair(Nz::BinPackAlgorithm::Guillotine, "guillotine"),
+		std::make_pair(Nz::BinPackAlgorithm::MaxRects, "maxrects"),
+		std::make_pair(Nz::BinPackAlgorithm::Skyline, "skyline")
+	};
+
+	struct Entry
+	{
+		Nz::Rectui rect;
+		std::size_t layerIndex;
+		bool flipped;
+	};
+
+	for (auto&& [algorithm, name] : algorithms)
+	{
+		Nz::GuillotineImageAtlas atlas;
+		atlas.SetMaxLayerSize(2048);
+		atlas.SetPackingAlgorithm(algorithm);
+
+		auto PrintOccupancy = [&]
+		{
+			std::cout << "  " << atlas.GetLayerCount() << " layer(s), occupancy:";
+			for (std::size_t i = 0; i < atlas.GetLayerCount(); ++i)
+				std::cout << " " << atlas.GetLayerOccupancy(i) * 100.f << "%";
+
+			std::cout << std::endl;
+		};
+
+		std::cout << name << ":" << std::endl;
+
+		// Insert every image, one at a time like glyphs being rendered for the first time
+		std::vector<Entry> entries(imageCount);
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < imageCount; ++i)
+		{
+			Entry& entry = entries[i];
+			entry.rect = Nz::Rectui(0, 0, images[i].GetWidth(), images[i].GetHeight());
+			if (!atlas.Insert(images[i], &entry.rect, &entry.flipped, &entry.layerIndex))
+			{
+				std::cerr << "failed to insert image #" << i << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		std::cout << "  inserted " << imageCount << " images in " << (t2 - t1) << " (" << Nz::Time::Nanoseconds((t2 - t1).AsNanoseconds() / imageCount) << " per image)" << std::endl;
+		PrintOccupancy();
+
+		// Long running session: images are freed and replaced by new ones
+		std::size_t initialLayerCount = atlas.GetLayerCount();
+
+		t1 = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < churnCount; ++i)
+		{
+			std::size_t entryIndex = randEngine() % entries.size();
+			std::size_t imageIndex = randEngine() % images.size();
+
+			Entry& entry = entries[entryIndex];
+			atlas.Free(&entry.rect, &entry.layerIndex, 1);
+
+			entry.rect = Nz::Rectui(0, 0, images[imageIndex].GetWidth(), images[imageIndex].GetHeight());
+			if (!atlas.Insert(images[imageIndex], &entry.rect, &entry.flipped, &entry.layerIndex))
+			{
+				std::cerr << "failed to insert image #" << imageIndex << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		t2 = Nz::GetElapsedNanoseconds();
+
+		std::cout << "  replaced " << churnCount << " images in " << (t2 - t1) << ", " << atlas.GetLayerCount() - initialLayerCount << " new layer(s)" << std::endl;
+		PrintOccupancy();
+
+		// Keep track of relocated rectangles like a font would
+		atlas.OnAtlasRectsRelocated.Connect([&](const Nz::AbstractAtlas*, std::size_t layerIndex, Nz::AbstractImage*, Nz::SparsePtr<const Nz::Rectui> oldRects, Nz::SparsePtr<const Nz::Rectui> newRects, std::size_t count)
+		{
+			std::unordered_map<Nz::UInt64, Nz::Rectui> newPositions;
+			for (std::size_t i = 0; i < count; ++i)
+				newPositions.emplace((Nz::UInt64(oldRects[i].x) << 32) | oldRects[i].y, newRects[i]);
+
+			for (Entry& entry : entries)
+			{
+				if (entry.layerIndex != layerIndex)
+					continue;
+
+				auto it = newPositions.find((Nz::UInt64(entry.rect.x) << 32) | entry.rect.y);
+				if (it != newPositions.end())
+					entry.rect = it->second;
+			}
+		});
+
+		t1 = Nz::GetElapsedNanoseconds();
+		std::size_t defragmentedCount = 0;
+		for (std::size_t i = 0; i < atlas.GetLayerCount(); ++i)
+		{
+			if (atlas.Defragment(i))
+				defragmentedCount++;
+		}
+		t2 = Nz::GetElapsedNanoseconds();
+
+		std::cout << "  defragmented " << defragmentedCount << " layer(s) in " << (t2 - t1) << std::endl;
+
+		// Space given back by the defragmentation is used by the next insertions instead of new layers
+		std::size_t layerCount = atlas.GetLayerCount();
+		for (std::size_t i = 0; i < churnCount; ++i)
+		{
+			std::size_t entryIndex = randEngine() % entries.size();
+			std::size_t imageIndex = randEngine() % images.size();
+
+			Entry& entry = entries[entryIndex];
+			atlas.Free(&entry.rect, &entry.layerIndex, 1);
+
+			entry.rect = Nz::Rectui(0, 0, images[imageIndex].GetWidth(), images[imageIndex].GetHeight());
+			if (!atlas.Insert(images[imageIndex], &entry.rect, &entry.flipped, &entry.layerIndex))
+			{
+				std::cerr << "failed to insert image #" << imageIndex << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+
+		std::cout << "  replaced " << churnCount << " images after defragmentation, " << atlas.GetLayerCount() - layerCount << " new layer(s)" << std::endl;
+		PrintOccupancy();
+	}
+
+	return 0;
+}
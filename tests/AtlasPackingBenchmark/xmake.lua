@@ -0,0 +1,3 @@
+target("AtlasPackingBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,101 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	constexpr unsigned int imageSize = 1024;
+
+	// Gradients with noise, as pure noise would make every encoder look equally bad
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<int> noiseDis(-12, 12);
+
+	Nz::Image sourceImage(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, imageSize, imageSize);
+
+	Nz::UInt8* pixels = sourceImage.GetPixels();
+	for (unsigned int y = 0; y < imageSize; ++y)
+	{
+		for (unsigned int x = 0; x < imageSize; ++x)
+		{
+			Nz::UInt8* pixel = &pixels[(y * imageSize + x) * 4];
+			pixel[0] = Nz::UInt8(std::clamp(int(127.f + 127.f * std::sin(x * 0.05f)) + noiseDis(randEngine), 0, 255));
+			pixel[1] = Nz::UInt8(std::clamp(int(127.f + 127.f * std::cos(y * 0.03f)) + noiseDis(randEngine), 0, 255));
+			pixel[2] = Nz::UInt8(std::clamp(int((x ^ y) & 0xFF) + noiseDis(randEngine), 0, 255));
+			pixel[3] = Nz::UInt8(std::clamp(int(x * 255 / imageSize) + noiseDis(randEngine), 0, 255));
+		}
+	}
+
+	auto ComputePSNR = [&](const Nz::Image& image, unsigned int channelCount)
+	{
+		const Nz::UInt8* referencePixels = sourceImage.GetConstPixels();
+		const Nz::UInt8* decodedPixels = image.GetConstPixels();
+
+		double squaredError = 0.0;
+		for (std::size_t i = 0; i < std::size_t(imageSize) * imageSize; ++i)
+		{
+			for (unsigned int c = 0; c < channelCount; ++c)
+			{
+				double diff = double(referencePixels[i * 4 + c]) - double(decodedPixels[i * 4 + c]);
+				squaredError += diff * diff;
+			}
+		}
+
+		double meanSquaredError = squaredError / (double(imageSize) * imageSize * channelCount);
+		return (meanSquaredError > 0.0) ? 10.0 * std::log10(255.0 * 255.0 / meanSquaredError) : 100.0;
+	};
+
+	Nz::TaskScheduler taskScheduler;
+
+	auto Measure = [&](Nz::PixelFormat format, unsigned int channelCount, Nz::BlockCompressionQuality quality, Nz::TaskScheduler* scheduler)
+	{
+		std::string qualityName;
+		switch (quality)
+		{
+			case Nz::BlockCompressionQuality::Fast:   qualityName = "fast"; break;
+			case Nz::BlockCompressionQuality::Normal: qualityName = "normal"; break;
+			case Nz::BlockCompressionQuality::High:   qualityName = "high"; break;
+		}
+
+		Nz::BlockCompressionParams params;
+		params.quality = quality;
+
+		Nz::Image image(sourceImage);
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		image.Convert(format, params, scheduler);
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		image.Convert(Nz::PixelFormat::RGBA8, scheduler);
+
+		double texelsPerSecond = double(imageSize) * imageSize / (t2 - t1).AsSeconds<double>();
+		std::cout << Nz::PixelFormatInfo::GetName(format) << " " << qualityName << ((scheduler) ? " (parallel)" : "") << ": " << (t2 - t1) << " (" << texelsPerSecond / 1'000'000.0 << "M texels/s), PSNR: " << ComputePSNR(image, channelCount) << "dB" << std::endl;
+	};
+
+	struct FormatInfo
+	{
+		Nz::PixelFormat format;
+		unsigned int channelCount;
+	};
+
+	for (const FormatInfo& formatInfo : { FormatInfo{ Nz::PixelFormat::DXT1, 3 }, FormatInfo{ Nz::PixelFormat::DXT3, 4 }, FormatInfo{ Nz::PixelFormat::DXT5, 4 }, FormatInfo{ Nz::PixelFormat::BC4, 1 }, FormatInfo{ Nz::PixelFormat::BC5, 2 }, FormatInfo{ Nz::PixelFormat::BC7, 4 } })
+	{
+		for (Nz::BlockCompressionQuality quality : { Nz::BlockCompressionQuality::Fast, Nz::BlockCompressionQuality::Normal, Nz::BlockCompressionQuality::High })
+		{
+			Measure(formatInfo.format, formatInfo.channelCount, quality, nullptr);
+			Measure(formatInfo.format, formatInfo.channelCount, quality, &taskScheduler);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+target("BlockCompressionBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,172 @@
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// A datagram as ENetHost hands it to the compressor: command headers and payloads in separate buffers
+struct Datagram
+{
+	std::vector<Nz::UInt8> data;
+	std::vector<std::size_t> bufferSizes;
+};
+
+// Trace files are a sequence of datagrams, each one being a little-endian UInt16 size followed by the datagram bytes
+std::vector<Datagram> LoadTrace(const char* filePath)
+{
+	std::vector<Datagram> trace;
+
+	std::ifstream file(filePath, std::ios::binary);
+	std::array<Nz::UInt8, 2> sizeBytes;
+	while (file.read(reinterpret_cast<char*>(sizeBytes.data()), sizeBytes.size()))
+	{
+		Datagram& datagram = trace.emplace_back();
+		datagram.data.resize(sizeBytes[0] | (sizeBytes[1] << 8));
+		if (!file.read(reinterpret_cast<char*>(datagram.data.data()), datagram.data.size()))
+		{
+			trace.pop_back();
+			break;
+		}
+
+		datagram.bufferSizes.push_back(datagram.data.size());
+	}
+
+	return trace;
+}
+
+// Snapshot-like traffic: every tick sends the state of visible entities, which changes slowly
+std::vector<Datagram> GenerateTrace(std::size_t datagramCount)
+{
+	std::mt19937 randomGenerator(42);
+
+	struct Entity
+	{
+		Nz::UInt32 position[3];
+		Nz::UInt16 id;
+		Nz::UInt16 health;
+		Nz::UInt8 state;
+	};
+
+	std::vector<Entity> entities(256);
+	for (std::size_t i = 0; i < entities.size(); ++i)
+	{
+		entities[i].id = static_cast<Nz::UInt16>(i);
+		entities[i].health = 100;
+		entities[i].state = 0;
+		for (Nz::UInt32& coord : entities[i].position)
+			coord = randomGenerator() % 10'000;
+	}
+
+	auto Append = [](Datagram& datagram, const void* data, std::size_t size)
+	{
+		const Nz::UInt8* ptr = static_cast<const Nz::UInt8*>(data);
+		datagram.data.insert(datagram.data.end(), ptr, ptr + size);
+		datagram.bufferSizes.push_back(size);
+	};
+
+	std::vector<Datagram> trace(datagramCount);
+	for (std::size_t tick = 0; tick < datagramCount; ++tick)
+	{
+		Datagram& datagram = trace[tick];
+
+		std::size_t visibleCount = 10 + randomGenerator() % 60;
+		std::size_t firstEntity = randomGenerator() % (entities.size() - visibleCount);
+
+		// Reliable command header (command, channel, sequence number, data length) followed by entity records
+		std::array<Nz::UInt8, 6> commandHeader = { 0x86, 0x00, static_cast<Nz::UInt8>(tick >> 8), static_cast<Nz::UInt8>(tick), static_cast<Nz::UInt8>((visibleCount * sizeof(Entity)) >> 8), static_cast<Nz::UInt8>(visibleCount * sizeof(Entity)) };
+		Append(datagram, commandHeader.data(), commandHeader.size());
+
+		for (std::size_t i = firstEntity; i < firstEntity + visibleCount; ++i)
+		{
+			Entity& entity = entities[i];
+			for (Nz::UInt32& coord : entity.position)
+				coord += randomGenerator() % 5;
+
+			if (randomGenerator() % 50 == 0)
+				entity.health = static_cast<Nz::UInt16>(randomGenerator() % 101);
+
+			entity.state = static_cast<Nz::UInt8>(randomGenerator() % 4);
+		}
+
+		Append(datagram, &entities[firstEntity], visibleCount * sizeof(Entity));
+	}
+
+	return trace;
+}
+
+void RunBenchmark(const char* name, Nz::ENetCompressor& compressor, const std::vector<Datagram>& trace)
+{
+	std::array<Nz::UInt8, 4096> compressed;
+	std::array<Nz::UInt8, 4096> decompressed;
+
+	std::size_t decompressedBytes = 0;
+	std::size_t failureCount = 0;
+	for (const Datagram& datagram : trace)
+	{
+		std::vector<Nz::NetBuffer> buffers;
+		std::size_t offset = 0;
+		for (std::size_t bufferSize : datagram.bufferSizes)
+		{
+			buffers.push_back(Nz::NetBuffer{ const_cast<Nz::UInt8*>(datagram.data.data()) + offset, bufferSize });
+			offset += bufferSize;
+		}
+
+		std::size_t compressedSize = compressor.Compress(nullptr, buffers.data(), buffers.size(), datagram.data.size(), compressed.data(), compressed.size());
+		if (compressedSize == 0)
+			continue;
+
+		std::size_t decompressedSize = compressor.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+		if (decompressedSize != datagram.data.size() || !std::equal(datagram.data.begin(), datagram.data.end(), decompressed.begin()))
+			failureCount++;
+
+		decompressedBytes += decompressedSize;
+	}
+
+	const auto& statistics = compressor.GetGlobalStatistics();
+
+	std::size_t packetCount = statistics.compressedPacketCount + statistics.uncompressedPacketCount;
+	double compressionMBs = statistics.inputSize / statistics.compressionTime.AsSeconds<double>() / (1024.0 * 1024.0);
+	double decompressionMBs = (statistics.decompressedPacketCount > 0) ? decompressedBytes / statistics.decompressionTime.AsSeconds<double>() / (1024.0 * 1024.0) : 0.0;
+
+	std::cout << std::setw(14) << name << std::fixed << std::setprecision(3)
+	          << std::setw(10) << statistics.GetCompressionRatio()
+	          << std::setw(14) << statistics.compressedPacketCount << "/" << packetCount
+	          << std::setprecision(1)
+	          << std::setw(16) << compressionMBs
+	          << std::setw(18) << decompressionMBs;
+
+	if (failureCount > 0)
+		std::cout << "  (" << failureCount << " roundtrip failures!)";
+
+	std::cout << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<Datagram> trace = (argc > 1) ? LoadTrace(argv[1]) : GenerateTrace(20'000);
+	if (trace.empty())
+	{
+		std::cerr << "empty packet trace" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::size_t totalSize = 0;
+	for (const Datagram& datagram : trace)
+		totalSize += datagram.data.size();
+
+	std::cout << trace.size() << " datagrams, " << totalSize / trace.size() << " bytes on average" << std::endl;
+	std::cout << std::setw(14) << "compressor" << std::setw(10) << "ratio" << std::setw(20) << "compressed" << std::setw(16) << "comp. (MiB/s)" << std::setw(18) << "decomp. (MiB/s)" << std::endl;
+
+	Nz::ENetLZ4Compressor lz4Compressor;
+	RunBenchmark("LZ4", lz4Compressor, trace);
+
+	Nz::ENetRangeCoderCompressor rangeCoderCompressor;
+	RunBenchmark("Range coder", rangeCoderCompressor, trace);
+
+	return EXIT_SUCCESS;
+}
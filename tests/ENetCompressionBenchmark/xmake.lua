@@ -0,0 +1,3 @@
+target("ENetCompressionBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,210 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+constexpr Nz::UInt16 ServerPort = 64321;
+constexpr std::size_t MessageSize = 64;
+constexpr std::size_t MessagesPerTick = 4;
+
+// A thread simulating several clients, each one using its own host (and thus its own source port)
+class ClientGroup
+{
+	public:
+		ClientGroup(std::size_t clientCount) :
+		m_echoCount(0)
+		{
+			Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), ServerPort);
+
+			for (std::size_t i = 0; i < clientCount; ++i)
+			{
+				auto& host = m_hosts.emplace_back(std::make_unique<Nz::ENetHost>());
+				host->Create(Nz::IpAddress::LoopbackIpV4, 1, 1);
+				host->Connect(serverAddress, 1);
+			}
+		}
+
+		bool WaitForConnections(Nz::Time timeout)
+		{
+			Nz::Time endTime = Nz::GetElapsedNanoseconds() + timeout;
+
+			std::size_t connectedCount = 0;
+			while (connectedCount < m_hosts.size() && Nz::GetElapsedNanoseconds() < endTime)
+			{
+				for (auto& host : m_hosts)
+				{
+					Nz::ENetEvent event;
+					while (host->Service(&event, 0) > 0)
+					{
+						if (event.type == Nz::ENetEventType::OutgoingConnect)
+						{
+							m_peers.push_back(event.peer);
+							connectedCount++;
+						}
+					}
+				}
+
+				std::this_thread::yield();
+			}
+
+			return connectedCount == m_hosts.size();
+		}
+
+		void Run(const std::atomic_bool& running)
+		{
+			std::vector<Nz::UInt8> message(MessageSize, 0xCD);
+
+			while (running.load(std::memory_order_relaxed))
+			{
+				for (Nz::ENetPeer* peer : m_peers)
+				{
+					for (std::size_t i = 0; i < MessagesPerTick; ++i)
+						peer->Send(0, Nz::ENetPacketFlag::Unsequenced, Nz::ByteArray(message.data(), message.size()));
+				}
+
+				for (auto& host : m_hosts)
+				{
+					Nz::ENetEvent event;
+					while (host->Service(&event, 0) > 0)
+					{
+						if (event.type == Nz::ENetEventType::Receive)
+							m_echoCount++;
+					}
+				}
+			}
+		}
+
+		std::size_t GetEchoCount() const
+		{
+			return m_echoCount;
+		}
+
+	private:
+		std::size_t m_echoCount;
+		std::vector<std::unique_ptr<Nz::ENetHost>> m_hosts;
+		std::vector<Nz::ENetPeer*> m_peers;
+};
+
+void RunBenchmark(std::size_t shardCount, std::size_t clientCount, std::size_t clientThreadCount, Nz::Time duration)
+{
+	Nz::ENetShardedHost server;
+	if (!server.Create(Nz::NetProtocol::IPv4, ServerPort, shardCount, clientCount, 1))
+	{
+		std::cerr << "failed to create a server with " << shardCount << " shards" << std::endl;
+		return;
+	}
+
+	std::vector<std::atomic_size_t> clientsPerShard(shardCount);
+
+	// Echo everything back from the shard thread, reusing the received packet
+	server.Start([&](std::size_t shardIndex, Nz::ENetHost& /*host*/, Nz::ENetEvent& event)
+	{
+		switch (event.type)
+		{
+			case Nz::ENetEventType::IncomingConnect:
+				clientsPerShard[shardIndex]++;
+				break;
+
+			case Nz::ENetEventType::Receive:
+				event.peer->Send(event.channelId, event.packet);
+				break;
+
+			default:
+				break;
+		}
+	});
+
+	std::vector<std::unique_ptr<ClientGroup>> clientGroups;
+	for (std::size_t i = 0; i < clientThreadCount; ++i)
+	{
+		std::size_t groupClientCount = clientCount / clientThreadCount + ((i < clientCount % clientThreadCount) ? 1 : 0);
+		clientGroups.push_back(std::make_unique<ClientGroup>(groupClientCount));
+	}
+
+	std::atomic_bool running = true;
+	std::atomic_size_t failedGroups = 0;
+
+	std::vector<std::thread> clientThreads;
+	for (auto& clientGroup : clientGroups)
+	{
+		clientThreads.emplace_back([&, group = clientGroup.get()]
+		{
+			if (!group->WaitForConnections(Nz::Time::Seconds(5)))
+			{
+				failedGroups++;
+				return;
+			}
+
+			group->Run(running);
+		});
+	}
+
+	// Let clients connect, then measure over the requested duration
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+	Nz::UInt32 startReceivedPackets = server.GetTotalReceivedPackets();
+	Nz::UInt64 startReceivedData = server.GetTotalReceivedData();
+	Nz::Time startTime = Nz::GetElapsedNanoseconds();
+
+	// Exercise the cross-shard queue with a server-wide broadcast every 100ms
+	while (Nz::GetElapsedNanoseconds() - startTime < duration)
+	{
+		server.Broadcast(0, Nz::ENetPacketFlag::Reliable, Nz::ByteArray(16, 0xEF));
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+
+	double elapsedTime = (Nz::GetElapsedNanoseconds() - startTime).AsSeconds<double>();
+	Nz::UInt32 receivedPackets = server.GetTotalReceivedPackets() - startReceivedPackets;
+	Nz::UInt64 receivedData = server.GetTotalReceivedData() - startReceivedData;
+
+	running = false;
+	for (std::thread& thread : clientThreads)
+		thread.join();
+
+	std::size_t echoCount = 0;
+	for (auto& clientGroup : clientGroups)
+		echoCount += clientGroup->GetEchoCount();
+
+	std::cout << std::setw(7) << shardCount << std::fixed << std::setprecision(0)
+	          << std::setw(20) << receivedPackets / elapsedTime
+	          << std::setprecision(1)
+	          << std::setw(18) << receivedData / elapsedTime / (1024.0 * 1024.0)
+	          << std::setprecision(0)
+	          << std::setw(16) << echoCount / elapsedTime
+	          << "   ";
+
+	for (std::size_t i = 0; i < shardCount; ++i)
+		std::cout << (i > 0 ? "/" : "") << clientsPerShard[i].load();
+
+	if (failedGroups > 0)
+		std::cout << "  (" << failedGroups << " client threads failed to connect)";
+
+	std::cout << std::endl;
+
+	server.Destroy();
+}
+
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::Network> network;
+
+	std::size_t clientCount = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 256;
+	std::size_t maxShardCount = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : std::max(std::thread::hardware_concurrency() / 2, 1u);
+	std::size_t clientThreadCount = std::max<std::size_t>(maxShardCount, 1);
+	Nz::Time duration = Nz::Time::Seconds(3);
+
+	std::cout << clientCount << " simulated clients on " << clientThreadCount << " threads, " << MessagesPerTick << "x" << MessageSize << " bytes unsequenced messages per client tick" << std::endl;
+	std::cout << std::setw(7) << "shards" << std::setw(20) << "recv. (packets/s)" << std::setw(18) << "recv. (MiB/s)" << std::setw(16) << "echoes/s" << "   clients per shard" << std::endl;
+
+	for (std::size_t shardCount = 1; shardCount <= maxShardCount; shardCount *= 2)
+		RunBenchmark(shardCount, clientCount, clientThreadCount, duration);
+
+	return EXIT_SUCCESS;
+}
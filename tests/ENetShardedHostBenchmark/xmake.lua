@@ -0,0 +1,3 @@
+target("ENetShardedHostBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
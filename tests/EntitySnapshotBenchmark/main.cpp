@@ -0,0 +1,148 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/EntitySnapshotDecoder.hpp>
+#include <Nazara/Network/EntitySnapshotEncoder.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr std::size_t TickCount = 100;
+
+struct Transform
+{
+	Nz::Vector3f position;
+	Nz::Quaternionf rotation;
+};
+
+struct Health
+{
+	int health;
+	bool isAlive;
+};
+
+struct Result
+{
+	double captureTime = 0.0;
+	double decodeTime = 0.0;
+	double encodeTime = 0.0;
+	std::size_t entityCount = 0;
+	std::size_t packetSize = 0;
+	std::size_t snapshotCount = 0;
+};
+
+void PrintResult(const char* name, const Result& result)
+{
+	double entitiesPerSnapshot = double(result.entityCount) / result.snapshotCount;
+
+	std::cout << std::setw(24) << name << std::fixed << std::setprecision(1)
+	          << std::setw(14) << result.packetSize * 8.0 / result.entityCount
+	          << std::setw(14) << double(result.packetSize) / result.snapshotCount / 1024.0
+	          << std::setprecision(2)
+	          << std::setw(14) << result.captureTime * 1000.0 / result.snapshotCount
+	          << std::setw(14) << result.encodeTime * 1000.0 / result.snapshotCount
+	          << std::setw(14) << result.decodeTime * 1000.0 / result.snapshotCount
+	          << std::setprecision(1)
+	          << std::setw(18) << entitiesPerSnapshot * result.snapshotCount / result.encodeTime / 1'000'000.0
+	          << std::setw(18) << entitiesPerSnapshot * result.snapshotCount / result.decodeTime / 1'000'000.0
+	          << std::endl;
+}
+
+// Simulates a server sending snapshots to a client acknowledging every one of them, movingRatio being the ratio of entities moving each tick
+Result RunBenchmark(const std::shared_ptr<Nz::EntitySnapshotSchema>& schema, std::size_t entityCount, float movingRatio, bool acknowledge)
+{
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> positionDis(-1000.f, 1000.f);
+	std::uniform_real_distribution<float> unitDis(-1.f, 1.f);
+	std::uniform_real_distribution<float> ratioDis(0.f, 1.f);
+
+	entt::registry serverRegistry;
+	for (std::size_t i = 0; i < entityCount; ++i)
+	{
+		entt::entity entity = serverRegistry.create();
+		serverRegistry.emplace<Transform>(entity, Transform{ Nz::Vector3f(positionDis(randomGenerator), 0.f, positionDis(randomGenerator)), Nz::Quaternionf::Normalize(Nz::Quaternionf(unitDis(randomGenerator), 0.f, unitDis(randomGenerator), 0.f)) });
+		if (i % 4 == 0)
+			serverRegistry.emplace<Health>(entity, Health{ 100, true });
+	}
+
+	entt::registry clientRegistry;
+	Nz::EntitySnapshotEncoder encoder(schema);
+	Nz::EntitySnapshotDecoder decoder(schema);
+
+	Result result;
+	for (Nz::UInt32 tick = 1; tick <= TickCount; ++tick)
+	{
+		for (auto&& [entity, transform] : serverRegistry.view<Transform>().each())
+		{
+			if (ratioDis(randomGenerator) < movingRatio)
+			{
+				transform.position.x += unitDis(randomGenerator);
+				transform.position.z += unitDis(randomGenerator);
+			}
+		}
+
+		Nz::Time startTime = Nz::GetElapsedNanoseconds();
+		std::shared_ptr<Nz::EntitySnapshot> snapshot = schema->Capture(serverRegistry, tick);
+		Nz::Time captureTime = Nz::GetElapsedNanoseconds();
+		Nz::ByteArray packet = encoder.Encode(snapshot);
+		Nz::Time encodeTime = Nz::GetElapsedNanoseconds();
+		std::shared_ptr<const Nz::EntitySnapshot> decodedSnapshot = decoder.Decode(packet.GetConstBuffer(), packet.GetSize());
+		Nz::Time decodeTime = Nz::GetElapsedNanoseconds();
+
+		if (!decodedSnapshot)
+		{
+			std::cerr << "failed to decode snapshot #" << tick << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+
+		// Skip the first (full) snapshot when measuring deltas
+		if (acknowledge && tick == 1)
+		{
+			encoder.Acknowledge(tick);
+			continue;
+		}
+
+		decoder.Apply(clientRegistry, *decodedSnapshot);
+		if (acknowledge)
+			encoder.Acknowledge(tick);
+
+		result.captureTime += (captureTime - startTime).AsSeconds<double>();
+		result.encodeTime += (encodeTime - captureTime).AsSeconds<double>();
+		result.decodeTime += (decodeTime - encodeTime).AsSeconds<double>();
+		result.entityCount += snapshot->GetEntityCount();
+		result.packetSize += packet.GetSize();
+		result.snapshotCount++;
+	}
+
+	return result;
+}
+
+int main(int argc, char* argv[])
+{
+	std::size_t entityCount = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10'000;
+
+	auto schema = std::make_shared<Nz::EntitySnapshotSchema>();
+	schema->AddComponent<Transform>()
+		.AddVector3(&Transform::position, -2000.f, 2000.f, 20)
+		.AddQuaternion(&Transform::rotation, 9);
+
+	schema->AddComponent<Health>()
+		.AddInteger(&Health::health, 8)
+		.AddBool(&Health::isAlive);
+
+	std::cout << entityCount << " entities (position 3x20 bits, rotation 29 bits, 1/4 with health 9 bits), " << TickCount << " ticks" << std::endl;
+	std::cout << std::setw(24) << "snapshot" << std::setw(14) << "bits/entity" << std::setw(14) << "KiB/packet" << std::setw(14) << "capture (ms)" << std::setw(14) << "encode (ms)" << std::setw(14) << "decode (ms)" << std::setw(18) << "enc. (Mentity/s)" << std::setw(18) << "dec. (Mentity/s)" << std::endl;
+
+	PrintResult("full", RunBenchmark(schema, entityCount, 0.1f, false));
+
+	for (float movingRatio : { 0.f, 0.1f, 0.5f, 1.f })
+	{
+		std::string name = "delta (" + std::to_string(int(movingRatio * 100.f)) + "% moving)";
+		PrintResult(name.c_str(), RunBenchmark(schema, entityCount, movingRatio, true));
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/TextRenderer/Font.hpp>
+#include <Nazara/TextRenderer/TextRenderer.hpp>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::TextRenderer> textRenderer;
+
+	std::cout << "Initializing..." << std::endl;
+
+	// A CJK font can be passed to benchmark the character sets this is meant for
+	std::shared_ptr<Nz::Font> font;
+	std::u32string characterSet;
+	if (argc > 1)
+	{
+		font = Nz::Font::OpenFromFile(argv[1]);
+		if (!font)
+		{
+			std::cerr << "failed to open " << argv[1] << std::endl;
+			return 1;
+		}
+
+		// CJK Unified Ideographs
+		for (char32_t character = 0x4E00; character < 0x4E00 + 3000; ++character)
+			characterSet += character;
+	}
+	else
+	{
+		font = Nz::Font::GetDefault();
+
+		// Latin, Greek and Cyrillic blocks
+		for (char32_t character = 0x21; character < 0x530; ++character)
+			characterSet += character;
+	}
+
+	std::string utf8CharacterSet = Nz::FromUtf32String(characterSet);
+
+	Nz::TaskScheduler taskScheduler;
+
+	auto Measure = [&](const char* name, unsigned int characterSize, float outlineThickness, Nz::TaskScheduler* scheduler)
+	{
+		std::shared_ptr<Nz::GuillotineImageAtlas> atlas = std::make_shared<Nz::GuillotineImageAtlas>();
+		font->SetAtlas(atlas);
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		font->Precache(characterSize, Nz::TextStyle_Regular, outlineThickness, utf8CharacterSet, scheduler);
+
+		// Include the pixel copy into the atlas
+		for (std::size_t i = 0; i < atlas->GetLayerCount(); ++i)
+			atlas->GetLayer(i);
+
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		std::size_t glyphCount = font->GetCachedGlyphCount();
+		double glyphsPerSecond = double(glyphCount) / (t2 - t1).AsSeconds<double>();
+		std::cout << name << " " << characterSize << "px (outline: " << outlineThickness << "): " << glyphCount << " glyphs in " << (t2 - t1) << " (" << glyphsPerSecond << " glyphs/s, " << atlas->GetLayerCount() << " layer(s))" << std::endl;
+
+		font->SetAtlas(nullptr);
+	};
+
+	std::cout << "Using " << taskScheduler.GetWorkerCount() << " workers" << std::endl;
+
+	for (unsigned int characterSize : { 16, 32, 64 })
+	{
+		for (float outlineThickness : { 0.f, 2.f })
+		{
+			Measure("sequential", characterSize, outlineThickness, nullptr);
+			Measure("parallel", characterSize, outlineThickness, &taskScheduler);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+target("FontPrecacheBenchmark")
+	add_deps("NazaraTextRenderer")
+	add_files("main.cpp")
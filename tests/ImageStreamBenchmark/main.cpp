@@ -0,0 +1,137 @@
+#include <Nazara/Core/BufferedImageStream.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/ImageStream.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#ifdef NAZARA_IMAGESTREAMBENCHMARK_FFMPEG
+#include <Nazara/Core/PluginLoader.hpp>
+#include <Nazara/Core/Plugins/FFmpegPlugin.hpp>
+#endif
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Plays image streams (GIF, or videos when the FFmpeg plugin is available) in real time at 60Hz and reports how long the caller is blocked by decoding
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::Core> core;
+
+#ifdef NAZARA_IMAGESTREAMBENCHMARK_FFMPEG
+	Nz::PluginLoader loader;
+	Nz::Plugin<Nz::FFmpegPlugin> ffmpeg = loader.Load<Nz::FFmpegPlugin>();
+#endif
+
+	if (argc < 2)
+	{
+		std::cout << "Usage: " << argv[0] << " <image stream files...>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	constexpr Nz::Time tickDuration = Nz::Time::TickDuration(60);
+	constexpr Nz::Time maxPlaybackDuration = Nz::Time::Seconds(10);
+
+	struct Stats
+	{
+		Nz::Time maxStall = Nz::Time::Zero();
+		Nz::Time totalStall = Nz::Time::Zero();
+		unsigned int lateTicks = 0; //< ticks blocked for more than a tick
+		unsigned int presentedFrames = 0;
+		unsigned int tickCount = 0;
+	};
+
+	auto Report = [&](const char* name, const Stats& stats)
+	{
+		std::cout << "  " << name << ": " << stats.presentedFrames << " frames presented, max stall " << stats.maxStall << ", average stall " << (stats.totalStall / Nz::Time::Nanoseconds(std::max(stats.tickCount, 1u))) << ", " << stats.lateTicks << " late ticks" << std::endl;
+	};
+
+	auto Play = [&](auto&& fetchFrame, Stats& stats)
+	{
+		Nz::Time startTime = Nz::GetElapsedNanoseconds();
+		for (;;)
+		{
+			Nz::Time tickTime = Nz::GetElapsedNanoseconds();
+			Nz::Time timestamp = tickTime - startTime;
+			if (timestamp >= maxPlaybackDuration)
+				break;
+
+			if (!fetchFrame(timestamp))
+				break;
+
+			Nz::Time stall = Nz::GetElapsedNanoseconds() - tickTime;
+			stats.maxStall = std::max(stats.maxStall, stall);
+			stats.totalStall += stall;
+			stats.tickCount++;
+			if (stall > tickDuration)
+				stats.lateTicks++;
+
+			std::this_thread::sleep_for((tickDuration - std::min(stall, tickDuration)).AsDuration<std::chrono::nanoseconds>());
+		}
+	};
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::cout << argv[i] << std::endl;
+
+		// Synchronous decoding, one frame ahead to know when to present it
+		{
+			std::shared_ptr<Nz::ImageStream> imageStream = Nz::ImageStream::OpenFromFile(argv[i]);
+			if (!imageStream)
+			{
+				std::cout << "  failed to open file" << std::endl;
+				continue;
+			}
+
+			Nz::Vector2ui size = imageStream->GetSize();
+			std::vector<Nz::UInt8> frameData(Nz::PixelFormatInfo::ComputeSize(imageStream->GetPixelFormat(), size.x, size.y, 1));
+
+			Stats stats;
+
+			Nz::Time nextFrameTime;
+			bool hasNextFrame = imageStream->DecodeNextFrame(frameData.data(), &nextFrameTime);
+			Play([&](Nz::Time timestamp)
+			{
+				while (hasNextFrame && nextFrameTime <= timestamp)
+				{
+					stats.presentedFrames++;
+					hasNextFrame = imageStream->DecodeNextFrame(frameData.data(), &nextFrameTime);
+				}
+
+				return hasNextFrame;
+			}, stats);
+
+			Report("synchronous", stats);
+		}
+
+		// Background decoding
+		{
+			std::shared_ptr<Nz::ImageStream> imageStream = Nz::ImageStream::OpenFromFile(argv[i]);
+			Nz::BufferedImageStream bufferedStream(imageStream, 8);
+
+			// Let the decoder fill its buffer, as a player would before starting playback
+			while (bufferedStream.GetReadyFrameCount() < bufferedStream.GetBufferedFrameCount() && !bufferedStream.IsFinished())
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			Stats stats;
+
+			const Nz::BufferedImageStream::Frame* lastFrame = nullptr;
+			Nz::Time lastFrameTime = -Nz::Time::Second();
+			Play([&](Nz::Time timestamp)
+			{
+				const Nz::BufferedImageStream::Frame* frame = bufferedStream.FetchFrame(timestamp);
+				if (frame && (frame != lastFrame || frame->time != lastFrameTime))
+				{
+					stats.presentedFrames++;
+					lastFrame = frame;
+					lastFrameTime = frame->time;
+				}
+
+				return !bufferedStream.IsFinished();
+			}, stats);
+
+			Report("buffered", stats);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
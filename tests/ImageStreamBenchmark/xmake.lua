@@ -0,0 +1,11 @@
+target("ImageStreamBenchmark")
+	add_deps("NazaraCore")
+	if has_config("ffmpeg") then
+		if has_config("embed_plugins", "static") then
+			add_deps("PluginFFmpeg")
+		else
+			add_deps("PluginFFmpeg", { links = {} })
+		end
+		add_defines("NAZARA_IMAGESTREAMBENCHMARK_FFMPEG")
+	end
+	add_files("main.cpp")
@@ -0,0 +1,130 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Components/NodeComponent.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <Nazara/Network/Components/InterestComponent.hpp>
+#include <Nazara/Network/Components/InterestObserverComponent.hpp>
+#include <Nazara/Network/Systems/InterestSystem.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+constexpr float WorldSize = 4000.f;
+constexpr float ObserverRadius = 100.f;
+constexpr std::size_t TickCount = 60;
+
+struct PositionState
+{
+	Nz::Vector3f position;
+};
+
+int main(int argc, char* argv[])
+{
+	std::size_t entityCount = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100'000;
+	std::size_t observerCount = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 5'000;
+	float movingRatio = (argc > 3) ? std::strtof(argv[3], nullptr) : 0.5f;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> positionDis(-WorldSize * 0.5f, WorldSize * 0.5f);
+	std::uniform_real_distribution<float> stepDis(-2.f, 2.f);
+	std::uniform_real_distribution<float> ratioDis(0.f, 1.f);
+
+	entt::registry registry;
+	Nz::InterestSystem interestSystem(registry, ObserverRadius);
+
+	// Entities are spread over a flat world, a few of them having a higher priority (players, bosses, ...)
+	std::vector<entt::entity> entities(entityCount);
+	for (entt::entity& entity : entities)
+	{
+		entity = registry.create();
+		registry.emplace<Nz::NodeComponent>(entity, Nz::Vector3f(positionDis(randomGenerator), 0.f, positionDis(randomGenerator)));
+		registry.emplace<Nz::InterestComponent>(entity, (ratioDis(randomGenerator) < 0.05f) ? 4.f : 1.f);
+		registry.emplace<PositionState>(entity);
+	}
+
+	for (std::size_t i = 0; i < observerCount; ++i)
+	{
+		entt::entity observer = registry.create();
+		registry.emplace<Nz::NodeComponent>(observer, Nz::Vector3f(positionDis(randomGenerator), 0.f, positionDis(randomGenerator)));
+
+		auto& observerComponent = registry.emplace<Nz::InterestObserverComponent>(observer, ObserverRadius);
+		observerComponent.SetMaxUpdatedEntities(64);
+	}
+
+	auto schema = std::make_shared<Nz::EntitySnapshotSchema>();
+	schema->AddComponent<PositionState>()
+		.AddVector3(&PositionState::position, -WorldSize, WorldSize, 20);
+
+	std::cout << entityCount << " entities, " << observerCount << " observers (radius " << ObserverRadius << ", max 64 updates/tick), " << int(movingRatio * 100.f) << "% moving, " << TickCount << " ticks" << std::endl;
+
+	double updateTime = 0.0;
+	double snapshotTime = 0.0;
+	std::size_t relevantCount = 0;
+	std::size_t enteringCount = 0;
+	std::size_t leavingCount = 0;
+	std::size_t updatedCount = 0;
+	std::size_t snapshotEntityCount = 0;
+	std::size_t measuredTicks = 0;
+
+	std::vector<std::shared_ptr<const Nz::EntitySnapshot>> lastSnapshots(observerCount);
+
+	auto observerView = registry.view<Nz::NodeComponent, Nz::InterestObserverComponent>();
+	for (Nz::UInt32 tick = 1; tick <= TickCount; ++tick)
+	{
+		for (auto&& [entity, nodeComponent] : registry.view<Nz::NodeComponent>().each())
+		{
+			if (ratioDis(randomGenerator) < movingRatio)
+				nodeComponent.Move(Nz::Vector3f(stepDis(randomGenerator), 0.f, stepDis(randomGenerator)));
+		}
+
+		for (auto&& [entity, nodeComponent, positionState] : registry.view<Nz::NodeComponent, PositionState>().each())
+			positionState.position = nodeComponent.GetPosition();
+
+		Nz::Time startTime = Nz::GetElapsedNanoseconds();
+		interestSystem.Update(tick);
+		Nz::Time updateEndTime = Nz::GetElapsedNanoseconds();
+
+		// Build the batch of every observer, as it would be given to the snapshot encoder of its peer
+		std::shared_ptr<Nz::EntitySnapshot> worldSnapshot = schema->Capture(registry, tick);
+
+		Nz::Time snapshotStartTime = Nz::GetElapsedNanoseconds();
+		std::size_t observerIndex = 0;
+		for (auto&& [entity, nodeComponent, observerComponent] : observerView.each())
+		{
+			std::shared_ptr<const Nz::EntitySnapshot>& lastSnapshot = lastSnapshots[observerIndex++];
+			std::shared_ptr<Nz::EntitySnapshot> snapshot = interestSystem.BuildSnapshot(observerComponent, *worldSnapshot, lastSnapshot.get());
+
+			// Skip the first tick where every entity enters
+			if (tick > 1)
+			{
+				relevantCount += observerComponent.GetRelevantEntities().size();
+				enteringCount += observerComponent.GetEnteringEntities().size();
+				leavingCount += observerComponent.GetLeavingEntities().size();
+				updatedCount += observerComponent.GetUpdatedEntities().size();
+				snapshotEntityCount += snapshot->GetEntityCount();
+			}
+
+			lastSnapshot = std::move(snapshot);
+		}
+		Nz::Time snapshotEndTime = Nz::GetElapsedNanoseconds();
+
+		if (tick > 1)
+		{
+			updateTime += (updateEndTime - startTime).AsSeconds<double>();
+			snapshotTime += (snapshotEndTime - snapshotStartTime).AsSeconds<double>();
+			measuredTicks++;
+		}
+	}
+
+	double observerTicks = double(measuredTicks * observerCount);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "update:          " << updateTime * 1000.0 / measuredTicks << " ms/tick (" << updateTime * 1'000'000'000.0 / observerTicks << " ns/observer)" << std::endl;
+	std::cout << "build snapshots: " << snapshotTime * 1000.0 / measuredTicks << " ms/tick (" << snapshotTime * 1'000'000'000.0 / observerTicks << " ns/observer)" << std::endl;
+	std::cout << std::setprecision(1);
+	std::cout << "per observer and tick: " << relevantCount / observerTicks << " relevant, " << enteringCount / observerTicks << " entering, " << leavingCount / observerTicks << " leaving, " << updatedCount / observerTicks << " updated, " << snapshotEntityCount / observerTicks << " in snapshot" << std::endl;
+
+	return EXIT_SUCCESS;
+}
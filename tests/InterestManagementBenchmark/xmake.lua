@@ -0,0 +1,4 @@
+target("InterestManagementBenchmark")
+	add_deps("NazaraNetwork")
+	add_packages("entt")
+	add_files("main.cpp")
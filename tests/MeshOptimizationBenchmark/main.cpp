@@ -0,0 +1,80 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/IndexMapper.hpp>
+#include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/VertexMapper.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	Nz::MeshParams params;
+	params.optimizeIndexBuffers = false;
+
+	std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(Nz::Primitive::IcoSphere(1.f, 7), params);
+	Nz::SubMesh& subMesh = *mesh->GetSubMesh(0);
+
+	// Shuffle triangles to simulate a badly ordered mesh
+	std::vector<Nz::UInt32> originalIndices;
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::UInt32 triangleCount = indexMapper.GetIndexCount() / 3;
+
+		std::vector<Nz::UInt32> triangles(triangleCount);
+		for (Nz::UInt32 i = 0; i < triangleCount; ++i)
+			triangles[i] = i;
+
+		std::shuffle(triangles.begin(), triangles.end(), std::minstd_rand(42));
+
+		originalIndices.resize(triangleCount * 3);
+		for (Nz::UInt32 i = 0; i < triangleCount; ++i)
+		{
+			for (Nz::UInt32 j = 0; j < 3; ++j)
+				originalIndices[i * 3 + j] = indexMapper.Get(triangles[i] * 3 + j);
+		}
+	}
+
+	auto ResetIndices = [&]
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		for (std::size_t i = 0; i < originalIndices.size(); ++i)
+			indexMapper.Set(i, originalIndices[i]);
+	};
+
+	auto PrintStats = [&](const char* name)
+	{
+		float acmr, atvr;
+		subMesh.GetIndexBuffer()->ComputeCacheMissCount(&acmr, &atvr);
+		std::cout << name << ": ACMR = " << acmr << ", ATVR = " << atvr << std::endl;
+	};
+
+	std::cout << subMesh.GetTriangleCount() << " triangles, " << subMesh.GetVertexCount() << " vertices" << std::endl;
+
+	ResetIndices();
+	PrintStats("unoptimized");
+
+	auto Measure = [&](const char* name, auto&& func)
+	{
+		ResetIndices();
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		func();
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		double trianglesPerSecond = double(subMesh.GetTriangleCount()) / (t2 - t1).AsSeconds<double>();
+		std::cout << name << ": " << (t2 - t1) << " (" << trianglesPerSecond / 1'000'000.0 << "M triangles/s)" << std::endl;
+		PrintStats(name);
+	};
+
+	Measure("vertex cache", [&] { subMesh.GetIndexBuffer()->Optimize(); });
+	Measure("vertex cache + overdraw", [&] { subMesh.Optimize(false); });
+	Measure("vertex cache + overdraw + vertex fetch", [&] { subMesh.Optimize(true); });
+}
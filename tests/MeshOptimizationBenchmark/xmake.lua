@@ -0,0 +1,3 @@
+target("MeshOptimizationBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,62 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Core/PrimitiveList.hpp>
+#include <Nazara/Core/SubMesh.hpp>
+#include <iostream>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	// Test scene: a few dense primitives
+	Nz::PrimitiveList primitives;
+	primitives.AddIcoSphere(1.f, 7);
+	primitives.AddUVSphere(1.f, 512, 256, Nz::Vector3f(3.f, 0.f, 0.f));
+	primitives.AddPlane(Nz::Vector2f(10.f, 10.f), Nz::Vector2ui(256, 256), Nz::Vector3f(0.f, -2.f, 0.f));
+	primitives.AddBox(Nz::Vector3f(1.f), Nz::Vector3ui(128), Nz::Vector3f(-3.f, 0.f, 0.f));
+
+	Nz::MeshParams params;
+	params.optimizeIndexBuffers = false;
+
+	std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(primitives, params);
+
+	std::cout << mesh->GetSubMeshCount() << " submeshes, " << mesh->GetTriangleCount() << " triangles" << std::endl;
+
+	params.lodCount = 4;
+	params.lodReductionRatio = 0.5f;
+	params.lodMaxError = 0.05f;
+
+	Nz::Time t1 = Nz::GetElapsedNanoseconds();
+	mesh->GenerateLods(params);
+	Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+	double trianglesPerSecond = double(mesh->GetTriangleCount()) * params.lodCount / (t2 - t1).AsSeconds<double>();
+	std::cout << "LOD generation: " << (t2 - t1) << " (" << trianglesPerSecond / 1'000'000.0 << "M input triangles/s)" << std::endl;
+
+	for (std::size_t lodLevel = 0; lodLevel < params.lodCount; ++lodLevel)
+	{
+		Nz::UInt64 triangleCount = 0;
+		float maxError = 0.f;
+		for (std::size_t i = 0; i < mesh->GetSubMeshCount(); ++i)
+		{
+			const Nz::SubMesh& subMesh = *mesh->GetSubMesh(i);
+			if (subMesh.GetLodCount() == 0)
+			{
+				triangleCount += subMesh.GetTriangleCount();
+				continue;
+			}
+
+			const Nz::SubMesh::Lod& lod = subMesh.GetLod(std::min(lodLevel, subMesh.GetLodCount() - 1));
+			triangleCount += lod.indexBuffer->GetIndexCount() / 3;
+			maxError = std::max(maxError, lod.error);
+		}
+
+		std::cout << "LOD #" << (lodLevel + 1) << ": " << triangleCount << " triangles (" << 100.0 * double(triangleCount) / mesh->GetTriangleCount() << "%), max error " << maxError << std::endl;
+	}
+}
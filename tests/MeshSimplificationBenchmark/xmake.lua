@@ -0,0 +1,3 @@
+target("MeshSimplificationBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
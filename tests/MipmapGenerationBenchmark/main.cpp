@@ -0,0 +1,71 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <iostream>
+#include <random>
+#include <string>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	constexpr unsigned int imageSize = 2048;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+	Nz::TaskScheduler taskScheduler;
+
+	auto Measure = [&](const std::string& name, Nz::ImageType type, Nz::PixelFormat format, unsigned int size, const Nz::ImageMipmapParams& params, Nz::TaskScheduler* scheduler)
+	{
+		Nz::Image image(type, format, size, size);
+
+		Nz::UInt8* pixels = image.GetPixels();
+		for (std::size_t i = 0; i < image.GetMemoryUsage(0); ++i)
+			pixels[i] = Nz::UInt8(byteDis(randEngine));
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		image.GenerateMipmaps(params, scheduler);
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		double texelCount = double(image.GetMemoryUsage(0)) / Nz::PixelFormatInfo::GetBytesPerPixel(format);
+		double texelsPerSecond = texelCount / (t2 - t1).AsSeconds<double>();
+		std::cout << name << ": " << (t2 - t1) << " (" << texelsPerSecond / 1'000'000.0 << "M base texels/s)" << std::endl;
+	};
+
+	for (Nz::MipmapFilter filter : { Nz::MipmapFilter::Box, Nz::MipmapFilter::Kaiser, Nz::MipmapFilter::Lanczos })
+	{
+		std::string filterName;
+		switch (filter)
+		{
+			case Nz::MipmapFilter::Box:     filterName = "box"; break;
+			case Nz::MipmapFilter::Kaiser:  filterName = "kaiser"; break;
+			case Nz::MipmapFilter::Lanczos: filterName = "lanczos"; break;
+		}
+
+		Nz::ImageMipmapParams params;
+		params.filter = filter;
+
+		for (Nz::PixelFormat format : { Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA16F })
+		{
+			std::string name = filterName + " " + std::string(Nz::PixelFormatInfo::GetName(format)) + " " + std::to_string(imageSize) + "x" + std::to_string(imageSize);
+
+			Measure(name, Nz::ImageType::E2D, format, imageSize, params, nullptr);
+			Measure(name + " (parallel)", Nz::ImageType::E2D, format, imageSize, params, &taskScheduler);
+		}
+
+		Measure(filterName + " RGBA8_SRGB cubemap 512x512", Nz::ImageType::Cubemap, Nz::PixelFormat::RGBA8_SRGB, 512, params, nullptr);
+		Measure(filterName + " RGBA8_SRGB cubemap 512x512 (parallel)", Nz::ImageType::Cubemap, Nz::PixelFormat::RGBA8_SRGB, 512, params, &taskScheduler);
+	}
+
+	Nz::ImageMipmapParams coverageParams;
+	coverageParams.alphaCoverageReference = 0.5f;
+
+	Measure("box RGBA8 with alpha coverage", Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, imageSize, coverageParams, &taskScheduler);
+
+	return 0;
+}
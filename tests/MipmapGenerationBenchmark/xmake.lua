@@ -0,0 +1,3 @@
+target("MipmapGenerationBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,78 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Formats/OBJParser.hpp>
+#include <iostream>
+#include <random>
+#include <string>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	constexpr unsigned int gridSize = 1024; // Will produce gridSize² vertices and 2 * (gridSize - 1)² triangles
+
+	std::cout << "Generating OBJ file..." << std::endl;
+
+	std::minstd_rand randEngine(std::random_device{}());
+	std::uniform_real_distribution<float> heightDis(-10.f, 10.f);
+
+	std::string content;
+	content.reserve(gridSize * gridSize * 128);
+	content += "o Terrain\n";
+	for (unsigned int y = 0; y < gridSize; ++y)
+	{
+		for (unsigned int x = 0; x < gridSize; ++x)
+		{
+			content += "v " + std::to_string(x * 0.5f) + ' ' + std::to_string(heightDis(randEngine)) + ' ' + std::to_string(y * 0.5f) + '\n';
+			content += "vt " + std::to_string(float(x) / gridSize) + ' ' + std::to_string(float(y) / gridSize) + '\n';
+			content += "vn 0.0 1.0 0.0\n";
+		}
+	}
+
+	for (unsigned int y = 0; y < gridSize - 1; ++y)
+	{
+		for (unsigned int x = 0; x < gridSize - 1; ++x)
+		{
+			unsigned int i0 = y * gridSize + x + 1;
+			unsigned int i1 = i0 + 1;
+			unsigned int i2 = i0 + gridSize;
+			unsigned int i3 = i2 + 1;
+
+			auto Vertex = [](unsigned int index)
+			{
+				std::string str = std::to_string(index);
+				return str + '/' + str + '/' + str;
+			};
+
+			content += "f " + Vertex(i0) + ' ' + Vertex(i2) + ' ' + Vertex(i1) + '\n';
+			content += "f " + Vertex(i1) + ' ' + Vertex(i2) + ' ' + Vertex(i3) + '\n';
+		}
+	}
+
+	double sizeInMiB = content.size() / (1024.0 * 1024.0);
+	std::cout << "File size: " << sizeInMiB << "MiB" << std::endl;
+
+	auto Measure = [&](Nz::TaskScheduler* taskScheduler)
+	{
+		Nz::OBJParser parser;
+		Nz::MemoryView stream(content.data(), content.size());
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		if (!parser.Parse(stream, 100, taskScheduler))
+			std::cerr << "failed to parse OBJ file" << std::endl;
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		Nz::Time parseTime = t2 - t1;
+		std::cout << "parse time: " << parseTime << " (" << sizeInMiB / parseTime.AsSeconds<double>() << "MiB/s)" << std::endl;
+	};
+
+	std::cout << "Measuring mono-threaded..." << std::endl;
+	Measure(nullptr);
+
+	Nz::TaskScheduler taskScheduler;
+
+	std::cout << "Measuring task-scheduler (" << taskScheduler.GetWorkerCount() << " workers)..." << std::endl;
+	Measure(&taskScheduler);
+}
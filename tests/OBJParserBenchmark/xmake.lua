@@ -0,0 +1,3 @@
+target("OBJParserBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
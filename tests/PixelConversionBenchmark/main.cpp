@@ -0,0 +1,81 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	constexpr unsigned int imageSize = 1024;
+	constexpr std::size_t pixelCount = imageSize * imageSize;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+	// Largest uncompressed color format is RGBA32F (16 bytes per pixel)
+	std::vector<Nz::UInt8> source(pixelCount * 16);
+	for (Nz::UInt8& value : source)
+		value = Nz::UInt8(byteDis(randEngine));
+
+	std::vector<Nz::UInt8> destination(pixelCount * 16);
+
+	auto Measure = [&](std::string_view name, auto&& func)
+	{
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		func();
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		double pixelsPerSecond = double(pixelCount) / (t2 - t1).AsSeconds<double>();
+		std::cout << name << ": " << (t2 - t1) << " (" << pixelsPerSecond / 1'000'000.0 << "MPix/s)" << std::endl;
+	};
+
+	auto IsColorFormat = [](Nz::PixelFormat format)
+	{
+		return Nz::PixelFormatInfo::GetContent(format) == Nz::PixelFormatContent::ColorRGBA && !Nz::PixelFormatInfo::IsCompressed(format);
+	};
+
+	for (std::size_t i = 0; i < Nz::PixelFormatCount; ++i)
+	{
+		Nz::PixelFormat srcFormat = static_cast<Nz::PixelFormat>(i);
+		if (!IsColorFormat(srcFormat))
+			continue;
+
+		const Nz::UInt8* start = source.data();
+		const Nz::UInt8* end = start + pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(srcFormat);
+
+		for (std::size_t j = 0; j < Nz::PixelFormatCount; ++j)
+		{
+			Nz::PixelFormat dstFormat = static_cast<Nz::PixelFormat>(j);
+			if (srcFormat == dstFormat || !IsColorFormat(dstFormat))
+				continue;
+
+			std::string name = std::string(Nz::PixelFormatInfo::GetName(srcFormat)) + " => " + std::string(Nz::PixelFormatInfo::GetName(dstFormat));
+			Measure(name, [&] { Nz::PixelFormatInfo::Convert(srcFormat, dstFormat, start, end, destination.data()); });
+		}
+	}
+
+	Nz::TaskScheduler taskScheduler;
+
+	for (Nz::PixelFormat dstFormat : { Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA16F, Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RG16 })
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, imageSize, imageSize);
+		std::memcpy(image.GetPixels(), source.data(), pixelCount * 4);
+
+		Nz::Image parallelImage(image);
+
+		std::string name = "Image::Convert RGBA8 => " + std::string(Nz::PixelFormatInfo::GetName(dstFormat));
+		Measure(name, [&] { image.Convert(dstFormat); });
+		Measure(name + " (parallel)", [&] { parallelImage.Convert(dstFormat, &taskScheduler); });
+	}
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+target("PixelConversionBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,88 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Joint.hpp>
+#include <Nazara/Core/Skeleton.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Angle.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	constexpr std::size_t jointCount = 64;
+	constexpr std::size_t vertexCount = 1'000'000;
+	constexpr std::size_t iterationCount = 20;
+
+	std::minstd_rand randEngine(std::random_device{}());
+	std::uniform_real_distribution<float> posDis(-5.f, 5.f);
+	std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+	std::uniform_int_distribution<Nz::Int32> jointDis(0, jointCount - 1);
+	std::uniform_real_distribution<float> weightDis(0.f, 1.f);
+
+	std::cout << "Initializing..." << std::endl;
+
+	Nz::Skeleton skeleton;
+	skeleton.Create(jointCount);
+	for (std::size_t i = 0; i < jointCount; ++i)
+	{
+		Nz::Joint* joint = skeleton.GetJoint(i);
+		joint->SetPosition(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine)));
+		joint->SetRotation(Nz::EulerAnglesf(Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine))));
+	}
+
+	std::vector<Nz::Vector3f> positions(vertexCount);
+	std::vector<Nz::Vector3f> normals(vertexCount);
+	std::vector<Nz::Vector3f> tangents(vertexCount);
+	std::vector<Nz::Vector4i32> jointIndices(vertexCount);
+	std::vector<Nz::Vector4f> jointWeights(vertexCount);
+	for (std::size_t i = 0; i < vertexCount; ++i)
+	{
+		positions[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine));
+		normals[i] = Nz::Vector3f::Up();
+		tangents[i] = Nz::Vector3f::Right();
+		jointIndices[i] = Nz::Vector4i32(jointDis(randEngine), jointDis(randEngine), jointDis(randEngine), jointDis(randEngine));
+
+		Nz::Vector4f weights(weightDis(randEngine), weightDis(randEngine), weightDis(randEngine), weightDis(randEngine));
+		jointWeights[i] = weights / (weights.x + weights.y + weights.z + weights.w);
+	}
+
+	std::vector<Nz::Vector3f> outputPositions(vertexCount);
+	std::vector<Nz::Vector3f> outputNormals(vertexCount);
+	std::vector<Nz::Vector3f> outputTangents(vertexCount);
+
+	Nz::SkinningData skinningData;
+	skinningData.joints = skeleton.GetJoints();
+	skinningData.jointCount = jointCount;
+	skinningData.inputPositions = positions.data();
+	skinningData.inputNormals = normals.data();
+	skinningData.inputTangents = tangents.data();
+	skinningData.inputJointIndices = jointIndices.data();
+	skinningData.inputJointWeights = jointWeights.data();
+	skinningData.outputPositions = outputPositions.data();
+	skinningData.outputNormals = outputNormals.data();
+	skinningData.outputTangents = outputTangents.data();
+
+	Nz::TaskScheduler taskScheduler;
+
+	auto Measure = [&](const char* name, auto&& func)
+	{
+		func(); // warm-up
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < iterationCount; ++i)
+			func();
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		double verticesPerSecond = double(vertexCount * iterationCount) / (t2 - t1).AsSeconds<double>();
+		std::cout << name << ": " << Nz::Time::Nanoseconds((t2 - t1).AsNanoseconds() / iterationCount) << " per iteration (" << verticesPerSecond / 1'000'000.0 << "M vertices/s)" << std::endl;
+	};
+
+	Measure("linear blend (mono-threaded)", [&] { Nz::SkinLinearBlend(skinningData, 0, vertexCount); });
+	Measure("linear blend (task-scheduler)", [&] { Nz::SkinLinearBlend(skinningData, 0, vertexCount, &taskScheduler); });
+	Measure("dual quaternion (mono-threaded)", [&] { Nz::SkinDualQuaternionBlend(skinningData, 0, vertexCount); });
+	Measure("dual quaternion (task-scheduler)", [&] { Nz::SkinDualQuaternionBlend(skinningData, 0, vertexCount, &taskScheduler); });
+}
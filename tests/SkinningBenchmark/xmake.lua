@@ -0,0 +1,3 @@
+target("SkinningBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
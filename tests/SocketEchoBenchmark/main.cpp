@@ -0,0 +1,181 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+constexpr std::size_t MessageSize = 64;
+
+struct Connection
+{
+	Nz::TcpClient socket;
+	Nz::UInt32 sendBuffer;
+};
+
+// Keeps one message in flight per connection and counts echoed messages
+void RunClients(Nz::UInt16 port, std::size_t connectionCount, const std::atomic_bool& running)
+{
+	std::vector<std::unique_ptr<Nz::TcpClient>> clients;
+	std::vector<std::size_t> receivedBytes(connectionCount, 0);
+
+	Nz::SocketPoller poller;
+	for (std::size_t i = 0; i < connectionCount; ++i)
+	{
+		auto& client = clients.emplace_back(std::make_unique<Nz::TcpClient>());
+		client->Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port));
+		client->WaitForConnected();
+		client->EnableLowDelay(true);
+
+		poller.RegisterSocket(*client, Nz::SocketPollEvent::Read, reinterpret_cast<void*>(i));
+	}
+
+	std::array<Nz::UInt8, MessageSize> message = {};
+	for (auto& client : clients)
+		client->Send(message.data(), message.size(), nullptr);
+
+	std::array<Nz::UInt8, MessageSize> buffer;
+	while (running)
+	{
+		poller.Wait(10);
+		for (const auto& readyEvent : poller.GetReadyEvents())
+		{
+			std::size_t clientIndex = reinterpret_cast<std::size_t>(readyEvent.userdata);
+
+			std::size_t received;
+			if (!clients[clientIndex]->Receive(buffer.data(), MessageSize - receivedBytes[clientIndex], &received))
+				continue;
+
+			receivedBytes[clientIndex] += received;
+			if (receivedBytes[clientIndex] == MessageSize)
+			{
+				receivedBytes[clientIndex] = 0;
+				clients[clientIndex]->Send(message.data(), message.size(), nullptr);
+			}
+		}
+	}
+}
+
+template<typename F>
+void RunBenchmark(const char* name, std::size_t connectionCount, Nz::Time duration, F&& echoLoop)
+{
+	Nz::TcpServer server;
+	server.Listen(Nz::NetProtocol::IPv4, 0, static_cast<unsigned int>(connectionCount));
+
+	std::atomic_bool running = true;
+	std::thread clientThread(RunClients, server.GetBoundPort(), connectionCount, std::cref(running));
+
+	std::vector<std::unique_ptr<Connection>> connections;
+	for (std::size_t i = 0; i < connectionCount; ++i)
+	{
+		auto& connection = connections.emplace_back(std::make_unique<Connection>());
+		while (!server.AcceptClient(&connection->socket));
+
+		connection->socket.EnableLowDelay(true);
+	}
+
+	std::size_t echoCount = echoLoop(connections, duration);
+
+	running = false;
+	clientThread.join();
+
+	std::cout << name << ": " << echoCount * 1'000'000 / duration.AsMicroseconds() << " echoes/s" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::Network> network;
+
+	std::size_t connectionCount = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 256;
+	Nz::Time duration = Nz::Time::Seconds(3);
+
+	std::cout << "Echo server with " << connectionCount << " connections, " << MessageSize << " bytes messages" << std::endl;
+
+	// Readiness-then-syscall: one Wait plus one receive and one send syscall per message
+	RunBenchmark("SocketPoller", connectionCount, duration, [](std::vector<std::unique_ptr<Connection>>& connections, Nz::Time duration)
+	{
+		Nz::SocketPoller poller;
+		for (auto& connection : connections)
+			poller.RegisterSocket(connection->socket, Nz::SocketPollEvent::Read, connection.get());
+
+		std::array<Nz::UInt8, MessageSize> buffer;
+		std::size_t echoCount = 0;
+
+		Nz::Time endTime = Nz::GetElapsedNanoseconds() + duration;
+		while (Nz::GetElapsedNanoseconds() < endTime)
+		{
+			poller.Wait(10);
+			for (const auto& readyEvent : poller.GetReadyEvents())
+			{
+				Connection& connection = *static_cast<Connection*>(readyEvent.userdata);
+
+				std::size_t received;
+				if (!connection.socket.Receive(buffer.data(), buffer.size(), &received) || received == 0)
+					continue;
+
+				connection.socket.Send(buffer.data(), received, nullptr);
+				echoCount++;
+			}
+		}
+
+		return echoCount;
+	});
+
+	// Completion-based: operations are submitted and reaped by Wait
+	auto CompletionEchoLoop = [](Nz::SocketCompletionBackend backend)
+	{
+		return [=](std::vector<std::unique_ptr<Connection>>& connections, Nz::Time duration)
+		{
+			Nz::SocketCompletionQueue::Config config;
+			config.backend = backend;
+			config.bufferCount = connections.size() * 2;
+			config.bufferSize = MessageSize;
+			config.queueDepth = static_cast<Nz::UInt32>(connections.size());
+
+			Nz::SocketCompletionQueue queue(config);
+			for (auto& connection : connections)
+				queue.ReceivePooled(connection->socket, connection.get());
+
+			std::size_t echoCount = 0;
+
+			Nz::Time endTime = Nz::GetElapsedNanoseconds() + duration;
+			while (Nz::GetElapsedNanoseconds() < endTime)
+			{
+				queue.Wait(10);
+				for (const auto& completion : queue.GetCompletions())
+				{
+					Connection& connection = *static_cast<Connection*>(completion.userdata);
+					if (completion.error != Nz::SocketError::NoError)
+						continue;
+
+					if (completion.operation == Nz::SocketOperation::Receive)
+					{
+						// Echo the received buffer back and only release it once sent
+						connection.sendBuffer = completion.bufferIndex;
+						queue.Send(connection.socket, queue.GetBuffer(completion.bufferIndex).data(), completion.transferredBytes, &connection);
+					}
+					else
+					{
+						queue.ReleaseBuffer(connection.sendBuffer);
+						queue.ReceivePooled(connection.socket, &connection);
+						echoCount++;
+					}
+				}
+			}
+
+			return echoCount;
+		};
+	};
+
+	RunBenchmark("SocketCompletionQueue (io_uring)", connectionCount, duration, CompletionEchoLoop(Nz::SocketCompletionBackend::IoUring));
+	RunBenchmark("SocketCompletionQueue (poller)", connectionCount, duration, CompletionEchoLoop(Nz::SocketCompletionBackend::Poller));
+
+	return EXIT_SUCCESS;
+}
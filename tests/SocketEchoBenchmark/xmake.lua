@@ -0,0 +1,3 @@
+target("SocketEchoBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,121 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::Network> network;
+
+	// Many mostly idle sockets (as a game server with a lot of connected clients) and a few active ones
+	// Note: the open file limit (ulimit -n) may have to be raised to open that many sockets
+	std::size_t socketCount = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10'000;
+	std::size_t activeSocketCount = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 100;
+	constexpr std::size_t iterationCount = 1000;
+
+	std::cout << "Opening " << socketCount << " sockets..." << std::endl;
+
+	std::vector<std::unique_ptr<Nz::UdpSocket>> sockets;
+	sockets.reserve(socketCount);
+	for (std::size_t i = 0; i < socketCount; ++i)
+	{
+		auto& socket = sockets.emplace_back(std::make_unique<Nz::UdpSocket>(Nz::NetProtocol::IPv4));
+		if (socket->Bind(0) != Nz::SocketState::Bound)
+		{
+			std::cerr << "failed to bind socket #" << i << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	activeSocketCount = std::min(activeSocketCount, socketCount);
+
+	Nz::UdpSocket sender(Nz::NetProtocol::IPv4);
+	std::array<Nz::UInt8, 64> buffer = {};
+
+	auto SendToActiveSockets = [&]
+	{
+		// Spread active sockets over the whole registration range
+		std::size_t step = socketCount / activeSocketCount;
+		for (std::size_t i = 0; i < activeSocketCount; ++i)
+		{
+			Nz::IpAddress address(Nz::IpAddress::LoopbackIpV4.ToIPv4(), sockets[i * step]->GetBoundPort());
+			sender.Send(address, buffer.data(), buffer.size(), nullptr);
+		}
+	};
+
+	auto Measure = [&](const char* name, auto&& waitAndProcess)
+	{
+		Nz::Time duration = Nz::Time::Zero();
+		std::size_t processedCount = 0;
+		for (std::size_t i = 0; i < iterationCount; ++i)
+		{
+			SendToActiveSockets();
+
+			Nz::Time start = Nz::GetElapsedNanoseconds();
+			processedCount += waitAndProcess();
+			duration += Nz::GetElapsedNanoseconds() - start;
+		}
+
+		std::cout << name << ": " << Nz::Time::Nanoseconds(duration.AsNanoseconds() / iterationCount) << " per wait (" << processedCount / iterationCount << " packets per wait)" << std::endl;
+	};
+
+	auto ReceiveFrom = [&](Nz::UdpSocket& socket)
+	{
+		std::size_t received;
+		Nz::IpAddress from;
+		socket.Receive(buffer.data(), buffer.size(), &from, &received);
+	};
+
+	{
+		Nz::SocketPoller poller;
+		for (auto& socket : sockets)
+			poller.RegisterSocket(*socket, Nz::SocketPollEvent::Read);
+
+		Measure("Wait + IsReadyToRead on every socket", [&]
+		{
+			std::size_t processedCount = 0;
+			if (poller.Wait(100))
+			{
+				for (auto& socket : sockets)
+				{
+					if (!poller.IsReadyToRead(*socket))
+						continue;
+
+					ReceiveFrom(*socket);
+					processedCount++;
+				}
+			}
+
+			return processedCount;
+		});
+	}
+
+	{
+		Nz::SocketPoller poller;
+		for (auto& socket : sockets)
+			poller.RegisterSocket(*socket, Nz::SocketPollEvent::Read, socket.get());
+
+		Measure("Wait + GetReadyEvents", [&]
+		{
+			std::size_t processedCount = 0;
+			if (poller.Wait(100))
+			{
+				for (const Nz::SocketPoller::ReadyEvent& readyEvent : poller.GetReadyEvents())
+				{
+					ReceiveFrom(*static_cast<Nz::UdpSocket*>(readyEvent.userdata));
+					processedCount++;
+				}
+			}
+
+			return processedCount;
+		});
+	}
+
+	return EXIT_SUCCESS;
+}
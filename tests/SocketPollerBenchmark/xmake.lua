@@ -0,0 +1,3 @@
+target("SocketPollerBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,142 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Connection
+{
+	Nz::TcpClient client;
+	Nz::TcpClient serverToClient;
+};
+
+bool Connect(Nz::TcpServer& server, Connection& connection, std::size_t maxMessageSize)
+{
+	connection.client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort()));
+	if (connection.client.WaitForConnected() != Nz::SocketState::Connected)
+		return false;
+
+	if (!server.AcceptClient(&connection.serverToClient))
+		return false;
+
+	Nz::TcpClient::FramingConfig config;
+	config.lengthPrefix = Nz::MessageLengthPrefix::VarInt;
+	config.maxMessageSize = maxMessageSize;
+
+	for (Nz::TcpClient* socket : { &connection.client, &connection.serverToClient })
+	{
+		socket->EnableLowDelay(true);
+		socket->EnableFraming(config);
+	}
+
+	return true;
+}
+
+// Streams messages from one end and measures how fast the other end receives them
+double MeasureThroughput(Connection& connection, std::size_t messageSize, std::size_t messageCount)
+{
+	std::vector<Nz::UInt8> message(messageSize, 0xAB);
+
+	Nz::Time startTime = Nz::GetElapsedNanoseconds();
+
+	std::thread sender([&]
+	{
+		for (std::size_t i = 0; i < messageCount; ++i)
+			connection.client.QueueMessage(message.data(), message.size());
+
+		connection.client.FlushMessages();
+	});
+
+	std::size_t receivedBytes = 0;
+	for (std::size_t i = 0; i < messageCount; ++i)
+	{
+		std::span<const Nz::UInt8> receivedMessage;
+		if (!connection.serverToClient.ReceiveMessage(&receivedMessage))
+			break;
+
+		receivedBytes += receivedMessage.size();
+	}
+
+	Nz::Time elapsedTime = Nz::GetElapsedNanoseconds() - startTime;
+	sender.join();
+
+	return receivedBytes / elapsedTime.AsSeconds<double>() / (1024.0 * 1024.0);
+}
+
+// Bounces a single message between both ends and measures the average round trip time
+double MeasureLatency(Connection& connection, std::size_t messageSize, std::size_t roundTripCount)
+{
+	std::vector<Nz::UInt8> message(messageSize, 0xCD);
+
+	std::thread echo([&]
+	{
+		for (std::size_t i = 0; i < roundTripCount; ++i)
+		{
+			std::span<const Nz::UInt8> receivedMessage;
+			if (!connection.serverToClient.ReceiveMessage(&receivedMessage))
+				break;
+
+			connection.serverToClient.QueueMessage(receivedMessage.data(), receivedMessage.size());
+			connection.serverToClient.FlushMessages();
+		}
+	});
+
+	Nz::Time startTime = Nz::GetElapsedNanoseconds();
+
+	for (std::size_t i = 0; i < roundTripCount; ++i)
+	{
+		connection.client.QueueMessage(message.data(), message.size());
+		connection.client.FlushMessages();
+
+		std::span<const Nz::UInt8> receivedMessage;
+		if (!connection.client.ReceiveMessage(&receivedMessage))
+			break;
+	}
+
+	Nz::Time elapsedTime = Nz::GetElapsedNanoseconds() - startTime;
+	echo.join();
+
+	return elapsedTime.AsSeconds<double>() * 1'000'000.0 / roundTripCount;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Network> network;
+
+	constexpr std::size_t MaxMessageSize = 64 * 1024;
+	constexpr std::size_t RoundTripCount = 2'000;
+	constexpr std::size_t StreamedBytes = 256 * 1024 * 1024;
+
+	Nz::TcpServer server;
+	if (server.Listen(Nz::NetProtocol::IPv4, 0) != Nz::SocketState::Bound)
+	{
+		std::cerr << "failed to listen on loopback" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << std::setw(10) << "size" << std::setw(18) << "throughput (MiB/s)" << std::setw(20) << "messages/s" << std::setw(18) << "round trip (us)" << std::endl;
+
+	for (std::size_t messageSize = 16; messageSize <= MaxMessageSize; messageSize *= 4)
+	{
+		Connection connection;
+		if (!Connect(server, connection, MaxMessageSize))
+		{
+			std::cerr << "failed to connect on loopback" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		std::size_t messageCount = std::max<std::size_t>(StreamedBytes / messageSize / 16, 10'000);
+
+		double throughput = MeasureThroughput(connection, messageSize, messageCount);
+		double latency = MeasureLatency(connection, messageSize, RoundTripCount);
+
+		std::cout << std::setw(10) << messageSize << std::setw(18) << std::fixed << std::setprecision(1) << throughput << std::setw(20) << static_cast<std::size_t>(throughput * 1024.0 * 1024.0 / messageSize) << std::setw(18) << latency << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
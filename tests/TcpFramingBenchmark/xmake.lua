@@ -0,0 +1,3 @@
+target("TcpFramingBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
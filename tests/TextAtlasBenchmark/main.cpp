@@ -0,0 +1,61 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <Nazara/TextRenderer/Font.hpp>
+#include <Nazara/TextRenderer/SimpleTextDrawer.hpp>
+#include <Nazara/TextRenderer/TextRenderer.hpp>
+#include <array>
+#include <iostream>
+#include <string>
+
+int main()
+{
+	Nz::Modules<Nz::TextRenderer> textRenderer;
+
+	std::cout << "Initializing..." << std::endl;
+
+	std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+
+	// Typical UI: labels, titles and tooltips at many sizes, some of them outlined
+	constexpr std::array<unsigned int, 10> characterSizes = { 10, 12, 14, 16, 18, 20, 24, 32, 48, 72 };
+	constexpr std::array<float, 2> outlineThicknesses = { 0.f, 2.f };
+
+	std::string text = "The quick brown fox jumps over the lazy dog 0123456789 THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG !?.,;:()[]";
+
+	auto Measure = [&](Nz::FontGlyphMode glyphMode, const char* name)
+	{
+		std::shared_ptr<Nz::GuillotineImageAtlas> atlas = std::make_shared<Nz::GuillotineImageAtlas>();
+		font->SetAtlas(atlas);
+		font->SetGlyphMode(glyphMode);
+
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		std::size_t drawnGlyphCount = 0;
+		for (unsigned int characterSize : characterSizes)
+		{
+			for (float outlineThickness : outlineThicknesses)
+			{
+				Nz::SimpleTextDrawer drawer = Nz::SimpleTextDrawer::Draw(font, text, characterSize, Nz::TextStyle_Regular, Nz::Color::White(), outlineThickness, Nz::Color::Black());
+				drawnGlyphCount += drawer.GetGlyphCount();
+			}
+		}
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		std::size_t atlasMemory = 0;
+		for (std::size_t i = 0; i < atlas->GetLayerCount(); ++i)
+		{
+			Nz::Vector3ui layerSize = atlas->GetLayer(i)->GetSize();
+			atlasMemory += layerSize.x * layerSize.y; //< A8
+		}
+
+		std::cout << name << ": " << font->GetCachedGlyphCount() << " cached glyphs for " << drawnGlyphCount << " drawn glyphs, ";
+		std::cout << atlas->GetLayerCount() << " atlas layer(s) using " << atlasMemory / 1024 << "KiB, generated in " << (t2 - t1) << std::endl;
+
+		font->SetAtlas(nullptr);
+	};
+
+	Measure(Nz::FontGlyphMode::Bitmap, "bitmap");
+	Measure(Nz::FontGlyphMode::DistanceField, "distance field");
+
+	font->SetGlyphMode(Nz::FontGlyphMode::Bitmap);
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+target("TextAtlasBenchmark")
+	add_deps("NazaraTextRenderer")
+	add_files("main.cpp")
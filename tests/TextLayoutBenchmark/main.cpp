@@ -0,0 +1,78 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <Nazara/TextRenderer/Font.hpp>
+#include <Nazara/TextRenderer/SimpleTextDrawer.hpp>
+#include <Nazara/TextRenderer/TextRenderer.hpp>
+#include <iostream>
+#include <string>
+
+int main()
+{
+	Nz::Modules<Nz::TextRenderer> textRenderer;
+
+	std::cout << "Initializing..." << std::endl;
+
+	std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+	font->SetAtlas(std::make_shared<Nz::GuillotineImageAtlas>());
+
+	// A log-like text area holding 100k lines
+	constexpr std::size_t lineCount = 100'000;
+	constexpr std::size_t editCount = 100;
+
+	std::string line = "[12:34:56] Player joined the game, the quick brown fox jumps over the lazy dog\n";
+
+	std::string text;
+	text.reserve(line.size() * (lineCount + editCount));
+	for (std::size_t i = 0; i < lineCount; ++i)
+		text += line;
+
+	Nz::SimpleTextDrawer drawer;
+	drawer.SetMaxLineWidth(800.f);
+	drawer.SetText(text);
+
+	Nz::Time t1 = Nz::GetElapsedNanoseconds();
+	std::size_t glyphCount = drawer.GetGlyphCount();
+	Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+	std::cout << "full layout: " << glyphCount << " glyphs, " << drawer.GetLineCount() << " lines in " << (t2 - t1) << std::endl;
+
+	// Text areas keep their own copy of the text and set it back on every change
+	auto Measure = [&](const char* name, auto&& func)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < editCount; ++i)
+		{
+			func();
+			glyphCount = drawer.GetGlyphCount(); //< triggers layout
+		}
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		std::cout << name << ": " << Nz::Time::Nanoseconds((end - start).AsNanoseconds() / editCount) << " per edit (" << glyphCount << " glyphs)" << std::endl;
+	};
+
+	Measure("append line (AppendText)", [&]
+	{
+		text += line;
+		drawer.AppendText(line);
+	});
+
+	Measure("append line (SetText)", [&]
+	{
+		text += line;
+		drawer.SetText(text);
+	});
+
+	Measure("type in last line (SetText)", [&]
+	{
+		text.insert(text.size() - line.size() / 2, "a");
+		drawer.SetText(text);
+	});
+
+	Measure("type in first line (SetText)", [&]
+	{
+		text.insert(line.size() / 2, "a");
+		drawer.SetText(text);
+	});
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+target("TextLayoutBenchmark")
+	add_deps("NazaraTextRenderer")
+	add_files("main.cpp")
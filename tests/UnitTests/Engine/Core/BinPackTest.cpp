@@ -0,0 +1,215 @@
+#include <Nazara/Core/GuillotineBinPack.hpp>
+#include <Nazara/Core/MaxRectsBinPack.hpp>
+#include <Nazara/Core/SkylineBinPack.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	void CheckRectangles(const std::vector<Nz::Rectui>& rects, const Nz::Vector2ui& size)
+	{
+		for (std::size_t i = 0; i < rects.size(); ++i)
+		{
+			CHECK(rects[i].x + rects[i].width <= size.x);
+			CHECK(rects[i].y + rects[i].height <= size.y);
+
+			for (std::size_t j = i + 1; j < rects.size(); ++j)
+			{
+				// Rectangles sharing an edge are reported as intersecting with an empty intersection
+				Nz::Rectui intersection;
+				if (rects[i].Intersect(rects[j], &intersection) && intersection.width > 0 && intersection.height > 0)
+					FAIL("rectangles #" << i << " and #" << j << " overlap");
+			}
+		}
+	}
+
+	float ComputeOccupancy(const std::vector<Nz::Rectui>& rects, const Nz::Vector2ui& size)
+	{
+		unsigned int area = 0;
+		for (const Nz::Rectui& rect : rects)
+			area += rect.width * rect.height;
+
+		return float(area) / (size.x * size.y);
+	}
+
+	template<typename T>
+	void TestBinPack()
+	{
+		T binPack(512, 512);
+		REQUIRE(binPack.GetSize() == Nz::Vector2ui(512, 512));
+		CHECK(binPack.GetOccupancy() == Catch::Approx(0.f));
+
+		std::minstd_rand randEngine(42);
+		std::uniform_int_distribution<unsigned int> sizeDis(4, 48);
+
+		auto InsertRectangles = [&](std::vector<Nz::Rectui>& rects, std::size_t count, bool allowFlip)
+		{
+			std::size_t insertedCount = 0;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				unsigned int width = sizeDis(randEngine);
+				unsigned int height = sizeDis(randEngine);
+
+				Nz::Rectui rect(0, 0, width, height);
+				bool flipped = false;
+				bool inserted = (allowFlip) ? binPack.Insert(&rect, &flipped, 1) : binPack.Insert(&rect, 1);
+				if (!inserted)
+					continue;
+
+				if (flipped)
+				{
+					CHECK(rect.width == height);
+					CHECK(rect.height == width);
+				}
+				else
+				{
+					CHECK(rect.width == width);
+					CHECK(rect.height == height);
+				}
+
+				rects.push_back(rect);
+				insertedCount++;
+			}
+
+			return insertedCount;
+		};
+
+		std::vector<Nz::Rectui> rects;
+
+		WHEN("Inserting rectangles until the bin is full")
+		{
+			InsertRectangles(rects, 1000, true);
+
+			THEN("Rectangles don't overlap, fit in the bin and use most of it")
+			{
+				CheckRectangles(rects, binPack.GetSize());
+				CHECK(binPack.GetOccupancy() == Catch::Approx(ComputeOccupancy(rects, binPack.GetSize())));
+				CHECK(binPack.GetOccupancy() > 0.75f);
+			}
+		}
+
+		WHEN("Inserting rectangles without allowing rotations")
+		{
+			InsertRectangles(rects, 1000, false);
+
+			THEN("Rectangles don't overlap and fit in the bin")
+			{
+				CheckRectangles(rects, binPack.GetSize());
+				CHECK(binPack.GetOccupancy() == Catch::Approx(ComputeOccupancy(rects, binPack.GetSize())));
+			}
+		}
+
+		WHEN("Inserting a batch with rectangles which can't fit")
+		{
+			std::vector<Nz::Rectui> batch = {
+				Nz::Rectui(0, 0, 32, 32),
+				Nz::Rectui(0, 0, 1024, 32),
+				Nz::Rectui(0, 0, 16, 16)
+			};
+
+			bool inserted[3];
+			CHECK_FALSE(binPack.Insert(batch.data(), nullptr, inserted, 3));
+
+			THEN("Other rectangles are still inserted")
+			{
+				CHECK(inserted[0]);
+				CHECK_FALSE(inserted[1]);
+				CHECK(inserted[2]);
+			}
+		}
+
+		WHEN("Freeing and inserting rectangles repeatedly")
+		{
+			InsertRectangles(rects, 200, true);
+
+			std::size_t failureCount = 0;
+			for (std::size_t i = 0; i < 1000; ++i)
+			{
+				std::size_t rectIndex = randEngine() % rects.size();
+				binPack.FreeRectangle(rects[rectIndex]);
+				rects.erase(rects.begin() + rectIndex);
+
+				if (InsertRectangles(rects, 1, true) == 0)
+					failureCount++;
+			}
+
+			THEN("Freed space is reused")
+			{
+				CheckRectangles(rects, binPack.GetSize());
+				CHECK(binPack.GetOccupancy() == Catch::Approx(ComputeOccupancy(rects, binPack.GetSize())));
+				CHECK(failureCount < 100);
+			}
+		}
+
+		WHEN("Freeing every rectangle")
+		{
+			InsertRectangles(rects, 1000, true);
+			for (const Nz::Rectui& rect : rects)
+				binPack.FreeRectangle(rect);
+
+			THEN("The whole bin can be used again")
+			{
+				CHECK(binPack.GetOccupancy() == Catch::Approx(0.f));
+
+				Nz::Rectui rect(0, 0, 512, 512);
+				CHECK(binPack.Insert(&rect, 1));
+			}
+		}
+
+		WHEN("Expanding the bin")
+		{
+			InsertRectangles(rects, 1000, true);
+			std::size_t rectCount = rects.size();
+
+			binPack.Expand(1024, 1024);
+			REQUIRE(binPack.GetSize() == Nz::Vector2ui(1024, 1024));
+
+			InsertRectangles(rects, 1000, true);
+
+			THEN("New rectangles are packed in the new space without overlapping previous ones")
+			{
+				CHECK(rects.size() > rectCount);
+				CheckRectangles(rects, binPack.GetSize());
+			}
+		}
+	}
+}
+
+SCENARIO("Bin packers", "[CORE][BINPACK]")
+{
+	GIVEN("A maximal rectangles bin packer and many rectangles")
+	{
+		TestBinPack<Nz::MaxRectsBinPack>();
+	}
+
+	GIVEN("A skyline bin packer and many rectangles")
+	{
+		TestBinPack<Nz::SkylineBinPack>();
+	}
+
+	GIVEN("A guillotine bin packer")
+	{
+		Nz::GuillotineBinPack binPack(64, 64);
+
+		WHEN("Inserting a rectangle which only fits rotated")
+		{
+			Nz::Rectui rect(0, 0, 8, 64);
+			REQUIRE(binPack.Insert(&rect, 1, false, Nz::GuillotineBinPack::RectBestAreaFit, Nz::GuillotineBinPack::SplitMinimizeArea));
+
+			Nz::Rectui wideRect(0, 0, 64, 8);
+
+			THEN("It is only rotated if the caller can know about it")
+			{
+				CHECK_FALSE(binPack.Insert(&wideRect, 1, false, Nz::GuillotineBinPack::RectBestAreaFit, Nz::GuillotineBinPack::SplitMinimizeArea));
+
+				bool flipped;
+				CHECK(binPack.Insert(&wideRect, &flipped, 1, false, Nz::GuillotineBinPack::RectBestAreaFit, Nz::GuillotineBinPack::SplitMinimizeArea));
+				CHECK(flipped);
+				CHECK(wideRect.width == 8);
+				CHECK(wideRect.height == 64);
+			}
+		}
+	}
+}
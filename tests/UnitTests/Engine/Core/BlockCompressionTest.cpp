@@ -0,0 +1,389 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace
+{
+	// Smooth gradients with a bit of noise, closer to real textures than pure noise
+	Nz::Image BuildTestImage(unsigned int width, unsigned int height, bool opaque)
+	{
+		std::minstd_rand randEngine(42);
+		std::uniform_int_distribution<int> noiseDis(-8, 8);
+
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, width, height);
+
+		Nz::UInt8* pixels = image.GetPixels();
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			for (unsigned int x = 0; x < width; ++x)
+			{
+				Nz::UInt8* pixel = &pixels[(y * width + x) * 4];
+				pixel[0] = Nz::UInt8(std::clamp(int(x * 255 / width) + noiseDis(randEngine), 0, 255));
+				pixel[1] = Nz::UInt8(std::clamp(int(y * 255 / height) + noiseDis(randEngine), 0, 255));
+				pixel[2] = Nz::UInt8(std::clamp(int((x + y) * 127 / (width + height)) + 64 + noiseDis(randEngine), 0, 255));
+				pixel[3] = (opaque) ? 255 : Nz::UInt8(std::clamp(255 - int(x * 255 / width) + noiseDis(randEngine), 0, 255));
+			}
+		}
+
+		return image;
+	}
+
+	double ComputePSNR(const Nz::Image& reference, const Nz::Image& image, unsigned int channelCount)
+	{
+		const Nz::UInt8* referencePixels = reference.GetConstPixels();
+		const Nz::UInt8* pixels = image.GetConstPixels();
+
+		std::size_t pixelCount = std::size_t(reference.GetWidth()) * reference.GetHeight();
+
+		double squaredError = 0.0;
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			for (unsigned int c = 0; c < channelCount; ++c)
+			{
+				double diff = double(referencePixels[i * 4 + c]) - double(pixels[i * 4 + c]);
+				squaredError += diff * diff;
+			}
+		}
+
+		double meanSquaredError = squaredError / (pixelCount * channelCount);
+		if (meanSquaredError <= 0.0)
+			return 100.0;
+
+		return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+	}
+
+	double CompressAndMeasure(const Nz::Image& source, Nz::PixelFormat format, Nz::BlockCompressionQuality quality, unsigned int channelCount)
+	{
+		Nz::BlockCompressionParams params;
+		params.quality = quality;
+
+		Nz::Image image(source);
+		REQUIRE(image.Convert(format, params));
+		CHECK(image.GetMemoryUsage() == Nz::PixelFormatInfo::ComputeSize(format, source.GetWidth(), source.GetHeight(), 1));
+
+		REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+		return ComputePSNR(source, image, channelCount);
+	}
+}
+
+SCENARIO("Block compression", "[CORE][PIXELFORMAT][BLOCKCOMPRESSION]")
+{
+	WHEN("Computing the size of block compressed images")
+	{
+		CHECK(Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::DXT1, 4, 4, 1) == 8);
+		CHECK(Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::BC4, 5, 5, 1) == 4 * 8);
+		CHECK(Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::BC7, 1, 1, 1) == 16);
+		CHECK(Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::BC7, 64, 32, 6) == 16 * 8 * 16 * 6);
+	}
+
+	WHEN("Compressing an opaque image")
+	{
+		Nz::Image image = BuildTestImage(64, 64, true);
+
+		for (Nz::BlockCompressionQuality quality : { Nz::BlockCompressionQuality::Fast, Nz::BlockCompressionQuality::Normal, Nz::BlockCompressionQuality::High })
+		{
+			CHECK(CompressAndMeasure(image, Nz::PixelFormat::DXT1, quality, 3) > 30.0);
+			CHECK(CompressAndMeasure(image, Nz::PixelFormat::BC4, quality, 1) > 38.0);
+			CHECK(CompressAndMeasure(image, Nz::PixelFormat::BC5, quality, 2) > 38.0);
+			CHECK(CompressAndMeasure(image, Nz::PixelFormat::BC7, quality, 4) > 36.0);
+		}
+	}
+
+	WHEN("Compressing an image with alpha")
+	{
+		Nz::Image image = BuildTestImage(64, 64, false);
+
+		CHECK(CompressAndMeasure(image, Nz::PixelFormat::DXT3, Nz::BlockCompressionQuality::Normal, 4) > 28.0);
+		CHECK(CompressAndMeasure(image, Nz::PixelFormat::DXT5, Nz::BlockCompressionQuality::Normal, 4) > 30.0);
+		CHECK(CompressAndMeasure(image, Nz::PixelFormat::BC7, Nz::BlockCompressionQuality::Normal, 4) > 34.0);
+	}
+
+	WHEN("Compressing solid colors")
+	{
+		// Odd sizes exercise partial blocks
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 13, 7);
+		REQUIRE(image.Fill(Nz::Color::FromRGBA8(0, 255, 0, 255)));
+
+		for (Nz::PixelFormat format : { Nz::PixelFormat::DXT1, Nz::PixelFormat::DXT3, Nz::PixelFormat::DXT5, Nz::PixelFormat::BC7 })
+		{
+			Nz::Image compressed(image);
+			REQUIRE(compressed.Convert(format));
+			REQUIRE(compressed.Convert(Nz::PixelFormat::RGBA8));
+
+			// BC7 p-bits may prevent 0 and 255 to be represented exactly in the same endpoint
+			CHECK(ComputePSNR(image, compressed, 4) > 48.0);
+		}
+	}
+
+	WHEN("Compressing transparent texels to DXT1")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 4, 4);
+		REQUIRE(image.Fill(Nz::Color::FromRGBA8(200, 100, 50, 255)));
+		REQUIRE(image.Fill(Nz::Color::FromRGBA8(0, 0, 0, 0), Nz::Rectui(0, 0, 2, 2)));
+
+		REQUIRE(image.Convert(Nz::PixelFormat::DXT1));
+		REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+		const Nz::UInt8* pixels = image.GetConstPixels();
+		CHECK(pixels[3] == 0);
+		CHECK(pixels[(3 * 4 + 3) * 4 + 3] == 255);
+	}
+
+	WHEN("Compressing HDR data to BC6H")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA32F, 8, 8);
+
+		float* texels = reinterpret_cast<float*>(image.GetPixels());
+		for (unsigned int i = 0; i < 8 * 8; ++i)
+		{
+			texels[i * 4 + 0] = 1.f + i * 0.05f;
+			texels[i * 4 + 1] = 1.f;
+			texels[i * 4 + 2] = 2.f - i * 0.01f;
+			texels[i * 4 + 3] = 1.f;
+		}
+
+		Nz::Image compressed(image);
+		REQUIRE(compressed.Convert(Nz::PixelFormat::BC6H));
+		REQUIRE(compressed.Convert(Nz::PixelFormat::RGBA32F));
+
+		const float* decompressedTexels = reinterpret_cast<const float*>(compressed.GetConstPixels());
+
+		float maxRelativeError = 0.f;
+		for (unsigned int i = 0; i < 8 * 8 * 4; ++i)
+			maxRelativeError = std::max(maxRelativeError, std::abs(decompressedTexels[i] - texels[i]) / texels[i]);
+
+		CHECK(maxRelativeError < 0.05f);
+	}
+
+	WHEN("Decoding BC6H blocks of every mode")
+	{
+		// One block per mode, reference texels come from an independent decoder (Pillow) as 8 bits RGB values (clamped to [0, 1])
+		struct ReferenceBlock
+		{
+			std::array<Nz::UInt8, 16> block;
+			std::array<Nz::UInt8, 16 * 3> texels;
+		};
+
+		std::array<ReferenceBlock, 14> referenceBlocks = { {
+			// Mode 0x00
+			{
+				{ 0x80, 0xB2, 0xE5, 0x42, 0xB3, 0x16, 0x36, 0x59, 0x18, 0xF9, 0x3F, 0x81, 0x2B, 0x35, 0x3B, 0x76 },
+				{
+					35, 108, 46, 35, 108, 46, 44, 153, 56, 51, 158, 54, 51, 158, 54, 30, 90, 38, 36, 113, 48, 47, 155, 55,
+					33, 144, 60, 31, 95, 40, 34, 103, 44, 33, 144, 60, 40, 150, 57, 36, 147, 59, 32, 99, 42, 35, 108, 46
+				}
+			},
+			// Mode 0x01
+			{
+				{ 0x7D, 0x74, 0xDC, 0x4F, 0xB8, 0x20, 0x26, 0x43, 0x95, 0x26, 0xEE, 0xD5, 0xC9, 0x92, 0x0C, 0x37 },
+				{
+					15, 36, 9, 26, 13, 14, 21, 9, 5, 19, 8, 3, 51, 17, 12, 15, 36, 9, 9, 52, 7, 26, 13, 14,
+					9, 52, 7, 9, 52, 7, 9, 52, 7, 88, 12, 14, 3, 107, 6, 88, 12, 14, 51, 17, 12, 5, 74, 7
+				}
+			},
+			// Mode 0x02
+			{
+				{ 0xA2, 0x6C, 0xC8, 0x2F, 0xAE, 0xC0, 0x50, 0x75, 0x8C, 0x9B, 0xAF, 0x83, 0x67, 0x34, 0x9D, 0x04 },
+				{
+					69, 117, 30, 71, 117, 31, 63, 121, 30, 79, 115, 32, 67, 118, 30, 65, 109, 30, 71, 112, 31, 77, 114, 32,
+					75, 113, 31, 67, 110, 30, 71, 112, 31, 64, 120, 30, 77, 114, 32, 72, 116, 31, 72, 116, 31, 74, 115, 31
+				}
+			},
+			// Mode 0x06
+			{
+				{ 0x66, 0x77, 0x99, 0x47, 0x6F, 0xDF, 0x09, 0x16, 0xEC, 0x27, 0xB4, 0xC8, 0xE0, 0x83, 0x2D, 0x66 },
+				{
+					185, 45, 139, 184, 47, 136, 185, 45, 139, 194, 47, 143, 181, 50, 133, 186, 44, 140, 183, 48, 135, 184, 37, 153,
+					185, 45, 139, 186, 44, 140, 184, 47, 136, 192, 45, 145, 185, 45, 139, 181, 50, 133, 183, 48, 135, 196, 49, 142
+				}
+			},
+			// Mode 0x0a
+			{
+				{ 0xCA, 0xF0, 0xEC, 0x9F, 0x7F, 0x64, 0x99, 0x2D, 0x0F, 0x7C, 0xCF, 0x9B, 0x8E, 0xCA, 0x7F, 0x25 },
+				{
+					105, 240, 221, 105, 238, 219, 106, 249, 228, 102, 249, 218, 105, 243, 223, 102, 249, 218, 106, 249, 228, 105, 238, 219,
+					105, 241, 222, 110, 248, 237, 98, 250, 209, 104, 234, 215, 98, 250, 209, 108, 248, 233, 105, 243, 223, 105, 243, 223
+				}
+			},
+			// Mode 0x0e
+			{
+				{ 0xCE, 0x1E, 0x63, 0xE4, 0xE9, 0x82, 0x69, 0x4E, 0x6E, 0xE1, 0x7F, 0x58, 0x4D, 0x49, 0xA1, 0xB2 },
+				{
+					235, 42, 201, 222, 55, 183, 175, 34, 229, 224, 47, 238, 236, 51, 241, 238, 38, 205, 235, 42, 201, 199, 40, 234,
+					187, 37, 232, 242, 35, 210, 228, 49, 192, 175, 34, 229, 199, 40, 234, 236, 51, 241, 231, 45, 196, 228, 49, 192
+				}
+			},
+			// Mode 0x12
+			{
+				{ 0xF2, 0xC9, 0xB3, 0xBE, 0xB0, 0x48, 0x0F, 0xC9, 0x82, 0x0E, 0x90, 0x26, 0x14, 0xC6, 0x58, 0xE7 },
+				{
+					6, 48, 24, 7, 45, 21, 37, 55, 26, 9, 62, 12, 7, 45, 21, 18, 35, 12, 13, 61, 14, 6, 64, 10,
+					13, 39, 14, 18, 35, 12, 9, 62, 12, 52, 54, 30, 10, 42, 17, 41, 28, 7, 27, 57, 22, 18, 59, 17
+				}
+			},
+			// Mode 0x16
+			{
+				{ 0x96, 0xCE, 0x2D, 0xC9, 0x1E, 0xB5, 0x06, 0x48, 0x74, 0x38, 0x77, 0x91, 0x02, 0x74, 0x37, 0x41 },
+				{
+					147, 15, 30, 187, 6, 9, 154, 13, 25, 167, 10, 16, 53, 20, 18, 154, 13, 25, 141, 17, 37, 141, 17, 37,
+					66, 57, 14, 180, 7, 11, 174, 8, 14, 160, 12, 21, 59, 34, 15, 66, 57, 14, 141, 17, 37, 154, 13, 25
+				}
+			},
+			// Mode 0x1a
+			{
+				{ 0x7A, 0x0D, 0xB5, 0xD6, 0x5E, 0x7F, 0x00, 0xE5, 0x50, 0x21, 0x34, 0xE9, 0xF8, 0xD7, 0x5B, 0x56 },
+				{
+					76, 62, 75, 100, 66, 97, 88, 63, 86, 113, 105, 11, 172, 80, 156, 64, 60, 64, 172, 80, 156, 80, 15, 24,
+					100, 66, 97, 125, 73, 120, 172, 80, 156, 86, 23, 21, 88, 63, 86, 148, 77, 134, 88, 63, 86, 120, 151, 9
+				}
+			},
+			// Mode 0x1e
+			{
+				{ 0xBE, 0x5A, 0x4D, 0x29, 0xF8, 0x1A, 0xBF, 0xEB, 0xB6, 0xD1, 0x26, 0x00, 0x09, 0x03, 0xD0, 0xCB },
+				{
+					17, 239, 9, 28, 255, 10, 11, 58, 7, 11, 58, 7, 11, 58, 7, 17, 239, 9, 17, 239, 9, 77, 255, 14,
+					118, 119, 255, 11, 58, 7, 11, 58, 7, 11, 58, 7, 255, 38, 2, 255, 22, 0, 28, 255, 10, 200, 255, 18
+				}
+			},
+			// Mode 0x03
+			{
+				{ 0x83, 0x36, 0xD5, 0x9C, 0x2B, 0xCA, 0xB2, 0xEE, 0x02, 0x74, 0x7E, 0x70, 0x2E, 0x56, 0x3E, 0xB9 },
+				{
+					63, 59, 131, 77, 60, 127, 42, 55, 143, 26, 51, 154, 8, 42, 181, 26, 51, 154, 77, 60, 127, 26, 51, 154,
+					8, 42, 181, 55, 58, 135, 29, 53, 151, 35, 54, 146, 8, 42, 181, 48, 56, 139, 19, 49, 161, 13, 46, 170
+				}
+			},
+			// Mode 0x07
+			{
+				{ 0x47, 0x63, 0x77, 0x5D, 0x55, 0x43, 0x30, 0x4D, 0x1C, 0xDB, 0xDF, 0x49, 0xEA, 0x35, 0xC2, 0x40 },
+				{
+					53, 12, 21, 35, 19, 12, 76, 7, 35, 89, 6, 44, 103, 5, 54, 89, 6, 44, 63, 9, 28, 46, 14, 16,
+					70, 8, 31, 97, 6, 50, 49, 13, 18, 43, 15, 14, 39, 17, 13, 83, 7, 39, 32, 21, 11, 46, 14, 16
+				}
+			},
+			// Mode 0x0b
+			{
+				{ 0xCB, 0xDE, 0x98, 0xC9, 0xD4, 0x75, 0x54, 0x5A, 0xCB, 0xC9, 0xAF, 0xC6, 0x83, 0x77, 0xE0, 0x04 },
+				{
+					83, 108, 38, 68, 87, 30, 74, 96, 33, 68, 87, 30, 62, 78, 28, 72, 93, 31, 81, 105, 36, 68, 87, 30,
+					88, 114, 40, 77, 99, 34, 79, 102, 35, 79, 102, 35, 95, 123, 44, 63, 81, 29, 86, 111, 39, 95, 123, 44
+				}
+			},
+			// Mode 0x0f
+			{
+				{ 0x4F, 0x37, 0xF9, 0x19, 0x5F, 0xB7, 0xD4, 0xF2, 0xCA, 0x9C, 0xEC, 0x40, 0x53, 0x71, 0x6F, 0x6A },
+				{
+					159, 13, 250, 159, 13, 250, 159, 13, 250, 159, 13, 250, 159, 13, 250, 159, 13, 250, 160, 13, 249, 159, 13, 250,
+					159, 13, 250, 159, 13, 250, 159, 13, 249, 159, 13, 250, 159, 13, 250, 159, 13, 250, 159, 13, 250, 159, 13, 250
+				}
+			}
+		} };
+
+		for (const ReferenceBlock& referenceBlock : referenceBlocks)
+		{
+			Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::BC6H, 4, 4);
+			std::memcpy(image.GetPixels(), referenceBlock.block.data(), referenceBlock.block.size());
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA32F));
+
+			const float* texels = reinterpret_cast<const float*>(image.GetConstPixels());
+
+			float maxError = 0.f;
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				for (unsigned int c = 0; c < 3; ++c)
+					maxError = std::max(maxError, std::abs(std::clamp(texels[i * 4 + c], 0.f, 1.f) * 255.f - referenceBlock.texels[i * 3 + c]));
+			}
+
+			// Allow for the rounding of the reference
+			CHECK(maxError < 1.5f);
+		}
+	}
+
+	WHEN("Decoding BC7 three-subset blocks")
+	{
+		// Blocks of modes 0 and 2, reference texels come from an independent decoder (Pillow)
+		struct ReferenceBlock
+		{
+			std::array<Nz::UInt8, 16> block;
+			std::array<Nz::UInt8, 16 * 4> texels;
+		};
+
+		std::array<ReferenceBlock, 2> referenceBlocks = { {
+			// Mode 0
+			{
+				{ 0x9D, 0xFC, 0x4A, 0xAD, 0xDA, 0x8F, 0xDD, 0xD0, 0x54, 0xD3, 0x08, 0x66, 0x15, 0x19, 0xF7, 0x1A },
+				{
+					90, 102, 105, 255, 66, 82, 99, 255, 88, 132, 157, 255, 123, 239, 107, 255, 139, 141, 116, 255, 94, 150, 149, 255, 111, 204, 123, 255, 127, 217, 155, 255,
+					99, 167, 141, 255, 117, 222, 115, 255, 108, 226, 150, 255, 118, 222, 153, 255, 82, 115, 165, 255, 146, 207, 160, 255, 137, 212, 158, 255, 165, 198, 165, 255
+				}
+			},
+			// Mode 2
+			{
+				{ 0x1C, 0xAE, 0x3D, 0x76, 0x4C, 0x51, 0x9D, 0x95, 0x46, 0x92, 0x06, 0x4D, 0x4E, 0xD9, 0x6D, 0x0F },
+				{
+					186, 68, 110, 255, 24, 148, 49, 255, 67, 116, 101, 255, 67, 116, 101, 255, 189, 16, 148, 255, 181, 173, 33, 255, 113, 81, 154, 255, 156, 49, 206, 255,
+					184, 121, 71, 255, 186, 68, 110, 255, 181, 181, 132, 255, 140, 159, 124, 255, 181, 173, 33, 255, 98, 137, 115, 255, 57, 115, 107, 255, 57, 115, 107, 255
+				}
+			}
+		} };
+
+		for (const ReferenceBlock& referenceBlock : referenceBlocks)
+		{
+			Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::BC7, 4, 4);
+			std::memcpy(image.GetPixels(), referenceBlock.block.data(), referenceBlock.block.size());
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+			CHECK(std::memcmp(image.GetConstPixels(), referenceBlock.texels.data(), referenceBlock.texels.size()) == 0);
+		}
+	}
+
+	WHEN("Compressing in parallel")
+	{
+		Nz::Image image = BuildTestImage(256, 256, false);
+
+		Nz::TaskScheduler taskScheduler(4);
+
+		for (Nz::PixelFormat format : { Nz::PixelFormat::DXT1, Nz::PixelFormat::DXT5, Nz::PixelFormat::BC7 })
+		{
+			Nz::Image serialImage(image);
+			REQUIRE(serialImage.Convert(format));
+
+			Nz::Image parallelImage(image);
+			REQUIRE(parallelImage.Convert(format, Nz::BlockCompressionParams{}, &taskScheduler));
+
+			REQUIRE(serialImage.GetMemoryUsage() == parallelImage.GetMemoryUsage());
+			CHECK(std::memcmp(serialImage.GetConstPixels(), parallelImage.GetConstPixels(), serialImage.GetMemoryUsage()) == 0);
+		}
+	}
+
+	WHEN("Saving a BC7 image to a DDS file")
+	{
+		Nz::Image image = BuildTestImage(32, 32, false);
+		REQUIRE(image.GenerateMipmaps());
+		REQUIRE(image.Convert(Nz::PixelFormat::BC7));
+
+		Nz::ByteArray data;
+		Nz::MemoryStream stream(&data);
+		REQUIRE(image.SaveToStream(stream, ".dds"));
+
+		std::shared_ptr<Nz::Image> loadedImage = Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize());
+		REQUIRE(loadedImage);
+
+		CHECK(loadedImage->GetFormat() == Nz::PixelFormat::BC7);
+		REQUIRE(loadedImage->GetLevelCount() == image.GetLevelCount());
+
+		for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+		{
+			REQUIRE(loadedImage->GetMemoryUsage(level) == image.GetMemoryUsage(level));
+			CHECK(std::memcmp(loadedImage->GetConstPixels(0, 0, 0, level), image.GetConstPixels(0, 0, 0, level), image.GetMemoryUsage(level)) == 0);
+		}
+	}
+}
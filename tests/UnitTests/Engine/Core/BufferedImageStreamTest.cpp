@@ -0,0 +1,272 @@
+#include <Nazara/Core/BufferedImageStream.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/ImageStream.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+std::filesystem::path GetAssetDir();
+
+namespace
+{
+	// Each frame is filled with its index and takes some time to decode
+	class SlowImageStream : public Nz::ImageStream
+	{
+		public:
+			SlowImageStream(Nz::UInt64 frameCount, Nz::Time frameDuration, Nz::Time decodeDuration) :
+			m_currentFrame(0),
+			m_frameCount(frameCount),
+			m_decodeDuration(decodeDuration),
+			m_frameDuration(frameDuration)
+			{
+			}
+
+			bool DecodeNextFrame(void* frameBuffer, Nz::Time* frameTime) override
+			{
+				if (m_currentFrame >= m_frameCount)
+				{
+					if (frameTime)
+						*frameTime = Nz::Time::Nanoseconds(m_frameDuration.AsNanoseconds() * Nz::Int64(m_frameCount));
+
+					return false;
+				}
+
+				std::this_thread::sleep_for(m_decodeDuration.AsDuration<std::chrono::nanoseconds>());
+
+				if (frameBuffer)
+					std::memset(frameBuffer, int(m_currentFrame & 0xFF), Nz::PixelFormatInfo::ComputeSize(GetPixelFormat(), 4, 4, 1));
+
+				if (frameTime)
+					*frameTime = Nz::Time::Nanoseconds(m_frameDuration.AsNanoseconds() * Nz::Int64(m_currentFrame));
+
+				m_currentFrame++;
+				return true;
+			}
+
+			Nz::UInt64 GetFrameCount() const override
+			{
+				return m_frameCount;
+			}
+
+			Nz::PixelFormat GetPixelFormat() const override
+			{
+				return Nz::PixelFormat::RGBA8;
+			}
+
+			Nz::Vector2ui GetSize() const override
+			{
+				return Nz::Vector2ui(4, 4);
+			}
+
+			void Seek(Nz::UInt64 frameIndex) override
+			{
+				m_currentFrame = frameIndex;
+			}
+
+			Nz::UInt64 Tell() override
+			{
+				return m_currentFrame;
+			}
+
+		private:
+			Nz::UInt64 m_currentFrame;
+			Nz::UInt64 m_frameCount;
+			Nz::Time m_decodeDuration;
+			Nz::Time m_frameDuration;
+	};
+
+	const Nz::BufferedImageStream::Frame* WaitForFrame(Nz::BufferedImageStream& stream, Nz::Time timestamp)
+	{
+		// Give the decoder thread plenty of time even on a busy machine
+		Nz::Time deadline = Nz::GetElapsedMilliseconds() + Nz::Time::Seconds(10);
+		while (stream.GetReadyFrameCount() == 0 && !stream.IsFinished() && Nz::GetElapsedMilliseconds() < deadline)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		return stream.FetchFrame(timestamp);
+	}
+}
+
+SCENARIO("BufferedImageStream", "[CORE][BUFFEREDIMAGESTREAM]")
+{
+	using namespace Nz::Literals;
+
+	constexpr Nz::UInt64 frameCount = 20;
+
+	GIVEN("A slow to decode stream")
+	{
+		std::shared_ptr<SlowImageStream> imageStream = std::make_shared<SlowImageStream>(frameCount, 40_ms, 5_ms);
+		Nz::BufferedImageStream bufferedStream(imageStream, 4);
+
+		CHECK(bufferedStream.GetBufferedFrameCount() == 4);
+		CHECK(bufferedStream.GetFrameCount() == frameCount);
+		CHECK(bufferedStream.GetPixelFormat() == Nz::PixelFormat::RGBA8);
+		CHECK(bufferedStream.GetSize() == Nz::Vector2ui(4, 4));
+
+		WHEN("Fetching every frame in order")
+		{
+			THEN("Frames come out in order with the right content")
+			{
+				for (Nz::UInt64 i = 0; i < frameCount; ++i)
+				{
+					INFO("Frame " << i);
+
+					const Nz::BufferedImageStream::Frame* frame = WaitForFrame(bufferedStream, Nz::Time::Milliseconds(40 * Nz::Int64(i)));
+					REQUIRE(frame);
+					CHECK(frame->index == i);
+					CHECK(frame->time == Nz::Time::Milliseconds(40 * Nz::Int64(i)));
+					CHECK(static_cast<const Nz::UInt8*>(frame->pixels)[0] == i);
+				}
+
+				WaitForFrame(bufferedStream, 1000_ms);
+				CHECK(bufferedStream.IsFinished());
+			}
+		}
+
+		WHEN("Requesting a timestamp before the next frame")
+		{
+			const Nz::BufferedImageStream::Frame* firstFrame = WaitForFrame(bufferedStream, 10_ms);
+			REQUIRE(firstFrame);
+			CHECK(firstFrame->index == 0);
+
+			THEN("The current frame is presented again")
+			{
+				const Nz::BufferedImageStream::Frame* frame = WaitForFrame(bufferedStream, 39_ms);
+				REQUIRE(frame);
+				CHECK(frame->index == 0);
+			}
+		}
+
+		WHEN("Skipping ahead")
+		{
+			while (bufferedStream.GetReadyFrameCount() < bufferedStream.GetBufferedFrameCount())
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			THEN("Only the most recent due frame is presented")
+			{
+				const Nz::BufferedImageStream::Frame* frame = bufferedStream.FetchFrame(90_ms);
+				REQUIRE(frame);
+				CHECK(frame->index == 2);
+			}
+		}
+
+		WHEN("Seeking")
+		{
+			WaitForFrame(bufferedStream, 0_ms);
+			bufferedStream.Seek(12);
+
+			THEN("Buffered frames are dropped and decoding restarts from the seeked frame")
+			{
+				CHECK(bufferedStream.FetchFrame(1000_ms) == nullptr);
+
+				const Nz::BufferedImageStream::Frame* frame = WaitForFrame(bufferedStream, 480_ms);
+				REQUIRE(frame);
+				CHECK(frame->index == 12);
+				CHECK(static_cast<const Nz::UInt8*>(frame->pixels)[0] == 12);
+			}
+		}
+
+		WHEN("Playing in real time")
+		{
+			// Measure how long the caller is blocked when crossing frame boundaries, compared to decoding frames synchronously
+			Nz::Time maxBufferedStall = Nz::Time::Zero();
+			Nz::Time maxSynchronousStall = Nz::Time::Zero();
+
+			std::shared_ptr<SlowImageStream> synchronousStream = std::make_shared<SlowImageStream>(frameCount, 40_ms, 5_ms);
+
+			// Let the decoder fill its buffer, as a video player would before starting playback
+			while (bufferedStream.GetReadyFrameCount() < bufferedStream.GetBufferedFrameCount())
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			Nz::Time startTime = Nz::GetElapsedNanoseconds();
+			Nz::UInt64 lastFrameIndex = 0;
+			for (;;)
+			{
+				Nz::Time timestamp = Nz::GetElapsedNanoseconds() - startTime;
+				if (timestamp >= Nz::Time::Milliseconds(40 * Nz::Int64(frameCount)))
+					break;
+
+				Nz::Time t1 = Nz::GetElapsedNanoseconds();
+				const Nz::BufferedImageStream::Frame* frame = bufferedStream.FetchFrame(timestamp);
+				Nz::Time t2 = Nz::GetElapsedNanoseconds();
+				maxBufferedStall = std::max(maxBufferedStall, t2 - t1);
+
+				REQUIRE(frame);
+				CHECK(frame->index >= lastFrameIndex);
+				lastFrameIndex = frame->index;
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(4));
+			}
+
+			std::vector<Nz::UInt8> frameData(Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::RGBA8, 4, 4, 1));
+			for (Nz::UInt64 i = 0; i < frameCount; ++i)
+			{
+				Nz::Time t1 = Nz::GetElapsedNanoseconds();
+				synchronousStream->DecodeNextFrame(frameData.data(), nullptr);
+				Nz::Time t2 = Nz::GetElapsedNanoseconds();
+				maxSynchronousStall = std::max(maxSynchronousStall, t2 - t1);
+			}
+
+			INFO("buffered stall: " << maxBufferedStall << ", synchronous stall: " << maxSynchronousStall);
+
+			THEN("The caller never waits for the decoder")
+			{
+				CHECK(maxSynchronousStall >= 5_ms);
+				CHECK(maxBufferedStall < maxSynchronousStall);
+				CHECK(lastFrameIndex >= frameCount - 2);
+			}
+		}
+	}
+
+	GIVEN("A looping stream")
+	{
+		std::shared_ptr<SlowImageStream> imageStream = std::make_shared<SlowImageStream>(3, 100_ms, 0_ms);
+		Nz::BufferedImageStream bufferedStream(imageStream, 2, true);
+		CHECK(bufferedStream.IsLooping());
+
+		THEN("Frame times keep increasing across loops")
+		{
+			for (Nz::UInt64 i = 0; i < 8; ++i)
+			{
+				INFO("Frame " << i);
+
+				const Nz::BufferedImageStream::Frame* frame = WaitForFrame(bufferedStream, Nz::Time::Milliseconds(100 * Nz::Int64(i)));
+				REQUIRE(frame);
+				CHECK(frame->index == i % 3);
+				CHECK(frame->time == Nz::Time::Milliseconds(100 * Nz::Int64(i)));
+			}
+
+			CHECK_FALSE(bufferedStream.IsFinished());
+		}
+	}
+
+	GIVEN("A GIF file")
+	{
+		std::filesystem::path resourcePath = GetAssetDir();
+
+		std::shared_ptr<Nz::ImageStream> gif = Nz::ImageStream::OpenFromFile(resourcePath / "Utility/GIF/canvas_prev.gif");
+		REQUIRE(gif);
+
+		Nz::BufferedImageStream bufferedStream(gif, 3);
+
+		THEN("Buffered frames match the reference frames")
+		{
+			std::array<Nz::Time, 5> frameTimes = { 0_ms, 100_ms, 1100_ms, 2100_ms, 3100_ms };
+			for (std::size_t i = 0; i < frameTimes.size(); ++i)
+			{
+				INFO("Frame " << i);
+
+				std::shared_ptr<Nz::Image> referenceImage = Nz::Image::LoadFromFile(resourcePath / "Utility/GIF/canvas_prev" / (std::to_string(i) + ".png"));
+				REQUIRE(referenceImage);
+
+				const Nz::BufferedImageStream::Frame* frame = WaitForFrame(bufferedStream, frameTimes[i]);
+				REQUIRE(frame);
+				CHECK(frame->index == i);
+				CHECK(frame->time == frameTimes[i]);
+				CHECK(std::memcmp(frame->pixels, referenceImage->GetConstPixels(), referenceImage->GetMemoryUsage(0)) == 0);
+			}
+		}
+	}
+}
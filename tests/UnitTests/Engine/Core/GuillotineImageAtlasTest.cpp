@@ -0,0 +1,219 @@
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <random>
+#include <vector>
+
+SCENARIO("GuillotineImageAtlas", "[CORE][GUILLOTINEIMAGEATLAS]")
+{
+	GIVEN("An atlas and many images")
+	{
+		Nz::GuillotineImageAtlas atlas;
+		atlas.SetMaxLayerSize(1024);
+
+		struct Entry
+		{
+			Nz::Image image;
+			Nz::Rectui rect;
+			std::size_t layerIndex;
+			bool flipped;
+		};
+
+		std::minstd_rand randEngine(42);
+		std::uniform_int_distribution<unsigned int> sizeDis(4, 64);
+
+		std::vector<Entry> entries(2000);
+		for (std::size_t i = 0; i < entries.size(); ++i)
+		{
+			Entry& entry = entries[i];
+
+			unsigned int width = sizeDis(randEngine);
+			unsigned int height = sizeDis(randEngine);
+
+			// Fill each image with its index so we can check it was copied at the right place
+			entry.image.Create(Nz::ImageType::E2D, Nz::PixelFormat::A8, width, height);
+			std::memset(entry.image.GetPixels(), int(i % 250 + 1), width * height);
+			entry.rect = Nz::Rectui(0, 0, width, height);
+		}
+
+		WHEN("Inserting them at once")
+		{
+			Nz::SparsePtr<const Nz::Image> images(&entries[0].image, sizeof(Entry));
+			Nz::SparsePtr<Nz::Rectui> rects(&entries[0].rect, sizeof(Entry));
+			Nz::SparsePtr<bool> flipped(&entries[0].flipped, sizeof(Entry));
+			Nz::SparsePtr<std::size_t> layerIndices(&entries[0].layerIndex, sizeof(Entry));
+
+			REQUIRE(atlas.Insert(images, rects, flipped, layerIndices, entries.size()));
+
+			THEN("Rectangles don't overlap and fit in their layer")
+			{
+				CHECK(atlas.GetLayerCount() > 1);
+
+				for (std::size_t i = 0; i < entries.size(); ++i)
+				{
+					const Entry& entry = entries[i];
+					REQUIRE(entry.layerIndex < atlas.GetLayerCount());
+
+					Nz::Vector3ui layerSize = atlas.GetLayer(entry.layerIndex)->GetSize();
+					CHECK(entry.rect.x + entry.rect.width <= layerSize.x);
+					CHECK(entry.rect.y + entry.rect.height <= layerSize.y);
+
+					if (entry.flipped)
+					{
+						CHECK(entry.rect.width == entry.image.GetHeight());
+						CHECK(entry.rect.height == entry.image.GetWidth());
+					}
+					else
+					{
+						CHECK(entry.rect.width == entry.image.GetWidth());
+						CHECK(entry.rect.height == entry.image.GetHeight());
+					}
+				}
+
+				for (std::size_t i = 0; i < entries.size(); ++i)
+				{
+					for (std::size_t j = i + 1; j < entries.size(); ++j)
+					{
+						if (entries[i].layerIndex != entries[j].layerIndex)
+							continue;
+
+						// Rectangles sharing an edge are reported as intersecting with an empty intersection
+						Nz::Rectui intersection;
+						if (entries[i].rect.Intersect(entries[j].rect, &intersection) && intersection.width > 0 && intersection.height > 0)
+							FAIL("rectangles #" << i << " and #" << j << " overlap");
+					}
+				}
+			}
+
+			THEN("Images are copied into their rectangle")
+			{
+				for (std::size_t i = 0; i < entries.size(); ++i)
+				{
+					const Entry& entry = entries[i];
+					const Nz::Image& layer = static_cast<const Nz::Image&>(*atlas.GetLayer(entry.layerIndex));
+
+					Nz::UInt8 expectedValue = Nz::UInt8(i % 250 + 1);
+					CHECK(*layer.GetConstPixels(entry.rect.x, entry.rect.y) == expectedValue);
+					CHECK(*layer.GetConstPixels(entry.rect.x + entry.rect.width - 1, entry.rect.y + entry.rect.height - 1) == expectedValue);
+				}
+			}
+		}
+
+		WHEN("Inserting a rectangle bigger than a layer")
+		{
+			Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::A8, 2048, 16);
+			Nz::Rectui rect(0, 0, 2048, 16);
+			bool flipped;
+			std::size_t layerIndex;
+
+			THEN("It fails")
+			{
+				CHECK_FALSE(atlas.Insert(image, &rect, &flipped, &layerIndex));
+			}
+		}
+	}
+	GIVEN("A fragmented atlas using each packing algorithm")
+	{
+		for (Nz::BinPackAlgorithm algorithm : { Nz::BinPackAlgorithm::Guillotine, Nz::BinPackAlgorithm::MaxRects, Nz::BinPackAlgorithm::Skyline })
+		{
+			Nz::GuillotineImageAtlas atlas;
+			atlas.SetMaxLayerSize(1024);
+			atlas.SetPackingAlgorithm(algorithm);
+
+			struct Entry
+			{
+				Nz::Rectui rect;
+				std::size_t layerIndex;
+				Nz::UInt8 value;
+				bool flipped;
+			};
+
+			std::minstd_rand randEngine(42);
+			std::uniform_int_distribution<unsigned int> sizeDis(4, 32);
+
+			// Insert images one by one and free every other one
+			std::vector<Entry> entries;
+			for (std::size_t i = 0; i < 600; ++i)
+			{
+				unsigned int width = sizeDis(randEngine);
+				unsigned int height = sizeDis(randEngine);
+
+				Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::A8, width, height);
+				std::memset(image.GetPixels(), int(i % 250 + 1), width * height);
+
+				Entry entry;
+				entry.rect = Nz::Rectui(0, 0, width, height);
+				entry.value = Nz::UInt8(i % 250 + 1);
+				REQUIRE(atlas.Insert(image, &entry.rect, &entry.flipped, &entry.layerIndex));
+
+				if (i % 2 == 0)
+					entries.push_back(entry);
+				else
+					atlas.Free(&entry.rect, &entry.layerIndex, 1);
+			}
+
+			REQUIRE(atlas.GetLayerCount() == 1);
+			float occupancy = atlas.GetLayerOccupancy(0);
+
+			std::size_t relocationCount = 0;
+			Nz::AbstractImage* relocatedLayer = nullptr;
+			atlas.OnAtlasRectsRelocated.Connect([&](const Nz::AbstractAtlas*, std::size_t layerIndex, Nz::AbstractImage* layer, Nz::SparsePtr<const Nz::Rectui> oldRects, Nz::SparsePtr<const Nz::Rectui> newRects, std::size_t count)
+			{
+				CHECK(layerIndex == 0);
+				relocatedLayer = layer;
+				relocationCount = count;
+
+				for (Entry& entry : entries)
+				{
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						if (oldRects[i] == entry.rect)
+						{
+							entry.rect = newRects[i];
+							break;
+						}
+					}
+				}
+			});
+
+			Nz::AbstractImage* oldLayer = atlas.GetLayer(0);
+			Nz::AbstractImage* newLayer = nullptr;
+			atlas.OnAtlasLayerChange.Connect([&](const Nz::AbstractAtlas*, Nz::AbstractImage* oldImage, Nz::AbstractImage* newImage)
+			{
+				CHECK(oldImage == oldLayer);
+				newLayer = newImage;
+			});
+
+			INFO("packing algorithm #" << int(algorithm));
+			REQUIRE(atlas.Defragment(0));
+
+			// Users are notified of the new position of every live rectangle and of the new image
+			CHECK(relocationCount == entries.size());
+			CHECK(relocatedLayer == oldLayer);
+			CHECK(newLayer == atlas.GetLayer(0));
+			CHECK(atlas.GetLayerOccupancy(0) == occupancy);
+
+			// Rectangles don't overlap and their pixels were moved with them
+			const Nz::Image& layer = static_cast<const Nz::Image&>(*atlas.GetLayer(0));
+			for (std::size_t i = 0; i < entries.size(); ++i)
+			{
+				const Entry& entry = entries[i];
+				CHECK(*layer.GetConstPixels(entry.rect.x, entry.rect.y) == entry.value);
+				CHECK(*layer.GetConstPixels(entry.rect.x + entry.rect.width - 1, entry.rect.y + entry.rect.height - 1) == entry.value);
+
+				for (std::size_t j = i + 1; j < entries.size(); ++j)
+				{
+					Nz::Rectui intersection;
+					if (entry.rect.Intersect(entries[j].rect, &intersection) && intersection.width > 0 && intersection.height > 0)
+						FAIL("rectangles #" << i << " and #" << j << " overlap");
+				}
+			}
+
+			// Relocated rectangles can be freed
+			for (Entry& entry : entries)
+				atlas.Free(&entry.rect, &entry.layerIndex, 1);
+
+			CHECK(atlas.GetLayerOccupancy(0) == 0.f);
+		}
+	}
+}
@@ -0,0 +1,261 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace
+{
+	float ComputeCoverage(const Nz::Image& image, Nz::UInt8 level, float alphaReference)
+	{
+		const Nz::UInt8* pixels = image.GetConstPixels(0, 0, 0, level);
+		std::size_t pixelCount = std::size_t(image.GetWidth(level)) * image.GetHeight(level);
+
+		std::size_t coveredPixels = 0;
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			if (pixels[i * 4 + 3] / 255.f > alphaReference)
+				coveredPixels++;
+		}
+
+		return float(coveredPixels) / pixelCount;
+	}
+
+	bool LevelsMatch(const Nz::Image& lhs, const Nz::Image& rhs)
+	{
+		if (lhs.GetLevelCount() != rhs.GetLevelCount())
+			return false;
+
+		for (Nz::UInt8 level = 0; level < lhs.GetLevelCount(); ++level)
+		{
+			if (lhs.GetMemoryUsage(level) != rhs.GetMemoryUsage(level))
+				return false;
+
+			if (std::memcmp(lhs.GetConstPixels(0, 0, 0, level), rhs.GetConstPixels(0, 0, 0, level), lhs.GetMemoryUsage(level)) != 0)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("Image mipmap generation", "[CORE][IMAGE][MIPMAP]")
+{
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+	WHEN("Generating mipmaps of a float image using a box filter")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA32F, 4, 4);
+
+		float* texels = reinterpret_cast<float*>(image.GetPixels());
+		for (unsigned int i = 0; i < 4 * 4 * 4; ++i)
+			texels[i] = float(i);
+
+		REQUIRE(image.GenerateMipmaps());
+		REQUIRE(image.GetLevelCount() == 3);
+
+		THEN("Each texel is the average of the four texels it covers")
+		{
+			const float* level1 = reinterpret_cast<const float*>(image.GetConstPixels(0, 0, 0, 1));
+			CHECK(level1[0] == Catch::Approx((0.f + 4.f + 16.f + 20.f) / 4.f));
+			CHECK(level1[3] == Catch::Approx((3.f + 7.f + 19.f + 23.f) / 4.f));
+
+			const float* level2 = reinterpret_cast<const float*>(image.GetConstPixels(0, 0, 0, 2));
+			CHECK(level2[0] == Catch::Approx(30.f));
+		}
+	}
+
+	WHEN("Generating mipmaps of a constant image")
+	{
+		// Odd sizes make sure every filter weights are normalized
+		for (Nz::MipmapFilter filter : { Nz::MipmapFilter::Box, Nz::MipmapFilter::Kaiser, Nz::MipmapFilter::Lanczos })
+		{
+			Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 37, 23);
+			REQUIRE(image.Fill(Nz::Color::FromRGBA8(100, 150, 200, 255)));
+
+			Nz::ImageMipmapParams params;
+			params.filter = filter;
+
+			REQUIRE(image.GenerateMipmaps(params));
+			REQUIRE(image.GetLevelCount() == 6);
+
+			bool isConstant = true;
+			for (Nz::UInt8 level = 1; level < image.GetLevelCount(); ++level)
+			{
+				const Nz::UInt8* pixels = image.GetConstPixels(0, 0, 0, level);
+				std::size_t pixelCount = std::size_t(image.GetWidth(level)) * image.GetHeight(level);
+				for (std::size_t i = 0; i < pixelCount; ++i)
+				{
+					if (pixels[i * 4 + 0] != 100 || pixels[i * 4 + 1] != 150 || pixels[i * 4 + 2] != 200 || pixels[i * 4 + 3] != 255)
+						isConstant = false;
+				}
+			}
+
+			CHECK(isConstant);
+		}
+	}
+
+	WHEN("Generating mipmaps of sRGB images")
+	{
+		// Black and white columns, averaging in linear space gives 0.5 which is 188 once encoded in sRGB
+		auto BuildImage = [](Nz::PixelFormat format)
+		{
+			Nz::Image image(Nz::ImageType::E2D, format, 2, 2);
+
+			Nz::UInt8* pixels = image.GetPixels();
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				Nz::UInt8 value = (i % 2 == 0) ? 0 : 255;
+				pixels[i * 4 + 0] = value;
+				pixels[i * 4 + 1] = value;
+				pixels[i * 4 + 2] = value;
+				pixels[i * 4 + 3] = 255;
+			}
+
+			return image;
+		};
+
+		Nz::Image srgbImage = BuildImage(Nz::PixelFormat::RGBA8_SRGB);
+		REQUIRE(srgbImage.GenerateMipmaps());
+		CHECK(srgbImage.GetConstPixels(0, 0, 0, 1)[0] == 188);
+		CHECK(srgbImage.GetConstPixels(0, 0, 0, 1)[3] == 255);
+
+		Nz::Image linearImage = BuildImage(Nz::PixelFormat::RGBA8);
+		REQUIRE(linearImage.GenerateMipmaps());
+		CHECK(linearImage.GetConstPixels(0, 0, 0, 1)[0] == 128);
+
+		Nz::ImageMipmapParams params;
+		params.sRGB = true;
+
+		Nz::Image forcedImage = BuildImage(Nz::PixelFormat::RGBA8);
+		REQUIRE(forcedImage.GenerateMipmaps(params));
+		CHECK(forcedImage.GetFormat() == Nz::PixelFormat::RGBA8);
+		CHECK(forcedImage.GetConstPixels(0, 0, 0, 1)[0] == 188);
+	}
+
+	WHEN("Preserving alpha coverage")
+	{
+		constexpr float alphaReference = 0.5f;
+
+		// Sparse alpha-tested texels (like foliage) tend to vanish as alpha gets averaged
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 64, 64);
+
+		std::bernoulli_distribution coverageDis(0.3);
+		Nz::UInt8* pixels = image.GetPixels();
+		for (std::size_t i = 0; i < 64 * 64; ++i)
+		{
+			pixels[i * 4 + 0] = 255;
+			pixels[i * 4 + 1] = 255;
+			pixels[i * 4 + 2] = 255;
+			pixels[i * 4 + 3] = (coverageDis(randEngine)) ? 255 : 0;
+		}
+
+		float baseCoverage = ComputeCoverage(image, 0, alphaReference);
+
+		Nz::Image defaultImage(image);
+		REQUIRE(defaultImage.GenerateMipmaps());
+
+		Nz::ImageMipmapParams params;
+		params.alphaCoverageReference = alphaReference;
+
+		Nz::Image preservedImage(image);
+		REQUIRE(preservedImage.GenerateMipmaps(params));
+
+		CHECK(std::abs(ComputeCoverage(defaultImage, 3, alphaReference) - baseCoverage) > 0.2f);
+		CHECK(std::abs(ComputeCoverage(preservedImage, 3, alphaReference) - baseCoverage) < 0.1f);
+	}
+
+	WHEN("Generating mipmaps of layered images")
+	{
+		const Nz::Color faceColors[] = { Nz::Color::Red(), Nz::Color::Green(), Nz::Color::Blue(), Nz::Color::White(), Nz::Color::Black(), Nz::Color::Yellow() };
+
+		Nz::Image cubemap(Nz::ImageType::Cubemap, Nz::PixelFormat::RGBA8, 16, 16);
+		for (unsigned int face = 0; face < 6; ++face)
+			REQUIRE(cubemap.Fill(faceColors[face], Nz::Rectui(0, 0, 16, 16), face));
+
+		Nz::ImageMipmapParams params;
+		params.filter = Nz::MipmapFilter::Lanczos;
+
+		REQUIRE(cubemap.GenerateMipmaps(params));
+		REQUIRE(cubemap.GetLevelCount() == 5);
+
+		THEN("Faces are filtered independently")
+		{
+			for (Nz::UInt8 level = 1; level < cubemap.GetLevelCount(); ++level)
+			{
+				unsigned int size = cubemap.GetWidth(level);
+				for (unsigned int face = 0; face < 6; ++face)
+				{
+					const Nz::UInt8* pixel = cubemap.GetConstPixels(size - 1, size - 1, face, level);
+					CHECK(Nz::Color::FromRGBA8(pixel[0], pixel[1], pixel[2], pixel[3]) == faceColors[face]);
+				}
+			}
+		}
+
+		Nz::Image array(Nz::ImageType::E2D_Array, Nz::PixelFormat::RGBA8, 16, 8, 3);
+		REQUIRE(array.GenerateMipmaps());
+		REQUIRE(array.GetLevelCount() == 5);
+
+		THEN("Array layers are kept on every level")
+		{
+			for (Nz::UInt8 level = 0; level < array.GetLevelCount(); ++level)
+			{
+				CHECK(array.GetDepth(level) == 3);
+				CHECK(array.GetMemoryUsage(level) == std::size_t(array.GetWidth(level)) * array.GetHeight(level) * 3 * 4);
+			}
+		}
+	}
+
+	WHEN("Generating mipmaps in parallel")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 512, 384);
+
+		Nz::UInt8* pixels = image.GetPixels();
+		for (std::size_t i = 0; i < image.GetMemoryUsage(0); ++i)
+			pixels[i] = Nz::UInt8(byteDis(randEngine));
+
+		Nz::TaskScheduler taskScheduler(4);
+
+		for (Nz::MipmapFilter filter : { Nz::MipmapFilter::Box, Nz::MipmapFilter::Kaiser })
+		{
+			Nz::ImageMipmapParams params;
+			params.filter = filter;
+
+			Nz::Image serialImage(image);
+			REQUIRE(serialImage.GenerateMipmaps(params));
+
+			Nz::Image parallelImage(image);
+			REQUIRE(parallelImage.GenerateMipmaps(params, &taskScheduler));
+
+			CHECK(LevelsMatch(serialImage, parallelImage));
+		}
+	}
+
+	WHEN("Saving mipmaps to a DDS file")
+	{
+		Nz::Image cubemap(Nz::ImageType::Cubemap, Nz::PixelFormat::RGBA8, 32, 32);
+
+		Nz::UInt8* pixels = cubemap.GetPixels();
+		for (std::size_t i = 0; i < cubemap.GetMemoryUsage(0); ++i)
+			pixels[i] = Nz::UInt8(byteDis(randEngine));
+
+		REQUIRE(cubemap.GenerateMipmaps());
+
+		Nz::ByteArray data;
+		Nz::MemoryStream stream(&data);
+		REQUIRE(cubemap.SaveToStream(stream, ".dds"));
+
+		std::shared_ptr<Nz::Image> loadedCubemap = Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize());
+		REQUIRE(loadedCubemap);
+
+		CHECK(loadedCubemap->GetType() == Nz::ImageType::Cubemap);
+		CHECK(loadedCubemap->GetFormat() == Nz::PixelFormat::RGBA8);
+		CHECK(LevelsMatch(cubemap, *loadedCubemap));
+	}
+}
@@ -0,0 +1,124 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/IndexMapper.hpp>
+#include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/VertexMapper.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Triangle = std::array<Nz::Vector3f, 3>;
+
+	std::vector<Triangle> GetTriangles(Nz::SubMesh& subMesh)
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::VertexMapper vertexMapper(*subMesh.GetVertexBuffer());
+		Nz::SparsePtr<Nz::Vector3f> positions = vertexMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent::Position);
+
+		std::vector<Triangle> triangles(indexMapper.GetIndexCount() / 3);
+		for (std::size_t i = 0; i < triangles.size(); ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+				triangles[i][j] = positions[indexMapper.Get(i * 3 + j)];
+		}
+
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	void ShuffleTriangles(Nz::SubMesh& subMesh)
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::UInt32 triangleCount = indexMapper.GetIndexCount() / 3;
+
+		std::minstd_rand randEngine(42);
+		for (Nz::UInt32 i = triangleCount - 1; i > 0; --i)
+		{
+			Nz::UInt32 j = std::uniform_int_distribution<Nz::UInt32>(0, i)(randEngine);
+			for (Nz::UInt32 k = 0; k < 3; ++k)
+			{
+				Nz::UInt32 index = indexMapper.Get(i * 3 + k);
+				indexMapper.Set(i * 3 + k, indexMapper.Get(j * 3 + k));
+				indexMapper.Set(j * 3 + k, index);
+			}
+		}
+	}
+}
+
+SCENARIO("Mesh optimization", "[CORE][MESH]")
+{
+	Nz::MeshParams params;
+	params.optimizeIndexBuffers = false;
+
+	std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(Nz::Primitive::IcoSphere(1.f, 4), params);
+	REQUIRE(mesh);
+	REQUIRE(mesh->GetSubMeshCount() == 1);
+
+	Nz::SubMesh& subMesh = *mesh->GetSubMesh(0);
+	ShuffleTriangles(subMesh);
+
+	std::vector<Triangle> originalTriangles = GetTriangles(subMesh);
+
+	float originalAcmr;
+	Nz::UInt64 originalMissCount = subMesh.GetIndexBuffer()->ComputeCacheMissCount(&originalAcmr);
+	CHECK(originalAcmr > 1.5f);
+
+	WHEN("Optimizing the vertex cache")
+	{
+		subMesh.GetIndexBuffer()->Optimize();
+
+		float acmr, atvr;
+		Nz::UInt64 missCount = subMesh.GetIndexBuffer()->ComputeCacheMissCount(&acmr, &atvr);
+		CHECK(missCount < originalMissCount);
+		CHECK(acmr < 0.8f);
+		CHECK(atvr < 1.5f);
+		CHECK(GetTriangles(subMesh) == originalTriangles);
+	}
+
+	WHEN("Optimizing the whole mesh")
+	{
+		Nz::TaskScheduler taskScheduler(2);
+		mesh->Optimize(&taskScheduler);
+
+		float acmr;
+		subMesh.GetIndexBuffer()->ComputeCacheMissCount(&acmr);
+		CHECK(acmr < 0.85f);
+		CHECK(GetTriangles(subMesh) == originalTriangles);
+
+		// Vertices must now be referenced in order
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::UInt32 nextVertex = 0;
+		bool ordered = true;
+		for (Nz::UInt32 i = 0; i < indexMapper.GetIndexCount(); ++i)
+		{
+			Nz::UInt32 index = indexMapper.Get(i);
+			if (index > nextVertex)
+				ordered = false;
+			else if (index == nextVertex)
+				nextVertex++;
+		}
+
+		CHECK(ordered);
+	}
+
+	WHEN("Computing a vertex fetch remap table")
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::UInt32 vertexCount = subMesh.GetVertexCount();
+
+		std::vector<Nz::UInt32> remap(vertexCount);
+		Nz::UInt32 usedVertexCount = Nz::OptimizeVertexFetch(indexMapper.begin(), indexMapper.GetIndexCount(), vertexCount, remap.data());
+		CHECK(usedVertexCount == vertexCount);
+
+		// remap must be a permutation
+		std::sort(remap.begin(), remap.end());
+		for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+			CHECK(remap[i] == i);
+	}
+}
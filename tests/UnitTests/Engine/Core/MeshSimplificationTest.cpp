@@ -0,0 +1,104 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/IndexMapper.hpp>
+#include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/VertexMapper.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	// Returns the maximum distance between the triangles vertices and the unit sphere
+	float ComputeMaxSphereDistance(const Nz::SparsePtr<const Nz::Vector3f>& positions, const std::vector<Nz::UInt32>& indices, Nz::UInt32 indexCount)
+	{
+		float maxDistance = 0.f;
+		for (Nz::UInt32 i = 0; i < indexCount; i += 3)
+		{
+			// triangle center is the point which drifts the most from the sphere
+			Nz::Vector3f center = (positions[indices[i + 0]] + positions[indices[i + 1]] + positions[indices[i + 2]]) / 3.f;
+			maxDistance = std::max(maxDistance, std::abs(center.GetLength() - 1.f));
+		}
+
+		return maxDistance;
+	}
+}
+
+SCENARIO("Mesh simplification", "[CORE][MESH]")
+{
+	Nz::MeshParams params;
+	params.optimizeIndexBuffers = false;
+
+	std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(Nz::Primitive::IcoSphere(1.f, 4), params);
+	REQUIRE(mesh);
+
+	Nz::SubMesh& subMesh = *mesh->GetSubMesh(0);
+
+	WHEN("Simplifying indices")
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::VertexMapper vertexMapper(*subMesh.GetVertexBuffer());
+		Nz::SparsePtr<const Nz::Vector3f> positions = vertexMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Position);
+
+		Nz::UInt32 indexCount = indexMapper.GetIndexCount();
+		Nz::UInt32 vertexCount = subMesh.GetVertexCount();
+
+		std::vector<Nz::UInt32> simplifiedIndices(indexCount);
+
+		float error;
+		Nz::UInt32 simplifiedIndexCount = Nz::SimplifyIndices(indexMapper.begin(), indexCount, positions, vertexCount, indexCount / 4, 1.f, simplifiedIndices.data(), &error);
+
+		CHECK(simplifiedIndexCount % 3 == 0);
+		CHECK(simplifiedIndexCount <= indexCount / 4);
+		CHECK(simplifiedIndexCount > 0);
+		CHECK(error > 0.f);
+		CHECK(error < 0.05f);
+
+		// simplified mesh must stay close to the original sphere (error is relative to the mesh size)
+		CHECK(ComputeMaxSphereDistance(positions, simplifiedIndices, simplifiedIndexCount) < 0.1f);
+
+		for (Nz::UInt32 i = 0; i < simplifiedIndexCount; ++i)
+			CHECK(simplifiedIndices[i] < vertexCount);
+
+		AND_WHEN("Limiting the error")
+		{
+			Nz::UInt32 constrainedIndexCount = Nz::SimplifyIndices(indexMapper.begin(), indexCount, positions, vertexCount, 0, error * 0.5f, simplifiedIndices.data(), &error);
+			CHECK(constrainedIndexCount > simplifiedIndexCount);
+		}
+	}
+
+	WHEN("Generating levels of detail")
+	{
+		params.lodCount = 4;
+		params.lodReductionRatio = 0.5f;
+		params.lodMaxError = 0.1f;
+		mesh->GenerateLods(params);
+
+		REQUIRE(subMesh.GetLodCount() > 1);
+		CHECK(subMesh.GetLodCount() <= 4);
+
+		Nz::UInt32 previousIndexCount = subMesh.GetIndexBuffer()->GetIndexCount();
+		float previousError = 0.f;
+		for (std::size_t i = 0; i < subMesh.GetLodCount(); ++i)
+		{
+			const Nz::SubMesh::Lod& lod = subMesh.GetLod(i);
+			CHECK(lod.indexBuffer->GetIndexCount() < previousIndexCount);
+			CHECK(lod.error >= previousError);
+			CHECK(lod.error <= params.lodMaxError);
+
+			previousIndexCount = lod.indexBuffer->GetIndexCount();
+			previousError = lod.error;
+		}
+
+		AND_WHEN("Optimizing the mesh afterwards")
+		{
+			mesh->Optimize();
+
+			// levels of detail must still reference valid vertices
+			Nz::IndexMapper lodIndexMapper(*subMesh.GetLod(0).indexBuffer);
+			for (Nz::UInt32 i = 0; i < lodIndexMapper.GetIndexCount(); ++i)
+				CHECK(lodIndexMapper.Get(i) < subMesh.GetVertexCount());
+		}
+	}
+}
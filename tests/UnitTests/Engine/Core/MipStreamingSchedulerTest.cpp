@@ -0,0 +1,189 @@
+#include <Nazara/Core/MipStreamingScheduler.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+SCENARIO("MipStreamingScheduler", "[CORE][MIPSTREAMINGSCHEDULER]")
+{
+	// 1024x1024 RGBA8 with a full mip chain, level 4 (64x64) starts the mip tail
+	constexpr unsigned int textureSize = 1024;
+	constexpr Nz::UInt8 levelCount = 11;
+
+	auto ComputeResidentSize = [](Nz::UInt8 firstLevel)
+	{
+		Nz::UInt64 size = 0;
+		for (Nz::UInt8 level = firstLevel; level < levelCount; ++level)
+			size += Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::RGBA8, textureSize >> level, textureSize >> level, 1);
+
+		return size;
+	};
+
+	Nz::MipStreamingScheduler::Config config;
+	config.evictionDelay = 10;
+	config.frameUploadBudget = ComputeResidentSize(2);
+	config.mipTailSize = 64;
+	config.residentMemoryBudget = 64 * 1024 * 1024;
+
+	std::vector<Nz::MipStreamingScheduler::ResidencyChange> changes;
+
+	GIVEN("A scheduler with a single texture")
+	{
+		Nz::MipStreamingScheduler scheduler(config);
+		std::size_t textureIndex = scheduler.RegisterTexture(Nz::PixelFormat::RGBA8, textureSize, textureSize, 1, levelCount);
+
+		THEN("Only the mip tail is resident")
+		{
+			CHECK(scheduler.GetTailLevel(textureIndex) == 4);
+			CHECK(scheduler.GetResidentLevel(textureIndex) == 4);
+			CHECK(scheduler.GetResidentMemory() == ComputeResidentSize(4));
+		}
+
+		WHEN("It's not used")
+		{
+			scheduler.Update(changes);
+
+			THEN("Nothing is streamed")
+			{
+				CHECK(changes.empty());
+				CHECK(scheduler.GetLastFrameUploadSize() == 0);
+			}
+		}
+
+		WHEN("It covers a few pixels on screen")
+		{
+			scheduler.ReportUsage(textureIndex, 20.f);
+			scheduler.Update(changes);
+
+			THEN("The mip tail is enough")
+			{
+				CHECK(changes.empty());
+				CHECK(scheduler.GetDesiredLevel(textureIndex) == 4);
+			}
+		}
+
+		WHEN("It covers the whole screen")
+		{
+			scheduler.ReportUsage(textureIndex, 1080.f);
+			scheduler.Update(changes);
+
+			THEN("High mips are streamed over multiple frames within the upload budget")
+			{
+				CHECK(scheduler.GetDesiredLevel(textureIndex) == 0);
+
+				// Level 2 is the best fitting in the frame budget
+				REQUIRE(changes.size() == 1);
+				CHECK(changes[0].textureIndex == textureIndex);
+				CHECK(changes[0].previousResidentLevel == 4);
+				CHECK(changes[0].residentLevel == 2);
+				CHECK(changes[0].uploadSize == ComputeResidentSize(2));
+				CHECK(scheduler.GetLastFrameUploadSize() <= config.frameUploadBudget);
+
+				// Level 1 doesn't fit in the budget but is let through alone, as it would never be streamed otherwise
+				scheduler.ReportUsage(textureIndex, 1080.f);
+				scheduler.Update(changes);
+				REQUIRE(changes.size() == 1);
+				CHECK(changes[0].residentLevel == 1);
+
+				scheduler.ReportUsage(textureIndex, 1080.f);
+				scheduler.Update(changes);
+				REQUIRE(changes.size() == 1);
+				CHECK(changes[0].residentLevel == 0);
+				CHECK(scheduler.GetResidentMemory() == ComputeResidentSize(0));
+
+				scheduler.ReportUsage(textureIndex, 1080.f);
+				scheduler.Update(changes);
+				CHECK(changes.empty());
+			}
+
+			AND_WHEN("It stops being used")
+			{
+				for (unsigned int i = 0; i < 5; ++i)
+				{
+					scheduler.ReportUsage(textureIndex, 1080.f);
+					scheduler.Update(changes);
+				}
+				REQUIRE(scheduler.GetResidentLevel(textureIndex) == 0);
+
+				for (unsigned int i = 0; i < config.evictionDelay - 1; ++i)
+				{
+					scheduler.Update(changes);
+					CHECK(changes.empty());
+				}
+
+				THEN("High mips are evicted after a delay")
+				{
+					scheduler.Update(changes);
+					REQUIRE(changes.size() == 1);
+					CHECK(changes[0].previousResidentLevel == 0);
+					CHECK(changes[0].residentLevel == 4);
+					CHECK(scheduler.GetResidentLevel(textureIndex) == 4);
+					CHECK(scheduler.GetResidentMemory() == ComputeResidentSize(4));
+				}
+
+				THEN("Using it again resets the delay")
+				{
+					scheduler.ReportUsage(textureIndex, 1080.f);
+					scheduler.Update(changes);
+					CHECK(changes.empty());
+
+					scheduler.Update(changes);
+					CHECK(changes.empty());
+				}
+			}
+		}
+
+		WHEN("Unregistering the texture")
+		{
+			scheduler.UnregisterTexture(textureIndex);
+
+			CHECK_FALSE(scheduler.IsValid(textureIndex));
+			CHECK(scheduler.GetTextureCount() == 0);
+			CHECK(scheduler.GetResidentMemory() == 0);
+		}
+	}
+
+	GIVEN("A scheduler with multiple textures")
+	{
+		Nz::MipStreamingScheduler scheduler(config);
+
+		std::size_t closeTexture = scheduler.RegisterTexture(Nz::PixelFormat::RGBA8, textureSize, textureSize, 1, levelCount);
+		std::size_t farTexture = scheduler.RegisterTexture(Nz::PixelFormat::RGBA8, textureSize, textureSize, 1, levelCount);
+		CHECK(scheduler.GetTextureCount() == 2);
+
+		WHEN("They're used at different distances")
+		{
+			scheduler.ReportUsage(closeTexture, 1024.f);
+			scheduler.ReportUsage(farTexture, 256.f);
+
+			THEN("The texture missing the most detail is streamed first")
+			{
+				scheduler.Update(changes);
+				REQUIRE(changes.size() == 1);
+				CHECK(changes[0].textureIndex == closeTexture);
+				CHECK(scheduler.GetDesiredLevel(farTexture) == 2);
+			}
+		}
+
+		WHEN("Memory budget is too tight for both textures")
+		{
+			Nz::MipStreamingScheduler::Config tightConfig = config;
+			tightConfig.frameUploadBudget = ComputeResidentSize(0) * 2;
+			tightConfig.residentMemoryBudget = ComputeResidentSize(0) + ComputeResidentSize(3);
+			scheduler.UpdateConfig(tightConfig);
+
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				scheduler.ReportUsage(closeTexture, 1024.f);
+				scheduler.ReportUsage(farTexture, 1024.f);
+				scheduler.Update(changes);
+			}
+
+			THEN("Resident memory never exceeds the budget")
+			{
+				CHECK(scheduler.GetResidentMemory() <= tightConfig.residentMemoryBudget);
+				CHECK(scheduler.GetResidentLevel(closeTexture) == 0);
+				CHECK(scheduler.GetResidentLevel(farTexture) == 3);
+			}
+		}
+	}
+}
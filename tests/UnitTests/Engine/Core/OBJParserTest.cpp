@@ -0,0 +1,138 @@
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Formats/OBJParser.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+namespace
+{
+	std::string GenerateOBJ(unsigned int gridSize)
+	{
+		std::string content = "# Generated test file\nmtllib test.mtl\n";
+		for (unsigned int i = 0; i < gridSize; ++i)
+		{
+			if (i % 64 == 0)
+			{
+				content += "o Object" + std::to_string(i / 64) + '\n';
+				content += "usemtl Material" + std::to_string((i / 64) % 3) + '\n';
+			}
+
+			content += "v " + std::to_string(i) + ".5 " + std::to_string(-float(i)) + " 0.25\n";
+			content += "v " + std::to_string(i) + ".5 1e-2 " + std::to_string(i * 2) + '\n';
+			content += "v 0 0 0 1 # trailing comment\n";
+			content += "vt 0.5 " + std::to_string(i) + '\n';
+			content += "vn 0 1 0\n";
+
+			// mix absolute and relative indices
+			unsigned int first = i * 3 + 1;
+			content += "f " + std::to_string(first) + '/' + std::to_string(i + 1) + '/' + std::to_string(i + 1) + ' ' + std::to_string(first + 1) + "//" + std::to_string(i + 1) + ' ' + std::to_string(first + 2) + '\n';
+			content += "f -3/-1 -2/-1 -1/-1\r\n";
+		}
+
+		return content;
+	}
+
+	bool Compare(const Nz::OBJParser& lhs, const Nz::OBJParser& rhs)
+	{
+		if (lhs.GetPositionCount() != rhs.GetPositionCount() || lhs.GetNormalCount() != rhs.GetNormalCount() || lhs.GetTexCoordCount() != rhs.GetTexCoordCount())
+			return false;
+
+		if (lhs.GetMeshCount() != rhs.GetMeshCount() || lhs.GetMaterialCount() != rhs.GetMaterialCount() || lhs.GetMtlLib() != rhs.GetMtlLib())
+			return false;
+
+		for (std::size_t i = 0; i < lhs.GetPositionCount(); ++i)
+		{
+			if (lhs.GetPositions()[i] != rhs.GetPositions()[i])
+				return false;
+		}
+
+		for (std::size_t i = 0; i < lhs.GetMaterialCount(); ++i)
+		{
+			if (lhs.GetMaterials()[i] != rhs.GetMaterials()[i])
+				return false;
+		}
+
+		for (std::size_t i = 0; i < lhs.GetMeshCount(); ++i)
+		{
+			const Nz::OBJParser::Mesh& lhsMesh = lhs.GetMeshes()[i];
+			const Nz::OBJParser::Mesh& rhsMesh = rhs.GetMeshes()[i];
+			if (lhsMesh.name != rhsMesh.name || lhsMesh.material != rhsMesh.material || lhsMesh.faces.size() != rhsMesh.faces.size() || lhsMesh.vertices.size() != rhsMesh.vertices.size())
+				return false;
+
+			for (std::size_t j = 0; j < lhsMesh.vertices.size(); ++j)
+			{
+				const Nz::OBJParser::FaceVertex& lhsVertex = lhsMesh.vertices[j];
+				const Nz::OBJParser::FaceVertex& rhsVertex = rhsMesh.vertices[j];
+				if (lhsVertex.position != rhsVertex.position || lhsVertex.normal != rhsVertex.normal || lhsVertex.texCoord != rhsVertex.texCoord)
+					return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("OBJParser", "[CORE][OBJParser]")
+{
+	WHEN("Parsing a small OBJ file")
+	{
+		std::string content = GenerateOBJ(1);
+
+		Nz::OBJParser parser;
+		Nz::MemoryView stream(content.data(), content.size());
+		REQUIRE(parser.Parse(stream));
+
+		CHECK(parser.GetMtlLib() == "test.mtl");
+		CHECK(parser.GetPositionCount() == 3);
+		CHECK(parser.GetNormalCount() == 1);
+		CHECK(parser.GetTexCoordCount() == 1);
+		CHECK(parser.GetPositions()[0] == Nz::Vector4f(0.5f, 0.f, 0.25f, 1.f));
+		CHECK(parser.GetPositions()[1] == Nz::Vector4f(0.5f, 0.01f, 0.f, 1.f));
+		REQUIRE(parser.GetMeshCount() == 1);
+
+		const Nz::OBJParser::Mesh& mesh = parser.GetMeshes()[0];
+		CHECK(mesh.name == "Object0");
+		CHECK(parser.GetMaterials()[mesh.material] == "Material0");
+		REQUIRE(mesh.faces.size() == 2);
+		REQUIRE(mesh.vertices.size() == 6);
+
+		CHECK(mesh.vertices[0].position == 1);
+		CHECK(mesh.vertices[0].texCoord == 1);
+		CHECK(mesh.vertices[0].normal == 1);
+		CHECK(mesh.vertices[1].position == 2);
+		CHECK(mesh.vertices[1].texCoord == 0);
+		CHECK(mesh.vertices[1].normal == 1);
+		CHECK(mesh.vertices[2].position == 3);
+		CHECK(mesh.vertices[2].texCoord == 0);
+		CHECK(mesh.vertices[2].normal == 0);
+
+		// relative indices are resolved against the number of elements declared so far
+		CHECK(mesh.vertices[3].position == 1);
+		CHECK(mesh.vertices[4].position == 2);
+		CHECK(mesh.vertices[5].position == 3);
+		CHECK(mesh.vertices[5].texCoord == 1);
+	}
+
+	WHEN("Parsing a large OBJ file in parallel")
+	{
+		std::string content = GenerateOBJ(40'000);
+		REQUIRE(content.size() > 4 * 1024 * 1024);
+
+		Nz::OBJParser referenceParser;
+		{
+			Nz::MemoryView stream(content.data(), content.size());
+			REQUIRE(referenceParser.Parse(stream));
+		}
+
+		for (unsigned int workerCount : { 1, 2, 4 })
+		{
+			Nz::TaskScheduler taskScheduler(workerCount);
+
+			Nz::OBJParser parser;
+			Nz::MemoryView stream(content.data(), content.size());
+			REQUIRE(parser.Parse(stream, 100, &taskScheduler));
+
+			CHECK(Compare(referenceParser, parser));
+		}
+	}
+}
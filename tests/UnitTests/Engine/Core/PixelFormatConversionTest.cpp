@@ -0,0 +1,215 @@
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::vector<Nz::UInt8> Convert(Nz::PixelFormat srcFormat, Nz::PixelFormat dstFormat, const std::vector<Nz::UInt8>& pixels)
+	{
+		std::size_t pixelCount = pixels.size() / Nz::PixelFormatInfo::GetBytesPerPixel(srcFormat);
+
+		std::vector<Nz::UInt8> result(pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(dstFormat));
+		REQUIRE(Nz::PixelFormatInfo::Convert(srcFormat, dstFormat, pixels.data(), pixels.data() + pixels.size(), result.data()));
+
+		return result;
+	}
+}
+
+SCENARIO("Pixel format conversion", "[CORE][PIXELFORMAT]")
+{
+	// Odd pixel count, to exercise the scalar tail of vectorized kernels
+	constexpr std::size_t pixelCount = 1021;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+	std::vector<Nz::UInt8> rgba8(pixelCount * 4);
+	for (Nz::UInt8& value : rgba8)
+		value = Nz::UInt8(byteDis(randEngine));
+
+	WHEN("Checking supported conversions")
+	{
+		bool allSupported = true;
+		for (std::size_t i = 0; i < Nz::PixelFormatCount; ++i)
+		{
+			Nz::PixelFormat srcFormat = Nz::PixelFormat(i);
+			if (Nz::PixelFormatInfo::GetContent(srcFormat) != Nz::PixelFormatContent::ColorRGBA || Nz::PixelFormatInfo::IsCompressed(srcFormat))
+				continue;
+
+			for (std::size_t j = 0; j < Nz::PixelFormatCount; ++j)
+			{
+				Nz::PixelFormat dstFormat = Nz::PixelFormat(j);
+				if (Nz::PixelFormatInfo::GetContent(dstFormat) != Nz::PixelFormatContent::ColorRGBA || Nz::PixelFormatInfo::IsCompressed(dstFormat))
+					continue;
+
+				if (!Nz::PixelFormatInfo::IsConversionSupported(srcFormat, dstFormat))
+					allSupported = false;
+			}
+		}
+
+		CHECK(allSupported);
+	}
+
+	WHEN("Swizzling 8bits formats")
+	{
+		std::vector<Nz::UInt8> bgra8 = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::BGRA8, rgba8);
+		CHECK(bgra8[0] == rgba8[2]);
+		CHECK(bgra8[1] == rgba8[1]);
+		CHECK(bgra8[2] == rgba8[0]);
+		CHECK(bgra8[3] == rgba8[3]);
+		CHECK(Convert(Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA8, bgra8) == rgba8);
+
+		std::vector<Nz::UInt8> rgb8 = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB8, rgba8);
+		std::vector<Nz::UInt8> bgr8 = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::BGR8, rgba8);
+		CHECK(Convert(Nz::PixelFormat::BGR8, Nz::PixelFormat::RGB8, bgr8) == rgb8);
+
+		std::vector<Nz::UInt8> expandedRgba8 = Convert(Nz::PixelFormat::RGB8, Nz::PixelFormat::RGBA8, rgb8);
+		std::vector<Nz::UInt8> expandedBgra8 = Convert(Nz::PixelFormat::RGB8, Nz::PixelFormat::BGRA8, rgb8);
+
+		bool rgbMatches = true;
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			if (expandedRgba8[i * 4 + 0] != rgba8[i * 4 + 0] || expandedRgba8[i * 4 + 1] != rgba8[i * 4 + 1] || expandedRgba8[i * 4 + 2] != rgba8[i * 4 + 2] || expandedRgba8[i * 4 + 3] != 0xFF)
+				rgbMatches = false;
+
+			if (expandedBgra8[i * 4 + 0] != bgra8[i * 4 + 0] || expandedBgra8[i * 4 + 1] != bgra8[i * 4 + 1] || expandedBgra8[i * 4 + 2] != bgra8[i * 4 + 2] || expandedBgra8[i * 4 + 3] != 0xFF)
+				rgbMatches = false;
+		}
+		CHECK(rgbMatches);
+	}
+
+	WHEN("Expanding luminance formats")
+	{
+		std::vector<Nz::UInt8> la8(rgba8.begin(), rgba8.begin() + pixelCount * 2);
+		std::vector<Nz::UInt8> l8(rgba8.begin(), rgba8.begin() + pixelCount);
+
+		std::vector<Nz::UInt8> fromLA8 = Convert(Nz::PixelFormat::LA8, Nz::PixelFormat::RGBA8, la8);
+		std::vector<Nz::UInt8> fromL8 = Convert(Nz::PixelFormat::L8, Nz::PixelFormat::BGRA8, l8);
+
+		bool luminanceMatches = true;
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			if (fromLA8[i * 4 + 0] != la8[i * 2] || fromLA8[i * 4 + 1] != la8[i * 2] || fromLA8[i * 4 + 2] != la8[i * 2] || fromLA8[i * 4 + 3] != la8[i * 2 + 1])
+				luminanceMatches = false;
+
+			if (fromL8[i * 4 + 0] != l8[i] || fromL8[i * 4 + 1] != l8[i] || fromL8[i * 4 + 2] != l8[i] || fromL8[i * 4 + 3] != 0xFF)
+				luminanceMatches = false;
+		}
+		CHECK(luminanceMatches);
+
+		// Going back to luminance uses the same weights as the specialized converters
+		std::vector<Nz::UInt8> pixel = { 200, 100, 0, 255 };
+		CHECK(Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::L8, Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA32F, pixel))[0] == 119);
+	}
+
+	WHEN("Converting between 8bits, half-float and float formats")
+	{
+		std::vector<Nz::UInt8> rgba32f = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA32F, rgba8);
+
+		const float* floats = reinterpret_cast<const float*>(rgba32f.data());
+		CHECK(floats[0] == rgba8[0] / 255.f);
+		CHECK(floats[3] == rgba8[3] / 255.f);
+
+		CHECK(Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8, rgba32f) == rgba8);
+
+		// Half-floats have enough precision to represent every 8bits normalized value
+		std::vector<Nz::UInt8> rgba16f = Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA16F, rgba32f);
+		CHECK(Convert(Nz::PixelFormat::RGBA16F, Nz::PixelFormat::RGBA8, rgba16f) == rgba8);
+		CHECK(Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA16F, rgba8) == rgba16f);
+
+		std::vector<Nz::UInt8> rgb32f = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB32F, rgba8);
+		CHECK(Convert(Nz::PixelFormat::RGB32F, Nz::PixelFormat::RGB8, rgb32f) == Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB8, rgba8));
+	}
+
+	WHEN("Converting sRGB formats")
+	{
+		std::vector<Nz::UInt8> pixel = { 188, 0, 255, 128 };
+
+		std::vector<Nz::UInt8> linear = Convert(Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA32F, pixel);
+		const float* floats = reinterpret_cast<const float*>(linear.data());
+		CHECK(floats[0] == Catch::Approx(0.5029f).margin(0.0001f));
+		CHECK(floats[1] == 0.f);
+		CHECK(floats[2] == Catch::Approx(1.f));
+		CHECK(floats[3] == 128 / 255.f); //< alpha stays linear
+
+		// Every sRGB value must survive a round trip through linear space
+		CHECK(Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8_SRGB, Convert(Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA32F, rgba8)) == rgba8);
+		CHECK(Convert(Nz::PixelFormat::RGBA16F, Nz::PixelFormat::RGBA8_SRGB, Convert(Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA16F, rgba8)) == rgba8);
+
+		// Going through the generic path must give the same result
+		std::vector<Nz::UInt8> bgra8 = Convert(Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::BGRA8_SRGB, rgba8);
+		CHECK(Convert(Nz::PixelFormat::BGRA8_SRGB, Nz::PixelFormat::RGBA32F, bgra8) == Convert(Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA32F, rgba8));
+
+		// Normalized formats don't carry colorspace information and are only relabeled
+		CHECK(Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA8_SRGB, rgba8) == rgba8);
+	}
+
+	WHEN("Converting using the generic path")
+	{
+		std::vector<Nz::UInt8> rg16 = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RG16, rgba8);
+		std::vector<Nz::UInt8> result = Convert(Nz::PixelFormat::RG16, Nz::PixelFormat::RGBA8, rg16);
+
+		bool channelsMatch = true;
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			if (result[i * 4 + 0] != rgba8[i * 4 + 0] || result[i * 4 + 1] != rgba8[i * 4 + 1] || result[i * 4 + 2] != 0 || result[i * 4 + 3] != 0xFF)
+				channelsMatch = false;
+		}
+		CHECK(channelsMatch);
+
+		// Integer formats are not normalized
+		std::vector<float> color = { -3.6f, 40'000.f, 2.5f, 1.f };
+		std::vector<Nz::UInt8> colorBytes(reinterpret_cast<const Nz::UInt8*>(color.data()), reinterpret_cast<const Nz::UInt8*>(color.data() + color.size()));
+
+		std::vector<Nz::UInt8> rgba16i = Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA16I, colorBytes);
+		const Nz::Int16* integers = reinterpret_cast<const Nz::Int16*>(rgba16i.data());
+		CHECK(integers[0] == -4);
+		CHECK(integers[1] == 32767);
+		CHECK(integers[2] == 2);
+		CHECK(integers[3] == 1);
+
+		// Packed formats
+		std::vector<Nz::UInt8> rgba4 = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA4, rgba8);
+		std::vector<Nz::UInt8> rgb5a1 = Convert(Nz::PixelFormat::RGBA4, Nz::PixelFormat::RGB5A1, rgba4);
+		CHECK(rgb5a1.size() == pixelCount * 2);
+	}
+
+	WHEN("Converting images on a task scheduler")
+	{
+		constexpr unsigned int size = 1024;
+
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGB8, size, size, 1, 3);
+		for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+		{
+			Nz::UInt8* pixels = image.GetPixels(0, 0, 0, level);
+			std::size_t byteCount = Nz::PixelFormatInfo::ComputeSize(image.GetFormat(), image.GetWidth(level), image.GetHeight(level), 1);
+			for (std::size_t i = 0; i < byteCount; ++i)
+				pixels[i] = Nz::UInt8(byteDis(randEngine));
+		}
+
+		Nz::TaskScheduler taskScheduler(4);
+
+		for (Nz::PixelFormat format : { Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA16F, Nz::PixelFormat::RG16 })
+		{
+			Nz::Image reference(image);
+			REQUIRE(reference.Convert(format));
+
+			Nz::Image converted(image);
+			REQUIRE(converted.Convert(format, &taskScheduler));
+
+			bool levelsMatch = true;
+			for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+			{
+				std::size_t byteCount = Nz::PixelFormatInfo::ComputeSize(format, image.GetWidth(level), image.GetHeight(level), 1);
+				if (std::memcmp(reference.GetConstPixels(0, 0, 0, level), converted.GetConstPixels(0, 0, 0, level), byteCount) != 0)
+					levelsMatch = false;
+			}
+			CHECK(levelsMatch);
+		}
+	}
+}
@@ -42,6 +42,30 @@ SCENARIO("Serialization", "[CORE][SERIALIZATION]")
 				REQUIRE(Unserialize(context, &value));
 				REQUIRE(value == true);
 			}
+
+			THEN("Bit-packed integers")
+			{
+				context.stream->SetCursorPos(0);
+				REQUIRE(Serialize(context, true));
+				REQUIRE(Nz::SerializeBits(context, 0x5, 3));
+				REQUIRE(Nz::SerializeBits(context, 0x3FF, 10));
+				REQUIRE(Nz::SerializeBits(context, 0x0123456789ABCDEF, 64));
+				REQUIRE(Nz::SerializeBits(context, 0xFFFF, 0));
+				context.FlushBits();
+				CHECK(context.stream->GetCursorPos() == 10); //< 1 + 3 + 10 + 64 bits
+
+				context.stream->SetCursorPos(0);
+				bool flag = false;
+				Nz::UInt64 a = 0, b = 0, c = 0;
+				REQUIRE(Unserialize(context, &flag));
+				REQUIRE(Nz::UnserializeBits(context, &a, 3));
+				REQUIRE(Nz::UnserializeBits(context, &b, 10));
+				REQUIRE(Nz::UnserializeBits(context, &c, 64));
+				CHECK(flag);
+				CHECK(a == 0x5);
+				CHECK(b == 0x3FF);
+				CHECK(c == 0x0123456789ABCDEF);
+			}
 		}
 
 		WHEN("We serialize mathematical classes")
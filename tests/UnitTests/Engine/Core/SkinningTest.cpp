@@ -0,0 +1,124 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Joint.hpp>
+#include <Nazara/Core/Skeleton.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Angle.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	bool CheckVectors(const std::vector<Nz::Vector3f>& lhs, const std::vector<Nz::Vector3f>& rhs, float tolerance)
+	{
+		for (std::size_t i = 0; i < lhs.size(); ++i)
+		{
+			if ((lhs[i] - rhs[i]).GetLength() > tolerance)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("Skinning", "[CORE][SKINNING]")
+{
+	constexpr std::size_t jointCount = 8;
+	constexpr std::size_t vertexCount = 20'000;
+
+	Nz::Skeleton skeleton;
+	REQUIRE(skeleton.Create(jointCount));
+
+	std::minstd_rand randEngine(42);
+	std::uniform_real_distribution<float> posDis(-5.f, 5.f);
+	std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+	std::uniform_int_distribution<Nz::Int32> jointDis(0, jointCount - 1);
+
+	for (std::size_t i = 0; i < jointCount; ++i)
+	{
+		Nz::Joint* joint = skeleton.GetJoint(i);
+		joint->SetInverseBindMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine))));
+		joint->SetPosition(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine)));
+		joint->SetRotation(Nz::EulerAnglesf(Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine))));
+	}
+
+	std::vector<Nz::Vector3f> positions(vertexCount);
+	std::vector<Nz::Vector3f> normals(vertexCount);
+	std::vector<Nz::Vector4i32> jointIndices(vertexCount);
+	std::vector<Nz::Vector4f> jointWeights(vertexCount);
+	for (std::size_t i = 0; i < vertexCount; ++i)
+	{
+		positions[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine));
+		normals[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), 1.f).GetNormal();
+		jointIndices[i] = Nz::Vector4i32(jointDis(randEngine), jointDis(randEngine), jointDis(randEngine), jointDis(randEngine));
+		jointWeights[i] = Nz::Vector4f(0.4f, 0.3f, 0.2f, 0.1f);
+	}
+
+	// Reference implementation
+	std::vector<Nz::Vector3f> expectedPositions(vertexCount);
+	std::vector<Nz::Vector3f> expectedNormals(vertexCount);
+	for (std::size_t i = 0; i < vertexCount; ++i)
+	{
+		Nz::Vector3f finalPosition = Nz::Vector3f::Zero();
+		Nz::Vector3f finalNormal = Nz::Vector3f::Zero();
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			Nz::Matrix4f mat = skeleton.GetJoint(jointIndices[i][j])->GetSkinningMatrix();
+			mat *= jointWeights[i][j];
+
+			finalPosition += mat.Transform(positions[i]);
+			finalNormal += mat.Transform(normals[i], 0.f);
+		}
+
+		expectedPositions[i] = finalPosition;
+		expectedNormals[i] = finalNormal.GetNormal();
+	}
+
+	std::vector<Nz::Vector3f> outputPositions(vertexCount);
+	std::vector<Nz::Vector3f> outputNormals(vertexCount);
+
+	Nz::SkinningData skinningData;
+	skinningData.joints = skeleton.GetJoints();
+	skinningData.inputPositions = positions.data();
+	skinningData.inputNormals = normals.data();
+	skinningData.inputJointIndices = jointIndices.data();
+	skinningData.inputJointWeights = jointWeights.data();
+	skinningData.outputPositions = outputPositions.data();
+	skinningData.outputNormals = outputNormals.data();
+
+	WHEN("Using linear blend skinning")
+	{
+		Nz::SkinLinearBlend(skinningData, 0, vertexCount);
+
+		CHECK(CheckVectors(outputPositions, expectedPositions, 0.001f));
+		CHECK(CheckVectors(outputNormals, expectedNormals, 0.0001f));
+	}
+
+	WHEN("Using linear blend skinning on a task scheduler")
+	{
+		Nz::TaskScheduler taskScheduler(4);
+		Nz::SkinLinearBlend(skinningData, 0, vertexCount, &taskScheduler);
+
+		CHECK(CheckVectors(outputPositions, expectedPositions, 0.001f));
+		CHECK(CheckVectors(outputNormals, expectedNormals, 0.0001f));
+	}
+
+	WHEN("Using dual quaternion skinning on rigidly bound vertices")
+	{
+		// With only one influence, dual quaternion skinning must match linear blend skinning
+		for (std::size_t i = 0; i < vertexCount; ++i)
+		{
+			jointWeights[i] = Nz::Vector4f(1.f, 0.f, 0.f, 0.f);
+
+			Nz::Matrix4f mat = skeleton.GetJoint(jointIndices[i][0])->GetSkinningMatrix();
+			expectedPositions[i] = mat.Transform(positions[i]);
+			expectedNormals[i] = mat.Transform(normals[i], 0.f).GetNormal();
+		}
+
+		Nz::TaskScheduler taskScheduler(4);
+		Nz::SkinDualQuaternionBlend(skinningData, 0, vertexCount, &taskScheduler);
+
+		CHECK(CheckVectors(outputPositions, expectedPositions, 0.001f));
+		CHECK(CheckVectors(outputNormals, expectedNormals, 0.0001f));
+	}
+}
@@ -1,6 +1,7 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <random>
@@ -66,6 +67,59 @@ SCENARIO("TaskScheduler", "[CORE][TaskScheduler]")
 					CHECK(completionBuffer[i] == 1);
 				}
 			}
+
+			WHEN("We run a batch of jobs")
+			{
+				constexpr std::size_t jobCount = 257;
+
+				std::vector<Nz::UInt8> completionBuffer(jobCount, 0);
+				scheduler.ParallelFor(jobCount, [&](std::size_t jobIndex)
+				{
+					completionBuffer[jobIndex]++;
+				});
+
+				for (std::size_t i = 0; i < jobCount; ++i)
+				{
+					INFO("checking that job " << i << " was executed once");
+					CHECK(completionBuffer[i] == 1);
+				}
+			}
+
+			WHEN("We split a range between workers")
+			{
+				constexpr std::size_t elementCount = 100'000;
+
+				std::vector<Nz::UInt8> completionBuffer(elementCount, 0);
+				scheduler.ParallelForRange(elementCount, 1000, [&](std::size_t first, std::size_t last)
+				{
+					for (std::size_t i = first; i < last; ++i)
+						completionBuffer[i]++;
+				});
+
+				CHECK(std::count(completionBuffer.begin(), completionBuffer.end(), 1) == elementCount);
+			}
+
+			WHEN("We run batches of jobs from tasks of the same scheduler")
+			{
+				constexpr std::size_t taskCount = 16;
+				constexpr std::size_t jobCount = 64;
+
+				std::atomic_uint count = 0;
+				for (std::size_t i = 0; i < taskCount; ++i)
+				{
+					scheduler.AddTask([&]
+					{
+						scheduler.ParallelFor(jobCount, [&](std::size_t /*jobIndex*/)
+						{
+							count++;
+						});
+					});
+				}
+				scheduler.WaitForTasks();
+
+				unsigned int c = count.load();
+				CHECK(c == taskCount * jobCount);
+			}
 		}
 	}
 }
@@ -0,0 +1,195 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/VertexMapper.hpp>
+#include <Nazara/Core/VertexStruct.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+SCENARIO("Vertex quantization", "[CORE][VERTEXQUANTIZATION]")
+{
+	std::minstd_rand randEngine(42);
+
+	WHEN("Converting floats to half-floats")
+	{
+		CHECK(Nz::HalfToFloat(Nz::FloatToHalf(0.f)) == 0.f);
+		CHECK(Nz::HalfToFloat(Nz::FloatToHalf(1.f)) == 1.f);
+		CHECK(Nz::HalfToFloat(Nz::FloatToHalf(-0.5f)) == -0.5f);
+		CHECK(Nz::HalfToFloat(Nz::FloatToHalf(65504.f)) == 65504.f);
+		CHECK(Nz::HalfToFloat(Nz::FloatToHalf(100'000.f)) == std::numeric_limits<float>::infinity());
+
+		// Every half-float must survive a round trip
+		bool roundTrip = true;
+		for (Nz::UInt32 i = 0; i <= 0xFFFF; ++i)
+		{
+			float value = Nz::HalfToFloat(Nz::UInt16(i));
+			if (!std::isnan(value) && Nz::FloatToHalf(value) != i)
+				roundTrip = false;
+		}
+		CHECK(roundTrip);
+
+		// Normal half-floats have 11 bits of precision, rounding to nearest gives a relative error of at most 2^-11
+		std::uniform_real_distribution<float> valueDis(-1000.f, 1000.f);
+
+		float maxRelativeError = 0.f;
+		for (std::size_t i = 0; i < 100'000; ++i)
+		{
+			float value = valueDis(randEngine);
+			if (std::abs(value) < 6.2e-5f) //< subnormal half-floats
+				continue;
+
+			maxRelativeError = std::max(maxRelativeError, std::abs(Nz::HalfToFloat(Nz::FloatToHalf(value)) - value) / std::abs(value));
+		}
+		CHECK(maxRelativeError <= std::ldexp(1.f, -11));
+	}
+
+	WHEN("Encoding unit vectors using octahedral encoding")
+	{
+		for (const Nz::Vector3f& axis : { Nz::Vector3f::UnitX(), -Nz::Vector3f::UnitX(), Nz::Vector3f::UnitY(), -Nz::Vector3f::UnitY(), Nz::Vector3f::UnitZ(), -Nz::Vector3f::UnitZ() })
+			CHECK(Nz::DecodeOctahedral(Nz::EncodeOctahedral(axis)).ApproxEqual(axis, 0.00001f));
+
+		std::normal_distribution<float> normalDis;
+
+		float maxError = 0.f;
+		for (std::size_t i = 0; i < 100'000; ++i)
+		{
+			Nz::Vector3f normal = Nz::Vector3f(normalDis(randEngine), normalDis(randEngine), normalDis(randEngine)).GetNormal();
+			maxError = std::max(maxError, (Nz::DecodeOctahedral(Nz::EncodeOctahedral(normal)) - normal).GetLength());
+		}
+		CHECK(maxError < 0.0001f);
+	}
+
+	WHEN("Quantizing positions")
+	{
+		constexpr Nz::UInt32 vertexCount = 10'000;
+
+		std::uniform_real_distribution<float> xDis(-50.f, 150.f);
+		std::uniform_real_distribution<float> yDis(2.f, 3.f);
+		std::uniform_real_distribution<float> zDis(-0.1f, 0.1f);
+
+		std::vector<Nz::Vector3f> positions(vertexCount);
+		for (Nz::Vector3f& position : positions)
+			position = Nz::Vector3f(xDis(randEngine), yDis(randEngine), zDis(randEngine));
+
+		Nz::Boxf aabb = Nz::ComputeAABB(positions.data(), vertexCount);
+		Nz::PositionQuantization quantization = Nz::ComputePositionQuantization(aabb);
+
+		std::vector<Nz::Vector4i16> quantizedPositions(vertexCount);
+		Nz::QuantizePositions(positions.data(), vertexCount, quantization, quantizedPositions.data());
+
+		std::vector<Nz::Vector3f> dequantizedPositions(vertexCount);
+		Nz::DequantizePositions(quantizedPositions.data(), vertexCount, quantization, dequantizedPositions.data());
+
+		// The error is at most half a quantization step on each axis (with a bit of slack for float rounding)
+		Nz::Vector3f maxError = quantization.scale * (0.5f / 32767.f) * 1.05f;
+
+		bool inRange = true;
+		for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+		{
+			Nz::Vector3f error = dequantizedPositions[i] - positions[i];
+			if (std::abs(error.x) > maxError.x || std::abs(error.y) > maxError.y || std::abs(error.z) > maxError.z)
+				inRange = false;
+		}
+		CHECK(inRange);
+	}
+
+	WHEN("Building a mesh using the quantized vertex layout")
+	{
+		CHECK(Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_Normal_UV_Tangent_Quantized)->GetStride() == sizeof(Nz::VertexStruct_XYZ_Normal_UV_Tangent_Quantized));
+
+		Nz::MeshParams params;
+		params.optimizeIndexBuffers = false;
+		params.vertexOffset = Nz::Vector3f(10.f, -5.f, 2.f);
+
+		std::shared_ptr<Nz::Mesh> referenceMesh = Nz::Mesh::Build(Nz::Primitive::UVSphere(1.f, 17, 17), params);
+		REQUIRE(referenceMesh);
+
+		params.vertexDeclaration = Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_Normal_UV_Tangent_Quantized);
+
+		std::shared_ptr<Nz::Mesh> quantizedMesh = Nz::Mesh::Build(Nz::Primitive::UVSphere(1.f, 17, 17), params);
+		REQUIRE(quantizedMesh);
+
+		Nz::SubMesh& referenceSubMesh = *referenceMesh->GetSubMesh(0);
+		Nz::SubMesh& quantizedSubMesh = *quantizedMesh->GetSubMesh(0);
+		REQUIRE(referenceSubMesh.GetVertexCount() == quantizedSubMesh.GetVertexCount());
+
+		const Nz::PositionQuantization& quantization = quantizedSubMesh.GetVertexBuffer()->GetPositionQuantization();
+		CHECK(quantization.offset.ApproxEqual(params.vertexOffset, 0.001f));
+		CHECK(quantization.scale.ApproxEqual(Nz::Vector3f(1.f), 0.001f));
+
+		Nz::UInt32 vertexCount = referenceSubMesh.GetVertexCount();
+
+		Nz::VertexMapper referenceMapper(referenceSubMesh);
+		Nz::VertexMapper quantizedMapper(quantizedSubMesh);
+
+		THEN("Quantized components are transparently decoded")
+		{
+			CHECK(quantizedMapper.HasComponentOfType<Nz::Vector3f>(Nz::VertexComponent::Position));
+			CHECK(quantizedMapper.HasComponentOfType<Nz::Vector3f>(Nz::VertexComponent::Normal));
+			CHECK(quantizedMapper.HasComponentOfType<Nz::Vector2f>(Nz::VertexComponent::TexCoord));
+
+			Nz::SparsePtr<const Nz::Vector3f> referencePositions = referenceMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Position);
+			Nz::SparsePtr<const Nz::Vector3f> referenceNormals = referenceMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Normal);
+			Nz::SparsePtr<const Nz::Vector2f> referenceTexCoords = referenceMapper.GetComponentPtr<const Nz::Vector2f>(Nz::VertexComponent::TexCoord);
+
+			Nz::SparsePtr<const Nz::Vector3f> positions = quantizedMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Position);
+			Nz::SparsePtr<const Nz::Vector3f> normals = quantizedMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Normal);
+			Nz::SparsePtr<const Nz::Vector2f> texCoords = quantizedMapper.GetComponentPtr<const Nz::Vector2f>(Nz::VertexComponent::TexCoord);
+			REQUIRE(positions);
+			REQUIRE(normals);
+			REQUIRE(texCoords);
+
+			bool positionsMatch = true;
+			bool normalsMatch = true;
+			bool texCoordsMatch = true;
+			for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+			{
+				// Sphere radius is 1, so the quantization step is 1/32767
+				if (!positions[i].ApproxEqual(referencePositions[i], 0.0001f))
+					positionsMatch = false;
+
+				if (!normals[i].ApproxEqual(referenceNormals[i], 0.0001f))
+					normalsMatch = false;
+
+				if (!texCoords[i].ApproxEqual(referenceTexCoords[i], 0.001f))
+					texCoordsMatch = false;
+			}
+
+			CHECK(positionsMatch);
+			CHECK(normalsMatch);
+			CHECK(texCoordsMatch);
+		}
+
+		THEN("Writing through the mapper updates the quantization")
+		{
+			Nz::SparsePtr<Nz::Vector3f> positions = quantizedMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent::Position);
+			REQUIRE(positions);
+
+			for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+				positions[i] *= 4.f;
+
+			quantizedMapper.Unmap();
+
+			const Nz::PositionQuantization& newQuantization = quantizedSubMesh.GetVertexBuffer()->GetPositionQuantization();
+			CHECK(newQuantization.offset.ApproxEqual(params.vertexOffset * 4.f, 0.01f));
+			CHECK(newQuantization.scale.ApproxEqual(Nz::Vector3f(4.f), 0.01f));
+
+			Nz::VertexMapper updatedMapper(quantizedSubMesh);
+			Nz::SparsePtr<const Nz::Vector3f> referencePositions = referenceMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Position);
+			Nz::SparsePtr<const Nz::Vector3f> updatedPositions = updatedMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent::Position);
+
+			bool positionsMatch = true;
+			for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+			{
+				if (!updatedPositions[i].ApproxEqual(referencePositions[i] * 4.f, 0.0005f))
+					positionsMatch = false;
+			}
+
+			CHECK(positionsMatch);
+		}
+	}
+}
@@ -0,0 +1,147 @@
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	void TestCompressor(Nz::ENetCompressor& compressor)
+	{
+		std::array<Nz::UInt8, 4096> compressed;
+		std::array<Nz::UInt8, 4096> decompressed;
+
+		WHEN("Compressing a repetitive datagram split in several buffers")
+		{
+			// Looks like a snapshot: fixed-size entity records with mostly small values
+			std::vector<Nz::UInt8> datagram;
+			for (Nz::UInt8 entityIndex = 0; entityIndex < 50; ++entityIndex)
+			{
+				std::array<Nz::UInt8, 16> record = {};
+				record[0] = 0x03;
+				record[1] = entityIndex;
+				record[4] = entityIndex % 4;
+				record[8] = 0x42;
+				datagram.insert(datagram.end(), record.begin(), record.end());
+			}
+
+			std::array<Nz::NetBuffer, 4> buffers = {
+				Nz::NetBuffer{ &datagram[0], 4 },
+				Nz::NetBuffer{ &datagram[4], 0 },
+				Nz::NetBuffer{ &datagram[4], 300 },
+				Nz::NetBuffer{ &datagram[304], datagram.size() - 304 }
+			};
+
+			std::size_t compressedSize = compressor.Compress(nullptr, buffers.data(), buffers.size(), datagram.size(), compressed.data(), compressed.size());
+			REQUIRE(compressedSize > 0);
+			CHECK(compressedSize < datagram.size());
+
+			THEN("Decompressing gives back the original datagram")
+			{
+				std::size_t decompressedSize = compressor.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+				REQUIRE(decompressedSize == datagram.size());
+				CHECK(std::memcmp(decompressed.data(), datagram.data(), datagram.size()) == 0);
+			}
+
+			THEN("A too small output buffer is rejected")
+			{
+				CHECK(compressor.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), datagram.size() - 1) == 0);
+			}
+
+			THEN("Statistics are recorded")
+			{
+				const auto& statistics = compressor.GetGlobalStatistics();
+				CHECK(statistics.compressedPacketCount == 1);
+				CHECK(statistics.uncompressedPacketCount == 0);
+				CHECK(statistics.inputSize == datagram.size());
+				CHECK(statistics.outputSize == compressedSize);
+				CHECK(statistics.GetCompressionRatio() < 1.0);
+			}
+		}
+
+		WHEN("Compressing random data")
+		{
+			std::mt19937 randomGenerator(42);
+
+			std::vector<Nz::UInt8> datagram(1200);
+			for (Nz::UInt8& byte : datagram)
+				byte = static_cast<Nz::UInt8>(randomGenerator());
+
+			Nz::NetBuffer buffer{ datagram.data(), datagram.size() };
+
+			THEN("The datagram is left uncompressed")
+			{
+				CHECK(compressor.Compress(nullptr, &buffer, 1, datagram.size(), compressed.data(), compressed.size()) == 0);
+
+				const auto& statistics = compressor.GetGlobalStatistics();
+				CHECK(statistics.uncompressedPacketCount == 1);
+				CHECK(statistics.GetCompressionRatio() == 1.0);
+			}
+		}
+
+		WHEN("Decompressing random datagrams")
+		{
+			std::mt19937 randomGenerator(1337);
+
+			THEN("Decompression never writes past the output buffer")
+			{
+				for (std::size_t i = 0; i < 1000; ++i)
+				{
+					std::array<Nz::UInt8, 64> input;
+					for (Nz::UInt8& byte : input)
+						byte = static_cast<Nz::UInt8>(randomGenerator());
+
+					std::size_t inputSize = 1 + randomGenerator() % input.size();
+					CHECK(compressor.Decompress(nullptr, input.data(), inputSize, decompressed.data(), 256) <= 256);
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("ENetCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	GIVEN("A LZ4 compressor")
+	{
+		Nz::ENetLZ4Compressor compressor;
+		TestCompressor(compressor);
+	}
+
+	GIVEN("A range coder compressor")
+	{
+		Nz::ENetRangeCoderCompressor compressor;
+		TestCompressor(compressor);
+
+		WHEN("Compressing a long run of identical bytes")
+		{
+			// Best case for the range coder, close to its maximum ratio
+			std::vector<Nz::UInt8> datagram(100'000, 0xAB);
+			std::vector<Nz::UInt8> compressed(datagram.size());
+			std::vector<Nz::UInt8> decompressed(datagram.size());
+
+			Nz::NetBuffer buffer{ datagram.data(), datagram.size() };
+			std::size_t compressedSize = compressor.Compress(nullptr, &buffer, 1, datagram.size(), compressed.data(), compressed.size());
+			REQUIRE(compressedSize > 0);
+
+			THEN("It can still be decompressed")
+			{
+				CHECK(compressor.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), decompressed.size()) == datagram.size());
+				CHECK(decompressed == datagram);
+			}
+		}
+
+		WHEN("Decompressing a datagram declaring a size its data can't hold")
+		{
+			// 1MiB of decompressed data from five bytes
+			std::array<Nz::UInt8, 8> input = { 0x80, 0x80, 0x40, 0x12, 0x34, 0x56, 0x78, 0x9A };
+			std::vector<Nz::UInt8> decompressed(1024 * 1024);
+
+			THEN("It is rejected")
+			{
+				CHECK(compressor.Decompress(nullptr, input.data(), input.size(), decompressed.data(), decompressed.size()) == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,270 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	Nz::ByteArray MakePacket(std::initializer_list<Nz::UInt8> bytes)
+	{
+		return Nz::ByteArray(bytes.begin(), bytes.end());
+	}
+}
+
+SCENARIO("ENetShardedHost", "[NETWORK][ENETSHARDEDHOST]")
+{
+	GIVEN("A sharded host and a few clients connected through the loopback")
+	{
+		constexpr std::size_t ClientCount = 4;
+#ifdef NAZARA_PLATFORM_WINDOWS
+		constexpr std::size_t ShardCount = 1; //< no port sharing
+#else
+		constexpr std::size_t ShardCount = 2;
+#endif
+
+		// Multiple shards can't listen on a random port, find a free one
+		Nz::UInt16 port;
+		{
+			Nz::UdpSocket socket(Nz::NetProtocol::IPv4);
+			REQUIRE(socket.Bind(0) == Nz::SocketState::Bound);
+			port = socket.GetBoundPort();
+		}
+
+		Nz::ENetShardedHost server;
+		REQUIRE(server.Create(Nz::NetProtocol::IPv4, port, ShardCount, ClientCount, 1));
+		CHECK(server.GetShardCount() == ShardCount);
+		CHECK(server.GetServiceTimeout() == 1);
+
+		std::mutex serverMutex;
+		std::array<std::optional<Nz::ENetShardedHost::PeerToken>, ClientCount> serverTokens;
+
+		// Clients send their index as connection data, packets received by the server are relayed to the client whose index is the first byte
+		server.Start([&](std::size_t shardIndex, Nz::ENetHost& /*host*/, Nz::ENetEvent& event)
+		{
+			switch (event.type)
+			{
+				case Nz::ENetEventType::IncomingConnect:
+				{
+					std::scoped_lock lock(serverMutex);
+					serverTokens[event.data] = Nz::ENetShardedHost::GetPeerToken(shardIndex, *event.peer);
+					break;
+				}
+
+				case Nz::ENetEventType::Receive:
+				{
+					std::optional<Nz::ENetShardedHost::PeerToken> targetToken;
+					{
+						std::scoped_lock lock(serverMutex);
+						targetToken = serverTokens[event.packet->data[0]];
+					}
+
+					// The target may be owned by another shard
+					if (targetToken)
+						server.Send(*targetToken, 0, Nz::ENetPacketFlag::Reliable, Nz::ByteArray(event.packet->data));
+
+					break;
+				}
+
+				default:
+					break;
+			}
+		});
+
+		CHECK(server.IsRunning());
+
+		Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port);
+
+		struct Client
+		{
+			Nz::ENetHost host;
+			Nz::ENetPeer* peer = nullptr;
+			std::vector<Nz::ByteArray> receivedPackets;
+			bool isConnected = false;
+		};
+
+		std::array<Client, ClientCount> clients;
+		for (std::size_t i = 0; i < ClientCount; ++i)
+		{
+			REQUIRE(clients[i].host.Create(Nz::IpAddress::LoopbackIpV4, 1, 1));
+			REQUIRE(clients[i].host.Connect(serverAddress, 1, Nz::UInt32(i)));
+		}
+
+		auto ServiceClientsUntil = [&](auto&& predicate)
+		{
+			Nz::MillisecondClock clock;
+			while (clock.GetElapsedTime() < Nz::Time::Seconds(5))
+			{
+				for (Client& client : clients)
+				{
+					Nz::ENetEvent event;
+					while (client.host.Service(&event, 0) > 0)
+					{
+						switch (event.type)
+						{
+							case Nz::ENetEventType::OutgoingConnect:
+								client.peer = event.peer;
+								client.isConnected = true;
+								break;
+
+							case Nz::ENetEventType::Disconnect:
+							case Nz::ENetEventType::DisconnectTimeout:
+								client.isConnected = false;
+								break;
+
+							case Nz::ENetEventType::Receive:
+								client.receivedPackets.push_back(event.packet->data);
+								break;
+
+							default:
+								break;
+						}
+					}
+				}
+
+				if (predicate())
+					return true;
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			return false;
+		};
+
+		auto GetServerToken = [&](std::size_t clientIndex)
+		{
+			std::scoped_lock lock(serverMutex);
+			return serverTokens[clientIndex];
+		};
+
+		REQUIRE(ServiceClientsUntil([&]
+		{
+			for (std::size_t i = 0; i < ClientCount; ++i)
+			{
+				if (!clients[i].isConnected || !GetServerToken(i))
+					return false;
+			}
+
+			return true;
+		}));
+
+		std::array<Nz::ENetShardedHost::PeerToken, ClientCount> tokens;
+		for (std::size_t i = 0; i < ClientCount; ++i)
+		{
+			tokens[i] = *GetServerToken(i);
+			CHECK(tokens[i].shardIndex < ShardCount);
+			CHECK(tokens[i].connectId == clients[i].peer->GetConnectId());
+		}
+
+		WHEN("Sending packets to peer tokens from another thread")
+		{
+			for (std::size_t i = 0; i < ClientCount; ++i)
+				server.Send(tokens[i], 0, Nz::ENetPacketFlag::Reliable, MakePacket({ Nz::UInt8(i), 0x42 }));
+
+			THEN("Each client receives its own packet")
+			{
+				REQUIRE(ServiceClientsUntil([&]
+				{
+					for (const Client& client : clients)
+					{
+						if (client.receivedPackets.empty())
+							return false;
+					}
+
+					return true;
+				}));
+
+				for (std::size_t i = 0; i < ClientCount; ++i)
+				{
+					REQUIRE(clients[i].receivedPackets.size() == 1);
+					CHECK(clients[i].receivedPackets[0] == MakePacket({ Nz::UInt8(i), 0x42 }));
+				}
+			}
+		}
+
+		WHEN("Relaying packets between clients from the shard threads")
+		{
+			// Each client sends a packet to the next one, whichever shard owns it
+			for (std::size_t i = 0; i < ClientCount; ++i)
+			{
+				Nz::UInt8 target = Nz::UInt8((i + 1) % ClientCount);
+				clients[i].peer->Send(0, Nz::ENetPacketFlag::Reliable, MakePacket({ target, Nz::UInt8(i) }));
+			}
+
+			THEN("Packets reach their target")
+			{
+				REQUIRE(ServiceClientsUntil([&]
+				{
+					for (const Client& client : clients)
+					{
+						if (client.receivedPackets.empty())
+							return false;
+					}
+
+					return true;
+				}));
+
+				for (std::size_t i = 0; i < ClientCount; ++i)
+				{
+					Nz::UInt8 source = Nz::UInt8((i + ClientCount - 1) % ClientCount);
+
+					REQUIRE(clients[i].receivedPackets.size() == 1);
+					CHECK(clients[i].receivedPackets[0] == MakePacket({ Nz::UInt8(i), source }));
+				}
+			}
+		}
+
+		WHEN("Disconnecting a peer through its token")
+		{
+			server.Disconnect(tokens[1], 1337);
+
+			THEN("Only this client is disconnected")
+			{
+				REQUIRE(ServiceClientsUntil([&] { return !clients[1].isConnected; }));
+
+				CHECK(clients[0].isConnected);
+				CHECK(clients[2].isConnected);
+				CHECK(clients[3].isConnected);
+			}
+
+			AND_WHEN("The client reconnects")
+			{
+				REQUIRE(ServiceClientsUntil([&] { return !clients[1].isConnected; }));
+
+				{
+					std::scoped_lock lock(serverMutex);
+					serverTokens[1].reset();
+				}
+
+				REQUIRE(clients[1].host.Connect(serverAddress, 1, 1));
+				REQUIRE(ServiceClientsUntil([&] { return clients[1].isConnected && GetServerToken(1); }));
+
+				Nz::ENetShardedHost::PeerToken newToken = *GetServerToken(1);
+				CHECK(newToken != tokens[1]);
+
+				THEN("The old token is stale and packets sent to it are dropped")
+				{
+					// Commands are processed in order by the same shard: had the stale token been accepted, the new connection would be
+					// disconnected before receiving anything, or the first packet would arrive first on the reliable channel
+					server.Disconnect(tokens[1]);
+					server.Send(tokens[1], 0, Nz::ENetPacketFlag::Reliable, MakePacket({ 0x01 }));
+					server.Send(newToken, 0, Nz::ENetPacketFlag::Reliable, MakePacket({ 0x02 }));
+
+					REQUIRE(ServiceClientsUntil([&] { return !clients[1].receivedPackets.empty(); }));
+
+					CHECK(clients[1].receivedPackets == std::vector<Nz::ByteArray>{ MakePacket({ 0x02 }) });
+					CHECK(clients[1].isConnected);
+				}
+			}
+		}
+
+		server.Stop();
+		CHECK_FALSE(server.IsRunning());
+	}
+}
@@ -0,0 +1,262 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/Serialization.hpp>
+#include <Nazara/Network/EntitySnapshotDecoder.hpp>
+#include <Nazara/Network/EntitySnapshotEncoder.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <initializer_list>
+#include <memory>
+
+namespace
+{
+	struct TransformState
+	{
+		Nz::Vector3f position;
+		Nz::Quaternionf rotation = Nz::Quaternionf::Identity();
+	};
+
+	struct HealthState
+	{
+		int health = 0;
+		bool isAlive = true;
+	};
+
+	struct PlayerTag {};
+
+	std::shared_ptr<Nz::EntitySnapshotSchema> BuildSchema()
+	{
+		auto schema = std::make_shared<Nz::EntitySnapshotSchema>();
+		schema->AddComponent<TransformState>()
+			.AddVector3(&TransformState::position, -1000.f, 1000.f, 20)
+			.AddQuaternion(&TransformState::rotation, 9);
+
+		schema->AddComponent<HealthState>()
+			.AddInteger(&HealthState::health, 8)
+			.AddBool(&HealthState::isAlive);
+
+		schema->AddComponent<PlayerTag>();
+
+		return schema;
+	}
+}
+
+SCENARIO("EntitySnapshot", "[NETWORK][ENTITYSNAPSHOT]")
+{
+	GIVEN("Quantization helpers")
+	{
+		WHEN("Quantizing floats")
+		{
+			Nz::UInt32 quantized = Nz::EntitySnapshotSchema::QuantizeFloat(12.345f, -100.f, 100.f, 16);
+
+			THEN("The error is bounded by the step size")
+			{
+				float step = 200.f / ((1 << 16) - 1);
+				CHECK(std::abs(Nz::EntitySnapshotSchema::DequantizeFloat(quantized, -100.f, 100.f, 16) - 12.345f) <= step * 0.5f);
+			}
+
+			THEN("Out of range values are clamped")
+			{
+				CHECK(Nz::EntitySnapshotSchema::QuantizeFloat(-500.f, -100.f, 100.f, 16) == 0);
+				CHECK(Nz::EntitySnapshotSchema::QuantizeFloat(500.f, -100.f, 100.f, 16) == 0xFFFF);
+			}
+		}
+
+		WHEN("Quantizing rotations with the smallest three method")
+		{
+			Nz::Quaternionf rotation = Nz::Quaternionf::Normalize(Nz::Quaternionf(-0.3f, 0.8f, -0.4f, 0.2f));
+			Nz::UInt32 quantized = Nz::EntitySnapshotSchema::QuantizeQuaternion(rotation, 9);
+
+			THEN("The rotation is preserved (up to its sign)")
+			{
+				CHECK(quantized < (1u << (2 + 3 * 9)));
+
+				Nz::Quaternionf dequantized = Nz::EntitySnapshotSchema::DequantizeQuaternion(quantized, 9);
+				float dot = rotation.w * dequantized.w + rotation.x * dequantized.x + rotation.y * dequantized.y + rotation.z * dequantized.z;
+				CHECK(std::abs(dot) == Catch::Approx(1.f).margin(0.0001f));
+			}
+		}
+	}
+
+	GIVEN("A server registry replicated to a client")
+	{
+		std::shared_ptr<Nz::EntitySnapshotSchema> schema = BuildSchema();
+
+		entt::registry serverRegistry;
+		entt::registry clientRegistry;
+
+		entt::entity player = serverRegistry.create();
+		serverRegistry.emplace<TransformState>(player, TransformState{ Nz::Vector3f(10.f, 20.f, -30.f), Nz::Quaternionf::Identity() });
+		serverRegistry.emplace<HealthState>(player, HealthState{ 100, true });
+		serverRegistry.emplace<PlayerTag>(player);
+
+		entt::entity monster = serverRegistry.create();
+		serverRegistry.emplace<TransformState>(monster, TransformState{ Nz::Vector3f(-5.f, 0.f, 5.f), Nz::Quaternionf::Identity() });
+		serverRegistry.emplace<HealthState>(monster, HealthState{ -12, false });
+
+		Nz::EntitySnapshotEncoder encoder(schema);
+		Nz::EntitySnapshotDecoder decoder(schema);
+
+		std::shared_ptr<Nz::EntitySnapshot> firstSnapshot = schema->Capture(serverRegistry, 1);
+		Nz::ByteArray fullPacket = encoder.Encode(firstSnapshot);
+
+		std::shared_ptr<const Nz::EntitySnapshot> decodedSnapshot = decoder.Decode(fullPacket.GetConstBuffer(), fullPacket.GetSize());
+		REQUIRE(decodedSnapshot);
+		decoder.Apply(clientRegistry, *decodedSnapshot);
+
+		entt::entity clientPlayer = decoder.GetEntity(static_cast<Nz::UInt32>(entt::to_integral(player)));
+		entt::entity clientMonster = decoder.GetEntity(static_cast<Nz::UInt32>(entt::to_integral(monster)));
+
+		WHEN("Decoding a full snapshot")
+		{
+			THEN("Entities are created with their replicated components")
+			{
+				REQUIRE(clientRegistry.valid(clientPlayer));
+				REQUIRE(clientRegistry.valid(clientMonster));
+
+				const TransformState& transform = clientRegistry.get<TransformState>(clientPlayer);
+				CHECK(transform.position.x == Catch::Approx(10.f).margin(0.01f));
+				CHECK(transform.position.y == Catch::Approx(20.f).margin(0.01f));
+				CHECK(transform.position.z == Catch::Approx(-30.f).margin(0.01f));
+				CHECK(clientRegistry.get<HealthState>(clientPlayer).health == 100);
+				CHECK(clientRegistry.all_of<PlayerTag>(clientPlayer));
+
+				CHECK(clientRegistry.get<HealthState>(clientMonster).health == -12);
+				CHECK_FALSE(clientRegistry.get<HealthState>(clientMonster).isAlive);
+				CHECK_FALSE(clientRegistry.all_of<PlayerTag>(clientMonster));
+			}
+		}
+
+		WHEN("Sending a snapshot without acknowledging the previous one")
+		{
+			serverRegistry.get<HealthState>(player).health = 99;
+
+			Nz::ByteArray packet = encoder.Encode(schema->Capture(serverRegistry, 2));
+
+			THEN("It is encoded in full")
+			{
+				CHECK(packet.GetSize() == fullPacket.GetSize());
+			}
+		}
+
+		WHEN("Sending a delta snapshot after an acknowledgment")
+		{
+			REQUIRE(encoder.Acknowledge(decodedSnapshot->GetTick()));
+			CHECK_FALSE(encoder.Acknowledge(decodedSnapshot->GetTick()));
+
+			serverRegistry.get<TransformState>(player).position.x = 11.f;
+			serverRegistry.remove<HealthState>(monster);
+
+			entt::entity projectile = serverRegistry.create();
+			serverRegistry.emplace<TransformState>(projectile, TransformState{ Nz::Vector3f(0.f, 1.f, 0.f), Nz::Quaternionf::Identity() });
+
+			Nz::ByteArray deltaPacket = encoder.Encode(schema->Capture(serverRegistry, 2));
+			CHECK(deltaPacket.GetSize() < fullPacket.GetSize());
+
+			std::shared_ptr<const Nz::EntitySnapshot> deltaSnapshot = decoder.Decode(deltaPacket.GetConstBuffer(), deltaPacket.GetSize());
+			REQUIRE(deltaSnapshot);
+			CHECK(deltaSnapshot->GetEntityCount() == 3);
+
+			decoder.Apply(clientRegistry, *deltaSnapshot);
+
+			THEN("Changes are applied on top of the baseline")
+			{
+				CHECK(clientRegistry.get<TransformState>(clientPlayer).position.x == Catch::Approx(11.f).margin(0.01f));
+				CHECK(clientRegistry.get<HealthState>(clientPlayer).health == 100);
+				CHECK_FALSE(clientRegistry.all_of<HealthState>(clientMonster));
+
+				entt::entity clientProjectile = decoder.GetEntity(static_cast<Nz::UInt32>(entt::to_integral(projectile)));
+				REQUIRE(clientRegistry.valid(clientProjectile));
+				CHECK(clientRegistry.get<TransformState>(clientProjectile).position.y == Catch::Approx(1.f).margin(0.01f));
+			}
+
+			THEN("Older snapshots are ignored")
+			{
+				CHECK_FALSE(decoder.Decode(fullPacket.GetConstBuffer(), fullPacket.GetSize()));
+			}
+		}
+
+		WHEN("Decoding snapshots with malformed entity ids")
+		{
+			// Builds a snapshot on top of the first one, removing and updating entities by their id gaps (updated entities have a PlayerTag only)
+			auto BuildPacket = [](std::initializer_list<Nz::UInt32> removedGaps, std::initializer_list<Nz::UInt32> updatedGaps)
+			{
+				Nz::ByteArray data;
+				Nz::MemoryStream stream(&data, Nz::OpenMode::Write);
+
+				Nz::SerializationContext context;
+				context.stream = &stream;
+
+				auto WriteVarUInt = [&](Nz::UInt32 value)
+				{
+					if (value < (1 << 4))
+						Nz::SerializeBits(context, Nz::UInt64(value) << 1, 1 + 4);
+					else if (value < (1 << 10))
+						Nz::SerializeBits(context, 0b01 | (Nz::UInt64(value) << 2), 2 + 10);
+					else
+						Nz::SerializeBits(context, 0b11 | (Nz::UInt64(value) << 2), 2 + 32);
+				};
+
+				Nz::SerializeBits(context, 2, 32);
+				Nz::SerializeBits(context, 1, 32);
+
+				WriteVarUInt(static_cast<Nz::UInt32>(removedGaps.size()));
+				for (Nz::UInt32 gap : removedGaps)
+					WriteVarUInt(gap);
+
+				WriteVarUInt(static_cast<Nz::UInt32>(updatedGaps.size()));
+				for (Nz::UInt32 gap : updatedGaps)
+				{
+					WriteVarUInt(gap);
+					Nz::SerializeBits(context, 0b100, 3);
+				}
+
+				context.FlushBits();
+				return data;
+			};
+
+			THEN("Valid ids are accepted")
+			{
+				Nz::ByteArray packet = BuildPacket({ 5, 3 }, { 5, 0xFFFFFFF0 });
+				CHECK(decoder.Decode(packet.GetConstBuffer(), packet.GetSize()));
+			}
+
+			THEN("Overflowing ids are rejected")
+			{
+				Nz::ByteArray updatedPacket = BuildPacket({}, { 5, 0xFFFFFFFF });
+				CHECK_FALSE(decoder.Decode(updatedPacket.GetConstBuffer(), updatedPacket.GetSize()));
+
+				Nz::ByteArray removedPacket = BuildPacket({ 5, 0xFFFFFFFF }, {});
+				CHECK_FALSE(decoder.Decode(removedPacket.GetConstBuffer(), removedPacket.GetSize()));
+			}
+
+			THEN("Duplicated removed ids are rejected")
+			{
+				Nz::ByteArray packet = BuildPacket({ 5, 0 }, {});
+				CHECK_FALSE(decoder.Decode(packet.GetConstBuffer(), packet.GetSize()));
+			}
+		}
+
+		WHEN("An entity is destroyed on the server")
+		{
+			REQUIRE(encoder.Acknowledge(decodedSnapshot->GetTick()));
+
+			serverRegistry.destroy(monster);
+
+			Nz::ByteArray packet = encoder.Encode(schema->Capture(serverRegistry, 2));
+			std::shared_ptr<const Nz::EntitySnapshot> snapshot = decoder.Decode(packet.GetConstBuffer(), packet.GetSize());
+			REQUIRE(snapshot);
+
+			decoder.Apply(clientRegistry, *snapshot);
+
+			THEN("It is destroyed on the client")
+			{
+				CHECK_FALSE(clientRegistry.valid(clientMonster));
+				CHECK(decoder.GetEntity(static_cast<Nz::UInt32>(entt::to_integral(monster))) == entt::null);
+				CHECK(clientRegistry.valid(clientPlayer));
+			}
+		}
+	}
+}
@@ -0,0 +1,198 @@
+#include <Nazara/Core/Components/NodeComponent.hpp>
+#include <Nazara/Network/EntitySnapshotSchema.hpp>
+#include <Nazara/Network/Components/InterestComponent.hpp>
+#include <Nazara/Network/Components/InterestObserverComponent.hpp>
+#include <Nazara/Network/Systems/InterestSystem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+	struct PositionState
+	{
+		Nz::Vector3f position;
+	};
+
+	bool Contains(const std::vector<entt::entity>& entities, entt::entity entity)
+	{
+		return std::find(entities.begin(), entities.end(), entity) != entities.end();
+	}
+}
+
+SCENARIO("InterestSystem", "[NETWORK][INTERESTSYSTEM]")
+{
+	GIVEN("An observer and a few replicated entities")
+	{
+		entt::registry registry;
+		Nz::InterestSystem interestSystem(registry, 10.f);
+
+		entt::entity observer = registry.create();
+		registry.emplace<Nz::NodeComponent>(observer, Nz::Vector3f::Zero());
+		registry.emplace<Nz::InterestObserverComponent>(observer, 50.f);
+
+		auto CreateEntity = [&](const Nz::Vector3f& position, float priority = 1.f)
+		{
+			entt::entity entity = registry.create();
+			registry.emplace<Nz::NodeComponent>(entity, position);
+			registry.emplace<Nz::InterestComponent>(entity, priority);
+			return entity;
+		};
+
+		entt::entity closeEntity = CreateEntity(Nz::Vector3f(5.f, 0.f, 0.f));
+		entt::entity farEntity = CreateEntity(Nz::Vector3f(0.f, -45.f, 0.f));
+		entt::entity outOfRangeEntity = CreateEntity(Nz::Vector3f(100.f, 0.f, 0.f));
+
+		interestSystem.Update(1);
+
+		const Nz::InterestObserverComponent& observerComponent = registry.get<Nz::InterestObserverComponent>(observer);
+
+		WHEN("Updating for the first time")
+		{
+			THEN("Entities in range enter the area of interest and are updated")
+			{
+				CHECK(interestSystem.GetTrackedEntityCount() == 3);
+				CHECK(observerComponent.GetRelevantEntities().size() == 2);
+				CHECK(observerComponent.GetEnteringEntities().size() == 2);
+				CHECK(Contains(observerComponent.GetEnteringEntities(), closeEntity));
+				CHECK(Contains(observerComponent.GetEnteringEntities(), farEntity));
+				CHECK(observerComponent.GetLeavingEntities().empty());
+				CHECK(observerComponent.GetUpdatedEntities().size() == 2);
+			}
+		}
+
+		WHEN("Updating again")
+		{
+			interestSystem.Update(2);
+
+			THEN("Nothing enters nor leaves, and far entities are updated less often")
+			{
+				CHECK(observerComponent.GetEnteringEntities().empty());
+				CHECK(observerComponent.GetLeavingEntities().empty());
+				CHECK(Contains(observerComponent.GetUpdatedEntities(), closeEntity));
+				CHECK_FALSE(Contains(observerComponent.GetUpdatedEntities(), farEntity));
+			}
+
+			THEN("Far entities are eventually updated")
+			{
+				bool updated = false;
+				for (Nz::UInt32 tick = 3; tick <= 1 + interestSystem.GetMaxUpdateInterval(); ++tick)
+				{
+					interestSystem.Update(tick);
+					updated = updated || Contains(observerComponent.GetUpdatedEntities(), farEntity);
+				}
+
+				CHECK(updated);
+			}
+		}
+
+		WHEN("Increasing the priority of a far entity")
+		{
+			registry.get<Nz::InterestComponent>(farEntity).SetPriority(10.f);
+			interestSystem.Update(2);
+
+			THEN("It is updated every tick")
+			{
+				CHECK(Contains(observerComponent.GetUpdatedEntities(), farEntity));
+			}
+		}
+
+		WHEN("Entities move in and out of range")
+		{
+			registry.get<Nz::NodeComponent>(closeEntity).SetPosition(Nz::Vector3f(0.f, 0.f, 80.f));
+			registry.get<Nz::NodeComponent>(outOfRangeEntity).SetPosition(Nz::Vector3f(20.f, 0.f, 0.f));
+			interestSystem.Update(2);
+
+			THEN("Enter and leave sets are updated")
+			{
+				CHECK(observerComponent.GetEnteringEntities() == std::vector<entt::entity>{ outOfRangeEntity });
+				CHECK(observerComponent.GetLeavingEntities() == std::vector<entt::entity>{ closeEntity });
+				CHECK(observerComponent.GetRelevantEntities().size() == 2);
+			}
+		}
+
+		WHEN("An entity is destroyed")
+		{
+			registry.destroy(closeEntity);
+			interestSystem.Update(2);
+
+			THEN("It leaves the area of interest")
+			{
+				CHECK(interestSystem.GetTrackedEntityCount() == 2);
+				CHECK(observerComponent.GetLeavingEntities() == std::vector<entt::entity>{ closeEntity });
+				CHECK(observerComponent.GetRelevantEntities().size() == 1);
+			}
+		}
+
+		WHEN("Limiting the number of updated entities")
+		{
+			for (int i = 0; i < 10; ++i)
+				CreateEntity(Nz::Vector3f(0.f, 0.f, 1.f + i));
+
+			registry.get<Nz::InterestObserverComponent>(observer).SetMaxUpdatedEntities(4);
+			interestSystem.Update(2);
+
+			THEN("Entering entities are still sent in full")
+			{
+				CHECK(observerComponent.GetEnteringEntities().size() == 10);
+				CHECK(observerComponent.GetUpdatedEntities().size() == 10);
+			}
+
+			interestSystem.Update(3);
+
+			THEN("Updates are spread over several ticks")
+			{
+				CHECK(observerComponent.GetUpdatedEntities().size() == 4);
+			}
+		}
+
+		WHEN("Building the snapshot of the observer")
+		{
+			auto schema = std::make_shared<Nz::EntitySnapshotSchema>();
+			schema->AddComponent<PositionState>()
+				.AddVector3(&PositionState::position, -1000.f, 1000.f, 20);
+
+			auto CaptureWorld = [&](Nz::UInt32 tick)
+			{
+				for (auto&& [entity, node] : registry.view<Nz::NodeComponent>().each())
+					registry.emplace_or_replace<PositionState>(entity, PositionState{ node.GetPosition() });
+
+				return schema->Capture(registry, tick);
+			};
+
+			std::shared_ptr<Nz::EntitySnapshot> firstSnapshot = interestSystem.BuildSnapshot(observerComponent, *CaptureWorld(1));
+
+			THEN("It only holds relevant entities")
+			{
+				REQUIRE(firstSnapshot->GetEntityCount() == 2);
+				CHECK(firstSnapshot->FindEntity(static_cast<Nz::UInt32>(entt::to_integral(closeEntity))) != nullptr);
+				CHECK(firstSnapshot->FindEntity(static_cast<Nz::UInt32>(entt::to_integral(farEntity))) != nullptr);
+				CHECK(firstSnapshot->FindEntity(static_cast<Nz::UInt32>(entt::to_integral(outOfRangeEntity))) == nullptr);
+			}
+
+			THEN("Entities which are not updated keep their last sent state")
+			{
+				registry.get<Nz::NodeComponent>(closeEntity).Move(Nz::Vector3f(1.f, 0.f, 0.f));
+				registry.get<Nz::NodeComponent>(farEntity).Move(Nz::Vector3f(1.f, 0.f, 0.f));
+				interestSystem.Update(2);
+
+				std::shared_ptr<Nz::EntitySnapshot> worldSnapshot = CaptureWorld(2);
+				std::shared_ptr<Nz::EntitySnapshot> snapshot = interestSystem.BuildSnapshot(observerComponent, *worldSnapshot, firstSnapshot.get());
+				CHECK(snapshot->GetTick() == 2);
+				REQUIRE(snapshot->GetEntityCount() == 2);
+
+				auto GetFirstWord = [](const Nz::EntitySnapshot& sourceSnapshot, entt::entity entity)
+				{
+					const Nz::EntitySnapshot::Entity* snapshotEntity = sourceSnapshot.FindEntity(static_cast<Nz::UInt32>(entt::to_integral(entity)));
+					REQUIRE(snapshotEntity != nullptr);
+					REQUIRE(sourceSnapshot.GetWordCount(*snapshotEntity) == 3);
+					return sourceSnapshot.GetWords(*snapshotEntity)[0];
+				};
+
+				CHECK(GetFirstWord(*snapshot, closeEntity) == GetFirstWord(*worldSnapshot, closeEntity));
+				CHECK(GetFirstWord(*snapshot, farEntity) == GetFirstWord(*firstSnapshot, farEntity));
+				CHECK(GetFirstWord(*snapshot, farEntity) != GetFirstWord(*worldSnapshot, farEntity));
+			}
+		}
+	}
+}
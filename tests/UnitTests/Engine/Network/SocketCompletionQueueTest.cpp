@@ -0,0 +1,160 @@
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+
+namespace
+{
+	// Waits until the expected number of operations completed
+	std::vector<Nz::SocketCompletionQueue::Completion> WaitForCompletions(Nz::SocketCompletionQueue& queue, std::size_t expectedCount)
+	{
+		std::vector<Nz::SocketCompletionQueue::Completion> completions;
+		for (std::size_t i = 0; i < 50 && completions.size() < expectedCount; ++i)
+		{
+			queue.Wait(100);
+			for (const auto& completion : queue.GetCompletions())
+				completions.push_back(completion);
+		}
+
+		return completions;
+	}
+
+	void TestCompletionQueue(Nz::SocketCompletionBackend backend)
+	{
+		Nz::SocketCompletionQueue::Config config;
+		config.backend = backend;
+		config.bufferCount = 4;
+
+		Nz::SocketCompletionQueue queue(config);
+		if (backend == Nz::SocketCompletionBackend::Poller)
+			CHECK(queue.GetBackend() == Nz::SocketCompletionBackend::Poller);
+
+		CHECK(queue.Wait(0) == 0);
+
+		WHEN("Receiving datagrams in pooled buffers")
+		{
+			Nz::UdpSocket server(Nz::NetProtocol::IPv4);
+			REQUIRE(server.Bind(0) == Nz::SocketState::Bound);
+
+			Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort());
+
+			Nz::UdpSocket client(Nz::NetProtocol::IPv4);
+			REQUIRE(client.Bind(0) == Nz::SocketState::Bound);
+
+			REQUIRE(queue.ReceiveFromPooled(server, &server));
+			CHECK(queue.GetPendingOperationCount() == 1);
+			CHECK(queue.Wait(10) == 0);
+
+			std::array<char, 6> message = { "Hello" };
+			REQUIRE(queue.SendTo(client, serverIP, message.data(), message.size(), &client));
+
+			auto completions = WaitForCompletions(queue, 2);
+			REQUIRE(completions.size() == 2);
+			CHECK(queue.GetPendingOperationCount() == 0);
+
+			THEN("Both operations completed with their user data")
+			{
+				for (const auto& completion : completions)
+				{
+					CHECK(completion.error == Nz::SocketError::NoError);
+					CHECK(completion.transferredBytes == message.size());
+
+					if (completion.operation == Nz::SocketOperation::SendTo)
+					{
+						CHECK(completion.userdata == &client);
+						CHECK(completion.bufferIndex == Nz::SocketCompletionQueue::InvalidBufferIndex);
+					}
+					else
+					{
+						REQUIRE(completion.operation == Nz::SocketOperation::ReceiveFrom);
+						CHECK(completion.userdata == &server);
+						CHECK(completion.address.GetPort() == client.GetBoundPort());
+
+						REQUIRE(completion.bufferIndex != Nz::SocketCompletionQueue::InvalidBufferIndex);
+						CHECK(std::memcmp(queue.GetBuffer(completion.bufferIndex).data(), message.data(), message.size()) == 0);
+
+						queue.ReleaseBuffer(completion.bufferIndex);
+					}
+				}
+			}
+		}
+
+		WHEN("Every pooled buffer is in use")
+		{
+			Nz::UdpSocket server(Nz::NetProtocol::IPv4);
+			REQUIRE(server.Bind(0) == Nz::SocketState::Bound);
+
+			for (std::size_t i = 0; i < config.bufferCount; ++i)
+				REQUIRE(queue.ReceiveFromPooled(server));
+
+			THEN("Pooled receives can't be queued")
+			{
+				CHECK_FALSE(queue.ReceiveFromPooled(server));
+				CHECK(queue.GetPendingOperationCount() == config.bufferCount);
+			}
+		}
+
+		WHEN("Accepting a connection and exchanging data")
+		{
+			Nz::TcpServer server;
+			REQUIRE(server.Listen(Nz::NetProtocol::IPv4, 0) == Nz::SocketState::Bound);
+
+			Nz::TcpClient serverToClient;
+			REQUIRE(queue.Accept(server, &serverToClient));
+
+			Nz::TcpClient client;
+			client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort()));
+
+			auto completions = WaitForCompletions(queue, 1);
+			REQUIRE(completions.size() == 1);
+			CHECK(completions[0].operation == Nz::SocketOperation::Accept);
+			CHECK(completions[0].error == Nz::SocketError::NoError);
+			CHECK(serverToClient.GetState() == Nz::SocketState::Connected);
+
+			REQUIRE(client.WaitForConnected(1000) == Nz::SocketState::Connected);
+
+			std::array<char, 5> message = { "Data" };
+			std::array<char, 16> buffer;
+			REQUIRE(queue.Receive(serverToClient, buffer.data(), buffer.size()));
+			REQUIRE(queue.Send(client, message.data(), message.size()));
+
+			completions = WaitForCompletions(queue, 2);
+			REQUIRE(completions.size() == 2);
+			for (const auto& completion : completions)
+			{
+				CHECK(completion.error == Nz::SocketError::NoError);
+				CHECK(completion.transferredBytes == message.size());
+			}
+
+			CHECK(std::memcmp(buffer.data(), message.data(), message.size()) == 0);
+
+			THEN("Closing the connection completes pending receives with an error")
+			{
+				REQUIRE(queue.ReceivePooled(serverToClient));
+				client.Close();
+
+				completions = WaitForCompletions(queue, 1);
+				REQUIRE(completions.size() == 1);
+				CHECK(completions[0].operation == Nz::SocketOperation::Receive);
+				CHECK(completions[0].error == Nz::SocketError::ConnectionClosed);
+				CHECK(completions[0].bufferIndex == Nz::SocketCompletionQueue::InvalidBufferIndex);
+			}
+		}
+	}
+}
+
+SCENARIO("SocketCompletionQueue", "[NETWORK][SOCKETCOMPLETIONQUEUE]")
+{
+	GIVEN("A completion queue using the default backend (io_uring when available)")
+	{
+		TestCompletionQueue(Nz::SocketCompletionBackend::IoUring);
+	}
+
+	GIVEN("A completion queue using the poller backend")
+	{
+		TestCompletionQueue(Nz::SocketCompletionBackend::Poller);
+	}
+}
@@ -80,5 +80,62 @@ SCENARIO("SocketPoller", "[NETWORK][SOCKETPOLLER]")
 				}
 			}
 		}
+
+		WHEN("We register the server socket with user data and connect to it")
+		{
+			REQUIRE(serverPoller.RegisterSocket(server, Nz::SocketPollEvent::Read, &server));
+			CHECK(serverPoller.GetReadyEvents().empty());
+
+			Nz::SocketState state = clientToServer.Connect(serverIP);
+			CHECK(state != Nz::SocketState::NotConnected);
+
+			REQUIRE(serverPoller.Wait(1000) == 1);
+
+			THEN("The server socket is reported with its user data")
+			{
+				auto readyEvents = serverPoller.GetReadyEvents();
+				REQUIRE(readyEvents.size() == 1);
+				CHECK(readyEvents[0].userdata == &server);
+				CHECK(readyEvents[0].events & Nz::SocketPollEvent::Read);
+				CHECK_FALSE(readyEvents[0].events & Nz::SocketPollEvent::Write);
+			}
+
+			AND_WHEN("We watch the accepted client socket for both read and write events")
+			{
+				Nz::TcpClient serverToClient;
+				REQUIRE(server.AcceptClient(&serverToClient));
+
+				REQUIRE(serverPoller.RegisterSocket(serverToClient, Nz::SocketPollEvent::Read | Nz::SocketPollEvent::Write, &serverToClient));
+
+				REQUIRE(serverPoller.Wait(1000) == 1);
+				CHECK(serverPoller.IsReadyToWrite(serverToClient));
+				CHECK_FALSE(serverPoller.IsReadyToRead(serverToClient));
+				CHECK_FALSE(serverPoller.IsReadyToRead(server));
+
+				THEN("Modifying the socket to only watch read events stops reporting it until data is received")
+				{
+					REQUIRE(serverPoller.ModifySocket(serverToClient, Nz::SocketPollEvent::Read));
+
+					REQUIRE_FALSE(serverPoller.Wait(100));
+					CHECK(serverPoller.GetReadyEvents().empty());
+					CHECK_FALSE(serverPoller.IsReadyToWrite(serverToClient));
+
+					std::array<char, 5> buffer = {"Data"};
+
+					std::size_t sent;
+					REQUIRE(clientToServer.Send(buffer.data(), buffer.size(), &sent));
+					REQUIRE(sent == buffer.size());
+
+					REQUIRE(serverPoller.Wait(1000) == 1);
+
+					auto readyEvents = serverPoller.GetReadyEvents();
+					REQUIRE(readyEvents.size() == 1);
+					CHECK(readyEvents[0].userdata == &serverToClient);
+					CHECK(readyEvents[0].events & Nz::SocketPollEvent::Read);
+					CHECK_FALSE(readyEvents[0].events & Nz::SocketPollEvent::Write);
+					CHECK(serverPoller.IsReadyToRead(serverToClient));
+				}
+			}
+		}
  	}
 }
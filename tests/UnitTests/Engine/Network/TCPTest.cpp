@@ -5,7 +5,10 @@
 #include <Nazara/Network/TcpServer.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 SCENARIO("TCP", "[NETWORK][TCP]")
@@ -70,5 +73,78 @@ SCENARIO("TCP", "[NETWORK][TCP]")
 				CHECK(result == vector123);
 			}
 		}
+
+		WHEN("We exchange framed messages")
+		{
+			for (Nz::MessageLengthPrefix lengthPrefix : { Nz::MessageLengthPrefix::UInt16, Nz::MessageLengthPrefix::UInt32, Nz::MessageLengthPrefix::VarInt })
+			{
+				Nz::TcpClient::FramingConfig config;
+				config.bufferPool = std::make_shared<Nz::ByteArrayPool>();
+				config.corkThreshold = 1024;
+				config.lengthPrefix = lengthPrefix;
+				config.receiveBufferSize = 256;
+				config.sendChunkSize = 128;
+
+				client.EnableFraming(config);
+				serverToClient.EnableFraming(config);
+				CHECK(client.IsFramingEnabled());
+
+				// Messages smaller than, crossing and exceeding the receive buffer
+				std::vector<Nz::ByteArray> messages;
+				for (std::size_t size : { 0, 5, 200, 300, 5000 })
+				{
+					Nz::ByteArray& message = messages.emplace_back(size);
+					for (std::size_t i = 0; i < size; ++i)
+						message[i] = static_cast<Nz::UInt8>(i * 7 + size);
+				}
+
+				REQUIRE(client.QueueMessage(messages[0].GetConstBuffer(), messages[0].GetSize()));
+				REQUIRE(client.QueueMessage(messages[1].GetConstBuffer(), messages[1].GetSize()));
+				REQUIRE(client.QueueMessage(messages[2].GetConstBuffer(), messages[2].GetSize()));
+				CHECK(client.GetQueuedMessageSize() > 0); //< below cork threshold
+
+				Nz::ByteArray zeroCopyMessage = client.AcquireMessageBuffer(messages[3].GetSize());
+				std::memcpy(zeroCopyMessage.GetBuffer(), messages[3].GetConstBuffer(), messages[3].GetSize());
+				REQUIRE(client.QueueMessage(std::move(zeroCopyMessage)));
+				REQUIRE(client.QueueMessage(messages[4].GetConstBuffer(), messages[4].GetSize())); //< over cork threshold, flushes
+
+				REQUIRE(client.FlushMessages());
+				CHECK(client.GetQueuedMessageSize() == 0);
+
+				// Every message should be received whole and in order
+				for (const Nz::ByteArray& expectedMessage : messages)
+				{
+					std::span<const Nz::UInt8> message;
+					REQUIRE(serverToClient.ReceiveMessage(&message));
+					REQUIRE(message.size() == expectedMessage.GetSize());
+					CHECK(std::equal(message.begin(), message.end(), expectedMessage.begin()));
+				}
+
+				client.DisableFraming();
+				serverToClient.DisableFraming();
+				CHECK_FALSE(client.IsFramingEnabled());
+			}
+		}
+
+		WHEN("We receive a framed message bigger than allowed")
+		{
+			Nz::TcpClient::FramingConfig config;
+			client.EnableFraming(config);
+
+			config.maxMessageSize = 64;
+			serverToClient.EnableFraming(config);
+
+			std::array<Nz::UInt8, 100> message = {};
+			REQUIRE(client.QueueMessage(message.data(), message.size()));
+			REQUIRE(client.FlushMessages());
+
+			THEN("The connection is closed")
+			{
+				std::span<const Nz::UInt8> receivedMessage;
+				CHECK_FALSE(serverToClient.ReceiveMessage(&receivedMessage));
+				CHECK(serverToClient.GetLastError() == Nz::SocketError::Packet);
+				CHECK(serverToClient.GetState() == Nz::SocketState::NotConnected);
+			}
+		}
 	}
 }
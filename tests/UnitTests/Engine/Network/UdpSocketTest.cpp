@@ -42,4 +42,37 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 			}
 		}
 	}
+
+#ifndef NAZARA_PLATFORM_WINDOWS
+	GIVEN("Two UdpSocket sharing the same port")
+	{
+		Nz::UdpSocket first(Nz::NetProtocol::IPv4);
+		CHECK_FALSE(first.IsReusePortEnabled());
+		REQUIRE(first.EnableReusePort(true));
+		REQUIRE(first.Bind(0) == Nz::SocketState::Bound);
+
+		Nz::UInt16 port = first.GetBoundPort();
+
+		WHEN("The second socket enables port sharing")
+		{
+			Nz::UdpSocket second(Nz::NetProtocol::IPv4);
+			REQUIRE(second.EnableReusePort(true));
+
+			THEN("Both sockets can bind the port")
+			{
+				CHECK(second.Bind(port) == Nz::SocketState::Bound);
+			}
+		}
+
+		WHEN("The second socket doesn't enable port sharing")
+		{
+			Nz::UdpSocket second(Nz::NetProtocol::IPv4);
+
+			THEN("It cannot bind the port")
+			{
+				CHECK(second.Bind(port) != Nz::SocketState::Bound);
+			}
+		}
+	}
+#endif
 }
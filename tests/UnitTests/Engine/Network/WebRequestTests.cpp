@@ -1,10 +1,124 @@
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
 #include <Nazara/Network/WebRequest.hpp>
 #include <Nazara/Network/WebService.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
+
+namespace
+{
+	// Minimal keep-alive HTTP server answering every request with the same body
+	class LocalHttpServer
+	{
+		public:
+			LocalHttpServer() :
+			m_connectionCount(0),
+			m_running(true)
+			{
+				m_server.EnableBlocking(false);
+				m_server.Listen(Nz::NetProtocol::IPv4, 0);
+
+				m_thread = std::thread([this] { Run(); });
+			}
+
+			~LocalHttpServer()
+			{
+				m_running = false;
+				m_thread.join();
+			}
+
+			std::size_t GetConnectionCount() const
+			{
+				return m_connectionCount;
+			}
+
+			std::string GetURL() const
+			{
+				return "http://127.0.0.1:" + std::to_string(m_server.GetBoundPort()) + "/";
+			}
+
+			static constexpr std::string_view Body = "Hello Nazara from a local server!";
+
+		private:
+			struct Connection
+			{
+				Nz::TcpClient socket;
+				std::string pendingData;
+			};
+
+			void Run()
+			{
+				std::vector<std::unique_ptr<Connection>> connections;
+
+				Nz::SocketPoller poller;
+				poller.RegisterSocket(m_server, Nz::SocketPollEvent::Read);
+
+				while (m_running)
+				{
+					poller.Wait(10);
+					for (const auto& readyEvent : poller.GetReadyEvents())
+					{
+						if (!readyEvent.userdata)
+						{
+							auto connection = std::make_unique<Connection>();
+							while (m_server.AcceptClient(&connection->socket))
+							{
+								m_connectionCount++;
+
+								connection->socket.EnableBlocking(false);
+								poller.RegisterSocket(connection->socket, Nz::SocketPollEvent::Read, connection.get());
+								connections.push_back(std::move(connection));
+
+								connection = std::make_unique<Connection>();
+							}
+
+							continue;
+						}
+
+						Connection& connection = *static_cast<Connection*>(readyEvent.userdata);
+
+						std::array<char, 4096> buffer;
+						std::size_t received;
+						if (!connection.socket.Receive(buffer.data(), buffer.size(), &received))
+						{
+							if (poller.IsRegistered(connection.socket))
+								poller.UnregisterSocket(connection.socket);
+
+							continue;
+						}
+
+						connection.pendingData.append(buffer.data(), received);
+
+						std::size_t headerEnd;
+						while ((headerEnd = connection.pendingData.find("\r\n\r\n")) != std::string::npos)
+						{
+							connection.pendingData.erase(0, headerEnd + 4);
+
+							std::string response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(Body.size()) + "\r\n\r\n";
+							response.append(Body);
+
+							connection.socket.Send(response.data(), response.size(), nullptr);
+						}
+					}
+				}
+			}
+
+			std::atomic_size_t m_connectionCount;
+			std::atomic_bool m_running;
+			std::thread m_thread;
+			Nz::TcpServer m_server;
+	};
+}
 
 SCENARIO("WebService", "[NETWORK][WebService]")
 {
@@ -74,3 +188,76 @@ SCENARIO("WebService", "[NETWORK][WebService]")
 		WaitForRequest();
 	}
 }
+
+SCENARIO("WebService driven by socket events", "[NETWORK][WebService]")
+{
+	LocalHttpServer server;
+
+	std::unique_ptr<Nz::WebService> webService = Nz::Network::Instance()->InstantiateWebService(Nz::WebServicePollMode::SocketEvents);
+	REQUIRE(webService->GetPollMode() == Nz::WebServicePollMode::SocketEvents);
+
+	GIVEN("Many concurrent requests to a host limited to two connections")
+	{
+		webService->SetMaxHostConnections(2);
+
+		constexpr std::size_t RequestCount = 32;
+
+		std::size_t failedRequests = 0;
+		std::size_t succeededRequests = 0;
+		auto QueueRequests = [&]
+		{
+			for (std::size_t i = 0; i < RequestCount; ++i)
+			{
+				webService->QueueRequest(webService->CreateGetRequest(server.GetURL(), [&](Nz::WebRequestResult&& result)
+				{
+					if (result && result.GetStatusCode() == 200 && result.GetBody() == LocalHttpServer::Body)
+						succeededRequests++;
+					else
+						failedRequests++;
+				}));
+			}
+		};
+
+		auto WaitForRequests = [&](std::size_t expectedCount)
+		{
+			Nz::MillisecondClock clock;
+			while (succeededRequests + failedRequests < expectedCount && clock.GetElapsedTime() < Nz::Time::Seconds(5))
+				webService->Poll(100);
+		};
+
+		WHEN("We run them")
+		{
+			QueueRequests();
+			WaitForRequests(RequestCount);
+
+			THEN("They all succeed over kept-alive connections")
+			{
+				CHECK(succeededRequests == RequestCount);
+				CHECK(failedRequests == 0);
+				CHECK(server.GetConnectionCount() <= 2);
+			}
+
+			AND_WHEN("We run them again")
+			{
+				QueueRequests();
+				WaitForRequests(RequestCount * 2);
+
+				THEN("Connections are reused")
+				{
+					CHECK(succeededRequests == RequestCount * 2);
+					CHECK(server.GetConnectionCount() <= 2);
+				}
+			}
+		}
+	}
+
+	GIVEN("No request")
+	{
+		THEN("Polling returns without waiting")
+		{
+			Nz::MillisecondClock clock;
+			CHECK_FALSE(webService->Poll(1000));
+			CHECK(clock.GetElapsedTime() < Nz::Time::Milliseconds(500));
+		}
+	}
+}
@@ -0,0 +1,150 @@
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/TextRenderer/Font.hpp>
+#include <Nazara/TextRenderer/SimpleTextDrawer.hpp>
+#include <NazaraUtils/CallOnExit.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+
+SCENARIO("Distance field fonts", "[TextRenderer][Font][DistanceField]")
+{
+	std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+
+	std::shared_ptr<Nz::GuillotineImageAtlas> imageAtlas = std::make_shared<Nz::GuillotineImageAtlas>();
+	imageAtlas->SetMaxLayerSize(1024);
+
+	font->SetAtlas(imageAtlas);
+
+	// The default font is shared with other tests
+	Nz::CallOnExit resetFont([&]
+	{
+		font->SetGlyphMode(Nz::FontGlyphMode::Bitmap);
+	});
+
+	constexpr std::array<unsigned int, 4> characterSizes = { 12, 24, 48, 72 };
+
+	GIVEN("A font using bitmap glyphs")
+	{
+		REQUIRE(font->GetGlyphMode() == Nz::FontGlyphMode::Bitmap);
+		CHECK(font->GetGlyphScale(72) == Catch::Approx(1.f));
+
+		WHEN("Using multiple character sizes")
+		{
+			for (unsigned int characterSize : characterSizes)
+				CHECK(font->Precache(characterSize, Nz::TextStyle_Regular, 0.f, "ABC"));
+
+			THEN("Each size has its own glyphs")
+			{
+				CHECK(font->GetCachedGlyphCount() == characterSizes.size() * 3);
+				for (unsigned int characterSize : characterSizes)
+					CHECK(font->GetCachedGlyphCount(characterSize, Nz::TextStyle_Regular, 0.f) == 3);
+			}
+		}
+	}
+
+	GIVEN("A font using distance field glyphs")
+	{
+		font->SetGlyphMode(Nz::FontGlyphMode::DistanceField);
+
+		const Nz::Font::DistanceFieldParams& params = font->GetDistanceFieldParams();
+
+		WHEN("Using multiple character sizes and outlines")
+		{
+			for (unsigned int characterSize : characterSizes)
+			{
+				CHECK(font->Precache(characterSize, Nz::TextStyle_Regular, 0.f, "ABC"));
+				CHECK(font->Precache(characterSize, Nz::TextStyle_Regular, 2.f, "ABC"));
+			}
+
+			THEN("Glyphs are shared between every size")
+			{
+				CHECK(font->GetCachedGlyphCount() == 3);
+				for (unsigned int characterSize : characterSizes)
+					CHECK(font->GetCachedGlyphCount(characterSize, Nz::TextStyle_Regular, 0.f) == 3);
+			}
+		}
+
+		WHEN("Inspecting a glyph")
+		{
+			// Changing the glyph mode clears the glyph cache, keep a copy
+			Nz::Font::Glyph glyph = font->GetGlyph(24, Nz::TextStyle_Regular, 0.f, 'I');
+			REQUIRE(glyph.valid);
+
+			font->SetGlyphMode(Nz::FontGlyphMode::Bitmap);
+
+			const Nz::Font::Glyph& bitmapGlyph = font->GetGlyph(params.glyphSize, Nz::TextStyle_Regular, 0.f, 'I');
+			REQUIRE(bitmapGlyph.valid);
+
+			THEN("It is padded by the spread on each side")
+			{
+				CHECK(glyph.aabb.width >= bitmapGlyph.aabb.width + int(params.spread * 2) - 1);
+				CHECK(glyph.aabb.height >= bitmapGlyph.aabb.height + int(params.spread * 2) - 1);
+				CHECK(glyph.aabb.width <= bitmapGlyph.aabb.width + int(params.spread * 2) + 2);
+				CHECK(glyph.aabb.height <= bitmapGlyph.aabb.height + int(params.spread * 2) + 2);
+			}
+		}
+
+		WHEN("Inspecting distance values")
+		{
+			const Nz::Font::Glyph& glyph = font->GetGlyph(params.glyphSize, Nz::TextStyle_Regular, 0.f, 'I');
+			REQUIRE(glyph.valid);
+
+			const Nz::Image* layer = static_cast<const Nz::Image*>(imageAtlas->GetLayer(glyph.layerIndex));
+			REQUIRE(layer->GetFormat() == Nz::PixelFormat::A8);
+
+			Nz::Vector2ui center = Nz::Vector2ui(glyph.atlasRect.GetCenter());
+
+			THEN("Values are high inside the glyph and low outside of it")
+			{
+				// The center of 'I' lies in its stem while the corners of the glyph are in the padding
+				CHECK(*layer->GetConstPixels(center.x, center.y) > 140);
+				CHECK(*layer->GetConstPixels(glyph.atlasRect.x, glyph.atlasRect.y) < 16);
+				CHECK(*layer->GetConstPixels(glyph.atlasRect.x + glyph.atlasRect.width - 1, glyph.atlasRect.y + glyph.atlasRect.height - 1) < 16);
+			}
+		}
+
+		WHEN("Drawing text")
+		{
+			Nz::SimpleTextDrawer smallDrawer = Nz::SimpleTextDrawer::Draw(font, "Nazara", 24);
+			Nz::SimpleTextDrawer bigDrawer = Nz::SimpleTextDrawer::Draw(font, "Nazara", 72);
+
+			THEN("Glyphs are scaled to the character size")
+			{
+				REQUIRE(smallDrawer.GetGlyphCount() == bigDrawer.GetGlyphCount());
+				CHECK(font->GetCachedGlyphCount() == 4); //< N, a, z and r
+
+				for (std::size_t i = 0; i < smallDrawer.GetGlyphCount(); ++i)
+				{
+					const Nz::AbstractTextDrawer::Glyph& smallGlyph = smallDrawer.GetGlyph(i);
+					const Nz::AbstractTextDrawer::Glyph& bigGlyph = bigDrawer.GetGlyph(i);
+
+					CHECK(bigGlyph.bounds.width == Catch::Approx(smallGlyph.bounds.width * 3.f));
+					CHECK(bigGlyph.bounds.height == Catch::Approx(smallGlyph.bounds.height * 3.f));
+					CHECK(bigGlyph.atlasRect == smallGlyph.atlasRect);
+				}
+			}
+		}
+
+		WHEN("Drawing outlined text")
+		{
+			Nz::SimpleTextDrawer drawer = Nz::SimpleTextDrawer::Draw(font, "A", 24, Nz::TextStyle_Regular, Nz::Color::White(), 2.f, Nz::Color::Black());
+
+			THEN("The outline uses the same glyph with a lower edge")
+			{
+				REQUIRE(drawer.GetGlyphCount() == 2);
+				CHECK(font->GetCachedGlyphCount() == 1);
+
+				const Nz::AbstractTextDrawer::Glyph& firstGlyph = drawer.GetGlyph(0);
+				const Nz::AbstractTextDrawer::Glyph& secondGlyph = drawer.GetGlyph(1);
+				const Nz::AbstractTextDrawer::Glyph& outlineGlyph = (firstGlyph.renderOrder < secondGlyph.renderOrder) ? firstGlyph : secondGlyph;
+				const Nz::AbstractTextDrawer::Glyph& fillGlyph = (firstGlyph.renderOrder < secondGlyph.renderOrder) ? secondGlyph : firstGlyph;
+
+				CHECK(fillGlyph.distanceFieldEdge == Catch::Approx(0.5f));
+				CHECK(outlineGlyph.distanceFieldEdge < fillGlyph.distanceFieldEdge);
+				CHECK(outlineGlyph.atlasRect == fillGlyph.atlasRect);
+				CHECK(outlineGlyph.corners[0] == fillGlyph.corners[0]);
+			}
+		}
+	}
+}
@@ -0,0 +1,90 @@
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/TextRenderer/Font.hpp>
+#include <Nazara/TextRenderer/FontGlyph.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <unordered_map>
+
+SCENARIO("Font precaching", "[TextRenderer][Font][Precache]")
+{
+	std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+
+	std::shared_ptr<Nz::GuillotineImageAtlas> imageAtlas = std::make_shared<Nz::GuillotineImageAtlas>();
+	imageAtlas->SetMaxLayerSize(1024);
+
+	font->SetAtlas(imageAtlas);
+
+	std::string characterSet;
+	for (char c = '!'; c <= '~'; ++c)
+		characterSet += c;
+
+	characterSet += "àâäçéèêëîïôöùûüÿÀÂÄÇÉÈÊËÎÏÔÖÙÛÜ";
+
+	auto CheckGlyphPixels = [&](const Nz::Font::Glyph& glyph, unsigned int characterSize, float outlineThickness, char32_t character)
+	{
+		Nz::FontGlyph fontGlyph;
+		REQUIRE(font->ExtractGlyph(characterSize, character, Nz::TextStyle_Regular, outlineThickness, &fontGlyph));
+		if (!fontGlyph.image.IsValid())
+			return;
+
+		const Nz::Image& layer = static_cast<const Nz::Image&>(*imageAtlas->GetLayer(glyph.layerIndex));
+
+		unsigned int width = fontGlyph.image.GetWidth();
+		unsigned int height = fontGlyph.image.GetHeight();
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			for (unsigned int x = 0; x < width; ++x)
+			{
+				Nz::Vector2ui atlasPos = (glyph.flipped) ? Nz::Vector2ui(glyph.atlasRect.x + y, glyph.atlasRect.y + width - x - 1) : Nz::Vector2ui(glyph.atlasRect.x + x, glyph.atlasRect.y + y);
+				if (*layer.GetConstPixels(atlasPos.x, atlasPos.y) != *fontGlyph.image.GetConstPixels(x, y))
+				{
+					FAIL("glyph pixel mismatch at " << x << ", " << y);
+					return;
+				}
+			}
+		}
+	};
+
+	for (float outlineThickness : { 0.f, 2.f })
+	{
+		GIVEN("A character set precached sequentially and in parallel (outline thickness: " + std::to_string(outlineThickness) + ")")
+		{
+			constexpr unsigned int characterSize = 32;
+
+			std::unordered_map<char32_t, Nz::Font::Glyph> sequentialGlyphs;
+
+			REQUIRE(font->Precache(characterSize, Nz::TextStyle_Regular, outlineThickness, characterSet));
+			std::size_t glyphCount = font->GetCachedGlyphCount(characterSize, Nz::TextStyle_Regular, outlineThickness);
+
+			for (char32_t character : Nz::ToUtf32String(characterSet))
+				sequentialGlyphs[character] = font->GetGlyph(characterSize, Nz::TextStyle_Regular, outlineThickness, character);
+
+			font->ClearGlyphCache();
+
+			Nz::TaskScheduler taskScheduler(4);
+			REQUIRE(font->Precache(characterSize, Nz::TextStyle_Regular, outlineThickness, characterSet, &taskScheduler));
+
+			THEN("The same glyphs are cached")
+			{
+				CHECK(font->GetCachedGlyphCount(characterSize, Nz::TextStyle_Regular, outlineThickness) == glyphCount);
+
+				for (auto&& [character, sequentialGlyph] : sequentialGlyphs)
+				{
+					const Nz::Font::Glyph& glyph = font->GetGlyph(characterSize, Nz::TextStyle_Regular, outlineThickness, character);
+					REQUIRE(glyph.valid == sequentialGlyph.valid);
+					if (!glyph.valid)
+						continue;
+
+					CHECK(glyph.aabb == sequentialGlyph.aabb);
+					CHECK(glyph.advance == sequentialGlyph.advance);
+					CHECK(glyph.atlasRect.width * glyph.atlasRect.height == sequentialGlyph.atlasRect.width * sequentialGlyph.atlasRect.height);
+
+					CheckGlyphPixels(glyph, characterSize, outlineThickness, character);
+				}
+			}
+		}
+	}
+}
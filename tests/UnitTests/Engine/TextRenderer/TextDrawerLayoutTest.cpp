@@ -0,0 +1,192 @@
+#include <Nazara/Core/GuillotineImageAtlas.hpp>
+#include <Nazara/TextRenderer/Font.hpp>
+#include <Nazara/TextRenderer/RichTextDrawer.hpp>
+#include <Nazara/TextRenderer/SimpleTextDrawer.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+namespace
+{
+	void CheckRect(const Nz::Rectf& lhs, const Nz::Rectf& rhs)
+	{
+		CHECK(lhs.x == Catch::Approx(rhs.x));
+		CHECK(lhs.y == Catch::Approx(rhs.y));
+		CHECK(lhs.width == Catch::Approx(rhs.width));
+		CHECK(lhs.height == Catch::Approx(rhs.height));
+	}
+
+	void CheckSameLayout(const Nz::AbstractTextDrawer& drawer, const Nz::AbstractTextDrawer& referenceDrawer)
+	{
+		REQUIRE(drawer.GetGlyphCount() == referenceDrawer.GetGlyphCount());
+		REQUIRE(drawer.GetLineCount() == referenceDrawer.GetLineCount());
+
+		CheckRect(drawer.GetBounds(), referenceDrawer.GetBounds());
+
+		for (std::size_t i = 0; i < drawer.GetLineCount(); ++i)
+		{
+			const Nz::AbstractTextDrawer::Line& line = drawer.GetLine(i);
+			const Nz::AbstractTextDrawer::Line& referenceLine = referenceDrawer.GetLine(i);
+
+			CHECK(line.glyphIndex == referenceLine.glyphIndex);
+			CheckRect(line.bounds, referenceLine.bounds);
+		}
+
+		for (std::size_t i = 0; i < drawer.GetGlyphCount(); ++i)
+		{
+			const Nz::AbstractTextDrawer::Glyph& glyph = drawer.GetGlyph(i);
+			const Nz::AbstractTextDrawer::Glyph& referenceGlyph = referenceDrawer.GetGlyph(i);
+
+			CHECK(glyph.atlas == referenceGlyph.atlas);
+			CHECK(glyph.atlasRect == referenceGlyph.atlasRect);
+			CHECK(glyph.color == referenceGlyph.color);
+			CHECK(glyph.renderOrder == referenceGlyph.renderOrder);
+			CheckRect(glyph.bounds, referenceGlyph.bounds);
+		}
+	}
+}
+
+SCENARIO("Text drawers incremental layout", "[TextRenderer][SimpleTextDrawer][RichTextDrawer]")
+{
+	std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+
+	std::shared_ptr<Nz::GuillotineImageAtlas> imageAtlas = std::make_shared<Nz::GuillotineImageAtlas>();
+	imageAtlas->SetMaxLayerSize(1024);
+
+	font->SetAtlas(imageAtlas);
+
+	std::string text = "The quick brown fox\njumps over the lazy dog and keeps running until the end of the line\n\nThe end";
+
+	GIVEN("A simple text drawer with word wrapping")
+	{
+		auto CreateDrawer = [&](const std::string& str)
+		{
+			Nz::SimpleTextDrawer drawer;
+			drawer.SetTextFont(font);
+			drawer.SetMaxLineWidth(200.f);
+			drawer.SetText(str);
+
+			return drawer;
+		};
+
+		Nz::SimpleTextDrawer drawer = CreateDrawer(text);
+		REQUIRE(drawer.GetLineCount() > 4); //< lays out the text
+
+		WHEN("Appending text")
+		{
+			drawer.AppendText("\nA new line which is long enough to be wrapped");
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				CheckSameLayout(drawer, CreateDrawer(drawer.GetText()));
+			}
+		}
+
+		WHEN("Modifying a line in the middle of the text")
+		{
+			std::string newText = text;
+			newText.replace(newText.find("lazy"), 4, "very lazy");
+			drawer.SetText(newText);
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				CheckSameLayout(drawer, CreateDrawer(newText));
+			}
+		}
+
+		WHEN("Removing the end of the text right after a line feed")
+		{
+			std::string newText = text.substr(0, text.find('\n') + 1);
+			drawer.SetText(newText);
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				CheckSameLayout(drawer, CreateDrawer(newText));
+			}
+		}
+
+		WHEN("Modifying the text multiple times before its layout is used")
+		{
+			drawer.SetText(text + "\nFirst edit");
+			drawer.SetText("Second edit\n" + text);
+			drawer.AppendText(" and the end");
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				CheckSameLayout(drawer, CreateDrawer(drawer.GetText()));
+			}
+		}
+
+		WHEN("Changing the text color before appending text")
+		{
+			drawer.SetTextColor(Nz::Color::Red());
+			drawer.AppendText("\nRed text");
+
+			THEN("Every glyph uses the new color")
+			{
+				Nz::SimpleTextDrawer referenceDrawer = CreateDrawer(drawer.GetText());
+				referenceDrawer.SetTextColor(Nz::Color::Red());
+
+				CheckSameLayout(drawer, referenceDrawer);
+			}
+		}
+	}
+
+	GIVEN("A rich text drawer with multiple blocks")
+	{
+		auto CreateDrawer = [&](const std::string& firstBlock, const std::string& secondBlock)
+		{
+			Nz::RichTextDrawer drawer;
+			drawer.SetMaxLineWidth(200.f);
+			drawer.SetTextFont(font);
+			drawer.AppendText(firstBlock);
+			drawer.SetCharacterSize(32);
+			drawer.SetTextColor(Nz::Color::Red());
+			drawer.AppendText(secondBlock);
+
+			return drawer;
+		};
+
+		std::string secondBlock = "Second block\nwith a few lines\nof text";
+
+		Nz::RichTextDrawer drawer = CreateDrawer(text, secondBlock);
+		REQUIRE(drawer.GetBlockCount() == 2);
+		REQUIRE(drawer.GetLineCount() > 6); //< lays out the text
+
+		WHEN("Appending text to the last block")
+		{
+			drawer.AppendText(" and more\nlines");
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				REQUIRE(drawer.GetBlockCount() == 2);
+				CheckSameLayout(drawer, CreateDrawer(text, secondBlock + " and more\nlines"));
+			}
+		}
+
+		WHEN("Modifying the text of the first block")
+		{
+			std::string newText = text;
+			newText.replace(newText.find("lazy"), 4, "very lazy");
+			drawer.SetBlockText(0, newText);
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				CheckSameLayout(drawer, CreateDrawer(newText, secondBlock));
+			}
+		}
+
+		WHEN("Changing the properties of the second block")
+		{
+			drawer.SetBlockCharacterSize(1, 16);
+
+			THEN("Layout is the same as laying out the whole text")
+			{
+				Nz::RichTextDrawer referenceDrawer = CreateDrawer(text, secondBlock);
+				referenceDrawer.SetBlockCharacterSize(1, 16);
+
+				CheckSameLayout(drawer, referenceDrawer);
+			}
+		}
+	}
+}
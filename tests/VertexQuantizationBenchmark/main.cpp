@@ -0,0 +1,91 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Core/SubMesh.hpp>
+#include <Nazara/Core/VertexMapper.hpp>
+#include <Nazara/Core/VertexStruct.hpp>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << "Initializing..." << std::endl;
+
+	constexpr Nz::UInt32 vertexCount = 1'000'000;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_real_distribution<float> posDis(-100.f, 100.f);
+	std::uniform_real_distribution<float> uvDis(0.f, 1.f);
+	std::normal_distribution<float> normalDis;
+
+	std::vector<Nz::Vector3f> positions(vertexCount);
+	std::vector<Nz::Vector3f> normals(vertexCount);
+	std::vector<Nz::Vector2f> texCoords(vertexCount);
+	for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+	{
+		positions[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine));
+		normals[i] = Nz::Vector3f(normalDis(randEngine), normalDis(randEngine), normalDis(randEngine)).GetNormal();
+		texCoords[i] = Nz::Vector2f(uvDis(randEngine), uvDis(randEngine));
+	}
+
+	std::vector<Nz::Vector4i16> quantizedPositions(vertexCount);
+	std::vector<Nz::Vector2i16> quantizedNormals(vertexCount);
+	std::vector<Nz::Vector2ui16> quantizedTexCoords(vertexCount);
+
+	std::vector<Nz::Vector3f> decodedPositions(vertexCount);
+	std::vector<Nz::Vector3f> decodedNormals(vertexCount);
+	std::vector<Nz::Vector2f> decodedTexCoords(vertexCount);
+
+	auto Measure = [&](const char* name, auto&& func)
+	{
+		Nz::Time t1 = Nz::GetElapsedNanoseconds();
+		func();
+		Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+		double verticesPerSecond = double(vertexCount) / (t2 - t1).AsSeconds<double>();
+		std::cout << name << ": " << (t2 - t1) << " (" << verticesPerSecond / 1'000'000.0 << "M vertices/s)" << std::endl;
+	};
+
+	Nz::PositionQuantization quantization = Nz::ComputePositionQuantization(Nz::ComputeAABB(positions.data(), vertexCount));
+
+	Measure("quantize positions", [&] { Nz::QuantizePositions(positions.data(), vertexCount, quantization, quantizedPositions.data()); });
+	Measure("quantize normals", [&] { Nz::QuantizeNormals(normals.data(), vertexCount, quantizedNormals.data()); });
+	Measure("quantize texcoords", [&] { Nz::QuantizeTexCoords(texCoords.data(), vertexCount, quantizedTexCoords.data()); });
+
+	Measure("dequantize positions", [&] { Nz::DequantizePositions(quantizedPositions.data(), vertexCount, quantization, decodedPositions.data()); });
+	Measure("dequantize normals", [&] { Nz::DequantizeNormals(quantizedNormals.data(), vertexCount, decodedNormals.data()); });
+	Measure("dequantize texcoords", [&] { Nz::DequantizeTexCoords(quantizedTexCoords.data(), vertexCount, decodedTexCoords.data()); });
+
+	float maxPositionError = 0.f;
+	float maxNormalError = 0.f;
+	float maxTexCoordError = 0.f;
+	for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+	{
+		maxPositionError = std::max(maxPositionError, (decodedPositions[i] - positions[i]).GetLength());
+		maxNormalError = std::max(maxNormalError, (decodedNormals[i] - normals[i]).GetLength());
+		maxTexCoordError = std::max(maxTexCoordError, (decodedTexCoords[i] - texCoords[i]).GetLength());
+	}
+
+	std::cout << "max position error: " << maxPositionError << ", max normal error: " << maxNormalError << ", max texcoord error: " << maxTexCoordError << std::endl;
+
+	// Load-time conversion through the mesh builder
+	Nz::MeshParams params;
+	params.optimizeIndexBuffers = false;
+
+	Nz::Time t1 = Nz::GetElapsedNanoseconds();
+	std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(Nz::Primitive::UVSphere(1.f, 1000, 1000), params);
+	Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+	params.vertexDeclaration = Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_Normal_UV_Tangent_Quantized);
+	std::shared_ptr<Nz::Mesh> quantizedMesh = Nz::Mesh::Build(Nz::Primitive::UVSphere(1.f, 1000, 1000), params);
+	Nz::Time t3 = Nz::GetElapsedNanoseconds();
+
+	std::cout << "mesh build: " << (t2 - t1) << " (full precision, " << mesh->GetSubMesh(0)->GetVertexCount() * sizeof(Nz::VertexStruct_XYZ_Normal_UV_Tangent) / 1024 << "KiB), ";
+	std::cout << (t3 - t2) << " (quantized, " << quantizedMesh->GetSubMesh(0)->GetVertexCount() * sizeof(Nz::VertexStruct_XYZ_Normal_UV_Tangent_Quantized) / 1024 << "KiB)" << std::endl;
+}
@@ -0,0 +1,3 @@
+target("VertexQuantizationBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
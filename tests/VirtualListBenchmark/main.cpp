@@ -0,0 +1,110 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Platform/WindowEventHandler.hpp>
+#include <Nazara/TextRenderer/SimpleTextDrawer.hpp>
+#include <Nazara/Widgets/Canvas.hpp>
+#include <Nazara/Widgets/LabelWidget.hpp>
+#include <Nazara/Widgets/ScrollAreaWidget.hpp>
+#include <Nazara/Widgets/VirtualListWidget.hpp>
+#include <Nazara/Widgets/Widgets.hpp>
+#include <entt/entity/registry.hpp>
+#include <iostream>
+#include <string>
+
+int main()
+{
+	Nz::Modules<Nz::Widgets> widgets;
+
+	std::cout << "Initializing..." << std::endl;
+
+	entt::registry registry;
+	Nz::WindowEventHandler eventHandler;
+
+	Nz::Canvas canvas(registry, eventHandler, {}, 0xFFFFFFFF);
+	canvas.EnableDeferredLayout();
+	canvas.Resize({ 1920.f, 1080.f });
+
+	// A log window holding 1M entries
+	constexpr std::size_t itemCount = 1'000'000;
+
+	std::size_t createdWidgetCount = 0;
+	std::size_t updatedItemCount = 0;
+
+	Nz::VirtualListWidget* list = canvas.Add<Nz::VirtualListWidget>([&](Nz::VirtualListWidget* listWidget) -> Nz::BaseWidget*
+	{
+		createdWidgetCount++;
+		return listWidget->Add<Nz::LabelWidget>();
+	},
+	[&](Nz::BaseWidget* item, std::size_t itemIndex)
+	{
+		updatedItemCount++;
+		static_cast<Nz::LabelWidget*>(item)->UpdateText(Nz::SimpleTextDrawer::Draw("[12:34:56] Log entry #" + std::to_string(itemIndex), 18));
+	});
+
+	Nz::ScrollAreaWidget* scrollArea = canvas.Add<Nz::ScrollAreaWidget>(list);
+	scrollArea->Resize({ 800.f, 1000.f });
+
+	auto Measure = [&](const char* name, std::size_t count, auto&& func)
+	{
+		createdWidgetCount = 0;
+		updatedItemCount = 0;
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			func(i);
+			canvas.UpdateLayout();
+		}
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		std::cout << name << ": " << Nz::Time::Nanoseconds((end - start).AsNanoseconds() / count) << " per frame, " << createdWidgetCount << " widgets created, " << updatedItemCount << " items updated (" << list->GetItemWidgetCount() << " item widgets alive)" << std::endl;
+	};
+
+	Measure("set item count", 1, [&](std::size_t)
+	{
+		list->SetItemCount(itemCount);
+	});
+
+	constexpr std::size_t frameCount = 1000;
+
+	Measure("scroll (small steps)", frameCount, [&](std::size_t frameIndex)
+	{
+		scrollArea->ScrollToHeight(frameIndex * 7.f);
+	});
+
+	Measure("scroll (jumps)", frameCount, [&](std::size_t frameIndex)
+	{
+		scrollArea->ScrollToRatio(float(frameIndex) / frameCount);
+	});
+
+	Measure("append entry", frameCount, [&](std::size_t frameIndex)
+	{
+		list->SetItemCount(itemCount + frameIndex + 1);
+	});
+
+	Measure("variable heights", 1, [&](std::size_t)
+	{
+		list->SetItemHeightCallback([](std::size_t itemIndex)
+		{
+			return 20.f + (itemIndex % 3) * 10.f;
+		});
+	});
+
+	std::cout << "height index: " << (list->GetRowCount() + 1) * sizeof(float) / 1024 << "KiB" << std::endl;
+
+	Measure("scroll with variable heights (jumps)", frameCount, [&](std::size_t frameIndex)
+	{
+		scrollArea->ScrollToRatio(float(frameIndex) / frameCount);
+	});
+
+	Measure("grid (4 columns)", 1, [&](std::size_t)
+	{
+		list->SetColumnCount(4);
+	});
+
+	Measure("scroll grid (jumps)", frameCount, [&](std::size_t frameIndex)
+	{
+		scrollArea->ScrollToRatio(float(frameIndex) / frameCount);
+	});
+
+	return 0;
+}
@@ -0,0 +1,4 @@
+target("VirtualListBenchmark")
+	add_deps("NazaraWidgets")
+	add_packages("entt")
+	add_files("main.cpp")
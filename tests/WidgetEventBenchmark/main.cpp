@@ -0,0 +1,95 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Platform/WindowEventHandler.hpp>
+#include <Nazara/Widgets/Canvas.hpp>
+#include <Nazara/Widgets/Widgets.hpp>
+#include <entt/entity/registry.hpp>
+#include <iostream>
+#include <random>
+
+int main()
+{
+	Nz::Modules<Nz::Widgets> widgets;
+
+	std::cout << "Initializing..." << std::endl;
+
+	entt::registry registry;
+	Nz::WindowEventHandler eventHandler;
+
+	Nz::Canvas canvas(registry, eventHandler, {}, 0xFFFFFFFF);
+	canvas.Resize({ 1920.f, 1080.f });
+
+	// A tool UI: a scrollable list of 10k rows of small widgets, most of them being out of view
+	constexpr std::size_t columnCount = 10;
+	constexpr std::size_t rowCount = 1'000;
+	constexpr Nz::Vector2f cellSize(150.f, 20.f);
+
+	Nz::BaseWidget* list = canvas.Add<Nz::BaseWidget>();
+	list->Resize({ cellSize.x * columnCount, cellSize.y * rowCount });
+
+	for (std::size_t y = 0; y < rowCount; ++y)
+	{
+		for (std::size_t x = 0; x < columnCount; ++x)
+		{
+			Nz::BaseWidget* widget = list->Add<Nz::BaseWidget>();
+			widget->SetPosition({ x * cellSize.x, y * cellSize.y });
+			widget->Resize(cellSize);
+		}
+	}
+
+	std::cout << columnCount * rowCount << " widgets" << std::endl;
+
+	constexpr std::size_t eventCount = 100'000;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<int> xDis(0, 1919);
+	std::uniform_int_distribution<int> yDis(0, 1079);
+
+	auto Measure = [&](const char* name, std::size_t count, auto&& func)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < count; ++i)
+			func();
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		std::cout << name << ": " << Nz::Time::Nanoseconds((end - start).AsNanoseconds() / count) << " per event" << std::endl;
+	};
+
+	Measure("mouse moved", eventCount, [&]
+	{
+		Nz::WindowEvent event;
+		event.type = Nz::WindowEventType::MouseMoved;
+		event.mouseMove.deltaX = 1;
+		event.mouseMove.deltaY = 1;
+		event.mouseMove.x = xDis(randEngine);
+		event.mouseMove.y = yDis(randEngine);
+
+		eventHandler.Dispatch(event);
+	});
+
+	Measure("mouse button pressed and released", eventCount, [&]
+	{
+		Nz::WindowEvent event;
+		event.type = Nz::WindowEventType::MouseButtonPressed;
+		event.mouseButton.button = Nz::Mouse::Left;
+		event.mouseButton.clickCount = 1;
+		event.mouseButton.x = xDis(randEngine);
+		event.mouseButton.y = yDis(randEngine);
+
+		eventHandler.Dispatch(event);
+
+		event.type = Nz::WindowEventType::MouseButtonReleased;
+		eventHandler.Dispatch(event);
+	});
+
+	// Scrolling moves every widget of the list, which have to be moved in the hit-testing grid
+	constexpr std::size_t scrollCount = 100;
+
+	float scrollPosition = 0.f;
+	Measure("list scrolled", scrollCount, [&]
+	{
+		scrollPosition += 7.f;
+		list->SetPosition({ 0.f, -scrollPosition });
+	});
+
+	return 0;
+}
@@ -0,0 +1,4 @@
+target("WidgetEventBenchmark")
+	add_deps("NazaraWidgets")
+	add_packages("entt")
+	add_files("main.cpp")
@@ -0,0 +1,99 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Platform/WindowEventHandler.hpp>
+#include <Nazara/Widgets/BoxLayout.hpp>
+#include <Nazara/Widgets/Canvas.hpp>
+#include <Nazara/Widgets/Widgets.hpp>
+#include <entt/entity/registry.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main()
+{
+	Nz::Modules<Nz::Widgets> widgets;
+
+	std::cout << "Initializing..." << std::endl;
+
+	entt::registry registry;
+	Nz::WindowEventHandler eventHandler;
+
+	Nz::Canvas canvas(registry, eventHandler, {}, 0xFFFFFFFF);
+	canvas.EnableDeferredLayout();
+	canvas.Resize({ 1920.f, 1080.f });
+
+	// A deep tree of nested box layouts, alternating their orientation
+	constexpr std::size_t depth = 6;
+	constexpr std::size_t childCount = 4;
+
+	std::vector<Nz::BaseWidget*> leaves;
+
+	auto BuildTree = [&](auto&& self, Nz::BaseWidget* parent, std::size_t level) -> void
+	{
+		if (level == depth)
+		{
+			for (std::size_t i = 0; i < childCount; ++i)
+				leaves.push_back(parent->Add<Nz::BaseWidget>());
+
+			return;
+		}
+
+		Nz::BoxLayoutOrientation orientation = (level % 2 == 0) ? Nz::BoxLayoutOrientation::LeftToRight : Nz::BoxLayoutOrientation::TopToBottom;
+		for (std::size_t i = 0; i < childCount; ++i)
+			self(self, parent->Add<Nz::BoxLayout>(orientation), level + 1);
+	};
+
+	auto Measure = [&](const char* name, std::size_t count, auto&& func)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			func();
+			canvas.UpdateLayout();
+		}
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		std::cout << name << ": " << Nz::Time::Nanoseconds((end - start).AsNanoseconds() / count) << " per frame" << std::endl;
+	};
+
+	Nz::BoxLayout* root = nullptr;
+	Measure("build tree", 1, [&]
+	{
+		root = canvas.Add<Nz::BoxLayout>(Nz::BoxLayoutOrientation::TopToBottom);
+		root->Resize(canvas.GetSize());
+
+		BuildTree(BuildTree, root, 1);
+	});
+
+	std::cout << leaves.size() << " leaves" << std::endl;
+
+	constexpr std::size_t frameCount = 100;
+
+	float rootWidth = canvas.GetWidth();
+	Measure("resize root", frameCount, [&]
+	{
+		rootWidth = (rootWidth < canvas.GetWidth()) ? canvas.GetWidth() : canvas.GetWidth() - 100.f;
+		root->Resize({ rootWidth, canvas.GetHeight() });
+	});
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<std::size_t> leafDis(0, leaves.size() - 1);
+
+	Measure("toggle one leaf", frameCount, [&]
+	{
+		Nz::BaseWidget* leaf = leaves[leafDis(randEngine)];
+		leaf->Show(!leaf->IsVisible());
+	});
+
+	Measure("toggle 100 leaves", frameCount, [&]
+	{
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			Nz::BaseWidget* leaf = leaves[leafDis(randEngine)];
+			leaf->Show(!leaf->IsVisible());
+		}
+	});
+
+	Measure("idle", frameCount, [] {});
+
+	return 0;
+}
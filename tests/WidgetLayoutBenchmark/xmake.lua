@@ -0,0 +1,4 @@
+target("WidgetLayoutBenchmark")
+	add_deps("NazaraWidgets")
+	add_packages("entt")
+	add_files("main.cpp")
@@ -150,7 +150,8 @@ local modules = {
 				remove_files("src/Nazara/Network/Posix/SocketPollerImpl.hpp")
 				remove_files("src/Nazara/Network/Posix/SocketPollerImpl.cpp")
 			end
-		end
+		end,
+		Packages = { "concurrentqueue", "entt" }
 	},
 	Platform = {
 		Option = "platform",